@@ -0,0 +1,59 @@
+/**********************************************************************************************************************
+ * \file Aes.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * AES-128/192/256 block encryption (FIPS 197), the block cipher under AES-GCM and CTR_DRBG. Only the forward
+ * direction is implemented since both modes use AES in counter mode.
+ *
+ * Rounds use a single 1 KB T-table with rotations, which fits the data cache better than the usual four tables and
+ * costs one rotate per lookup. Table lookups are indexed by key dependent data, so the timing is only constant as
+ * long as the table accesses take the same time, as they do without a data cache.
+ *********************************************************************************************************************/
+
+#ifndef AES_H_
+#define AES_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define AES_BLOCK_SIZE                           16
+#define AES128_KEY_SIZE                          16
+#define AES256_KEY_SIZE                          32
+#define AES_MAX_ROUNDS                           14
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 roundKey[4 * (AES_MAX_ROUNDS + 1)];
+    uint32 rounds;
+} Aes_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Expand a key
+ * \param ctx Cipher state
+ * \param key Key bytes
+ * \param keyLength 16, 24 or 32
+ * \return TRUE on success, FALSE for an invalid key length
+ */
+boolean Aes_Init(Aes_t *ctx, const uint8 *key, uint32 keyLength);
+
+/**
+ * \brief Encrypt one block
+ * \param ctx Cipher state from Aes_Init()
+ * \param input AES_BLOCK_SIZE bytes
+ * \param output AES_BLOCK_SIZE bytes, may be the same as input
+ */
+void Aes_EncryptBlock(const Aes_t *ctx, const uint8 *input, uint8 *output);
+
+#endif /* AES_H_ */
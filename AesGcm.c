@@ -0,0 +1,230 @@
+/**********************************************************************************************************************
+ * \file AesGcm.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * AES-GCM with 4-bit table GHASH
+ *********************************************************************************************************************/
+
+#include "AesGcm.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Reduction of the 4 bits shifted out of the low end, modulo x^128 + x^7 + x^2 + x + 1 in GCM bit order */
+static const uint16 g_gcmReduce[16] = {
+    0x0000, 0x1C20, 0x3840, 0x2460, 0x7080, 0x6CA0, 0x48C0, 0x54E0,
+    0xE100, 0xFD20, 0xD940, 0xC560, 0x9180, 0x8DA0, 0xA9C0, 0xB5E0
+};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static uint64 load64(const uint8 *bytes)
+{
+    uint64 value = 0;
+    uint32 i;
+
+    for (i = 0; i < 8u; i++)
+        value = (value << 8) | bytes[i];
+
+    return value;
+}
+
+static void store64(uint8 *bytes, uint64 value)
+{
+    uint32 i;
+
+    for (i = 0; i < 8u; i++)
+        bytes[7u - i] = (uint8)(value >> (8u * i));
+}
+
+/* Entry i holds i * H, entry 8 being H itself since GCM numbers the bits from the most significant end */
+static void buildTable(AesGcm_t *ctx, const uint8 *h)
+{
+    uint64 high = load64(h);
+    uint64 low  = load64(&h[8]);
+    uint32 i;
+    uint32 j;
+
+    ctx->tableHigh[0] = 0;
+    ctx->tableLow[0]  = 0;
+    ctx->tableHigh[8] = high;
+    ctx->tableLow[8]  = low;
+
+    for (i = 4u; i > 0u; i >>= 1)
+    {
+        uint64 reduce = (low & 1u) ? 0xE100000000000000ULL : 0u;
+
+        low               = (high << 63) | (low >> 1);
+        high              = (high >> 1) ^ reduce;
+        ctx->tableHigh[i] = high;
+        ctx->tableLow[i]  = low;
+    }
+
+    for (i = 2u; i <= 8u; i <<= 1)
+    {
+        for (j = 1u; j < i; j++)
+        {
+            ctx->tableHigh[i + j] = ctx->tableHigh[i] ^ ctx->tableHigh[j];
+            ctx->tableLow[i + j]  = ctx->tableLow[i] ^ ctx->tableLow[j];
+        }
+    }
+}
+
+/* x = x * H, one nibble at a time from the last byte (Shoup) */
+static void multiplyH(const AesGcm_t *ctx, uint8 *x)
+{
+    uint64 high = 0;
+    uint64 low  = 0;
+    sint32 i;
+    uint32 half;
+
+    for (i = AES_BLOCK_SIZE - 1; i >= 0; i--)
+    {
+        for (half = 0; half < 2u; half++)
+        {
+            uint32 nibble = (half == 0u) ? (x[i] & 0x0Fu) : (uint32)(x[i] >> 4);
+            uint32 rem    = (uint32)low & 0x0Fu;
+
+            low  = (high << 60) | (low >> 4);
+            high = (high >> 4) ^ ((uint64)g_gcmReduce[rem] << 48);
+            high ^= ctx->tableHigh[nibble];
+            low  ^= ctx->tableLow[nibble];
+        }
+    }
+
+    store64(x, high);
+    store64(&x[8], low);
+}
+
+static void incrementCounter(uint8 *counter)
+{
+    uint32 i;
+
+    for (i = AES_BLOCK_SIZE - 1u; i >= AES_BLOCK_SIZE - 4u; i--)
+    {
+        if (++counter[i] != 0u)
+            break;
+    }
+}
+
+/* CTR mode and GHASH over the ciphertext, which is the output when encrypting and the input when decrypting */
+static void crypt(AesGcm_t *ctx, const uint8 *input, uint8 *output, uint32 length, boolean encrypt)
+{
+    while (length > 0u)
+    {
+        uint32 position = ctx->length % AES_BLOCK_SIZE;
+        uint32 n        = AES_BLOCK_SIZE - position;
+        uint32 i;
+
+        if (position == 0u)
+        {
+            incrementCounter(ctx->counter);
+            Aes_EncryptBlock(&ctx->aes, ctx->counter, ctx->keystream);
+        }
+
+        if (n > length)
+            n = length;
+
+        for (i = 0; i < n; i++)
+        {
+            uint8 in  = input[i];
+            uint8 out = in ^ ctx->keystream[position + i];
+
+            ctx->hash[position + i] ^= encrypt ? out : in;
+            output[i] = out;
+        }
+
+        if (position + n == AES_BLOCK_SIZE)
+            multiplyH(ctx, ctx->hash);
+
+        ctx->length += n;
+        input       += n;
+        output      += n;
+        length      -= n;
+    }
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+boolean AesGcm_Init(AesGcm_t *ctx, const uint8 *key, uint32 keyLength)
+{
+    uint8 h[AES_BLOCK_SIZE] = {0};
+
+    if (!Aes_Init(&ctx->aes, key, keyLength))
+        return FALSE;
+
+    Aes_EncryptBlock(&ctx->aes, h, h);
+    buildTable(ctx, h);
+
+    return TRUE;
+}
+
+void AesGcm_Start(AesGcm_t *ctx, const uint8 *iv, const uint8 *aad, uint32 aadLength)
+{
+    uint32 i;
+
+    memcpy(ctx->counter, iv, AESGCM_IV_SIZE);
+    ctx->counter[12] = 0;
+    ctx->counter[13] = 0;
+    ctx->counter[14] = 0;
+    ctx->counter[15] = 1;
+    Aes_EncryptBlock(&ctx->aes, ctx->counter, ctx->tagMask);
+
+    memset(ctx->hash, 0, AES_BLOCK_SIZE);
+    for (i = 0; i < aadLength; i++)
+    {
+        ctx->hash[i % AES_BLOCK_SIZE] ^= aad[i];
+        if (i % AES_BLOCK_SIZE == AES_BLOCK_SIZE - 1u || i == aadLength - 1u)
+            multiplyH(ctx, ctx->hash);
+    }
+
+    ctx->aadLength = aadLength;
+    ctx->length    = 0;
+}
+
+void AesGcm_Encrypt(AesGcm_t *ctx, const uint8 *input, uint8 *output, uint32 length)
+{
+    crypt(ctx, input, output, length, TRUE);
+}
+
+void AesGcm_Decrypt(AesGcm_t *ctx, const uint8 *input, uint8 *output, uint32 length)
+{
+    crypt(ctx, input, output, length, FALSE);
+}
+
+void AesGcm_Finish(AesGcm_t *ctx, uint8 *tag)
+{
+    uint8  lengths[AES_BLOCK_SIZE];
+    uint32 i;
+
+    if (ctx->length % AES_BLOCK_SIZE != 0u)
+        multiplyH(ctx, ctx->hash);
+
+    store64(lengths, (uint64)ctx->aadLength * 8u);
+    store64(&lengths[8], (uint64)ctx->length * 8u);
+    for (i = 0; i < AES_BLOCK_SIZE; i++)
+        ctx->hash[i] ^= lengths[i];
+    multiplyH(ctx, ctx->hash);
+
+    for (i = 0; i < AESGCM_TAG_SIZE; i++)
+        tag[i] = ctx->hash[i] ^ ctx->tagMask[i];
+}
+
+boolean AesGcm_CheckTag(AesGcm_t *ctx, const uint8 *tag)
+{
+    uint8  expected[AESGCM_TAG_SIZE];
+    uint8  diff = 0;
+    uint32 i;
+
+    AesGcm_Finish(ctx, expected);
+    for (i = 0; i < AESGCM_TAG_SIZE; i++)
+        diff |= expected[i] ^ tag[i];
+
+    return (diff == 0u) ? TRUE : FALSE;
+}
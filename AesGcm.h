@@ -0,0 +1,99 @@
+/**********************************************************************************************************************
+ * \file AesGcm.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * AES-GCM authenticated encryption (NIST SP 800-38D) with 96-bit IVs and a streaming interface
+ * A message is started with its IV and additional data, then encrypted or decrypted in pieces of any length and
+ * finished with the tag. GHASH uses Shoup's method with a 16 entry table of multiples of H (256 bytes per key),
+ * processing 4 bits per table lookup.
+ *
+ * Decrypted data must not be used before AesGcm_CheckTag() has accepted the tag.
+ *********************************************************************************************************************/
+
+#ifndef AESGCM_H_
+#define AESGCM_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Aes.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define AESGCM_IV_SIZE                           12
+#define AESGCM_TAG_SIZE                          16
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    Aes_t  aes;
+    uint64 tableHigh[16];                   /* Multiples of H by 4-bit values */
+    uint64 tableLow[16];
+    uint8  counter[AES_BLOCK_SIZE];
+    uint8  tagMask[AES_BLOCK_SIZE];         /* Encrypted first counter block  */
+    uint8  hash[AES_BLOCK_SIZE];            /* GHASH accumulator              */
+    uint8  keystream[AES_BLOCK_SIZE];
+    uint32 aadLength;
+    uint32 length;                          /* Bytes of text so far           */
+} AesGcm_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Set the key, once for any number of messages
+ * \param ctx GCM state
+ * \param key Key bytes
+ * \param keyLength AES128_KEY_SIZE or AES256_KEY_SIZE (24 for AES-192 works as well)
+ * \return TRUE on success, FALSE for an invalid key length
+ */
+boolean AesGcm_Init(AesGcm_t *ctx, const uint8 *key, uint32 keyLength);
+
+/**
+ * \brief Start a message
+ * \param ctx GCM state with a key
+ * \param iv AESGCM_IV_SIZE bytes, never used twice with the same key
+ * \param aad Additional authenticated data, NULL_PTR if aadLength is 0
+ * \param aadLength Number of bytes
+ */
+void AesGcm_Start(AesGcm_t *ctx, const uint8 *iv, const uint8 *aad, uint32 aadLength);
+
+/**
+ * \brief Encrypt the next part of the message
+ * \param ctx GCM state
+ * \param input Plaintext
+ * \param output Ciphertext, may be the same buffer as input
+ * \param length Number of bytes
+ */
+void AesGcm_Encrypt(AesGcm_t *ctx, const uint8 *input, uint8 *output, uint32 length);
+
+/**
+ * \brief Decrypt the next part of the message
+ * \param ctx GCM state
+ * \param input Ciphertext
+ * \param output Plaintext, may be the same buffer as input
+ * \param length Number of bytes
+ */
+void AesGcm_Decrypt(AesGcm_t *ctx, const uint8 *input, uint8 *output, uint32 length);
+
+/**
+ * \brief Complete the message and compute its tag
+ * \param ctx GCM state, start the next message with AesGcm_Start()
+ * \param tag Output, AESGCM_TAG_SIZE bytes
+ */
+void AesGcm_Finish(AesGcm_t *ctx, uint8 *tag);
+
+/**
+ * \brief Complete the message and compare its tag in constant time
+ * \param ctx GCM state, start the next message with AesGcm_Start()
+ * \param tag Received tag, AESGCM_TAG_SIZE bytes
+ * \return TRUE if the tag matches
+ */
+boolean AesGcm_CheckTag(AesGcm_t *ctx, const uint8 *tag);
+
+#endif /* AESGCM_H_ */
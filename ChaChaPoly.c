@@ -0,0 +1,371 @@
+/**********************************************************************************************************************
+ * \file ChaChaPoly.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * ChaCha20-Poly1305 with block-wise encryption and 26-bit limb Poly1305
+ *********************************************************************************************************************/
+
+#include "ChaChaPoly.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define ROTL(x, n)                  (((x) << (n)) | ((x) >> (32u - (n))))
+#define POLY_MASK                   0x03FFFFFFu
+#define POLY_HIBIT                  (1uL << 24)     /* 2^128 in the top limb */
+
+/* Four adds, XORs and rotations; the compiler maps each rotation to one DEXTR on TriCore */
+#define QUARTER_ROUND(a, b, c, d)                                                                                   \
+    do                                                                                                              \
+    {                                                                                                               \
+        (a) += (b); (d) ^= (a); (d) = ROTL((d), 16u);                                                               \
+        (c) += (d); (b) ^= (c); (b) = ROTL((b), 12u);                                                               \
+        (a) += (b); (d) ^= (a); (d) = ROTL((d), 8u);                                                                \
+        (c) += (d); (b) ^= (c); (b) = ROTL((b), 7u);                                                                \
+    } while (0)
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static uint32 load32(const uint8 *bytes)
+{
+    return (uint32)bytes[0] | ((uint32)bytes[1] << 8) | ((uint32)bytes[2] << 16) | ((uint32)bytes[3] << 24);
+}
+
+static void store32(uint8 *bytes, uint32 value)
+{
+    bytes[0] = (uint8)value;
+    bytes[1] = (uint8)(value >> 8);
+    bytes[2] = (uint8)(value >> 16);
+    bytes[3] = (uint8)(value >> 24);
+}
+
+/* One ChaCha20 block of the current counter into x, then advance the counter */
+static void chachaBlock(ChaChaPoly_t *ctx, uint32 *x)
+{
+    uint32 x0  = ctx->input[0],  x1  = ctx->input[1],  x2  = ctx->input[2],  x3  = ctx->input[3];
+    uint32 x4  = ctx->input[4],  x5  = ctx->input[5],  x6  = ctx->input[6],  x7  = ctx->input[7];
+    uint32 x8  = ctx->input[8],  x9  = ctx->input[9],  x10 = ctx->input[10], x11 = ctx->input[11];
+    uint32 x12 = ctx->input[12], x13 = ctx->input[13], x14 = ctx->input[14], x15 = ctx->input[15];
+    uint32 i;
+
+    for (i = 0; i < 10u; i++)
+    {
+        QUARTER_ROUND(x0, x4, x8,  x12);
+        QUARTER_ROUND(x1, x5, x9,  x13);
+        QUARTER_ROUND(x2, x6, x10, x14);
+        QUARTER_ROUND(x3, x7, x11, x15);
+        QUARTER_ROUND(x0, x5, x10, x15);
+        QUARTER_ROUND(x1, x6, x11, x12);
+        QUARTER_ROUND(x2, x7, x8,  x13);
+        QUARTER_ROUND(x3, x4, x9,  x14);
+    }
+
+    x[0]  = x0  + ctx->input[0];  x[1]  = x1  + ctx->input[1];
+    x[2]  = x2  + ctx->input[2];  x[3]  = x3  + ctx->input[3];
+    x[4]  = x4  + ctx->input[4];  x[5]  = x5  + ctx->input[5];
+    x[6]  = x6  + ctx->input[6];  x[7]  = x7  + ctx->input[7];
+    x[8]  = x8  + ctx->input[8];  x[9]  = x9  + ctx->input[9];
+    x[10] = x10 + ctx->input[10]; x[11] = x11 + ctx->input[11];
+    x[12] = x12 + ctx->input[12]; x[13] = x13 + ctx->input[13];
+    x[14] = x14 + ctx->input[14]; x[15] = x15 + ctx->input[15];
+
+    ctx->input[12]++;
+}
+
+/* Whole blocks, XORed a word at a time straight from input to output */
+static void chachaBlocks(ChaChaPoly_t *ctx, const uint8 *input, uint8 *output, uint32 blocks)
+{
+    uint32 x[16];
+    uint32 i;
+
+    while (blocks-- > 0u)
+    {
+        chachaBlock(ctx, x);
+        for (i = 0; i < 16u; i++)
+            store32(&output[4u * i], load32(&input[4u * i]) ^ x[i]);
+
+        input  += CHACHA_BLOCK_SIZE;
+        output += CHACHA_BLOCK_SIZE;
+    }
+}
+
+/* h = (h + block + 2^128) * r mod 2^130 - 5 for each 16 byte block, all blocks are full as the text is padded */
+static void polyBlocks(ChaChaPoly_t *ctx, const uint8 *data, uint32 blocks)
+{
+    uint32 r0 = ctx->r[0], r1 = ctx->r[1], r2 = ctx->r[2], r3 = ctx->r[3], r4 = ctx->r[4];
+    uint32 s1 = r1 * 5u, s2 = r2 * 5u, s3 = r3 * 5u, s4 = r4 * 5u;
+    uint32 h0 = ctx->h[0], h1 = ctx->h[1], h2 = ctx->h[2], h3 = ctx->h[3], h4 = ctx->h[4];
+    uint64 d0, d1, d2, d3, d4;
+    uint32 c;
+
+    while (blocks-- > 0u)
+    {
+        h0 += load32(&data[0]) & POLY_MASK;
+        h1 += (load32(&data[3]) >> 2) & POLY_MASK;
+        h2 += (load32(&data[6]) >> 4) & POLY_MASK;
+        h3 += (load32(&data[9]) >> 6) & POLY_MASK;
+        h4 += (load32(&data[12]) >> 8) | POLY_HIBIT;
+
+        d0 = (uint64)h0 * r0 + (uint64)h1 * s4 + (uint64)h2 * s3 + (uint64)h3 * s2 + (uint64)h4 * s1;
+        d1 = (uint64)h0 * r1 + (uint64)h1 * r0 + (uint64)h2 * s4 + (uint64)h3 * s3 + (uint64)h4 * s2;
+        d2 = (uint64)h0 * r2 + (uint64)h1 * r1 + (uint64)h2 * r0 + (uint64)h3 * s4 + (uint64)h4 * s3;
+        d3 = (uint64)h0 * r3 + (uint64)h1 * r2 + (uint64)h2 * r1 + (uint64)h3 * r0 + (uint64)h4 * s4;
+        d4 = (uint64)h0 * r4 + (uint64)h1 * r3 + (uint64)h2 * r2 + (uint64)h3 * r1 + (uint64)h4 * r0;
+
+        c = (uint32)(d0 >> 26); h0 = (uint32)d0 & POLY_MASK;
+        d1 += c; c = (uint32)(d1 >> 26); h1 = (uint32)d1 & POLY_MASK;
+        d2 += c; c = (uint32)(d2 >> 26); h2 = (uint32)d2 & POLY_MASK;
+        d3 += c; c = (uint32)(d3 >> 26); h3 = (uint32)d3 & POLY_MASK;
+        d4 += c; c = (uint32)(d4 >> 26); h4 = (uint32)d4 & POLY_MASK;
+        h0 += c * 5u; c = h0 >> 26; h0 &= POLY_MASK;
+        h1 += c;
+
+        data += POLY1305_BLOCK_SIZE;
+    }
+
+    ctx->h[0] = h0;
+    ctx->h[1] = h1;
+    ctx->h[2] = h2;
+    ctx->h[3] = h3;
+    ctx->h[4] = h4;
+}
+
+static void polyUpdate(ChaChaPoly_t *ctx, const uint8 *data, uint32 length)
+{
+    uint32 n;
+
+    if (ctx->blockLength > 0u)
+    {
+        n = POLY1305_BLOCK_SIZE - ctx->blockLength;
+        if (n > length)
+            n = length;
+
+        memcpy(&ctx->block[ctx->blockLength], data, n);
+        ctx->blockLength += n;
+        data             += n;
+        length           -= n;
+
+        if (ctx->blockLength < POLY1305_BLOCK_SIZE)
+            return;
+
+        polyBlocks(ctx, ctx->block, 1u);
+        ctx->blockLength = 0;
+    }
+
+    n = length / POLY1305_BLOCK_SIZE;
+    polyBlocks(ctx, data, n);
+
+    ctx->blockLength = length % POLY1305_BLOCK_SIZE;
+    memcpy(ctx->block, &data[n * POLY1305_BLOCK_SIZE], ctx->blockLength);
+}
+
+/* RFC 8439 pads the additional data and the text with zeros to whole blocks */
+static void polyPad(ChaChaPoly_t *ctx)
+{
+    if (ctx->blockLength > 0u)
+    {
+        memset(&ctx->block[ctx->blockLength], 0, POLY1305_BLOCK_SIZE - ctx->blockLength);
+        polyBlocks(ctx, ctx->block, 1u);
+        ctx->blockLength = 0;
+    }
+}
+
+/* Continue the keystream at the current text position, whole blocks go straight from input to output */
+static void xorKeystream(ChaChaPoly_t *ctx, const uint8 *input, uint8 *output, uint32 length)
+{
+    uint32 x[16];
+    uint32 offset;
+    uint32 n;
+    uint32 i;
+
+    while (length > 0u)
+    {
+        offset = ctx->length % CHACHA_BLOCK_SIZE;
+
+        if (offset == 0u && length >= CHACHA_BLOCK_SIZE)
+        {
+            n = length - length % CHACHA_BLOCK_SIZE;
+            chachaBlocks(ctx, input, output, n / CHACHA_BLOCK_SIZE);
+        }
+        else
+        {
+            if (offset == 0u)
+            {
+                chachaBlock(ctx, x);
+                for (i = 0; i < 16u; i++)
+                    store32(&ctx->keystream[4u * i], x[i]);
+            }
+
+            n = CHACHA_BLOCK_SIZE - offset;
+            if (n > length)
+                n = length;
+
+            for (i = 0; i < n; i++)
+                output[i] = input[i] ^ ctx->keystream[offset + i];
+        }
+
+        ctx->length += n;
+        input       += n;
+        output      += n;
+        length      -= n;
+    }
+}
+
+/* Poly1305 always covers the ciphertext, read before it is overwritten when decrypting in place */
+static void crypt(ChaChaPoly_t *ctx, const uint8 *input, uint8 *output, uint32 length, boolean encrypt)
+{
+    if (!encrypt)
+        polyUpdate(ctx, input, length);
+
+    xorKeystream(ctx, input, output, length);
+
+    if (encrypt)
+        polyUpdate(ctx, output, length);
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+void ChaChaPoly_Init(ChaChaPoly_t *ctx, const uint8 *key)
+{
+    uint32 i;
+
+    ctx->input[0] = 0x61707865uL;   /* "expand 32-byte k" */
+    ctx->input[1] = 0x3320646EuL;
+    ctx->input[2] = 0x79622D32uL;
+    ctx->input[3] = 0x6B206574uL;
+
+    for (i = 0; i < 8u; i++)
+        ctx->input[4u + i] = load32(&key[4u * i]);
+}
+
+void ChaChaPoly_Start(ChaChaPoly_t *ctx, const uint8 *nonce, const uint8 *aad, uint32 aadLength)
+{
+    uint32 x[16];
+
+    ctx->input[12] = 0;
+    ctx->input[13] = load32(&nonce[0]);
+    ctx->input[14] = load32(&nonce[4]);
+    ctx->input[15] = load32(&nonce[8]);
+
+    /* Block 0 gives the one-time Poly1305 key, the text starts with block 1 */
+    chachaBlock(ctx, x);
+    ctx->r[0]   = x[0] & 0x03FFFFFFu;
+    ctx->r[1]   = ((x[0] >> 26) | (x[1] << 6)) & 0x03FFFF03u;
+    ctx->r[2]   = ((x[1] >> 20) | (x[2] << 12)) & 0x03FFC0FFu;
+    ctx->r[3]   = ((x[2] >> 14) | (x[3] << 18)) & 0x03F03FFFu;
+    ctx->r[4]   = (x[3] >> 8) & 0x000FFFFFu;
+    ctx->pad[0] = x[4];
+    ctx->pad[1] = x[5];
+    ctx->pad[2] = x[6];
+    ctx->pad[3] = x[7];
+    memset(ctx->h, 0, sizeof(ctx->h));
+    memset(x, 0, sizeof(x));
+
+    ctx->blockLength = 0;
+    if (aadLength > 0u)
+        polyUpdate(ctx, aad, aadLength);
+    polyPad(ctx);
+
+    ctx->aadLength = aadLength;
+    ctx->length    = 0;
+}
+
+void ChaChaPoly_Encrypt(ChaChaPoly_t *ctx, const uint8 *input, uint8 *output, uint32 length)
+{
+    crypt(ctx, input, output, length, TRUE);
+}
+
+void ChaChaPoly_Decrypt(ChaChaPoly_t *ctx, const uint8 *input, uint8 *output, uint32 length)
+{
+    crypt(ctx, input, output, length, FALSE);
+}
+
+void ChaChaPoly_Finish(ChaChaPoly_t *ctx, uint8 *tag)
+{
+    uint8  lengths[POLY1305_BLOCK_SIZE] = {0};
+    uint32 h0, h1, h2, h3, h4;
+    uint32 g0, g1, g2, g3, g4;
+    uint32 c;
+    uint32 mask;
+    uint64 f;
+
+    polyPad(ctx);
+    store32(&lengths[0], ctx->aadLength);
+    store32(&lengths[8], ctx->length);
+    polyBlocks(ctx, lengths, 1u);
+
+    /* Full carry, then subtract p = 2^130 - 5 if h >= p without branching */
+    h0 = ctx->h[0]; h1 = ctx->h[1]; h2 = ctx->h[2]; h3 = ctx->h[3]; h4 = ctx->h[4];
+    c = h1 >> 26; h1 &= POLY_MASK;
+    h2 += c; c = h2 >> 26; h2 &= POLY_MASK;
+    h3 += c; c = h3 >> 26; h3 &= POLY_MASK;
+    h4 += c; c = h4 >> 26; h4 &= POLY_MASK;
+    h0 += c * 5u; c = h0 >> 26; h0 &= POLY_MASK;
+    h1 += c;
+
+    g0 = h0 + 5u; c = g0 >> 26; g0 &= POLY_MASK;
+    g1 = h1 + c;  c = g1 >> 26; g1 &= POLY_MASK;
+    g2 = h2 + c;  c = g2 >> 26; g2 &= POLY_MASK;
+    g3 = h3 + c;  c = g3 >> 26; g3 &= POLY_MASK;
+    g4 = h4 + c - (1uL << 26);
+
+    mask = (g4 >> 31) - 1u;     /* All ones if h >= p */
+    h0   = (h0 & ~mask) | (g0 & mask);
+    h1   = (h1 & ~mask) | (g1 & mask);
+    h2   = (h2 & ~mask) | (g2 & mask);
+    h3   = (h3 & ~mask) | (g3 & mask);
+    h4   = (h4 & ~mask) | (g4 & mask);
+
+    /* tag = (h + pad) mod 2^128 */
+    f = (uint64)(h0 | (h1 << 26)) + ctx->pad[0];
+    store32(&tag[0], (uint32)f);
+    f = (uint64)((h1 >> 6) | (h2 << 20)) + ctx->pad[1] + (f >> 32);
+    store32(&tag[4], (uint32)f);
+    f = (uint64)((h2 >> 12) | (h3 << 14)) + ctx->pad[2] + (f >> 32);
+    store32(&tag[8], (uint32)f);
+    f = (uint64)((h3 >> 18) | (h4 << 8)) + ctx->pad[3] + (f >> 32);
+    store32(&tag[12], (uint32)f);
+}
+
+boolean ChaChaPoly_CheckTag(ChaChaPoly_t *ctx, const uint8 *tag)
+{
+    uint8  expected[CHACHAPOLY_TAG_SIZE];
+    uint8  diff = 0;
+    uint32 i;
+
+    ChaChaPoly_Finish(ctx, expected);
+    for (i = 0; i < CHACHAPOLY_TAG_SIZE; i++)
+        diff |= expected[i] ^ tag[i];
+
+    return (diff == 0u) ? TRUE : FALSE;
+}
+
+void ChaChaPoly_Seal(ChaChaPoly_t *ctx, const uint8 *nonce, const uint8 *aad, uint32 aadLength, uint8 *data,
+                     uint32 length, uint8 *tag)
+{
+    ChaChaPoly_Start(ctx, nonce, aad, aadLength);
+    crypt(ctx, data, data, length, TRUE);
+    ChaChaPoly_Finish(ctx, tag);
+}
+
+boolean ChaChaPoly_Open(ChaChaPoly_t *ctx, const uint8 *nonce, const uint8 *aad, uint32 aadLength, uint8 *data,
+                        uint32 length, const uint8 *tag)
+{
+    ChaChaPoly_Start(ctx, nonce, aad, aadLength);
+
+    /* Authenticate first, the keystream does not depend on it and still starts at block 1 */
+    polyUpdate(ctx, data, length);
+    ctx->length = length;
+    if (!ChaChaPoly_CheckTag(ctx, tag))
+        return FALSE;
+
+    ctx->length = 0;
+    xorKeystream(ctx, data, data, length);
+
+    return TRUE;
+}
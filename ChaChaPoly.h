@@ -0,0 +1,128 @@
+/**********************************************************************************************************************
+ * \file ChaChaPoly.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * ChaCha20-Poly1305 authenticated encryption (RFC 8439) for the TLS 1.3 record layer
+ * A cipher suite that needs no AES hardware: ChaCha20 only adds, rotates and XORs 32-bit words, and Poly1305 is
+ * computed in five 26-bit limbs with 32x32->64 bit multiplies, both native on TriCore. Whole 64 byte blocks of
+ * the message are encrypted and authenticated word by word without a keystream copy, only the ends of a piece
+ * that is not block aligned go through a buffer.
+ *
+ * The streaming interface matches AesGcm.h. ChaChaPoly_Seal() and ChaChaPoly_Open() process a whole record in
+ * place; Open checks the tag before decrypting, so a rejected record is left as it was received.
+ *********************************************************************************************************************/
+
+#ifndef CHACHAPOLY_H_
+#define CHACHAPOLY_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define CHACHAPOLY_KEY_SIZE                      32
+#define CHACHAPOLY_NONCE_SIZE                    12
+#define CHACHAPOLY_TAG_SIZE                      16
+#define CHACHA_BLOCK_SIZE                        64
+#define POLY1305_BLOCK_SIZE                      16
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 input[16];                       /* ChaCha20 state: constants, key, counter, nonce */
+    uint8  keystream[CHACHA_BLOCK_SIZE];    /* Block used by a piece that is not aligned      */
+    uint32 r[5];                            /* Poly1305 key in 26-bit limbs                   */
+    uint32 h[5];                            /* Poly1305 accumulator                           */
+    uint32 pad[4];
+    uint8  block[POLY1305_BLOCK_SIZE];      /* Partial block of text to authenticate          */
+    uint32 blockLength;
+    uint32 aadLength;
+    uint32 length;                          /* Bytes of text so far                           */
+} ChaChaPoly_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Set the key, once for any number of messages
+ * \param ctx Cipher state
+ * \param key CHACHAPOLY_KEY_SIZE bytes
+ */
+void ChaChaPoly_Init(ChaChaPoly_t *ctx, const uint8 *key);
+
+/**
+ * \brief Start a message
+ * \param ctx Cipher state with a key
+ * \param nonce CHACHAPOLY_NONCE_SIZE bytes, never used twice with the same key (TLS: IV XOR sequence number)
+ * \param aad Additional authenticated data, NULL_PTR if aadLength is 0
+ * \param aadLength Number of bytes
+ */
+void ChaChaPoly_Start(ChaChaPoly_t *ctx, const uint8 *nonce, const uint8 *aad, uint32 aadLength);
+
+/**
+ * \brief Encrypt the next part of the message
+ * \param ctx Cipher state
+ * \param input Plaintext
+ * \param output Ciphertext, may be the same buffer as input
+ * \param length Number of bytes
+ */
+void ChaChaPoly_Encrypt(ChaChaPoly_t *ctx, const uint8 *input, uint8 *output, uint32 length);
+
+/**
+ * \brief Decrypt the next part of the message
+ * \param ctx Cipher state
+ * \param input Ciphertext
+ * \param output Plaintext, may be the same buffer as input
+ * \param length Number of bytes
+ */
+void ChaChaPoly_Decrypt(ChaChaPoly_t *ctx, const uint8 *input, uint8 *output, uint32 length);
+
+/**
+ * \brief Complete the message and compute its tag
+ * \param ctx Cipher state, start the next message with ChaChaPoly_Start()
+ * \param tag Output, CHACHAPOLY_TAG_SIZE bytes
+ */
+void ChaChaPoly_Finish(ChaChaPoly_t *ctx, uint8 *tag);
+
+/**
+ * \brief Complete the message and compare its tag in constant time
+ * \param ctx Cipher state, start the next message with ChaChaPoly_Start()
+ * \param tag Received tag, CHACHAPOLY_TAG_SIZE bytes
+ * \return TRUE if the tag matches
+ */
+boolean ChaChaPoly_CheckTag(ChaChaPoly_t *ctx, const uint8 *tag);
+
+/**
+ * \brief Encrypt a whole record in place
+ * \param ctx Cipher state with a key
+ * \param nonce CHACHAPOLY_NONCE_SIZE bytes
+ * \param aad Additional authenticated data, e.g. the TLS record header
+ * \param aadLength Number of bytes
+ * \param data Plaintext, replaced by the ciphertext
+ * \param length Number of bytes
+ * \param tag Output, CHACHAPOLY_TAG_SIZE bytes
+ */
+void ChaChaPoly_Seal(ChaChaPoly_t *ctx, const uint8 *nonce, const uint8 *aad, uint32 aadLength, uint8 *data,
+                     uint32 length, uint8 *tag);
+
+/**
+ * \brief Check and decrypt a whole record in place
+ * \param ctx Cipher state with a key
+ * \param nonce CHACHAPOLY_NONCE_SIZE bytes
+ * \param aad Additional authenticated data, e.g. the TLS record header
+ * \param aadLength Number of bytes
+ * \param data Ciphertext, replaced by the plaintext if the tag matches
+ * \param length Number of bytes
+ * \param tag Received tag, CHACHAPOLY_TAG_SIZE bytes
+ * \return TRUE if the tag matches, FALSE otherwise with data unchanged
+ */
+boolean ChaChaPoly_Open(ChaChaPoly_t *ctx, const uint8 *nonce, const uint8 *aad, uint32 aadLength, uint8 *data,
+                        uint32 length, const uint8 *tag);
+
+#endif /* CHACHAPOLY_H_ */
@@ -28,6 +28,8 @@
 #include "IfxCpu.h"
 #include "IfxScuWdt.h"
 #include "Ifx_Cfg_Ssw.h"
+#include "Ota_Pipeline.h"
+#include "Ota_DualVerify.h"
 
 extern IfxCpu_syncEvent cpuSyncEvent;
 
@@ -44,7 +46,10 @@ void core1_main(void)
     IfxCpu_emitEvent(&cpuSyncEvent);
     IfxCpu_waitEvent(&cpuSyncEvent, 1);
     
+    /* Hash the OTA chunks core 0 submits and check ML-DSA signatures, see Ota_Pipeline.h and Ota_DualVerify.h */
     while(1)
     {
+        Ota_Pipeline_Service();
+        Ota_DualVerify_ServiceMlDsa();
     }
 }
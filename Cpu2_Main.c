@@ -28,6 +28,7 @@
 #include "IfxCpu.h"
 #include "IfxScuWdt.h"
 #include "Ifx_Cfg_Ssw.h"
+#include "Ota_DualVerify.h"
 
 extern IfxCpu_syncEvent cpuSyncEvent;
 
@@ -44,7 +45,9 @@ void core2_main(void)
     IfxCpu_emitEvent(&cpuSyncEvent);
     IfxCpu_waitEvent(&cpuSyncEvent, 1);
     
+    /* Check ECDSA signatures of OTA manifests, see Ota_DualVerify.h */
     while(1)
     {
+        Ota_DualVerify_ServiceEcdsa();
     }
 }
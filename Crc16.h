@@ -0,0 +1,43 @@
+/**********************************************************************************************************************
+ * \file Crc16.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ * 
+ * Table driven CRC-16 (polynomial 0xA001 reflected, init 0xFFFF) used to protect records stored in Flash4.
+ * The result is identical to the bitwise calculateCRC16() of the examples, one table lookup per byte.
+ *********************************************************************************************************************/
+
+#ifndef CRC16_H_
+#define CRC16_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define CRC16_INIT_VALUE                         0xFFFF
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Continue a CRC-16 over a buffer
+ * \param crc Running CRC value (CRC16_INIT_VALUE for the first call)
+ * \param data Input data
+ * \param length Number of bytes
+ * \return Updated CRC value
+ */
+uint16 Crc16_Update(uint16 crc, const uint8 *data, uint32 length);
+
+/**
+ * \brief Calculate the CRC-16 of a buffer
+ * \param data Input data
+ * \param length Number of bytes
+ * \return CRC value
+ */
+uint16 Crc16_Calculate(const uint8 *data, uint32 length);
+
+#endif /* CRC16_H_ */
@@ -0,0 +1,280 @@
+/**********************************************************************************************************************
+ * \file CtrDrbg.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * CTR_DRBG with AES-256 and Block_Cipher_df, random pool
+ *********************************************************************************************************************/
+
+#include "CtrDrbg.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define CTRDRBG_DF_CHAINS           3           /* BCC outputs for a key and a block, 48 bytes  */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    Aes_t  aes;
+    uint8  chain[CTRDRBG_DF_CHAINS][AES_BLOCK_SIZE];    /* BCC with the IVs 0, 1 and 2 in parallel */
+    uint8  block[AES_BLOCK_SIZE];
+    uint32 blockLength;
+} CtrDrbg_Df_t;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Fixed key of Block_Cipher_df: 00 01 02 ... 1F */
+static const uint8 g_dfKey[AES256_KEY_SIZE] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F
+};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* V = V + 1 mod 2^128, big endian */
+static void incrementCounter(uint8 *v)
+{
+    sint32 i;
+
+    for (i = AES_BLOCK_SIZE - 1; i >= 0; i--)
+    {
+        if (++v[i] != 0u)
+            break;
+    }
+}
+
+/* CTR_DRBG_Update: key and counter from the next 48 bytes of keystream XOR provided, NULL_PTR for zeros */
+static void update(CtrDrbg_t *ctx, const uint8 *provided)
+{
+    uint8  temp[CTRDRBG_SEED_SIZE];
+    uint32 i;
+
+    for (i = 0; i < CTRDRBG_SEED_SIZE; i += AES_BLOCK_SIZE)
+    {
+        incrementCounter(ctx->v);
+        Aes_EncryptBlock(&ctx->aes, ctx->v, &temp[i]);
+    }
+
+    if (provided != NULL_PTR)
+    {
+        for (i = 0; i < CTRDRBG_SEED_SIZE; i++)
+            temp[i] ^= provided[i];
+    }
+
+    (void)Aes_Init(&ctx->aes, temp, AES256_KEY_SIZE);
+    memcpy(ctx->v, &temp[AES256_KEY_SIZE], AES_BLOCK_SIZE);
+    memset(temp, 0, sizeof(temp));
+}
+
+/* Feed bytes of S to all three BCC chains */
+static void dfAbsorb(CtrDrbg_Df_t *df, const uint8 *data, uint32 length)
+{
+    uint32 i;
+    uint32 j;
+    uint32 k;
+
+    for (i = 0; i < length; i++)
+    {
+        df->block[df->blockLength++] = data[i];
+        if (df->blockLength == AES_BLOCK_SIZE)
+        {
+            for (j = 0; j < CTRDRBG_DF_CHAINS; j++)
+            {
+                for (k = 0; k < AES_BLOCK_SIZE; k++)
+                    df->chain[j][k] ^= df->block[k];
+                Aes_EncryptBlock(&df->aes, df->chain[j], df->chain[j]);
+            }
+            df->blockLength = 0;
+        }
+    }
+}
+
+/*
+ * Block_Cipher_df of first || second to CTRDRBG_SEED_SIZE bytes. S = L || N || input || 0x80 || zeros is streamed
+ * through the three BCC chains at once instead of being built in memory.
+ */
+static void derive(uint8 *seed, const uint8 *first, uint32 firstLength, const uint8 *second, uint32 secondLength)
+{
+    static const uint8 pad[AES_BLOCK_SIZE] = {0x80};
+    CtrDrbg_Df_t df;
+    uint8        header[8];
+    uint32       length = firstLength + secondLength;
+    uint32       i;
+
+    (void)Aes_Init(&df.aes, g_dfKey, AES256_KEY_SIZE);
+    for (i = 0; i < CTRDRBG_DF_CHAINS; i++)
+    {
+        memset(df.chain[i], 0, AES_BLOCK_SIZE);
+        df.chain[i][3] = (uint8)i;
+        Aes_EncryptBlock(&df.aes, df.chain[i], df.chain[i]);
+    }
+    df.blockLength = 0;
+
+    header[0] = (uint8)(length >> 24);
+    header[1] = (uint8)(length >> 16);
+    header[2] = (uint8)(length >> 8);
+    header[3] = (uint8)length;
+    header[4] = 0;
+    header[5] = 0;
+    header[6] = 0;
+    header[7] = CTRDRBG_SEED_SIZE;
+    dfAbsorb(&df, header, sizeof(header));
+    dfAbsorb(&df, first, firstLength);
+    dfAbsorb(&df, second, secondLength);
+    dfAbsorb(&df, pad, AES_BLOCK_SIZE - df.blockLength);
+
+    /* The chains give the key and the first block, the seed is that block encrypted three times in a row */
+    (void)Aes_Init(&df.aes, df.chain[0], AES256_KEY_SIZE);
+    Aes_EncryptBlock(&df.aes, df.chain[2], seed);
+    for (i = AES_BLOCK_SIZE; i < CTRDRBG_SEED_SIZE; i += AES_BLOCK_SIZE)
+        Aes_EncryptBlock(&df.aes, &seed[i - AES_BLOCK_SIZE], &seed[i]);
+
+    memset(&df, 0, sizeof(df));
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+boolean CtrDrbg_Instantiate(CtrDrbg_t *ctx, const uint8 *entropy, uint32 entropyLength, const uint8 *personalization,
+                            uint32 personalizationLength)
+{
+    static const uint8 zeroKey[AES256_KEY_SIZE] = {0};
+    uint8 seed[CTRDRBG_SEED_SIZE];
+
+    if (entropyLength < CTRDRBG_MIN_ENTROPY_SIZE)
+        return FALSE;
+
+    derive(seed, entropy, entropyLength, personalization, personalizationLength);
+    (void)Aes_Init(&ctx->aes, zeroKey, AES256_KEY_SIZE);
+    memset(ctx->v, 0, AES_BLOCK_SIZE);
+    update(ctx, seed);
+    ctx->reseedCounter = 1;
+    memset(seed, 0, sizeof(seed));
+
+    return TRUE;
+}
+
+boolean CtrDrbg_Reseed(CtrDrbg_t *ctx, const uint8 *entropy, uint32 entropyLength, const uint8 *additional,
+                       uint32 additionalLength)
+{
+    uint8 seed[CTRDRBG_SEED_SIZE];
+
+    if (ctx->reseedCounter == 0u || entropyLength < AES256_KEY_SIZE)
+        return FALSE;
+
+    derive(seed, entropy, entropyLength, additional, additionalLength);
+    update(ctx, seed);
+    ctx->reseedCounter = 1;
+    memset(seed, 0, sizeof(seed));
+
+    return TRUE;
+}
+
+boolean CtrDrbg_Generate(CtrDrbg_t *ctx, uint8 *output, uint32 length, const uint8 *additional,
+                         uint32 additionalLength)
+{
+    uint8 seed[CTRDRBG_SEED_SIZE];
+    uint8 block[AES_BLOCK_SIZE];
+
+    if (ctx->reseedCounter == 0u || ctx->reseedCounter > CTRDRBG_RESEED_INTERVAL ||
+        length > CTRDRBG_MAX_REQUEST_SIZE)
+        return FALSE;
+
+    if (additionalLength > 0u)
+    {
+        derive(seed, additional, additionalLength, NULL_PTR, 0u);
+        update(ctx, seed);
+    }
+
+    /* Whole blocks are encrypted straight into the output */
+    while (length >= AES_BLOCK_SIZE)
+    {
+        incrementCounter(ctx->v);
+        Aes_EncryptBlock(&ctx->aes, ctx->v, output);
+        output += AES_BLOCK_SIZE;
+        length -= AES_BLOCK_SIZE;
+    }
+    if (length > 0u)
+    {
+        incrementCounter(ctx->v);
+        Aes_EncryptBlock(&ctx->aes, ctx->v, block);
+        memcpy(output, block, length);
+        memset(block, 0, sizeof(block));
+    }
+
+    update(ctx, (additionalLength > 0u) ? seed : NULL_PTR);
+    ctx->reseedCounter++;
+    memset(seed, 0, sizeof(seed));
+
+    return TRUE;
+}
+
+boolean CtrDrbg_PoolInit(CtrDrbg_Pool_t *pool, CtrDrbg_EntropySource source, const uint8 *personalization,
+                         uint32 personalizationLength)
+{
+    uint8   entropy[CTRDRBG_POOL_ENTROPY_SIZE + CTRDRBG_POOL_NONCE_SIZE];
+    boolean seeded;
+
+    memset(pool, 0, sizeof(CtrDrbg_Pool_t));
+    pool->source = source;
+
+    seeded = source(entropy, sizeof(entropy)) &&
+             CtrDrbg_Instantiate(&pool->drbg, entropy, sizeof(entropy), personalization, personalizationLength);
+    memset(entropy, 0, sizeof(entropy));
+    if (!seeded)
+        return FALSE;
+
+    return CtrDrbg_Refill(pool);
+}
+
+boolean CtrDrbg_Read(CtrDrbg_Pool_t *pool, uint8 *data, uint32 length)
+{
+    if (length > pool->available)
+        return FALSE;
+
+    /* Bytes are taken from the top and cleared, so no output stays in memory after it was handed out */
+    pool->available -= length;
+    memcpy(data, &pool->data[pool->available], length);
+    memset(&pool->data[pool->available], 0, length);
+
+    return TRUE;
+}
+
+boolean CtrDrbg_Refill(CtrDrbg_Pool_t *pool)
+{
+    uint8   entropy[CTRDRBG_POOL_ENTROPY_SIZE];
+    boolean seeded;
+
+    if (pool->available == CTRDRBG_POOL_SIZE)
+        return TRUE;
+
+    if (pool->drbg.reseedCounter > CTRDRBG_RESEED_INTERVAL)
+    {
+        seeded = pool->source(entropy, sizeof(entropy)) &&
+                 CtrDrbg_Reseed(&pool->drbg, entropy, sizeof(entropy), NULL_PTR, 0u);
+        memset(entropy, 0, sizeof(entropy));
+        if (!seeded)
+            return FALSE;
+    }
+
+    /* One request for the whole gap, so the key update is paid once per batch rather than once per read */
+    if (!CtrDrbg_Generate(&pool->drbg, &pool->data[pool->available], CTRDRBG_POOL_SIZE - pool->available, NULL_PTR,
+                          0u))
+        return FALSE;
+    pool->available = CTRDRBG_POOL_SIZE;
+
+    return TRUE;
+}
+
+uint32 CtrDrbg_GetAvailable(const CtrDrbg_Pool_t *pool)
+{
+    return pool->available;
+}
@@ -0,0 +1,135 @@
+/**********************************************************************************************************************
+ * \file CtrDrbg.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * CTR_DRBG random bit generator (NIST SP 800-90A) with AES-256 and the derivation function, for key pairs and
+ * nonces in place of the LCG of IfxCpu_getRandomValue()
+ * The derivation function condenses entropy input of any length, so a raw noise source needs no conditioning of
+ * its own. Every request ends with an update of key and counter, so earlier output cannot be recomputed from a
+ * later state (backtracking resistance); after CTRDRBG_RESEED_INTERVAL requests the generator refuses output until
+ * it is reseeded.
+ *
+ * On top of the generator, CtrDrbg_Pool_t keeps a buffer of output generated in batches of CTRDRBG_POOL_SIZE
+ * bytes. CtrDrbg_Refill() runs from the idle loop and does all AES work and reseeding, CtrDrbg_Read() only copies
+ * bytes out of the pool and clears them, so a handshake draws its key material without blocking on the cipher.
+ * Both are called from the same core and not from interrupts, like the Flash4 scrubber.
+ *********************************************************************************************************************/
+
+#ifndef CTRDRBG_H_
+#define CTRDRBG_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Aes.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define CTRDRBG_SEED_SIZE                        48          /* Key and counter, seedlen of AES-256             */
+#define CTRDRBG_MIN_ENTROPY_SIZE                 48          /* 256 bits of entropy and a 128 bit nonce         */
+#define CTRDRBG_MAX_REQUEST_SIZE                 65536uL     /* Bytes per CtrDrbg_Generate(), 2^19 bits         */
+#define CTRDRBG_RESEED_INTERVAL                  1000000uL   /* Requests between reseeds, far below 2^48        */
+#define CTRDRBG_POOL_SIZE                        256         /* Bytes generated per refill                      */
+#define CTRDRBG_POOL_ENTROPY_SIZE                64          /* Source bytes per reseed, 256 bits at 4 per byte */
+#define CTRDRBG_POOL_NONCE_SIZE                  32          /* Additional source bytes when instantiating      */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    Aes_t  aes;                             /* Expanded key                               */
+    uint8  v[AES_BLOCK_SIZE];               /* Counter                                    */
+    uint32 reseedCounter;                   /* 1 + requests since seeding, 0 if unseeded  */
+} CtrDrbg_t;
+
+/**
+ * \brief Entropy source of a pool, e.g. the TRNG of the HSM or sampled noise
+ * \param data Output
+ * \param length Number of bytes, the source should deliver at least 4 bits of min-entropy per byte
+ * \return TRUE if the bytes were delivered, FALSE if the source failed its health check
+ */
+typedef boolean (*CtrDrbg_EntropySource)(uint8 *data, uint32 length);
+
+typedef struct
+{
+    CtrDrbg_t             drbg;
+    CtrDrbg_EntropySource source;
+    uint8                 data[CTRDRBG_POOL_SIZE];  /* Unread bytes are data[0 .. available - 1] */
+    uint32                available;
+} CtrDrbg_Pool_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Seed a generator
+ * \param ctx Generator state
+ * \param entropy Entropy input followed by the nonce, at least CTRDRBG_MIN_ENTROPY_SIZE bytes
+ * \param entropyLength Number of bytes
+ * \param personalization Device specific string, e.g. the serial number, NULL_PTR if personalizationLength is 0
+ * \param personalizationLength Number of bytes
+ * \return TRUE on success, FALSE if the entropy input is too short
+ */
+boolean CtrDrbg_Instantiate(CtrDrbg_t *ctx, const uint8 *entropy, uint32 entropyLength, const uint8 *personalization,
+                            uint32 personalizationLength);
+
+/**
+ * \brief Mix fresh entropy into a generator and restart the reseed counter
+ * \param ctx Generator state from CtrDrbg_Instantiate()
+ * \param entropy Entropy input, at least AES256_KEY_SIZE bytes
+ * \param entropyLength Number of bytes
+ * \param additional Additional input, NULL_PTR if additionalLength is 0
+ * \param additionalLength Number of bytes
+ * \return TRUE on success, FALSE if the entropy input is too short
+ */
+boolean CtrDrbg_Reseed(CtrDrbg_t *ctx, const uint8 *entropy, uint32 entropyLength, const uint8 *additional,
+                       uint32 additionalLength);
+
+/**
+ * \brief Generate random bytes
+ * \param ctx Generator state
+ * \param output Output
+ * \param length Number of bytes, at most CTRDRBG_MAX_REQUEST_SIZE
+ * \param additional Additional input, NULL_PTR if additionalLength is 0
+ * \param additionalLength Number of bytes
+ * \return TRUE on success, FALSE if the generator is not seeded, needs a reseed or length is too large
+ */
+boolean CtrDrbg_Generate(CtrDrbg_t *ctx, uint8 *output, uint32 length, const uint8 *additional,
+                         uint32 additionalLength);
+
+/**
+ * \brief Seed a pool from its entropy source and fill it
+ * \param pool Pool state
+ * \param source Entropy source, also used for every reseed
+ * \param personalization Device specific string, NULL_PTR if personalizationLength is 0
+ * \param personalizationLength Number of bytes
+ * \return TRUE on success, FALSE if the entropy source failed
+ */
+boolean CtrDrbg_PoolInit(CtrDrbg_Pool_t *pool, CtrDrbg_EntropySource source, const uint8 *personalization,
+                         uint32 personalizationLength);
+
+/**
+ * \brief Take random bytes from the pool, never generates
+ * \param pool Pool state
+ * \param data Output
+ * \param length Number of bytes
+ * \return TRUE if length bytes were available, FALSE otherwise with nothing taken
+ */
+boolean CtrDrbg_Read(CtrDrbg_Pool_t *pool, uint8 *data, uint32 length);
+
+/**
+ * \brief Top up the pool with one batch of generator output, reseeding first when the interval is reached
+ * \param pool Pool state
+ * \return TRUE if the pool is full, FALSE if a reseed was due and the entropy source failed
+ */
+boolean CtrDrbg_Refill(CtrDrbg_Pool_t *pool);
+
+/**
+ * \brief Number of bytes a CtrDrbg_Read() can take right now
+ */
+uint32 CtrDrbg_GetAvailable(const CtrDrbg_Pool_t *pool);
+
+#endif /* CTRDRBG_H_ */
@@ -0,0 +1,430 @@
+/**********************************************************************************************************************
+ * \file Ed25519.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Ed25519 in extended twisted Edwards coordinates
+ *********************************************************************************************************************/
+
+#include "Ed25519.h"
+#include "Fe25519.h"
+#include "Sha512.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define ED25519_WINDOWS             64              /* Signed 4-bit digits of a scalar */
+#define ED25519_TABLE_SIZE          8               /* 1P .. 8P                        */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    Fe25519_t x;                    /* x = X / Z, y = Y / Z, x y = T / Z */
+    Fe25519_t y;
+    Fe25519_t z;
+    Fe25519_t t;
+} Ed25519_Point_t;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static const Fe25519_t g_edD = {
+    0x35978A3, 0xD37284, 0x3156EBD, 0x6A0A0E, 0x1C029, 0x179E898, 0x3A03CBB, 0x1CE7198, 0x2E2B6FF, 0x1480DB3
+};
+static const Fe25519_t g_edD2 = {
+    0x2B2F159, 0x1A6E509, 0x22ADD7A, 0xD4141D, 0x38052, 0xF3D130, 0x3407977, 0x19CE331, 0x1C56DFF, 0x901B67
+};
+static const Fe25519_t g_edSqrtM1 = {
+    0x20EA0B0, 0x186C9D2, 0x8F189D, 0x35697F, 0xBD0C60, 0x1FBD7A7, 0x2804C9E, 0x1E16569, 0x4FC1D, 0xAE0C92
+};
+
+/* Base point B, y = 4/5 and x even */
+static const Ed25519_Point_t g_edBase = {
+    {0x325D51A, 0x18B5823, 0xF6592A, 0x104A92D, 0x1A4B31D, 0x1D6DC5C, 0x27118FE, 0x7FD814, 0x13CD6E5, 0x85A4DB},
+    {0x2666658, 0x1999999, 0xCCCCCC, 0x1333333, 0x1999999, 0x666666, 0x3333333, 0xCCCCCC, 0x2666666, 0x1999999},
+    {1, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0x1B7DDA3, 0x1A2ACE9, 0x25EADBB, 0x3BA8A, 0x83C27E, 0xABE37D, 0x1274732, 0xCCACDD, 0xFD78B7, 0x19E1D7C}
+};
+
+/* Group order L = 2^252 + 27742317777372353535851937790883648493, little endian */
+static const uint8 g_edOrder[32] = {
+    0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58, 0xD6, 0x9C, 0xF7, 0xA2, 0xDE, 0xF9, 0xDE, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static void pointIdentity(Ed25519_Point_t *p)
+{
+    memset(p, 0, sizeof(Ed25519_Point_t));
+    p->y[0] = 1;
+    p->z[0] = 1;
+}
+
+/* r = p + q, unified formulas for a = -1 (add-2008-hwcd-3), r may be p or q */
+static void pointAdd(Ed25519_Point_t *r, const Ed25519_Point_t *p, const Ed25519_Point_t *q)
+{
+    Fe25519_t a;
+    Fe25519_t b;
+    Fe25519_t c;
+    Fe25519_t d;
+    Fe25519_t t;
+
+    Fe25519_Sub(a, p->y, p->x);
+    Fe25519_Sub(t, q->y, q->x);
+    Fe25519_Mul(a, a, t);
+    Fe25519_Add(b, p->y, p->x);
+    Fe25519_Add(t, q->y, q->x);
+    Fe25519_Mul(b, b, t);
+    Fe25519_Mul(c, p->t, g_edD2);
+    Fe25519_Mul(c, c, q->t);
+    Fe25519_Mul(d, p->z, q->z);
+    Fe25519_Add(d, d, d);
+
+    Fe25519_Sub(t, b, a);               /* E */
+    Fe25519_Add(b, b, a);               /* H */
+    Fe25519_Sub(a, d, c);               /* F */
+    Fe25519_Add(d, d, c);               /* G */
+    Fe25519_Mul(r->x, t, a);
+    Fe25519_Mul(r->y, d, b);
+    Fe25519_Mul(r->t, t, b);
+    Fe25519_Mul(r->z, a, d);
+}
+
+/* r = 2 p (dbl-2008-hwcd), r may be p */
+static void pointDouble(Ed25519_Point_t *r, const Ed25519_Point_t *p)
+{
+    Fe25519_t a;
+    Fe25519_t b;
+    Fe25519_t c;
+    Fe25519_t e;
+    Fe25519_t f;
+
+    Fe25519_Square(a, p->x);
+    Fe25519_Square(b, p->y);
+    Fe25519_Square(c, p->z);
+    Fe25519_Add(c, c, c);
+    Fe25519_Add(e, p->x, p->y);
+    Fe25519_Square(e, e);
+    Fe25519_Sub(e, e, a);
+    Fe25519_Sub(e, e, b);               /* E = 2 x y */
+    Fe25519_Sub(f, b, a);               /* G = B - A */
+    Fe25519_Add(a, a, b);
+    Fe25519_Neg(b, a);                  /* H = -A - B */
+    Fe25519_Sub(c, f, c);
+    Fe25519_Carry(c, c);                /* F = G - C, carried as it is the sum of three values */
+
+    Fe25519_Mul(r->x, e, c);
+    Fe25519_Mul(r->y, f, b);
+    Fe25519_Mul(r->t, e, b);
+    Fe25519_Mul(r->z, c, f);
+}
+
+static void pointNeg(Ed25519_Point_t *r, const Ed25519_Point_t *p)
+{
+    Fe25519_Neg(r->x, p->x);
+    memcpy(r->y, p->y, sizeof(Fe25519_t));
+    memcpy(r->z, p->z, sizeof(Fe25519_t));
+    Fe25519_Neg(r->t, p->t);
+}
+
+/* r = digit * P from the table of 1P .. 8P, reading every entry; digit in -8 .. 8 */
+static void pointSelect(Ed25519_Point_t *r, const Ed25519_Point_t *table, sint32 digit)
+{
+    uint32          negative = (uint32)digit >> 31;
+    uint32          magnitude = (uint32)((digit ^ -(sint32)negative) + (sint32)negative);
+    Ed25519_Point_t minus;
+    uint32          i;
+
+    pointIdentity(r);
+    for (i = 0; i < ED25519_TABLE_SIZE; i++)
+    {
+        uint32 equal = (((i + 1u) ^ magnitude) - 1u) >> 31;
+
+        Fe25519_CondMove(r->x, table[i].x, equal);
+        Fe25519_CondMove(r->y, table[i].y, equal);
+        Fe25519_CondMove(r->z, table[i].z, equal);
+        Fe25519_CondMove(r->t, table[i].t, equal);
+    }
+
+    pointNeg(&minus, r);
+    Fe25519_CondMove(r->x, minus.x, negative);
+    Fe25519_CondMove(r->t, minus.t, negative);
+}
+
+/* r = scalar * p in constant time, scalar below 2^255 */
+static void scalarMult(Ed25519_Point_t *r, const Ed25519_Point_t *p, const uint8 *scalar)
+{
+    Ed25519_Point_t table[ED25519_TABLE_SIZE];
+    Ed25519_Point_t q;
+    sint8           digit[ED25519_WINDOWS];
+    sint32          carry = 0;
+    sint32          i;
+
+    /* Digits in -8 .. 7, the top one up to 8 */
+    for (i = 0; i < ED25519_WINDOWS; i++)
+    {
+        digit[i]  = (sint8)(((scalar[i >> 1] >> (4 * (i & 1))) & 15) + carry);
+        carry     = (digit[i] + 8) >> 4;
+        digit[i] -= (sint8)(carry * 16);
+    }
+    digit[ED25519_WINDOWS - 1] += (sint8)(carry * 16);
+
+    table[0] = *p;
+    for (i = 1; i < ED25519_TABLE_SIZE; i++)
+        pointAdd(&table[i], &table[i - 1], p);
+
+    pointIdentity(r);
+    for (i = ED25519_WINDOWS - 1; i >= 0; i--)
+    {
+        pointDouble(r, r);
+        pointDouble(r, r);
+        pointDouble(r, r);
+        pointDouble(r, r);
+        pointSelect(&q, table, digit[i]);
+        pointAdd(r, r, &q);
+    }
+
+    memset(digit, 0, sizeof(digit));
+}
+
+/* r = s B + k Q for public scalars, one doubling per bit */
+static void doubleScalarMult(Ed25519_Point_t *r, const uint8 *s, const Ed25519_Point_t *q, const uint8 *k)
+{
+    Ed25519_Point_t sum;
+    uint32          sBit;
+    uint32          kBit;
+    sint32          i;
+
+    pointAdd(&sum, &g_edBase, q);
+    pointIdentity(r);
+
+    for (i = 255; i >= 0; i--)
+    {
+        pointDouble(r, r);
+        sBit = (s[i >> 3] >> (i & 7)) & 1u;
+        kBit = (k[i >> 3] >> (i & 7)) & 1u;
+
+        if (sBit != 0u && kBit != 0u)
+            pointAdd(r, r, &sum);
+        else if (sBit != 0u)
+            pointAdd(r, r, &g_edBase);
+        else if (kBit != 0u)
+            pointAdd(r, r, q);
+    }
+}
+
+static void pointEncode(uint8 *bytes, const Ed25519_Point_t *p)
+{
+    Fe25519_t zInverse;
+    Fe25519_t x;
+    Fe25519_t y;
+
+    Fe25519_Invert(zInverse, p->z);
+    Fe25519_Mul(x, p->x, zInverse);
+    Fe25519_Mul(y, p->y, zInverse);
+    Fe25519_ToBytes(bytes, y);
+    bytes[31] |= (uint8)(Fe25519_IsNegative(x) << 7);
+}
+
+/* Recover x from y and its sign: x = sqrt((y^2 - 1) / (d y^2 + 1)) */
+static boolean pointDecode(Ed25519_Point_t *p, const uint8 *bytes)
+{
+    uint8     check[32];
+    Fe25519_t u;
+    Fe25519_t v;
+    Fe25519_t v3;
+    Fe25519_t t;
+    uint32    sign = bytes[31] >> 7;
+
+    Fe25519_FromBytes(p->y, bytes);
+    Fe25519_ToBytes(check, p->y);
+    check[31] |= (uint8)(sign << 7);
+    if (memcmp(check, bytes, sizeof(check)) != 0)
+        return FALSE;                   /* y >= p */
+
+    memset(p->z, 0, sizeof(Fe25519_t));
+    p->z[0] = 1;
+    Fe25519_Square(u, p->y);
+    Fe25519_Mul(v, u, g_edD);
+    Fe25519_Sub(u, u, p->z);
+    Fe25519_Add(v, v, p->z);
+
+    /* x = u v^3 (u v^7)^((p - 5) / 8) */
+    Fe25519_Square(v3, v);
+    Fe25519_Mul(v3, v3, v);
+    Fe25519_Square(p->x, v3);
+    Fe25519_Mul(p->x, p->x, v);
+    Fe25519_Mul(p->x, p->x, u);
+    Fe25519_Pow22523(p->x, p->x);
+    Fe25519_Mul(p->x, p->x, v3);
+    Fe25519_Mul(p->x, p->x, u);
+
+    /* v x^2 is u, or -u if x still needs the factor sqrt(-1) */
+    Fe25519_Square(t, p->x);
+    Fe25519_Mul(t, t, v);
+    Fe25519_Sub(v3, t, u);
+    if (!Fe25519_IsZero(v3))
+    {
+        Fe25519_Add(v3, t, u);
+        if (!Fe25519_IsZero(v3))
+            return FALSE;
+        Fe25519_Mul(p->x, p->x, g_edSqrtM1);
+    }
+
+    if (Fe25519_IsZero(p->x) && sign != 0u)
+        return FALSE;
+    if ((uint32)Fe25519_IsNegative(p->x) != sign)
+        Fe25519_Neg(p->x, p->x);
+
+    Fe25519_Mul(p->t, p->x, p->y);
+    return TRUE;
+}
+
+/* r = x mod L for a 64 digit number in base 256, digits may exceed 8 bits */
+static void reduceScalar(uint8 *r, sint64 *x)
+{
+    sint64 carry;
+    sint32 i;
+    sint32 j;
+
+    for (i = 63; i >= 32; i--)
+    {
+        carry = 0;
+        for (j = i - 32; j < i - 12; j++)
+        {
+            x[j] += carry - 16 * x[i] * g_edOrder[j - (i - 32)];
+            carry = (x[j] + 128) >> 8;
+            x[j] -= carry * 256;
+        }
+        x[j] += carry;
+        x[i]  = 0;
+    }
+
+    carry = 0;
+    for (j = 0; j < 32; j++)
+    {
+        x[j] += carry - (x[31] >> 4) * g_edOrder[j];
+        carry = x[j] >> 8;
+        x[j] &= 255;
+    }
+    for (j = 0; j < 32; j++)
+        x[j] -= carry * g_edOrder[j];
+
+    for (i = 0; i < 32; i++)
+    {
+        x[i + 1] += x[i] >> 8;
+        r[i]      = (uint8)(x[i] & 255);
+    }
+}
+
+/* SHA-512 of the concatenation of up to three parts, reduced mod L */
+static void hashScalar(uint8 *r, const uint8 *a, uint32 aLength, const uint8 *b, uint32 bLength, const uint8 *c,
+                       uint32 cLength)
+{
+    Sha512_t ctx;
+    uint8    digest[SHA512_DIGEST_SIZE];
+    sint64   x[64];
+    uint32   i;
+
+    Sha512_Init(&ctx);
+    Sha512_Update(&ctx, a, aLength);
+    Sha512_Update(&ctx, b, bLength);
+    Sha512_Update(&ctx, c, cLength);
+    Sha512_Final(&ctx, digest);
+
+    for (i = 0; i < 64u; i++)
+        x[i] = digest[i];
+    reduceScalar(r, x);
+}
+
+static void expandKey(uint8 *expanded, const uint8 *secretKey)
+{
+    Sha512_Calculate(secretKey, ED25519_SECRET_KEY_SIZE, expanded);
+    expanded[0]  &= 248u;
+    expanded[31]  = (uint8)((expanded[31] & 127u) | 64u);
+}
+
+static boolean isReducedScalar(const uint8 *s)
+{
+    sint32 i;
+
+    for (i = 31; i >= 0; i--)
+    {
+        if (s[i] != g_edOrder[i])
+            return (s[i] < g_edOrder[i]) ? TRUE : FALSE;
+    }
+
+    return FALSE;
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+void Ed25519_PublicKey(uint8 *publicKey, const uint8 *secretKey)
+{
+    uint8           expanded[SHA512_DIGEST_SIZE];
+    Ed25519_Point_t a;
+
+    expandKey(expanded, secretKey);
+    scalarMult(&a, &g_edBase, expanded);
+    pointEncode(publicKey, &a);
+
+    memset(expanded, 0, sizeof(expanded));
+}
+
+void Ed25519_Sign(uint8 *signature, const uint8 *secretKey, const uint8 *publicKey, const uint8 *message,
+                  uint32 messageLength)
+{
+    uint8           expanded[SHA512_DIGEST_SIZE];
+    uint8           r[32];
+    uint8           k[32];
+    sint64          x[64];
+    Ed25519_Point_t point;
+    uint32          i;
+    uint32          j;
+
+    expandKey(expanded, secretKey);
+
+    /* Deterministic nonce r = H(prefix || M), R = r B */
+    hashScalar(r, &expanded[32], 32u, message, messageLength, NULL_PTR, 0u);
+    scalarMult(&point, &g_edBase, r);
+    pointEncode(signature, &point);
+
+    /* S = r + H(R || A || M) a mod L */
+    hashScalar(k, signature, 32u, publicKey, ED25519_PUBLIC_KEY_SIZE, message, messageLength);
+    for (i = 0; i < 64u; i++)
+        x[i] = (i < 32u) ? r[i] : 0;
+    for (i = 0; i < 32u; i++)
+        for (j = 0; j < 32u; j++)
+            x[i + j] += (sint64)k[i] * expanded[j];
+    reduceScalar(&signature[32], x);
+
+    memset(expanded, 0, sizeof(expanded));
+    memset(r, 0, sizeof(r));
+    memset(x, 0, sizeof(x));
+}
+
+boolean Ed25519_Verify(const uint8 *publicKey, const uint8 *message, uint32 messageLength, const uint8 *signature)
+{
+    uint8           k[32];
+    uint8           check[32];
+    Ed25519_Point_t a;
+    Ed25519_Point_t r;
+
+    if (!isReducedScalar(&signature[32]) || !pointDecode(&a, publicKey))
+        return FALSE;
+
+    /* R must equal S B - k A */
+    hashScalar(k, signature, 32u, publicKey, ED25519_PUBLIC_KEY_SIZE, message, messageLength);
+    pointNeg(&a, &a);
+    doubleScalarMult(&r, &signature[32], &a, k);
+    pointEncode(check, &r);
+
+    return (memcmp(check, signature, sizeof(check)) == 0) ? TRUE : FALSE;
+}
@@ -0,0 +1,62 @@
+/**********************************************************************************************************************
+ * \file Ed25519.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Ed25519 signatures (RFC 8032) over the field arithmetic of Fe25519.h
+ * Points are kept in extended twisted Edwards coordinates with the unified addition formulas, so an addition is
+ * eight field multiplications and needs no special case for doubling or the neutral element. Key generation and
+ * signing multiply the base point with a secret scalar in 4-bit windows; every window reads all 16 table entries
+ * and the sequence of operations does not depend on the scalar. Verification only handles public data and
+ * computes [S]B - [k]A in one pass of doublings (Shamir's trick), like P256_Verify().
+ *
+ * Signatures with S >= L and public keys or R values that are not canonical encodings are rejected.
+ *********************************************************************************************************************/
+
+#ifndef ED25519_H_
+#define ED25519_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define ED25519_SECRET_KEY_SIZE                  32          /* Random seed                                     */
+#define ED25519_PUBLIC_KEY_SIZE                  32
+#define ED25519_SIGNATURE_SIZE                   64          /* R || S                                          */
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Derive the public key of a secret key
+ * \param publicKey Output, ED25519_PUBLIC_KEY_SIZE bytes
+ * \param secretKey ED25519_SECRET_KEY_SIZE random bytes
+ */
+void Ed25519_PublicKey(uint8 *publicKey, const uint8 *secretKey);
+
+/**
+ * \brief Sign a message
+ * \param signature Output, ED25519_SIGNATURE_SIZE bytes
+ * \param secretKey ED25519_SECRET_KEY_SIZE bytes
+ * \param publicKey Public key of secretKey from Ed25519_PublicKey()
+ * \param message Message
+ * \param messageLength Number of bytes
+ */
+void Ed25519_Sign(uint8 *signature, const uint8 *secretKey, const uint8 *publicKey, const uint8 *message,
+                  uint32 messageLength);
+
+/**
+ * \brief Verify a signature
+ * \param publicKey ED25519_PUBLIC_KEY_SIZE bytes
+ * \param message Message
+ * \param messageLength Number of bytes
+ * \param signature ED25519_SIGNATURE_SIZE bytes
+ * \return TRUE if the signature is valid, FALSE otherwise
+ */
+boolean Ed25519_Verify(const uint8 *publicKey, const uint8 *message, uint32 messageLength, const uint8 *signature);
+
+#endif /* ED25519_H_ */
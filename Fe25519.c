@@ -0,0 +1,347 @@
+/**********************************************************************************************************************
+ * \file Fe25519.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Field arithmetic modulo 2^255 - 19 in radix 2^25.5
+ *********************************************************************************************************************/
+
+#include "Fe25519.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Round limb i of h to its width and move the carry to limb j; 2^255 = 19 wraps the top limb around */
+#define CARRY(h, i, j, bits, factor)                                                                                \
+    do                                                                                                              \
+    {                                                                                                               \
+        sint64 c_ = ((h)[(i)] + ((sint64)1 << ((bits) - 1))) >> (bits);                                            \
+        (h)[(j)] += c_ * (factor);                                                                                  \
+        (h)[(i)] -= c_ * ((sint64)1 << (bits));                                                                     \
+    } while (0)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Limb widths, limb i starts at bit ceil(25.5 * i) */
+static const uint8 g_feBits[FE25519_LIMBS]   = {26, 25, 26, 25, 26, 25, 26, 25, 26, 25};
+static const uint8 g_feOffset[FE25519_LIMBS] = {0, 26, 51, 77, 102, 128, 153, 179, 204, 230};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Products back to signed limbs of 26 and 25 bits, |h| below 2^25 and 2^24 except limb 1 */
+static void reduce(Fe25519_t o, sint64 *h)
+{
+    uint32 i;
+
+    CARRY(h, 0, 1, 26, 1);
+    CARRY(h, 4, 5, 26, 1);
+    CARRY(h, 1, 2, 25, 1);
+    CARRY(h, 5, 6, 25, 1);
+    CARRY(h, 2, 3, 26, 1);
+    CARRY(h, 6, 7, 26, 1);
+    CARRY(h, 3, 4, 25, 1);
+    CARRY(h, 7, 8, 25, 1);
+    CARRY(h, 4, 5, 26, 1);
+    CARRY(h, 8, 9, 26, 1);
+    CARRY(h, 9, 0, 25, 19);
+    CARRY(h, 0, 1, 26, 1);
+
+    for (i = 0; i < FE25519_LIMBS; i++)
+        o[i] = (sint32)h[i];
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+void Fe25519_FromBytes(Fe25519_t o, const uint8 *bytes)
+{
+    uint32 i;
+    uint32 j;
+
+    for (i = 0; i < FE25519_LIMBS; i++)
+    {
+        uint32 first = g_feOffset[i] / 8u;
+        uint32 shift = g_feOffset[i] % 8u;
+        uint64 word  = 0;
+
+        /* The limb lies within 5 bytes from its first one, bit 255 is ignored */
+        for (j = 0; j < 5u && first + j < FE25519_SIZE; j++)
+            word |= (uint64)bytes[first + j] << (8u * j);
+
+        o[i] = (sint32)((word >> shift) & (((uint64)1 << g_feBits[i]) - 1u));
+    }
+}
+
+void Fe25519_ToBytes(uint8 *bytes, const Fe25519_t a)
+{
+    sint64 h[FE25519_LIMBS];
+    sint64 q;
+    uint64 word = 0;
+    uint32 bits = 0;
+    uint32 n    = 0;
+    uint32 i;
+
+    for (i = 0; i < FE25519_LIMBS; i++)
+        h[i] = a[i];
+
+    /* q = 1 if a >= p, then a - q p is in [0, p) and the carries leave limbs in their widths */
+    q = (19 * h[9] + ((sint64)1 << 24)) >> 25;
+    for (i = 0; i < FE25519_LIMBS; i++)
+        q = (h[i] + q) >> g_feBits[i];
+
+    h[0] += 19 * q;
+    for (i = 0; i < FE25519_LIMBS - 1u; i++)
+    {
+        q         = h[i] >> g_feBits[i];
+        h[i + 1u] += q;
+        h[i]      -= q * ((sint64)1 << g_feBits[i]);
+    }
+    h[9] &= ((sint64)1 << 25) - 1;
+
+    for (i = 0; i < FE25519_LIMBS; i++)
+    {
+        word |= (uint64)h[i] << bits;
+        bits += g_feBits[i];
+        while (bits >= 8u)
+        {
+            bytes[n++] = (uint8)word;
+            word     >>= 8;
+            bits      -= 8u;
+        }
+    }
+    bytes[n] = (uint8)word;     /* Top 7 bits */
+}
+
+void Fe25519_Add(Fe25519_t o, const Fe25519_t a, const Fe25519_t b)
+{
+    uint32 i;
+
+    for (i = 0; i < FE25519_LIMBS; i++)
+        o[i] = a[i] + b[i];
+}
+
+void Fe25519_Sub(Fe25519_t o, const Fe25519_t a, const Fe25519_t b)
+{
+    uint32 i;
+
+    for (i = 0; i < FE25519_LIMBS; i++)
+        o[i] = a[i] - b[i];
+}
+
+void Fe25519_Neg(Fe25519_t o, const Fe25519_t a)
+{
+    uint32 i;
+
+    for (i = 0; i < FE25519_LIMBS; i++)
+        o[i] = -a[i];
+}
+
+void Fe25519_Carry(Fe25519_t o, const Fe25519_t a)
+{
+    sint64 h[FE25519_LIMBS];
+    uint32 i;
+
+    for (i = 0; i < FE25519_LIMBS; i++)
+        h[i] = a[i];
+
+    reduce(o, h);
+}
+
+void Fe25519_Mul(Fe25519_t o, const Fe25519_t f, const Fe25519_t g)
+{
+    sint32 f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    sint32 f5 = f[5], f6 = f[6], f7 = f[7], f8 = f[8], f9 = f[9];
+    sint32 g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+    sint32 g5 = g[5], g6 = g[6], g7 = g[7], g8 = g[8], g9 = g[9];
+    sint32 g1_19 = 19 * g1, g2_19 = 19 * g2, g3_19 = 19 * g3, g4_19 = 19 * g4, g5_19 = 19 * g5;
+    sint32 g6_19 = 19 * g6, g7_19 = 19 * g7, g8_19 = 19 * g8, g9_19 = 19 * g9;
+    sint32 f1_2 = 2 * f1, f3_2 = 2 * f3, f5_2 = 2 * f5, f7_2 = 2 * f7, f9_2 = 2 * f9;
+    sint64 h[FE25519_LIMBS];
+
+    h[0] = (sint64)f0 * g0 + (sint64)f1_2 * g9_19 + (sint64)f2 * g8_19 + (sint64)f3_2 * g7_19 + (sint64)f4 * g6_19 +
+           (sint64)f5_2 * g5_19 + (sint64)f6 * g4_19 + (sint64)f7_2 * g3_19 + (sint64)f8 * g2_19 +
+           (sint64)f9_2 * g1_19;
+    h[1] = (sint64)f0 * g1 + (sint64)f1 * g0 + (sint64)f2 * g9_19 + (sint64)f3 * g8_19 + (sint64)f4 * g7_19 +
+           (sint64)f5 * g6_19 + (sint64)f6 * g5_19 + (sint64)f7 * g4_19 + (sint64)f8 * g3_19 + (sint64)f9 * g2_19;
+    h[2] = (sint64)f0 * g2 + (sint64)f1_2 * g1 + (sint64)f2 * g0 + (sint64)f3_2 * g9_19 + (sint64)f4 * g8_19 +
+           (sint64)f5_2 * g7_19 + (sint64)f6 * g6_19 + (sint64)f7_2 * g5_19 + (sint64)f8 * g4_19 +
+           (sint64)f9_2 * g3_19;
+    h[3] = (sint64)f0 * g3 + (sint64)f1 * g2 + (sint64)f2 * g1 + (sint64)f3 * g0 + (sint64)f4 * g9_19 +
+           (sint64)f5 * g8_19 + (sint64)f6 * g7_19 + (sint64)f7 * g6_19 + (sint64)f8 * g5_19 + (sint64)f9 * g4_19;
+    h[4] = (sint64)f0 * g4 + (sint64)f1_2 * g3 + (sint64)f2 * g2 + (sint64)f3_2 * g1 + (sint64)f4 * g0 +
+           (sint64)f5_2 * g9_19 + (sint64)f6 * g8_19 + (sint64)f7_2 * g7_19 + (sint64)f8 * g6_19 +
+           (sint64)f9_2 * g5_19;
+    h[5] = (sint64)f0 * g5 + (sint64)f1 * g4 + (sint64)f2 * g3 + (sint64)f3 * g2 + (sint64)f4 * g1 + (sint64)f5 * g0 +
+           (sint64)f6 * g9_19 + (sint64)f7 * g8_19 + (sint64)f8 * g7_19 + (sint64)f9 * g6_19;
+    h[6] = (sint64)f0 * g6 + (sint64)f1_2 * g5 + (sint64)f2 * g4 + (sint64)f3_2 * g3 + (sint64)f4 * g2 +
+           (sint64)f5_2 * g1 + (sint64)f6 * g0 + (sint64)f7_2 * g9_19 + (sint64)f8 * g8_19 + (sint64)f9_2 * g7_19;
+    h[7] = (sint64)f0 * g7 + (sint64)f1 * g6 + (sint64)f2 * g5 + (sint64)f3 * g4 + (sint64)f4 * g3 + (sint64)f5 * g2 +
+           (sint64)f6 * g1 + (sint64)f7 * g0 + (sint64)f8 * g9_19 + (sint64)f9 * g8_19;
+    h[8] = (sint64)f0 * g8 + (sint64)f1_2 * g7 + (sint64)f2 * g6 + (sint64)f3_2 * g5 + (sint64)f4 * g4 +
+           (sint64)f5_2 * g3 + (sint64)f6 * g2 + (sint64)f7_2 * g1 + (sint64)f8 * g0 + (sint64)f9_2 * g9_19;
+    h[9] = (sint64)f0 * g9 + (sint64)f1 * g8 + (sint64)f2 * g7 + (sint64)f3 * g6 + (sint64)f4 * g5 + (sint64)f5 * g4 +
+           (sint64)f6 * g3 + (sint64)f7 * g2 + (sint64)f8 * g1 + (sint64)f9 * g0;
+
+    reduce(o, h);
+}
+
+void Fe25519_Square(Fe25519_t o, const Fe25519_t f)
+{
+    sint32 f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    sint32 f5 = f[5], f6 = f[6], f7 = f[7], f8 = f[8], f9 = f[9];
+    sint32 f0_2 = 2 * f0, f1_2 = 2 * f1, f2_2 = 2 * f2, f3_2 = 2 * f3, f4_2 = 2 * f4;
+    sint32 f5_2 = 2 * f5, f6_2 = 2 * f6, f7_2 = 2 * f7, f8_2 = 2 * f8, f9_2 = 2 * f9;
+    sint32 f1_4 = 4 * f1, f3_4 = 4 * f3, f5_4 = 4 * f5, f7_4 = 4 * f7;
+    sint32 f5_19 = 19 * f5, f6_19 = 19 * f6, f7_19 = 19 * f7, f8_19 = 19 * f8, f9_19 = 19 * f9;
+    sint64 h[FE25519_LIMBS];
+
+    h[0] = (sint64)f0 * f0 + (sint64)f1_4 * f9_19 + (sint64)f2_2 * f8_19 + (sint64)f3_4 * f7_19 +
+           (sint64)f4_2 * f6_19 + (sint64)f5_2 * f5_19;
+    h[1] = (sint64)f0_2 * f1 + (sint64)f2_2 * f9_19 + (sint64)f3_2 * f8_19 + (sint64)f4_2 * f7_19 +
+           (sint64)f5_2 * f6_19;
+    h[2] = (sint64)f0_2 * f2 + (sint64)f1_2 * f1 + (sint64)f3_4 * f9_19 + (sint64)f4_2 * f8_19 +
+           (sint64)f5_4 * f7_19 + (sint64)f6 * f6_19;
+    h[3] = (sint64)f0_2 * f3 + (sint64)f1_2 * f2 + (sint64)f4_2 * f9_19 + (sint64)f5_2 * f8_19 +
+           (sint64)f6_2 * f7_19;
+    h[4] = (sint64)f0_2 * f4 + (sint64)f1_4 * f3 + (sint64)f2 * f2 + (sint64)f5_4 * f9_19 + (sint64)f6_2 * f8_19 +
+           (sint64)f7_2 * f7_19;
+    h[5] = (sint64)f0_2 * f5 + (sint64)f1_2 * f4 + (sint64)f2_2 * f3 + (sint64)f6_2 * f9_19 + (sint64)f7_2 * f8_19;
+    h[6] = (sint64)f0_2 * f6 + (sint64)f1_4 * f5 + (sint64)f2_2 * f4 + (sint64)f3_2 * f3 + (sint64)f7_4 * f9_19 +
+           (sint64)f8 * f8_19;
+    h[7] = (sint64)f0_2 * f7 + (sint64)f1_2 * f6 + (sint64)f2_2 * f5 + (sint64)f3_2 * f4 + (sint64)f8_2 * f9_19;
+    h[8] = (sint64)f0_2 * f8 + (sint64)f1_4 * f7 + (sint64)f2_2 * f6 + (sint64)f3_4 * f5 + (sint64)f4 * f4 +
+           (sint64)f9_2 * f9_19;
+    h[9] = (sint64)f0_2 * f9 + (sint64)f1_2 * f8 + (sint64)f2_2 * f7 + (sint64)f3_2 * f6 + (sint64)f4_2 * f5;
+
+    reduce(o, h);
+}
+
+void Fe25519_MulSmall(Fe25519_t o, const Fe25519_t a, sint32 n)
+{
+    sint64 h[FE25519_LIMBS];
+    uint32 i;
+
+    for (i = 0; i < FE25519_LIMBS; i++)
+        h[i] = (sint64)a[i] * n;
+
+    reduce(o, h);
+}
+
+void Fe25519_SquareTimes(Fe25519_t o, const Fe25519_t a, uint32 count)
+{
+    Fe25519_Square(o, a);
+    while (--count > 0u)
+        Fe25519_Square(o, o);
+}
+
+void Fe25519_Invert(Fe25519_t o, const Fe25519_t z)
+{
+    Fe25519_t t0;
+    Fe25519_t t1;
+    Fe25519_t t2;
+    Fe25519_t t3;
+
+    /* z^(p - 2) = z^(2^255 - 21) with 254 squarings and 11 multiplications */
+    Fe25519_Square(t0, z);
+    Fe25519_SquareTimes(t1, t0, 2u);
+    Fe25519_Mul(t1, z, t1);
+    Fe25519_Mul(t0, t0, t1);
+    Fe25519_Square(t2, t0);
+    Fe25519_Mul(t1, t1, t2);                /* z^(2^5 - 1)   */
+    Fe25519_SquareTimes(t2, t1, 5u);
+    Fe25519_Mul(t1, t2, t1);                /* z^(2^10 - 1)  */
+    Fe25519_SquareTimes(t2, t1, 10u);
+    Fe25519_Mul(t2, t2, t1);                /* z^(2^20 - 1)  */
+    Fe25519_SquareTimes(t3, t2, 20u);
+    Fe25519_Mul(t2, t3, t2);                /* z^(2^40 - 1)  */
+    Fe25519_SquareTimes(t2, t2, 10u);
+    Fe25519_Mul(t1, t2, t1);                /* z^(2^50 - 1)  */
+    Fe25519_SquareTimes(t2, t1, 50u);
+    Fe25519_Mul(t2, t2, t1);                /* z^(2^100 - 1) */
+    Fe25519_SquareTimes(t3, t2, 100u);
+    Fe25519_Mul(t2, t3, t2);                /* z^(2^200 - 1) */
+    Fe25519_SquareTimes(t2, t2, 50u);
+    Fe25519_Mul(t1, t2, t1);                /* z^(2^250 - 1) */
+    Fe25519_SquareTimes(t1, t1, 5u);
+    Fe25519_Mul(o, t1, t0);
+}
+
+void Fe25519_Pow22523(Fe25519_t o, const Fe25519_t z)
+{
+    Fe25519_t t0;
+    Fe25519_t t1;
+    Fe25519_t t2;
+
+    Fe25519_Square(t0, z);
+    Fe25519_SquareTimes(t1, t0, 2u);
+    Fe25519_Mul(t1, z, t1);
+    Fe25519_Mul(t0, t0, t1);
+    Fe25519_Square(t0, t0);
+    Fe25519_Mul(t0, t1, t0);                /* z^(2^5 - 1)   */
+    Fe25519_SquareTimes(t1, t0, 5u);
+    Fe25519_Mul(t0, t1, t0);                /* z^(2^10 - 1)  */
+    Fe25519_SquareTimes(t1, t0, 10u);
+    Fe25519_Mul(t1, t1, t0);                /* z^(2^20 - 1)  */
+    Fe25519_SquareTimes(t2, t1, 20u);
+    Fe25519_Mul(t1, t2, t1);                /* z^(2^40 - 1)  */
+    Fe25519_SquareTimes(t1, t1, 10u);
+    Fe25519_Mul(t0, t1, t0);                /* z^(2^50 - 1)  */
+    Fe25519_SquareTimes(t1, t0, 50u);
+    Fe25519_Mul(t1, t1, t0);                /* z^(2^100 - 1) */
+    Fe25519_SquareTimes(t2, t1, 100u);
+    Fe25519_Mul(t1, t2, t1);                /* z^(2^200 - 1) */
+    Fe25519_SquareTimes(t1, t1, 50u);
+    Fe25519_Mul(t0, t1, t0);                /* z^(2^250 - 1) */
+    Fe25519_SquareTimes(t0, t0, 2u);
+    Fe25519_Mul(o, t0, z);                  /* z^(2^252 - 3) */
+}
+
+void Fe25519_CondSwap(Fe25519_t a, Fe25519_t b, uint32 bit)
+{
+    sint32 mask = -(sint32)bit;
+    sint32 t;
+    uint32 i;
+
+    for (i = 0; i < FE25519_LIMBS; i++)
+    {
+        t     = mask & (a[i] ^ b[i]);
+        a[i] ^= t;
+        b[i] ^= t;
+    }
+}
+
+void Fe25519_CondMove(Fe25519_t o, const Fe25519_t a, uint32 bit)
+{
+    sint32 mask = -(sint32)bit;
+    uint32 i;
+
+    for (i = 0; i < FE25519_LIMBS; i++)
+        o[i] ^= mask & (o[i] ^ a[i]);
+}
+
+boolean Fe25519_IsNegative(const Fe25519_t a)
+{
+    uint8 bytes[FE25519_SIZE];
+
+    Fe25519_ToBytes(bytes, a);
+    return (boolean)(bytes[0] & 1u);
+}
+
+boolean Fe25519_IsZero(const Fe25519_t a)
+{
+    uint8  bytes[FE25519_SIZE];
+    uint8  bits = 0;
+    uint32 i;
+
+    Fe25519_ToBytes(bytes, a);
+    for (i = 0; i < FE25519_SIZE; i++)
+        bits |= bytes[i];
+
+    return (bits == 0u) ? TRUE : FALSE;
+}
@@ -0,0 +1,117 @@
+/**********************************************************************************************************************
+ * \file Fe25519.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Arithmetic modulo p = 2^255 - 19, shared by X25519 and Ed25519
+ * An element is held in radix 2^25.5: ten signed limbs of alternately 26 and 25 bits. A product then needs 100
+ * 32x32->64 bit multiply-accumulates into ten 64-bit sums, which map onto the MADD instructions of TriCore, and
+ * the wrap-around of 2^255 is a multiplication by 19 folded into the operands beforehand. Additions and
+ * subtractions do not carry; their results may be multiplied once, but not added to again before a carry.
+ *
+ * All functions take the same time for all values, except for conversions of public values.
+ *********************************************************************************************************************/
+
+#ifndef FE25519_H_
+#define FE25519_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define FE25519_LIMBS                            10
+#define FE25519_SIZE                             32          /* Little endian encoding */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef sint32 Fe25519_t[FE25519_LIMBS];
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Decode 32 bytes, the top bit is ignored and values up to 2^255 - 1 are accepted
+ */
+void Fe25519_FromBytes(Fe25519_t o, const uint8 *bytes);
+
+/**
+ * \brief Encode the fully reduced value in 32 bytes
+ */
+void Fe25519_ToBytes(uint8 *bytes, const Fe25519_t a);
+
+/**
+ * \brief o = a + b, without carry
+ */
+void Fe25519_Add(Fe25519_t o, const Fe25519_t a, const Fe25519_t b);
+
+/**
+ * \brief o = a - b, without carry
+ */
+void Fe25519_Sub(Fe25519_t o, const Fe25519_t a, const Fe25519_t b);
+
+/**
+ * \brief o = -a, without carry
+ */
+void Fe25519_Neg(Fe25519_t o, const Fe25519_t a);
+
+/**
+ * \brief Bring the limbs of a sum back into range
+ */
+void Fe25519_Carry(Fe25519_t o, const Fe25519_t a);
+
+/**
+ * \brief o = f * g
+ */
+void Fe25519_Mul(Fe25519_t o, const Fe25519_t f, const Fe25519_t g);
+
+/**
+ * \brief o = f^2, with 55 instead of 100 products
+ */
+void Fe25519_Square(Fe25519_t o, const Fe25519_t f);
+
+/**
+ * \brief o = a^(2^count), count at least 1
+ */
+void Fe25519_SquareTimes(Fe25519_t o, const Fe25519_t a, uint32 count);
+
+/**
+ * \brief o = a * n for a small constant n below 2^20
+ */
+void Fe25519_MulSmall(Fe25519_t o, const Fe25519_t a, sint32 n);
+
+/**
+ * \brief o = 1 / z, 0 for z = 0
+ */
+void Fe25519_Invert(Fe25519_t o, const Fe25519_t z);
+
+/**
+ * \brief o = z^((p - 5) / 8), the core of a square root
+ */
+void Fe25519_Pow22523(Fe25519_t o, const Fe25519_t z);
+
+/**
+ * \brief Swap a and b if bit is 1, without a branch
+ */
+void Fe25519_CondSwap(Fe25519_t a, Fe25519_t b, uint32 bit);
+
+/**
+ * \brief o = a if bit is 1, without a branch
+ */
+void Fe25519_CondMove(Fe25519_t o, const Fe25519_t a, uint32 bit);
+
+/**
+ * \brief Lowest bit of the reduced value, the sign of an x-coordinate
+ */
+boolean Fe25519_IsNegative(const Fe25519_t a);
+
+/**
+ * \brief Check for the value 0
+ */
+boolean Fe25519_IsZero(const Fe25519_t a);
+
+#endif /* FE25519_H_ */
@@ -0,0 +1,181 @@
+/**********************************************************************************************************************
+ * \file Flash4_Archive.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Read-only indexed asset archive in Flash4
+ *********************************************************************************************************************/
+
+#include "Flash4_Archive.h"
+#include "Crc16.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define ARCHIVE_CRC_CHUNK_SIZE      64
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Continue a CRC-16 over a flash range */
+static uint16 crcFlash(uint16 crc, uint32 address, uint32 length)
+{
+    uint8 buffer[ARCHIVE_CRC_CHUNK_SIZE];
+
+    while (length > 0u)
+    {
+        uint16 chunk = (length > ARCHIVE_CRC_CHUNK_SIZE) ? ARCHIVE_CRC_CHUNK_SIZE : (uint16)length;
+
+        Flash4_ReadFlash4(buffer, address, chunk);
+        crc      = Crc16_Update(crc, buffer, chunk);
+        address += chunk;
+        length  -= chunk;
+    }
+
+    return crc;
+}
+
+/* A table of count elements of size bytes at offset lies inside the image and behind the header */
+static boolean isValidTable(const Flash4_ArchiveHeader_t *header, uint32 offset, uint32 count, uint32 size)
+{
+    return (offset >= sizeof(Flash4_ArchiveHeader_t)) && (offset <= header->imageSize) &&
+           (count <= (header->imageSize - offset) / size);
+}
+
+/* The data of an entry lies inside the image */
+static boolean isValidEntry(const Flash4_Archive_t *archive, const Flash4_ArchiveEntry_t *entry)
+{
+    return isValidTable(&archive->header, entry->offset, entry->length, 1u);
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+uint32 Flash4_Archive_Hash(const char *name, uint32 seed)
+{
+    uint32 h = 2166136261UL ^ (seed * 0x9E3779B9UL);
+
+    while (*name != '\0')
+    {
+        h ^= (uint8)*name++;
+        h *= 16777619UL;
+    }
+
+    h ^= h >> 16;
+    h *= 0x85EBCA6BUL;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35UL;
+    h ^= h >> 16;
+
+    return h;
+}
+
+uint8 Flash4_Archive_Open(Flash4_Archive_t *archive, uint32 baseAddress, uint32 *seedBuffer, uint32 seedCapacity)
+{
+    Flash4_ArchiveHeader_t *header = &archive->header;
+    uint16 headerCrc;
+    uint16 indexCrc;
+
+    Flash4_ReadFlash4((uint8 *)header, baseAddress, sizeof(Flash4_ArchiveHeader_t));
+
+    headerCrc         = header->headerCrc;
+    header->headerCrc = 0;
+    if (header->magic != FLASH4_ARCHIVE_MAGIC || header->version != FLASH4_ARCHIVE_VERSION ||
+        header->headerSize != sizeof(Flash4_ArchiveHeader_t) ||
+        Crc16_Calculate((const uint8 *)header, sizeof(Flash4_ArchiveHeader_t)) != headerCrc)
+        return FLASH4_ERROR;
+    header->headerCrc = headerCrc;
+
+    if ((header->entryCount > 0u && header->bucketCount == 0u) ||
+        !isValidTable(header, header->seedOffset, header->bucketCount, 4u) ||
+        !isValidTable(header, header->entryOffset, header->entryCount, sizeof(Flash4_ArchiveEntry_t)))
+        return FLASH4_ERROR;
+
+    archive->baseAddress = baseAddress;
+    archive->seeds       = NULL_PTR;
+
+    if (seedBuffer != NULL_PTR)
+    {
+        if (seedCapacity < header->bucketCount)
+            return FLASH4_ERROR;
+
+        Flash4_ReadBuffer((uint8 *)seedBuffer, baseAddress + header->seedOffset, header->bucketCount * 4u);
+        indexCrc = Crc16_Update(CRC16_INIT_VALUE, (const uint8 *)seedBuffer, header->bucketCount * 4u);
+    }
+    else
+    {
+        indexCrc = crcFlash(CRC16_INIT_VALUE, baseAddress + header->seedOffset, header->bucketCount * 4u);
+    }
+
+    /* Lookups trust the seeds and entries, an index that does not match its CRC is not opened */
+    indexCrc = crcFlash(indexCrc, baseAddress + header->entryOffset,
+                        header->entryCount * sizeof(Flash4_ArchiveEntry_t));
+    if (indexCrc != header->indexCrc)
+        return FLASH4_ERROR;
+
+    archive->seeds = seedBuffer;
+
+    return FLASH4_OK;
+}
+
+uint8 Flash4_Archive_Find(const Flash4_Archive_t *archive, const char *name, Flash4_ArchiveEntry_t *entry)
+{
+    const Flash4_ArchiveHeader_t *header = &archive->header;
+    uint32 bucket;
+    uint32 seed;
+    uint32 slot;
+
+    if (header->entryCount == 0u)
+        return FLASH4_ERROR;
+
+    bucket = Flash4_Archive_Hash(name, 0u) % header->bucketCount;
+
+    if (archive->seeds != NULL_PTR)
+    {
+        seed = archive->seeds[bucket];
+    }
+    else
+    {
+        Flash4_ReadFlash4((uint8 *)&seed, archive->baseAddress + header->seedOffset + bucket * 4u, 4u);
+    }
+
+    slot = Flash4_Archive_Hash(name, seed) % header->entryCount;
+    Flash4_ReadFlash4((uint8 *)entry, archive->baseAddress + header->entryOffset + slot * sizeof(*entry),
+                      sizeof(*entry));
+
+    /* The perfect hash maps every name to some slot, the fingerprint tells whether it is the right one */
+    if (entry->fingerprint != Flash4_Archive_Hash(name, FLASH4_ARCHIVE_FINGERPRINT_SEED) ||
+        !isValidEntry(archive, entry))
+        return FLASH4_ERROR;
+
+    return FLASH4_OK;
+}
+
+uint8 Flash4_Archive_Read(const Flash4_Archive_t *archive, const Flash4_ArchiveEntry_t *entry, uint32 offset,
+                          uint8 *outData, uint32 length)
+{
+    if (!isValidEntry(archive, entry) || offset > entry->length || length > entry->length - offset)
+        return FLASH4_ERROR;
+
+    Flash4_ReadBuffer(outData, archive->baseAddress + entry->offset + offset, length);
+
+    return FLASH4_OK;
+}
+
+uint8 Flash4_Archive_Load(const Flash4_Archive_t *archive, const char *name, uint8 *outData, uint32 capacity,
+                          uint32 *length)
+{
+    Flash4_ArchiveEntry_t entry;
+
+    if (Flash4_Archive_Find(archive, name, &entry) != FLASH4_OK || entry.length > capacity)
+        return FLASH4_ERROR;
+
+    Flash4_ReadBuffer(outData, archive->baseAddress + entry.offset, entry.length);
+    if (Crc16_Calculate(outData, entry.length) != entry.crc)
+        return FLASH4_ERROR;
+
+    *length = entry.length;
+
+    return FLASH4_OK;
+}
@@ -0,0 +1,129 @@
+/**********************************************************************************************************************
+ * \file Flash4_Archive.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Read-only indexed asset archive in Flash4
+ * Certificates, trust anchors, calibration blobs and UI assets are packed by the host tool Tools/flash4_mkarchive.c
+ * into one image with a minimal perfect hash index. With the bucket seeds cached in RAM at open time, a lookup by
+ * name costs one entry read and the asset itself one data read, independent of the number of assets.
+ *
+ * Image layout (little endian):
+ *   Flash4_ArchiveHeader_t                          32 bytes
+ *   uint32 seeds[bucketCount]                       displacement seed per hash bucket
+ *   Flash4_ArchiveEntry_t entries[entryCount]       16 bytes each, indexed by the perfect hash
+ *   asset data                                      4 byte aligned
+ *
+ * Hash: FNV-1a over the name bytes, basis 2166136261 ^ (seed * 0x9E3779B9), finalized with the murmur3 mix.
+ *   bucket      = hash(name, 0) % bucketCount
+ *   slot        = hash(name, seeds[bucket]) % entryCount      (seeds are never 0)
+ *   fingerprint = hash(name, 0xFFFFFFFF), rejects names not contained in the archive
+ *********************************************************************************************************************/
+
+#ifndef FLASH4_ARCHIVE_H_
+#define FLASH4_ARCHIVE_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define FLASH4_ARCHIVE_MAGIC                     0x52413446UL    /* "F4AR" */
+#define FLASH4_ARCHIVE_VERSION                   1
+#define FLASH4_ARCHIVE_FINGERPRINT_SEED          0xFFFFFFFFUL
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Archive image header */
+typedef struct
+{
+    uint32 magic;           /* FLASH4_ARCHIVE_MAGIC                            */
+    uint16 version;         /* FLASH4_ARCHIVE_VERSION                          */
+    uint16 headerSize;      /* sizeof(Flash4_ArchiveHeader_t)                  */
+    uint32 entryCount;      /* Number of assets                                */
+    uint32 bucketCount;     /* Number of hash buckets / seeds                  */
+    uint32 seedOffset;      /* Offset of the seed table from the image start   */
+    uint32 entryOffset;     /* Offset of the entry table from the image start  */
+    uint32 imageSize;       /* Total image size in bytes                       */
+    uint16 indexCrc;        /* CRC-16 over seed and entry tables               */
+    uint16 headerCrc;       /* CRC-16 over the header with headerCrc = 0       */
+} Flash4_ArchiveHeader_t;
+
+/* Index entry of one asset */
+typedef struct
+{
+    uint32 fingerprint;     /* Second hash of the name                         */
+    uint32 offset;          /* Offset of the data from the image start         */
+    uint32 length;          /* Data length in bytes                            */
+    uint16 crc;             /* CRC-16 of the data                              */
+    uint16 flags;           /* Reserved, 0                                     */
+} Flash4_ArchiveEntry_t;
+
+/* Open archive */
+typedef struct
+{
+    uint32                 baseAddress;
+    Flash4_ArchiveHeader_t header;
+    uint32                *seeds;           /* Cached seed table, NULL_PTR to read seeds on demand */
+} Flash4_Archive_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Open an archive and cache its seed table
+ * \param archive Archive handle
+ * \param baseAddress Flash4 address of the image
+ * \param seedBuffer RAM for the seed table (4 bytes per bucket), NULL_PTR to read one seed per lookup instead
+ * \param seedCapacity Number of seeds fitting into seedBuffer
+ * \return FLASH4_OK, FLASH4_ERROR if the image is invalid or seedBuffer is too small
+ */
+uint8 Flash4_Archive_Open(Flash4_Archive_t *archive, uint32 baseAddress, uint32 *seedBuffer, uint32 seedCapacity);
+
+/**
+ * \brief Look up an asset by name
+ * \param archive Archive handle
+ * \param name NUL terminated asset name
+ * \param entry Output index entry
+ * \return FLASH4_OK, FLASH4_ERROR if the name is not in the archive
+ */
+uint8 Flash4_Archive_Find(const Flash4_Archive_t *archive, const char *name, Flash4_ArchiveEntry_t *entry);
+
+/**
+ * \brief Read part of an asset
+ * \param archive Archive handle
+ * \param entry Entry returned by Flash4_Archive_Find()
+ * \param offset Offset inside the asset
+ * \param outData Output buffer
+ * \param length Number of bytes
+ * \return FLASH4_OK, FLASH4_ERROR if the range is outside the asset
+ */
+uint8 Flash4_Archive_Read(const Flash4_Archive_t *archive, const Flash4_ArchiveEntry_t *entry, uint32 offset,
+                          uint8 *outData, uint32 length);
+
+/**
+ * \brief Look up an asset and read it completely, checking its CRC
+ * \param archive Archive handle
+ * \param name NUL terminated asset name
+ * \param outData Output buffer
+ * \param capacity Size of outData
+ * \param length Output asset length
+ * \return FLASH4_OK, FLASH4_ERROR if not found, too large or corrupted
+ */
+uint8 Flash4_Archive_Load(const Flash4_Archive_t *archive, const char *name, uint8 *outData, uint32 capacity,
+                          uint32 *length);
+
+/**
+ * \brief Hash function of the archive index, shared with the host tool
+ * \param name NUL terminated name
+ * \param seed Seed
+ * \return Hash value
+ */
+uint32 Flash4_Archive_Hash(const char *name, uint32 seed);
+
+#endif /* FLASH4_ARCHIVE_H_ */
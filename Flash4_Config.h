@@ -24,5 +24,45 @@
 #define ISR_PRIORITY_FLASH4_RX          61          /* Receive interrupt priority */
 #define ISR_PRIORITY_FLASH4_ER          62          /* Error interrupt priority */
 
+/*********************************************************************************************************************/
+/*----------------------------------Memory Map-----------------------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Firmware image of Example 7 and its per-chunk CRC table for the scrubber */
+#define FLASH4_FIRMWARE_CRC_TABLE_ADDRESS 0x00200000UL
+#define FLASH4_FIRMWARE_SCRUB_CHUNK_SIZE  4096
+#define FLASH4_SCRUB_SPARE_ADDRESS        0x00300000UL  /* 4 erased spare sectors for relocation */
+/* Page of relocation records of the scrubbed image, in the CRC table sector so storing a new image clears them */
+#define FLASH4_SCRUB_RECORD_ADDRESS       (FLASH4_FIRMWARE_CRC_TABLE_ADDRESS + 0x1000UL)
+
+/* Compressed time-series log (ring of sectors) */
+#define FLASH4_TSLOG_START_ADDRESS      0x00800000UL
+#define FLASH4_TSLOG_SECTOR_COUNT       4
+
+/* Read-only asset archive built by Tools/flash4_mkarchive */
+#define FLASH4_ARCHIVE_START_ADDRESS    0x00C00000UL
+#define FLASH4_ARCHIVE_SEED_CAPACITY    64          /* Cached seeds, 4 assets per seed */
+
+/* A/B firmware slots, slot A is the image location of Example 7 */
+#define OTA_SLOT_A_ADDRESS              0x00100000UL
+#define OTA_SLOT_B_ADDRESS              0x00400000UL
+#define OTA_SLOT_SIZE                   0x00100000UL
+#define OTA_METADATA_ADDRESS            0x00500000UL  /* 2 sectors, metadata records are journaled alternately */
+#define OTA_MAX_BOOT_ATTEMPTS           3           /* Trial boots of a new image before rolling back */
+#define OTA_MANIFEST_ADDRESS            0x00580000UL  /* 1 sector, manifest header and chunk hashes of the download */
+
+/* Public keys of the update signer, provisioned at production, and the two signatures of the manifest header */
+#define OTA_SIGNER_KEY_ADDRESS          0x005C0000UL  /* 1 sector, ML-DSA public key */
+#define OTA_SIGNER_ECDSA_KEY_ADDRESS    (OTA_SIGNER_KEY_ADDRESS + 0x0800UL)
+#define OTA_MANIFEST_SIGNATURE_ADDRESS  (OTA_SIGNER_KEY_ADDRESS + 0x1000UL)  /* ML-DSA */
+#define OTA_MANIFEST_ECDSA_SIGNATURE_ADDRESS (OTA_SIGNER_KEY_ADDRESS + 0x2000UL)
+
+/* Content-defined chunk store: index sector, recipe sector and 32 data sectors (8 MB) */
+#define OTA_CHUNKSTORE_ADDRESS          0x01000000UL
+#define OTA_CHUNKSTORE_SECTOR_COUNT     34
+
+/* PFlash location the installer copies a slot to (start of bank PF1, the code running the installer sits in PF0) */
+#define OTA_PFLASH_INSTALL_ADDRESS      0xA0300000UL
+
 #endif /* FLASH4_CONFIG_H_ */
 
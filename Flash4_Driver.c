@@ -180,6 +180,32 @@ void Flash4_ReadFlash4(uint8 *outData, uint32 addr, uint16 nData)
     }
 }
 
+void Flash4_StartRead(uint8 *rxData, uint32 addr, uint16 nData)
+{
+    static uint8 txData[FLASH4_READ_HEADER_SIZE + 256]; // Sent by the interrupts after this function returns
+    uint16 i;
+    uint16 totalBytes = FLASH4_READ_HEADER_SIZE + nData;
+
+    txData[0] = FLASH4_CMD_4READ_FLASH;
+    txData[1] = (uint8)((addr >> 24) & 0xFF);
+    txData[2] = (uint8)((addr >> 16) & 0xFF);
+    txData[3] = (uint8)((addr >> 8) & 0xFF);
+    txData[4] = (uint8)(addr & 0xFF);
+
+    // Fill rest with dummy data
+    for (i = FLASH4_READ_HEADER_SIZE; i < totalBytes; i++)
+    {
+        txData[i] = 0xFF;
+    }
+
+    IfxQspi_SpiMaster_exchange(&g_qspiFlash4Channel, txData, rxData, totalBytes);
+}
+
+boolean Flash4_IsReadBusy(void)
+{
+    return (IfxQspi_SpiMaster_getStatus(&g_qspiFlash4Channel) == IfxQspi_Status_busy) ? TRUE : FALSE;
+}
+
 void Flash4_PageProgram4(uint8 *inData, uint32 addr, uint16 nData)
 {
     uint8 txData[5 + 256]; // Max page size + 5 command/address bytes
@@ -236,6 +262,38 @@ uint8 Flash4_CheckWEL(void)
     return (rxData[1] & 0x02); // WEL bit is bit 1 of status register
 }
 
+uint8 Flash4_CheckError(void)
+{
+    uint8 errors = Flash4_ReadByte(FLASH4_CMD_READ_STATUS_REG_1) & (FLASH4_SR1_P_ERR | FLASH4_SR1_E_ERR);
+
+    if (errors != 0u)
+    {
+        // Clears P_ERR / E_ERR and with them WIP
+        Flash4_WriteCommand(FLASH4_CMD_CLEAR_STATUS_REG);
+    }
+
+    return errors;
+}
+
+uint8 Flash4_ReadEccStatus(uint32 addr)
+{
+    uint8 txData[7];
+    uint8 rxData[7];
+
+    txData[0] = FLASH4_CMD_READ_ECC_STATUS_REG;
+    txData[1] = (uint8)((addr >> 24) & 0xFF);
+    txData[2] = (uint8)((addr >> 16) & 0xFF);
+    txData[3] = (uint8)((addr >> 8) & 0xFF);
+    txData[4] = (uint8)(addr & 0xFF);
+    txData[5] = 0xFF;   // 8 dummy cycles
+    txData[6] = 0xFF;
+
+    IfxQspi_SpiMaster_exchange(&g_qspiFlash4Channel, txData, rxData, 7);
+    while (IfxQspi_SpiMaster_getStatus(&g_qspiFlash4Channel) == IfxQspi_Status_busy);
+
+    return rxData[6];
+}
+
 void Flash4_Reset(void)
 {
     // Send software reset command
@@ -250,6 +308,10 @@ uint8 Flash4_WaitReady(uint32 timeoutMs)
 
     while (Flash4_CheckWIP())
     {
+        if (Flash4_CheckError() != 0u)
+        {
+            return FLASH4_ERROR;
+        }
         if ((IfxStm_get(&MODULE_STM0) - startTime) > timeoutTicks)
         {
             return FLASH4_TIMEOUT_ERROR;
@@ -257,3 +319,30 @@ uint8 Flash4_WaitReady(uint32 timeoutMs)
     }
     return FLASH4_OK;
 }
+
+void Flash4_ReadBuffer(uint8 *outData, uint32 addr, uint32 nData)
+{
+    while (nData > 0)
+    {
+        uint16 chunk = (nData > FLASH4_MAX_PAGE_SIZE) ? FLASH4_MAX_PAGE_SIZE : (uint16)nData;
+
+        Flash4_ReadFlash4(outData, addr, chunk);
+        outData += chunk;
+        addr    += chunk;
+        nData   -= chunk;
+    }
+}
+
+uint8 Flash4_ProgramPage(const uint8 *inData, uint32 addr, uint16 nData)
+{
+    Flash4_WriteCommand(FLASH4_CMD_WRITE_ENABLE_WREN);
+    Flash4_PageProgram4((uint8 *)inData, addr, nData);
+    return Flash4_WaitReady(FLASH4_PROGRAM_TIMEOUT_MS);
+}
+
+uint8 Flash4_EraseSector(uint32 addr)
+{
+    Flash4_WriteCommand(FLASH4_CMD_WRITE_ENABLE_WREN);
+    Flash4_SectorErase4(addr);
+    return Flash4_WaitReady(FLASH4_ERASE_TIMEOUT_MS);
+}
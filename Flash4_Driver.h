@@ -73,8 +73,23 @@
 #define FLASH4_MANUFACTURER_ID                   0x01
 #define FLASH4_DEVICE_ID                         0x19
 
+/* Status register 1 */
+#define FLASH4_SR1_WIP                           0x01        /* Write in progress                              */
+#define FLASH4_SR1_E_ERR                         0x20        /* Erase error, WIP stays set until cleared       */
+#define FLASH4_SR1_P_ERR                         0x40        /* Program error, WIP stays set until cleared     */
+
+/* ECC status register of one ECC unit */
+#define FLASH4_ECC_UNIT_SIZE                     16
+#define FLASH4_ECCSR_DISABLED                    0x01        /* Unit programmed more than once, no ECC         */
+#define FLASH4_ECCSR_DATA_CORRECTED              0x02        /* Single bit error in the data corrected         */
+#define FLASH4_ECCSR_ECC_CORRECTED               0x04        /* Single bit error in the ECC bits corrected     */
+
 /* Configuration */
 #define FLASH4_MAX_PAGE_SIZE                     256
+#define FLASH4_READ_HEADER_SIZE                  5           /* Command and 4 address bytes ahead of read data */
+#define FLASH4_SECTOR_SIZE                       0x00040000  /* 256 KB uniform sectors (S25FL512S) */
+#define FLASH4_PROGRAM_TIMEOUT_MS                1000
+#define FLASH4_ERASE_TIMEOUT_MS                  5000
 #define FLASH4_QSPI_BAUDRATE                     1000000     /* 1 MHz SPI clock */
 
 /* Interrupt Service Routine priorities */
@@ -161,6 +176,22 @@ void Flash4_WriteByte(uint8 reg, uint8 txData);
  */
 void Flash4_ReadFlash4(uint8 *outData, uint32 addr, uint16 nData);
 
+/**
+ * \brief Start a read with 4-byte address without waiting for it
+ * The QSPI interrupts fill rxData while the caller goes on; the data starts at rxData[FLASH4_READ_HEADER_SIZE].
+ * Only one read may be in flight, check Flash4_IsReadBusy() before touching rxData or starting the next access.
+ * \param rxData Receive buffer of FLASH4_READ_HEADER_SIZE + nData bytes, must stay valid until the read is done
+ * \param addr Start address (32-bit)
+ * \param nData Number of bytes to read (max 256)
+ */
+void Flash4_StartRead(uint8 *rxData, uint32 addr, uint16 nData);
+
+/**
+ * \brief Check whether the read started with Flash4_StartRead() is still running
+ * \return TRUE while the transfer is in progress
+ */
+boolean Flash4_IsReadBusy(void);
+
 /**
  * \brief Write data to flash memory with 4-byte address (page program)
  * \param inData Input data buffer
@@ -187,6 +218,22 @@ uint8 Flash4_CheckWIP(void);
  */
 uint8 Flash4_CheckWEL(void);
 
+/**
+ * \brief Check for a failed program or erase and clear the error
+ * A failed operation keeps WIP set until the status register is cleared, so a poll loop on Flash4_CheckWIP() has
+ * to call this as well.
+ * \return FLASH4_SR1_P_ERR and / or FLASH4_SR1_E_ERR if set, 0 otherwise
+ */
+uint8 Flash4_CheckError(void);
+
+/**
+ * \brief Read the ECC status of the ECC unit holding an address
+ * The device corrects single bit errors on every read, this tells whether a correction was needed.
+ * \param addr Any address inside the FLASH4_ECC_UNIT_SIZE byte unit (32-bit)
+ * \return ECC status register, FLASH4_ECCSR_* bits
+ */
+uint8 Flash4_ReadEccStatus(uint32 addr);
+
 /**
  * \brief Software reset of the flash device
  */
@@ -195,9 +242,33 @@ void Flash4_Reset(void);
 /**
  * \brief Wait for flash operation to complete
  * \param timeoutMs Timeout in milliseconds
- * \return FLASH4_OK if ready, FLASH4_TIMEOUT if timeout
+ * \return FLASH4_OK if ready, FLASH4_ERROR if the program or erase failed, FLASH4_TIMEOUT if timeout
  */
 uint8 Flash4_WaitReady(uint32 timeoutMs);
 
+/**
+ * \brief Read an arbitrary length from flash, split into page sized transfers
+ * \param outData Output buffer
+ * \param addr Start address (32-bit)
+ * \param nData Number of bytes to read
+ */
+void Flash4_ReadBuffer(uint8 *outData, uint32 addr, uint32 nData);
+
+/**
+ * \brief Write enable, program one page and wait for completion
+ * \param inData Input data buffer
+ * \param addr Start address (32-bit), the write must not cross a page boundary
+ * \param nData Number of bytes to write (max 256)
+ * \return FLASH4_OK on success, FLASH4_ERROR on a program error, FLASH4_TIMEOUT if the device stays busy
+ */
+uint8 Flash4_ProgramPage(const uint8 *inData, uint32 addr, uint16 nData);
+
+/**
+ * \brief Write enable, erase one sector and wait for completion
+ * \param addr Any address inside the sector (32-bit)
+ * \return FLASH4_OK on success, FLASH4_ERROR on an erase error, FLASH4_TIMEOUT if the device stays busy
+ */
+uint8 Flash4_EraseSector(uint32 addr);
+
 #endif /* FLASH4_DRIVER_H_ */
 
@@ -7,7 +7,34 @@
  *********************************************************************************************************************/
 
 #include "Flash4_Driver.h"
+#include "Flash4_Config.h"
+#include "Flash4_TimeSeries.h"
+#include "Flash4_Scrubber.h"
+#include "Ota_StreamWriter.h"
+#include "Ota_Slots.h"
+#include "Ota_Patch.h"
+#include "Ota_Lz.h"
+#include "Ota_Manifest.h"
+#include "Ota_Installer.h"
+#include "Ota_BankSwap.h"
+#include "Ota_ChunkStore.h"
+#include "Ota_Pipeline.h"
+#include "HybridKem.h"
+#include "MlDsa.h"
+#include "Keccak.h"
+#include "Ota_DualVerify.h"
+#include "Flash4_Hash.h"
+#include "Ota_Gcm.h"
+#include "ChaChaPoly.h"
+#include "X25519.h"
+#include "Ed25519.h"
+#include "CtrDrbg.h"
+#include "Flash4_Window.h"
+#include "Flash4_Archive.h"
 #include "IfxStm.h"
+#include "IfxCpu.h"
+#include "IfxScuRcu.h"
+#include <string.h>
 
 /*********************************************************************************************************************/
 /*----------------------------------Helper Functions-----------------------------------------------------------------*/
@@ -439,8 +466,8 @@ boolean Example6_LogData(void)
  * 
  * This example demonstrates:
  * - Storing firmware image in flash
- * - Verifying firmware with CRC
- * - Reading firmware for boot loader
+ * - Verifying firmware with SHA-256, hashing the read back while the next page is read
+ * - Storing per-chunk CRCs for the background scrubber (Example 9)
  * 
  * \return TRUE if successful, FALSE otherwise
  */
@@ -448,94 +475,1669 @@ boolean Example6_LogData(void)
 #define FIRMWARE_START_ADDRESS  0x00100000
 #define FIRMWARE_MAX_SIZE       0x00100000  /* 1 MB */
 
-/* Simple CRC-16 calculation */
-static uint16 calculateCRC16(const uint8 *data, uint32 length)
+boolean Example7_StoreFirmware(const uint8 *firmwareData, uint32 firmwareSize)
+{
+    uint32 sectorsToErase;
+    uint32 i;
+    uint8 calculatedDigest[SHA256_DIGEST_SIZE];
+    uint8 verifyDigest[SHA256_DIGEST_SIZE];
+    
+    if(firmwareSize > FIRMWARE_MAX_SIZE)
+        return FALSE;
+    
+    /* Calculate number of sectors to erase */
+    sectorsToErase = (firmwareSize + 0x3FFFF) / 0x40000;  /* Round up */
+    
+    /* Erase sectors */
+    for(i = 0; i < sectorsToErase; i++)
+    {
+        uint32 sectorAddress = FIRMWARE_START_ADDRESS + (i * 0x40000);
+        
+        Flash4_WriteCommand(FLASH4_CMD_WRITE_ENABLE_WREN);
+        Flash4_SectorErase4(sectorAddress);
+        if(Flash4_WaitReady(5000) != FLASH4_OK)
+            return FALSE;
+    }
+    
+    /* Calculate digest before writing */
+    Sha256_Calculate(firmwareData, firmwareSize, calculatedDigest);
+    
+    /* Write firmware in pages */
+    uint32 bytesWritten = 0;
+    uint32 currentAddress = FIRMWARE_START_ADDRESS;
+    
+    while(bytesWritten < firmwareSize)
+    {
+        uint16 bytesToWrite = (firmwareSize - bytesWritten > 256) ? 256 : (firmwareSize - bytesWritten);
+        
+        Flash4_WriteCommand(FLASH4_CMD_WRITE_ENABLE_WREN);
+        Flash4_PageProgram4((uint8*)&firmwareData[bytesWritten], currentAddress, bytesToWrite);
+        if(Flash4_WaitReady(1000) != FLASH4_OK)
+            return FALSE;
+        
+        bytesWritten += bytesToWrite;
+        currentAddress += bytesToWrite;
+    }
+    
+    /* Verify by reading back and hashing (double-buffered page reads) */
+    Flash4_Hash_Sha256(FIRMWARE_START_ADDRESS, firmwareSize, verifyDigest);
+    
+    if(memcmp(verifyDigest, calculatedDigest, SHA256_DIGEST_SIZE) != 0)
+        return FALSE;
+    
+    /* Store per-chunk CRCs so the image can be scrubbed in the background */
+    Flash4_ScrubRegion_t region = {FIRMWARE_START_ADDRESS, firmwareSize, FLASH4_FIRMWARE_SCRUB_CHUNK_SIZE,
+                                   FLASH4_FIRMWARE_CRC_TABLE_ADDRESS, FLASH4_SCRUB_NO_RELOCATION};
+    
+    if(Flash4_EraseSector(FLASH4_FIRMWARE_CRC_TABLE_ADDRESS) != FLASH4_OK)
+        return FALSE;
+    
+    if(Flash4_Scrubber_WriteCrcTable(&region) != FLASH4_OK)
+        return FALSE;
+    
+    return TRUE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 8: Compressed Data Logging-------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Example 8: Compressed Time-Series Logging
+ *
+ * This example demonstrates:
+ * - Logging samples with delta-of-delta / zig-zag encoding
+ * - Page granularity flushes (one page program per ~240 samples)
+ * - Streaming the log back, oldest sample first
+ *
+ * \return TRUE if successful, FALSE otherwise
+ */
+boolean Example8_CompressedLogging(void)
+{
+    const Flash4_TsConfig_t logConfig = {FLASH4_TSLOG_START_ADDRESS, FLASH4_TSLOG_SECTOR_COUNT};
+    static Flash4_TsWriter_t writer;
+    static Flash4_TsReader_t reader;
+    Flash4_TsSample_t sample;
+    Flash4_TsSample_t lastWritten;
+    Flash4_TsSample_t lastRead;
+    uint16 i;
+
+    if(Flash4_TsWriter_Init(&writer, &logConfig) != FLASH4_OK)
+        return FALSE;
+
+    /* Log 1000 samples of a slowly varying signal, 10 ms apart */
+    sample.timestamp = IfxStm_get(&MODULE_STM0) / 100000;  /* ms */
+    sample.value = 1234;
+    sample.status = 0x01;
+
+    for(i = 0; i < 1000; i++)
+    {
+        sample.timestamp += 10;
+        sample.value += (uint16)((i % 8 == 0) ? 1 : 0);
+
+        if(Flash4_TsWriter_Append(&writer, &sample) != FLASH4_OK)
+            return FALSE;
+    }
+    lastWritten = sample;
+
+    /* Program the partially filled page */
+    if(Flash4_TsWriter_Flush(&writer) != FLASH4_OK)
+        return FALSE;
+
+    /* Read back, the newest sample must match the last one written */
+    if(Flash4_TsReader_Init(&reader, &logConfig) != FLASH4_OK)
+        return FALSE;
+
+    lastRead.timestamp = 0;
+    while(Flash4_TsReader_Next(&reader, &sample))
+    {
+        lastRead = sample;
+    }
+
+    if(lastRead.timestamp != lastWritten.timestamp || lastRead.value != lastWritten.value)
+        return FALSE;
+
+    return TRUE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 9: Background Scrubbing----------------------------------------------------*/
+/*********************************************************************************************************************/
+
+#define SCRUB_RECORD_MAGIC      0x5352      /* "RS" */
+#define SCRUB_RECORD_SLOTS      (FLASH4_MAX_PAGE_SIZE / sizeof(ScrubRecord_t))
+
+/*
+ * Address of a relocated region, appended to the record page so it survives a reset. One record fills one ECC unit,
+ * programming a unit a second time would disable its ECC.
+ */
+typedef struct
+{
+    uint16 magic;
+    uint8  regionIndex;
+    uint8  reserved;
+    uint32 address;
+    uint32 unused[2];
+} ScrubRecord_t;
+
+static Flash4_ScrubRegion_t g_scrubRegions[1];
+static volatile boolean g_scrubRecordError = FALSE;
+
+/* Apply the stored records, a relocated region keeps its new address and has no spare left */
+static void loadScrubRecords(void)
+{
+    ScrubRecord_t records[SCRUB_RECORD_SLOTS];
+    uint32 i;
+
+    Flash4_ReadFlash4((uint8 *)records, FLASH4_SCRUB_RECORD_ADDRESS, sizeof(records));
+    for(i = 0; i < SCRUB_RECORD_SLOTS && records[i].magic == SCRUB_RECORD_MAGIC; i++)
+    {
+        if(records[i].regionIndex < sizeof(g_scrubRegions) / sizeof(g_scrubRegions[0]))
+        {
+            g_scrubRegions[records[i].regionIndex].address = records[i].address;
+            g_scrubRegions[records[i].regionIndex].relocationAddress = FLASH4_SCRUB_NO_RELOCATION;
+        }
+    }
+}
+
+/* Program a record into the first erased slot */
+static boolean storeScrubRecord(uint8 regionIndex, uint32 address)
+{
+    ScrubRecord_t record;
+    uint32 i;
+
+    for(i = 0; i < SCRUB_RECORD_SLOTS; i++)
+    {
+        Flash4_ReadFlash4((uint8 *)&record, FLASH4_SCRUB_RECORD_ADDRESS + i * sizeof(record), sizeof(record));
+        if(record.magic == 0xFFFF)
+        {
+            record.magic = SCRUB_RECORD_MAGIC;
+            record.regionIndex = regionIndex;
+            record.reserved = 0;
+            record.address = address;
+            record.unused[0] = 0xFFFFFFFF;
+            record.unused[1] = 0xFFFFFFFF;
+            return (Flash4_ProgramPage((const uint8 *)&record, FLASH4_SCRUB_RECORD_ADDRESS + i * sizeof(record),
+                                       sizeof(record)) == FLASH4_OK) ? TRUE : FALSE;
+        }
+    }
+
+    return FALSE;
+}
+
+static void scrubEvent(Flash4_ScrubEvent event, uint8 regionIndex, uint32 address)
+{
+    /* Persist the new address before returning, the scrubber switches the region over afterwards */
+    if(event == Flash4_ScrubEvent_regionRelocated && !storeScrubRecord(regionIndex, address))
+    {
+        g_scrubRecordError = TRUE;
+    }
+}
+
+/**
+ * \brief Example 9: Background Integrity Scrubbing
+ *
+ * This example demonstrates:
+ * - Scrubbing the firmware image stored by Example 7 against its chunk CRCs and the device ECC status
+ * - Limiting the scrubber to one page every 10 ms after 50 ms of foreground silence
+ * - Relocating the image to spare sectors while ECC corrections show it degrading, and persisting the new address
+ *   from the relocation event so it is used again after a reset
+ *
+ * A failed chunk cannot be repaired by the scrubber, the image has to be stored again (Example 7), which also
+ * erases the relocation records together with the CRC table.
+ *
+ * \param firmwareSize Size of the image stored by Example 7
+ * \return TRUE if a complete pass found no failed chunk, FALSE otherwise
+ */
+boolean Example9_BackgroundScrub(uint32 firmwareSize)
+{
+    static Flash4_Scrubber_t scrubber;
+    Flash4_ScrubBudget_t budget;
+    uint32 ticksPerMs = (uint32)(IfxStm_getFrequency(&MODULE_STM0) / 1000u);
+    uint64 passTicks = 60000uLL * ticksPerMs;
+
+    g_scrubRecordError = FALSE;
+    g_scrubRegions[0].address           = FIRMWARE_START_ADDRESS;
+    g_scrubRegions[0].length            = firmwareSize;
+    g_scrubRegions[0].chunkSize         = FLASH4_FIRMWARE_SCRUB_CHUNK_SIZE;
+    g_scrubRegions[0].crcTableAddress   = FLASH4_FIRMWARE_CRC_TABLE_ADDRESS;
+    g_scrubRegions[0].relocationAddress = FLASH4_SCRUB_SPARE_ADDRESS;
+    loadScrubRecords();
+
+    /* One pass a minute, limited to the 32 bit tick range (43 s at 100 MHz) */
+    budget.bytesPerSlice = 256;
+    budget.sliceTicks    = 10 * ticksPerMs;
+    budget.quietTicks    = 50 * ticksPerMs;
+    budget.passTicks     = (passTicks > 0xFFFFFFFFuLL) ? 0xFFFFFFFFu : (uint32)passTicks;
+
+    if(Flash4_Scrubber_Init(&scrubber, g_scrubRegions, 1, &budget, scrubEvent) != FLASH4_OK)
+        return FALSE;
+
+    /* In the application this is the idle loop; foreground code calls Flash4_Scrubber_NotifyForeground() */
+    while(scrubber.passes == 0)
+    {
+        Flash4_Scrubber_Step(&scrubber);
+    }
+
+    return (scrubber.chunksFailed == 0 && !g_scrubRecordError) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 10: Streaming Firmware Download---------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Feed received frames to the writer until size bytes have arrived */
+static boolean streamImage(Ota_StreamWriter_t *writer, uint32 (*receive)(uint8 *buffer, uint32 capacity), uint32 size)
+{
+    uint8 frame[64];
+    uint32 received = 0;
+
+    /* After a program or erase error the rest of the image is not received, Finish reports the error */
+    while(received < size && Ota_StreamWriter_GetStatus(writer) == FLASH4_OK)
+    {
+        uint32 length = receive(frame, sizeof(frame));
+        uint32 offset = 0;
+
+        if(length == 0)
+        {
+            Ota_StreamWriter_Poll(writer);
+            continue;
+        }
+
+        /* The ring is full only if the flash falls behind, keep polling until the frame is taken */
+        while(offset < length)
+        {
+            offset += Ota_StreamWriter_Write(writer, &frame[offset], length - offset);
+            if(offset < length)
+                Ota_StreamWriter_Poll(writer);
+        }
+
+        received += length;
+    }
+
+    return (Ota_StreamWriter_Finish(writer, FLASH4_ERASE_TIMEOUT_MS) == FLASH4_OK) ? TRUE : FALSE;
+}
+
+/**
+ * \brief Example 10: Streaming Firmware Download
+ *
+ * This example demonstrates:
+ * - Writing an image to Flash4 while it is being received, with only 1 KB of page buffers
+ * - Erasing the next sector in the background instead of all sectors up front
+ * - Polling the writer while the transport waits for the next frame
+ *
+ * \param receive Transport receive function, returns the number of bytes copied (0 if no frame is pending)
+ * \param firmwareSize Announced image size
+ * \return TRUE if successful, FALSE otherwise
+ */
+boolean Example10_StreamFirmware(uint32 (*receive)(uint8 *buffer, uint32 capacity), uint32 firmwareSize)
+{
+    static Ota_StreamWriter_t writer;
+
+    if(firmwareSize > FIRMWARE_MAX_SIZE)
+        return FALSE;
+
+    if(Ota_StreamWriter_Init(&writer, FIRMWARE_START_ADDRESS, firmwareSize) != FLASH4_OK)
+        return FALSE;
+
+    return streamImage(&writer, receive, firmwareSize);
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 11: A/B Firmware Update-----------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Example 11: A/B Firmware Update
+ *
+ * This example demonstrates:
+ * - Downloading into the inactive slot while the active slot keeps running
+ * - Activating the new image with a single metadata record
+ * - Trial boots with automatic rollback (Ota_Slots_SelectBoot / Ota_Slots_Confirm at startup)
+ *
+ * \param receive Transport receive function, returns the number of bytes copied (0 if no frame is pending)
+ * \param firmwareSize Announced image size
+ * \param version Announced firmware version
+ * \return TRUE if the new image is activated, FALSE otherwise
+ */
+boolean Example11_SlotUpdate(uint32 (*receive)(uint8 *buffer, uint32 capacity), uint32 firmwareSize, uint32 version)
+{
+    static Ota_Slots_t slots;
+    static Ota_StreamWriter_t writer;
+    uint8 target;
+
+    if(firmwareSize > OTA_SLOT_SIZE)
+        return FALSE;
+
+    (void)Ota_Slots_Init(&slots);
+    target = Ota_Slots_GetInactive(&slots);
+
+    if(Ota_Slots_BeginDownload(&slots) != FLASH4_OK)
+        return FALSE;
+
+    if(Ota_StreamWriter_Init(&writer, Ota_Slots_GetAddress(target), firmwareSize) != FLASH4_OK)
+        return FALSE;
+
+    /* A failed download leaves the slot in state downloading, the active slot is untouched */
+    if(!streamImage(&writer, receive, firmwareSize))
+        return FALSE;
+
+    if(Ota_Slots_CompleteDownload(&slots, version, firmwareSize, NULL_PTR) != FLASH4_OK)
+        return FALSE;
+
+    /* Commit point: after this record the next reset boots the new slot on trial */
+    return (Ota_Slots_Activate(&slots) == FLASH4_OK) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 12: Delta Update------------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Example 12: Delta Update
+ *
+ * This example demonstrates:
+ * - Receiving a patch built with Tools/ota_mkpatch instead of the full image
+ * - Rebuilding the new image in the inactive slot from the active slot while the patch arrives
+ * - Activating it like a full download (Example 11)
+ *
+ * \param receive Transport receive function, returns the number of bytes copied (0 if no frame is pending)
+ * \param patchSize Announced patch size
+ * \param version Announced firmware version
+ * \return TRUE if the new image is activated, FALSE otherwise
+ */
+boolean Example12_DeltaUpdate(uint32 (*receive)(uint8 *buffer, uint32 capacity), uint32 patchSize, uint32 version)
+{
+    static Ota_Slots_t slots;
+    static Ota_StreamWriter_t writer;
+    static Ota_Patch_t patch;
+    const Ota_SlotInfo_t *active;
+    uint8 frame[64];
+    uint32 received = 0;
+
+    (void)Ota_Slots_Init(&slots);
+    active = &slots.record.slots[slots.record.activeSlot];
+
+    if(Ota_Slots_BeginDownload(&slots) != FLASH4_OK)
+        return FALSE;
+
+    /* The patch header names the CRC of the image it was built against, a patch for another base is rejected */
+    Ota_Patch_Init(&patch, &writer, Ota_Slots_GetAddress(slots.record.activeSlot), active->size, active->imageCrc,
+                   Ota_Slots_GetAddress(Ota_Slots_GetInactive(&slots)));
+
+    while(received < patchSize && patch.state != Ota_PatchState_error)
+    {
+        uint32 length = receive(frame, sizeof(frame));
+        uint32 offset = 0;
+
+        /* Also called without new data: copies from the old image progress meanwhile */
+        do
+        {
+            offset += Ota_Patch_Write(&patch, &frame[offset], length - offset);
+        } while(offset < length && patch.state != Ota_PatchState_error);
+
+        received += length;
+    }
+
+    if(Ota_Patch_Finish(&patch, FLASH4_ERASE_TIMEOUT_MS) != FLASH4_OK)
+        return FALSE;
+
+    if(Ota_Slots_CompleteDownload(&slots, version, patch.header.newSize, NULL_PTR) != FLASH4_OK)
+        return FALSE;
+
+    return (Ota_Slots_Activate(&slots) == FLASH4_OK) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 13: Compressed Update-------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Example 13: Compressed Update
+ *
+ * This example demonstrates:
+ * - Receiving an image compressed with Tools/ota_lz
+ * - Decompressing it on the fly into the inactive slot, nothing larger than the 4 KB window is buffered
+ * - Activating it like a full download (Example 11)
+ *
+ * \param receive Transport receive function, returns the number of bytes copied (0 if no frame is pending)
+ * \param compressedSize Announced size of the compressed stream
+ * \param version Announced firmware version
+ * \return TRUE if the new image is activated, FALSE otherwise
+ */
+boolean Example13_CompressedUpdate(uint32 (*receive)(uint8 *buffer, uint32 capacity), uint32 compressedSize,
+                                   uint32 version)
+{
+    static Ota_Slots_t slots;
+    static Ota_StreamWriter_t writer;
+    static Ota_Lz_t lz;
+    uint8 frame[64];
+    uint32 received = 0;
+
+    (void)Ota_Slots_Init(&slots);
+
+    if(Ota_Slots_BeginDownload(&slots) != FLASH4_OK)
+        return FALSE;
+
+    Ota_Lz_Init(&lz, &writer, Ota_Slots_GetAddress(Ota_Slots_GetInactive(&slots)));
+
+    while(received < compressedSize && lz.state != Ota_LzState_error)
+    {
+        uint32 length = receive(frame, sizeof(frame));
+        uint32 offset = 0;
+
+        /* Input the writer cannot take yet is offered again, the window holds the decoded backlog */
+        do
+        {
+            offset += Ota_Lz_Write(&lz, &frame[offset], length - offset);
+        } while(offset < length && lz.state != Ota_LzState_error);
+
+        received += length;
+    }
+
+    if(Ota_Lz_Finish(&lz, FLASH4_ERASE_TIMEOUT_MS) != FLASH4_OK)
+        return FALSE;
+
+    if(Ota_Slots_CompleteDownload(&slots, version, lz.header.originalSize, NULL_PTR) != FLASH4_OK)
+        return FALSE;
+
+    return (Ota_Slots_Activate(&slots) == FLASH4_OK) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 14: Decompression Benchmark-------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Example 14: Decompression Benchmark
+ *
+ * This example demonstrates:
+ * - Measuring the decoder alone, without flash programming, using the CPU clock counter
+ * - Feeding the stream in 64 byte frames like a transport would
+ *
+ * Compare with the host figures of "ota_lz -b" for the same file. Run it from a core with the stream and
+ * the decoder state in its local RAM to see the best case.
+ *
+ * \param stream Stream produced by Tools/ota_lz, e.g. linked in as a constant array
+ * \param length Stream size
+ * \return CPU cycles per decompressed byte, 0 if the stream is invalid
+ */
+uint32 Example14_DecompressBenchmark(const uint8 *stream, uint32 length)
+{
+    static Ota_Lz_t lz;
+    IfxCpu_Perf perf;
+    uint32 offset = 0;
+
+    Ota_Lz_Init(&lz, NULL_PTR, 0);
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+
+    while(lz.state != Ota_LzState_done && lz.state != Ota_LzState_error)
+    {
+        const uint8 *data;
+        uint32 frame = (length - offset > 64u) ? 64u : length - offset;
+        uint32 n;
+
+        offset += Ota_Lz_Decode(&lz, &stream[offset], frame);
+
+        /* Release includes the CRC, as in a real download */
+        while((n = Ota_Lz_GetOutput(&lz, &data)) > 0u)
+            Ota_Lz_Release(&lz, n);
+
+        if(frame == 0u && lz.state != Ota_LzState_match)
+            break;
+    }
+
+    perf = IfxCpu_stopCounters();
+
+    if(lz.state != Ota_LzState_done || lz.crc != lz.header.originalCrc || perf.clock.overlfow)
+        return 0;
+
+    return perf.clock.counter / lz.header.originalSize;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 15: Verified Chunk Download-------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Example 15: Verified Chunk Download
+ *
+ * This example demonstrates:
+ * - Accepting the chunk hashes of a manifest built with Tools/ota_mkmanifest against its signed root
+ * - Verifying every chunk before it is programmed into the inactive slot
+ * - Requesting only the chunks that failed again, no full-slot read-back at the end
+ * - Resuming an interrupted download from the persisted chunk bitmap instead of starting over
+ *
+ * \param header Manifest header, its signature already checked by the caller
+ * \param receive Transport receive function for the chunk hashes following the header
+ * \param fetchChunk Transport request for one chunk, returns the number of bytes copied
+ * \return TRUE if the new image is activated, FALSE otherwise
+ */
+boolean Example15_ManifestUpdate(const Ota_ManifestHeader_t *header, uint32 (*receive)(uint8 *buffer, uint32 capacity),
+                                 uint32 (*fetchChunk)(uint32 index, uint8 *buffer, uint32 capacity))
+{
+    static Ota_Slots_t slots;
+    static Ota_Manifest_t manifest;
+    static uint8 chunk[4096];
+    uint8 frame[64];
+    uint32 index;
+    uint32 retries = 0;
+    uint8 target;
+
+    if(header->chunkBits > 12u)
+        return FALSE;
+
+    (void)Ota_Slots_Init(&slots);
+    target = Ota_Slots_GetInactive(&slots);
+
+    /* After a reset or a dropped link the same manifest continues with the first missing chunk */
+    if(slots.record.slots[target].state != (uint8)Ota_SlotState_downloading ||
+       Ota_Manifest_Resume(&manifest, header, Ota_Slots_GetAddress(target)) != FLASH4_OK)
+    {
+        if(Ota_Slots_BeginDownload(&slots) != FLASH4_OK)
+            return FALSE;
+
+        if(Ota_Manifest_Begin(&manifest, header, Ota_Slots_GetAddress(target)) != FLASH4_OK)
+            return FALSE;
+
+        while(manifest.state == Ota_ManifestState_leaves)
+        {
+            uint32 length = receive(frame, sizeof(frame));
+
+            (void)Ota_Manifest_WriteLeaves(&manifest, frame, length);
+        }
+    }
+
+    if(manifest.state != Ota_ManifestState_chunks && manifest.state != Ota_ManifestState_complete)
+        return FALSE;
+
+    /* Chunks that fail are skipped and requested again in the next pass */
+    index = Ota_Manifest_NextMissing(&manifest, 0);
+    while(manifest.state != Ota_ManifestState_complete)
+    {
+        uint32 length = fetchChunk(index, chunk, sizeof(chunk));
+        uint8 result = Ota_Manifest_WriteChunk(&manifest, index, chunk, length);
+
+        if(result == FLASH4_TIMEOUT || (result == FLASH4_ERROR && ++retries > header->chunkCount))
+            return FALSE;
+
+        index = Ota_Manifest_NextMissing(&manifest, index + 1u);
+        if(index == header->chunkCount)
+            index = Ota_Manifest_NextMissing(&manifest, 0);
+    }
+
+    /* Every chunk matched its hash when it was programmed, the CRC comes from the received data */
+    if(Ota_Slots_RecordDownload(&slots, header->imageVersion, header->imageSize, Ota_Manifest_GetImageCrc(&manifest),
+                                header->root) != FLASH4_OK)
+        return FALSE;
+
+    return (Ota_Slots_Activate(&slots) == FLASH4_OK) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 16: Install to PFlash-------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Percentage for the diagnostic interface */
+static uint32 g_installProgress;
+
+static void installProgress(uint32 installed, uint32 total)
+{
+    g_installProgress = (uint32)(((uint64)installed * 100u) / total);
+}
+
+/**
+ * \brief Example 16: Install to PFlash
+ *
+ * This example demonstrates:
+ * - Copying the verified active slot from Flash4 into program flash
+ * - Reading the next Flash4 pages while PFlash erases and burst-programs
+ * - Reporting progress, e.g. to the diagnostic interface
+ *
+ * \return TRUE if the image is installed and matches the slot, FALSE otherwise
+ */
+boolean Example16_InstallToPFlash(void)
+{
+    static Ota_Slots_t slots;
+    static Ota_Installer_t installer;
+    uint8 slot;
+
+    (void)Ota_Slots_Init(&slots);
+    slot = slots.record.activeSlot;
+    if(Ota_Slots_Verify(&slots, slot) != FLASH4_OK)
+        return FALSE;
+
+    if(Ota_Installer_Init(&installer, Ota_Slots_GetAddress(slot), OTA_PFLASH_INSTALL_ADDRESS,
+                          slots.record.slots[slot].size, installProgress) != FLASH4_OK)
+        return FALSE;
+
+    /* A 1 MB image needs 16 erase commands of 4 sectors and 4096 bursts */
+    return (Ota_Installer_Run(&installer, 60000u) == FLASH4_OK) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 17: Bank Swap Update--------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Example 17: Bank Swap Update
+ *
+ * This example demonstrates:
+ * - Installing the verified active slot into the inactive PFlash bank as a background job
+ * - Keeping the application running from the active bank meanwhile
+ * - Swapping the banks with a UCB_SWAP entry and a reset, the only downtime of the update
+ *
+ * \param applicationStep One pass of the application main loop, called between installer steps
+ * \return FALSE if the installation or the swap request failed, does not return otherwise
+ */
+boolean Example17_BankSwapUpdate(void (*applicationStep)(void))
+{
+    static Ota_Slots_t slots;
+    static Ota_BankSwap_t swap;
+    uint8 slot;
+
+    (void)Ota_Slots_Init(&slots);
+    slot = slots.record.activeSlot;
+    if(Ota_Slots_Verify(&slots, slot) != FLASH4_OK)
+        return FALSE;
+
+    if(Ota_BankSwap_Begin(&swap, Ota_Slots_GetAddress(slot), slots.record.slots[slot].size,
+                          installProgress) != FLASH4_OK)
+        return FALSE;
+
+    while(swap.state == Ota_SwapState_installing)
+    {
+        applicationStep();
+        Ota_BankSwap_Poll(&swap);
+    }
+
+    if(Ota_BankSwap_Commit(&swap) != FLASH4_OK)
+        return FALSE;
+
+    /* The startup software evaluates UCB_SWAP and starts the new image from the lower half */
+    IfxScuRcu_performReset(IfxScuRcu_ResetType_system, 0);
+    return FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 18: Deduplicated Update-----------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Example 18: Deduplicated Update
+ *
+ * This example demonstrates:
+ * - Seeding the chunk store from the installed image on first use
+ * - Accepting the chunk references of a recipe built with Tools/ota_mkrecipe against its signed header
+ * - Downloading only the chunks the store does not hold yet, from any earlier version or ECU image
+ * - Assembling the new image from the store into the inactive slot and activating it
+ *
+ * \param header Recipe header, its signature already checked by the caller
+ * \param receive Transport receive function for the chunk references following the header
+ * \param fetchChunk Transport request for the chunk of one reference, returns the number of bytes copied
+ * \return TRUE if the new image is activated, FALSE otherwise
+ */
+boolean Example18_DedupUpdate(const Ota_RecipeHeader_t *header, uint32 (*receive)(uint8 *buffer, uint32 capacity),
+                              uint32 (*fetchChunk)(uint32 index, uint8 *buffer, uint32 capacity))
+{
+    static Ota_Slots_t slots;
+    static Ota_ChunkStore_t store;
+    static uint8 chunk[OTA_CHUNKSTORE_MAX_CHUNK];
+    uint8 frame[64];
+    uint32 index;
+    uint32 retries = 0;
+    uint16 crc;
+    uint8 active;
+
+    (void)Ota_Slots_Init(&slots);
+    active = slots.record.activeSlot;
+
+    if(Ota_ChunkStore_Init(&store) != FLASH4_OK && Ota_ChunkStore_Format(&store) != FLASH4_OK)
+        return FALSE;
+
+    /* A new store starts with the chunks of the running version */
+    if(store.entryCount == 0u && Ota_Slots_Verify(&slots, active) == FLASH4_OK &&
+       Ota_ChunkStore_ImportImage(&store, Ota_Slots_GetAddress(active), slots.record.slots[active].size,
+                                  NULL_PTR) != FLASH4_OK)
+        return FALSE;
+
+    if(Ota_ChunkStore_BeginRecipe(&store, header) != FLASH4_OK)
+        return FALSE;
+
+    while(store.state == Ota_ChunkStoreState_recipe)
+    {
+        uint32 length = receive(frame, sizeof(frame));
+
+        (void)Ota_ChunkStore_WriteRecipe(&store, frame, length);
+    }
+
+    if(store.state != Ota_ChunkStoreState_chunks)
+        return FALSE;
+
+    /* Chunks added before a reset are found in the store, only the rest is requested again */
+    index = Ota_ChunkStore_NextMissing(&store, 0);
+    while(index < header->chunkCount)
+    {
+        uint32 length = fetchChunk(index, chunk, sizeof(chunk));
+        uint8 result = Ota_ChunkStore_AddChunk(&store, index, chunk, length);
+
+        if(result == FLASH4_TIMEOUT || (result == FLASH4_ERROR && ++retries > header->chunkCount))
+            return FALSE;
+
+        if(result == FLASH4_OK)
+            index = Ota_ChunkStore_NextMissing(&store, index + 1u);
+    }
+
+    if(Ota_Slots_BeginDownload(&slots) != FLASH4_OK ||
+       Ota_ChunkStore_Assemble(&store, Ota_Slots_GetAddress(Ota_Slots_GetInactive(&slots)), &crc) != FLASH4_OK)
+        return FALSE;
+
+    if(Ota_Slots_RecordDownload(&slots, header->imageVersion, header->imageSize, crc, header->imageDigest) != FLASH4_OK)
+        return FALSE;
+
+    return (Ota_Slots_Activate(&slots) == FLASH4_OK) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 19: Two-Core Staging--------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Staging time on core 0 and hashing time on core 1 in STM ticks, for the diagnostic interface */
+static uint32 g_stagingTicks;
+static uint32 g_stagingHashTicks;
+
+/**
+ * \brief Example 19: Two-Core Staging
+ *
+ * This example demonstrates:
+ * - Receiving and programming the chunks of a manifest download on core 0
+ * - Hashing every chunk on core 1 at the same time, in the slot it was received into
+ * - Measuring how much of the staging time core 1 spent hashing
+ *
+ * Core 1 runs Ota_Pipeline_Service() in its main loop. The chunk size of the manifest is at most 4 KB.
+ *
+ * \param header Manifest header, its signature already checked by the caller
+ * \param receive Transport receive function for the chunk hashes following the header
+ * \param fetchChunk Transport request for one chunk, returns the number of bytes copied
+ * \return TRUE if the new image is activated, FALSE otherwise
+ */
+boolean Example19_PipelinedUpdate(const Ota_ManifestHeader_t *header, uint32 (*receive)(uint8 *buffer, uint32 capacity),
+                                  uint32 (*fetchChunk)(uint32 index, uint8 *buffer, uint32 capacity))
+{
+    static Ota_Slots_t slots;
+    static Ota_Manifest_t manifest;
+    uint8 frame[64];
+    uint32 start;
+    uint32 hashStart;
+    uint8 target;
+    uint8 result;
+
+    (void)Ota_Slots_Init(&slots);
+    target = Ota_Slots_GetInactive(&slots);
+
+    if(slots.record.slots[target].state != (uint8)Ota_SlotState_downloading ||
+       Ota_Manifest_Resume(&manifest, header, Ota_Slots_GetAddress(target)) != FLASH4_OK)
+    {
+        if(Ota_Slots_BeginDownload(&slots) != FLASH4_OK)
+            return FALSE;
+
+        if(Ota_Manifest_Begin(&manifest, header, Ota_Slots_GetAddress(target)) != FLASH4_OK)
+            return FALSE;
+
+        while(manifest.state == Ota_ManifestState_leaves)
+        {
+            uint32 length = receive(frame, sizeof(frame));
+
+            (void)Ota_Manifest_WriteLeaves(&manifest, frame, length);
+        }
+    }
+
+    start = IfxStm_get(&MODULE_STM0);
+    hashStart = Ota_Pipeline_GetHashTicks();
+
+    result = Ota_Pipeline_StageManifest(&manifest, fetchChunk);
+
+    g_stagingTicks = IfxStm_get(&MODULE_STM0) - start;
+    g_stagingHashTicks = Ota_Pipeline_GetHashTicks() - hashStart;
+
+    if(result != FLASH4_OK)
+        return FALSE;
+
+    if(Ota_Slots_RecordDownload(&slots, header->imageVersion, header->imageSize, Ota_Manifest_GetImageCrc(&manifest),
+                                header->root) != FLASH4_OK)
+        return FALSE;
+
+    return (Ota_Slots_Activate(&slots) == FLASH4_OK) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 20: Hybrid Key Exchange Benchmark-------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* CPU cycles of the last run: client key pair, server encapsulation, client decapsulation */
+static uint32 g_keyExchangeCycles[3];
+
+#define ENTROPY_SAMPLES_PER_BYTE    8       /* Timer samples folded into one byte of entropy input          */
+#define ENTROPY_REPETITION_CUTOFF   32      /* Equal deltas in a row that fail the health check (SP 800-90B) */
+
+/* Random pool for key pairs and nonces, seeded on first use */
+static CtrDrbg_Pool_t g_randomPool;
+static boolean g_randomPoolReady = FALSE;
+
+/*
+ * Entropy source of the examples: the STM timer read after each Flash4 status read, whose duration jitters with the
+ * QSPI interrupt latency and bus arbitration. The derivation function of the DRBG condenses the samples, the
+ * repetition count test rejects a source that has stopped jittering. Production code passes the TRNG of the HSM.
+ */
+static boolean sampleEntropy(uint8 *data, uint32 length)
+{
+    uint32 previous = IfxStm_getLower(&MODULE_STM0);
+    uint32 lastDelta = 0;
+    uint32 repetitions = 0;
+    uint32 sample;
+    uint32 delta;
+    uint32 i;
+    uint32 j;
+    uint8 value;
+
+    for(i = 0; i < length; i++)
+    {
+        value = 0;
+        for(j = 0; j < ENTROPY_SAMPLES_PER_BYTE; j++)
+        {
+            (void)Flash4_CheckWIP();
+            sample = IfxStm_getLower(&MODULE_STM0);
+            delta = sample - previous;
+            previous = sample;
+
+            if(delta == lastDelta)
+            {
+                if(++repetitions >= ENTROPY_REPETITION_CUTOFF)
+                    return FALSE;
+            }
+            else
+            {
+                repetitions = 0;
+            }
+            lastDelta = delta;
+
+            value = (uint8)((value << 1) | (value >> 7)) ^ (uint8)delta;
+        }
+        data[i] = value;
+    }
+
+    return TRUE;
+}
+
+/* Take key material from the pool, refilling it in place if the examples drained it */
+static boolean getRandom(uint8 *data, uint32 length)
+{
+    if(!g_randomPoolReady)
+    {
+        g_randomPoolReady = CtrDrbg_PoolInit(&g_randomPool, sampleEntropy, NULL_PTR, 0u);
+        if(!g_randomPoolReady)
+            return FALSE;
+    }
+
+    if(CtrDrbg_Read(&g_randomPool, data, length))
+        return TRUE;
+
+    return (CtrDrbg_Refill(&g_randomPool) && CtrDrbg_Read(&g_randomPool, data, length)) ? TRUE : FALSE;
+}
+
+/**
+ * \brief Example 20: Hybrid Key Exchange Benchmark
+ *
+ * This example demonstrates:
+ * - Both sides of an X25519MLKEM768 key exchange as used in the TLS 1.3 handshake
+ * - Measuring each step with the CPU clock counter
+ * - Checking that client and server derive the same 64 byte secret
+ * - Drawing the key material from the CTR_DRBG pool instead of the LCG of IfxCpu_getRandomValue()
+ *
+ * Compare with the host figures of Tools/CryptoBench. The client side (key pair and decapsulation) is what the
+ * device runs per connection.
+ *
+ * \return TRUE if both sides derived the same secret, cycles in g_keyExchangeCycles
+ */
+boolean Example20_KeyExchangeBenchmark(void)
+{
+    static HybridKem_t client;
+    static HybridKem_t server;
+    static uint8 clientShare[HYBRIDKEM_CLIENT_SHARE_SIZE];
+    static uint8 serverShare[HYBRIDKEM_SERVER_SHARE_SIZE];
+    uint8 random[HYBRIDKEM_KEYPAIR_RANDOM_SIZE];
+    uint8 clientSecret[HYBRIDKEM_SECRET_SIZE];
+    uint8 serverSecret[HYBRIDKEM_SECRET_SIZE];
+    IfxCpu_Perf perf;
+    boolean valid;
+    uint32 i;
+
+    if(!getRandom(random, HYBRIDKEM_KEYPAIR_RANDOM_SIZE))
+        return FALSE;
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    HybridKem_KeyPair(&client, random, clientShare);
+    perf = IfxCpu_stopCounters();
+    g_keyExchangeCycles[0] = perf.clock.counter;
+
+    if(!getRandom(random, HYBRIDKEM_ENCAPSULATE_RANDOM_SIZE))
+        return FALSE;
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    valid = HybridKem_Encapsulate(&server, clientShare, random, serverShare, serverSecret);
+    perf = IfxCpu_stopCounters();
+    g_keyExchangeCycles[1] = perf.clock.counter;
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    valid &= HybridKem_Decapsulate(&client, serverShare, clientSecret);
+    perf = IfxCpu_stopCounters();
+    g_keyExchangeCycles[2] = perf.clock.counter;
+
+    for(i = 0; i < HYBRIDKEM_SECRET_SIZE; i++)
+    {
+        if(clientSecret[i] != serverSecret[i])
+            valid = FALSE;
+    }
+
+    return valid;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 21: Manifest Signature Benchmark--------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* CPU cycles of the last verification, for the diagnostic interface */
+static uint32 g_signatureCycles;
+
+/**
+ * \brief Example 21: Manifest Signature Benchmark
+ *
+ * This example demonstrates:
+ * - Verifying the ML-DSA signature of a manifest header before the download starts
+ * - Streaming the signer public key and the signature from Flash4 instead of copying them to RAM
+ * - Measuring the verification with the CPU clock counter
+ *
+ * The signer key sits at OTA_SIGNER_KEY_ADDRESS and the signature received with the header at
+ * OTA_MANIFEST_SIGNATURE_ADDRESS. The same check runs at boot against the header of the active slot.
+ *
+ * \param header Manifest header as received
+ * \param level Parameter set of the signer key
+ * \return TRUE if the signature is valid, cycles in g_signatureCycles
+ */
+boolean Example21_SignatureBenchmark(const Ota_ManifestHeader_t *header, MlDsa_Level level)
+{
+    static MlDsa_Workspace_t workspace;
+    static const uint8 context[] = OTA_MANIFEST_SIGNATURE_CONTEXT;
+    IfxCpu_Perf perf;
+    boolean valid;
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    valid = MlDsa_Verify(&workspace, level, OTA_SIGNER_KEY_ADDRESS, OTA_MANIFEST_SIGNATURE_ADDRESS, context,
+                         sizeof(context) - 1u, (const uint8 *)header, sizeof(Ota_ManifestHeader_t));
+    perf = IfxCpu_stopCounters();
+    g_signatureCycles = perf.clock.counter;
+
+    return valid;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 22: Dual Signature Check----------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* STM ticks of the last check: core 0 until the join, ML-DSA on core 1, ECDSA on core 2 */
+static uint32 g_dualVerifyTicks[3];
+
+/**
+ * \brief Example 22: Dual Signature Check
+ *
+ * This example demonstrates:
+ * - Accepting a manifest header only if both its ECDSA P-256 and its ML-DSA signature verify
+ * - Running the two verifications on core 2 and core 1 at the same time
+ * - Comparing the joined latency on core 0 with the time of each check
+ *
+ * Core 1 runs Ota_DualVerify_ServiceMlDsa() and core 2 Ota_DualVerify_ServiceEcdsa() in their main loops. The
+ * latency on core 0 should be close to the larger of the two check times, not their sum.
+ *
+ * \param header Manifest header as received
+ * \param level Parameter set of the ML-DSA signer key
+ * \return TRUE if both signatures are valid, ticks in g_dualVerifyTicks
+ */
+boolean Example22_DualSignatureCheck(const Ota_ManifestHeader_t *header, MlDsa_Level level)
+{
+    uint32 start = IfxStm_get(&MODULE_STM0);
+    boolean valid;
+
+    valid = Ota_DualVerify_Manifest(header, level);
+
+    g_dualVerifyTicks[0] = IfxStm_get(&MODULE_STM0) - start;
+    Ota_DualVerify_GetTicks(&g_dualVerifyTicks[1], &g_dualVerifyTicks[2]);
+
+    return valid;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 23: SHAKE Throughput--------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+#define KECCAK_BENCH_BLOCKS     16
+
+/* CPU cycles for KECCAK_BENCH_BLOCKS blocks of SHAKE128: absorbing, squeezing */
+static uint32 g_keccakCycles[2];
+
+/**
+ * \brief Example 23: SHAKE Throughput
+ *
+ * This example demonstrates:
+ * - Absorbing and squeezing SHAKE128 in whole blocks, as the ML-KEM and ML-DSA matrix samplers do
+ * - Measuring the Keccak permutation in cycles per byte with the CPU clock counter
+ * - Checking the permutation against the SHA3-256("abc") example of FIPS 202
+ *
+ * Divide g_keccakCycles by KECCAK_BENCH_BLOCKS * KECCAK_RATE_SHAKE128 bytes for cycles per byte and compare with
+ * the host figures of Tools/CryptoBench.
+ *
+ * \return TRUE if the SHA3-256 example matches, cycles in g_keccakCycles
+ */
+boolean Example23_ShakeThroughput(void)
 {
-    uint16 crc = 0xFFFF;
-    uint32 i;
-    uint8 j;
-    
-    for(i = 0; i < length; i++)
+    static const uint8 expected[SHA3_256_DIGEST_SIZE] = {
+        0x3A, 0x98, 0x5D, 0xA7, 0x4F, 0xE2, 0x25, 0xB2, 0x04, 0x5C, 0x17, 0x2D, 0x6B, 0xD3, 0x90, 0xBD,
+        0x85, 0x5F, 0x08, 0x6E, 0x3E, 0x9D, 0x52, 0x5B, 0x46, 0xBF, 0xE2, 0x45, 0x11, 0x43, 0x15, 0x32
+    };
+    static uint8 data[KECCAK_BENCH_BLOCKS * KECCAK_RATE_SHAKE128];
+    static Keccak_t ctx;
+    uint8 digest[SHA3_256_DIGEST_SIZE];
+    IfxCpu_Perf perf;
+
+    Keccak_Sha3_256((const uint8 *)"abc", 3u, digest);
+    if(memcmp(digest, expected, SHA3_256_DIGEST_SIZE) != 0)
+        return FALSE;
+
+    Keccak_Init(&ctx, KECCAK_RATE_SHAKE128);
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    Keccak_Absorb(&ctx, data, sizeof(data));
+    perf = IfxCpu_stopCounters();
+    g_keccakCycles[0] = perf.clock.counter;
+
+    Keccak_Finalize(&ctx, KECCAK_SUFFIX_SHAKE);
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    Keccak_SqueezeBlocks(&ctx, data, KECCAK_BENCH_BLOCKS);
+    perf = IfxCpu_stopCounters();
+    g_keccakCycles[1] = perf.clock.counter;
+
+    return TRUE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 24: Encrypted Update--------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Example 24: Encrypted Update
+ *
+ * This example demonstrates:
+ * - Receiving an image encrypted with Tools/ota_encrypt
+ * - Decrypting it with AES-GCM straight into the page ring of the writer, without a staging copy
+ * - Programming a chunk only after its tag has verified, so a forged frame never reaches the inactive slot
+ *
+ * \param receive Transport receive function, returns the number of bytes copied (0 if no frame is pending)
+ * \param streamSize Announced size of the encrypted stream
+ * \param version Announced firmware version
+ * \param key Image key, AES256_KEY_SIZE bytes
+ * \return TRUE if the new image is activated, FALSE otherwise
+ */
+boolean Example24_EncryptedUpdate(uint32 (*receive)(uint8 *buffer, uint32 capacity), uint32 streamSize,
+                                  uint32 version, const uint8 *key)
+{
+    static Ota_Slots_t slots;
+    static Ota_StreamWriter_t writer;
+    static Ota_Gcm_t gcm;
+    uint8 frame[64];
+    uint32 received = 0;
+
+    (void)Ota_Slots_Init(&slots);
+
+    if(Ota_Slots_BeginDownload(&slots) != FLASH4_OK)
+        return FALSE;
+
+    if(Ota_Gcm_Init(&gcm, &writer, Ota_Slots_GetAddress(Ota_Slots_GetInactive(&slots)), key,
+                    AES256_KEY_SIZE) != FLASH4_OK)
+        return FALSE;
+
+    while(received < streamSize && gcm.state != Ota_GcmState_error)
     {
-        crc ^= data[i];
-        for(j = 0; j < 8; j++)
+        uint32 length = receive(frame, sizeof(frame));
+        uint32 offset = 0;
+
+        /* Ciphertext the ring cannot take yet is offered again while the writer drains it */
+        do
         {
-            if(crc & 0x0001)
-                crc = (crc >> 1) ^ 0xA001;
-            else
-                crc >>= 1;
-        }
+            offset += Ota_Gcm_Write(&gcm, &frame[offset], length - offset);
+        } while(offset < length && gcm.state != Ota_GcmState_error);
+
+        received += length;
     }
-    
-    return crc;
+
+    if(Ota_Gcm_Finish(&gcm, FLASH4_ERASE_TIMEOUT_MS) != FLASH4_OK)
+        return FALSE;
+
+    if(Ota_Slots_CompleteDownload(&slots, version, gcm.header.imageSize, NULL_PTR) != FLASH4_OK)
+        return FALSE;
+
+    return (Ota_Slots_Activate(&slots) == FLASH4_OK) ? TRUE : FALSE;
 }
 
-boolean Example7_StoreFirmware(const uint8 *firmwareData, uint32 firmwareSize)
+/*********************************************************************************************************************/
+/*----------------------------------Example 25: Record Layer Throughput-------------------------------------------------*/
+/*********************************************************************************************************************/
+
+#define RECORD_BENCH_SIZE       1024
+
+/* CPU cycles for one RECORD_BENCH_SIZE byte record: seal, open */
+static uint32 g_recordCycles[2];
+
+/**
+ * \brief Example 25: Record Layer Throughput
+ *
+ * This example demonstrates:
+ * - Protecting a TLS 1.3 record with ChaCha20-Poly1305 in place, the record header as additional data
+ * - Opening it again in place, with the tag checked before anything is decrypted
+ * - Measuring both directions with the CPU clock counter
+ *
+ * Divide g_recordCycles by RECORD_BENCH_SIZE for cycles per byte and compare with the host figures of
+ * Tools/CryptoBench. The session key would come from the hybrid key exchange of Example 20.
+ *
+ * \param key Traffic key, CHACHAPOLY_KEY_SIZE bytes
+ * \param iv Traffic IV, CHACHAPOLY_NONCE_SIZE bytes
+ * \return TRUE if the record round trip succeeds, cycles in g_recordCycles
+ */
+boolean Example25_RecordThroughput(const uint8 *key, const uint8 *iv)
 {
-    uint32 sectorsToErase;
+    static const uint8 header[5] = {0x17, 0x03, 0x03, (RECORD_BENCH_SIZE + CHACHAPOLY_TAG_SIZE) >> 8,
+                                    (uint8)(RECORD_BENCH_SIZE + CHACHAPOLY_TAG_SIZE)};
+    static uint8 record[RECORD_BENCH_SIZE];
+    static ChaChaPoly_t ctx;
+    uint8 nonce[CHACHAPOLY_NONCE_SIZE];
+    uint8 tag[CHACHAPOLY_TAG_SIZE];
+    IfxCpu_Perf perf;
     uint32 i;
-    uint16 calculatedCRC;
-    uint16 storedCRC;
-    
-    if(firmwareSize > FIRMWARE_MAX_SIZE)
+
+    for(i = 0; i < RECORD_BENCH_SIZE; i++)
+        record[i] = (uint8)i;
+
+    /* Nonce of the first record: the sequence number 0 XORed into the IV leaves it unchanged */
+    memcpy(nonce, iv, CHACHAPOLY_NONCE_SIZE);
+    ChaChaPoly_Init(&ctx, key);
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    ChaChaPoly_Seal(&ctx, nonce, header, sizeof(header), record, RECORD_BENCH_SIZE, tag);
+    perf = IfxCpu_stopCounters();
+    g_recordCycles[0] = perf.clock.counter;
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    if(!ChaChaPoly_Open(&ctx, nonce, header, sizeof(header), record, RECORD_BENCH_SIZE, tag))
         return FALSE;
-    
-    /* Calculate number of sectors to erase */
-    sectorsToErase = (firmwareSize + 0x3FFFF) / 0x40000;  /* Round up */
-    
-    /* Erase sectors */
-    for(i = 0; i < sectorsToErase; i++)
+    perf = IfxCpu_stopCounters();
+    g_recordCycles[1] = perf.clock.counter;
+
+    for(i = 0; i < RECORD_BENCH_SIZE; i++)
     {
-        uint32 sectorAddress = FIRMWARE_START_ADDRESS + (i * 0x40000);
-        
-        Flash4_WriteCommand(FLASH4_CMD_WRITE_ENABLE_WREN);
-        Flash4_SectorErase4(sectorAddress);
-        if(Flash4_WaitReady(5000) != FLASH4_OK)
+        if(record[i] != (uint8)i)
             return FALSE;
     }
-    
-    /* Calculate CRC before writing */
-    calculatedCRC = calculateCRC16(firmwareData, firmwareSize);
-    
-    /* Write firmware in pages */
-    uint32 bytesWritten = 0;
-    uint32 currentAddress = FIRMWARE_START_ADDRESS;
-    
-    while(bytesWritten < firmwareSize)
+
+    return TRUE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 26: Curve25519 Benchmark----------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* CPU cycles: X25519 scalar multiplication, Ed25519 key pair, sign, verify */
+static uint32 g_curve25519Cycles[4];
+
+/**
+ * \brief Example 26: Curve25519 Benchmark
+ *
+ * This example demonstrates:
+ * - X25519 with the radix 2^25.5 field arithmetic, checked against the first example of RFC 7748
+ * - Ed25519 key generation, signing and verification, checked against test 1 of RFC 8032
+ * - Measuring each operation with the CPU clock counter
+ *
+ * Compare g_curve25519Cycles with the host figures of Tools/CryptoBench. The X25519 figure is the classical
+ * share of every hybrid handshake in Example 20.
+ *
+ * \return TRUE if both known answers match and the signature verifies, cycles in g_curve25519Cycles
+ */
+boolean Example26_Curve25519Benchmark(void)
+{
+    static const uint8 scalar[X25519_KEY_SIZE] = {
+        0xA5, 0x46, 0xE3, 0x6B, 0xF0, 0x52, 0x7C, 0x9D, 0x3B, 0x16, 0x15, 0x4B, 0x82, 0x46, 0x5E, 0xDD,
+        0x62, 0x14, 0x4C, 0x0A, 0xC1, 0xFC, 0x5A, 0x18, 0x50, 0x6A, 0x22, 0x44, 0xBA, 0x44, 0x9A, 0xC4
+    };
+    static const uint8 point[X25519_KEY_SIZE] = {
+        0xE6, 0xDB, 0x68, 0x67, 0x58, 0x30, 0x30, 0xDB, 0x35, 0x94, 0xC1, 0xA4, 0x24, 0xB1, 0x5F, 0x7C,
+        0x72, 0x66, 0x24, 0xEC, 0x26, 0xB3, 0x35, 0x3B, 0x10, 0xA9, 0x03, 0xA6, 0xD0, 0xAB, 0x1C, 0x4C
+    };
+    static const uint8 expected[X25519_KEY_SIZE] = {
+        0xC3, 0xDA, 0x55, 0x37, 0x9D, 0xE9, 0xC6, 0x90, 0x8E, 0x94, 0xEA, 0x4D, 0xF2, 0x8D, 0x08, 0x4F,
+        0x32, 0xEC, 0xCF, 0x03, 0x49, 0x1C, 0x71, 0xF7, 0x54, 0xB4, 0x07, 0x55, 0x77, 0xA2, 0x85, 0x52
+    };
+    static const uint8 secretKey[ED25519_SECRET_KEY_SIZE] = {
+        0x9D, 0x61, 0xB1, 0x9D, 0xEF, 0xFD, 0x5A, 0x60, 0xBA, 0x84, 0x4A, 0xF4, 0x92, 0xEC, 0x2C, 0xC4,
+        0x44, 0x49, 0xC5, 0x69, 0x7B, 0x32, 0x69, 0x19, 0x70, 0x3B, 0xAC, 0x03, 0x1C, 0xAE, 0x7F, 0x60
+    };
+    static const uint8 expectedSignature[ED25519_SIGNATURE_SIZE] = {
+        0xE5, 0x56, 0x43, 0x00, 0xC3, 0x60, 0xAC, 0x72, 0x90, 0x86, 0xE2, 0xCC, 0x80, 0x6E, 0x82, 0x8A,
+        0x84, 0x87, 0x7F, 0x1E, 0xB8, 0xE5, 0xD9, 0x74, 0xD8, 0x73, 0xE0, 0x65, 0x22, 0x49, 0x01, 0x55,
+        0x5F, 0xB8, 0x82, 0x15, 0x90, 0xA3, 0x3B, 0xAC, 0xC6, 0x1E, 0x39, 0x70, 0x1C, 0xF9, 0xB4, 0x6B,
+        0xD2, 0x5B, 0xF5, 0xF0, 0x59, 0x5B, 0xBE, 0x24, 0x65, 0x51, 0x41, 0x43, 0x8E, 0x7A, 0x10, 0x0B
+    };
+    uint8 output[X25519_KEY_SIZE];
+    uint8 publicKey[ED25519_PUBLIC_KEY_SIZE];
+    uint8 signature[ED25519_SIGNATURE_SIZE];
+    boolean valid;
+    IfxCpu_Perf perf;
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    (void)X25519_ScalarMult(output, scalar, point);
+    perf = IfxCpu_stopCounters();
+    g_curve25519Cycles[0] = perf.clock.counter;
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    Ed25519_PublicKey(publicKey, secretKey);
+    perf = IfxCpu_stopCounters();
+    g_curve25519Cycles[1] = perf.clock.counter;
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    Ed25519_Sign(signature, secretKey, publicKey, NULL_PTR, 0u);
+    perf = IfxCpu_stopCounters();
+    g_curve25519Cycles[2] = perf.clock.counter;
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    valid = Ed25519_Verify(publicKey, NULL_PTR, 0u, signature);
+    perf = IfxCpu_stopCounters();
+    g_curve25519Cycles[3] = perf.clock.counter;
+
+    return (valid && memcmp(output, expected, X25519_KEY_SIZE) == 0 &&
+            memcmp(signature, expectedSignature, ED25519_SIGNATURE_SIZE) == 0) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 27: Random Pool-------------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+#define RANDOM_BENCH_SIZE       32
+
+/* CPU cycles: pool read, direct CTR_DRBG request, refill of the drained bytes */
+static uint32 g_randomCycles[3];
+
+/**
+ * \brief Example 27: Random Pool
+ *
+ * This example demonstrates:
+ * - Seeding the CTR_DRBG pool from the entropy source shared with Example 20
+ * - A key sized read from the pool, which only copies bytes, next to the same request made directly to the DRBG
+ * - Refilling the pool in one batch, as the idle loop would between handshakes
+ *
+ * The difference between the first two figures is the AES work a handshake no longer waits for.
+ *
+ * \return TRUE if all steps succeed and the pool is full again, cycles in g_randomCycles
+ */
+boolean Example27_RandomPool(void)
+{
+    uint8 key[RANDOM_BENCH_SIZE];
+    IfxCpu_Perf perf;
+    boolean valid;
+
+    if(!getRandom(key, RANDOM_BENCH_SIZE))
+        return FALSE;
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    valid = CtrDrbg_Read(&g_randomPool, key, RANDOM_BENCH_SIZE);
+    perf = IfxCpu_stopCounters();
+    g_randomCycles[0] = perf.clock.counter;
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    valid &= CtrDrbg_Generate(&g_randomPool.drbg, key, RANDOM_BENCH_SIZE, NULL_PTR, 0u);
+    perf = IfxCpu_stopCounters();
+    g_randomCycles[1] = perf.clock.counter;
+
+    IfxCpu_resetAndStartCounters(IfxCpu_CounterMode_normal);
+    valid &= CtrDrbg_Refill(&g_randomPool);
+    perf = IfxCpu_stopCounters();
+    g_randomCycles[2] = perf.clock.counter;
+
+    memset(key, 0, sizeof(key));
+
+    return (valid && CtrDrbg_GetAvailable(&g_randomPool) == CTRDRBG_POOL_SIZE) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 28: Log Recovery After Reset------------------------------------------------*/
+/*********************************************************************************************************************/
+
+#define TSLOG_PAGES_PER_SECTOR  (FLASH4_SECTOR_SIZE / FLASH4_TS_BLOCK_SIZE)
+
+/**
+ * \brief Example 28: Time-Series Log Recovery After a Reset During a Wrap
+ *
+ * This example demonstrates:
+ * - Filling the log ring until it wraps, one block per sample so every page carries a known timestamp
+ * - A reset between the erase of the next sector and its first page program, simulated by erasing the sector
+ * - Reopening the log: the reader starts at the oldest remaining sector behind the erased one and returns every
+ *   surviving sample in order, the writer continues in the erased sector
+ *
+ * The log region of Example 8 is erased first.
+ *
+ * \return TRUE if all surviving samples are read back in order and logging continues, FALSE otherwise
+ */
+boolean Example28_LogResetRecovery(void)
+{
+    const Flash4_TsConfig_t logConfig = {FLASH4_TSLOG_START_ADDRESS, FLASH4_TSLOG_SECTOR_COUNT};
+    static Flash4_TsWriter_t writer;
+    static Flash4_TsReader_t reader;
+    Flash4_TsSample_t sample;
+    uint32 pages = (FLASH4_TSLOG_SECTOR_COUNT + 1) * TSLOG_PAGES_PER_SECTOR;
+    uint32 expected;
+    uint32 i;
+
+    for(i = 0; i < FLASH4_TSLOG_SECTOR_COUNT; i++)
     {
-        uint16 bytesToWrite = (firmwareSize - bytesWritten > 256) ? 256 : (firmwareSize - bytesWritten);
-        
-        Flash4_WriteCommand(FLASH4_CMD_WRITE_ENABLE_WREN);
-        Flash4_PageProgram4((uint8*)&firmwareData[bytesWritten], currentAddress, bytesToWrite);
-        if(Flash4_WaitReady(1000) != FLASH4_OK)
+        if(Flash4_EraseSector(FLASH4_TSLOG_START_ADDRESS + i * FLASH4_SECTOR_SIZE) != FLASH4_OK)
             return FALSE;
-        
-        bytesWritten += bytesToWrite;
-        currentAddress += bytesToWrite;
     }
-    
-    /* Verify by reading back and calculating CRC */
-    uint8 verifyBuffer[256];
-    uint32 bytesVerified = 0;
-    uint16 verifyCRC = 0xFFFF;
-    
-    while(bytesVerified < firmwareSize)
+
+    /* Fill every sector and then sector 0 once more, the head ends at the last page of sector 0 */
+    if(Flash4_TsWriter_Init(&writer, &logConfig) != FLASH4_OK)
+        return FALSE;
+
+    sample.value = 100;
+    sample.status = 0;
+    for(i = 0; i < pages; i++)
     {
-        uint16 bytesToRead = (firmwareSize - bytesVerified > 256) ? 256 : (firmwareSize - bytesVerified);
-        
-        Flash4_ReadFlash4(verifyBuffer, FIRMWARE_START_ADDRESS + bytesVerified, bytesToRead);
-        
-        /* Update CRC */
-        uint16 chunkCRC = calculateCRC16(verifyBuffer, bytesToRead);
-        /* Combine CRC chunks (simplified) */
-        
-        bytesVerified += bytesToRead;
+        sample.timestamp = i * 10;
+        if(Flash4_TsWriter_Append(&writer, &sample) != FLASH4_OK || Flash4_TsWriter_Flush(&writer) != FLASH4_OK)
+            return FALSE;
     }
-    
-    /* In real application, would compare CRC values */
+
+    /* The next flush would erase sector 1 first; the reset hits right after that erase */
+    if(Flash4_EraseSector(FLASH4_TSLOG_START_ADDRESS + FLASH4_SECTOR_SIZE) != FLASH4_OK)
+        return FALSE;
+
+    /* After the reset: sectors 2 .. n-1 and then sector 0 must still read back, oldest first */
+    if(Flash4_TsReader_Init(&reader, &logConfig) != FLASH4_OK)
+        return FALSE;
+
+    expected = 2 * TSLOG_PAGES_PER_SECTOR;
+    while(Flash4_TsReader_Next(&reader, &sample))
+    {
+        if(sample.timestamp != expected * 10)
+            return FALSE;
+        expected++;
+    }
+    if(expected != pages)
+        return FALSE;
+
+    /* Logging continues in the erased sector and the new sample is the newest of the log */
+    if(Flash4_TsWriter_Init(&writer, &logConfig) != FLASH4_OK)
+        return FALSE;
+    if(writer.writeAddress != FLASH4_TSLOG_START_ADDRESS + FLASH4_SECTOR_SIZE)
+        return FALSE;
+
+    sample.timestamp = pages * 10;
+    if(Flash4_TsWriter_Append(&writer, &sample) != FLASH4_OK || Flash4_TsWriter_Flush(&writer) != FLASH4_OK)
+        return FALSE;
+
+    return (Flash4_TsLog_GetNewestTimestamp(&logConfig, &sample.timestamp) == FLASH4_OK &&
+            sample.timestamp == pages * 10) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 29: Log Range Query---------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+#define TSQUERY_SAMPLES         4000u
+#define TSQUERY_STEP_SAMPLES    400u        /* Samples per value step */
+
+/* Count the samples a query returns */
+static uint32 countQuery(Flash4_TsReader_t *reader, const Flash4_TsConfig_t *logConfig, const Flash4_TsQuery_t *query)
+{
+    Flash4_TsSample_t sample;
+    uint32 count = 0;
+
+    if(Flash4_TsReader_InitQuery(reader, logConfig, query) != FLASH4_OK)
+        return 0;
+
+    while(Flash4_TsReader_Next(reader, &sample))
+    {
+        if(sample.timestamp < query->fromTimestamp || sample.timestamp > query->toTimestamp)
+            return 0;
+        count++;
+    }
+
+    return count;
+}
+
+/**
+ * \brief Example 29: Time-Series Range Query
+ *
+ * This example demonstrates:
+ * - Selecting a time window with Flash4_TsReader_InitQuery(), located by binary search over the block headers
+ * - Narrowing the window to a value range with the query filter
+ * - Checking pagesLoaded: blocks outside the window or the value range are skipped on their header alone, a value
+ *   range no block covers loads no payload at all
+ *
+ * The log region of Example 8 is erased first and filled with a step signal, 10 ms per sample.
+ *
+ * \return TRUE if every query returns the expected samples and loads fewer pages than a full read, FALSE otherwise
+ */
+boolean Example29_LogRangeQuery(void)
+{
+    const Flash4_TsConfig_t logConfig = {FLASH4_TSLOG_START_ADDRESS, FLASH4_TSLOG_SECTOR_COUNT};
+    static Flash4_TsWriter_t writer;
+    static Flash4_TsReader_t reader;
+    Flash4_TsSample_t sample;
+    Flash4_TsQuery_t query;
+    uint32 pagesTotal;
+    uint32 pagesWindow;
+    uint32 i;
+
+    for(i = 0; i < FLASH4_TSLOG_SECTOR_COUNT; i++)
+    {
+        if(Flash4_EraseSector(FLASH4_TSLOG_START_ADDRESS + i * FLASH4_SECTOR_SIZE) != FLASH4_OK)
+            return FALSE;
+    }
+
+    /* Value 1000 for the first 400 samples, then 50 higher every 400 samples */
+    if(Flash4_TsWriter_Init(&writer, &logConfig) != FLASH4_OK)
+        return FALSE;
+
+    sample.status = 0;
+    for(i = 0; i < TSQUERY_SAMPLES; i++)
+    {
+        sample.timestamp = i * 10;
+        sample.value = (uint16)(1000 + (i / TSQUERY_STEP_SAMPLES) * 50);
+        if(Flash4_TsWriter_Append(&writer, &sample) != FLASH4_OK)
+            return FALSE;
+    }
+    if(Flash4_TsWriter_Flush(&writer) != FLASH4_OK)
+        return FALSE;
+
+    /* Full read as reference, every page is loaded */
+    query.fromTimestamp = 0;
+    query.toTimestamp = 0xFFFFFFFF;
+    query.filterValue = FALSE;
+    query.minValue = 0;
+    query.maxValue = 0xFFFF;
+    if(countQuery(&reader, &logConfig, &query) != TSQUERY_SAMPLES)
+        return FALSE;
+    pagesTotal = reader.pagesLoaded;
+
+    /* Samples 1000 .. 1999: only the pages overlapping the window are loaded */
+    query.fromTimestamp = 10000;
+    query.toTimestamp = 19990;
+    if(countQuery(&reader, &logConfig, &query) != 1000u)
+        return FALSE;
+    pagesWindow = reader.pagesLoaded;
+    if(pagesWindow == 0u || pagesWindow >= pagesTotal)
+        return FALSE;
+
+    /* Same window, value 1150 only: samples 1200 .. 1599 */
+    query.filterValue = TRUE;
+    query.minValue = 1150;
+    query.maxValue = 1150;
+    if(countQuery(&reader, &logConfig, &query) != TSQUERY_STEP_SAMPLES || reader.pagesLoaded >= pagesWindow)
+        return FALSE;
+
+    /* No block holds a value below 1000, the headers alone rule out every page */
+    query.minValue = 0;
+    query.maxValue = 999;
+    if(countQuery(&reader, &logConfig, &query) != 0u || reader.pagesLoaded != 0u)
+        return FALSE;
+
     return TRUE;
 }
 
+/*********************************************************************************************************************/
+/*----------------------------------Example 30: Paged Window------------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+#define WINDOW_FRAMES           4
+
+static uint32 g_windowFrames[WINDOW_FRAMES * FLASH4_WINDOW_FRAME_SIZE / 4];    /* 4 byte aligned */
+
+/* Compare a mapped range with a direct read of the flash */
+static boolean windowMatches(const uint8 *data, uint32 address)
+{
+    uint8 direct[16];
+
+    Flash4_ReadFlash4(direct, address, sizeof(direct));
+
+    return (data != NULL_PTR && memcmp(data, direct, sizeof(direct)) == 0) ? TRUE : FALSE;
+}
+
+/**
+ * \brief Example 30: Paged Window over the Firmware Image
+ *
+ * This example demonstrates:
+ * - Pinning the first page of the image stored by Example 7, its pointer stays valid while other pages are mapped
+ * - Eviction of the least recently used unpinned frame once all frames are taken
+ * - Prefetch hints loaded from the idle loop, so the following maps are hits
+ * - Unpinning, after which the page can be evicted like any other
+ *
+ * \param firmwareSize Size of the image stored by Example 7, at least 11 frames
+ * \return TRUE if hits, misses and mapped data are as expected, FALSE otherwise
+ */
+boolean Example30_PagedWindow(uint32 firmwareSize)
+{
+    static Flash4_Window_t window;
+    const uint8 *header;
+    const uint8 *data;
+    uint32 misses;
+    uint32 page;
+
+    if(firmwareSize < 11 * FLASH4_WINDOW_FRAME_SIZE)
+        return FALSE;
+
+    if(Flash4_Window_Init(&window, FIRMWARE_START_ADDRESS, firmwareSize, (uint8 *)g_windowFrames,
+                          WINDOW_FRAMES) != FLASH4_OK)
+        return FALSE;
+
+    /* Page 0 stays resident until unpinned */
+    header = Flash4_Window_Pin(&window, 0, 16);
+    if(!windowMatches(header, FIRMWARE_START_ADDRESS))
+        return FALSE;
+
+    /* Pages 1 .. 4 share the three other frames, mapping page 4 evicts page 1 */
+    for(page = 1; page <= 4; page++)
+    {
+        data = Flash4_Map(&window, page * FLASH4_WINDOW_FRAME_SIZE, 16);
+        if(!windowMatches(data, FIRMWARE_START_ADDRESS + page * FLASH4_WINDOW_FRAME_SIZE))
+            return FALSE;
+    }
+    if(window.misses != 5 || Flash4_Map(&window, 0, 16) != header || window.hits != 1)
+        return FALSE;
+
+    misses = window.misses;
+    data = Flash4_Map(&window, FLASH4_WINDOW_FRAME_SIZE, 16);
+    if(!windowMatches(data, FIRMWARE_START_ADDRESS + FLASH4_WINDOW_FRAME_SIZE) || window.misses != misses + 1)
+        return FALSE;
+
+    /* Hint pages 5 and 6, the idle loop loads them and the maps that follow are hits */
+    Flash4_Window_Prefetch(&window, 5 * FLASH4_WINDOW_FRAME_SIZE, 2 * FLASH4_WINDOW_FRAME_SIZE);
+    if(Flash4_Window_ProcessPrefetch(&window, 8) != 2)
+        return FALSE;
+
+    misses = window.misses;
+    for(page = 5; page <= 6; page++)
+    {
+        data = Flash4_Map(&window, page * FLASH4_WINDOW_FRAME_SIZE, 16);
+        if(!windowMatches(data, FIRMWARE_START_ADDRESS + page * FLASH4_WINDOW_FRAME_SIZE))
+            return FALSE;
+    }
+    if(window.misses != misses)
+        return FALSE;
+
+    /* Once unpinned, page 0 is the oldest frame and is replaced by pages 7 .. 10 */
+    Flash4_Window_Unpin(&window, 0);
+    for(page = 7; page <= 10; page++)
+    {
+        if(Flash4_Map(&window, page * FLASH4_WINDOW_FRAME_SIZE, 16) == NULL_PTR)
+            return FALSE;
+    }
+
+    misses = window.misses;
+    data = Flash4_Map(&window, 0, 16);
+
+    return (windowMatches(data, FIRMWARE_START_ADDRESS) && window.misses == misses + 1) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------Example 31: Asset Archive-----------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+#define ASSET_BUFFER_SIZE       4096
+
+/**
+ * \brief Example 31: Asset Lookup in the Read-Only Archive
+ *
+ * This example demonstrates:
+ * - Opening the archive written to FLASH4_ARCHIVE_START_ADDRESS by Tools/flash4_mkarchive, with header and index
+ *   CRCs checked and the seed table cached in FLASH4_ARCHIVE_SEED_CAPACITY words of RAM
+ * - Loading a complete asset, e.g. a trust anchor, with its CRC checked
+ * - Reading only the start of an asset through its index entry
+ * - Rejecting a name that is not in the archive by its fingerprint
+ *
+ * \param name Name of an asset stored in the archive, at most ASSET_BUFFER_SIZE bytes long
+ * \return TRUE if the asset is found and both reads agree, FALSE otherwise
+ */
+boolean Example31_AssetArchive(const char *name)
+{
+    static uint32 seeds[FLASH4_ARCHIVE_SEED_CAPACITY];
+    static uint8 asset[ASSET_BUFFER_SIZE];
+    static Flash4_Archive_t archive;
+    Flash4_ArchiveEntry_t entry;
+    uint8 head[16];
+    uint32 length;
+
+    if(Flash4_Archive_Open(&archive, FLASH4_ARCHIVE_START_ADDRESS, seeds, FLASH4_ARCHIVE_SEED_CAPACITY) != FLASH4_OK)
+        return FALSE;
+
+    /* One entry read and one data read, independent of the number of assets */
+    if(Flash4_Archive_Load(&archive, name, asset, sizeof(asset), &length) != FLASH4_OK)
+        return FALSE;
+
+    /* Partial read of the same asset */
+    if(Flash4_Archive_Find(&archive, name, &entry) != FLASH4_OK || entry.length != length)
+        return FALSE;
+
+    if(length > sizeof(head))
+        length = sizeof(head);
+    if(Flash4_Archive_Read(&archive, &entry, 0, head, length) != FLASH4_OK || memcmp(head, asset, length) != 0)
+        return FALSE;
+
+    /* The perfect hash maps any name to a slot, the fingerprint rejects the ones not stored */
+    return (Flash4_Archive_Find(&archive, "no/such/asset", &entry) != FLASH4_OK) ? TRUE : FALSE;
+}
+
 /*********************************************************************************************************************/
 /*----------------------------------Example Usage-----------------------------------------------------------------------*/
 /*********************************************************************************************************************/
@@ -595,5 +2197,12 @@ void RunAllExamples(void)
     {
         /* Handle error */
     }
+    
+    /* Example 8: Compressed Data Logging */
+    result = Example8_CompressedLogging();
+    if(!result)
+    {
+        /* Handle error */
+    }
 }
 
@@ -0,0 +1,104 @@
+/**********************************************************************************************************************
+ * \file Flash4_Hash.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Hashing of Flash4 ranges with double-buffered reads
+ *********************************************************************************************************************/
+
+#include "Flash4_Hash.h"
+#include "Flash4_Driver.h"
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef void (*Flash4_Hash_Update_t)(void *ctx, const uint8 *data, uint32 length);
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static uint8 g_hashBuffer[2][FLASH4_READ_HEADER_SIZE + FLASH4_MAX_PAGE_SIZE];
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static void updateSha256(void *ctx, const uint8 *data, uint32 length)
+{
+    Sha256_Update((Sha256_t *)ctx, data, length);
+}
+
+static void updateSha512(void *ctx, const uint8 *data, uint32 length)
+{
+    Sha512_Update((Sha512_t *)ctx, data, length);
+}
+
+static uint16 chunkSize(uint32 length)
+{
+    return (length > FLASH4_MAX_PAGE_SIZE) ? FLASH4_MAX_PAGE_SIZE : (uint16)length;
+}
+
+/* Hash one buffer while the next one is being read */
+static void hashRange(Flash4_Hash_Update_t update, void *ctx, uint32 address, uint32 length)
+{
+    uint32 current = 0;
+    uint16 chunk;
+
+    if (length == 0u)
+        return;
+
+    chunk = chunkSize(length);
+    Flash4_StartRead(g_hashBuffer[current], address, chunk);
+
+    while (length > 0u)
+    {
+        uint16 next;
+
+        while (Flash4_IsReadBusy())
+        {
+        }
+
+        address += chunk;
+        length  -= chunk;
+        next     = chunkSize(length);
+
+        if (next > 0u)
+            Flash4_StartRead(g_hashBuffer[current ^ 1u], address, next);
+
+        update(ctx, &g_hashBuffer[current][FLASH4_READ_HEADER_SIZE], chunk);
+
+        current ^= 1u;
+        chunk    = next;
+    }
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+void Flash4_Hash_UpdateSha256(Sha256_t *ctx, uint32 address, uint32 length)
+{
+    hashRange(updateSha256, ctx, address, length);
+}
+
+void Flash4_Hash_UpdateSha512(Sha512_t *ctx, uint32 address, uint32 length)
+{
+    hashRange(updateSha512, ctx, address, length);
+}
+
+void Flash4_Hash_Sha256(uint32 address, uint32 length, uint8 *digest)
+{
+    Sha256_t ctx;
+
+    Sha256_Init(&ctx);
+    hashRange(updateSha256, &ctx, address, length);
+    Sha256_Final(&ctx, digest);
+}
+
+void Flash4_Hash_Sha512(uint32 address, uint32 length, uint8 *digest)
+{
+    Sha512_t ctx;
+
+    Sha512_Init(&ctx);
+    hashRange(updateSha512, &ctx, address, length);
+    Sha512_Final(&ctx, digest);
+}
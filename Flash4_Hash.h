@@ -0,0 +1,58 @@
+/**********************************************************************************************************************
+ * \file Flash4_Hash.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * SHA-256 and SHA-512 over a Flash4 address range, for verifying images after they are written.
+ * The range is read in page sized transfers into two buffers: while the QSPI interrupts fill one buffer the CPU
+ * hashes the other, so hashing a range takes about as long as reading it instead of reading plus hashing.
+ *
+ * The read buffers are static, only one hash may run at a time and nothing else may access Flash4 meanwhile.
+ *********************************************************************************************************************/
+
+#ifndef FLASH4_HASH_H_
+#define FLASH4_HASH_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Sha256.h"
+#include "Sha512.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Add a Flash4 range to a running SHA-256
+ * \param ctx Hash state from Sha256_Init(), may already hold other data
+ * \param address Start address in Flash4
+ * \param length Number of bytes
+ */
+void Flash4_Hash_UpdateSha256(Sha256_t *ctx, uint32 address, uint32 length);
+
+/**
+ * \brief Add a Flash4 range to a running SHA-512
+ * \param ctx Hash state from Sha512_Init(), may already hold other data
+ * \param address Start address in Flash4
+ * \param length Number of bytes
+ */
+void Flash4_Hash_UpdateSha512(Sha512_t *ctx, uint32 address, uint32 length);
+
+/**
+ * \brief SHA-256 of a Flash4 range
+ * \param address Start address in Flash4
+ * \param length Number of bytes
+ * \param digest Output, SHA256_DIGEST_SIZE bytes
+ */
+void Flash4_Hash_Sha256(uint32 address, uint32 length, uint8 *digest);
+
+/**
+ * \brief SHA-512 of a Flash4 range
+ * \param address Start address in Flash4
+ * \param length Number of bytes
+ * \param digest Output, SHA512_DIGEST_SIZE bytes
+ */
+void Flash4_Hash_Sha512(uint32 address, uint32 length, uint8 *digest);
+
+#endif /* FLASH4_HASH_H_ */
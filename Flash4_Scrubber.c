@@ -0,0 +1,357 @@
+/**********************************************************************************************************************
+ * \file Flash4_Scrubber.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Background scrubber for data stored in Flash4
+ *********************************************************************************************************************/
+
+#include "Flash4_Scrubber.h"
+#include "Crc16.h"
+#include "IfxStm.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define SCRUB_SUSPEND_TIMEOUT_MS    1u      /* Erase suspend latency is in the order of 40 us */
+#define SCRUB_ECC_CORRECTED         (FLASH4_ECCSR_DATA_CORRECTED | FLASH4_ECCSR_ECC_CORRECTED)
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static uint32 scrubNow(void)
+{
+    return (uint32)IfxStm_get(&MODULE_STM0);
+}
+
+static void notify(Flash4_Scrubber_t *scrubber, Flash4_ScrubEvent event, uint32 address)
+{
+    if (scrubber->callback != NULL_PTR)
+        scrubber->callback(event, scrubber->region, address);
+}
+
+static boolean isValidRegion(const Flash4_ScrubRegion_t *region)
+{
+    return (region->length > 0u) && (region->chunkSize > 0u) &&
+           (region->chunkSize % FLASH4_MAX_PAGE_SIZE == 0u) &&
+           (region->address % FLASH4_MAX_PAGE_SIZE == 0u) &&
+           (region->crcTableAddress % FLASH4_MAX_PAGE_SIZE == 0u) &&
+           (region->relocationAddress == FLASH4_SCRUB_NO_RELOCATION ||
+            region->relocationAddress % FLASH4_SECTOR_SIZE == 0u);
+}
+
+static void nextRegion(Flash4_Scrubber_t *scrubber, uint32 now)
+{
+    scrubber->offset         = 0;
+    scrubber->regionFailed   = FALSE;
+    scrubber->regionDegraded = FALSE;
+    scrubber->state          = Flash4_ScrubState_verify;
+    scrubber->region++;
+
+    if (scrubber->region >= scrubber->regionCount)
+    {
+        scrubber->passes++;
+        notify(scrubber, Flash4_ScrubEvent_passCompleted, 0u);
+        scrubber->region     = 0;
+        scrubber->state      = Flash4_ScrubState_pause;
+        scrubber->pauseStart = now;
+    }
+}
+
+/* TRUE if the device had to correct a bit in one of the ECC units of a range */
+static boolean isEccCorrected(uint32 address, uint32 length)
+{
+    uint32 unit;
+
+    for (unit = address - address % FLASH4_ECC_UNIT_SIZE; unit < address + length; unit += FLASH4_ECC_UNIT_SIZE)
+    {
+        if ((Flash4_ReadEccStatus(unit) & SCRUB_ECC_CORRECTED) != 0u)
+            return TRUE;
+    }
+
+    return FALSE;
+}
+
+static uint16 readExpectedCrc(const Flash4_ScrubRegion_t *region, uint32 chunk)
+{
+    uint16 expected;
+
+    Flash4_ReadFlash4((uint8 *)&expected, region->crcTableAddress + chunk * 2u, 2u);
+
+    return expected;
+}
+
+static void verifyStep(Flash4_Scrubber_t *scrubber, uint32 now)
+{
+    Flash4_ScrubRegion_t *region      = &scrubber->regions[scrubber->region];
+    uint32                address     = region->address + scrubber->offset;
+    uint32                chunkOffset = scrubber->offset % region->chunkSize;
+    uint32                n           = scrubber->budget.bytesPerSlice;
+
+    if (n > region->chunkSize - chunkOffset)
+        n = region->chunkSize - chunkOffset;
+    if (n > region->length - scrubber->offset)
+        n = region->length - scrubber->offset;
+
+    Flash4_ReadFlash4(scrubber->buffer, address, (uint16)n);
+
+    if (chunkOffset == 0u)
+    {
+        scrubber->crc           = CRC16_INIT_VALUE;
+        scrubber->chunkDegraded = FALSE;
+    }
+    scrubber->crc = Crc16_Update(scrubber->crc, scrubber->buffer, n);
+
+    /* The read was corrected, the data is still good but the cells are wearing out */
+    if (!scrubber->chunkDegraded && isEccCorrected(address, n))
+        scrubber->chunkDegraded = TRUE;
+
+    scrubber->offset        += n;
+    scrubber->bytesScrubbed += n;
+
+    /* Chunk complete: compare with the stored CRC */
+    if (scrubber->offset % region->chunkSize == 0u || scrubber->offset == region->length)
+    {
+        uint32 chunk        = (scrubber->offset - 1u) / region->chunkSize;
+        uint32 chunkAddress = region->address + chunk * region->chunkSize;
+
+        if (readExpectedCrc(region, chunk) != scrubber->crc)
+        {
+            scrubber->chunksFailed++;
+            scrubber->regionFailed = TRUE;
+            notify(scrubber, Flash4_ScrubEvent_chunkFailed, chunkAddress);
+        }
+        else if (scrubber->chunkDegraded)
+        {
+            scrubber->chunksDegraded++;
+            scrubber->regionDegraded = TRUE;
+            notify(scrubber, Flash4_ScrubEvent_chunkDegraded, chunkAddress);
+        }
+    }
+
+    if (scrubber->offset >= region->length)
+    {
+        /* Copying a failed chunk would only move the corruption, such a region waits until it was restored */
+        if (scrubber->regionDegraded && !scrubber->regionFailed &&
+            region->relocationAddress != FLASH4_SCRUB_NO_RELOCATION)
+        {
+            scrubber->state  = Flash4_ScrubState_relocate;
+            scrubber->offset = 0;
+        }
+        else
+        {
+            nextRegion(scrubber, now);
+        }
+    }
+}
+
+/* Give up a relocation, the region keeps its address and is relocated again when the next pass finds it degraded */
+static void failRelocation(Flash4_Scrubber_t *scrubber, uint32 address, uint32 now)
+{
+    scrubber->relocationsFailed++;
+    notify(scrubber, Flash4_ScrubEvent_relocationFailed, address);
+    nextRegion(scrubber, now);
+}
+
+/*
+ * Copy the region page by page to its spare sectors, erasing them without blocking the foreground. Every page is
+ * read back from the spare and the chunks are checked against the CRC table before the region is switched over.
+ */
+static void relocateStep(Flash4_Scrubber_t *scrubber, uint32 now)
+{
+    Flash4_ScrubRegion_t *region = &scrubber->regions[scrubber->region];
+    uint32                target = region->relocationAddress + scrubber->offset;
+    uint32                n;
+
+    if (scrubber->eraseSuspended)
+    {
+        Flash4_WriteCommand(FLASH4_CMD_ERASE_RESUME);
+        scrubber->eraseSuspended = FALSE;
+        return;
+    }
+
+    if (scrubber->eraseBusy)
+    {
+        /* A failed erase keeps WIP set, the error has to be checked first */
+        if (Flash4_CheckError() != 0u)
+        {
+            scrubber->eraseBusy = FALSE;
+            failRelocation(scrubber, target, now);
+            return;
+        }
+        if (Flash4_CheckWIP())
+            return;
+        scrubber->eraseBusy = FALSE;
+    }
+    else if (scrubber->offset < region->length && target % FLASH4_SECTOR_SIZE == 0u)
+    {
+        Flash4_WriteCommand(FLASH4_CMD_WRITE_ENABLE_WREN);
+        Flash4_SectorErase4(target);
+        scrubber->eraseBusy = TRUE;
+        return;
+    }
+
+    if (scrubber->offset < region->length)
+    {
+        n = region->length - scrubber->offset;
+        if (n > FLASH4_MAX_PAGE_SIZE)
+            n = FLASH4_MAX_PAGE_SIZE;
+
+        /* The source reads back ECC corrected, the copy starts out without the weak bits */
+        Flash4_ReadFlash4(scrubber->buffer, region->address + scrubber->offset, (uint16)n);
+        if (Flash4_ProgramPage(scrubber->buffer, target, (uint16)n) != FLASH4_OK)
+        {
+            failRelocation(scrubber, target, now);
+            return;
+        }
+
+        Flash4_ReadFlash4(scrubber->buffer, target, (uint16)n);
+        if (scrubber->offset % region->chunkSize == 0u)
+            scrubber->crc = CRC16_INIT_VALUE;
+        scrubber->crc     = Crc16_Update(scrubber->crc, scrubber->buffer, n);
+        scrubber->offset += n;
+
+        if (scrubber->offset % region->chunkSize == 0u || scrubber->offset == region->length)
+        {
+            uint32 chunk = (scrubber->offset - 1u) / region->chunkSize;
+
+            if (readExpectedCrc(region, chunk) != scrubber->crc)
+                failRelocation(scrubber, region->relocationAddress + chunk * region->chunkSize, now);
+        }
+        return;
+    }
+
+    /* The callback persists the new address, only then the region is switched over in RAM */
+    notify(scrubber, Flash4_ScrubEvent_regionRelocated, region->relocationAddress);
+    region->address           = region->relocationAddress;
+    region->relocationAddress = FLASH4_SCRUB_NO_RELOCATION;
+    nextRegion(scrubber, now);
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+uint8 Flash4_Scrubber_Init(Flash4_Scrubber_t *scrubber, Flash4_ScrubRegion_t *regions, uint8 regionCount,
+                           const Flash4_ScrubBudget_t *budget, Flash4_ScrubCallback callback)
+{
+    uint8 i;
+
+    if (budget->bytesPerSlice == 0u || budget->bytesPerSlice > FLASH4_MAX_PAGE_SIZE)
+        return FLASH4_ERROR;
+
+    for (i = 0; i < regionCount; i++)
+    {
+        if (!isValidRegion(&regions[i]))
+            return FLASH4_ERROR;
+    }
+
+    scrubber->regions           = regions;
+    scrubber->regionCount       = regionCount;
+    scrubber->budget            = *budget;
+    scrubber->callback          = callback;
+    scrubber->state             = Flash4_ScrubState_verify;
+    scrubber->region            = 0;
+    scrubber->regionFailed      = FALSE;
+    scrubber->regionDegraded    = FALSE;
+    scrubber->chunkDegraded     = FALSE;
+    scrubber->offset            = 0;
+    scrubber->crc               = CRC16_INIT_VALUE;
+    scrubber->lastSlice         = scrubNow();
+    scrubber->lastForeground    = scrubber->lastSlice;
+    scrubber->pauseStart        = scrubber->lastSlice;
+    scrubber->eraseBusy         = FALSE;
+    scrubber->eraseSuspended    = FALSE;
+    scrubber->bytesScrubbed     = 0;
+    scrubber->chunksFailed      = 0;
+    scrubber->chunksDegraded    = 0;
+    scrubber->relocationsFailed = 0;
+    scrubber->passes            = 0;
+
+    return FLASH4_OK;
+}
+
+void Flash4_Scrubber_Step(Flash4_Scrubber_t *scrubber)
+{
+    uint32 now = scrubNow();
+
+    if (scrubber->regionCount == 0u || (now - scrubber->lastForeground) < scrubber->budget.quietTicks)
+        return;
+
+    if (scrubber->state == Flash4_ScrubState_pause)
+    {
+        if ((now - scrubber->pauseStart) < scrubber->budget.passTicks)
+            return;
+        scrubber->state = Flash4_ScrubState_verify;
+    }
+
+    if ((now - scrubber->lastSlice) < scrubber->budget.sliceTicks)
+        return;
+    scrubber->lastSlice = now;
+
+    if (scrubber->state == Flash4_ScrubState_relocate)
+        relocateStep(scrubber, now);
+    else
+        verifyStep(scrubber, now);
+}
+
+void Flash4_Scrubber_NotifyForeground(Flash4_Scrubber_t *scrubber)
+{
+    scrubber->lastForeground = scrubNow();
+
+    /* Reads are not possible while the device erases, suspend until the foreground is quiet again */
+    if (scrubber->eraseBusy && !scrubber->eraseSuspended)
+    {
+        Flash4_WriteCommand(FLASH4_CMD_ERASE_SUSPEND);
+        (void)Flash4_WaitReady(SCRUB_SUSPEND_TIMEOUT_MS);
+        scrubber->eraseSuspended = TRUE;
+    }
+}
+
+uint8 Flash4_Scrubber_WriteCrcTable(const Flash4_ScrubRegion_t *region)
+{
+    uint8  data[FLASH4_MAX_PAGE_SIZE];
+    uint16 table[FLASH4_MAX_PAGE_SIZE / 2u];
+    uint32 tableAddress = region->crcTableAddress;
+    uint32 offset       = 0;
+    uint16 entries      = 0;
+    uint8  result;
+
+    if (!isValidRegion(region))
+        return FLASH4_ERROR;
+
+    while (offset < region->length)
+    {
+        uint32 chunkEnd = offset + region->chunkSize;
+        uint16 crc      = CRC16_INIT_VALUE;
+
+        if (chunkEnd > region->length)
+            chunkEnd = region->length;
+
+        while (offset < chunkEnd)
+        {
+            uint32 n = chunkEnd - offset;
+
+            if (n > FLASH4_MAX_PAGE_SIZE)
+                n = FLASH4_MAX_PAGE_SIZE;
+
+            Flash4_ReadFlash4(data, region->address + offset, (uint16)n);
+            crc     = Crc16_Update(crc, data, n);
+            offset += n;
+        }
+
+        table[entries++] = crc;
+
+        if (entries == FLASH4_MAX_PAGE_SIZE / 2u || offset >= region->length)
+        {
+            result = Flash4_ProgramPage((const uint8 *)table, tableAddress, (uint16)(entries * 2u));
+            if (result != FLASH4_OK)
+                return result;
+
+            tableAddress += FLASH4_MAX_PAGE_SIZE;
+            entries       = 0;
+        }
+    }
+
+    return FLASH4_OK;
+}
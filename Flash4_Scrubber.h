@@ -0,0 +1,142 @@
+/**********************************************************************************************************************
+ * \file Flash4_Scrubber.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Background scrubber for data stored in Flash4
+ * Registered regions are re-read in small slices and every chunk is checked against a CRC-16 table stored in Flash4.
+ * Besides the CRC, the ECC status of every 16 byte ECC unit is read: a chunk whose data needed a single bit
+ * correction still reads back intact but is degrading. Such regions are relocated to spare sectors while their data
+ * is correct, every copied chunk is read back from the spare and checked against the CRC table before the region is
+ * switched over. A chunk that fails its CRC can no longer be repaired by copying, it is only reported and the
+ * application has to restore it, e.g. by downloading it again.
+ *
+ * The new address of a relocated region is only known in RAM. The Flash4_ScrubEvent_regionRelocated callback is
+ * the point where the application must store it in non-volatile memory, the scrubber switches the region over when
+ * the callback returns. The old copy is left untouched, so a reset before the address is stored only loses the
+ * relocation, not the data.
+ *
+ * The scrubber is driven by Flash4_Scrubber_Step() from the idle loop. A step verifies or copies at most one page
+ * and only runs if the application has not accessed the flash for quietTicks and the last slice is sliceTicks ago,
+ * which bounds bandwidth and CPU load. Foreground code calls Flash4_Scrubber_NotifyForeground() before its own
+ * accesses: this postpones the scrubber and suspends a relocation erase so the flash is readable right away.
+ *********************************************************************************************************************/
+
+#ifndef FLASH4_SCRUBBER_H_
+#define FLASH4_SCRUBBER_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define FLASH4_SCRUB_NO_RELOCATION               0xFFFFFFFFUL
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Scrubbed region, address and chunk size page aligned */
+typedef struct
+{
+    uint32 address;             /* Start of the data                                              */
+    uint32 length;              /* Data length in bytes                                           */
+    uint32 chunkSize;           /* Bytes covered by one CRC, multiple of FLASH4_MAX_PAGE_SIZE     */
+    uint32 crcTableAddress;     /* uint16 CRC per chunk, see Flash4_Scrubber_WriteCrcTable()      */
+    uint32 relocationAddress;   /* Erased spare sectors, FLASH4_SCRUB_NO_RELOCATION: report only  */
+} Flash4_ScrubRegion_t;
+
+typedef enum
+{
+    Flash4_ScrubEvent_chunkFailed = 0,  /* Chunk CRC mismatch, address = chunk address                    */
+    Flash4_ScrubEvent_regionRelocated,  /* Region copied and verified, address = new region address,
+                                           the callback must persist it                                 */
+    Flash4_ScrubEvent_passCompleted,    /* All regions verified once, address = 0                         */
+    Flash4_ScrubEvent_chunkDegraded,    /* Chunk intact but ECC corrected, address = chunk address        */
+    Flash4_ScrubEvent_relocationFailed  /* Erase, program or verify of the spare failed, address = spare
+                                           address, the region stays where it is                          */
+} Flash4_ScrubEvent;
+
+typedef void (*Flash4_ScrubCallback)(Flash4_ScrubEvent event, uint8 regionIndex, uint32 address);
+
+typedef enum
+{
+    Flash4_ScrubState_verify = 0,
+    Flash4_ScrubState_relocate,
+    Flash4_ScrubState_pause
+} Flash4_ScrubState;
+
+/* Budget, all times in STM ticks */
+typedef struct
+{
+    uint16 bytesPerSlice;       /* Bytes read per step, at most FLASH4_MAX_PAGE_SIZE          */
+    uint32 sliceTicks;          /* Minimum time between two steps                              */
+    uint32 quietTicks;          /* Time without foreground access before the scrubber runs     */
+    uint32 passTicks;           /* Pause between two complete passes                           */
+} Flash4_ScrubBudget_t;
+
+typedef struct
+{
+    Flash4_ScrubRegion_t *regions;
+    uint8                 regionCount;
+    Flash4_ScrubBudget_t  budget;
+    Flash4_ScrubCallback  callback;
+    Flash4_ScrubState     state;
+    uint8                 region;           /* Region being processed                     */
+    boolean               regionFailed;     /* Current region had a CRC failure           */
+    boolean               regionDegraded;   /* Current region had an ECC correction       */
+    boolean               chunkDegraded;    /* Current chunk had an ECC correction        */
+    uint32                offset;           /* Offset inside the region                   */
+    uint16                crc;              /* Running CRC of the current chunk           */
+    uint32                lastSlice;
+    uint32                lastForeground;
+    uint32                pauseStart;
+    boolean               eraseBusy;        /* Relocation erase running                   */
+    boolean               eraseSuspended;
+    uint32                bytesScrubbed;    /* Statistics                                 */
+    uint32                chunksFailed;
+    uint32                chunksDegraded;
+    uint32                relocationsFailed;
+    uint32                passes;
+    uint8                 buffer[FLASH4_MAX_PAGE_SIZE];
+} Flash4_Scrubber_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Initialize a scrubber
+ * \param scrubber Scrubber state
+ * \param regions Regions to scrub, updated in place when a region is relocated (after the callback has persisted it)
+ * \param regionCount Number of regions
+ * \param budget Bandwidth and timing budget
+ * \param callback Event callback, may be NULL_PTR
+ * \return FLASH4_OK, FLASH4_ERROR on invalid regions or budget
+ */
+uint8 Flash4_Scrubber_Init(Flash4_Scrubber_t *scrubber, Flash4_ScrubRegion_t *regions, uint8 regionCount,
+                           const Flash4_ScrubBudget_t *budget, Flash4_ScrubCallback callback);
+
+/**
+ * \brief Run one scrub slice if the budget allows it, call periodically from the idle loop
+ * \param scrubber Scrubber state
+ */
+void Flash4_Scrubber_Step(Flash4_Scrubber_t *scrubber);
+
+/**
+ * \brief Announce a foreground flash access, postpones the scrubber and suspends a running erase
+ * \param scrubber Scrubber state
+ */
+void Flash4_Scrubber_NotifyForeground(Flash4_Scrubber_t *scrubber);
+
+/**
+ * \brief Compute and program the CRC table of a region, e.g. right after storing an image
+ * The table area must be erased, it needs 2 bytes per chunk.
+ * \param region Region description
+ * \return FLASH4_OK or the error of the page program
+ */
+uint8 Flash4_Scrubber_WriteCrcTable(const Flash4_ScrubRegion_t *region);
+
+#endif /* FLASH4_SCRUBBER_H_ */
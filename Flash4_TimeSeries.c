@@ -0,0 +1,558 @@
+/**********************************************************************************************************************
+ * \file Flash4_TimeSeries.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Compressed time-series log for Flash4
+ *********************************************************************************************************************/
+
+#include <string.h>
+#include "Flash4_TimeSeries.h"
+#include "Crc16.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TS_PAGES_PER_SECTOR     (FLASH4_SECTOR_SIZE / FLASH4_TS_BLOCK_SIZE)
+#define TS_LONG_FORM            0x80u
+#define TS_LONG_STATUS          0x01u
+#define TS_SHORT_DOD_LIMIT      4u
+#define TS_SHORT_VALUE_LIMIT    32u
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static uint32 zigZagEncode(uint32 value)
+{
+    return (value << 1) ^ (uint32)((sint32)value >> 31);
+}
+
+static uint32 zigZagDecode(uint32 value)
+{
+    return (value >> 1) ^ (uint32)(0u - (value & 1u));
+}
+
+static uint8 putVarint(uint8 *out, uint32 value)
+{
+    uint8 n = 0;
+
+    while (value >= 0x80u)
+    {
+        out[n++] = (uint8)(value | 0x80u);
+        value >>= 7;
+    }
+    out[n++] = (uint8)value;
+
+    return n;
+}
+
+static boolean getVarint(Flash4_TsBlockDecoder_t *decoder, uint32 *value)
+{
+    uint32 result = 0;
+    uint8  shift  = 0;
+
+    while (decoder->position < decoder->end && shift < 35u)
+    {
+        uint8 byte = decoder->block[decoder->position++];
+        result |= (uint32)(byte & 0x7Fu) << shift;
+        if ((byte & 0x80u) == 0u)
+        {
+            *value = result;
+            return TRUE;
+        }
+        shift += 7u;
+    }
+
+    return FALSE;
+}
+
+static boolean isValidRegion(const Flash4_TsConfig_t *config)
+{
+    return (config->startAddress % FLASH4_SECTOR_SIZE == 0u) && (config->sectorCount >= 2u);
+}
+
+static uint32 nextPage(const Flash4_TsConfig_t *config, uint32 address)
+{
+    address += FLASH4_TS_BLOCK_SIZE;
+    if (address >= config->startAddress + config->sectorCount * FLASH4_SECTOR_SIZE)
+    {
+        address = config->startAddress;
+    }
+    return address;
+}
+
+static void readHeader(uint32 address, Flash4_TsBlockHeader_t *header)
+{
+    Flash4_ReadFlash4((uint8 *)header, address, sizeof(Flash4_TsBlockHeader_t));
+}
+
+/* Find the sector holding the newest block, returns FALSE if the log is empty */
+static boolean findHeadSector(const Flash4_TsConfig_t *config, uint32 *headSector, uint32 *headSequence)
+{
+    Flash4_TsBlockHeader_t header;
+    boolean found = FALSE;
+    uint32  s;
+
+    for (s = 0; s < config->sectorCount; s++)
+    {
+        readHeader(config->startAddress + s * FLASH4_SECTOR_SIZE, &header);
+        if (header.magic == FLASH4_TS_BLOCK_MAGIC)
+        {
+            if (!found || (sint32)(header.sequence - *headSequence) > 0)
+            {
+                *headSector   = s;
+                *headSequence = header.sequence;
+                found         = TRUE;
+            }
+        }
+    }
+
+    return found;
+}
+
+/* Address of the page 'index' pages after 'address' in the ring */
+static uint32 pageAddress(const Flash4_TsConfig_t *config, uint32 address, uint32 index)
+{
+    uint32 regionSize = config->sectorCount * FLASH4_SECTOR_SIZE;
+
+    return config->startAddress + ((address - config->startAddress) + index * FLASH4_TS_BLOCK_SIZE) % regionSize;
+}
+
+/* Locate the oldest programmed page and the number of programmed pages, returns FALSE if the log is empty */
+static boolean locateLog(const Flash4_TsConfig_t *config, uint32 *oldestAddress, uint32 *pageCount,
+                         uint32 *nextSequence)
+{
+    Flash4_TsBlockHeader_t header;
+    uint32 headSector   = 0;
+    uint32 headSequence = 0;
+    uint32 oldestSector;
+    uint32 s;
+
+    if (!findHeadSector(config, &headSector, &headSequence))
+    {
+        *oldestAddress = config->startAddress;
+        *pageCount     = 0;
+        *nextSequence  = 0;
+        return FALSE;
+    }
+
+    /* Pages are programmed in order, binary search the first erased one in the head sector */
+    uint32 sectorAddress = config->startAddress + headSector * FLASH4_SECTOR_SIZE;
+    uint32 low  = 1;
+    uint32 high = TS_PAGES_PER_SECTOR;
+
+    while (low < high)
+    {
+        uint32 mid = (low + high) / 2u;
+
+        readHeader(sectorAddress + mid * FLASH4_TS_BLOCK_SIZE, &header);
+        if (header.magic == FLASH4_TS_BLOCK_MAGIC)
+            low = mid + 1u;
+        else
+            high = mid;
+    }
+
+    /*
+     * The sectors following the head in ring order hold older blocks, the first programmed one is the oldest. The
+     * sector right after the head may be erased without a block yet (reset between the erase and the first program
+     * of a wrap), the sectors behind it are still valid. Before the ring has wrapped this finds sector 0.
+     */
+    oldestSector = headSector;
+    for (s = 1; s < config->sectorCount; s++)
+    {
+        uint32 sector = (headSector + s) % config->sectorCount;
+
+        readHeader(config->startAddress + sector * FLASH4_SECTOR_SIZE, &header);
+        if (header.magic == FLASH4_TS_BLOCK_MAGIC)
+        {
+            oldestSector = sector;
+            break;
+        }
+    }
+
+    *oldestAddress = config->startAddress + oldestSector * FLASH4_SECTOR_SIZE;
+    *pageCount     = ((headSector + config->sectorCount - oldestSector) % config->sectorCount) * TS_PAGES_PER_SECTOR
+                     + low;
+    *nextSequence  = headSequence + low;
+
+    return TRUE;
+}
+
+/*
+ * Read the header of the page 'index' pages after the oldest one. Pages are programmed in sequence without gaps, so
+ * a valid page carries firstSequence + index; anything else is an erased, torn or stale page.
+ */
+static boolean readLogHeader(const Flash4_TsConfig_t *config, uint32 oldestAddress, uint32 firstSequence,
+                             uint32 index, Flash4_TsBlockHeader_t *header)
+{
+    readHeader(pageAddress(config, oldestAddress, index), header);
+
+    return (header->magic == FLASH4_TS_BLOCK_MAGIC && header->sequence == firstSequence + index) ? TRUE : FALSE;
+}
+
+static void startBlock(Flash4_TsWriter_t *writer, const Flash4_TsSample_t *sample)
+{
+    Flash4_TsBlockHeader_t *header = &writer->header;
+
+    header->magic         = FLASH4_TS_BLOCK_MAGIC;
+    header->baseStatus    = sample->status;
+    header->baseTimestamp = sample->timestamp;
+    header->baseValue     = sample->value;
+    header->lastTimestamp = sample->timestamp;
+    header->minValue      = sample->value;
+    header->maxValue      = sample->value;
+
+    writer->state.timestamp = sample->timestamp;
+    writer->state.delta     = 0;
+    writer->state.value     = sample->value;
+    writer->state.status    = sample->status;
+    writer->used            = FLASH4_TS_HEADER_SIZE;
+    writer->count           = 1;
+}
+
+static uint8 encodeSample(Flash4_TsState_t *state, const Flash4_TsSample_t *sample, uint8 *out)
+{
+    uint32 delta   = sample->timestamp - state->timestamp;
+    uint32 zzDod   = zigZagEncode(delta - state->delta);
+    uint32 zzValue = zigZagEncode((uint32)(sint32)(sint16)(uint16)(sample->value - state->value));
+    uint8  n;
+
+    if (sample->status == state->status && zzDod < TS_SHORT_DOD_LIMIT && zzValue < TS_SHORT_VALUE_LIMIT)
+    {
+        out[0] = (uint8)((zzDod << 5) | zzValue);
+        n      = 1;
+    }
+    else
+    {
+        boolean statusChanged = (sample->status != state->status) ? TRUE : FALSE;
+
+        out[0] = (uint8)(TS_LONG_FORM | (statusChanged ? TS_LONG_STATUS : 0u));
+        n      = 1;
+        n     += putVarint(&out[n], zzDod);
+        n     += putVarint(&out[n], zzValue);
+        if (statusChanged)
+        {
+            out[n++] = sample->status;
+        }
+    }
+
+    state->timestamp = sample->timestamp;
+    state->delta     = delta;
+    state->value     = sample->value;
+    state->status    = sample->status;
+
+    return n;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+uint8 Flash4_TsWriter_Init(Flash4_TsWriter_t *writer, const Flash4_TsConfig_t *config)
+{
+    uint32 oldestAddress;
+    uint32 pageCount;
+
+    if (!isValidRegion(config))
+        return FLASH4_ERROR;
+
+    writer->config = *config;
+    writer->count  = 0;
+    writer->used   = 0;
+
+    (void)locateLog(config, &oldestAddress, &pageCount, &writer->sequence);
+    writer->writeAddress = pageAddress(config, oldestAddress, pageCount);
+
+    return FLASH4_OK;
+}
+
+uint8 Flash4_TsWriter_Append(Flash4_TsWriter_t *writer, const Flash4_TsSample_t *sample)
+{
+    uint8 encoded[FLASH4_TS_MAX_SAMPLE_SIZE];
+    Flash4_TsState_t state;
+    uint8 n;
+    uint8 result;
+
+    if (writer->count == 0u)
+    {
+        startBlock(writer, sample);
+        return FLASH4_OK;
+    }
+
+    state = writer->state;
+    n     = encodeSample(&state, sample, encoded);
+
+    if ((uint16)(writer->used + n) > FLASH4_TS_BLOCK_SIZE || writer->count == 0xFFu)
+    {
+        result = Flash4_TsWriter_Flush(writer);
+        if (result != FLASH4_OK)
+            return result;
+
+        startBlock(writer, sample);
+        return FLASH4_OK;
+    }
+
+    memcpy(&writer->page[writer->used], encoded, n);
+    writer->used  += n;
+    writer->count += 1u;
+    writer->state  = state;
+
+    writer->header.lastTimestamp = sample->timestamp;
+    if (sample->value < writer->header.minValue)
+        writer->header.minValue = sample->value;
+    if (sample->value > writer->header.maxValue)
+        writer->header.maxValue = sample->value;
+
+    return FLASH4_OK;
+}
+
+uint8 Flash4_TsWriter_Flush(Flash4_TsWriter_t *writer)
+{
+    Flash4_TsBlockHeader_t *header = &writer->header;
+    uint8 result;
+
+    if (writer->count == 0u)
+        return FLASH4_OK;
+
+    /* Entering a new sector: erase it, dropping the oldest blocks of the ring */
+    if (writer->writeAddress % FLASH4_SECTOR_SIZE == 0u)
+    {
+        result = Flash4_EraseSector(writer->writeAddress);
+        if (result != FLASH4_OK)
+            return result;
+    }
+
+    header->count    = writer->count;
+    header->length   = (uint8)(writer->used - FLASH4_TS_HEADER_SIZE);
+    header->sequence = writer->sequence;
+    header->crc      = 0;
+    memcpy(writer->page, header, FLASH4_TS_HEADER_SIZE);
+    header->crc      = Crc16_Calculate(writer->page, writer->used);
+    memcpy(writer->page, header, FLASH4_TS_HEADER_SIZE);
+
+    result = Flash4_ProgramPage(writer->page, writer->writeAddress, writer->used);
+    if (result != FLASH4_OK)
+        return result;
+
+    writer->writeAddress = nextPage(&writer->config, writer->writeAddress);
+    writer->sequence    += 1u;
+    writer->count        = 0;
+    writer->used         = 0;
+
+    return FLASH4_OK;
+}
+
+boolean Flash4_TsBlock_Open(Flash4_TsBlockDecoder_t *decoder, const uint8 *block)
+{
+    Flash4_TsBlockHeader_t header;
+    uint16 crc;
+
+    memcpy(&header, block, sizeof(header));
+
+    if (header.magic != FLASH4_TS_BLOCK_MAGIC || header.count == 0u ||
+        header.length > FLASH4_TS_BLOCK_SIZE - FLASH4_TS_HEADER_SIZE)
+        return FALSE;
+
+    crc = Crc16_Update(CRC16_INIT_VALUE, block, FLASH4_TS_HEADER_SIZE - 2u);
+    crc = Crc16_Update(crc, (const uint8 *)"\0\0", 2u);
+    crc = Crc16_Update(crc, &block[FLASH4_TS_HEADER_SIZE], header.length);
+    if (crc != header.crc)
+        return FALSE;
+
+    decoder->block           = block;
+    decoder->position        = FLASH4_TS_HEADER_SIZE;
+    decoder->end             = (uint16)(FLASH4_TS_HEADER_SIZE + header.length);
+    decoder->remaining       = (uint8)(header.count - 1u);
+    decoder->basePending     = TRUE;
+    decoder->state.timestamp = header.baseTimestamp;
+    decoder->state.delta     = 0;
+    decoder->state.value     = header.baseValue;
+    decoder->state.status    = header.baseStatus;
+
+    return TRUE;
+}
+
+boolean Flash4_TsBlock_Next(Flash4_TsBlockDecoder_t *decoder, Flash4_TsSample_t *sample)
+{
+    Flash4_TsState_t *state = &decoder->state;
+    uint32 zzDod;
+    uint32 zzValue;
+    uint8  tag;
+
+    if (decoder->basePending)
+    {
+        decoder->basePending = FALSE;
+    }
+    else
+    {
+        if (decoder->remaining == 0u || decoder->position >= decoder->end)
+            return FALSE;
+
+        tag = decoder->block[decoder->position++];
+        if ((tag & TS_LONG_FORM) == 0u)
+        {
+            zzDod   = (uint32)(tag >> 5);
+            zzValue = (uint32)(tag & 0x1Fu);
+        }
+        else
+        {
+            if (!getVarint(decoder, &zzDod) || !getVarint(decoder, &zzValue))
+                return FALSE;
+
+            if ((tag & TS_LONG_STATUS) != 0u)
+            {
+                if (decoder->position >= decoder->end)
+                    return FALSE;
+                state->status = decoder->block[decoder->position++];
+            }
+        }
+
+        state->delta     += zigZagDecode(zzDod);
+        state->timestamp += state->delta;
+        state->value      = (uint16)(state->value + zigZagDecode(zzValue));
+        decoder->remaining--;
+    }
+
+    sample->timestamp = state->timestamp;
+    sample->value     = state->value;
+    sample->status    = state->status;
+
+    return TRUE;
+}
+
+uint8 Flash4_TsReader_Init(Flash4_TsReader_t *reader, const Flash4_TsConfig_t *config)
+{
+    const Flash4_TsQuery_t everything = {0u, 0xFFFFFFFFu, FALSE, 0u, 0xFFFFu};
+
+    return Flash4_TsReader_InitQuery(reader, config, &everything);
+}
+
+uint8 Flash4_TsReader_InitQuery(Flash4_TsReader_t *reader, const Flash4_TsConfig_t *config,
+                                const Flash4_TsQuery_t *query)
+{
+    Flash4_TsBlockHeader_t header;
+    uint32 oldestAddress;
+    uint32 pageCount;
+    uint32 sequence;
+    uint32 firstSequence;
+    uint32 low;
+    uint32 high;
+
+    if (!isValidRegion(config))
+        return FLASH4_ERROR;
+
+    reader->config              = *config;
+    reader->query               = *query;
+    reader->pagesLoaded         = 0;
+    reader->pagesSkipped        = 0;
+    reader->decoder.remaining   = 0;
+    reader->decoder.basePending = FALSE;
+
+    (void)locateLog(config, &oldestAddress, &pageCount, &sequence);
+    firstSequence = sequence - pageCount;
+
+    /* First block whose last sample is not older than the window start, invalid pages are probed past */
+    low  = 0;
+    high = pageCount;
+    while (low < high)
+    {
+        uint32 mid   = (low + high) / 2u;
+        uint32 probe = mid;
+
+        while (probe < high && !readLogHeader(config, oldestAddress, firstSequence, probe, &header))
+            probe++;
+
+        if (probe == high)
+            high = mid;
+        else if (header.lastTimestamp < query->fromTimestamp)
+            low = probe + 1u;
+        else
+            high = probe;
+    }
+
+    reader->address   = pageAddress(config, oldestAddress, low);
+    reader->sequence  = firstSequence + low;
+    reader->pagesLeft = pageCount - low;
+
+    return FLASH4_OK;
+}
+
+boolean Flash4_TsReader_Next(Flash4_TsReader_t *reader, Flash4_TsSample_t *sample)
+{
+    const Flash4_TsQuery_t *query = &reader->query;
+    Flash4_TsBlockHeader_t header;
+    uint32 address;
+
+    for (;;)
+    {
+        while (Flash4_TsBlock_Next(&reader->decoder, sample))
+        {
+            if (sample->timestamp > query->toTimestamp)
+            {
+                reader->pagesLeft = 0;
+                return FALSE;
+            }
+            if (sample->timestamp >= query->fromTimestamp &&
+                (!query->filterValue || (sample->value >= query->minValue && sample->value <= query->maxValue)))
+            {
+                return TRUE;
+            }
+        }
+
+        if (reader->pagesLeft == 0u)
+            return FALSE;
+
+        /* Decide on the header alone, the payload is only read for blocks overlapping the query */
+        address = reader->address;
+        readHeader(address, &header);
+        reader->address    = nextPage(&reader->config, address);
+        reader->pagesLeft -= 1u;
+        reader->sequence  += 1u;
+
+        /* A torn page or a break in the sequence only loses that page, the blocks behind it are still valid */
+        if (header.magic != FLASH4_TS_BLOCK_MAGIC || header.sequence != reader->sequence - 1u ||
+            header.length > FLASH4_TS_BLOCK_SIZE - FLASH4_TS_HEADER_SIZE)
+        {
+            reader->pagesSkipped += 1u;
+            continue;
+        }
+        if (header.baseTimestamp > query->toTimestamp)
+        {
+            reader->pagesLeft = 0;
+            return FALSE;
+        }
+        if (header.lastTimestamp < query->fromTimestamp ||
+            (query->filterValue && (header.maxValue < query->minValue || header.minValue > query->maxValue)))
+        {
+            continue;
+        }
+
+        memcpy(reader->page, &header, FLASH4_TS_HEADER_SIZE);
+        Flash4_ReadFlash4(&reader->page[FLASH4_TS_HEADER_SIZE], address + FLASH4_TS_HEADER_SIZE, header.length);
+        reader->pagesLoaded += 1u;
+
+        if (!Flash4_TsBlock_Open(&reader->decoder, reader->page))
+        {
+            /* Corrupted block, skip it */
+            reader->decoder.remaining   = 0;
+            reader->decoder.basePending = FALSE;
+            reader->pagesSkipped       += 1u;
+        }
+    }
+}
+
+uint8 Flash4_TsLog_GetNewestTimestamp(const Flash4_TsConfig_t *config, uint32 *timestamp)
+{
+    Flash4_TsBlockHeader_t header;
+    uint32 oldestAddress;
+    uint32 pageCount;
+    uint32 sequence;
+
+    if (!isValidRegion(config) || !locateLog(config, &oldestAddress, &pageCount, &sequence))
+        return FLASH4_ERROR;
+
+    readHeader(pageAddress(config, oldestAddress, pageCount - 1u), &header);
+    *timestamp = header.lastTimestamp;
+
+    return FLASH4_OK;
+}
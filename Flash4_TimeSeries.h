@@ -0,0 +1,209 @@
+/**********************************************************************************************************************
+ * \file Flash4_TimeSeries.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Compressed time-series log for Flash4
+ * Samples are packed into page sized blocks: the first sample of a block is stored raw in the block header, the
+ * following ones as delta-of-delta timestamps and zig-zag value deltas. Slowly varying signals sampled at a steady
+ * rate need a single byte per sample instead of the 8 bytes of a raw log entry.
+ *
+ * Every block header also summarizes its samples (timestamp range, count, value range). Range queries binary search
+ * the headers and only load the payload of blocks overlapping the requested window, timestamps are therefore
+ * expected to be non-decreasing over the whole log.
+ *
+ * Block payload encoding (per sample after the first):
+ *   0ddvvvvv                  short form: zig-zag delta-of-delta < 4, zig-zag value delta < 32, status unchanged
+ *   1000000s <dod> <dv> [st]  long form:  varint zig-zag delta-of-delta, varint zig-zag value delta,
+ *                                         status byte present if s = 1
+ *********************************************************************************************************************/
+
+#ifndef FLASH4_TIMESERIES_H_
+#define FLASH4_TIMESERIES_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define FLASH4_TS_BLOCK_MAGIC                    0xA5        /* Marks a programmed block header          */
+#define FLASH4_TS_BLOCK_SIZE                     FLASH4_MAX_PAGE_SIZE
+#define FLASH4_TS_HEADER_SIZE                    24
+#define FLASH4_TS_MAX_SAMPLE_SIZE                10          /* Long form with 5 + 3 byte varints + status */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* One decoded log sample */
+typedef struct
+{
+    uint32 timestamp;       /* Timestamp in milliseconds */
+    uint16 value;           /* Sensor reading */
+    uint8  status;          /* Status flags */
+} Flash4_TsSample_t;
+
+/* Block header and summary stored at the start of every programmed page */
+typedef struct
+{
+    uint8  magic;           /* FLASH4_TS_BLOCK_MAGIC                          */
+    uint8  baseStatus;      /* Status of the first sample                     */
+    uint8  count;           /* Number of samples including the first one      */
+    uint8  length;          /* Payload bytes following the header             */
+    uint32 sequence;        /* Block sequence number, +1 per programmed page  */
+    uint32 baseTimestamp;   /* Timestamp of the first sample                  */
+    uint32 lastTimestamp;   /* Timestamp of the last sample                   */
+    uint16 baseValue;       /* Value of the first sample                      */
+    uint16 minValue;        /* Smallest value in the block                    */
+    uint16 maxValue;        /* Largest value in the block                     */
+    uint16 crc;             /* CRC-16 over header (crc = 0) and payload       */
+} Flash4_TsBlockHeader_t;
+
+/* Log region, must be sector aligned */
+typedef struct
+{
+    uint32 startAddress;    /* First sector of the log                  */
+    uint32 sectorCount;     /* Number of sectors used as ring (min. 2)  */
+} Flash4_TsConfig_t;
+
+/* Delta state shared by encoder and decoder */
+typedef struct
+{
+    uint32 timestamp;
+    uint32 delta;
+    uint16 value;
+    uint8  status;
+} Flash4_TsState_t;
+
+/* Writer: builds one block in RAM and programs it when the page is full */
+typedef struct
+{
+    Flash4_TsConfig_t config;
+    uint32            writeAddress;     /* Page the current block will be programmed to */
+    uint32            sequence;         /* Sequence number of the current block         */
+    Flash4_TsState_t  state;
+    Flash4_TsBlockHeader_t header;      /* Header of the current block                  */
+    uint16            used;             /* Bytes used in page, header included          */
+    uint8             count;            /* Samples in the current block                 */
+    uint8             page[FLASH4_TS_BLOCK_SIZE];
+} Flash4_TsWriter_t;
+
+/* Streaming decoder over one block held in RAM */
+typedef struct
+{
+    const uint8      *block;
+    uint16            position;
+    uint16            end;
+    uint8             remaining;        /* Delta coded samples left           */
+    boolean           basePending;      /* Header sample not returned yet     */
+    Flash4_TsState_t  state;
+} Flash4_TsBlockDecoder_t;
+
+/* Selection applied by a reader, inclusive bounds */
+typedef struct
+{
+    uint32  fromTimestamp;
+    uint32  toTimestamp;
+    boolean filterValue;    /* Only return samples inside [minValue, maxValue] */
+    uint16  minValue;
+    uint16  maxValue;
+} Flash4_TsQuery_t;
+
+/* Streaming reader over the log, oldest block first */
+typedef struct
+{
+    Flash4_TsConfig_t       config;
+    Flash4_TsQuery_t        query;
+    uint32                  address;        /* Next page to visit                */
+    uint32                  pagesLeft;      /* Programmed pages not visited yet  */
+    uint32                  sequence;       /* Expected sequence at address      */
+    uint32                  pagesLoaded;    /* Pages whose payload was read      */
+    uint32                  pagesSkipped;   /* Torn or out of sequence pages     */
+    Flash4_TsBlockDecoder_t decoder;
+    uint8                   page[FLASH4_TS_BLOCK_SIZE];
+} Flash4_TsReader_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Open the log for writing, continuing after the newest programmed block
+ * \param writer Writer state
+ * \param config Log region
+ * \return FLASH4_OK, FLASH4_ERROR if the region is invalid
+ */
+uint8 Flash4_TsWriter_Init(Flash4_TsWriter_t *writer, const Flash4_TsConfig_t *config);
+
+/**
+ * \brief Append a sample, programming the current block first when it is full
+ * \param writer Writer state
+ * \param sample Sample to append
+ * \return FLASH4_OK or the error of the page program / sector erase
+ */
+uint8 Flash4_TsWriter_Append(Flash4_TsWriter_t *writer, const Flash4_TsSample_t *sample);
+
+/**
+ * \brief Program the current block even if the page is not full
+ * The next sample starts a new block on the following page.
+ * \param writer Writer state
+ * \return FLASH4_OK or the error of the page program / sector erase
+ */
+uint8 Flash4_TsWriter_Flush(Flash4_TsWriter_t *writer);
+
+/**
+ * \brief Validate a block and prepare decoding of its samples
+ * \param decoder Decoder state
+ * \param block Page buffer holding the block
+ * \return TRUE if the block header and CRC are valid
+ */
+boolean Flash4_TsBlock_Open(Flash4_TsBlockDecoder_t *decoder, const uint8 *block);
+
+/**
+ * \brief Decode the next sample of an opened block
+ * \param decoder Decoder state
+ * \param sample Output sample
+ * \return TRUE if a sample was decoded, FALSE at the end of the block or on malformed data
+ */
+boolean Flash4_TsBlock_Next(Flash4_TsBlockDecoder_t *decoder, Flash4_TsSample_t *sample);
+
+/**
+ * \brief Position a reader on the oldest block of the log
+ * \param reader Reader state
+ * \param config Log region
+ * \return FLASH4_OK, FLASH4_ERROR if the region is invalid
+ */
+uint8 Flash4_TsReader_Init(Flash4_TsReader_t *reader, const Flash4_TsConfig_t *config);
+
+/**
+ * \brief Position a reader on the first block that may hold samples of the query
+ * Blocks are located by binary search over their headers, blocks outside the time or value range are skipped
+ * without reading their payload. A page whose header is not programmed or whose sequence number does not match
+ * its position in the ring (torn program, reset between erase and program) is skipped, not taken as end of log.
+ * \param reader Reader state
+ * \param config Log region
+ * \param query Time window and optional value range
+ * \return FLASH4_OK, FLASH4_ERROR if the region is invalid
+ */
+uint8 Flash4_TsReader_InitQuery(Flash4_TsReader_t *reader, const Flash4_TsConfig_t *config,
+                                const Flash4_TsQuery_t *query);
+
+/**
+ * \brief Read the next sample, loading one page at a time
+ * \param reader Reader state
+ * \param sample Output sample
+ * \return TRUE if a sample was read, FALSE at the end of the log or of the query window
+ */
+boolean Flash4_TsReader_Next(Flash4_TsReader_t *reader, Flash4_TsSample_t *sample);
+
+/**
+ * \brief Get the timestamp of the newest programmed sample, e.g. to query the last N minutes
+ * \param config Log region
+ * \param timestamp Output timestamp
+ * \return FLASH4_OK, FLASH4_ERROR if the log is empty or the region is invalid
+ */
+uint8 Flash4_TsLog_GetNewestTimestamp(const Flash4_TsConfig_t *config, uint32 *timestamp);
+
+#endif /* FLASH4_TIMESERIES_H_ */
@@ -0,0 +1,266 @@
+/**********************************************************************************************************************
+ * \file Flash4_Window.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Paged virtual window over Flash4
+ *********************************************************************************************************************/
+
+#include <string.h>
+#include "Flash4_Window.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define WINDOW_PAGE_OF(offset)      ((offset) / FLASH4_WINDOW_FRAME_SIZE)
+#define WINDOW_IN_PAGE(offset)      ((offset) % FLASH4_WINDOW_FRAME_SIZE)
+#define WINDOW_NO_FRAME             0xFFu
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static uint8 *frameData(Flash4_Window_t *window, uint8 frame)
+{
+    return &window->frameMemory[(uint32)frame * FLASH4_WINDOW_FRAME_SIZE];
+}
+
+static uint8 findFrame(Flash4_Window_t *window, uint32 page)
+{
+    uint8 i;
+
+    if (window->frames[window->lastFrame].page == page)
+        return window->lastFrame;
+
+    for (i = 0; i < window->frameCount; i++)
+    {
+        if (window->frames[i].page == page)
+            return i;
+    }
+
+    return WINDOW_NO_FRAME;
+}
+
+/* Free frame if there is one, else the least recently used unpinned frame */
+static uint8 victimFrame(Flash4_Window_t *window)
+{
+    uint8 victim = WINDOW_NO_FRAME;
+    uint8 i;
+
+    for (i = 0; i < window->frameCount; i++)
+    {
+        Flash4_WindowFrame_t *frame = &window->frames[i];
+
+        if (frame->page == FLASH4_WINDOW_NO_PAGE)
+            return i;
+
+        if (frame->pinCount == 0u &&
+            (victim == WINDOW_NO_FRAME || (sint32)(frame->lastUse - window->frames[victim].lastUse) < 0))
+        {
+            victim = i;
+        }
+    }
+
+    return victim;
+}
+
+static void loadFrame(Flash4_Window_t *window, uint8 frame, uint32 page)
+{
+    uint32 pageOffset = page * FLASH4_WINDOW_FRAME_SIZE;
+    uint32 length     = window->size - pageOffset;
+
+    if (length > FLASH4_WINDOW_FRAME_SIZE)
+        length = FLASH4_WINDOW_FRAME_SIZE;
+
+    Flash4_ReadBuffer(frameData(window, frame), window->baseAddress + pageOffset, length);
+    window->frames[frame].page     = page;
+    window->frames[frame].pinCount = 0;
+}
+
+/* Return the frame holding a page, loading it on a miss */
+static uint8 residentFrame(Flash4_Window_t *window, uint32 page)
+{
+    uint8 frame = findFrame(window, page);
+
+    if (frame == WINDOW_NO_FRAME)
+    {
+        frame = victimFrame(window);
+        if (frame == WINDOW_NO_FRAME)
+            return WINDOW_NO_FRAME;
+
+        loadFrame(window, frame, page);
+        window->misses++;
+    }
+    else
+    {
+        window->hits++;
+    }
+
+    window->frames[frame].lastUse = ++window->useCounter;
+    window->lastFrame             = frame;
+
+    return frame;
+}
+
+static boolean isValidRange(const Flash4_Window_t *window, uint32 offset, uint32 length)
+{
+    return (offset < window->size) && (length <= window->size - offset);
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+uint8 Flash4_Window_Init(Flash4_Window_t *window, uint32 baseAddress, uint32 size, uint8 *frameMemory,
+                         uint8 frameCount)
+{
+    if (frameMemory == NULL_PTR || frameCount == 0u || frameCount > FLASH4_WINDOW_MAX_FRAMES || size == 0u)
+        return FLASH4_ERROR;
+
+    window->baseAddress   = baseAddress;
+    window->size          = size;
+    window->frameMemory   = frameMemory;
+    window->frameCount    = frameCount;
+    window->lastFrame     = 0;
+    window->useCounter    = 0;
+    window->prefetchHead  = 0;
+    window->prefetchCount = 0;
+    window->hits          = 0;
+    window->misses        = 0;
+
+    memset(window->frames, 0, sizeof(window->frames));
+    Flash4_Window_Invalidate(window);
+
+    return FLASH4_OK;
+}
+
+const uint8 *Flash4_Map(Flash4_Window_t *window, uint32 offset, uint32 length)
+{
+    uint8 frame;
+
+    if (!isValidRange(window, offset, length) || WINDOW_IN_PAGE(offset) + length > FLASH4_WINDOW_FRAME_SIZE)
+        return NULL_PTR;
+
+    frame = residentFrame(window, WINDOW_PAGE_OF(offset));
+    if (frame == WINDOW_NO_FRAME)
+        return NULL_PTR;
+
+    return &frameData(window, frame)[WINDOW_IN_PAGE(offset)];
+}
+
+const uint8 *Flash4_Window_Pin(Flash4_Window_t *window, uint32 offset, uint32 length)
+{
+    const uint8 *data = Flash4_Map(window, offset, length);
+
+    if (data != NULL_PTR)
+        window->frames[window->lastFrame].pinCount++;
+
+    return data;
+}
+
+void Flash4_Window_Unpin(Flash4_Window_t *window, uint32 offset)
+{
+    uint8 frame = findFrame(window, WINDOW_PAGE_OF(offset));
+
+    if (frame != WINDOW_NO_FRAME && window->frames[frame].pinCount > 0u)
+        window->frames[frame].pinCount--;
+}
+
+uint8 Flash4_Window_Read(Flash4_Window_t *window, uint32 offset, uint8 *outData, uint32 length)
+{
+    if (!isValidRange(window, offset, length))
+        return FLASH4_ERROR;
+
+    while (length > 0u)
+    {
+        uint32 chunk = FLASH4_WINDOW_FRAME_SIZE - WINDOW_IN_PAGE(offset);
+        const uint8 *data;
+
+        if (chunk > length)
+            chunk = length;
+
+        data = Flash4_Map(window, offset, chunk);
+        if (data == NULL_PTR)
+            return FLASH4_ERROR;
+
+        memcpy(outData, data, chunk);
+        outData += chunk;
+        offset  += chunk;
+        length  -= chunk;
+    }
+
+    return FLASH4_OK;
+}
+
+void Flash4_Window_Prefetch(Flash4_Window_t *window, uint32 offset, uint32 length)
+{
+    uint32 page;
+    uint32 lastPage;
+
+    if (length == 0u || !isValidRange(window, offset, length))
+        return;
+
+    lastPage = WINDOW_PAGE_OF(offset + length - 1u);
+    for (page = WINDOW_PAGE_OF(offset); page <= lastPage; page++)
+    {
+        if (window->prefetchCount >= FLASH4_WINDOW_PREFETCH_DEPTH)
+            return;
+
+        if (findFrame(window, page) == WINDOW_NO_FRAME)
+        {
+            uint8 slot = (uint8)((window->prefetchHead + window->prefetchCount) % FLASH4_WINDOW_PREFETCH_DEPTH);
+
+            window->prefetch[slot] = page;
+            window->prefetchCount++;
+        }
+    }
+}
+
+uint8 Flash4_Window_ProcessPrefetch(Flash4_Window_t *window, uint8 maxPages)
+{
+    uint32 startUse = window->useCounter;
+    uint8  loaded   = 0;
+
+    while (window->prefetchCount > 0u && loaded < maxPages)
+    {
+        uint32 page  = window->prefetch[window->prefetchHead];
+        uint8  frame = WINDOW_NO_FRAME;
+
+        if (findFrame(window, page) == WINDOW_NO_FRAME)
+        {
+            /*
+             * Never replace a page loaded or used since this call started, only older frames are given up. Without
+             * a victim the page stays queued for the next call.
+             */
+            frame = victimFrame(window);
+            if (frame == WINDOW_NO_FRAME ||
+                (window->frames[frame].page != FLASH4_WINDOW_NO_PAGE &&
+                 (sint32)(window->frames[frame].lastUse - startUse) > 0))
+                break;
+        }
+
+        window->prefetchHead = (uint8)((window->prefetchHead + 1u) % FLASH4_WINDOW_PREFETCH_DEPTH);
+        window->prefetchCount--;
+
+        if (frame == WINDOW_NO_FRAME)
+            continue;
+
+        /* Prefetched pages count as just used so they survive until the access they were requested for */
+        loadFrame(window, frame, page);
+        window->frames[frame].lastUse = ++window->useCounter;
+        loaded++;
+    }
+
+    return loaded;
+}
+
+void Flash4_Window_Invalidate(Flash4_Window_t *window)
+{
+    uint8 i;
+
+    for (i = 0; i < window->frameCount; i++)
+    {
+        if (window->frames[i].pinCount == 0u)
+            window->frames[i].page = FLASH4_WINDOW_NO_PAGE;
+    }
+    window->prefetchCount = 0;
+}
@@ -0,0 +1,133 @@
+/**********************************************************************************************************************
+ * \file Flash4_Window.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Paged virtual window over Flash4
+ * The QSPI flash cannot be executed or read in place. A window maps a region of Flash4 onto a small set of RAM page
+ * frames: Flash4_Map() returns a pointer into a frame, loading the page on demand and replacing the least recently
+ * used unpinned frame. Pinned pages stay resident, prefetch hints are queued and loaded when the application is idle.
+ *********************************************************************************************************************/
+
+#ifndef FLASH4_WINDOW_H_
+#define FLASH4_WINDOW_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#ifndef FLASH4_WINDOW_FRAME_SIZE
+#define FLASH4_WINDOW_FRAME_SIZE                 1024        /* Bytes per RAM page frame (power of two)  */
+#endif
+#define FLASH4_WINDOW_MAX_FRAMES                 16
+#define FLASH4_WINDOW_PREFETCH_DEPTH             8
+#define FLASH4_WINDOW_NO_PAGE                    0xFFFFFFFFUL
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+/* Bookkeeping of one RAM page frame */
+typedef struct
+{
+    uint32 page;            /* Window page held, FLASH4_WINDOW_NO_PAGE if free */
+    uint32 lastUse;         /* LRU stamp                                        */
+    uint16 pinCount;        /* Frame cannot be replaced while > 0               */
+} Flash4_WindowFrame_t;
+
+/* Window handle */
+typedef struct
+{
+    uint32               baseAddress;       /* Flash4 address of window offset 0        */
+    uint32               size;              /* Window size in bytes                     */
+    uint8               *frameMemory;       /* frameCount * FLASH4_WINDOW_FRAME_SIZE     */
+    Flash4_WindowFrame_t frames[FLASH4_WINDOW_MAX_FRAMES];
+    uint8                frameCount;
+    uint8                lastFrame;         /* Frame of the last hit, checked first     */
+    uint32               useCounter;
+    uint32               prefetch[FLASH4_WINDOW_PREFETCH_DEPTH];
+    uint8                prefetchHead;
+    uint8                prefetchCount;
+    uint32               hits;              /* Statistics                               */
+    uint32               misses;
+} Flash4_Window_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Initialize a window over a Flash4 region
+ * \param window Window handle
+ * \param baseAddress Flash4 address of window offset 0
+ * \param size Window size in bytes
+ * \param frameMemory RAM for the page frames, frameCount * FLASH4_WINDOW_FRAME_SIZE bytes, 4 byte aligned
+ * \param frameCount Number of page frames (1 .. FLASH4_WINDOW_MAX_FRAMES)
+ * \return FLASH4_OK, FLASH4_ERROR on invalid parameters
+ */
+uint8 Flash4_Window_Init(Flash4_Window_t *window, uint32 baseAddress, uint32 size, uint8 *frameMemory,
+                         uint8 frameCount);
+
+/**
+ * \brief Map a range of the window into RAM
+ * The pointer stays valid until a later map replaces the frame, use Flash4_Window_Pin() to keep it longer.
+ * \param window Window handle
+ * \param offset Offset inside the window
+ * \param length Number of bytes, the range must not cross a frame boundary
+ * \return Pointer to the data, NULL_PTR if the range is invalid or all frames are pinned
+ */
+const uint8 *Flash4_Map(Flash4_Window_t *window, uint32 offset, uint32 length);
+
+/**
+ * \brief Map a range and pin its frame
+ * \param window Window handle
+ * \param offset Offset inside the window
+ * \param length Number of bytes, the range must not cross a frame boundary
+ * \return Pointer to the data, valid until Flash4_Window_Unpin(), NULL_PTR on failure
+ */
+const uint8 *Flash4_Window_Pin(Flash4_Window_t *window, uint32 offset, uint32 length);
+
+/**
+ * \brief Release one pin of the frame holding an offset
+ * \param window Window handle
+ * \param offset Offset passed to Flash4_Window_Pin()
+ */
+void Flash4_Window_Unpin(Flash4_Window_t *window, uint32 offset);
+
+/**
+ * \brief Copy a range that may span several frames
+ * \param window Window handle
+ * \param offset Offset inside the window
+ * \param outData Output buffer
+ * \param length Number of bytes
+ * \return FLASH4_OK, FLASH4_ERROR if the range is invalid or all frames are pinned
+ */
+uint8 Flash4_Window_Read(Flash4_Window_t *window, uint32 offset, uint8 *outData, uint32 length);
+
+/**
+ * \brief Hint that a range will be used soon
+ * The pages are queued and loaded by Flash4_Window_ProcessPrefetch(), hints beyond the queue depth are dropped.
+ * \param window Window handle
+ * \param offset Offset inside the window
+ * \param length Number of bytes
+ */
+void Flash4_Window_Prefetch(Flash4_Window_t *window, uint32 offset, uint32 length);
+
+/**
+ * \brief Load queued prefetch pages, call from the idle loop
+ * \param window Window handle
+ * \param maxPages Maximum number of pages to load in this call
+ * \return Number of pages loaded
+ */
+uint8 Flash4_Window_ProcessPrefetch(Flash4_Window_t *window, uint8 maxPages);
+
+/**
+ * \brief Drop all unpinned frames, e.g. after the underlying flash region was reprogrammed
+ * \param window Window handle
+ */
+void Flash4_Window_Invalidate(Flash4_Window_t *window);
+
+#endif /* FLASH4_WINDOW_H_ */
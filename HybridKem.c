@@ -0,0 +1,48 @@
+/**********************************************************************************************************************
+ * \file HybridKem.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * X25519MLKEM768 hybrid key exchange
+ *********************************************************************************************************************/
+
+#include "HybridKem.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+void HybridKem_KeyPair(HybridKem_t *kem, const uint8 *random, uint8 *clientShare)
+{
+    MlKem_KeyPair(&kem->workspace, random, clientShare, kem->mlkemSecretKey);
+
+    memcpy(kem->x25519SecretKey, &random[MLKEM_SEED_SIZE], X25519_KEY_SIZE);
+    X25519_PublicKey(&clientShare[MLKEM768_PUBLIC_KEY_SIZE], kem->x25519SecretKey);
+}
+
+boolean HybridKem_Encapsulate(HybridKem_t *kem, const uint8 *clientShare, const uint8 *random, uint8 *serverShare,
+                              uint8 *secret)
+{
+    if (!MlKem_Encapsulate(&kem->workspace, clientShare, random, serverShare, secret))
+        return FALSE;
+
+    X25519_PublicKey(&serverShare[MLKEM768_CIPHERTEXT_SIZE], &random[MLKEM_MESSAGE_SIZE]);
+
+    /* An all-zero X25519 result means a low order point and must abort the handshake (RFC 8446 7.4.2) */
+    return X25519_ScalarMult(&secret[MLKEM_SHARED_SECRET_SIZE], &random[MLKEM_MESSAGE_SIZE],
+                             &clientShare[MLKEM768_PUBLIC_KEY_SIZE]);
+}
+
+boolean HybridKem_Decapsulate(HybridKem_t *kem, const uint8 *serverShare, uint8 *secret)
+{
+    boolean valid;
+
+    valid  = MlKem_Decapsulate(&kem->workspace, kem->mlkemSecretKey, serverShare, secret);
+    valid &= X25519_ScalarMult(&secret[MLKEM_SHARED_SECRET_SIZE], kem->x25519SecretKey,
+                               &serverShare[MLKEM768_CIPHERTEXT_SIZE]);
+
+    memset(kem->mlkemSecretKey, 0, sizeof(kem->mlkemSecretKey));
+    memset(kem->x25519SecretKey, 0, sizeof(kem->x25519SecretKey));
+
+    return valid;
+}
@@ -0,0 +1,77 @@
+/**********************************************************************************************************************
+ * \file HybridKem.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Hybrid key exchange X25519MLKEM768 for TLS 1.3 (named group 0x11EC)
+ * The client key share is the ML-KEM-768 public key followed by an X25519 public key. The server answers with
+ * the ML-KEM ciphertext followed by its own X25519 public key, and both sides feed the ML-KEM shared secret
+ * followed by the X25519 shared secret into the TLS key schedule. The exchange stays secure as long as either of
+ * the two holds.
+ *
+ * Random bytes are passed in by the caller, so the module does not depend on a particular generator.
+ *********************************************************************************************************************/
+
+#ifndef HYBRIDKEM_H_
+#define HYBRIDKEM_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "MlKem.h"
+#include "X25519.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define HYBRIDKEM_GROUP                          0x11EC      /* X25519MLKEM768                                 */
+#define HYBRIDKEM_CLIENT_SHARE_SIZE              (MLKEM768_PUBLIC_KEY_SIZE + X25519_KEY_SIZE)      /* 1216 */
+#define HYBRIDKEM_SERVER_SHARE_SIZE              (MLKEM768_CIPHERTEXT_SIZE + X25519_KEY_SIZE)      /* 1120 */
+#define HYBRIDKEM_SECRET_SIZE                    (MLKEM_SHARED_SECRET_SIZE + X25519_KEY_SIZE)      /* 64   */
+#define HYBRIDKEM_KEYPAIR_RANDOM_SIZE            (MLKEM_SEED_SIZE + X25519_KEY_SIZE)               /* 96   */
+#define HYBRIDKEM_ENCAPSULATE_RANDOM_SIZE        (MLKEM_MESSAGE_SIZE + X25519_KEY_SIZE)            /* 64   */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    MlKem_Workspace_t workspace;
+    uint8             mlkemSecretKey[MLKEM768_SECRET_KEY_SIZE];
+    uint8             x25519SecretKey[X25519_KEY_SIZE];
+} HybridKem_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Client: generate the key pairs and the key share for the ClientHello
+ * \param kem Exchange state, keeps the secret keys until HybridKem_Decapsulate()
+ * \param random HYBRIDKEM_KEYPAIR_RANDOM_SIZE random bytes
+ * \param clientShare Output, HYBRIDKEM_CLIENT_SHARE_SIZE bytes
+ */
+void HybridKem_KeyPair(HybridKem_t *kem, const uint8 *random, uint8 *clientShare);
+
+/**
+ * \brief Server: answer a client key share
+ * \param kem Exchange state, only the workspace is used
+ * \param clientShare HYBRIDKEM_CLIENT_SHARE_SIZE bytes
+ * \param random HYBRIDKEM_ENCAPSULATE_RANDOM_SIZE random bytes
+ * \param serverShare Output, HYBRIDKEM_SERVER_SHARE_SIZE bytes
+ * \param secret Output, HYBRIDKEM_SECRET_SIZE bytes
+ * \return FALSE if the client share is invalid and the handshake must be aborted, TRUE otherwise
+ */
+boolean HybridKem_Encapsulate(HybridKem_t *kem, const uint8 *clientShare, const uint8 *random, uint8 *serverShare,
+                              uint8 *secret);
+
+/**
+ * \brief Client: derive the shared secret from the server key share
+ * \param kem Exchange state from HybridKem_KeyPair(), the secret keys are cleared afterwards
+ * \param serverShare HYBRIDKEM_SERVER_SHARE_SIZE bytes
+ * \param secret Output, HYBRIDKEM_SECRET_SIZE bytes
+ * \return FALSE if the server share is invalid and the handshake must be aborted, TRUE otherwise
+ */
+boolean HybridKem_Decapsulate(HybridKem_t *kem, const uint8 *serverShare, uint8 *secret);
+
+#endif /* HYBRIDKEM_H_ */
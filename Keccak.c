@@ -0,0 +1,403 @@
+/**********************************************************************************************************************
+ * \file Keccak.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Keccak-f[1600] sponge implementation, bit-interleaved 32-bit lanes with lane complementing
+ *********************************************************************************************************************/
+
+#include "Keccak.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define ROL32(x, n)                 (((x) << (n)) | ((x) >> (32u - (n))))
+#define KECCAK_ROUNDS               24
+#define KECCAK_LANE_SIZE            8
+
+/* Lanes 1, 2, 8, 12, 17 and 20 are stored complemented, which saves most of the NOTs in chi */
+#define KECCAK_COMPLEMENTED_LANES   0x00121106uL
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Round constants split into their even and odd bits */
+static const uint32 g_keccakRoundConstant[KECCAK_ROUNDS][2] = {
+    {0x00000001, 0x00000000}, {0x00000000, 0x00000089}, {0x00000000, 0x8000008B}, {0x00000000, 0x80008080},
+    {0x00000001, 0x0000008B}, {0x00000001, 0x00008000}, {0x00000001, 0x80008088}, {0x00000001, 0x80000082},
+    {0x00000000, 0x0000000B}, {0x00000000, 0x0000000A}, {0x00000001, 0x00008082}, {0x00000000, 0x00008003},
+    {0x00000001, 0x0000808B}, {0x00000001, 0x8000000B}, {0x00000001, 0x8000008A}, {0x00000001, 0x80000081},
+    {0x00000000, 0x80000081}, {0x00000000, 0x80000008}, {0x00000000, 0x00000083}, {0x00000000, 0x80008003},
+    {0x00000001, 0x80008088}, {0x00000000, 0x80000088}, {0x00000001, 0x00008000}, {0x00000000, 0x80008082}
+};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Even bits of x to the lower half, odd bits to the upper half */
+static uint32 unshuffle(uint32 x)
+{
+    uint32 t;
+
+    t = (x ^ (x >> 1)) & 0x22222222u;
+    x ^= t ^ (t << 1);
+    t = (x ^ (x >> 2)) & 0x0C0C0C0Cu;
+    x ^= t ^ (t << 2);
+    t = (x ^ (x >> 4)) & 0x00F000F0u;
+    x ^= t ^ (t << 4);
+    t = (x ^ (x >> 8)) & 0x0000FF00u;
+    x ^= t ^ (t << 8);
+
+    return x;
+}
+
+/* Inverse of unshuffle() */
+static uint32 shuffle(uint32 x)
+{
+    uint32 t;
+
+    t = (x ^ (x >> 8)) & 0x0000FF00u;
+    x ^= t ^ (t << 8);
+    t = (x ^ (x >> 4)) & 0x00F000F0u;
+    x ^= t ^ (t << 4);
+    t = (x ^ (x >> 2)) & 0x0C0C0C0Cu;
+    x ^= t ^ (t << 2);
+    t = (x ^ (x >> 1)) & 0x22222222u;
+    x ^= t ^ (t << 1);
+
+    return x;
+}
+
+static uint32 load32(const uint8 *bytes)
+{
+    return (uint32)bytes[0] | ((uint32)bytes[1] << 8) | ((uint32)bytes[2] << 16) | ((uint32)bytes[3] << 24);
+}
+
+static void store32(uint8 *bytes, uint32 value)
+{
+    bytes[0] = (uint8)value;
+    bytes[1] = (uint8)(value >> 8);
+    bytes[2] = (uint8)(value >> 16);
+    bytes[3] = (uint8)(value >> 24);
+}
+
+/* XOR 8 input bytes into lane index */
+static void xorLane(uint32 *lane, uint32 index, const uint8 *bytes)
+{
+    uint32 lo = unshuffle(load32(bytes));
+    uint32 hi = unshuffle(load32(&bytes[4]));
+
+    lane[2u * index]      ^= (lo & 0x0000FFFFu) | (hi << 16);
+    lane[2u * index + 1u] ^= (lo >> 16) | (hi & 0xFFFF0000u);
+}
+
+/* XOR one input byte into the state at byte position */
+static void xorByte(uint32 *lane, uint32 position, uint8 value)
+{
+    uint32 bits  = unshuffle(value);
+    uint32 shift = 4u * (position % KECCAK_LANE_SIZE);
+
+    lane[2u * (position / KECCAK_LANE_SIZE)]      ^= (bits & 0xFu) << shift;
+    lane[2u * (position / KECCAK_LANE_SIZE) + 1u] ^= ((bits >> 16) & 0xFu) << shift;
+}
+
+/* Lane index as 8 output bytes, undoing the interleaving and the complement */
+static void extractLane(const uint32 *lane, uint32 index, uint8 *bytes)
+{
+    uint32 even = lane[2u * index];
+    uint32 odd  = lane[2u * index + 1u];
+    uint32 lo   = shuffle((even & 0x0000FFFFu) | (odd << 16));
+    uint32 hi   = shuffle((even >> 16) | (odd & 0xFFFF0000u));
+
+    if (((KECCAK_COMPLEMENTED_LANES >> index) & 1u) != 0u)
+    {
+        lo = ~lo;
+        hi = ~hi;
+    }
+
+    store32(bytes, lo);
+    store32(&bytes[4], hi);
+}
+
+/*
+ * One round from state a into state e. Lane i has its even bits in word 2 * i and its odd bits in word 2 * i + 1,
+ * so a 64-bit rotation becomes two 32-bit rotations, swapping the halves for odd amounts. Rho and pi are folded
+ * into the loads of each output row, and chi uses the complemented lanes to replace NOTs by ORs.
+ */
+static void permuteRound(uint32 *e, const uint32 *a, const uint32 *rc)
+{
+    uint32 c[10];
+    uint32 d[10];
+    uint32 b0, b1, b2, b3, b4;
+    uint32 x;
+
+    /* Theta */
+    for (x = 0; x < 10u; x++)
+        c[x] = a[x] ^ a[x + 10u] ^ a[x + 20u] ^ a[x + 30u] ^ a[x + 40u];
+
+    for (x = 0; x < 5u; x++)
+    {
+        d[2u * x]      = c[2u * ((x + 4u) % 5u)] ^ ROL32(c[2u * ((x + 1u) % 5u) + 1u], 1u);
+        d[2u * x + 1u] = c[2u * ((x + 4u) % 5u) + 1u] ^ c[2u * ((x + 1u) % 5u)];
+    }
+
+    /* Output row 0, even bits */
+    b0 = a[0] ^ d[0];
+    b1 = ROL32(a[12] ^ d[2], 22u);
+    b2 = ROL32(a[25] ^ d[5], 22u);
+    b3 = ROL32(a[37] ^ d[7], 11u);
+    b4 = ROL32(a[48] ^ d[8], 7u);
+    e[0] = b0 ^ (b1 | b2) ^ rc[0];
+    e[2] = b1 ^ (~b2 | b3);
+    e[4] = b2 ^ (b3 & b4);
+    e[6] = b3 ^ (b4 | b0);
+    e[8] = b4 ^ (b0 & b1);
+
+    /* Output row 0, odd bits */
+    b0 = a[1] ^ d[1];
+    b1 = ROL32(a[13] ^ d[3], 22u);
+    b2 = ROL32(a[24] ^ d[4], 21u);
+    b3 = ROL32(a[36] ^ d[6], 10u);
+    b4 = ROL32(a[49] ^ d[9], 7u);
+    e[1] = b0 ^ (b1 | b2) ^ rc[1];
+    e[3] = b1 ^ (~b2 | b3);
+    e[5] = b2 ^ (b3 & b4);
+    e[7] = b3 ^ (b4 | b0);
+    e[9] = b4 ^ (b0 & b1);
+
+    /* Output row 1, even bits */
+    b0 = ROL32(a[6] ^ d[6], 14u);
+    b1 = ROL32(a[18] ^ d[8], 10u);
+    b2 = ROL32(a[21] ^ d[1], 2u);
+    b3 = ROL32(a[33] ^ d[3], 23u);
+    b4 = ROL32(a[45] ^ d[5], 31u);
+    e[10] = b0 ^ (b1 | b2);
+    e[12] = b1 ^ (b2 & b3);
+    e[14] = b2 ^ (b3 | ~b4);
+    e[16] = b3 ^ (b4 | b0);
+    e[18] = b4 ^ (b0 & b1);
+
+    /* Output row 1, odd bits */
+    b0 = ROL32(a[7] ^ d[7], 14u);
+    b1 = ROL32(a[19] ^ d[9], 10u);
+    b2 = ROL32(a[20] ^ d[0], 1u);
+    b3 = ROL32(a[32] ^ d[2], 22u);
+    b4 = ROL32(a[44] ^ d[4], 30u);
+    e[11] = b0 ^ (b1 | b2);
+    e[13] = b1 ^ (b2 & b3);
+    e[15] = b2 ^ (b3 | ~b4);
+    e[17] = b3 ^ (b4 | b0);
+    e[19] = b4 ^ (b0 & b1);
+
+    /* Output row 2, even bits */
+    b0 = ROL32(a[3] ^ d[3], 1u);
+    b1 = ROL32(a[14] ^ d[4], 3u);
+    b2 = ROL32(a[27] ^ d[7], 13u);
+    b3 = ROL32(a[38] ^ d[8], 4u);
+    b4 = ROL32(a[40] ^ d[0], 9u);
+    e[20] = b0 ^ (b1 | b2);
+    e[22] = b1 ^ (b2 & b3);
+    e[24] = b2 ^ (~b3 & b4);
+    e[26] = ~b3 ^ (b4 | b0);
+    e[28] = b4 ^ (b0 & b1);
+
+    /* Output row 2, odd bits */
+    b0 = a[2] ^ d[2];
+    b1 = ROL32(a[15] ^ d[5], 3u);
+    b2 = ROL32(a[26] ^ d[6], 12u);
+    b3 = ROL32(a[39] ^ d[9], 4u);
+    b4 = ROL32(a[41] ^ d[1], 9u);
+    e[21] = b0 ^ (b1 | b2);
+    e[23] = b1 ^ (b2 & b3);
+    e[25] = b2 ^ (~b3 & b4);
+    e[27] = ~b3 ^ (b4 | b0);
+    e[29] = b4 ^ (b0 & b1);
+
+    /* Output row 3, even bits */
+    b0 = ROL32(a[9] ^ d[9], 14u);
+    b1 = ROL32(a[10] ^ d[0], 18u);
+    b2 = ROL32(a[22] ^ d[2], 5u);
+    b3 = ROL32(a[35] ^ d[5], 8u);
+    b4 = ROL32(a[46] ^ d[6], 28u);
+    e[30] = b0 ^ (b1 & b2);
+    e[32] = b1 ^ (b2 | b3);
+    e[34] = b2 ^ (~b3 | b4);
+    e[36] = ~b3 ^ (b4 & b0);
+    e[38] = b4 ^ (b0 | b1);
+
+    /* Output row 3, odd bits */
+    b0 = ROL32(a[8] ^ d[8], 13u);
+    b1 = ROL32(a[11] ^ d[1], 18u);
+    b2 = ROL32(a[23] ^ d[3], 5u);
+    b3 = ROL32(a[34] ^ d[4], 7u);
+    b4 = ROL32(a[47] ^ d[7], 28u);
+    e[31] = b0 ^ (b1 & b2);
+    e[33] = b1 ^ (b2 | b3);
+    e[35] = b2 ^ (~b3 | b4);
+    e[37] = ~b3 ^ (b4 & b0);
+    e[39] = b4 ^ (b0 | b1);
+
+    /* Output row 4, even bits */
+    b0 = ROL32(a[4] ^ d[4], 31u);
+    b1 = ROL32(a[17] ^ d[7], 28u);
+    b2 = ROL32(a[29] ^ d[9], 20u);
+    b3 = ROL32(a[31] ^ d[1], 21u);
+    b4 = ROL32(a[42] ^ d[2], 1u);
+    e[40] = b0 ^ (~b1 & b2);
+    e[42] = ~b1 ^ (b2 | b3);
+    e[44] = b2 ^ (b3 & b4);
+    e[46] = b3 ^ (b4 | b0);
+    e[48] = b4 ^ (b0 & b1);
+
+    /* Output row 4, odd bits */
+    b0 = ROL32(a[5] ^ d[5], 31u);
+    b1 = ROL32(a[16] ^ d[6], 27u);
+    b2 = ROL32(a[28] ^ d[8], 19u);
+    b3 = ROL32(a[30] ^ d[0], 20u);
+    b4 = ROL32(a[43] ^ d[3], 1u);
+    e[41] = b0 ^ (~b1 & b2);
+    e[43] = ~b1 ^ (b2 | b3);
+    e[45] = b2 ^ (b3 & b4);
+    e[47] = b3 ^ (b4 | b0);
+    e[49] = b4 ^ (b0 & b1);
+
+}
+
+static void permute(uint32 *lane)
+{
+    uint32 temp[50];
+    uint32 round;
+
+    for (round = 0; round < KECCAK_ROUNDS; round += 2u)
+    {
+        permuteRound(temp, lane, g_keccakRoundConstant[round]);
+        permuteRound(lane, temp, g_keccakRoundConstant[round + 1u]);
+    }
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+void Keccak_Init(Keccak_t *ctx, uint32 rate)
+{
+    uint32 i;
+
+    for (i = 0; i < 25u; i++)
+    {
+        uint32 value = (((KECCAK_COMPLEMENTED_LANES >> i) & 1u) != 0u) ? 0xFFFFFFFFu : 0u;
+
+        ctx->lane[2u * i]      = value;
+        ctx->lane[2u * i + 1u] = value;
+    }
+    ctx->rate     = rate;
+    ctx->position = 0;
+}
+
+void Keccak_Absorb(Keccak_t *ctx, const uint8 *data, uint32 length)
+{
+    while (length > 0u)
+    {
+        if ((ctx->position % KECCAK_LANE_SIZE) == 0u && length >= KECCAK_LANE_SIZE)
+        {
+            xorLane(ctx->lane, ctx->position / KECCAK_LANE_SIZE, data);
+            ctx->position += KECCAK_LANE_SIZE;
+            data          += KECCAK_LANE_SIZE;
+            length        -= KECCAK_LANE_SIZE;
+        }
+        else
+        {
+            xorByte(ctx->lane, ctx->position++, *data++);
+            length--;
+        }
+
+        if (ctx->position == ctx->rate)
+        {
+            permute(ctx->lane);
+            ctx->position = 0;
+        }
+    }
+}
+
+void Keccak_Finalize(Keccak_t *ctx, uint8 suffix)
+{
+    xorByte(ctx->lane, ctx->position, suffix);
+    xorByte(ctx->lane, ctx->rate - 1u, 0x80);
+    permute(ctx->lane);
+    ctx->position = 0;
+}
+
+void Keccak_Squeeze(Keccak_t *ctx, uint8 *output, uint32 length)
+{
+    uint8  bytes[KECCAK_LANE_SIZE];
+    uint32 offset;
+    uint32 n;
+
+    while (length > 0u)
+    {
+        if (ctx->position == ctx->rate)
+        {
+            permute(ctx->lane);
+            ctx->position = 0;
+        }
+
+        offset = ctx->position % KECCAK_LANE_SIZE;
+        if (offset == 0u && length >= KECCAK_LANE_SIZE)
+        {
+            extractLane(ctx->lane, ctx->position / KECCAK_LANE_SIZE, output);
+            n = KECCAK_LANE_SIZE;
+        }
+        else
+        {
+            extractLane(ctx->lane, ctx->position / KECCAK_LANE_SIZE, bytes);
+            n = KECCAK_LANE_SIZE - offset;
+            if (n > length)
+                n = length;
+            memcpy(output, &bytes[offset], n);
+        }
+
+        ctx->position += n;
+        output        += n;
+        length        -= n;
+    }
+}
+
+void Keccak_SqueezeBlocks(Keccak_t *ctx, uint8 *output, uint32 blocks)
+{
+    uint32 i;
+
+    while (blocks-- > 0u)
+    {
+        if (ctx->position == ctx->rate)
+            permute(ctx->lane);
+
+        for (i = 0; i < ctx->rate / KECCAK_LANE_SIZE; i++)
+        {
+            extractLane(ctx->lane, i, output);
+            output += KECCAK_LANE_SIZE;
+        }
+        ctx->position = ctx->rate;
+    }
+}
+
+void Keccak_Sha3_256(const uint8 *data, uint32 length, uint8 *digest)
+{
+    Keccak_t ctx;
+
+    Keccak_Init(&ctx, KECCAK_RATE_SHA3_256);
+    Keccak_Absorb(&ctx, data, length);
+    Keccak_Finalize(&ctx, KECCAK_SUFFIX_SHA3);
+    Keccak_Squeeze(&ctx, digest, SHA3_256_DIGEST_SIZE);
+}
+
+void Keccak_Sha3_512(const uint8 *data, uint32 length, uint8 *digest)
+{
+    Keccak_t ctx;
+
+    Keccak_Init(&ctx, KECCAK_RATE_SHA3_512);
+    Keccak_Absorb(&ctx, data, length);
+    Keccak_Finalize(&ctx, KECCAK_SUFFIX_SHA3);
+    Keccak_Squeeze(&ctx, digest, SHA3_512_DIGEST_SIZE);
+}
@@ -0,0 +1,103 @@
+/**********************************************************************************************************************
+ * \file Keccak.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Keccak-f[1600] sponge (FIPS 202) with SHA3-256, SHA3-512, SHAKE128 and SHAKE256, used by ML-KEM.
+ * A sponge is initialized with its rate, absorbs any number of inputs, is finalized with the domain suffix of the
+ * function and then squeezed in as many calls as needed.
+ *
+ * The state is kept as 50 32-bit words with the even and odd bits of each 64-bit lane in separate words, so every
+ * 64-bit rotation is two native 32-bit rotations on TriCore, and six lanes are stored complemented to save most of
+ * the NOTs of chi. Keccak_SqueezeBlocks() returns whole blocks at once for the rejection samplers of ML-KEM and
+ * ML-DSA.
+ *********************************************************************************************************************/
+
+#ifndef KECCAK_H_
+#define KECCAK_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define KECCAK_RATE_SHAKE128                     168
+#define KECCAK_RATE_SHAKE256                     136
+#define KECCAK_RATE_SHA3_256                     136
+#define KECCAK_RATE_SHA3_512                     72
+#define KECCAK_SUFFIX_SHA3                       0x06
+#define KECCAK_SUFFIX_SHAKE                      0x1F
+#define SHA3_256_DIGEST_SIZE                     32
+#define SHA3_512_DIGEST_SIZE                     64
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 lane[50];                        /* Bit-interleaved, see Keccak.c */
+    uint32 rate;                            /* Bytes per block               */
+    uint32 position;                        /* Byte offset in the block      */
+} Keccak_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Start a new sponge
+ * \param ctx Sponge state
+ * \param rate Block size in bytes, one of KECCAK_RATE_*
+ */
+void Keccak_Init(Keccak_t *ctx, uint32 rate);
+
+/**
+ * \brief Absorb more input
+ * \param ctx Sponge state, not finalized
+ * \param data Input data
+ * \param length Number of bytes
+ */
+void Keccak_Absorb(Keccak_t *ctx, const uint8 *data, uint32 length);
+
+/**
+ * \brief Pad the input and switch to squeezing
+ * \param ctx Sponge state
+ * \param suffix KECCAK_SUFFIX_SHA3 or KECCAK_SUFFIX_SHAKE
+ */
+void Keccak_Finalize(Keccak_t *ctx, uint8 suffix);
+
+/**
+ * \brief Squeeze output, consecutive calls continue the output stream
+ * \param ctx Sponge state, finalized
+ * \param output Output buffer
+ * \param length Number of bytes
+ */
+void Keccak_Squeeze(Keccak_t *ctx, uint8 *output, uint32 length);
+
+/**
+ * \brief Squeeze whole blocks of rate bytes, faster than Keccak_Squeeze() for the same output
+ * \param ctx Sponge state, finalized and not squeezed yet or only squeezed in whole blocks
+ * \param output Output buffer of blocks * rate bytes
+ * \param blocks Number of blocks
+ */
+void Keccak_SqueezeBlocks(Keccak_t *ctx, uint8 *output, uint32 blocks);
+
+/**
+ * \brief SHA3-256 of a buffer
+ * \param data Input data
+ * \param length Number of bytes
+ * \param digest Output, SHA3_256_DIGEST_SIZE bytes
+ */
+void Keccak_Sha3_256(const uint8 *data, uint32 length, uint8 *digest);
+
+/**
+ * \brief SHA3-512 of a buffer
+ * \param data Input data
+ * \param length Number of bytes
+ * \param digest Output, SHA3_512_DIGEST_SIZE bytes
+ */
+void Keccak_Sha3_512(const uint8 *data, uint32 length, uint8 *digest);
+
+#endif /* KECCAK_H_ */
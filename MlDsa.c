@@ -0,0 +1,463 @@
+/**********************************************************************************************************************
+ * \file MlDsa.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * ML-DSA-44/65 verification implementation
+ *********************************************************************************************************************/
+
+#include "MlDsa.h"
+#include "Flash4_Driver.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define MLDSA_QINV                  58728449uL      /* q^-1 mod 2^32                               */
+#define MLDSA_INVNTT_SCALE          41978           /* 2^64 / 256 mod q                            */
+#define MLDSA_D                     13              /* Dropped bits of t                           */
+#define MLDSA_T1_BITS               10
+#define MLDSA_T1_BYTES              320
+#define MLDSA_TR_SIZE               64
+#define MLDSA_GAMMA2_88             ((MLDSA_Q - 1) / 88)
+#define MLDSA_PK_READ_SIZE          MLDSA_MAX_POLY_BYTES
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint8  k;                       /* Rows of A                                   */
+    uint8  l;                       /* Columns of A                                */
+    uint8  tau;                     /* Non-zero coefficients of c                  */
+    uint8  omega;                   /* Maximum number of hints                     */
+    uint8  zBits;                   /* Packed z coefficient, gamma1 = 2^(zBits-1)  */
+    uint8  w1Bits;                  /* Packed w1 coefficient                       */
+    uint8  challengeSize;           /* c~                                          */
+    uint32 beta;
+    sint32 gamma2;
+    uint32 publicKeySize;
+    uint32 signatureSize;
+} MlDsa_Params_t;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static const MlDsa_Params_t g_mlDsaParams[2] = {
+    {4u, 4u, 39u, 80u, 18u, 6u, 32u,  78u,  95232, MLDSA44_PUBLIC_KEY_SIZE, MLDSA44_SIGNATURE_SIZE},
+    {6u, 5u, 49u, 55u, 20u, 4u, 48u, 196u, 261888, MLDSA65_PUBLIC_KEY_SIZE, MLDSA65_SIGNATURE_SIZE}
+};
+
+/* 1753^bitrev8(i) * 2^32 mod q, centered */
+static const sint32 g_mlDsaZetas[MLDSA_N] = {
+           0,    25847, -2608894,  -518909,   237124,  -777960,  -876248,   466468,  1826347,  2353451,
+     -359251, -2091905,  3119733, -2884855,  3111497,  2680103,  2725464,  1024112, -1079900,  3585928,
+     -549488, -1119584,  2619752, -2108549, -2118186, -3859737, -1399561, -3277672,  1757237,   -19422,
+     4010497,   280005,  2706023,    95776,  3077325,  3530437, -1661693, -3592148, -2537516,  3915439,
+    -3861115, -3043716,  3574422, -2867647,  3539968,  -300467,  2348700,  -539299, -1699267, -1643818,
+     3505694, -3821735,  3507263, -2140649, -1600420,  3699596,   811944,   531354,   954230,  3881043,
+     3900724, -2556880,  2071892, -2797779, -3930395, -1528703, -3677745, -3041255, -1452451,  3475950,
+     2176455, -1585221, -1257611,  1939314, -4083598, -1000202, -3190144, -3157330, -3632928,   126922,
+     3412210,  -983419,  2147896,  2715295, -2967645, -3693493,  -411027, -2477047,  -671102, -1228525,
+      -22981, -1308169,  -381987,  1349076,  1852771, -1430430, -3343383,   264944,   508951,  3097992,
+       44288, -1100098,   904516,  3958618, -3724342,    -8578,  1653064, -3249728,  2389356,  -210977,
+      759969, -1316856,   189548, -3553272,  3159746, -1851402, -2409325,  -177440,  1315589,  1341330,
+     1285669, -1584928,  -812732, -1439742, -3019102, -3881060, -3628969,  3839961,  2091667,  3407706,
+     2316500,  3817976, -3342478,  2244091, -2446433, -3562462,   266997,  2434439, -1235728,  3513181,
+    -3520352, -3759364, -1197226, -3193378,   900702,  1859098,   909542,   819034,   495491, -1613174,
+      -43260,  -522500,  -655327, -3122442,  2031748,  3207046, -3556995,  -525098,  -768622, -3595838,
+      342297,   286988, -2437823,  4108315,  3437287, -3342277,  1735879,   203044,  2842341,  2691481,
+    -2590150,  1265009,  4055324,  1247620,  2486353,  1595974, -3767016,  1250494,  2635921, -3548272,
+    -2994039,  1869119,  1903435, -1050970, -1333058,  1237275, -3318210, -1430225,  -451100,  1312455,
+     3306115, -1962642, -1279661,  1917081, -2546312, -1374803,  1500165,   777191,  2235880,  3406031,
+     -542412, -2831860, -1671176, -1846953, -2584293, -3724270,   594136, -3776993, -2013608,  2432395,
+     2454455,  -164721,  1957272,  3369112,   185531, -1207385, -3183426,   162844,  1616392,  3014001,
+      810149,  1652634, -3694233, -1799107, -3038916,  3523897,  3866901,   269760,  2213111,  -975884,
+     1717735,   472078,  -426683,  1723600, -1803090,  1910376, -1667432, -1104333,  -260646, -3833893,
+    -2939036, -2235985,  -420899, -2286327,   183443,  -976891,  1612842, -3545687,  -554416,  3919660,
+      -48306, -1362209,  3937738,  1400424,  -846154,  1976782
+};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* a * 2^-32 mod q for |a| < q * 2^31, result in (-q, q) */
+static sint32 montgomeryReduce(sint64 a)
+{
+    sint32 t = (sint32)((uint32)a * MLDSA_QINV);
+
+    return (sint32)((a - (sint64)t * MLDSA_Q) >> 32);
+}
+
+/* a mod q in about (-q/2, q/2] for |a| < 2^31 - 2^22 */
+static sint32 reduce32(sint32 a)
+{
+    sint32 t = (a + (1 << 22)) >> 23;
+
+    return a - t * MLDSA_Q;
+}
+
+/* Forward NTT, output in bit-reversed order and not reduced, each layer adds at most q */
+static void ntt(sint32 *a)
+{
+    uint32 len;
+    uint32 start;
+    uint32 j;
+    uint32 k = 0;
+    sint32 zeta;
+    sint32 t;
+
+    for (len = 128; len > 0u; len >>= 1)
+    {
+        for (start = 0; start < MLDSA_N; start += 2u * len)
+        {
+            zeta = g_mlDsaZetas[++k];
+            for (j = start; j < start + len; j++)
+            {
+                t          = montgomeryReduce((sint64)zeta * a[j + len]);
+                a[j + len] = a[j] - t;
+                a[j]       = a[j] + t;
+            }
+        }
+    }
+}
+
+/* Inverse NTT, also multiplies by 2^32 so a Montgomery product comes out in the normal domain */
+static void invNtt(sint32 *a)
+{
+    uint32 len;
+    uint32 start;
+    uint32 j;
+    uint32 k = MLDSA_N;
+    sint32 zeta;
+    sint32 t;
+
+    for (len = 1; len < MLDSA_N; len <<= 1)
+    {
+        for (start = 0; start < MLDSA_N; start += 2u * len)
+        {
+            zeta = -g_mlDsaZetas[--k];
+            for (j = start; j < start + len; j++)
+            {
+                t          = a[j];
+                a[j]       = t + a[j + len];
+                a[j + len] = montgomeryReduce((sint64)zeta * (t - a[j + len]));
+            }
+        }
+    }
+
+    for (j = 0; j < MLDSA_N; j++)
+        a[j] = montgomeryReduce((sint64)MLDSA_INVNTT_SCALE * a[j]);
+}
+
+/* Unpack 256 values of the given width, little endian */
+static void decode(sint32 *values, const uint8 *in, uint32 bits)
+{
+    uint32 acc = 0;
+    uint32 fill = 0;
+    uint32 i;
+
+    for (i = 0; i < MLDSA_N; i++)
+    {
+        while (fill < bits)
+        {
+            acc  |= (uint32)*in++ << fill;
+            fill += 8u;
+        }
+        values[i] = (sint32)(acc & ((1uL << bits) - 1u));
+        acc     >>= bits;
+        fill     -= bits;
+    }
+}
+
+static void encode(uint8 *out, const sint32 *values, uint32 bits)
+{
+    uint32 acc = 0;
+    uint32 fill = 0;
+    uint32 i;
+
+    for (i = 0; i < MLDSA_N; i++)
+    {
+        acc  |= (uint32)values[i] << fill;
+        fill += bits;
+        while (fill >= 8u)
+        {
+            *out++ = (uint8)acc;
+            acc >>= 8;
+            fill -= 8u;
+        }
+    }
+}
+
+/* Read one packed polynomial from Flash4 into ws->poly */
+static void readPoly(MlDsa_Workspace_t *ws, uint32 address, uint32 bits)
+{
+    Flash4_ReadBuffer(ws->buffer, address, bits * (MLDSA_N / 8u));
+    decode(ws->poly, ws->buffer, bits);
+}
+
+/* tr = H(pk), the public key is hashed straight from Flash4 */
+static void hashPublicKey(MlDsa_Workspace_t *ws, uint32 address, uint32 length, uint8 *tr)
+{
+    uint32 n;
+
+    Keccak_Init(&ws->keccak, KECCAK_RATE_SHAKE256);
+    while (length > 0u)
+    {
+        n = (length < MLDSA_PK_READ_SIZE) ? length : MLDSA_PK_READ_SIZE;
+        Flash4_ReadBuffer(ws->buffer, address, n);
+        Keccak_Absorb(&ws->keccak, ws->buffer, n);
+        address += n;
+        length  -= n;
+    }
+    Keccak_Finalize(&ws->keccak, KECCAK_SUFFIX_SHAKE);
+    Keccak_Squeeze(&ws->keccak, tr, MLDSA_TR_SIZE);
+}
+
+/* HintBitUnpack without the bits: indices strictly increasing per row, row ends monotonic, unused slots zero */
+static boolean checkHint(const uint8 *hint, const MlDsa_Params_t *params)
+{
+    uint32 index = 0;
+    uint32 end;
+    uint32 row;
+    uint32 j;
+
+    for (row = 0; row < params->k; row++)
+    {
+        end = hint[params->omega + row];
+        if (end < index || end > params->omega)
+            return FALSE;
+        for (j = index + 1u; j < end; j++)
+        {
+            if (hint[j] <= hint[j - 1u])
+                return FALSE;
+        }
+        index = end;
+    }
+
+    for (j = index; j < params->omega; j++)
+    {
+        if (hint[j] != 0u)
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+/* SampleInBall(c~) into ws->challenge */
+static void sampleChallenge(MlDsa_Workspace_t *ws, const MlDsa_Params_t *params)
+{
+    uint64 signs = 0;
+    uint32 position = 8;
+    uint32 i;
+    uint32 b;
+
+    Keccak_Init(&ws->keccak, KECCAK_RATE_SHAKE256);
+    Keccak_Absorb(&ws->keccak, ws->challengeSeed, params->challengeSize);
+    Keccak_Finalize(&ws->keccak, KECCAK_SUFFIX_SHAKE);
+    Keccak_SqueezeBlocks(&ws->keccak, ws->buffer, 1u);
+
+    for (i = 0; i < 8u; i++)
+        signs |= (uint64)ws->buffer[i] << (8u * i);
+    for (i = 0; i < MLDSA_N; i++)
+        ws->challenge[i] = 0;
+
+    for (i = MLDSA_N - params->tau; i < MLDSA_N; i++)
+    {
+        do
+        {
+            if (position >= KECCAK_RATE_SHAKE256)
+            {
+                Keccak_SqueezeBlocks(&ws->keccak, ws->buffer, 1u);
+                position = 0;
+            }
+            b = ws->buffer[position++];
+        } while (b > i);
+
+        ws->challenge[i] = ws->challenge[b];
+        ws->challenge[b] = 1 - 2 * (sint32)(signs & 1u);
+        signs          >>= 1;
+    }
+}
+
+/* accumulator += A[row][column] * poly, the entry RejNTTPoly(rho || column || row) is used as it is sampled */
+static void multiplyUniform(MlDsa_Workspace_t *ws, uint8 row, uint8 column)
+{
+    uint8  index[2];
+    uint32 count = 0;
+    uint32 i;
+    uint32 t;
+
+    index[0] = column;
+    index[1] = row;
+    Keccak_Init(&ws->keccak, KECCAK_RATE_SHAKE128);
+    Keccak_Absorb(&ws->keccak, ws->rho, 32u);
+    Keccak_Absorb(&ws->keccak, index, 2u);
+    Keccak_Finalize(&ws->keccak, KECCAK_SUFFIX_SHAKE);
+
+    while (count < MLDSA_N)
+    {
+        Keccak_SqueezeBlocks(&ws->keccak, ws->buffer, 1u);
+        for (i = 0; i < KECCAK_RATE_SHAKE128 && count < MLDSA_N; i += 3u)
+        {
+            t = ws->buffer[i] | ((uint32)ws->buffer[i + 1u] << 8) | ((uint32)(ws->buffer[i + 2u] & 0x7Fu) << 16);
+            if (t < (uint32)MLDSA_Q)
+            {
+                ws->accumulator[count] += montgomeryReduce((sint64)t * ws->poly[count]);
+                count++;
+            }
+        }
+    }
+}
+
+/* UseHint for a coefficient in [0, q) */
+static sint32 useHint(sint32 a, boolean hint, sint32 gamma2)
+{
+    sint32 a0;
+    sint32 a1 = (a + 127) >> 7;
+    sint32 top;
+
+    /* Decompose, the divisions by 2 * gamma2 as multiplications */
+    if (gamma2 == MLDSA_GAMMA2_88)
+    {
+        a1  = (a1 * 11275 + (1 << 23)) >> 24;
+        a1 ^= ((43 - a1) >> 31) & a1;
+        top = 43;
+    }
+    else
+    {
+        a1  = ((a1 * 1025 + (1 << 21)) >> 22) & 15;
+        top = 15;
+    }
+    a0  = a - a1 * 2 * gamma2;
+    a0 -= (((MLDSA_Q - 1) / 2 - a0) >> 31) & MLDSA_Q;
+
+    if (!hint)
+        return a1;
+    if (a0 > 0)
+        return (a1 == top) ? 0 : a1 + 1;
+
+    return (a1 == 0) ? top : a1 - 1;
+}
+
+/*
+ * Row w1[row] of UseHint(h, A * z - c * t1 * 2^d), absorbed into the commitment hash. z is read again from the
+ * signature for every row. The z norm is checked on the first row, FALSE if it is too large.
+ */
+static boolean commitRow(MlDsa_Workspace_t *ws, const MlDsa_Params_t *params, uint32 row, uint32 publicKeyAddress,
+                         uint32 signatureAddress)
+{
+    sint32 gamma1 = (sint32)1 << (params->zBits - 1u);
+    sint32 bound  = gamma1 - (sint32)params->beta;
+    uint32 zBytes = params->zBits * (MLDSA_N / 8u);
+    uint32 start  = (row == 0u) ? 0u : ws->hint[params->omega + row - 1u];
+    uint32 end    = ws->hint[params->omega + row];
+    uint32 column;
+    uint32 i;
+    boolean hinted;
+
+    for (i = 0; i < MLDSA_N; i++)
+        ws->accumulator[i] = 0;
+
+    for (column = 0; column < params->l; column++)
+    {
+        readPoly(ws, signatureAddress + params->challengeSize + column * zBytes, params->zBits);
+        for (i = 0; i < MLDSA_N; i++)
+        {
+            ws->poly[i] = gamma1 - ws->poly[i];
+            if (row == 0u && (ws->poly[i] >= bound || ws->poly[i] <= -bound))
+                return FALSE;
+        }
+        ntt(ws->poly);
+        multiplyUniform(ws, (uint8)row, (uint8)column);
+    }
+
+    readPoly(ws, publicKeyAddress + 32u + row * MLDSA_T1_BYTES, MLDSA_T1_BITS);
+    for (i = 0; i < MLDSA_N; i++)
+        ws->poly[i] <<= MLDSA_D;
+    ntt(ws->poly);
+
+    for (i = 0; i < MLDSA_N; i++)
+        ws->accumulator[i] = reduce32(ws->accumulator[i] - montgomeryReduce((sint64)ws->challenge[i] * ws->poly[i]));
+    invNtt(ws->accumulator);
+
+    /* The hint indices of a row are increasing, so they are consumed in order */
+    for (i = 0; i < MLDSA_N; i++)
+    {
+        sint32 a = ws->accumulator[i] + ((ws->accumulator[i] >> 31) & MLDSA_Q);
+
+        hinted = (start < end && ws->hint[start] == i) ? TRUE : FALSE;
+        if (hinted)
+            start++;
+        ws->poly[i] = useHint(a, hinted, params->gamma2);
+    }
+
+    encode(ws->buffer, ws->poly, params->w1Bits);
+    Keccak_Absorb(&ws->commitment, ws->buffer, params->w1Bits * (MLDSA_N / 8u));
+
+    return TRUE;
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+uint32 MlDsa_GetPublicKeySize(MlDsa_Level level)
+{
+    return g_mlDsaParams[level].publicKeySize;
+}
+
+uint32 MlDsa_GetSignatureSize(MlDsa_Level level)
+{
+    return g_mlDsaParams[level].signatureSize;
+}
+
+boolean MlDsa_Verify(MlDsa_Workspace_t *ws, MlDsa_Level level, uint32 publicKeyAddress, uint32 signatureAddress,
+                     const uint8 *context, uint32 contextLength, const uint8 *message, uint32 messageLength)
+{
+    const MlDsa_Params_t *params = &g_mlDsaParams[level];
+    uint8                 prefix[2];
+    uint32                row;
+    uint32                i;
+    uint8                 diff = 0;
+
+    if (contextLength > MLDSA_MAX_CONTEXT_SIZE)
+        return FALSE;
+
+    /* c~ and the hints are small enough to keep, z and t1 stay in Flash4 */
+    Flash4_ReadBuffer(ws->challengeSeed, signatureAddress, params->challengeSize);
+    Flash4_ReadBuffer(ws->hint, signatureAddress + params->signatureSize - params->omega - params->k,
+                      (uint32)params->omega + params->k);
+    if (!checkHint(ws->hint, params))
+        return FALSE;
+    Flash4_ReadBuffer(ws->rho, publicKeyAddress, 32u);
+
+    /* mu = H(H(pk) || 0 || |ctx| || ctx || M) */
+    hashPublicKey(ws, publicKeyAddress, params->publicKeySize, ws->mu);
+    prefix[0] = 0;
+    prefix[1] = (uint8)contextLength;
+    Keccak_Init(&ws->keccak, KECCAK_RATE_SHAKE256);
+    Keccak_Absorb(&ws->keccak, ws->mu, MLDSA_TR_SIZE);
+    Keccak_Absorb(&ws->keccak, prefix, 2u);
+    Keccak_Absorb(&ws->keccak, context, contextLength);
+    Keccak_Absorb(&ws->keccak, message, messageLength);
+    Keccak_Finalize(&ws->keccak, KECCAK_SUFFIX_SHAKE);
+    Keccak_Squeeze(&ws->keccak, ws->mu, MLDSA_MU_SIZE);
+
+    sampleChallenge(ws, params);
+    ntt(ws->challenge);
+
+    Keccak_Init(&ws->commitment, KECCAK_RATE_SHAKE256);
+    Keccak_Absorb(&ws->commitment, ws->mu, MLDSA_MU_SIZE);
+    for (row = 0; row < params->k; row++)
+    {
+        if (!commitRow(ws, params, row, publicKeyAddress, signatureAddress))
+            return FALSE;
+    }
+    Keccak_Finalize(&ws->commitment, KECCAK_SUFFIX_SHAKE);
+    Keccak_Squeeze(&ws->commitment, ws->buffer, params->challengeSize);
+
+    for (i = 0; i < params->challengeSize; i++)
+        diff |= (uint8)(ws->buffer[i] ^ ws->challengeSeed[i]);
+
+    return (diff == 0u) ? TRUE : FALSE;
+}
@@ -0,0 +1,99 @@
+/**********************************************************************************************************************
+ * \file MlDsa.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * ML-DSA-44/65 signature verification (FIPS 204) for OTA manifests, with the public key and the signature read
+ * from Flash4 while they are used. Only the challenge, the hint indices and one packed polynomial are held at a
+ * time, so the whole verification runs in the MlDsa_Workspace_t (about 4.3 KB) plus a few hundred bytes of stack,
+ * independent of the parameter set.
+ *
+ * The product A * z is built one row at a time: each matrix entry is sampled from SHAKE128 and multiplied into
+ * the row as its coefficients come out, without being stored, and the packed z is read again for every row
+ * instead of keeping l polynomials in RAM. The finished row goes through UseHint and is absorbed into the
+ * challenge hash right away. Coefficients are 32-bit with Montgomery reduction, so every product is a single
+ * 32x32 bit multiplication with a 64-bit result on the TriCore.
+ *
+ * Verification only handles public data, it is not constant-time.
+ *********************************************************************************************************************/
+
+#ifndef MLDSA_H_
+#define MLDSA_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Keccak.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define MLDSA_N                                  256
+#define MLDSA_Q                                  8380417
+#define MLDSA_MU_SIZE                            64          /* Message representative mu                      */
+#define MLDSA_MAX_CHALLENGE_SIZE                 48          /* c~ of ML-DSA-65                                */
+#define MLDSA_MAX_HINT_SIZE                      84          /* omega + k of ML-DSA-44                         */
+#define MLDSA_MAX_POLY_BYTES                     640         /* z of ML-DSA-65, 20-bit coefficients            */
+#define MLDSA_MAX_CONTEXT_SIZE                   255
+#define MLDSA44_PUBLIC_KEY_SIZE                  1312
+#define MLDSA44_SIGNATURE_SIZE                   2420
+#define MLDSA65_PUBLIC_KEY_SIZE                  1952
+#define MLDSA65_SIGNATURE_SIZE                   3309
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef enum
+{
+    MlDsa_Level_44 = 0,             /* NIST category 2 */
+    MlDsa_Level_65                  /* NIST category 3 */
+} MlDsa_Level;
+
+typedef struct
+{
+    sint32   accumulator[MLDSA_N];              /* Row of A * z - c * t1 * 2^d                     */
+    sint32   poly[MLDSA_N];                     /* z or t1 entry being multiplied                  */
+    sint32   challenge[MLDSA_N];                /* c in the NTT domain                             */
+    uint8    buffer[MLDSA_MAX_POLY_BYTES];      /* Packed polynomial read from Flash4              */
+    uint8    challengeSeed[MLDSA_MAX_CHALLENGE_SIZE];
+    uint8    hint[MLDSA_MAX_HINT_SIZE];         /* Hint indices and the row ends                   */
+    uint8    rho[32];
+    uint8    mu[MLDSA_MU_SIZE];
+    Keccak_t keccak;                            /* Samplers                                        */
+    Keccak_t commitment;                        /* H(mu || w1Encode(w1)), fed row by row           */
+} MlDsa_Workspace_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Public key size of a parameter set
+ * \param level Parameter set
+ * \return MLDSA44_PUBLIC_KEY_SIZE or MLDSA65_PUBLIC_KEY_SIZE
+ */
+uint32 MlDsa_GetPublicKeySize(MlDsa_Level level);
+
+/**
+ * \brief Signature size of a parameter set
+ * \param level Parameter set
+ * \return MLDSA44_SIGNATURE_SIZE or MLDSA65_SIGNATURE_SIZE
+ */
+uint32 MlDsa_GetSignatureSize(MlDsa_Level level);
+
+/**
+ * \brief Verify a pure ML-DSA signature, the public key and the signature are read from Flash4
+ * \param ws Workspace
+ * \param level Parameter set of the key
+ * \param publicKeyAddress Flash4 address of the encoded public key
+ * \param signatureAddress Flash4 address of the encoded signature
+ * \param context Context string of the signer, may be NULL_PTR if contextLength is 0
+ * \param contextLength Up to MLDSA_MAX_CONTEXT_SIZE bytes
+ * \param message Signed message, e.g. the manifest header
+ * \param messageLength Number of bytes
+ * \return TRUE if the signature is valid, FALSE otherwise
+ */
+boolean MlDsa_Verify(MlDsa_Workspace_t *ws, MlDsa_Level level, uint32 publicKeyAddress, uint32 signatureAddress,
+                     const uint8 *context, uint32 contextLength, const uint8 *message, uint32 messageLength);
+
+#endif /* MLDSA_H_ */
@@ -0,0 +1,500 @@
+/**********************************************************************************************************************
+ * \file MlKem.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * ML-KEM-768 implementation
+ *********************************************************************************************************************/
+
+#include "MlKem.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define MLKEM_QINV                  (-3327)         /* q^-1 mod 2^16                               */
+#define MLKEM_BARRETT_V             20159           /* round(2^26 / q)                             */
+#define MLKEM_MONT_SQUARE           1353            /* 2^32 mod q, fqmul() by it converts to 2^16  */
+#define MLKEM_INVNTT_SCALE          1441            /* 2^32 / 128 mod q                            */
+#define MLKEM_DIV_Q                 2642262849uL    /* ceil(2^43 / q)                              */
+#define MLKEM_ETA_BYTES             128             /* CBD with eta = 2                            */
+#define MLKEM_HASH_OFFSET           (2u * MLKEM_K * MLKEM_POLY_BYTES + 32u)
+#define MLKEM_Z_OFFSET              (MLKEM_HASH_OFFSET + 32u)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* 17^bitrev7(i) * 2^16 mod q, centered */
+static const sint16 g_mlkemZetas[128] = {
+    -1044,  -758,  -359, -1517,  1493,  1422,   287,   202,  -171,   622,  1577,   182,   962, -1202, -1474,  1468,
+      573, -1325,   264,   383,  -829,  1458, -1602,  -130,  -681,  1017,   732,   608, -1542,   411,  -205, -1571,
+     1223,   652,  -552,  1015, -1293,  1491,  -282, -1544,   516,    -8,  -320,  -666, -1618, -1162,   126,  1469,
+     -853,   -90,  -271,   830,   107, -1421,  -247,  -951,  -398,   961, -1508,  -725,   448, -1065,   677, -1275,
+    -1103,   430,   555,   843, -1251,   871,  1550,   105,   422,   587,   177,  -235,  -291,  -460,  1574,  1653,
+     -246,   778,  1159,  -147,  -777,  1483,  -602,  1119, -1590,   644,  -872,   349,   418,   329,  -156,   -75,
+      817,  1097,   603,   610,  1322, -1285, -1465,   384, -1215,  -136,  1218, -1335,  -874,   220, -1187, -1659,
+    -1185, -1530, -1278,   794, -1510,  -854,  -870,   478,  -108,  -308,   996,   991,   958, -1460,  1522,  1628
+};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* a * 2^-16 mod q for |a| < q * 2^15, result in (-q, q) */
+static sint16 montgomeryReduce(sint32 a)
+{
+    sint16 t = (sint16)((sint16)a * MLKEM_QINV);
+
+    return (sint16)((a - (sint32)t * MLKEM_Q) >> 16);
+}
+
+/* a mod q, centered */
+static sint16 barrettReduce(sint16 a)
+{
+    sint16 t = (sint16)(((sint32)MLKEM_BARRETT_V * a + (1 << 25)) >> 26);
+
+    return (sint16)(a - t * MLKEM_Q);
+}
+
+static sint16 fqmul(sint16 a, sint16 b)
+{
+    return montgomeryReduce((sint32)a * b);
+}
+
+static void reducePoly(sint16 *poly)
+{
+    uint32 i;
+
+    for (i = 0; i < MLKEM_N; i++)
+        poly[i] = barrettReduce(poly[i]);
+}
+
+static void addPoly(sint16 *r, const sint16 *a)
+{
+    uint32 i;
+
+    for (i = 0; i < MLKEM_N; i++)
+        r[i] = (sint16)(r[i] + a[i]);
+}
+
+/* Forward NTT, output in bit-reversed order and bounded by 7q */
+static void ntt(sint16 *r)
+{
+    uint32 len;
+    uint32 start;
+    uint32 j;
+    uint32 k = 1;
+    sint16 zeta;
+    sint16 t;
+
+    for (len = 128; len >= 2u; len >>= 1)
+    {
+        for (start = 0; start < MLKEM_N; start += 2u * len)
+        {
+            zeta = g_mlkemZetas[k++];
+            for (j = start; j < start + len; j++)
+            {
+                t          = fqmul(zeta, r[j + len]);
+                r[j + len] = (sint16)(r[j] - t);
+                r[j]       = (sint16)(r[j] + t);
+            }
+        }
+    }
+
+    reducePoly(r);
+}
+
+/* Inverse NTT, also multiplies by 2^16 so a Montgomery product comes out in the normal domain */
+static void invNtt(sint16 *r)
+{
+    uint32 len;
+    uint32 start;
+    uint32 j;
+    uint32 k = 127;
+    sint16 zeta;
+    sint16 t;
+
+    for (len = 2; len <= 128u; len <<= 1)
+    {
+        for (start = 0; start < MLKEM_N; start += 2u * len)
+        {
+            zeta = g_mlkemZetas[k--];
+            for (j = start; j < start + len; j++)
+            {
+                t          = r[j];
+                r[j]       = barrettReduce((sint16)(t + r[j + len]));
+                r[j + len] = fqmul(zeta, (sint16)(r[j + len] - t));
+            }
+        }
+    }
+
+    for (j = 0; j < MLKEM_N; j++)
+        r[j] = fqmul(r[j], MLKEM_INVNTT_SCALE);
+}
+
+/* r += a * b in the NTT domain, as products of degree one polynomials modulo X^2 - zeta */
+static void multiplyAccumulate(sint16 *r, const sint16 *a, const sint16 *b)
+{
+    uint32 i;
+    sint16 zeta;
+
+    for (i = 0; i < MLKEM_N / 4u; i++)
+    {
+        const sint16 *x = &a[4u * i];
+        const sint16 *y = &b[4u * i];
+        sint16       *z = &r[4u * i];
+
+        zeta  = g_mlkemZetas[64u + i];
+        z[0] += (sint16)(fqmul(fqmul(x[1], y[1]), zeta) + fqmul(x[0], y[0]));
+        z[1] += (sint16)(fqmul(x[0], y[1]) + fqmul(x[1], y[0]));
+        z[2] += (sint16)(fqmul(fqmul(x[3], y[3]), (sint16)-zeta) + fqmul(x[2], y[2]));
+        z[3] += (sint16)(fqmul(x[2], y[3]) + fqmul(x[3], y[2]));
+    }
+}
+
+/* Reduced coefficient to [0, q) */
+static sint16 canonical(sint16 a)
+{
+    return (sint16)(a + ((a >> 15) & MLKEM_Q));
+}
+
+/* round(2^bits / q * a) mod 2^bits, with a multiplication instead of a secret dependent division */
+static uint16 compress(sint16 a, uint32 bits)
+{
+    uint32 x = ((uint32)canonical(a) << bits) + (MLKEM_Q - 1u) / 2u;
+
+    return (uint16)(((uint64)x * MLKEM_DIV_Q) >> 43) & (uint16)((1u << bits) - 1u);
+}
+
+static sint16 decompress(uint32 y, uint32 bits)
+{
+    return (sint16)((y * MLKEM_Q + (1u << (bits - 1u))) >> bits);
+}
+
+/* Pack 256 values of the given width little endian, as ByteEncode */
+static void encode(uint8 *out, const sint16 *values, uint32 bits)
+{
+    uint32 acc = 0;
+    uint32 fill = 0;
+    uint32 i;
+
+    for (i = 0; i < MLKEM_N; i++)
+    {
+        acc  |= (uint32)(uint16)values[i] << fill;
+        fill += bits;
+        while (fill >= 8u)
+        {
+            *out++ = (uint8)acc;
+            acc >>= 8;
+            fill -= 8u;
+        }
+    }
+}
+
+static void decode(sint16 *values, const uint8 *in, uint32 bits)
+{
+    uint32 acc = 0;
+    uint32 fill = 0;
+    uint32 i;
+
+    for (i = 0; i < MLKEM_N; i++)
+    {
+        while (fill < bits)
+        {
+            acc  |= (uint32)*in++ << fill;
+            fill += 8u;
+        }
+        values[i] = (sint16)(acc & ((1u << bits) - 1u));
+        acc     >>= bits;
+        fill     -= bits;
+    }
+}
+
+static void encodePoly(uint8 *out, sint16 *poly)
+{
+    uint32 i;
+
+    for (i = 0; i < MLKEM_N; i++)
+        poly[i] = canonical(poly[i]);
+    encode(out, poly, 12u);
+}
+
+static void compressPoly(uint8 *out, sint16 *poly, uint32 bits)
+{
+    uint32 i;
+
+    for (i = 0; i < MLKEM_N; i++)
+        poly[i] = (sint16)compress(poly[i], bits);
+    encode(out, poly, bits);
+}
+
+static void decompressPoly(sint16 *poly, const uint8 *in, uint32 bits)
+{
+    uint32 i;
+
+    decode(poly, in, bits);
+    for (i = 0; i < MLKEM_N; i++)
+        poly[i] = decompress((uint32)poly[i], bits);
+}
+
+/* Matrix entry SampleNTT(rho || x || y), uniform by rejection from SHAKE128 */
+static void sampleUniform(MlKem_Workspace_t *ws, sint16 *poly, const uint8 *rho, uint8 x, uint8 y)
+{
+    uint8  index[2];
+    uint32 count = 0;
+    uint32 i;
+
+    index[0] = x;
+    index[1] = y;
+    Keccak_Init(&ws->keccak, KECCAK_RATE_SHAKE128);
+    Keccak_Absorb(&ws->keccak, rho, 32u);
+    Keccak_Absorb(&ws->keccak, index, 2u);
+    Keccak_Finalize(&ws->keccak, KECCAK_SUFFIX_SHAKE);
+
+    while (count < MLKEM_N)
+    {
+        Keccak_SqueezeBlocks(&ws->keccak, ws->buffer, 1u);
+        for (i = 0; i < KECCAK_RATE_SHAKE128 && count < MLKEM_N; i += 3u)
+        {
+            uint16 d1 = (uint16)(ws->buffer[i] | ((uint16)(ws->buffer[i + 1u] & 0x0Fu) << 8));
+            uint16 d2 = (uint16)((ws->buffer[i + 1u] >> 4) | ((uint16)ws->buffer[i + 2u] << 4));
+
+            if (d1 < MLKEM_Q)
+                poly[count++] = (sint16)d1;
+            if (d2 < MLKEM_Q && count < MLKEM_N)
+                poly[count++] = (sint16)d2;
+        }
+    }
+}
+
+/* Noise polynomial SamplePolyCBD_2(PRF(seed, nonce)) */
+static void sampleNoise(MlKem_Workspace_t *ws, sint16 *poly, const uint8 *seed, uint8 nonce)
+{
+    uint32 i;
+
+    Keccak_Init(&ws->keccak, KECCAK_RATE_SHAKE256);
+    Keccak_Absorb(&ws->keccak, seed, 32u);
+    Keccak_Absorb(&ws->keccak, &nonce, 1u);
+    Keccak_Finalize(&ws->keccak, KECCAK_SUFFIX_SHAKE);
+    Keccak_Squeeze(&ws->keccak, ws->buffer, MLKEM_ETA_BYTES);
+
+    /* Each nibble is one coefficient: (b0 + b1) - (b2 + b3) */
+    for (i = 0; i < MLKEM_ETA_BYTES; i++)
+    {
+        uint32 b = ws->buffer[i];
+        uint32 s = (b & 0x55u) + ((b >> 1) & 0x55u);
+
+        poly[2u * i]      = (sint16)((sint32)(s & 3u) - (sint32)((s >> 2) & 3u));
+        poly[2u * i + 1u] = (sint16)((sint32)((s >> 4) & 3u) - (sint32)((s >> 6) & 3u));
+    }
+}
+
+/* SHA3-512(a || b) */
+static void hashG(MlKem_Workspace_t *ws, const uint8 *a, uint32 aLength, const uint8 *b, uint32 bLength,
+                  uint8 *digest)
+{
+    Keccak_Init(&ws->keccak, KECCAK_RATE_SHA3_512);
+    Keccak_Absorb(&ws->keccak, a, aLength);
+    Keccak_Absorb(&ws->keccak, b, bLength);
+    Keccak_Finalize(&ws->keccak, KECCAK_SUFFIX_SHA3);
+    Keccak_Squeeze(&ws->keccak, digest, SHA3_512_DIGEST_SIZE);
+}
+
+/* SHA3-256 */
+static void hashH(MlKem_Workspace_t *ws, const uint8 *data, uint32 length, uint8 *digest)
+{
+    Keccak_Init(&ws->keccak, KECCAK_RATE_SHA3_256);
+    Keccak_Absorb(&ws->keccak, data, length);
+    Keccak_Finalize(&ws->keccak, KECCAK_SUFFIX_SHA3);
+    Keccak_Squeeze(&ws->keccak, digest, SHA3_256_DIGEST_SIZE);
+}
+
+/*
+ * K-PKE.Encrypt. Writes the ciphertext, or with a reference compares each compressed polynomial against it
+ * instead; the result is then non-zero if they differ.
+ */
+static uint8 encrypt(MlKem_Workspace_t *ws, const uint8 *publicKey, const uint8 *message, const uint8 *coins,
+                     uint8 *ciphertext, const uint8 *reference)
+{
+    const uint8 *rho = &publicKey[MLKEM_K * MLKEM_POLY_BYTES];
+    uint8        diff = 0;
+    uint8       *out;
+    uint32       i;
+    uint32       j;
+
+    for (i = 0; i < MLKEM_K; i++)
+    {
+        sampleNoise(ws, ws->vector[i], coins, (uint8)i);
+        ntt(ws->vector[i]);
+    }
+
+    /* u = NTT^-1(A^T y) + e1, row by row; v = NTT^-1(t^T y) + e2 + m as the last row */
+    for (i = 0; i <= MLKEM_K; i++)
+    {
+        uint32 bits   = (i < MLKEM_K) ? 10u : 4u;
+        uint32 length = (i < MLKEM_K) ? MLKEM_POLY_BYTES_DU : MLKEM_POLY_BYTES_DV;
+
+        memset(ws->accumulator, 0, sizeof(ws->accumulator));
+        for (j = 0; j < MLKEM_K; j++)
+        {
+            if (i < MLKEM_K)
+                sampleUniform(ws, ws->poly, rho, (uint8)i, (uint8)j);
+            else
+                decode(ws->poly, &publicKey[j * MLKEM_POLY_BYTES], 12u);
+            multiplyAccumulate(ws->accumulator, ws->poly, ws->vector[j]);
+        }
+        invNtt(ws->accumulator);
+
+        sampleNoise(ws, ws->poly, coins, (uint8)(MLKEM_K + i));
+        addPoly(ws->accumulator, ws->poly);
+
+        if (i == MLKEM_K)
+        {
+            for (j = 0; j < MLKEM_N; j++)
+                ws->poly[j] = (sint16)(-(sint16)((message[j / 8u] >> (j % 8u)) & 1u) & ((MLKEM_Q + 1) / 2));
+            addPoly(ws->accumulator, ws->poly);
+        }
+        reducePoly(ws->accumulator);
+
+        out = (reference != NULL_PTR) ? ws->buffer : &ciphertext[i * MLKEM_POLY_BYTES_DU];
+        compressPoly(out, ws->accumulator, bits);
+
+        if (reference != NULL_PTR)
+        {
+            for (j = 0; j < length; j++)
+                diff |= (uint8)(out[j] ^ reference[i * MLKEM_POLY_BYTES_DU + j]);
+        }
+    }
+
+    return diff;
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+void MlKem_KeyPair(MlKem_Workspace_t *ws, const uint8 *seed, uint8 *publicKey, uint8 *secretKey)
+{
+    const uint8 *rho   = &ws->seed[0];
+    const uint8 *sigma = &ws->seed[32];
+    uint8        k     = MLKEM_K;
+    uint32       i;
+    uint32       j;
+
+    /* (rho, sigma) = G(d || k) */
+    hashG(ws, seed, 32u, &k, 1u, ws->seed);
+
+    for (i = 0; i < MLKEM_K; i++)
+    {
+        sampleNoise(ws, ws->vector[i], sigma, (uint8)i);
+        ntt(ws->vector[i]);
+    }
+
+    /* t = A s + e, row by row */
+    for (i = 0; i < MLKEM_K; i++)
+    {
+        memset(ws->accumulator, 0, sizeof(ws->accumulator));
+        for (j = 0; j < MLKEM_K; j++)
+        {
+            sampleUniform(ws, ws->poly, rho, (uint8)j, (uint8)i);
+            multiplyAccumulate(ws->accumulator, ws->poly, ws->vector[j]);
+        }
+        for (j = 0; j < MLKEM_N; j++)
+            ws->accumulator[j] = fqmul(ws->accumulator[j], MLKEM_MONT_SQUARE);
+
+        sampleNoise(ws, ws->poly, sigma, (uint8)(MLKEM_K + i));
+        ntt(ws->poly);
+        addPoly(ws->accumulator, ws->poly);
+        reducePoly(ws->accumulator);
+        encodePoly(&publicKey[i * MLKEM_POLY_BYTES], ws->accumulator);
+    }
+    memcpy(&publicKey[MLKEM_K * MLKEM_POLY_BYTES], rho, 32u);
+
+    /* dk = s || ek || H(ek) || z */
+    for (i = 0; i < MLKEM_K; i++)
+        encodePoly(&secretKey[i * MLKEM_POLY_BYTES], ws->vector[i]);
+    memcpy(&secretKey[MLKEM_K * MLKEM_POLY_BYTES], publicKey, MLKEM768_PUBLIC_KEY_SIZE);
+    hashH(ws, publicKey, MLKEM768_PUBLIC_KEY_SIZE, &secretKey[MLKEM_HASH_OFFSET]);
+    memcpy(&secretKey[MLKEM_Z_OFFSET], &seed[32], 32u);
+}
+
+boolean MlKem_Encapsulate(MlKem_Workspace_t *ws, const uint8 *publicKey, const uint8 *message, uint8 *ciphertext,
+                          uint8 *sharedSecret)
+{
+    uint8  hash[SHA3_256_DIGEST_SIZE];
+    uint32 i;
+    uint32 j;
+
+    /* Modulus check: every encoded coefficient of t must be below q */
+    for (i = 0; i < MLKEM_K; i++)
+    {
+        decode(ws->poly, &publicKey[i * MLKEM_POLY_BYTES], 12u);
+        for (j = 0; j < MLKEM_N; j++)
+        {
+            if (ws->poly[j] >= MLKEM_Q)
+                return FALSE;
+        }
+    }
+
+    /* (K, r) = G(m || H(ek)) */
+    hashH(ws, publicKey, MLKEM768_PUBLIC_KEY_SIZE, hash);
+    hashG(ws, message, MLKEM_MESSAGE_SIZE, hash, sizeof(hash), ws->seed);
+
+    (void)encrypt(ws, publicKey, message, &ws->seed[32], ciphertext, NULL_PTR);
+    memcpy(sharedSecret, ws->seed, MLKEM_SHARED_SECRET_SIZE);
+
+    return TRUE;
+}
+
+boolean MlKem_Decapsulate(MlKem_Workspace_t *ws, const uint8 *secretKey, const uint8 *ciphertext,
+                          uint8 *sharedSecret)
+{
+    const uint8 *publicKey = &secretKey[MLKEM_K * MLKEM_POLY_BYTES];
+    uint8        rejected[MLKEM_SHARED_SECRET_SIZE];
+    uint8        hash[SHA3_256_DIGEST_SIZE];
+    uint8        check = 0;
+    uint8        diff;
+    uint8        mask;
+    uint32       i;
+
+    hashH(ws, publicKey, MLKEM768_PUBLIC_KEY_SIZE, hash);
+    for (i = 0; i < sizeof(hash); i++)
+        check |= (uint8)(hash[i] ^ secretKey[MLKEM_HASH_OFFSET + i]);
+    if (check != 0u)
+        return FALSE;
+
+    /* m' = Decompress(v) - NTT^-1(s^T NTT(u)) */
+    memset(ws->accumulator, 0, sizeof(ws->accumulator));
+    for (i = 0; i < MLKEM_K; i++)
+    {
+        decompressPoly(ws->poly, &ciphertext[i * MLKEM_POLY_BYTES_DU], 10u);
+        ntt(ws->poly);
+        decode(ws->vector[0], &secretKey[i * MLKEM_POLY_BYTES], 12u);
+        multiplyAccumulate(ws->accumulator, ws->vector[0], ws->poly);
+    }
+    invNtt(ws->accumulator);
+
+    decompressPoly(ws->poly, &ciphertext[MLKEM_K * MLKEM_POLY_BYTES_DU], 4u);
+    for (i = 0; i < MLKEM_N; i++)
+        ws->poly[i] = barrettReduce((sint16)(ws->poly[i] - ws->accumulator[i]));
+
+    memset(ws->message, 0, sizeof(ws->message));
+    for (i = 0; i < MLKEM_N; i++)
+        ws->message[i / 8u] |= (uint8)(compress(ws->poly[i], 1u) << (i % 8u));
+
+    /* Re-encrypt with (K', r') = G(m' || h) and compare, K_bar = J(z || c) on mismatch */
+    hashG(ws, ws->message, MLKEM_MESSAGE_SIZE, &secretKey[MLKEM_HASH_OFFSET], 32u, ws->seed);
+    diff = encrypt(ws, publicKey, ws->message, &ws->seed[32], NULL_PTR, ciphertext);
+
+    Keccak_Init(&ws->keccak, KECCAK_RATE_SHAKE256);
+    Keccak_Absorb(&ws->keccak, &secretKey[MLKEM_Z_OFFSET], 32u);
+    Keccak_Absorb(&ws->keccak, ciphertext, MLKEM768_CIPHERTEXT_SIZE);
+    Keccak_Finalize(&ws->keccak, KECCAK_SUFFIX_SHAKE);
+    Keccak_Squeeze(&ws->keccak, rejected, sizeof(rejected));
+
+    mask = (uint8)((0u - (uint32)diff) >> 8);
+    for (i = 0; i < MLKEM_SHARED_SECRET_SIZE; i++)
+        sharedSecret[i] = (uint8)(ws->seed[i] ^ (mask & (ws->seed[i] ^ rejected[i])));
+
+    return TRUE;
+}
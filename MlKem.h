@@ -0,0 +1,92 @@
+/**********************************************************************************************************************
+ * \file MlKem.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * ML-KEM-768 key encapsulation (FIPS 203), the post-quantum half of the hybrid key exchange.
+ * All polynomial buffers live in a caller provided MlKem_Workspace_t (about 3 KB), so the functions themselves
+ * need only a few hundred bytes of stack. The matrix A is never stored: each entry is sampled from the seed when
+ * it is used and consumed right away, and the decapsulation compares the re-encrypted ciphertext one polynomial
+ * at a time instead of building a second ciphertext.
+ *
+ * Polynomial arithmetic uses 16-bit coefficients with Montgomery and Barrett reduction, so every product is a
+ * 16x16 bit multiplication with a 32-bit result and the reductions are multiply-subtract steps. Secret dependent
+ * branches and table lookups are avoided; the implicit rejection of a decapsulation is a constant-time select.
+ *********************************************************************************************************************/
+
+#ifndef MLKEM_H_
+#define MLKEM_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Keccak.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define MLKEM_N                                  256
+#define MLKEM_Q                                  3329
+#define MLKEM_K                                  3           /* ML-KEM-768 */
+#define MLKEM_SEED_SIZE                          64          /* d || z for key generation                      */
+#define MLKEM_MESSAGE_SIZE                       32          /* Random message m for encapsulation             */
+#define MLKEM_SHARED_SECRET_SIZE                 32
+#define MLKEM_POLY_BYTES                         384         /* 12-bit coefficients                            */
+#define MLKEM_POLY_BYTES_DU                      320         /* 10-bit compressed ciphertext part u             */
+#define MLKEM_POLY_BYTES_DV                      128         /* 4-bit compressed ciphertext part v              */
+#define MLKEM768_PUBLIC_KEY_SIZE                 (MLKEM_K * MLKEM_POLY_BYTES + 32)                      /* 1184 */
+#define MLKEM768_SECRET_KEY_SIZE                 (2 * MLKEM_K * MLKEM_POLY_BYTES + 96)                  /* 2400 */
+#define MLKEM768_CIPHERTEXT_SIZE                 (MLKEM_K * MLKEM_POLY_BYTES_DU + MLKEM_POLY_BYTES_DV)  /* 1088 */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    sint16   vector[MLKEM_K][MLKEM_N];      /* Secret vector s or y in the NTT domain          */
+    sint16   accumulator[MLKEM_N];          /* Row of the matrix-vector product                */
+    sint16   poly[MLKEM_N];                 /* Matrix entry, noise or decoded input            */
+    uint8    buffer[MLKEM_POLY_BYTES_DU];   /* Sampler output or a compressed polynomial       */
+    uint8    seed[64];                      /* rho || sigma, or K || r                         */
+    uint8    message[MLKEM_MESSAGE_SIZE];   /* Decrypted message                               */
+    Keccak_t keccak;
+} MlKem_Workspace_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Generate a key pair
+ * \param ws Workspace
+ * \param seed MLKEM_SEED_SIZE random bytes
+ * \param publicKey Output, MLKEM768_PUBLIC_KEY_SIZE bytes
+ * \param secretKey Output, MLKEM768_SECRET_KEY_SIZE bytes
+ */
+void MlKem_KeyPair(MlKem_Workspace_t *ws, const uint8 *seed, uint8 *publicKey, uint8 *secretKey);
+
+/**
+ * \brief Encapsulate a shared secret to a public key
+ * \param ws Workspace
+ * \param publicKey Peer public key, MLKEM768_PUBLIC_KEY_SIZE bytes
+ * \param message MLKEM_MESSAGE_SIZE random bytes
+ * \param ciphertext Output, MLKEM768_CIPHERTEXT_SIZE bytes
+ * \param sharedSecret Output, MLKEM_SHARED_SECRET_SIZE bytes
+ * \return FALSE if the public key is not valid (a coefficient not below q), TRUE otherwise
+ */
+boolean MlKem_Encapsulate(MlKem_Workspace_t *ws, const uint8 *publicKey, const uint8 *message, uint8 *ciphertext,
+                          uint8 *sharedSecret);
+
+/**
+ * \brief Decapsulate the shared secret of a ciphertext
+ * An invalid ciphertext yields a pseudorandom secret (implicit rejection), the handshake then fails later.
+ * \param ws Workspace
+ * \param secretKey Own secret key, MLKEM768_SECRET_KEY_SIZE bytes
+ * \param ciphertext MLKEM768_CIPHERTEXT_SIZE bytes
+ * \param sharedSecret Output, MLKEM_SHARED_SECRET_SIZE bytes
+ * \return FALSE if the secret key fails its hash check, TRUE otherwise
+ */
+boolean MlKem_Decapsulate(MlKem_Workspace_t *ws, const uint8 *secretKey, const uint8 *ciphertext,
+                          uint8 *sharedSecret);
+
+#endif /* MLKEM_H_ */
@@ -0,0 +1,141 @@
+/**********************************************************************************************************************
+ * \file Ota_BankSwap.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * PFlash bank swap update mode
+ *********************************************************************************************************************/
+
+#include "Ota_BankSwap.h"
+#include "IfxScu_reg.h"
+#include "IfxScuWdt.h"
+#include <stddef.h>
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Through size_t, so hosts with 64-bit pointers (Tools/PFlashModel) cast cleanly */
+static uint32 readWord(uint32 address)
+{
+    return *(volatile const uint32 *)(size_t)address;
+}
+
+/* Program one 8 byte DFlash page of the UCB and read it back */
+static uint8 programUcbPage(uint32 address, uint32 wordL, uint32 wordU)
+{
+    uint16 password;
+
+    if (IfxFlash_enterPageMode(address) != 0u)
+        return FLASH4_ERROR;
+    (void)IfxFlash_waitUnbusy(0, IfxFlash_FlashType_D0);
+
+    IfxFlash_loadPage2X32(address, wordL, wordU);
+
+    password = IfxScuWdt_getSafetyWatchdogPasswordInline();
+    IfxScuWdt_clearSafetyEndinitInline(password);
+    IfxFlash_writePage(address);
+    IfxScuWdt_setSafetyEndinitInline(password);
+
+    if (IfxFlash_waitUnbusy(0, IfxFlash_FlashType_D0) != 0u)
+        return FLASH4_ERROR;
+
+    return (readWord(address) == wordL && readWord(address + 4u) == wordU) ? FLASH4_OK : FLASH4_ERROR;
+}
+
+/* A set is used as soon as its marker page is programmed, even if a reset prevented the confirmation */
+static boolean isSetFree(uint32 ucb, uint32 set)
+{
+    uint32 address = ucb + set * OTA_SWAP_SET_SIZE;
+
+    return (readWord(address) == 0u && readWord(address + 4u) == 0u &&
+            readWord(address + 8u) == 0u && readWord(address + 12u) == 0u) ? TRUE : FALSE;
+}
+
+/* Marker first, confirmation last: the startup software ignores a set without a valid confirmation */
+static uint8 programSet(uint32 ucb, uint32 set, uint32 marker)
+{
+    uint32 markerAddress       = ucb + set * OTA_SWAP_SET_SIZE;
+    uint32 confirmationAddress = markerAddress + 8u;
+
+    if (programUcbPage(markerAddress, marker, markerAddress) != FLASH4_OK)
+        return FLASH4_ERROR;
+
+    return programUcbPage(confirmationAddress, OTA_SWAP_CONFIRMATION_CODE, confirmationAddress);
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+Ota_BankMap Ota_BankSwap_GetMap(void)
+{
+    return (SCU_SWAPCTRL.B.ADDRCFG == OTA_SWAP_ADDRCFG_ALTERNATE) ? Ota_BankMap_alternate : Ota_BankMap_standard;
+}
+
+uint8 Ota_BankSwap_Begin(Ota_BankSwap_t *swap, uint32 source, uint32 size, Ota_InstallProgress progress)
+{
+    swap->map   = Ota_BankSwap_GetMap();
+    swap->state = Ota_SwapState_error;
+
+    if (Ota_Installer_Init(&swap->installer, source, OTA_SWAP_INACTIVE_ADDRESS, size, progress) != FLASH4_OK)
+        return FLASH4_ERROR;
+
+    /* The busy flags belong to the physical banks: after a swap the upper half is PF0 */
+    swap->installer.bank = (swap->map == Ota_BankMap_alternate) ? IfxFlash_FlashType_P0 : IfxFlash_FlashType_P1;
+    swap->state          = Ota_SwapState_installing;
+
+    return FLASH4_OK;
+}
+
+void Ota_BankSwap_Poll(Ota_BankSwap_t *swap)
+{
+    if (swap->state != Ota_SwapState_installing)
+        return;
+
+    Ota_Installer_Poll(&swap->installer);
+
+    if (swap->installer.state == Ota_InstallState_done)
+        swap->state = Ota_SwapState_installed;
+    else if (swap->installer.state == Ota_InstallState_error)
+        swap->state = Ota_SwapState_error;
+}
+
+uint8 Ota_BankSwap_Commit(Ota_BankSwap_t *swap)
+{
+    Ota_BankMap next;
+
+    if (swap->state != Ota_SwapState_installed)
+        return FLASH4_ERROR;
+
+    next = (swap->map == Ota_BankMap_standard) ? Ota_BankMap_alternate : Ota_BankMap_standard;
+    if (Ota_BankSwap_SelectMap(next) != FLASH4_OK)
+    {
+        swap->state = Ota_SwapState_error;
+        return FLASH4_ERROR;
+    }
+
+    swap->state = Ota_SwapState_committed;
+    return FLASH4_OK;
+}
+
+uint8 Ota_BankSwap_SelectMap(Ota_BankMap map)
+{
+    uint32 marker = (map == Ota_BankMap_alternate) ? OTA_SWAP_MARKER_ALTERNATE : OTA_SWAP_MARKER_STANDARD;
+    uint32 set;
+
+    /* The same set index in both copies, the first one free in both */
+    for (set = 0; set < OTA_SWAP_SET_COUNT; set++)
+    {
+        if (isSetFree(OTA_SWAP_UCB_ORIG_ADDRESS, set) && isSetFree(OTA_SWAP_UCB_COPY_ADDRESS, set))
+            break;
+    }
+
+    /* Erasing UCB_SWAP is left to the production tooling */
+    if (set == OTA_SWAP_SET_COUNT)
+        return FLASH4_ERROR;
+
+    if (programSet(OTA_SWAP_UCB_ORIG_ADDRESS, set, marker) != FLASH4_OK)
+        return FLASH4_ERROR;
+
+    return programSet(OTA_SWAP_UCB_COPY_ADDRESS, set, marker);
+}
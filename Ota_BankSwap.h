@@ -0,0 +1,104 @@
+/**********************************************************************************************************************
+ * \file Ota_BankSwap.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Update mode using the PFlash address map swap of the TC3xx (SOTA)
+ * The application is linked for the lower half of the PFlash address range and always runs there. The upper half,
+ * PF1 in the standard map, holds the other bank. An update installs the new image into the upper half in the
+ * background with Ota_Installer while the application keeps running, then programs a new entry into UCB_SWAP. The
+ * startup software evaluates it at the next reset and swaps the two banks in the address map, so the new image
+ * runs from the lower half and the previous one stays available in the upper half for a rollback.
+ *
+ * The swap must be enabled in the device configuration (SOTA mode in UCB_SWAP). The UCB addresses and codes below
+ * follow the TC3xx user manual and must be checked against the manual of the device in use.
+ * Tools/PFlashModel simulates the banks, the address map and the UCB on a Linux host.
+ *********************************************************************************************************************/
+
+#ifndef OTA_BANKSWAP_H_
+#define OTA_BANKSWAP_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Ota_Installer.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define OTA_SWAP_INACTIVE_ADDRESS        IFXFLASH_PFLASH_P1_START  /* Upper half, the inactive bank in both maps  */
+#define OTA_SWAP_UCB_ORIG_ADDRESS        0xAF402E00UL  /* UCB_SWAP_ORIG                                           */
+#define OTA_SWAP_UCB_COPY_ADDRESS        0xAF403600UL  /* UCB_SWAP_COPY, used by the startup software if ORIG fails */
+#define OTA_SWAP_SET_COUNT               16            /* Marker / confirmation sets per UCB                      */
+#define OTA_SWAP_SET_SIZE                16            /* Marker page followed by confirmation page               */
+#define OTA_SWAP_MARKER_STANDARD         0x00000055UL
+#define OTA_SWAP_MARKER_ALTERNATE        0x000000AAUL
+#define OTA_SWAP_CONFIRMATION_CODE       0x57B5327FUL
+#define OTA_SWAP_ADDRCFG_ALTERNATE       2u            /* SCU_SWAPCTRL.ADDRCFG after a swap                       */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef enum
+{
+    Ota_BankMap_standard = 0,       /* PF0 at the lower half             */
+    Ota_BankMap_alternate           /* PF1 at the lower half             */
+} Ota_BankMap;
+
+typedef enum
+{
+    Ota_SwapState_idle = 0,         /* No update running                                */
+    Ota_SwapState_installing,       /* Background installation into the inactive bank   */
+    Ota_SwapState_installed,        /* Inactive bank holds the new image                */
+    Ota_SwapState_committed,        /* Swap requested for the next reset                */
+    Ota_SwapState_error
+} Ota_SwapState;
+
+typedef struct
+{
+    Ota_Installer_t installer;
+    Ota_BankMap     map;            /* Map the application runs with     */
+    Ota_SwapState   state;
+} Ota_BankSwap_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Get the address map the device started with
+ * \return Ota_BankMap_standard or Ota_BankMap_alternate
+ */
+Ota_BankMap Ota_BankSwap_GetMap(void);
+
+/**
+ * \brief Start installing an image into the inactive bank
+ * \param swap Update state
+ * \param source Flash4 address of the staged image
+ * \param size Image size in bytes, at most the size of one bank
+ * \param progress Progress callback, NULL_PTR if not needed
+ * \return FLASH4_OK, FLASH4_ERROR if the image does not fit
+ */
+uint8 Ota_BankSwap_Begin(Ota_BankSwap_t *swap, uint32 source, uint32 size, Ota_InstallProgress progress);
+
+/**
+ * \brief Advance the installation, call it from the idle loop or a cyclic task
+ * \param swap Update state
+ */
+void Ota_BankSwap_Poll(Ota_BankSwap_t *swap);
+
+/**
+ * \brief Request the swap to the installed image at the next reset
+ * \param swap Update state, must be Ota_SwapState_installed
+ * \return FLASH4_OK, FLASH4_ERROR if nothing is installed or UCB_SWAP is full or fails to program
+ */
+uint8 Ota_BankSwap_Commit(Ota_BankSwap_t *swap);
+
+/**
+ * \brief Program a UCB_SWAP entry selecting an address map for the next reset, e.g. to roll back
+ * \param map Address map to start with
+ * \return FLASH4_OK, FLASH4_ERROR if all sets are used or programming fails
+ */
+uint8 Ota_BankSwap_SelectMap(Ota_BankMap map);
+
+#endif /* OTA_BANKSWAP_H_ */
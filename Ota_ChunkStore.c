@@ -0,0 +1,522 @@
+/**********************************************************************************************************************
+ * \file Ota_ChunkStore.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Content-defined chunk store for deduplicated updates
+ *********************************************************************************************************************/
+
+#include "Ota_ChunkStore.h"
+#include "Crc16.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define ENTRIES_PER_PAGE            (FLASH4_MAX_PAGE_SIZE / OTA_CHUNKSTORE_ENTRY_SIZE)
+#define ENTRY_HASH_OFFSET           16u
+#define PAGE_ALIGN(n)               (((n) + FLASH4_MAX_PAGE_SIZE - 1u) & ~(uint32)(FLASH4_MAX_PAGE_SIZE - 1u))
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static uint32 entryAddress(uint32 entry)
+{
+    return OTA_CHUNKSTORE_INDEX_ADDRESS + FLASH4_MAX_PAGE_SIZE + entry * OTA_CHUNKSTORE_ENTRY_SIZE;
+}
+
+static uint32 tableSlot(const uint8 *hash)
+{
+    uint32 key = (uint32)hash[0] | ((uint32)hash[1] << 8) | ((uint32)hash[2] << 16) | ((uint32)hash[3] << 24);
+
+    return key & (OTA_CHUNKSTORE_TABLE_SIZE - 1u);
+}
+
+static void tableInsert(Ota_ChunkStore_t *store, const uint8 *hash, uint32 entry)
+{
+    uint32 slot = tableSlot(hash);
+
+    while (store->table[slot] != 0u)
+        slot = (slot + 1u) & (OTA_CHUNKSTORE_TABLE_SIZE - 1u);
+
+    store->table[slot] = (uint16)(entry + 1u);
+}
+
+static boolean isErased(const uint8 *data, uint32 length)
+{
+    uint32 i;
+
+    for (i = 0; i < length; i++)
+    {
+        if (data[i] != 0xFFu)
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+/* Gear table of the rolling hash, the same values as in Tools/ota_mkrecipe.c */
+static void initGear(Ota_ChunkStore_t *store)
+{
+    uint32 i;
+
+    for (i = 0; i < 256u; i++)
+    {
+        uint32 x = (i + 1u) * 0x9E3779B9UL;
+
+        x ^= x >> 16;
+        x *= 0x85EBCA6BUL;
+        x ^= x >> 13;
+        x *= 0xC2B2AE35UL;
+        x ^= x >> 16;
+        store->gear[i] = x;
+    }
+}
+
+/* Normalized chunking: a cut is unlikely below the average size and likely above it */
+static boolean isCutPoint(uint32 hash, uint32 length)
+{
+    uint32 mask;
+
+    if (length >= OTA_CHUNKSTORE_MAX_CHUNK)
+        return TRUE;
+    if (length < OTA_CHUNKSTORE_MIN_CHUNK)
+        return FALSE;
+
+    mask = (length < OTA_CHUNKSTORE_AVG_CHUNK) ? OTA_CHUNKSTORE_MASK_SMALL : OTA_CHUNKSTORE_MASK_LARGE;
+
+    return ((hash & mask) == 0u) ? TRUE : FALSE;
+}
+
+/* Program the address and length of a new entry and erase the data sectors the chunk enters */
+static uint8 reserveEntry(Ota_ChunkStore_t *store, uint32 length, uint32 *entry, uint32 *address)
+{
+    Ota_ChunkEntry_t record;
+    uint32           boundary;
+    uint8            result;
+
+    if (store->entryCount == OTA_CHUNKSTORE_MAX_ENTRIES || store->dataEnd + length > OTA_CHUNKSTORE_DATA_END)
+        return FLASH4_ERROR;
+
+    boundary = store->dataEnd - (store->dataEnd % FLASH4_SECTOR_SIZE);
+    if (boundary != store->dataEnd)
+        boundary += FLASH4_SECTOR_SIZE;
+
+    for (; boundary < store->dataEnd + length; boundary += FLASH4_SECTOR_SIZE)
+    {
+        result = Flash4_EraseSector(boundary);
+        if (result != FLASH4_OK)
+            return result;
+    }
+
+    memset(&record, 0xFF, sizeof(record));
+    record.address = store->dataEnd;
+    record.length  = length;
+    record.crc     = Crc16_Calculate((const uint8 *)&record, 8u);
+
+    result = Flash4_ProgramPage((const uint8 *)&record, entryAddress(store->entryCount), ENTRY_HASH_OFFSET);
+    if (result != FLASH4_OK)
+        return result;
+
+    *entry            = store->entryCount;
+    *address          = store->dataEnd;
+    store->entryCount++;
+    store->dataEnd   += PAGE_ALIGN(length);
+
+    return FLASH4_OK;
+}
+
+/* The hash makes the entry valid, a reset before leaves an entry that only occupies space */
+static uint8 completeEntry(Ota_ChunkStore_t *store, uint32 entry, const uint8 *hash)
+{
+    uint8 result = Flash4_ProgramPage(hash, entryAddress(entry) + ENTRY_HASH_OFFSET, SHA256_DIGEST_SIZE);
+
+    if (result == FLASH4_OK)
+        tableInsert(store, hash, entry);
+
+    return result;
+}
+
+/* Copy a chunk of an image already in Flash4 into the store */
+static uint8 importChunk(Ota_ChunkStore_t *store, uint32 source, uint32 length, const uint8 *hash)
+{
+    uint32 entry;
+    uint32 address;
+    uint32 offset;
+    uint8  result;
+
+    result = reserveEntry(store, length, &entry, &address);
+
+    for (offset = 0; offset < length && result == FLASH4_OK; offset += FLASH4_MAX_PAGE_SIZE)
+    {
+        uint16 n = (length - offset > FLASH4_MAX_PAGE_SIZE) ? FLASH4_MAX_PAGE_SIZE : (uint16)(length - offset);
+
+        Flash4_ReadFlash4(store->page, source + offset, n);
+        result = Flash4_ProgramPage(store->page, address + offset, n);
+    }
+
+    return (result == FLASH4_OK) ? completeEntry(store, entry, hash) : result;
+}
+
+static boolean isValidRecipe(const Ota_RecipeHeader_t *header)
+{
+    return (header->magic == OTA_RECIPE_MAGIC && header->version == OTA_CHUNKSTORE_VERSION &&
+            header->imageSize > 0u && header->imageSize <= OTA_SLOT_SIZE && header->chunkCount > 0u &&
+            header->chunkCount <= OTA_CHUNKSTORE_MAX_REFS) ? TRUE : FALSE;
+}
+
+/* Every reference within the chunk size limits and the lengths adding up to the image */
+static boolean isValidRefList(const Ota_ChunkStore_t *store)
+{
+    Ota_ChunkRef_t ref;
+    uint32         total = 0;
+    uint32         index;
+
+    for (index = 0; index < store->recipe.chunkCount; index++)
+    {
+        Ota_ChunkStore_GetRef(store, index, &ref);
+        if (ref.length == 0u || ref.length > OTA_CHUNKSTORE_MAX_CHUNK)
+            return FALSE;
+        total += ref.length;
+    }
+
+    return (total == store->recipe.imageSize) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+uint8 Ota_ChunkStore_Init(Ota_ChunkStore_t *store)
+{
+    uint32 header[2];
+    uint32 entry = 0;
+    boolean end  = FALSE;
+
+    initGear(store);
+    memset(store->table, 0, sizeof(store->table));
+    store->state      = Ota_ChunkStoreState_empty;
+    store->entryCount = 0;
+    store->dataEnd    = OTA_CHUNKSTORE_DATA_ADDRESS;
+
+    Flash4_ReadFlash4((uint8 *)header, OTA_CHUNKSTORE_INDEX_ADDRESS, sizeof(header));
+    if (header[0] != OTA_CHUNKSTORE_MAGIC || header[1] != OTA_CHUNKSTORE_VERSION)
+        return FLASH4_ERROR;
+
+    /* Entries are appended, the first erased one ends the index */
+    while (!end && entry < OTA_CHUNKSTORE_MAX_ENTRIES)
+    {
+        const Ota_ChunkEntry_t *records = (const Ota_ChunkEntry_t *)store->page;
+        uint32 i;
+
+        Flash4_ReadFlash4(store->page, entryAddress(entry), FLASH4_MAX_PAGE_SIZE);
+
+        for (i = 0; i < ENTRIES_PER_PAGE && entry < OTA_CHUNKSTORE_MAX_ENTRIES; i++, entry++)
+        {
+            const Ota_ChunkEntry_t *record = &records[i];
+
+            if (isErased((const uint8 *)record, ENTRY_HASH_OFFSET))
+            {
+                end = TRUE;
+                break;
+            }
+
+            store->entryCount = entry + 1u;
+
+            /* An entry torn while programming has no data behind it */
+            if (Crc16_Calculate((const uint8 *)record, 8u) != record->crc ||
+                record->address < OTA_CHUNKSTORE_DATA_ADDRESS || record->length > OTA_CHUNKSTORE_MAX_CHUNK ||
+                record->address + record->length > OTA_CHUNKSTORE_DATA_END)
+                continue;
+
+            if (record->address + PAGE_ALIGN(record->length) > store->dataEnd)
+                store->dataEnd = record->address + PAGE_ALIGN(record->length);
+
+            if (!isErased(record->hash, SHA256_DIGEST_SIZE))
+                tableInsert(store, record->hash, entry);
+        }
+    }
+
+    return FLASH4_OK;
+}
+
+uint8 Ota_ChunkStore_Format(Ota_ChunkStore_t *store)
+{
+    uint32 header[2] = {OTA_CHUNKSTORE_MAGIC, OTA_CHUNKSTORE_VERSION};
+    uint8  result;
+
+    /* The data sectors are erased when the data end reaches them */
+    result = Flash4_EraseSector(OTA_CHUNKSTORE_INDEX_ADDRESS);
+    if (result == FLASH4_OK)
+        result = Flash4_ProgramPage((const uint8 *)header, OTA_CHUNKSTORE_INDEX_ADDRESS, sizeof(header));
+    if (result != FLASH4_OK)
+        return result;
+
+    return Ota_ChunkStore_Init(store);
+}
+
+uint32 Ota_ChunkStore_Find(const Ota_ChunkStore_t *store, const uint8 *hash)
+{
+    uint32 slot = tableSlot(hash);
+    uint8  stored[SHA256_DIGEST_SIZE];
+
+    /* The table keeps entry numbers only, the full hash is compared in Flash4 */
+    while (store->table[slot] != 0u)
+    {
+        uint32 entry = store->table[slot] - 1u;
+
+        Flash4_ReadFlash4(stored, entryAddress(entry) + ENTRY_HASH_OFFSET, SHA256_DIGEST_SIZE);
+        if (memcmp(stored, hash, SHA256_DIGEST_SIZE) == 0)
+            return entry;
+
+        slot = (slot + 1u) & (OTA_CHUNKSTORE_TABLE_SIZE - 1u);
+    }
+
+    return OTA_CHUNKSTORE_NONE;
+}
+
+uint8 Ota_ChunkStore_ImportImage(Ota_ChunkStore_t *store, uint32 address, uint32 size, uint32 *added)
+{
+    uint8    buffer[FLASH4_MAX_PAGE_SIZE];
+    uint8    digest[SHA256_DIGEST_SIZE];
+    Sha256_t ctx;
+    uint32   position = 0;
+    uint32   start    = 0;
+    uint32   hash     = 0;
+    uint32   count    = 0;
+    uint8    result   = FLASH4_OK;
+
+    Sha256_Init(&ctx);
+
+    while (position < size && result == FLASH4_OK)
+    {
+        uint16 n       = (size - position > FLASH4_MAX_PAGE_SIZE) ? FLASH4_MAX_PAGE_SIZE : (uint16)(size - position);
+        uint16 segment = 0;
+        uint16 i;
+
+        Flash4_ReadFlash4(buffer, address + position, n);
+
+        for (i = 0; i < n && result == FLASH4_OK; i++)
+        {
+            uint32 end = position + i + 1u;
+
+            hash = (hash << 1) + store->gear[buffer[i]];
+            if (!isCutPoint(hash, end - start) && end != size)
+                continue;
+
+            Sha256_Update(&ctx, &buffer[segment], (uint32)(i + 1u - segment));
+            Sha256_Final(&ctx, digest);
+
+            if (Ota_ChunkStore_Find(store, digest) == OTA_CHUNKSTORE_NONE)
+            {
+                result = importChunk(store, address + start, end - start, digest);
+                count++;
+            }
+
+            Sha256_Init(&ctx);
+            segment = (uint16)(i + 1u);
+            start   = end;
+            hash    = 0;
+        }
+
+        Sha256_Update(&ctx, &buffer[segment], (uint32)(n - segment));
+        position += n;
+    }
+
+    if (added != NULL_PTR)
+        *added = count;
+
+    return result;
+}
+
+uint8 Ota_ChunkStore_BeginRecipe(Ota_ChunkStore_t *store, const Ota_RecipeHeader_t *header)
+{
+    uint8 result;
+
+    store->state = Ota_ChunkStoreState_empty;
+    if (!isValidRecipe(header))
+        return FLASH4_ERROR;
+
+    store->recipe      = *header;
+    store->recipeBytes = 0;
+    Sha256_Init(&store->sha);
+
+    result = Flash4_EraseSector(OTA_CHUNKSTORE_RECIPE_ADDRESS);
+    if (result == FLASH4_OK)
+        result = Flash4_ProgramPage((const uint8 *)header, OTA_CHUNKSTORE_RECIPE_ADDRESS, sizeof(Ota_RecipeHeader_t));
+    if (result == FLASH4_OK)
+        store->state = Ota_ChunkStoreState_recipe;
+
+    return result;
+}
+
+uint32 Ota_ChunkStore_WriteRecipe(Ota_ChunkStore_t *store, const uint8 *data, uint32 length)
+{
+    uint32 total = store->recipe.chunkCount * OTA_CHUNKSTORE_REF_SIZE;
+    uint32 used  = 0;
+
+    while (used < length && store->state == Ota_ChunkStoreState_recipe)
+    {
+        uint32 offset = store->recipeBytes % FLASH4_MAX_PAGE_SIZE;
+        uint32 n      = FLASH4_MAX_PAGE_SIZE - offset;
+
+        if (n > total - store->recipeBytes)
+            n = total - store->recipeBytes;
+        if (n > length - used)
+            n = length - used;
+
+        memcpy(&store->page[offset], &data[used], n);
+        Sha256_Update(&store->sha, &data[used], n);
+        used               += n;
+        store->recipeBytes += n;
+
+        if (offset + n == FLASH4_MAX_PAGE_SIZE || store->recipeBytes == total)
+        {
+            if (Flash4_ProgramPage(store->page, OTA_CHUNKSTORE_RECIPE_ADDRESS + FLASH4_MAX_PAGE_SIZE +
+                                   store->recipeBytes - (offset + n), (uint16)(offset + n)) != FLASH4_OK)
+                store->state = Ota_ChunkStoreState_error;
+        }
+
+        if (store->recipeBytes == total && store->state == Ota_ChunkStoreState_recipe)
+        {
+            uint8 digest[SHA256_DIGEST_SIZE];
+
+            Sha256_Final(&store->sha, digest);
+            store->state = (memcmp(digest, store->recipe.listDigest, SHA256_DIGEST_SIZE) == 0 &&
+                            isValidRefList(store)) ? Ota_ChunkStoreState_chunks : Ota_ChunkStoreState_error;
+        }
+    }
+
+    return used;
+}
+
+void Ota_ChunkStore_GetRef(const Ota_ChunkStore_t *store, uint32 index, Ota_ChunkRef_t *ref)
+{
+    uint32 address = OTA_CHUNKSTORE_RECIPE_ADDRESS + FLASH4_MAX_PAGE_SIZE + index * OTA_CHUNKSTORE_REF_SIZE;
+
+    /* Past the recipe the reference area holds no valid entry, and past the sector it belongs to the store */
+    if (index >= store->recipe.chunkCount || index >= OTA_CHUNKSTORE_MAX_REFS)
+    {
+        memset(ref, 0, sizeof(Ota_ChunkRef_t));
+        return;
+    }
+
+    Flash4_ReadBuffer((uint8 *)ref, address, OTA_CHUNKSTORE_REF_SIZE);
+}
+
+uint32 Ota_ChunkStore_NextMissing(const Ota_ChunkStore_t *store, uint32 index)
+{
+    Ota_ChunkRef_t ref;
+
+    for (; index < store->recipe.chunkCount; index++)
+    {
+        Ota_ChunkStore_GetRef(store, index, &ref);
+        if (Ota_ChunkStore_Find(store, ref.hash) == OTA_CHUNKSTORE_NONE)
+            break;
+    }
+
+    return index;
+}
+
+uint8 Ota_ChunkStore_AddChunk(Ota_ChunkStore_t *store, uint32 index, const uint8 *data, uint32 length)
+{
+    Ota_ChunkRef_t ref;
+    uint8          digest[SHA256_DIGEST_SIZE];
+    uint32         entry;
+    uint32         address;
+    uint32         offset;
+    uint8          result;
+
+    if (store->state != Ota_ChunkStoreState_chunks || index >= store->recipe.chunkCount)
+        return FLASH4_ERROR;
+
+    Ota_ChunkStore_GetRef(store, index, &ref);
+    if (length != ref.length)
+        return FLASH4_ERROR;
+
+    Sha256_Calculate(data, length, digest);
+    if (memcmp(digest, ref.hash, SHA256_DIGEST_SIZE) != 0)
+        return FLASH4_ERROR;
+
+    /* Also referenced earlier in the same recipe */
+    if (Ota_ChunkStore_Find(store, digest) != OTA_CHUNKSTORE_NONE)
+        return FLASH4_OK;
+
+    result = reserveEntry(store, length, &entry, &address);
+
+    for (offset = 0; offset < length && result == FLASH4_OK; offset += FLASH4_MAX_PAGE_SIZE)
+    {
+        uint16 n = (length - offset > FLASH4_MAX_PAGE_SIZE) ? FLASH4_MAX_PAGE_SIZE : (uint16)(length - offset);
+
+        result = Flash4_ProgramPage(&data[offset], address + offset, n);
+    }
+
+    return (result == FLASH4_OK) ? completeEntry(store, entry, digest) : result;
+}
+
+uint8 Ota_ChunkStore_Assemble(Ota_ChunkStore_t *store, uint32 targetAddress, uint16 *crc)
+{
+    uint8            buffer[FLASH4_MAX_PAGE_SIZE];
+    uint8            digest[SHA256_DIGEST_SIZE];
+    Sha256_t         ctx;
+    Ota_ChunkRef_t   ref;
+    Ota_ChunkEntry_t record;
+    uint32           written = 0;
+    uint32           fill    = 0;
+    uint32           index;
+    uint8            result  = FLASH4_OK;
+
+    if (store->state != Ota_ChunkStoreState_chunks || (targetAddress % FLASH4_SECTOR_SIZE) != 0u)
+        return FLASH4_ERROR;
+
+    Sha256_Init(&ctx);
+    *crc = CRC16_INIT_VALUE;
+
+    for (index = 0; index < store->recipe.chunkCount && result == FLASH4_OK; index++)
+    {
+        uint32 entry;
+        uint32 offset;
+
+        Ota_ChunkStore_GetRef(store, index, &ref);
+        entry = Ota_ChunkStore_Find(store, ref.hash);
+        if (entry == OTA_CHUNKSTORE_NONE)
+            return FLASH4_ERROR;
+
+        Flash4_ReadFlash4((uint8 *)&record, entryAddress(entry), sizeof(record));
+
+        /* Chunks start on a page in the store but not in the image: collect full pages for programming */
+        for (offset = 0; offset < ref.length && result == FLASH4_OK;)
+        {
+            uint32 n = FLASH4_MAX_PAGE_SIZE - fill;
+
+            if (n > ref.length - offset)
+                n = ref.length - offset;
+
+            Flash4_ReadFlash4(buffer, record.address + offset, (uint16)n);
+            Sha256_Update(&ctx, buffer, n);
+            *crc = Crc16_Update(*crc, buffer, n);
+            memcpy(&store->page[fill], buffer, n);
+            fill   += n;
+            offset += n;
+
+            if (fill == FLASH4_MAX_PAGE_SIZE || written + fill == store->recipe.imageSize)
+            {
+                if ((written % FLASH4_SECTOR_SIZE) == 0u)
+                    result = Flash4_EraseSector(targetAddress + written);
+                if (result == FLASH4_OK)
+                    result = Flash4_ProgramPage(store->page, targetAddress + written, (uint16)fill);
+
+                written += fill;
+                fill     = 0;
+            }
+        }
+    }
+
+    if (result != FLASH4_OK)
+        return result;
+
+    Sha256_Final(&ctx, digest);
+
+    return (written == store->recipe.imageSize &&
+            memcmp(digest, store->recipe.imageDigest, SHA256_DIGEST_SIZE) == 0) ? FLASH4_OK : FLASH4_ERROR;
+}
@@ -0,0 +1,203 @@
+/**********************************************************************************************************************
+ * \file Ota_ChunkStore.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Content-defined chunk store for deduplicated updates
+ * Images are split at content-defined boundaries: a rolling gear hash over the last 32 bytes selects the cut
+ * points, so an insertion only changes the chunks around it and identical code at a different offset still yields
+ * the same chunks. Every chunk is kept once in Flash4 and indexed by its SHA-256. A firmware version is described
+ * by a recipe, the list of (hash, length) references of its chunks. Only the chunks missing from the store are
+ * downloaded, independent of which version or which ECU image they were seen in before, and no pairwise patches
+ * are needed. The new image is then assembled from the store into a slot.
+ *
+ * Chunks added to the store are complete once their hash is programmed, so after a reset the same recipe only
+ * asks for the chunks still missing. Ota_ChunkStore_ImportImage() seeds the store from an installed image.
+ *
+ * Flash4 layout at OTA_CHUNKSTORE_ADDRESS:
+ *   sector 0        store header page, then Ota_ChunkEntry_t[] (index, appended)
+ *   sector 1        recipe of the current update: Ota_RecipeHeader_t page, then Ota_ChunkRef_t[]
+ *   sector 2..n     chunk data (appended, each chunk starts on a page)
+ *
+ * Recipe stream (little endian, built by Tools/ota_mkrecipe):
+ *   Ota_RecipeHeader_t                              88 bytes, the part covered by the update signature
+ *   Ota_ChunkRef_t[chunkCount]                      36 bytes each, listDigest = SHA-256 over all of them
+ *********************************************************************************************************************/
+
+#ifndef OTA_CHUNKSTORE_H_
+#define OTA_CHUNKSTORE_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+#include "Flash4_Config.h"
+#include "Sha256.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define OTA_CHUNKSTORE_MAGIC                     0x53433446UL    /* "F4CS" */
+#define OTA_RECIPE_MAGIC                         0x52433446UL    /* "F4CR" */
+#define OTA_CHUNKSTORE_VERSION                   1
+#define OTA_CHUNKSTORE_MIN_CHUNK                 1024        /* No cut point before                            */
+#define OTA_CHUNKSTORE_AVG_CHUNK                 4096        /* Stricter cut condition before, looser after    */
+#define OTA_CHUNKSTORE_MAX_CHUNK                 16384       /* Forced cut                                     */
+#define OTA_CHUNKSTORE_MASK_SMALL                0xFFFC0000UL  /* 14 bits, used below the average size         */
+#define OTA_CHUNKSTORE_MASK_LARGE                0xFFC00000UL  /* 10 bits, used above the average size         */
+#define OTA_CHUNKSTORE_ENTRY_SIZE                64
+#define OTA_CHUNKSTORE_MAX_ENTRIES               4092        /* Entries after the header page of the index sector */
+#define OTA_CHUNKSTORE_TABLE_SIZE                8192        /* RAM hash table, power of two, 2 x MAX_ENTRIES  */
+#define OTA_CHUNKSTORE_REF_SIZE                  36
+#define OTA_CHUNKSTORE_MAX_REFS                  ((FLASH4_SECTOR_SIZE - FLASH4_MAX_PAGE_SIZE) / OTA_CHUNKSTORE_REF_SIZE)
+#define OTA_CHUNKSTORE_INDEX_ADDRESS             OTA_CHUNKSTORE_ADDRESS
+#define OTA_CHUNKSTORE_RECIPE_ADDRESS            (OTA_CHUNKSTORE_ADDRESS + FLASH4_SECTOR_SIZE)
+#define OTA_CHUNKSTORE_DATA_ADDRESS              (OTA_CHUNKSTORE_ADDRESS + 2u * FLASH4_SECTOR_SIZE)
+#define OTA_CHUNKSTORE_DATA_END                  (OTA_CHUNKSTORE_ADDRESS + \
+                                                  OTA_CHUNKSTORE_SECTOR_COUNT * FLASH4_SECTOR_SIZE)
+#define OTA_CHUNKSTORE_NONE                      0xFFFFFFFFUL  /* Ota_ChunkStore_Find(): not in the store       */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Index entry, the address and length are programmed before the data and the hash after it */
+typedef struct
+{
+    uint32 address;                 /* Flash4 address of the chunk data                 */
+    uint32 length;                  /* Chunk length in bytes                            */
+    uint16 crc;                     /* CRC-16 of address and length                     */
+    uint8  reserved[6];
+    uint8  hash[SHA256_DIGEST_SIZE];/* SHA-256 of the data, erased until it is complete */
+    uint8  reserved2[16];
+} Ota_ChunkEntry_t;
+
+typedef struct
+{
+    uint32 magic;                   /* OTA_RECIPE_MAGIC                                 */
+    uint8  version;                 /* OTA_CHUNKSTORE_VERSION                           */
+    uint8  reserved[3];
+    uint32 imageVersion;            /* Firmware version                                 */
+    uint32 imageSize;               /* Image size in bytes                              */
+    uint32 chunkCount;              /* Number of chunk references                       */
+    uint32 reserved2;
+    uint8  imageDigest[SHA256_DIGEST_SIZE];  /* SHA-256 of the image                    */
+    uint8  listDigest[SHA256_DIGEST_SIZE];   /* SHA-256 of the chunk references         */
+} Ota_RecipeHeader_t;
+
+typedef struct
+{
+    uint8  hash[SHA256_DIGEST_SIZE];
+    uint32 length;
+} Ota_ChunkRef_t;
+
+typedef enum
+{
+    Ota_ChunkStoreState_empty = 0,  /* No recipe                                        */
+    Ota_ChunkStoreState_recipe,     /* Header accepted, receiving chunk references      */
+    Ota_ChunkStoreState_chunks,     /* References verified, receiving missing chunks    */
+    Ota_ChunkStoreState_error       /* References do not match the header               */
+} Ota_ChunkStoreState;
+
+typedef struct
+{
+    Ota_RecipeHeader_t  recipe;
+    Ota_ChunkStoreState state;
+    uint32              entryCount;                          /* Index entries used, incomplete ones included */
+    uint32              dataEnd;                             /* Next free data address, page aligned         */
+    uint32              recipeBytes;                         /* Reference bytes received                     */
+    Sha256_t            sha;
+    uint16              table[OTA_CHUNKSTORE_TABLE_SIZE];    /* Entry + 1 by hash, 0: free slot              */
+    uint32              gear[256];                           /* Rolling hash table                           */
+    uint8               page[FLASH4_MAX_PAGE_SIZE];
+} Ota_ChunkStore_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Load the store index into the RAM hash table
+ * \param store Store state
+ * \return FLASH4_OK, FLASH4_ERROR if the store is not formatted
+ */
+uint8 Ota_ChunkStore_Init(Ota_ChunkStore_t *store);
+
+/**
+ * \brief Erase the index and start an empty store, e.g. when it is full
+ * \param store Store state
+ * \return FLASH4_OK or the flash error
+ */
+uint8 Ota_ChunkStore_Format(Ota_ChunkStore_t *store);
+
+/**
+ * \brief Look a chunk up by its hash
+ * \param store Store state
+ * \param hash SHA-256 of the chunk
+ * \return Index entry of the chunk, OTA_CHUNKSTORE_NONE if it is not in the store
+ */
+uint32 Ota_ChunkStore_Find(const Ota_ChunkStore_t *store, const uint8 *hash);
+
+/**
+ * \brief Split an image already in Flash4 into chunks and add the ones not yet in the store
+ * \param store Store state
+ * \param address Flash4 address of the image, e.g. the active slot
+ * \param size Image size in bytes
+ * \param added Number of chunks added, NULL_PTR if not needed
+ * \return FLASH4_OK, FLASH4_ERROR if the store is full
+ */
+uint8 Ota_ChunkStore_ImportImage(Ota_ChunkStore_t *store, uint32 address, uint32 size, uint32 *added);
+
+/**
+ * \brief Start an update with its recipe header
+ * \param store Store state
+ * \param header Recipe header, its signature already checked by the caller
+ * \return FLASH4_OK, FLASH4_ERROR if the header is invalid
+ */
+uint8 Ota_ChunkStore_BeginRecipe(Ota_ChunkStore_t *store, const Ota_RecipeHeader_t *header);
+
+/**
+ * \brief Store the chunk references following the header and check them against listDigest
+ * \param store Store state
+ * \param data Reference data as received
+ * \param length Number of bytes
+ * \return Number of bytes consumed, less than length once all references are received
+ */
+uint32 Ota_ChunkStore_WriteRecipe(Ota_ChunkStore_t *store, const uint8 *data, uint32 length);
+
+/**
+ * \brief Read one chunk reference of the recipe
+ * \param store Store state
+ * \param index Reference index
+ * \param ref Reference read from Flash4, all zero (length 0) if index is not below recipe.chunkCount
+ */
+void Ota_ChunkStore_GetRef(const Ota_ChunkStore_t *store, uint32 index, Ota_ChunkRef_t *ref);
+
+/**
+ * \brief Next reference whose chunk is not in the store
+ * \param store Store state
+ * \param index First reference to check
+ * \return Reference index, recipe.chunkCount if all chunks from index on are present
+ */
+uint32 Ota_ChunkStore_NextMissing(const Ota_ChunkStore_t *store, uint32 index);
+
+/**
+ * \brief Verify a received chunk against its reference and add it to the store
+ * \param store Store state
+ * \param index Reference index in the recipe
+ * \param data Chunk data
+ * \param length Chunk length
+ * \return FLASH4_OK, FLASH4_ERROR if the chunk does not match or the store is full, FLASH4_TIMEOUT
+ */
+uint8 Ota_ChunkStore_AddChunk(Ota_ChunkStore_t *store, uint32 index, const uint8 *data, uint32 length);
+
+/**
+ * \brief Write the image described by the recipe from the store into a slot and check its SHA-256
+ * \param store Store state, all chunks of the recipe present
+ * \param targetAddress Sector aligned Flash4 address, e.g. the inactive slot
+ * \param crc Image CRC for Ota_Slots_RecordDownload()
+ * \return FLASH4_OK, FLASH4_ERROR if a chunk is missing or the image does not match, FLASH4_TIMEOUT
+ */
+uint8 Ota_ChunkStore_Assemble(Ota_ChunkStore_t *store, uint32 targetAddress, uint16 *crc);
+
+#endif /* OTA_CHUNKSTORE_H_ */
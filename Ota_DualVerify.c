@@ -0,0 +1,194 @@
+/**********************************************************************************************************************
+ * \file Ota_DualVerify.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Dual signature check with the job in the DLMU of CPU1
+ *********************************************************************************************************************/
+
+#include "Ota_DualVerify.h"
+#include "Flash4_Driver.h"
+#include "Flash4_Config.h"
+#include "Sha256.h"
+#include "IfxStm.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define DUALVERIFY_NONCACHED_OFFSET 0x20000000u     /* Segment 9 (cached) to segment 11 (non-cached) */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/*
+ * Placed in the DLMU of CPU1 by the linker scripts. The shared state is only accessed through dualVerify(), the
+ * ML-DSA workspace only by core 1 and through the cached range.
+ */
+#if defined(__TASKING__)
+#pragma section farbss "lmubss_cpu1"
+static Ota_DualVerify_t  g_otaDualVerify;
+static MlDsa_Workspace_t g_mlDsaWorkspace;
+#pragma section farbss restore
+#else
+static Ota_DualVerify_t  g_otaDualVerify __attribute__((section(".lmubss_cpu1")));
+static MlDsa_Workspace_t g_mlDsaWorkspace __attribute__((section(".lmubss_cpu1")));
+#endif
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Non-cached alias of the shared state, the same for all cores */
+static Ota_DualVerify_t *dualVerify(void)
+{
+    return (Ota_DualVerify_t *)((uint32)&g_otaDualVerify | DUALVERIFY_NONCACHED_OFFSET);
+}
+
+static void lock(Ota_DualVerify_t *shared)
+{
+    while (!IfxCpu_setSpinLock(&shared->lock, OTA_DUALVERIFY_LOCK_TIMEOUT))
+    {
+    }
+}
+
+static void unlock(Ota_DualVerify_t *shared)
+{
+    IfxCpu_resetSpinLock(&shared->lock);
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+void Ota_DualVerify_ServiceMlDsa(void)
+{
+    Ota_DualVerify_t    *shared = dualVerify();
+    Ota_DualVerifyJob_t *job    = &shared->job;
+    uint32               sequence;
+    uint32               start;
+    boolean              valid;
+
+    lock(shared);
+    sequence = shared->started;
+    unlock(shared);
+
+    if (sequence == shared->mlDsaDone)
+        return;
+
+    /* Core 0 does not change the job until both cores have finished it */
+    start = IfxStm_get(&MODULE_STM0);
+    valid = MlDsa_Verify(&g_mlDsaWorkspace, job->level, job->mlDsaPublicKeyAddress, job->mlDsaSignatureAddress,
+                         job->context, job->contextLength, job->message, job->messageLength);
+
+    lock(shared);
+    shared->mlDsaTicks = IfxStm_get(&MODULE_STM0) - start;
+    shared->mlDsaValid = valid;
+    shared->mlDsaDone  = sequence;
+    unlock(shared);
+}
+
+void Ota_DualVerify_ServiceEcdsa(void)
+{
+    Ota_DualVerify_t    *shared = dualVerify();
+    Ota_DualVerifyJob_t *job    = &shared->job;
+    uint8                digest[SHA256_DIGEST_SIZE];
+    uint32               sequence;
+    uint32               start;
+    boolean              valid;
+
+    lock(shared);
+    sequence = shared->started;
+    unlock(shared);
+
+    if (sequence == shared->ecdsaDone)
+        return;
+
+    start = IfxStm_get(&MODULE_STM0);
+    Sha256_Calculate(job->message, job->messageLength, digest);
+    valid = P256_Verify(job->ecdsaPublicKey, digest, job->ecdsaSignature);
+
+    lock(shared);
+    shared->ecdsaTicks = IfxStm_get(&MODULE_STM0) - start;
+    shared->ecdsaValid = valid;
+    shared->ecdsaDone  = sequence;
+    unlock(shared);
+}
+
+Ota_DualVerifyJob_t *Ota_DualVerify_GetJob(void)
+{
+    return Ota_DualVerify_IsDone() ? &dualVerify()->job : NULL_PTR;
+}
+
+void Ota_DualVerify_Start(void)
+{
+    Ota_DualVerify_t *shared = dualVerify();
+
+    lock(shared);
+    shared->started++;
+    unlock(shared);
+}
+
+boolean Ota_DualVerify_IsDone(void)
+{
+    Ota_DualVerify_t *shared = dualVerify();
+    boolean           done;
+
+    lock(shared);
+    done = (shared->mlDsaDone == shared->started && shared->ecdsaDone == shared->started) ? TRUE : FALSE;
+    unlock(shared);
+
+    return done;
+}
+
+boolean Ota_DualVerify_Join(void)
+{
+    Ota_DualVerify_t *shared = dualVerify();
+    boolean           valid;
+
+    while (!Ota_DualVerify_IsDone())
+    {
+    }
+
+    lock(shared);
+    valid = (shared->mlDsaValid && shared->ecdsaValid) ? TRUE : FALSE;
+    unlock(shared);
+
+    return valid;
+}
+
+void Ota_DualVerify_GetTicks(uint32 *mlDsaTicks, uint32 *ecdsaTicks)
+{
+    Ota_DualVerify_t *shared = dualVerify();
+
+    lock(shared);
+    *mlDsaTicks = shared->mlDsaTicks;
+    *ecdsaTicks = shared->ecdsaTicks;
+    unlock(shared);
+}
+
+boolean Ota_DualVerify_Manifest(const Ota_ManifestHeader_t *header, MlDsa_Level level)
+{
+    static const uint8   context[] = OTA_MANIFEST_SIGNATURE_CONTEXT;
+    Ota_DualVerifyJob_t *job;
+
+    while ((job = Ota_DualVerify_GetJob()) == NULL_PTR)
+    {
+    }
+
+    memcpy(job->message, header, sizeof(Ota_ManifestHeader_t));
+    job->messageLength = sizeof(Ota_ManifestHeader_t);
+    memcpy(job->context, context, sizeof(context) - 1u);
+    job->contextLength         = (uint8)(sizeof(context) - 1u);
+    job->level                 = level;
+    job->mlDsaPublicKeyAddress = OTA_SIGNER_KEY_ADDRESS;
+    job->mlDsaSignatureAddress = OTA_MANIFEST_SIGNATURE_ADDRESS;
+
+    /* The last Flash4 accesses of core 0 until the join */
+    Flash4_ReadBuffer(job->ecdsaPublicKey, OTA_SIGNER_ECDSA_KEY_ADDRESS, P256_PUBLIC_KEY_SIZE);
+    Flash4_ReadBuffer(job->ecdsaSignature, OTA_MANIFEST_ECDSA_SIGNATURE_ADDRESS, P256_SIGNATURE_SIZE);
+
+    Ota_DualVerify_Start();
+
+    return Ota_DualVerify_Join();
+}
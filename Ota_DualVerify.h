@@ -0,0 +1,124 @@
+/**********************************************************************************************************************
+ * \file Ota_DualVerify.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Dual signature check of OTA manifests: ECDSA P-256 on core 2 and ML-DSA on core 1 at the same time
+ * A manifest header carries a classical and a post-quantum signature and is only accepted if both verify. The two
+ * checks share nothing but the message, so core 0 posts one job, core 1 runs the ML-DSA verification and core 2
+ * the ECDSA verification, and core 0 joins both results. The boot check then takes about as long as the slower
+ * of the two verifications instead of their sum.
+ *
+ * The job and the results sit in the DLMU of CPU1 and are accessed through the non-cached address range under a
+ * spinlock, as in Ota_Pipeline.h. The ML-DSA key and signature are streamed from Flash4 by core 1, so core 0 must
+ * not use Flash4 between Ota_DualVerify_Start() and the end of the job, and it has to keep its interrupts enabled
+ * since the QSPI interrupts are serviced by CPU0. The ECDSA key and signature are 64 bytes each and are copied into
+ * the job by core 0 beforehand, so core 2 never touches Flash4.
+ *
+ * Core 1 calls Ota_DualVerify_ServiceMlDsa() and core 2 Ota_DualVerify_ServiceEcdsa() from their main loops, see
+ * Cpu1_Main.c and Cpu2_Main.c. All other functions are for core 0.
+ *********************************************************************************************************************/
+
+#ifndef OTA_DUALVERIFY_H_
+#define OTA_DUALVERIFY_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "MlDsa.h"
+#include "P256.h"
+#include "Ota_Manifest.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define OTA_DUALVERIFY_MAX_MESSAGE_SIZE          256         /* Signed part of the manifest                  */
+#define OTA_DUALVERIFY_LOCK_TIMEOUT              0xFFFFu     /* Spin count per attempt to take the lock      */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint8       message[OTA_DUALVERIFY_MAX_MESSAGE_SIZE];
+    uint32      messageLength;
+    uint8       context[MLDSA_MAX_CONTEXT_SIZE];         /* ML-DSA context string                   */
+    uint8       contextLength;
+    MlDsa_Level level;
+    uint32      mlDsaPublicKeyAddress;                   /* Flash4, read by core 1                  */
+    uint32      mlDsaSignatureAddress;
+    uint8       ecdsaPublicKey[P256_PUBLIC_KEY_SIZE];    /* Copied by core 0                        */
+    uint8       ecdsaSignature[P256_SIGNATURE_SIZE];
+} Ota_DualVerifyJob_t;
+
+typedef struct
+{
+    IfxCpu_spinLock     lock;
+    uint32              started;            /* Jobs posted by core 0                          */
+    uint32              mlDsaDone;          /* Jobs finished by core 1                        */
+    uint32              ecdsaDone;          /* Jobs finished by core 2                        */
+    boolean             mlDsaValid;
+    boolean             ecdsaValid;
+    uint32              mlDsaTicks;         /* STM ticks of the last verification on core 1   */
+    uint32              ecdsaTicks;         /* STM ticks of the last verification on core 2   */
+    Ota_DualVerifyJob_t job;
+} Ota_DualVerify_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Run the ML-DSA check of a posted job, called by core 1 in its main loop
+ * Returns at once if there is nothing to do.
+ */
+void Ota_DualVerify_ServiceMlDsa(void);
+
+/**
+ * \brief Run the ECDSA check of a posted job, called by core 2 in its main loop
+ * Returns at once if there is nothing to do.
+ */
+void Ota_DualVerify_ServiceEcdsa(void);
+
+/**
+ * \brief Job to fill in before Ota_DualVerify_Start()
+ * \return Job in the shared memory, NULL_PTR while the previous job is still running
+ */
+Ota_DualVerifyJob_t *Ota_DualVerify_GetJob(void);
+
+/**
+ * \brief Hand the job from Ota_DualVerify_GetJob() to cores 1 and 2
+ */
+void Ota_DualVerify_Start(void);
+
+/**
+ * \brief Check whether both cores have finished the job
+ * \return TRUE if the results are available
+ */
+boolean Ota_DualVerify_IsDone(void);
+
+/**
+ * \brief Wait for both checks of the job and combine them
+ * \return TRUE if both signatures are valid, FALSE otherwise
+ */
+boolean Ota_DualVerify_Join(void);
+
+/**
+ * \brief Time each core spent on its check of the last job, for the diagnostic interface
+ * \param mlDsaTicks Output, STM ticks on core 1
+ * \param ecdsaTicks Output, STM ticks on core 2
+ */
+void Ota_DualVerify_GetTicks(uint32 *mlDsaTicks, uint32 *ecdsaTicks);
+
+/**
+ * \brief Verify both signatures of a manifest header with the keys and signatures of the memory map
+ * Reads the ECDSA key and signature from Flash4, posts the job and joins it. Core 1 and core 2 must be running
+ * their service functions.
+ * \param header Manifest header as received
+ * \param level Parameter set of the ML-DSA signer key
+ * \return TRUE if both signatures are valid, FALSE otherwise
+ */
+boolean Ota_DualVerify_Manifest(const Ota_ManifestHeader_t *header, MlDsa_Level level);
+
+#endif /* OTA_DUALVERIFY_H_ */
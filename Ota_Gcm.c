@@ -0,0 +1,182 @@
+/**********************************************************************************************************************
+ * \file Ota_Gcm.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Streaming AES-GCM decryption of encrypted OTA payloads
+ *********************************************************************************************************************/
+
+#include "Ota_Gcm.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static boolean isValidHeader(const Ota_GcmHeader_t *header)
+{
+    return (header->magic == OTA_GCM_MAGIC && header->version == OTA_GCM_VERSION && header->chunkSize > 0u &&
+            header->chunkSize <= OTA_GCM_MAX_CHUNK_SIZE && header->imageSize > 0u &&
+            header->imageSize <= OTA_SLOT_SIZE) ? TRUE : FALSE;
+}
+
+static void startChunk(Ota_Gcm_t *gcm)
+{
+    uint8  iv[AESGCM_IV_SIZE];
+    uint32 remaining = gcm->header.imageSize - gcm->committed;
+
+    memcpy(iv, gcm->header.nonce, OTA_GCM_NONCE_SIZE);
+    iv[8]  = (uint8)(gcm->chunkIndex >> 24);
+    iv[9]  = (uint8)(gcm->chunkIndex >> 16);
+    iv[10] = (uint8)(gcm->chunkIndex >> 8);
+    iv[11] = (uint8)gcm->chunkIndex;
+    AesGcm_Start(&gcm->gcm, iv, (const uint8 *)&gcm->header, sizeof(Ota_GcmHeader_t));
+
+    gcm->chunkLength = (remaining < gcm->header.chunkSize) ? remaining : gcm->header.chunkSize;
+    gcm->chunkBytes  = 0;
+    gcm->tagBytes    = 0;
+    gcm->state       = Ota_GcmState_data;
+}
+
+/*
+ * Plaintext goes to the free part of the ring behind the data accepted so far, returns 0 if the ring is full or the
+ * writer failed
+ */
+static uint32 decryptData(Ota_Gcm_t *gcm, const uint8 *data, uint32 length)
+{
+    uint32 n;
+    uint8 *buffer = Ota_StreamWriter_GetBuffer(gcm->writer, gcm->chunkBytes, &n);
+
+    if (buffer == NULL_PTR)
+    {
+        /* The ring does not drain anymore after a program or erase error */
+        if (Ota_StreamWriter_GetStatus(gcm->writer) != FLASH4_OK)
+            gcm->state = Ota_GcmState_error;
+        return 0;
+    }
+
+    if (n > gcm->chunkLength - gcm->chunkBytes)
+        n = gcm->chunkLength - gcm->chunkBytes;
+    if (n > length)
+        n = length;
+
+    AesGcm_Decrypt(&gcm->gcm, data, buffer, n);
+    gcm->chunkBytes += n;
+
+    if (gcm->chunkBytes == gcm->chunkLength)
+        gcm->state = Ota_GcmState_tag;
+
+    return n;
+}
+
+static void checkTag(Ota_Gcm_t *gcm)
+{
+    if (!AesGcm_CheckTag(&gcm->gcm, gcm->tag))
+    {
+        gcm->state = Ota_GcmState_error;
+        return;
+    }
+
+    (void)Ota_StreamWriter_Commit(gcm->writer, gcm->chunkLength);
+    gcm->committed += gcm->chunkLength;
+    gcm->chunkIndex++;
+
+    if (Ota_StreamWriter_GetStatus(gcm->writer) != FLASH4_OK)
+        gcm->state = Ota_GcmState_error;
+    else if (gcm->committed == gcm->header.imageSize)
+        gcm->state = Ota_GcmState_done;
+    else
+        startChunk(gcm);
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+uint8 Ota_Gcm_Init(Ota_Gcm_t *gcm, Ota_StreamWriter_t *writer, uint32 address, const uint8 *key, uint32 keyLength)
+{
+    gcm->writer      = writer;
+    gcm->address     = address;
+    gcm->state       = Ota_GcmState_header;
+    gcm->headerBytes = 0;
+    gcm->chunkIndex  = 0;
+    gcm->chunkLength = 0;
+    gcm->chunkBytes  = 0;
+    gcm->tagBytes    = 0;
+    gcm->committed   = 0;
+
+    if ((keyLength != AES128_KEY_SIZE && keyLength != AES256_KEY_SIZE) || !AesGcm_Init(&gcm->gcm, key, keyLength))
+    {
+        gcm->state = Ota_GcmState_error;
+        return FLASH4_ERROR;
+    }
+
+    return FLASH4_OK;
+}
+
+uint32 Ota_Gcm_Write(Ota_Gcm_t *gcm, const uint8 *data, uint32 length)
+{
+    uint32  used    = 0;
+    boolean stalled = FALSE;
+    uint32  n;
+
+    while (used < length && !stalled && gcm->state != Ota_GcmState_done && gcm->state != Ota_GcmState_error)
+    {
+        switch (gcm->state)
+        {
+            case Ota_GcmState_header:
+                n = sizeof(Ota_GcmHeader_t) - gcm->headerBytes;
+                if (n > length - used)
+                    n = length - used;
+
+                memcpy((uint8 *)&gcm->header + gcm->headerBytes, &data[used], n);
+                gcm->headerBytes += n;
+                used             += n;
+
+                if (gcm->headerBytes == sizeof(Ota_GcmHeader_t))
+                {
+                    if (!isValidHeader(&gcm->header))
+                        gcm->state = Ota_GcmState_error;
+                    else if (Ota_StreamWriter_Init(gcm->writer, gcm->address, gcm->header.imageSize) != FLASH4_OK)
+                        gcm->state = Ota_GcmState_error;
+                    else
+                        startChunk(gcm);
+                }
+                break;
+
+            case Ota_GcmState_data:
+                n        = decryptData(gcm, &data[used], length - used);
+                used    += n;
+                stalled  = (n == 0u);   /* Ring full, the caller offers the rest again */
+                break;
+
+            case Ota_GcmState_tag:
+                n = AESGCM_TAG_SIZE - gcm->tagBytes;
+                if (n > length - used)
+                    n = length - used;
+
+                memcpy(&gcm->tag[gcm->tagBytes], &data[used], n);
+                gcm->tagBytes += n;
+                used          += n;
+
+                if (gcm->tagBytes == AESGCM_TAG_SIZE)
+                    checkTag(gcm);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (gcm->state != Ota_GcmState_header && gcm->state != Ota_GcmState_error)
+        Ota_StreamWriter_Poll(gcm->writer);
+
+    return used;
+}
+
+uint8 Ota_Gcm_Finish(Ota_Gcm_t *gcm, uint32 timeoutMs)
+{
+    if (gcm->state != Ota_GcmState_done)
+        return FLASH4_ERROR;
+
+    return Ota_StreamWriter_Finish(gcm->writer, timeoutMs);
+}
@@ -0,0 +1,112 @@
+/**********************************************************************************************************************
+ * \file Ota_Gcm.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Streaming AES-GCM decryption of encrypted OTA payloads
+ * Images encrypted on the host with Tools/ota_encrypt.c are decrypted as they arrive, straight into the page ring
+ * of an Ota_StreamWriter: the plaintext of a chunk is produced in place in the ring, and only once the tag of the
+ * chunk verifies is it committed and programmed. Unauthenticated data never reaches Flash4, and the image is
+ * written and read once instead of being staged encrypted and decrypted in a second pass.
+ *
+ * Stream layout (little endian):
+ *   Ota_GcmHeader_t                                20 bytes
+ *   chunks                                         chunkSize bytes of ciphertext (the last one shorter),
+ *                                                  each followed by its AESGCM_TAG_SIZE byte tag
+ *
+ * Chunk i is a GCM message with the IV nonce || i (32 bit big endian) and the header as additional data, so chunks
+ * cannot be reordered, dropped or moved to another image, and a changed header fails the first tag. A chunk has to
+ * fit into the ring next to a partly filled page, which limits chunkSize to OTA_GCM_MAX_CHUNK_SIZE.
+ *********************************************************************************************************************/
+
+#ifndef OTA_GCM_H_
+#define OTA_GCM_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+#include "Flash4_Config.h"
+#include "Ota_StreamWriter.h"
+#include "AesGcm.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define OTA_GCM_MAGIC                            0x43473446UL    /* "F4GC" */
+#define OTA_GCM_VERSION                          1
+#define OTA_GCM_NONCE_SIZE                       8
+#define OTA_GCM_MAX_CHUNK_SIZE                   ((OTA_WRITER_RING_PAGES - 1u) * FLASH4_MAX_PAGE_SIZE)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 magic;                           /* OTA_GCM_MAGIC                                   */
+    uint8  version;                         /* OTA_GCM_VERSION                                 */
+    uint8  reserved;
+    uint16 chunkSize;                       /* Plaintext bytes per chunk                       */
+    uint32 imageSize;                       /* Plaintext size, at most OTA_SLOT_SIZE           */
+    uint8  nonce[OTA_GCM_NONCE_SIZE];       /* Random per image, first part of every IV        */
+} Ota_GcmHeader_t;
+
+typedef enum
+{
+    Ota_GcmState_header = 0,
+    Ota_GcmState_data,
+    Ota_GcmState_tag,
+    Ota_GcmState_done,
+    Ota_GcmState_error
+} Ota_GcmState;
+
+typedef struct
+{
+    Ota_StreamWriter_t *writer;
+    uint32              address;            /* Target of the writer                            */
+    AesGcm_t            gcm;
+    Ota_GcmHeader_t     header;
+    Ota_GcmState        state;
+    uint32              headerBytes;
+    uint32              chunkIndex;
+    uint32              chunkLength;        /* Plaintext bytes of the current chunk            */
+    uint32              chunkBytes;         /* Of those decrypted into the ring so far         */
+    uint32              tagBytes;
+    uint32              committed;          /* Authenticated bytes handed to the writer        */
+    uint8               tag[AESGCM_TAG_SIZE];
+} Ota_Gcm_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Prepare decrypting a stream, the writer is started once the stream header has arrived
+ * \param gcm Decryptor state
+ * \param writer Writer for the plaintext
+ * \param address Sector aligned Flash4 address of the plaintext
+ * \param key Image key
+ * \param keyLength AES128_KEY_SIZE or AES256_KEY_SIZE
+ * \return FLASH4_OK, FLASH4_ERROR for an invalid key length
+ */
+uint8 Ota_Gcm_Init(Ota_Gcm_t *gcm, Ota_StreamWriter_t *writer, uint32 address, const uint8 *key, uint32 keyLength);
+
+/**
+ * \brief Decrypt data from the transport into the page ring of the writer
+ * Stops when the input is used up or the ring has no room for the rest of the current chunk.
+ * \param gcm Decryptor state
+ * \param data Encrypted stream data
+ * \param length Number of bytes
+ * \return Number of bytes consumed, the caller offers the rest again later
+ */
+uint32 Ota_Gcm_Write(Ota_Gcm_t *gcm, const uint8 *data, uint32 length);
+
+/**
+ * \brief Complete the stream and wait until the data is programmed
+ * \param gcm Decryptor state
+ * \param timeoutMs Timeout in milliseconds
+ * \return FLASH4_OK, FLASH4_ERROR if the stream is invalid, incomplete or a tag did not match, FLASH4_TIMEOUT
+ */
+uint8 Ota_Gcm_Finish(Ota_Gcm_t *gcm, uint32 timeoutMs);
+
+#endif /* OTA_GCM_H_ */
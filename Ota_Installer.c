@@ -0,0 +1,206 @@
+/**********************************************************************************************************************
+ * \file Ota_Installer.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Overlapped Flash4 to PFlash installer
+ *********************************************************************************************************************/
+
+#include "Ota_Installer.h"
+#include "IfxScuWdt.h"
+#include "IfxStm.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static boolean isBusy(const Ota_Installer_t *installer)
+{
+    return ((DMU_HF_STATUS.U & (1uL << installer->bank)) != 0u) ? TRUE : FALSE;
+}
+
+static uint8 *ringAt(Ota_Installer_t *installer, uint32 offset)
+{
+    return (uint8 *)installer->ring + (offset % OTA_INSTALL_RING_SIZE);
+}
+
+/* PFlash contents at an address, through size_t so hosts with 64-bit pointers (Tools/PFlashModel) cast cleanly */
+static const uint8 *pflashAt(uint32 address)
+{
+    return (const uint8 *)(size_t)address;
+}
+
+static uint32 burstLength(const Ota_Installer_t *installer)
+{
+    uint32 remaining = installer->size - installer->programOffset;
+
+    return (remaining > OTA_INSTALL_BURST_SIZE) ? OTA_INSTALL_BURST_SIZE : remaining;
+}
+
+/* Read the next Flash4 page into the ring if it has room, this is what overlaps the programming */
+static void readAhead(Ota_Installer_t *installer)
+{
+    uint32 n = installer->size - installer->readOffset;
+    uint8 *buffer;
+
+    if (n == 0u || installer->readOffset + OTA_INSTALL_BURST_SIZE > installer->programOffset + OTA_INSTALL_RING_SIZE)
+        return;
+
+    if (n > OTA_INSTALL_BURST_SIZE)
+        n = OTA_INSTALL_BURST_SIZE;
+
+    buffer = ringAt(installer, installer->readOffset);
+    Flash4_ReadBuffer(buffer, installer->source + installer->readOffset, n);
+
+    /* Pad the last burst */
+    if (n < OTA_INSTALL_BURST_SIZE)
+        memset(&buffer[n], 0, OTA_INSTALL_BURST_SIZE - n);
+
+    installer->readOffset += n;
+}
+
+static void startErase(Ota_Installer_t *installer)
+{
+    uint32 address   = installer->target + installer->erasedLimit;
+    uint32 remaining = installer->size - installer->erasedLimit;
+    uint32 count     = (remaining + OTA_INSTALL_SECTOR_SIZE - 1u) / OTA_INSTALL_SECTOR_SIZE;
+    uint32 boundary  = (OTA_INSTALL_PHYSICAL_SECTOR_SIZE - (address % OTA_INSTALL_PHYSICAL_SECTOR_SIZE)) /
+                       OTA_INSTALL_SECTOR_SIZE;
+    uint16 password;
+
+    if (count > OTA_INSTALL_ERASE_SECTORS)
+        count = OTA_INSTALL_ERASE_SECTORS;
+    if (count > boundary)
+        count = boundary;
+
+    password = IfxScuWdt_getSafetyWatchdogPasswordInline();
+    IfxScuWdt_clearSafetyEndinitInline(password);
+    IfxFlash_eraseMultipleSectors(address, count);
+    IfxScuWdt_setSafetyEndinitInline(password);
+
+    installer->erasedLimit += count * OTA_INSTALL_SECTOR_SIZE;
+    installer->state        = Ota_InstallState_erasing;
+}
+
+static void startBurst(Ota_Installer_t *installer)
+{
+    uint32        address = installer->target + installer->programOffset;
+    const uint32 *words   = (const uint32 *)ringAt(installer, installer->programOffset);
+    uint32        i;
+    uint16        password;
+
+    (void)IfxFlash_enterPageMode(address);
+    (void)IfxFlash_waitUnbusy(0, installer->bank);
+
+    for (i = 0; i < OTA_INSTALL_BURST_SIZE / 4u; i += 2u)
+        IfxFlash_loadPage2X32(address, words[i], words[i + 1u]);
+
+    password = IfxScuWdt_getSafetyWatchdogPasswordInline();
+    IfxScuWdt_clearSafetyEndinitInline(password);
+    IfxFlash_writeBurst(address);
+    IfxScuWdt_setSafetyEndinitInline(password);
+
+    installer->state = Ota_InstallState_programming;
+}
+
+static void reportProgress(Ota_Installer_t *installer)
+{
+    if (installer->progress != NULL_PTR &&
+        (installer->programOffset - installer->reported >= OTA_INSTALL_PROGRESS_STEP ||
+         installer->programOffset == installer->size))
+    {
+        installer->reported = installer->programOffset;
+        installer->progress(installer->programOffset, installer->size);
+    }
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+uint8 Ota_Installer_Init(Ota_Installer_t *installer, uint32 source, uint32 target, uint32 size,
+                         Ota_InstallProgress progress)
+{
+    installer->state = Ota_InstallState_error;
+
+    if (size == 0u || (target % OTA_INSTALL_SECTOR_SIZE) != 0u)
+        return FLASH4_ERROR;
+
+    if (target >= IFXFLASH_PFLASH_P0_START && target + size - 1u <= IFXFLASH_PFLASH_P0_END)
+        installer->bank = IfxFlash_FlashType_P0;
+    else if (target >= IFXFLASH_PFLASH_P1_START && target + size - 1u <= IFXFLASH_PFLASH_P1_END)
+        installer->bank = IfxFlash_FlashType_P1;
+    else
+        return FLASH4_ERROR;
+
+    installer->source        = source;
+    installer->target        = target;
+    installer->size          = size;
+    installer->progress      = progress;
+    installer->readOffset    = 0;
+    installer->programOffset = 0;
+    installer->erasedLimit   = 0;
+    installer->reported      = 0;
+    installer->state         = Ota_InstallState_idle;
+
+    return FLASH4_OK;
+}
+
+void Ota_Installer_Poll(Ota_Installer_t *installer)
+{
+    if (installer->state == Ota_InstallState_done || installer->state == Ota_InstallState_error)
+        return;
+
+    if (installer->state != Ota_InstallState_idle && isBusy(installer))
+    {
+        readAhead(installer);
+        return;
+    }
+
+    if (installer->state == Ota_InstallState_programming)
+    {
+        uint32 length = burstLength(installer);
+
+        /* Compare through the non-cached PFlash address */
+        if (memcmp(pflashAt(installer->target + installer->programOffset), ringAt(installer, installer->programOffset),
+                   length) != 0)
+        {
+            installer->state = Ota_InstallState_error;
+            return;
+        }
+
+        installer->programOffset += length;
+        reportProgress(installer);
+    }
+
+    installer->state = Ota_InstallState_idle;
+
+    if (installer->programOffset == installer->size)
+    {
+        installer->state = Ota_InstallState_done;
+        return;
+    }
+
+    /* Programming waits for the erase of the same bank, the read-ahead fills the ring meanwhile */
+    if (installer->programOffset >= installer->erasedLimit)
+        startErase(installer);
+    else if (installer->readOffset >= installer->programOffset + burstLength(installer))
+        startBurst(installer);
+
+    readAhead(installer);
+}
+
+uint8 Ota_Installer_Run(Ota_Installer_t *installer, uint32 timeoutMs)
+{
+    uint32 startTime    = IfxStm_get(&MODULE_STM0);
+    uint32 timeoutTicks = timeoutMs * (uint32)(IfxStm_getFrequency(&MODULE_STM0) / 1000u);
+
+    while (installer->state != Ota_InstallState_done && installer->state != Ota_InstallState_error)
+    {
+        if ((IfxStm_get(&MODULE_STM0) - startTime) > timeoutTicks)
+            return FLASH4_TIMEOUT;
+        Ota_Installer_Poll(installer);
+    }
+
+    return (installer->state == Ota_InstallState_done) ? FLASH4_OK : FLASH4_ERROR;
+}
@@ -0,0 +1,96 @@
+/**********************************************************************************************************************
+ * \file Ota_Installer.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Installer copying a staged image from Flash4 into the internal program flash (PFlash)
+ * PFlash erase and burst programming run autonomously in the flash module once started. The installer uses that
+ * time to read the following data from Flash4 into a ring buffer, so the QSPI transfers overlap the programming
+ * instead of adding to it. Each burst is compared with the buffer after programming.
+ *
+ * Ota_Installer_Poll() advances in small steps: finish a burst, start the next erase or burst as soon as the bank
+ * is idle, and read one Flash4 page while it is busy. Ota_Installer_Run() polls until the image is installed.
+ *
+ * The installer must not execute from the PFlash bank it programs: run it from the other bank or from PSPR.
+ *********************************************************************************************************************/
+
+#ifndef OTA_INSTALLER_H_
+#define OTA_INSTALLER_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+#include "IfxFlash.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define OTA_INSTALL_BURST_SIZE                   IFXFLASH_PFLASH_BURST_LENGTH    /* 256 bytes                   */
+#define OTA_INSTALL_SECTOR_SIZE                  0x4000UL    /* PFlash logical sector                             */
+#define OTA_INSTALL_PHYSICAL_SECTOR_SIZE         0x100000UL  /* Multi-sector erase stays inside one               */
+#define OTA_INSTALL_ERASE_SECTORS                4           /* Logical sectors per erase command                 */
+#define OTA_INSTALL_RING_SIZE                    8192        /* Read-ahead, multiple of OTA_INSTALL_BURST_SIZE    */
+#define OTA_INSTALL_PROGRESS_STEP                0x4000UL    /* Bytes between two progress callbacks              */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef enum
+{
+    Ota_InstallState_idle = 0,      /* Nothing running in the flash module              */
+    Ota_InstallState_erasing,       /* Erase command running                            */
+    Ota_InstallState_programming,   /* Burst running                                    */
+    Ota_InstallState_done,          /* Image installed and compared                     */
+    Ota_InstallState_error          /* Programmed data differs from the source          */
+} Ota_InstallState;
+
+/* Called every OTA_INSTALL_PROGRESS_STEP bytes and once at the end */
+typedef void (*Ota_InstallProgress)(uint32 installed, uint32 total);
+
+typedef struct
+{
+    uint32              source;             /* Flash4 address of the image               */
+    uint32              target;             /* PFlash address, logical sector aligned    */
+    uint32              size;               /* Image size in bytes                       */
+    Ota_InstallProgress progress;           /* NULL_PTR: no reporting                    */
+    Ota_InstallState    state;
+    IfxFlash_FlashType  bank;               /* Bank of the target                        */
+    uint32              readOffset;         /* Bytes read from Flash4                    */
+    uint32              programOffset;      /* Bytes programmed and compared             */
+    uint32              erasedLimit;        /* Offset up to which the target is erased   */
+    uint32              reported;           /* Last progress value reported              */
+    uint32              ring[OTA_INSTALL_RING_SIZE / 4u];  /* Word aligned for the page loads */
+} Ota_Installer_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Prepare an installation
+ * \param installer Installer state
+ * \param source Flash4 address of the staged image
+ * \param target PFlash address, aligned to OTA_INSTALL_SECTOR_SIZE, the range must lie in one bank
+ * \param size Image size in bytes, the last burst is padded with zeros
+ * \param progress Progress callback, NULL_PTR if not needed
+ * \return FLASH4_OK, FLASH4_ERROR if the target range is invalid
+ */
+uint8 Ota_Installer_Init(Ota_Installer_t *installer, uint32 source, uint32 target, uint32 size,
+                         Ota_InstallProgress progress);
+
+/**
+ * \brief Advance the installation without waiting for the flash
+ * \param installer Installer state
+ */
+void Ota_Installer_Poll(Ota_Installer_t *installer);
+
+/**
+ * \brief Install the whole image
+ * \param installer Installer state
+ * \param timeoutMs Timeout in milliseconds
+ * \return FLASH4_OK, FLASH4_ERROR if a burst does not match the source, FLASH4_TIMEOUT
+ */
+uint8 Ota_Installer_Run(Ota_Installer_t *installer, uint32 timeoutMs);
+
+#endif /* OTA_INSTALLER_H_ */
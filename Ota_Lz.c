@@ -0,0 +1,296 @@
+/**********************************************************************************************************************
+ * \file Ota_Lz.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Streaming LZ decompressor for OTA payloads
+ *********************************************************************************************************************/
+
+#include "Ota_Lz.h"
+#include "Crc16.h"
+#include "IfxStm.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define LZ_WINDOW_MASK              (OTA_LZ_WINDOW_SIZE - 1u)
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static boolean isValidHeader(const Ota_Lz_t *lz)
+{
+    Ota_LzHeader_t header = lz->header;
+
+    header.headerCrc = 0;
+
+    return (header.magic == OTA_LZ_MAGIC && header.version == OTA_LZ_VERSION &&
+            header.windowBits <= OTA_LZ_WINDOW_BITS && header.originalSize > 0u &&
+            header.originalSize <= OTA_SLOT_SIZE &&
+            Crc16_Calculate((const uint8 *)&header, sizeof(header)) == lz->header.headerCrc) ? TRUE : FALSE;
+}
+
+/* Sequence complete, the stream ends with the literals of the last one */
+static Ota_LzState afterLiterals(const Ota_Lz_t *lz)
+{
+    return (lz->produced == lz->header.originalSize) ? Ota_LzState_done : Ota_LzState_offsetLow;
+}
+
+static void copyMatch(Ota_Lz_t *lz, uint32 length)
+{
+    while (length > 0u)
+    {
+        uint32 dst = lz->produced & LZ_WINDOW_MASK;
+        uint32 src = (lz->produced - lz->offset) & LZ_WINDOW_MASK;
+        uint32 run = length;
+
+        if (run > OTA_LZ_WINDOW_SIZE - dst)
+            run = OTA_LZ_WINDOW_SIZE - dst;
+        if (run > OTA_LZ_WINDOW_SIZE - src)
+            run = OTA_LZ_WINDOW_SIZE - src;
+
+        if (lz->offset >= run && OTA_LZ_WINDOW_SIZE - lz->offset >= run)
+        {
+            memcpy(&lz->window[dst], &lz->window[src], run);
+        }
+        else
+        {
+            /* Overlapping match, e.g. a run of one repeated byte */
+            uint8       *d = &lz->window[dst];
+            const uint8 *s = &lz->window[src];
+            uint32       i;
+
+            for (i = 0; i < run; i++)
+                d[i] = s[i];
+        }
+
+        lz->produced += run;
+        length       -= run;
+    }
+}
+
+/* Pass decoded data to the writer, FALSE while the writer is busy or after it failed */
+static boolean flushOutput(Ota_Lz_t *lz)
+{
+    const uint8 *data;
+    uint32       n;
+
+    while ((n = Ota_Lz_GetOutput(lz, &data)) > 0u)
+    {
+        uint32 taken = Ota_StreamWriter_Write(lz->writer, data, n);
+
+        Ota_Lz_Release(lz, taken);
+        if (Ota_StreamWriter_GetStatus(lz->writer) != FLASH4_OK)
+        {
+            /* The image cannot be completed, the rest of the window is dropped like the writer drops it */
+            lz->released = lz->produced;
+            lz->state    = Ota_LzState_error;
+            return FALSE;
+        }
+        if (taken < n)
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+void Ota_Lz_Init(Ota_Lz_t *lz, Ota_StreamWriter_t *writer, uint32 address)
+{
+    lz->writer        = writer;
+    lz->address       = address;
+    lz->state         = Ota_LzState_header;
+    lz->headerBytes   = 0;
+    lz->literalLength = 0;
+    lz->matchLength   = 0;
+    lz->offset        = 0;
+    lz->produced      = 0;
+    lz->released      = 0;
+    lz->crc           = CRC16_INIT_VALUE;
+}
+
+uint32 Ota_Lz_Decode(Ota_Lz_t *lz, const uint8 *data, uint32 length)
+{
+    uint32 used = 0;
+
+    for (;;)
+    {
+        uint32 space = OTA_LZ_WINDOW_SIZE - (lz->produced - lz->released);
+        uint32 n;
+        uint8  byte;
+
+        if (lz->state == Ota_LzState_match)
+        {
+            n = (lz->matchLength < space) ? lz->matchLength : space;
+            if (n == 0u)
+                break;
+
+            copyMatch(lz, n);
+            lz->matchLength -= n;
+            if (lz->matchLength == 0u)
+                lz->state = Ota_LzState_token;
+            continue;
+        }
+
+        if (used == length || lz->state == Ota_LzState_done || lz->state == Ota_LzState_error)
+            break;
+
+        switch (lz->state)
+        {
+            case Ota_LzState_header:
+                n = sizeof(Ota_LzHeader_t) - lz->headerBytes;
+                if (n > length - used)
+                    n = length - used;
+
+                memcpy((uint8 *)&lz->header + lz->headerBytes, &data[used], n);
+                lz->headerBytes += n;
+                used            += n;
+
+                if (lz->headerBytes == sizeof(Ota_LzHeader_t))
+                {
+                    if (!isValidHeader(lz))
+                        lz->state = Ota_LzState_error;
+                    else if (lz->writer != NULL_PTR &&
+                             Ota_StreamWriter_Init(lz->writer, lz->address, lz->header.originalSize) != FLASH4_OK)
+                        lz->state = Ota_LzState_error;
+                    else
+                        lz->state = Ota_LzState_token;
+                }
+                break;
+
+            case Ota_LzState_token:
+                byte              = data[used++];
+                lz->literalLength = byte >> 4;
+                lz->matchLength   = (uint32)(byte & 0x0Fu) + OTA_LZ_MIN_MATCH;
+                lz->state         = (lz->literalLength == 15u) ? Ota_LzState_literalLength :
+                                    (lz->literalLength > 0u)   ? Ota_LzState_literals : afterLiterals(lz);
+                break;
+
+            case Ota_LzState_literalLength:
+                byte               = data[used++];
+                lz->literalLength += byte;
+                if (byte != 255u)
+                    lz->state = Ota_LzState_literals;
+                break;
+
+            case Ota_LzState_literals:
+                if (lz->literalLength > lz->header.originalSize - lz->produced)
+                {
+                    lz->state = Ota_LzState_error;
+                    break;
+                }
+
+                n = lz->literalLength;
+                if (n > length - used)
+                    n = length - used;
+                if (n > space)
+                    n = space;
+                if (n > OTA_LZ_WINDOW_SIZE - (lz->produced & LZ_WINDOW_MASK))
+                    n = OTA_LZ_WINDOW_SIZE - (lz->produced & LZ_WINDOW_MASK);
+                if (n == 0u)
+                    return used;
+
+                memcpy(&lz->window[lz->produced & LZ_WINDOW_MASK], &data[used], n);
+                used              += n;
+                lz->produced      += n;
+                lz->literalLength -= n;
+                if (lz->literalLength == 0u)
+                    lz->state = afterLiterals(lz);
+                break;
+
+            case Ota_LzState_offsetLow:
+                lz->offset = data[used++];
+                lz->state  = Ota_LzState_offsetHigh;
+                break;
+
+            case Ota_LzState_offsetHigh:
+                lz->offset |= (uint32)data[used++] << 8;
+                if (lz->offset == 0u || lz->offset > OTA_LZ_WINDOW_SIZE || lz->offset > lz->produced)
+                    lz->state = Ota_LzState_error;
+                else
+                    lz->state = (lz->matchLength == 15u + OTA_LZ_MIN_MATCH) ? Ota_LzState_matchLength :
+                                                                             Ota_LzState_match;
+                break;
+
+            case Ota_LzState_matchLength:
+                byte             = data[used++];
+                lz->matchLength += byte;
+                if (byte != 255u)
+                    lz->state = Ota_LzState_match;
+                break;
+
+            default:
+                break;
+        }
+
+        if (lz->state == Ota_LzState_match && lz->matchLength > lz->header.originalSize - lz->produced)
+            lz->state = Ota_LzState_error;
+    }
+
+    return used;
+}
+
+uint32 Ota_Lz_GetOutput(const Ota_Lz_t *lz, const uint8 **data)
+{
+    uint32 start = lz->released & LZ_WINDOW_MASK;
+    uint32 n     = lz->produced - lz->released;
+
+    if (n > OTA_LZ_WINDOW_SIZE - start)
+        n = OTA_LZ_WINDOW_SIZE - start;
+
+    *data = &lz->window[start];
+    return n;
+}
+
+void Ota_Lz_Release(Ota_Lz_t *lz, uint32 length)
+{
+    lz->crc       = Crc16_Update(lz->crc, &lz->window[lz->released & LZ_WINDOW_MASK], length);
+    lz->released += length;
+}
+
+uint32 Ota_Lz_Write(Ota_Lz_t *lz, const uint8 *data, uint32 length)
+{
+    uint32 used = 0;
+
+    while (flushOutput(lz))
+    {
+        uint32 n = Ota_Lz_Decode(lz, &data[used], length - used);
+
+        used += n;
+        if (lz->produced == lz->released)
+            break;
+    }
+
+    if (lz->state != Ota_LzState_header && lz->state != Ota_LzState_error)
+        Ota_StreamWriter_Poll(lz->writer);
+
+    return used;
+}
+
+uint8 Ota_Lz_Finish(Ota_Lz_t *lz, uint32 timeoutMs)
+{
+    uint32 startTime    = IfxStm_get(&MODULE_STM0);
+    uint32 timeoutTicks = timeoutMs * (uint32)(IfxStm_getFrequency(&MODULE_STM0) / 1000u);
+    uint8  result;
+
+    /* A match may still be pending behind a full window */
+    while ((lz->produced != lz->released || lz->state == Ota_LzState_match) && lz->state != Ota_LzState_error)
+    {
+        if ((IfxStm_get(&MODULE_STM0) - startTime) > timeoutTicks)
+            return FLASH4_TIMEOUT_ERROR;
+        (void)Ota_Lz_Write(lz, NULL_PTR, 0u);
+    }
+
+    if (lz->state != Ota_LzState_done)
+        return FLASH4_ERROR;
+
+    result = Ota_StreamWriter_Finish(lz->writer, timeoutMs);
+    if (result != FLASH4_OK)
+        return result;
+
+    return (lz->crc == lz->header.originalCrc) ? FLASH4_OK : FLASH4_ERROR;
+}
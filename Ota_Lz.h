@@ -0,0 +1,142 @@
+/**********************************************************************************************************************
+ * \file Ota_Lz.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Streaming LZ decompressor for OTA payloads
+ * Images compressed on the host with Tools/ota_lz.c are decoded as they arrive and handed to an Ota_StreamWriter.
+ * The decoder keeps only a window of 2^OTA_LZ_WINDOW_BITS bytes; decoded data is passed to the writer straight
+ * out of the window, so there is no further output buffer.
+ *
+ * Stream layout (little endian):
+ *   Ota_LzHeader_t                                 20 bytes
+ *   sequences                                      LZ4 block format
+ *
+ * Sequence: token (literal length << 4 | match length - 4), literal length extension bytes if 15, literals,
+ * 16 bit match offset, match length extension bytes if 15. Extension bytes add up, 255 means another follows.
+ * The last sequence has literals only. Everything is byte aligned, decoding needs no bit operations and
+ * non-overlapping matches are copied with memcpy.
+ *********************************************************************************************************************/
+
+#ifndef OTA_LZ_H_
+#define OTA_LZ_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+#include "Flash4_Config.h"
+#include "Ota_StreamWriter.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define OTA_LZ_MAGIC                             0x5A4C3446UL    /* "F4LZ" */
+#define OTA_LZ_VERSION                           1
+
+#ifndef OTA_LZ_WINDOW_BITS
+#define OTA_LZ_WINDOW_BITS                       12          /* 4 KB window, streams with a larger window are rejected */
+#endif
+#define OTA_LZ_WINDOW_SIZE                       (1u << OTA_LZ_WINDOW_BITS)
+#define OTA_LZ_MIN_MATCH                         4
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 magic;           /* OTA_LZ_MAGIC                                    */
+    uint8  version;         /* OTA_LZ_VERSION                                  */
+    uint8  windowBits;      /* Window used by the compressor                   */
+    uint16 reserved;
+    uint32 originalSize;    /* Decompressed size, at most OTA_SLOT_SIZE        */
+    uint32 compressedSize;  /* Stream size including this header               */
+    uint16 originalCrc;     /* CRC-16 of the decompressed data                 */
+    uint16 headerCrc;       /* CRC-16 over the header with headerCrc = 0       */
+} Ota_LzHeader_t;
+
+typedef enum
+{
+    Ota_LzState_header = 0,
+    Ota_LzState_token,
+    Ota_LzState_literalLength,
+    Ota_LzState_literals,
+    Ota_LzState_offsetLow,
+    Ota_LzState_offsetHigh,
+    Ota_LzState_matchLength,
+    Ota_LzState_match,
+    Ota_LzState_done,
+    Ota_LzState_error
+} Ota_LzState;
+
+typedef struct
+{
+    Ota_StreamWriter_t *writer;             /* NULL_PTR: output taken with Ota_Lz_GetOutput() */
+    uint32              address;            /* Target of the writer                           */
+    Ota_LzHeader_t      header;
+    Ota_LzState         state;
+    uint32              headerBytes;
+    uint32              literalLength;
+    uint32              matchLength;
+    uint32              offset;
+    uint32              produced;           /* Bytes decoded into the window                  */
+    uint32              released;           /* Bytes taken out of the window                  */
+    uint16              crc;                /* Running CRC of the released data               */
+    uint8               window[OTA_LZ_WINDOW_SIZE];
+} Ota_Lz_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Prepare decoding a stream, the writer is started once the stream header has arrived
+ * \param lz Decoder state
+ * \param writer Writer for the decompressed data, NULL_PTR to take the output with Ota_Lz_GetOutput()
+ * \param address Sector aligned Flash4 address of the decompressed data
+ */
+void Ota_Lz_Init(Ota_Lz_t *lz, Ota_StreamWriter_t *writer, uint32 address);
+
+/**
+ * \brief Decode compressed data into the window
+ * Stops when the input is used up or the window is full of data not yet released.
+ * \param lz Decoder state
+ * \param data Compressed data
+ * \param length Number of bytes
+ * \return Number of bytes consumed
+ */
+uint32 Ota_Lz_Decode(Ota_Lz_t *lz, const uint8 *data, uint32 length);
+
+/**
+ * \brief Decoded data not yet released, contiguous part only
+ * \param lz Decoder state
+ * \param data Output pointer into the window
+ * \return Number of bytes at data
+ */
+uint32 Ota_Lz_GetOutput(const Ota_Lz_t *lz, const uint8 **data);
+
+/**
+ * \brief Release decoded data, making room in the window
+ * \param lz Decoder state
+ * \param length Number of bytes, at most the value returned by Ota_Lz_GetOutput()
+ */
+void Ota_Lz_Release(Ota_Lz_t *lz, uint32 length);
+
+/**
+ * \brief Decode compressed data from the transport and pass the result to the writer
+ * \param lz Decoder state
+ * \param data Compressed data
+ * \param length Number of bytes
+ * \return Number of bytes consumed, the caller offers the rest again later
+ */
+uint32 Ota_Lz_Write(Ota_Lz_t *lz, const uint8 *data, uint32 length);
+
+/**
+ * \brief Complete the stream and wait until the data is programmed
+ * \param lz Decoder state
+ * \param timeoutMs Timeout in milliseconds
+ * \return FLASH4_OK, FLASH4_ERROR if the stream is invalid, incomplete or fails its CRC, FLASH4_TIMEOUT
+ */
+uint8 Ota_Lz_Finish(Ota_Lz_t *lz, uint32 timeoutMs);
+
+#endif /* OTA_LZ_H_ */
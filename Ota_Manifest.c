@@ -0,0 +1,378 @@
+/**********************************************************************************************************************
+ * \file Ota_Manifest.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Chunked image manifest with per-chunk verification
+ *********************************************************************************************************************/
+
+#include "Ota_Manifest.h"
+#include "Crc16.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define MANIFEST_NODE_PREFIX        0x01
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static boolean isValidHeader(const Ota_ManifestHeader_t *header, uint32 imageAddress)
+{
+    uint32 chunkSize;
+
+    if (header->magic != OTA_MANIFEST_MAGIC || header->version != OTA_MANIFEST_VERSION ||
+        header->chunkBits < OTA_MANIFEST_MIN_CHUNK_BITS || header->chunkBits > OTA_MANIFEST_MAX_CHUNK_BITS ||
+        header->imageSize == 0u || header->imageSize > OTA_SLOT_SIZE || (imageAddress % FLASH4_SECTOR_SIZE) != 0u)
+        return FALSE;
+
+    chunkSize = 1uL << header->chunkBits;
+
+    return (header->chunkCount == (header->imageSize + chunkSize - 1u) >> header->chunkBits &&
+            header->chunkCount <= OTA_MANIFEST_MAX_CHUNKS) ? TRUE : FALSE;
+}
+
+static uint32 chunkLength(const Ota_Manifest_t *manifest, uint32 index)
+{
+    uint32 offset = index << manifest->header.chunkBits;
+    uint32 length = manifest->header.imageSize - offset;
+
+    return (length > (1uL << manifest->header.chunkBits)) ? (1uL << manifest->header.chunkBits) : length;
+}
+
+static boolean isDone(const Ota_Manifest_t *manifest, uint32 index)
+{
+    return ((manifest->done[index / 32u] & (1uL << (index % 32u))) != 0u) ? TRUE : FALSE;
+}
+
+static void hashNode(const uint8 *left, const uint8 *right, uint8 *digest)
+{
+    Sha256_t ctx;
+    uint8    prefix = MANIFEST_NODE_PREFIX;
+
+    Sha256_Init(&ctx);
+    Sha256_Update(&ctx, &prefix, 1);
+    Sha256_Update(&ctx, left, SHA256_DIGEST_SIZE);
+    Sha256_Update(&ctx, right, SHA256_DIGEST_SIZE);
+    Sha256_Final(&ctx, digest);
+}
+
+/* Add the next leaf, merging complete subtrees of equal height */
+static void pushLeaf(Ota_Manifest_t *manifest, const uint8 *leaf)
+{
+    uint8 depth = manifest->treeDepth;
+
+    memcpy(manifest->tree[depth], leaf, SHA256_DIGEST_SIZE);
+    manifest->treeHeight[depth] = 0;
+    depth++;
+
+    while (depth >= 2u && manifest->treeHeight[depth - 1u] == manifest->treeHeight[depth - 2u])
+    {
+        hashNode(manifest->tree[depth - 2u], manifest->tree[depth - 1u], manifest->tree[depth - 2u]);
+        manifest->treeHeight[depth - 2u]++;
+        depth--;
+    }
+
+    manifest->treeDepth = depth;
+}
+
+/* Fold the remaining subtrees from the right into the root */
+static boolean isValidRoot(Ota_Manifest_t *manifest)
+{
+    uint8 depth = manifest->treeDepth;
+
+    while (depth >= 2u)
+    {
+        hashNode(manifest->tree[depth - 2u], manifest->tree[depth - 1u], manifest->tree[depth - 2u]);
+        depth--;
+    }
+
+    return (memcmp(manifest->tree[0], manifest->header.root, SHA256_DIGEST_SIZE) == 0) ? TRUE : FALSE;
+}
+
+/* Chunk digest against its leaf in flash, the index must lie within the leaves covered by the root */
+static boolean isValidChunk(const Ota_Manifest_t *manifest, uint32 index, const uint8 *digest)
+{
+    uint8 leaf[SHA256_DIGEST_SIZE];
+
+    if (index >= manifest->header.chunkCount || index >= OTA_MANIFEST_MAX_CHUNKS)
+        return FALSE;
+
+    Flash4_ReadFlash4(leaf, OTA_MANIFEST_LEAF_ADDRESS + index * SHA256_DIGEST_SIZE, SHA256_DIGEST_SIZE);
+
+    return (memcmp(leaf, digest, SHA256_DIGEST_SIZE) == 0) ? TRUE : FALSE;
+}
+
+static void resetState(Ota_Manifest_t *manifest, const Ota_ManifestHeader_t *header, uint32 imageAddress)
+{
+    manifest->header        = *header;
+    manifest->imageAddress  = imageAddress;
+    manifest->leafBytes     = 0;
+    manifest->chunksDone    = 0;
+    manifest->erasedSectors = 0;
+    manifest->crcChunks     = 0;
+    manifest->crc           = CRC16_INIT_VALUE;
+    manifest->treeDepth     = 0;
+    memset(manifest->done, 0, sizeof(manifest->done));
+}
+
+/* Clear one bit of the persistent bitmap, programming only ever clears bits so no erase is needed */
+static uint8 persistBit(uint32 offset, uint8 bit)
+{
+    uint8 value = (uint8)~(1u << bit);
+
+    return Flash4_ProgramPage(&value, OTA_MANIFEST_BITMAP_ADDRESS + offset, 1);
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+uint8 Ota_Manifest_Begin(Ota_Manifest_t *manifest, const Ota_ManifestHeader_t *header, uint32 imageAddress)
+{
+    uint8 result;
+
+    manifest->state = Ota_ManifestState_empty;
+    if (!isValidHeader(header, imageAddress))
+        return FLASH4_ERROR;
+
+    resetState(manifest, header, imageAddress);
+
+    /* Also erases the bitmap page: no chunk done, chunk hashes not verified */
+    result = Flash4_EraseSector(OTA_MANIFEST_ADDRESS);
+    if (result != FLASH4_OK)
+        return result;
+
+    memcpy(manifest->page, header, sizeof(Ota_ManifestHeader_t));
+    result = Flash4_ProgramPage(manifest->page, OTA_MANIFEST_ADDRESS, sizeof(Ota_ManifestHeader_t));
+    if (result == FLASH4_OK)
+        manifest->state = Ota_ManifestState_leaves;
+
+    return result;
+}
+
+uint8 Ota_Manifest_Resume(Ota_Manifest_t *manifest, const Ota_ManifestHeader_t *header, uint32 imageAddress)
+{
+    Ota_ManifestHeader_t stored;
+    uint8                bitmap[OTA_MANIFEST_VERIFIED_OFFSET + 1u];
+    uint32               index;
+
+    manifest->state = Ota_ManifestState_empty;
+    if (!isValidHeader(header, imageAddress))
+        return FLASH4_ERROR;
+
+    Flash4_ReadFlash4((uint8 *)&stored, OTA_MANIFEST_ADDRESS, sizeof(stored));
+    Flash4_ReadFlash4(bitmap, OTA_MANIFEST_BITMAP_ADDRESS, sizeof(bitmap));
+    if (memcmp(&stored, header, sizeof(stored)) != 0 || bitmap[OTA_MANIFEST_VERIFIED_OFFSET] != 0x00u)
+        return FLASH4_ERROR;
+
+    resetState(manifest, header, imageAddress);
+    manifest->leafBytes = header->chunkCount * SHA256_DIGEST_SIZE;
+
+    for (index = 0; index < header->chunkCount; index++)
+    {
+        if ((bitmap[index / 8u] & (1u << (index % 8u))) == 0u)
+        {
+            manifest->done[index / 32u] |= 1uL << (index % 32u);
+            manifest->chunksDone++;
+            manifest->erasedSectors |= 1uL << ((index << header->chunkBits) / FLASH4_SECTOR_SIZE);
+        }
+    }
+
+    manifest->state = (manifest->chunksDone == header->chunkCount) ? Ota_ManifestState_complete :
+                                                                     Ota_ManifestState_chunks;
+    return FLASH4_OK;
+}
+
+uint32 Ota_Manifest_WriteLeaves(Ota_Manifest_t *manifest, const uint8 *data, uint32 length)
+{
+    uint32 total = manifest->header.chunkCount * SHA256_DIGEST_SIZE;
+    uint32 used  = 0;
+
+    while (used < length && manifest->state == Ota_ManifestState_leaves)
+    {
+        uint32 offset = manifest->leafBytes % FLASH4_MAX_PAGE_SIZE;
+        uint32 n      = FLASH4_MAX_PAGE_SIZE - offset;
+        uint32 leaf;
+
+        if (n > total - manifest->leafBytes)
+            n = total - manifest->leafBytes;
+        if (n > length - used)
+            n = length - used;
+
+        memcpy(&manifest->page[offset], &data[used], n);
+        used += n;
+
+        /* Leaves completed by this copy; a page holds whole leaves only */
+        for (leaf = offset / SHA256_DIGEST_SIZE; (leaf + 1u) * SHA256_DIGEST_SIZE <= offset + n; leaf++)
+            pushLeaf(manifest, &manifest->page[leaf * SHA256_DIGEST_SIZE]);
+
+        manifest->leafBytes += n;
+
+        if (offset + n == FLASH4_MAX_PAGE_SIZE || manifest->leafBytes == total)
+        {
+            if (Flash4_ProgramPage(manifest->page, OTA_MANIFEST_LEAF_ADDRESS + manifest->leafBytes - (offset + n),
+                                   (uint16)(offset + n)) != FLASH4_OK)
+                manifest->state = Ota_ManifestState_error;
+        }
+
+        if (manifest->leafBytes == total && manifest->state == Ota_ManifestState_leaves)
+        {
+            uint8 verified = 0x00;
+
+            /* The marker makes the stored chunk hashes usable by Ota_Manifest_Resume() */
+            if (isValidRoot(manifest) &&
+                Flash4_ProgramPage(&verified, OTA_MANIFEST_BITMAP_ADDRESS + OTA_MANIFEST_VERIFIED_OFFSET, 1) == FLASH4_OK)
+                manifest->state = Ota_ManifestState_chunks;
+            else
+                manifest->state = Ota_ManifestState_error;
+        }
+    }
+
+    return used;
+}
+
+uint8 Ota_Manifest_WriteChunk(Ota_Manifest_t *manifest, uint32 index, const uint8 *data, uint32 length)
+{
+    uint8    digest[SHA256_DIGEST_SIZE];
+    uint8    prefix = OTA_MANIFEST_LEAF_PREFIX;
+    Sha256_t ctx;
+
+    if (manifest->state != Ota_ManifestState_chunks && manifest->state != Ota_ManifestState_complete)
+        return FLASH4_ERROR;
+
+    if (index < manifest->header.chunkCount && isDone(manifest, index))
+        return FLASH4_OK;
+
+    Sha256_Init(&ctx);
+    Sha256_Update(&ctx, &prefix, 1);
+    Sha256_Update(&ctx, data, length);
+    Sha256_Final(&ctx, digest);
+
+    return Ota_Manifest_WriteHashedChunk(manifest, index, data, length, digest);
+}
+
+uint8 Ota_Manifest_WriteHashedChunk(Ota_Manifest_t *manifest, uint32 index, const uint8 *data, uint32 length,
+                                    const uint8 *digest)
+{
+    uint32   address;
+    uint32   sector;
+    uint32   offset;
+    uint8    result;
+
+    if ((manifest->state != Ota_ManifestState_chunks && manifest->state != Ota_ManifestState_complete) ||
+        index >= manifest->header.chunkCount || length != chunkLength(manifest, index))
+        return FLASH4_ERROR;
+
+    if (isDone(manifest, index))
+        return FLASH4_OK;
+
+    if (!isValidChunk(manifest, index, digest))
+        return FLASH4_ERROR;
+
+    /* Chunks never straddle sectors, the chunk size divides the sector size */
+    address = manifest->imageAddress + (index << manifest->header.chunkBits);
+    sector  = (address - manifest->imageAddress) / FLASH4_SECTOR_SIZE;
+    if ((manifest->erasedSectors & (1uL << sector)) == 0u)
+    {
+        result = Flash4_EraseSector(address);
+        if (result != FLASH4_OK)
+            return result;
+        manifest->erasedSectors |= 1uL << sector;
+    }
+
+    for (offset = 0; offset < length; offset += FLASH4_MAX_PAGE_SIZE)
+    {
+        uint16 n = (length - offset > FLASH4_MAX_PAGE_SIZE) ? FLASH4_MAX_PAGE_SIZE : (uint16)(length - offset);
+
+        result = Flash4_ProgramPage(&data[offset], address + offset, n);
+        if (result != FLASH4_OK)
+            return result;
+    }
+
+    /* A reset before this leaves the bit set, the chunk is then programmed again with the same data */
+    result = persistBit(index / 8u, (uint8)(index % 8u));
+    if (result != FLASH4_OK)
+        return result;
+
+    manifest->done[index / 32u] |= 1uL << (index % 32u);
+    manifest->chunksDone++;
+
+    /* In-order chunks extend the image CRC directly, the others are read back by Ota_Manifest_GetImageCrc() */
+    if (index == manifest->crcChunks)
+    {
+        manifest->crc = Crc16_Update(manifest->crc, data, length);
+        manifest->crcChunks++;
+    }
+
+    if (manifest->chunksDone == manifest->header.chunkCount)
+        manifest->state = Ota_ManifestState_complete;
+
+    return FLASH4_OK;
+}
+
+uint32 Ota_Manifest_NextMissing(const Ota_Manifest_t *manifest, uint32 index)
+{
+    while (index < manifest->header.chunkCount && isDone(manifest, index))
+        index++;
+
+    return index;
+}
+
+uint16 Ota_Manifest_GetImageCrc(Ota_Manifest_t *manifest)
+{
+    uint8 buffer[FLASH4_MAX_PAGE_SIZE];
+
+    while (manifest->crcChunks < manifest->header.chunkCount && isDone(manifest, manifest->crcChunks))
+    {
+        uint32 address = manifest->imageAddress + (manifest->crcChunks << manifest->header.chunkBits);
+        uint32 length  = chunkLength(manifest, manifest->crcChunks);
+
+        while (length > 0u)
+        {
+            uint16 n = (length > FLASH4_MAX_PAGE_SIZE) ? FLASH4_MAX_PAGE_SIZE : (uint16)length;
+
+            Flash4_ReadFlash4(buffer, address, n);
+            manifest->crc = Crc16_Update(manifest->crc, buffer, n);
+            address      += n;
+            length       -= n;
+        }
+
+        manifest->crcChunks++;
+    }
+
+    return manifest->crc;
+}
+
+uint8 Ota_Manifest_CheckChunk(const Ota_Manifest_t *manifest, uint32 index)
+{
+    uint8    buffer[FLASH4_MAX_PAGE_SIZE];
+    uint8    digest[SHA256_DIGEST_SIZE];
+    uint8    prefix = OTA_MANIFEST_LEAF_PREFIX;
+    Sha256_t ctx;
+    uint32   address;
+    uint32   length;
+
+    if (manifest->state == Ota_ManifestState_empty || manifest->state == Ota_ManifestState_leaves ||
+        index >= manifest->header.chunkCount)
+        return FLASH4_ERROR;
+
+    address = manifest->imageAddress + (index << manifest->header.chunkBits);
+    length  = chunkLength(manifest, index);
+
+    Sha256_Init(&ctx);
+    Sha256_Update(&ctx, &prefix, 1);
+    while (length > 0u)
+    {
+        uint16 n = (length > FLASH4_MAX_PAGE_SIZE) ? FLASH4_MAX_PAGE_SIZE : (uint16)length;
+
+        Flash4_ReadFlash4(buffer, address, n);
+        Sha256_Update(&ctx, buffer, n);
+        address += n;
+        length  -= n;
+    }
+    Sha256_Final(&ctx, digest);
+
+    return isValidChunk(manifest, index, digest) ? FLASH4_OK : FLASH4_ERROR;
+}
@@ -0,0 +1,178 @@
+/**********************************************************************************************************************
+ * \file Ota_Manifest.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Chunked image manifest with a Merkle tree of SHA-256 chunk hashes
+ * The image is split into chunks of 2^chunkBits bytes. The manifest header carries the root of a Merkle tree over
+ * the chunk hashes and is the part covered by the update signature. The chunk hashes (leaves) follow the header;
+ * they are stored in Flash4 at OTA_MANIFEST_ADDRESS and accepted only if they rebuild the signed root. From then
+ * on every chunk is checked against its leaf as it arrives and programmed only if it matches, in any order. A
+ * corrupt chunk is rejected alone and can be requested again, and a complete image needs no further read-back.
+ *
+ * Progress survives a reset: the last page of the manifest sector holds a bitmap with one bit per chunk, and a bit
+ * is cleared by programming just its byte once the chunk is in flash, without any erase. Ota_Manifest_Resume()
+ * rebuilds the state from it, and the download continues with the first missing chunk.
+ *
+ * Manifest layout (little endian):
+ *   Ota_ManifestHeader_t                           56 bytes
+ *   leaf[chunkCount]                               SHA-256(0x00 || chunk), 32 bytes each
+ *
+ * Tree (as RFC 6962): node = SHA-256(0x01 || left || right). With n leaves the left subtree holds the largest
+ * power of two below n, so an unpaired node moves up a level unchanged.
+ *********************************************************************************************************************/
+
+#ifndef OTA_MANIFEST_H_
+#define OTA_MANIFEST_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+#include "Flash4_Config.h"
+#include "Sha256.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define OTA_MANIFEST_MAGIC                       0x464D3446UL    /* "F4MF" */
+#define OTA_MANIFEST_VERSION                     1
+#define OTA_MANIFEST_MIN_CHUNK_BITS              10          /* 1 KB  */
+#define OTA_MANIFEST_MAX_CHUNK_BITS              16          /* 64 KB */
+#define OTA_MANIFEST_LEAF_PREFIX                 0x00        /* Hashed ahead of the chunk data for its leaf */
+#define OTA_MANIFEST_SIGNATURE_CONTEXT           "ota-manifest"  /* ML-DSA context of the header signature */
+#define OTA_MANIFEST_MAX_CHUNKS                  1024        /* A full slot in 1 KB chunks */
+#define OTA_MANIFEST_TREE_DEPTH                  11          /* log2(OTA_MANIFEST_MAX_CHUNKS) + 1 */
+#define OTA_MANIFEST_LEAF_ADDRESS                (OTA_MANIFEST_ADDRESS + FLASH4_MAX_PAGE_SIZE)
+#define OTA_MANIFEST_BITMAP_ADDRESS              (OTA_MANIFEST_ADDRESS + FLASH4_SECTOR_SIZE - FLASH4_MAX_PAGE_SIZE)
+#define OTA_MANIFEST_VERIFIED_OFFSET             (OTA_MANIFEST_MAX_CHUNKS / 8u)  /* Byte after the bitmap, 0x00 once the chunk hashes match the root */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 magic;                   /* OTA_MANIFEST_MAGIC                               */
+    uint8  version;                 /* OTA_MANIFEST_VERSION                             */
+    uint8  chunkBits;               /* Chunk size 2^chunkBits                           */
+    uint16 reserved;
+    uint32 imageVersion;            /* Firmware version                                 */
+    uint32 imageSize;               /* Image size in bytes                              */
+    uint32 chunkCount;              /* ceil(imageSize / chunk size)                     */
+    uint32 reserved2;
+    uint8  root[SHA256_DIGEST_SIZE];/* Merkle root over the chunk hashes                */
+} Ota_ManifestHeader_t;
+
+typedef enum
+{
+    Ota_ManifestState_empty = 0,    /* No manifest                                      */
+    Ota_ManifestState_leaves,       /* Header accepted, receiving chunk hashes          */
+    Ota_ManifestState_chunks,       /* Chunk hashes verified, receiving chunks          */
+    Ota_ManifestState_complete,     /* All chunks verified and programmed               */
+    Ota_ManifestState_error         /* Chunk hashes do not match the root               */
+} Ota_ManifestState;
+
+typedef struct
+{
+    Ota_ManifestHeader_t header;
+    Ota_ManifestState    state;
+    uint32               imageAddress;                              /* Sector aligned target, e.g. a slot   */
+    uint32               leafBytes;                                 /* Chunk hash bytes received            */
+    uint32               chunksDone;                                /* Chunks verified and programmed       */
+    uint32               erasedSectors;                             /* Bit n: sector n of the image erased  */
+    uint32               done[OTA_MANIFEST_MAX_CHUNKS / 32u];       /* Bit per programmed chunk, in RAM     */
+    uint32               crcChunks;                                 /* Leading chunks covered by crc        */
+    uint16               crc;                                       /* CRC-16 of the image, see GetImageCrc */
+    uint8                treeDepth;
+    uint8                treeHeight[OTA_MANIFEST_TREE_DEPTH];
+    uint8                tree[OTA_MANIFEST_TREE_DEPTH][SHA256_DIGEST_SIZE];  /* Subtree roots, left to right */
+    uint8                page[FLASH4_MAX_PAGE_SIZE];                /* Chunk hashes to be programmed        */
+} Ota_Manifest_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Start a download with an authenticated manifest header
+ * The caller checks the signature over the header first, the header is trusted from here on.
+ * Erases the manifest sector and stores the header.
+ * \param manifest Manifest state
+ * \param header Manifest header
+ * \param imageAddress Sector aligned Flash4 address for the image, e.g. the inactive slot
+ * \return FLASH4_OK, FLASH4_ERROR if the header is invalid or the image does not fit into a slot
+ */
+uint8 Ota_Manifest_Begin(Ota_Manifest_t *manifest, const Ota_ManifestHeader_t *header, uint32 imageAddress);
+
+/**
+ * \brief Continue an interrupted download after a reset
+ * Succeeds if the manifest area holds the same header and its chunk hashes were verified. Chunks recorded in the
+ * bitmap count as done, their sectors are not erased again.
+ * \param manifest Manifest state
+ * \param header Manifest header offered again by the server, its signature already checked
+ * \param imageAddress Sector aligned Flash4 address for the image, the same as for Ota_Manifest_Begin()
+ * \return FLASH4_OK, FLASH4_ERROR if there is nothing to resume and Ota_Manifest_Begin() is needed
+ */
+uint8 Ota_Manifest_Resume(Ota_Manifest_t *manifest, const Ota_ManifestHeader_t *header, uint32 imageAddress);
+
+/**
+ * \brief Store the chunk hashes following the header and check them against the root
+ * \param manifest Manifest state
+ * \param data Chunk hash data, any split
+ * \param length Number of bytes
+ * \return Number of bytes consumed, state is chunks or error once all hashes are in
+ */
+uint32 Ota_Manifest_WriteLeaves(Ota_Manifest_t *manifest, const uint8 *data, uint32 length);
+
+/**
+ * \brief Verify one chunk and program it if it matches
+ * Chunks may arrive in any order. The sector of a chunk is erased before its first chunk is programmed,
+ * programming blocks until the chunk is written.
+ * \param manifest Manifest state
+ * \param index Chunk index
+ * \param data Chunk data
+ * \param length Chunk size, shorter for the last chunk only
+ * \return FLASH4_OK (also for a chunk already done), FLASH4_ERROR if the chunk does not match and must be
+ *         requested again, FLASH4_TIMEOUT on a flash error
+ */
+uint8 Ota_Manifest_WriteChunk(Ota_Manifest_t *manifest, uint32 index, const uint8 *data, uint32 length);
+
+/**
+ * \brief Program one chunk whose hash was computed elsewhere, e.g. on another core
+ * Same as Ota_Manifest_WriteChunk() without hashing the data again.
+ * \param manifest Manifest state
+ * \param index Chunk index
+ * \param data Chunk data
+ * \param length Chunk size, shorter for the last chunk only
+ * \param digest SHA-256(OTA_MANIFEST_LEAF_PREFIX || data)
+ * \return FLASH4_OK (also for a chunk already done), FLASH4_ERROR if the digest does not match the leaf,
+ *         FLASH4_TIMEOUT on a flash error
+ */
+uint8 Ota_Manifest_WriteHashedChunk(Ota_Manifest_t *manifest, uint32 index, const uint8 *data, uint32 length,
+                                    const uint8 *digest);
+
+/**
+ * \brief Next chunk still missing
+ * \param manifest Manifest state
+ * \param index First chunk index to consider
+ * \return Chunk index, header.chunkCount if all chunks from index on are done
+ */
+uint32 Ota_Manifest_NextMissing(const Ota_Manifest_t *manifest, uint32 index);
+
+/**
+ * \brief CRC-16 of the complete image for Ota_Slots_RecordDownload()
+ * Computed from the chunk data on arrival; chunks that arrived ahead of a missing one are read back once.
+ * \param manifest Manifest state, state complete
+ * \return CRC value
+ */
+uint16 Ota_Manifest_GetImageCrc(Ota_Manifest_t *manifest);
+
+/**
+ * \brief Read a programmed chunk back and check it against its hash
+ * \param manifest Manifest state
+ * \param index Chunk index
+ * \return FLASH4_OK, FLASH4_ERROR on mismatch
+ */
+uint8 Ota_Manifest_CheckChunk(const Ota_Manifest_t *manifest, uint32 index);
+
+#endif /* OTA_MANIFEST_H_ */
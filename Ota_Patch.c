@@ -0,0 +1,306 @@
+/**********************************************************************************************************************
+ * \file Ota_Patch.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Streaming delta patch applier
+ *********************************************************************************************************************/
+
+#include "Ota_Patch.h"
+#include "Crc16.h"
+#include "IfxStm.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static boolean isValidHeader(const Ota_Patch_t *patch)
+{
+    Ota_PatchHeader_t header = patch->header;
+
+    header.headerCrc = 0;
+
+    return (header.magic == OTA_PATCH_MAGIC && header.version == OTA_PATCH_VERSION &&
+            header.headerSize == sizeof(Ota_PatchHeader_t) &&
+            Crc16_Calculate((const uint8 *)&header, sizeof(header)) == patch->header.headerCrc &&
+            header.oldSize == patch->oldSize && header.oldCrc == patch->oldCrc && header.newSize > 0u &&
+            header.newSize <= OTA_SLOT_SIZE) ? TRUE : FALSE;
+}
+
+/* Copy old image data through the read-ahead buffer, refilled sequentially from the current position */
+static void readOld(Ota_Patch_t *patch, uint8 *out, uint32 length)
+{
+    uint32 position = patch->oldPosition;
+
+    while (length > 0u)
+    {
+        uint32 n;
+
+        if (position < patch->readAheadStart || position >= patch->readAheadStart + patch->readAheadLength)
+        {
+            patch->readAheadStart  = position;
+            patch->readAheadLength = patch->oldSize - position;
+            if (patch->readAheadLength > OTA_PATCH_READAHEAD_SIZE)
+                patch->readAheadLength = OTA_PATCH_READAHEAD_SIZE;
+
+            /* The new image is written to the same device, a running erase must be suspended for the read */
+            Ota_StreamWriter_SuspendForRead(patch->writer);
+            Flash4_ReadBuffer(patch->readAhead, patch->oldAddress + position, patch->readAheadLength);
+        }
+
+        n = patch->readAheadStart + patch->readAheadLength - position;
+        if (n > length)
+            n = length;
+
+        memcpy(out, &patch->readAhead[position - patch->readAheadStart], n);
+        out      += n;
+        position += n;
+        length   -= n;
+    }
+}
+
+static void stageOutput(Ota_Patch_t *patch, uint32 length)
+{
+    patch->crc           = Crc16_Update(patch->crc, patch->output, length);
+    patch->produced     += length;
+    patch->remaining    -= length;
+    patch->outputStart   = 0;
+    patch->outputLength  = (uint16)length;
+
+    if (patch->state != Ota_PatchState_insert)
+        patch->oldPosition += length;
+    if (patch->remaining == 0u)
+        patch->state = Ota_PatchState_opcode;
+}
+
+/* Hand staged output to the writer, FALSE while the writer is busy or after it failed */
+static boolean flushOutput(Ota_Patch_t *patch)
+{
+    uint32 taken;
+
+    if (patch->outputLength == 0u)
+        return TRUE;
+
+    taken = Ota_StreamWriter_Write(patch->writer, &patch->output[patch->outputStart], patch->outputLength);
+    patch->outputStart  += (uint16)taken;
+    patch->outputLength -= (uint16)taken;
+
+    if (Ota_StreamWriter_GetStatus(patch->writer) != FLASH4_OK)
+    {
+        patch->outputLength = 0;
+        patch->state        = Ota_PatchState_error;
+        return FALSE;
+    }
+
+    return (patch->outputLength == 0u) ? TRUE : FALSE;
+}
+
+/* Validate an instruction once its operands are known */
+static void beginInstruction(Ota_Patch_t *patch)
+{
+    if (patch->remaining > patch->header.newSize - patch->produced)
+    {
+        patch->state = Ota_PatchState_error;
+    }
+    else if (patch->opcode != OTA_PATCH_OP_INSERT &&
+             (patch->oldPosition > patch->oldSize || patch->remaining > patch->oldSize - patch->oldPosition))
+    {
+        patch->state = Ota_PatchState_error;
+    }
+    else if (patch->remaining == 0u)
+    {
+        patch->state = Ota_PatchState_opcode;
+    }
+    else
+    {
+        patch->state = (patch->opcode == OTA_PATCH_OP_COPY) ? Ota_PatchState_copy :
+                       (patch->opcode == OTA_PATCH_OP_ADD)  ? Ota_PatchState_add : Ota_PatchState_insert;
+    }
+}
+
+/* Feed one byte to the varint decoder, TRUE when the value is complete */
+static boolean varintByte(Ota_Patch_t *patch, uint8 byte)
+{
+    if (patch->varintShift > 28u)
+    {
+        patch->state = Ota_PatchState_error;
+        return FALSE;
+    }
+
+    patch->varint      |= (uint32)(byte & 0x7Fu) << patch->varintShift;
+    patch->varintShift += 7u;
+
+    return ((byte & 0x80u) == 0u) ? TRUE : FALSE;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+void Ota_Patch_Init(Ota_Patch_t *patch, Ota_StreamWriter_t *writer, uint32 oldAddress, uint32 oldSize, uint16 oldCrc,
+                    uint32 newAddress)
+{
+    patch->writer          = writer;
+    patch->oldAddress      = oldAddress;
+    patch->oldSize         = oldSize;
+    patch->oldCrc          = oldCrc;
+    patch->newAddress      = newAddress;
+    patch->state           = Ota_PatchState_header;
+    patch->opcode          = OTA_PATCH_OP_END;
+    patch->varint          = 0;
+    patch->varintShift     = 0;
+    patch->remaining       = 0;
+    patch->oldPosition     = 0;
+    patch->produced        = 0;
+    patch->consumed        = 0;
+    patch->crc             = CRC16_INIT_VALUE;
+    patch->readAheadStart  = 0;
+    patch->readAheadLength = 0;
+    patch->outputStart     = 0;
+    patch->outputLength    = 0;
+}
+
+uint32 Ota_Patch_Write(Ota_Patch_t *patch, const uint8 *data, uint32 length)
+{
+    uint32 used = 0;
+    uint32 n;
+
+    while (flushOutput(patch))
+    {
+        if (patch->state == Ota_PatchState_copy)
+        {
+            n = (patch->remaining > OTA_PATCH_OUTPUT_SIZE) ? OTA_PATCH_OUTPUT_SIZE : patch->remaining;
+            readOld(patch, patch->output, n);
+            stageOutput(patch, n);
+            continue;
+        }
+
+        if (used == length || patch->state == Ota_PatchState_done || patch->state == Ota_PatchState_error)
+            break;
+
+        switch (patch->state)
+        {
+            case Ota_PatchState_header:
+                n = sizeof(Ota_PatchHeader_t) - patch->consumed;
+                if (n > length - used)
+                    n = length - used;
+
+                memcpy((uint8 *)&patch->header + patch->consumed, &data[used], n);
+                patch->consumed += n;
+                used            += n;
+
+                if (patch->consumed == sizeof(Ota_PatchHeader_t))
+                {
+                    if (isValidHeader(patch) &&
+                        Ota_StreamWriter_Init(patch->writer, patch->newAddress, patch->header.newSize) == FLASH4_OK)
+                        patch->state = Ota_PatchState_opcode;
+                    else
+                        patch->state = Ota_PatchState_error;
+                }
+                break;
+
+            case Ota_PatchState_opcode:
+                patch->opcode = data[used++];
+                patch->consumed++;
+                patch->varint      = 0;
+                patch->varintShift = 0;
+
+                if (patch->opcode == OTA_PATCH_OP_END)
+                    patch->state = (patch->produced == patch->header.newSize) ? Ota_PatchState_done :
+                                                                                Ota_PatchState_error;
+                else if (patch->opcode >= OTA_PATCH_OP_COPY && patch->opcode <= OTA_PATCH_OP_INSERT)
+                    patch->state = Ota_PatchState_length;
+                else
+                    patch->state = Ota_PatchState_error;
+                break;
+
+            case Ota_PatchState_length:
+                patch->consumed++;
+                if (varintByte(patch, data[used++]))
+                {
+                    patch->remaining   = patch->varint;
+                    patch->varint      = 0;
+                    patch->varintShift = 0;
+
+                    if (patch->opcode == OTA_PATCH_OP_COPY)
+                        patch->state = Ota_PatchState_seek;
+                    else
+                        beginInstruction(patch);
+                }
+                break;
+
+            case Ota_PatchState_seek:
+                patch->consumed++;
+                if (varintByte(patch, data[used++]))
+                {
+                    /* Zig-zag: even values seek forward, odd values backward */
+                    if ((patch->varint & 1u) != 0u)
+                        patch->oldPosition -= (patch->varint >> 1) + 1u;
+                    else
+                        patch->oldPosition += patch->varint >> 1;
+
+                    beginInstruction(patch);
+                }
+                break;
+
+            case Ota_PatchState_add:
+            case Ota_PatchState_insert:
+                n = patch->remaining;
+                if (n > OTA_PATCH_OUTPUT_SIZE)
+                    n = OTA_PATCH_OUTPUT_SIZE;
+                if (n > length - used)
+                    n = length - used;
+
+                if (patch->state == Ota_PatchState_add)
+                {
+                    uint32 i;
+
+                    readOld(patch, patch->output, n);
+                    for (i = 0; i < n; i++)
+                        patch->output[i] = (uint8)(patch->output[i] + data[used + i]);
+                }
+                else
+                {
+                    memcpy(patch->output, &data[used], n);
+                }
+
+                used            += n;
+                patch->consumed += n;
+                stageOutput(patch, n);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (patch->state != Ota_PatchState_header && patch->state != Ota_PatchState_error)
+        Ota_StreamWriter_Poll(patch->writer);
+
+    return used;
+}
+
+uint8 Ota_Patch_Finish(Ota_Patch_t *patch, uint32 timeoutMs)
+{
+    uint32 startTime    = IfxStm_get(&MODULE_STM0);
+    uint32 timeoutTicks = timeoutMs * (uint32)(IfxStm_getFrequency(&MODULE_STM0) / 1000u);
+    uint8  result;
+
+    /* Trailing copies need no more input, drain them and the staged output */
+    while ((patch->outputLength > 0u || patch->state == Ota_PatchState_copy) &&
+           patch->state != Ota_PatchState_error)
+    {
+        if ((IfxStm_get(&MODULE_STM0) - startTime) > timeoutTicks)
+            return FLASH4_TIMEOUT_ERROR;
+        (void)Ota_Patch_Write(patch, NULL_PTR, 0u);
+    }
+
+    if (patch->state != Ota_PatchState_done)
+        return FLASH4_ERROR;
+
+    result = Ota_StreamWriter_Finish(patch->writer, timeoutMs);
+    if (result != FLASH4_OK)
+        return result;
+
+    return (patch->crc == patch->header.newCrc) ? FLASH4_OK : FLASH4_ERROR;
+}
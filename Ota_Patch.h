@@ -0,0 +1,139 @@
+/**********************************************************************************************************************
+ * \file Ota_Patch.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Streaming delta patch applier
+ * Rebuilds a new firmware image in the inactive slot from the active slot and a patch built on the host with
+ * Tools/ota_mkpatch.c. The patch is consumed as it arrives from the transport; the new image is programmed through
+ * an Ota_StreamWriter, so only the changed bytes are transferred and RAM use is independent of the image size.
+ * The old image is read sequentially through a small read-ahead buffer.
+ *
+ * Patch layout (little endian):
+ *   Ota_PatchHeader_t                              32 bytes
+ *   instructions                                   until OTA_PATCH_OP_END
+ *
+ * Instructions, lengths and seeks are LEB128 varints, seeks zig-zag encoded:
+ *   OTA_PATCH_OP_COPY    length, seek              new = old[pos .. pos + length)
+ *   OTA_PATCH_OP_ADD     length, diff bytes        new = old[pos + i] + diff[i], for bytes changed in place
+ *   OTA_PATCH_OP_INSERT  length, literal bytes     new = literal
+ *   OTA_PATCH_OP_END
+ * pos is the old image position; seek is added to it before a COPY. COPY and ADD advance it by length.
+ *********************************************************************************************************************/
+
+#ifndef OTA_PATCH_H_
+#define OTA_PATCH_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+#include "Flash4_Config.h"
+#include "Ota_StreamWriter.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define OTA_PATCH_MAGIC                          0x50443446UL    /* "F4DP" */
+#define OTA_PATCH_VERSION                        1
+
+#define OTA_PATCH_OP_END                         0x00
+#define OTA_PATCH_OP_COPY                        0x01
+#define OTA_PATCH_OP_ADD                         0x02
+#define OTA_PATCH_OP_INSERT                      0x03
+
+#define OTA_PATCH_READAHEAD_SIZE                 512         /* Old image read-ahead, multiple of a page */
+#define OTA_PATCH_OUTPUT_SIZE                    64          /* Output staged for the writer */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 magic;           /* OTA_PATCH_MAGIC                                 */
+    uint16 version;         /* OTA_PATCH_VERSION                               */
+    uint16 headerSize;      /* sizeof(Ota_PatchHeader_t)                       */
+    uint32 oldSize;         /* Size of the image the patch applies to          */
+    uint32 newSize;         /* Resulting image size, at most OTA_SLOT_SIZE     */
+    uint16 oldCrc;          /* CRC-16 of the old image                         */
+    uint16 newCrc;          /* CRC-16 of the new image                         */
+    uint32 patchSize;       /* Total patch size including this header          */
+    uint32 reserved;
+    uint16 reserved2;
+    uint16 headerCrc;       /* CRC-16 over the header with headerCrc = 0       */
+} Ota_PatchHeader_t;
+
+typedef enum
+{
+    Ota_PatchState_header = 0,
+    Ota_PatchState_opcode,
+    Ota_PatchState_length,
+    Ota_PatchState_seek,
+    Ota_PatchState_copy,
+    Ota_PatchState_add,
+    Ota_PatchState_insert,
+    Ota_PatchState_done,
+    Ota_PatchState_error
+} Ota_PatchState;
+
+typedef struct
+{
+    Ota_StreamWriter_t *writer;
+    uint32              oldAddress;
+    uint32              oldSize;
+    uint16              oldCrc;
+    uint32              newAddress;
+    Ota_PatchHeader_t   header;
+    Ota_PatchState      state;
+    uint8               opcode;
+    uint32              varint;             /* Varint being decoded                   */
+    uint8               varintShift;
+    uint32              remaining;          /* Bytes left in the current instruction  */
+    uint32              oldPosition;
+    uint32              produced;           /* New image bytes generated              */
+    uint32              consumed;           /* Patch bytes consumed                   */
+    uint16              crc;                /* Running CRC of the new image           */
+    uint32              readAheadStart;     /* Old image offset of the read-ahead     */
+    uint32              readAheadLength;
+    uint16              outputStart;        /* Staged output not yet taken            */
+    uint16              outputLength;
+    uint8               readAhead[OTA_PATCH_READAHEAD_SIZE];
+    uint8               output[OTA_PATCH_OUTPUT_SIZE];
+} Ota_Patch_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Prepare applying a patch, the writer is started once the patch header has arrived
+ * \param patch Patch applier state
+ * \param writer Writer for the new image
+ * \param oldAddress Flash4 address of the old image (active slot)
+ * \param oldSize Size of the old image
+ * \param oldCrc CRC-16 of the old image, e.g. from the slot metadata
+ * \param newAddress Sector aligned Flash4 address of the new image (inactive slot)
+ */
+void Ota_Patch_Init(Ota_Patch_t *patch, Ota_StreamWriter_t *writer, uint32 oldAddress, uint32 oldSize, uint16 oldCrc,
+                    uint32 newAddress);
+
+/**
+ * \brief Consume patch data from the transport
+ * Generates new image data until the input is used up or the writer is busy. Copies need no input, so calling
+ * it with length 0 lets them progress while the transport is waiting.
+ * \param patch Patch applier state
+ * \param data Patch data
+ * \param length Number of bytes
+ * \return Number of bytes consumed, the caller offers the rest again later
+ */
+uint32 Ota_Patch_Write(Ota_Patch_t *patch, const uint8 *data, uint32 length);
+
+/**
+ * \brief Complete the patch and wait until the new image is programmed
+ * \param patch Patch applier state
+ * \param timeoutMs Timeout in milliseconds
+ * \return FLASH4_OK, FLASH4_ERROR if the patch is invalid, incomplete or the new image CRC differs, FLASH4_TIMEOUT
+ */
+uint8 Ota_Patch_Finish(Ota_Patch_t *patch, uint32 timeoutMs);
+
+#endif /* OTA_PATCH_H_ */
@@ -0,0 +1,211 @@
+/**********************************************************************************************************************
+ * \file Ota_Pipeline.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Two-core staging pipeline with a shared slot ring in the DLMU of CPU1
+ *********************************************************************************************************************/
+
+#include "Ota_Pipeline.h"
+#include "IfxStm.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define PIPELINE_NONCACHED_OFFSET   0x20000000u     /* Segment 9 (cached) to segment 11 (non-cached) */
+#define PIPELINE_SLOT_MASK          (OTA_PIPELINE_SLOT_COUNT - 1u)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Placed in the DLMU of CPU1 by the linker scripts, only accessed through pipeline() */
+#if defined(__TASKING__)
+#pragma section farbss "lmubss_cpu1"
+static Ota_Pipeline_t g_otaPipeline;
+#pragma section farbss restore
+#else
+static Ota_Pipeline_t g_otaPipeline __attribute__((section(".lmubss_cpu1")));
+#endif
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Non-cached alias of the shared ring, the same for both cores */
+static Ota_Pipeline_t *pipeline(void)
+{
+    return (Ota_Pipeline_t *)((uint32)&g_otaPipeline | PIPELINE_NONCACHED_OFFSET);
+}
+
+static void lock(Ota_Pipeline_t *shared)
+{
+    while (!IfxCpu_setSpinLock(&shared->lock, OTA_PIPELINE_LOCK_TIMEOUT))
+    {
+    }
+}
+
+static void unlock(Ota_Pipeline_t *shared)
+{
+    IfxCpu_resetSpinLock(&shared->lock);
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+void Ota_Pipeline_Service(void)
+{
+    Ota_Pipeline_t     *shared = pipeline();
+    Ota_PipelineSlot_t *slot;
+    Sha256_t            ctx;
+    uint32              sequence;
+    uint32              start;
+    boolean             pending;
+
+    lock(shared);
+    sequence = shared->hashed;
+    pending  = (shared->submitted != sequence) ? TRUE : FALSE;
+    unlock(shared);
+
+    if (!pending)
+        return;
+
+    /* Core 0 does not touch a submitted slot until it is marked hashed */
+    slot  = &shared->slot[sequence & PIPELINE_SLOT_MASK];
+    start = IfxStm_get(&MODULE_STM0);
+
+    Sha256_Init(&ctx);
+    Sha256_Update(&ctx, &slot->prefix, 1);
+    Sha256_Update(&ctx, slot->data, slot->length);
+    Sha256_Final(&ctx, slot->digest);
+
+    lock(shared);
+    shared->hashTicks += IfxStm_get(&MODULE_STM0) - start;
+    shared->hashed = sequence + 1u;
+    unlock(shared);
+}
+
+Ota_PipelineSlot_t *Ota_Pipeline_Acquire(void)
+{
+    Ota_Pipeline_t *shared = pipeline();
+    uint32          sequence;
+    boolean         full;
+
+    lock(shared);
+    sequence = shared->submitted;
+    full     = (sequence - shared->released >= OTA_PIPELINE_SLOT_COUNT) ? TRUE : FALSE;
+    unlock(shared);
+
+    return full ? NULL_PTR : &shared->slot[sequence & PIPELINE_SLOT_MASK];
+}
+
+void Ota_Pipeline_Submit(void)
+{
+    Ota_Pipeline_t *shared = pipeline();
+
+    lock(shared);
+    shared->submitted++;
+    unlock(shared);
+}
+
+Ota_PipelineSlot_t *Ota_Pipeline_Next(void)
+{
+    Ota_Pipeline_t *shared = pipeline();
+    uint32          sequence;
+    boolean         ready;
+
+    lock(shared);
+    sequence = shared->released;
+    ready    = (shared->hashed != sequence) ? TRUE : FALSE;
+    unlock(shared);
+
+    return ready ? &shared->slot[sequence & PIPELINE_SLOT_MASK] : NULL_PTR;
+}
+
+void Ota_Pipeline_Release(void)
+{
+    Ota_Pipeline_t *shared = pipeline();
+
+    lock(shared);
+    shared->released++;
+    unlock(shared);
+}
+
+boolean Ota_Pipeline_IsIdle(void)
+{
+    Ota_Pipeline_t *shared = pipeline();
+    boolean         idle;
+
+    lock(shared);
+    idle = (shared->submitted == shared->released) ? TRUE : FALSE;
+    unlock(shared);
+
+    return idle;
+}
+
+uint32 Ota_Pipeline_GetHashTicks(void)
+{
+    Ota_Pipeline_t *shared = pipeline();
+    uint32          ticks;
+
+    lock(shared);
+    ticks = shared->hashTicks;
+    unlock(shared);
+
+    return ticks;
+}
+
+uint8 Ota_Pipeline_StageManifest(Ota_Manifest_t *manifest,
+                                 uint32 (*fetchChunk)(uint32 index, uint8 *buffer, uint32 capacity))
+{
+    Ota_PipelineSlot_t *slot;
+    uint32              count = manifest->header.chunkCount;
+    uint32              next;
+    uint32              retries = 0;
+    uint8               result  = FLASH4_OK;
+
+    if ((manifest->state != Ota_ManifestState_chunks && manifest->state != Ota_ManifestState_complete) ||
+        (1uL << manifest->header.chunkBits) > OTA_PIPELINE_SLOT_SIZE)
+        return FLASH4_ERROR;
+
+    next = Ota_Manifest_NextMissing(manifest, 0);
+    while (manifest->state != Ota_ManifestState_complete)
+    {
+        /* Keep core 1 supplied first, then program while it hashes */
+        slot = (next < count) ? Ota_Pipeline_Acquire() : NULL_PTR;
+        if (slot != NULL_PTR)
+        {
+            slot->index  = next;
+            slot->prefix = OTA_MANIFEST_LEAF_PREFIX;
+            slot->length = fetchChunk(next, slot->data, OTA_PIPELINE_SLOT_SIZE);
+            Ota_Pipeline_Submit();
+            next = Ota_Manifest_NextMissing(manifest, next + 1u);
+            continue;
+        }
+
+        slot = Ota_Pipeline_Next();
+        if (slot != NULL_PTR)
+        {
+            result = Ota_Manifest_WriteHashedChunk(manifest, slot->index, slot->data, slot->length, slot->digest);
+            Ota_Pipeline_Release();
+
+            if (result == FLASH4_TIMEOUT || (result == FLASH4_ERROR && ++retries > count))
+                break;
+            result = FLASH4_OK;
+        }
+        else if (next == count && Ota_Pipeline_IsIdle())
+        {
+            /* End of a pass, the chunks that failed are still missing */
+            next = Ota_Manifest_NextMissing(manifest, 0);
+        }
+    }
+
+    /* Slots still in flight after an error are dropped once core 1 is done with them */
+    while (!Ota_Pipeline_IsIdle())
+    {
+        if (Ota_Pipeline_Next() != NULL_PTR)
+            Ota_Pipeline_Release();
+    }
+
+    return result;
+}
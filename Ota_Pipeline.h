@@ -0,0 +1,117 @@
+/**********************************************************************************************************************
+ * \file Ota_Pipeline.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Two-core staging pipeline: transport and Flash4 I/O on core 0, hashing on core 1
+ * Staging a chunk is a transport receive, a SHA-256 over the data and a Flash4 program. The transfers are bus
+ * bound and the hash is CPU bound, so core 0 fetches and programs while core 1 hashes the chunk before.
+ *
+ * The cores share a ring of OTA_PIPELINE_SLOT_COUNT chunk buffers in the DLMU of CPU1. Core 0 receives a chunk
+ * directly into a free slot and submits it, core 1 hashes it in place and marks it hashed, and core 0 programs it
+ * from the same buffer and releases the slot. No chunk is copied between the cores. The ring is accessed through
+ * the non-cached address range, so neither core sees stale data in its cache; CPU1 reaches its own DLMU without
+ * crossing the SRI. The three free-running counters that pass the slots between the cores are only read and
+ * written with the pipeline spinlock held.
+ *
+ * Core 1 calls Ota_Pipeline_Service() from its main loop, see Cpu1_Main.c. All other functions are for core 0.
+ *********************************************************************************************************************/
+
+#ifndef OTA_PIPELINE_H_
+#define OTA_PIPELINE_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "IfxCpu.h"
+#include "Flash4_Driver.h"
+#include "Ota_Manifest.h"
+#include "Sha256.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define OTA_PIPELINE_SLOT_COUNT                  4           /* Power of two, the counters wrap around  */
+#define OTA_PIPELINE_SLOT_SIZE                   4096        /* Largest chunk, chunkBits up to 12       */
+#define OTA_PIPELINE_LOCK_TIMEOUT                0xFFFFu     /* Spin count per attempt to take the lock */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 index;                           /* Chunk index, set by core 0                     */
+    uint32 length;                          /* Bytes in data, set by core 0                   */
+    uint8  prefix;                          /* Byte hashed ahead of the data                  */
+    uint8  reserved[3];
+    uint8  digest[SHA256_DIGEST_SIZE];      /* SHA-256(prefix || data), set by core 1         */
+    uint8  data[OTA_PIPELINE_SLOT_SIZE];
+} Ota_PipelineSlot_t;
+
+typedef struct
+{
+    IfxCpu_spinLock    lock;
+    uint32             submitted;           /* Slots handed to core 1                         */
+    uint32             hashed;              /* Slots hashed by core 1                         */
+    uint32             released;            /* Slots programmed and returned by core 0        */
+    uint32             hashTicks;           /* STM ticks core 1 spent hashing                 */
+    Ota_PipelineSlot_t slot[OTA_PIPELINE_SLOT_COUNT];
+} Ota_Pipeline_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Hash the next submitted slot, called by core 1 in its main loop
+ * Returns at once if no slot is waiting.
+ */
+void Ota_Pipeline_Service(void);
+
+/**
+ * \brief Next free slot to receive a chunk into
+ * \return Slot, NULL_PTR if all slots are in use
+ */
+Ota_PipelineSlot_t *Ota_Pipeline_Acquire(void);
+
+/**
+ * \brief Hand the slot returned by Ota_Pipeline_Acquire() to core 1
+ */
+void Ota_Pipeline_Submit(void);
+
+/**
+ * \brief Oldest slot hashed by core 1, slots are returned in the order they were submitted
+ * \return Slot with its digest, NULL_PTR if core 1 has not finished the oldest slot yet
+ */
+Ota_PipelineSlot_t *Ota_Pipeline_Next(void);
+
+/**
+ * \brief Return the slot from Ota_Pipeline_Next() to the free slots
+ */
+void Ota_Pipeline_Release(void);
+
+/**
+ * \brief Check whether no slot is submitted or waiting to be released
+ * \return TRUE if the pipeline is empty
+ */
+boolean Ota_Pipeline_IsIdle(void);
+
+/**
+ * \brief STM ticks core 1 has spent hashing since startup, to compare with the staging time of core 0
+ * \return Tick count, wraps around
+ */
+uint32 Ota_Pipeline_GetHashTicks(void);
+
+/**
+ * \brief Receive, verify and program all missing chunks of a manifest download
+ * Core 0 fetches the next missing chunk into every free slot and programs the hashed ones with
+ * Ota_Manifest_WriteHashedChunk(), while core 1 hashes. Chunks that fail are requested again in the next pass.
+ * Blocks until the manifest is complete; core 1 must be running Ota_Pipeline_Service().
+ * \param manifest Manifest state, chunk hashes verified (state chunks or complete)
+ * \param fetchChunk Transport request for one chunk, returns the number of bytes copied
+ * \return FLASH4_OK, FLASH4_ERROR if the chunk size exceeds a slot or chunks keep failing, FLASH4_TIMEOUT
+ */
+uint8 Ota_Pipeline_StageManifest(Ota_Manifest_t *manifest,
+                                 uint32 (*fetchChunk)(uint32 index, uint8 *buffer, uint32 capacity));
+
+#endif /* OTA_PIPELINE_H_ */
@@ -0,0 +1,295 @@
+/**********************************************************************************************************************
+ * \file Ota_Slots.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * A/B firmware slots in Flash4
+ *********************************************************************************************************************/
+
+#include "Ota_Slots.h"
+#include "Crc16.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define SLOTS_PAGES_PER_SECTOR      (FLASH4_SECTOR_SIZE / FLASH4_MAX_PAGE_SIZE)
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static uint16 recordCrc(const Ota_SlotRecord_t *record)
+{
+    Ota_SlotRecord_t copy = *record;
+
+    copy.crc = 0;
+    return Crc16_Calculate((const uint8 *)&copy, sizeof(copy));
+}
+
+static boolean readRecord(uint32 address, Ota_SlotRecord_t *record)
+{
+    Flash4_ReadFlash4((uint8 *)record, address, sizeof(*record));
+
+    return (record->magic == OTA_METADATA_MAGIC && record->activeSlot < OTA_SLOT_COUNT &&
+            record->crc == recordCrc(record)) ? TRUE : FALSE;
+}
+
+static boolean isBlank(const uint8 *data, uint32 length)
+{
+    while (length > 0u)
+    {
+        if (data[--length] != 0xFFu)
+            return FALSE;
+    }
+
+    return TRUE;
+}
+
+/* Partially programmed pages left by a reset do not count as erased, commit() skips them as well */
+static boolean isErasedPage(uint32 address)
+{
+    uint8 page[sizeof(Ota_SlotRecord_t)];
+
+    Flash4_ReadFlash4(page, address, sizeof(page));
+    return isBlank(page, sizeof(page));
+}
+
+/* Records are appended from the start of a sector, binary search the first erased page */
+static uint32 firstErasedPage(uint32 sector)
+{
+    uint32 low  = 0;
+    uint32 high = SLOTS_PAGES_PER_SECTOR;
+
+    while (low < high)
+    {
+        uint32 mid = (low + high) / 2u;
+
+        if (isErasedPage(sector + mid * FLASH4_MAX_PAGE_SIZE))
+            high = mid;
+        else
+            low = mid + 1u;
+    }
+
+    return low;
+}
+
+static uint8 commit(Ota_Slots_t *slots)
+{
+    uint8 page[sizeof(Ota_SlotRecord_t)];
+    uint8 result;
+
+    slots->record.magic = OTA_METADATA_MAGIC;
+    slots->record.sequence++;
+    slots->record.crc = recordCrc(&slots->record);
+
+    for (;;)
+    {
+        /* Journal sector full: continue in the other one, the old sector stays valid until the record is written */
+        if (slots->nextAddress % FLASH4_SECTOR_SIZE == 0u)
+        {
+            if (slots->nextAddress >= OTA_METADATA_ADDRESS + 2u * FLASH4_SECTOR_SIZE)
+                slots->nextAddress = OTA_METADATA_ADDRESS;
+
+            result = Flash4_EraseSector(slots->nextAddress);
+            if (result != FLASH4_OK)
+                return result;
+        }
+
+        /* A record torn by a reset may have left bits programmed: skip pages that are not fully erased */
+        if (isErasedPage(slots->nextAddress))
+            break;
+        slots->nextAddress += FLASH4_MAX_PAGE_SIZE;
+    }
+
+    memcpy(page, &slots->record, sizeof(page));
+    result = Flash4_ProgramPage(page, slots->nextAddress, sizeof(page));
+    slots->nextAddress += FLASH4_MAX_PAGE_SIZE;
+
+    return result;
+}
+
+static uint16 imageCrc(uint32 address, uint32 size)
+{
+    uint8  buffer[FLASH4_MAX_PAGE_SIZE];
+    uint16 crc = CRC16_INIT_VALUE;
+
+    while (size > 0u)
+    {
+        uint16 n = (size > FLASH4_MAX_PAGE_SIZE) ? FLASH4_MAX_PAGE_SIZE : (uint16)size;
+
+        Flash4_ReadFlash4(buffer, address, n);
+        crc      = Crc16_Update(crc, buffer, n);
+        address += n;
+        size    -= n;
+    }
+
+    return crc;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+uint8 Ota_Slots_Init(Ota_Slots_t *slots)
+{
+    Ota_SlotRecord_t candidate;
+    boolean found = FALSE;
+    uint32 s;
+
+    slots->nextAddress = OTA_METADATA_ADDRESS;
+
+    for (s = 0; s < 2u; s++)
+    {
+        uint32 sector = OTA_METADATA_ADDRESS + s * FLASH4_SECTOR_SIZE;
+        uint32 end    = firstErasedPage(sector);
+        uint32 page   = end;
+
+        /* Newest valid record of this sector, normally the last one */
+        while (page > 0u)
+        {
+            page--;
+            if (readRecord(sector + page * FLASH4_MAX_PAGE_SIZE, &candidate))
+            {
+                if (!found || (sint32)(candidate.sequence - slots->record.sequence) > 0)
+                {
+                    slots->record      = candidate;
+                    slots->nextAddress = sector + end * FLASH4_MAX_PAGE_SIZE;
+                    found              = TRUE;
+                }
+                break;
+            }
+        }
+    }
+
+    if (!found)
+    {
+        memset(&slots->record, 0, sizeof(slots->record));
+        slots->record.activeSlot                 = OTA_SLOT_A;
+        slots->record.slots[OTA_SLOT_A].state    = (uint8)Ota_SlotState_confirmed;
+        slots->record.slots[OTA_SLOT_B].state    = (uint8)Ota_SlotState_empty;
+        slots->nextAddress                       = OTA_METADATA_ADDRESS;
+    }
+
+    return FLASH4_OK;
+}
+
+uint32 Ota_Slots_GetAddress(uint8 slot)
+{
+    return (slot == OTA_SLOT_A) ? OTA_SLOT_A_ADDRESS : OTA_SLOT_B_ADDRESS;
+}
+
+uint8 Ota_Slots_GetInactive(const Ota_Slots_t *slots)
+{
+    return (uint8)(OTA_SLOT_COUNT - 1u - slots->record.activeSlot);
+}
+
+uint8 Ota_Slots_BeginDownload(Ota_Slots_t *slots)
+{
+    Ota_SlotInfo_t *info = &slots->record.slots[Ota_Slots_GetInactive(slots)];
+
+    /* The inactive slot is the fallback of a pending image */
+    if (slots->record.slots[slots->record.activeSlot].state == (uint8)Ota_SlotState_pending)
+        return FLASH4_ERROR;
+
+    memset(info, 0, sizeof(*info));
+    info->state = (uint8)Ota_SlotState_downloading;
+
+    return commit(slots);
+}
+
+uint8 Ota_Slots_CompleteDownload(Ota_Slots_t *slots, uint32 version, uint32 size, const uint8 *digest)
+{
+    uint8 slot = Ota_Slots_GetInactive(slots);
+
+    /* Checked again by Ota_Slots_RecordDownload(), but before reading the whole slot */
+    if (slots->record.slots[slot].state != (uint8)Ota_SlotState_downloading || size == 0u || size > OTA_SLOT_SIZE)
+        return FLASH4_ERROR;
+
+    return Ota_Slots_RecordDownload(slots, version, size, imageCrc(Ota_Slots_GetAddress(slot), size), digest);
+}
+
+uint8 Ota_Slots_RecordDownload(Ota_Slots_t *slots, uint32 version, uint32 size, uint16 crc, const uint8 *digest)
+{
+    Ota_SlotInfo_t *info = &slots->record.slots[Ota_Slots_GetInactive(slots)];
+
+    if (info->state != (uint8)Ota_SlotState_downloading || size == 0u || size > OTA_SLOT_SIZE)
+        return FLASH4_ERROR;
+
+    info->version      = version;
+    info->size         = size;
+    info->bootAttempts = 0;
+    info->imageCrc     = crc;
+    info->state        = (uint8)Ota_SlotState_ready;
+
+    if (digest != NULL_PTR)
+        memcpy(info->digest, digest, OTA_SLOT_DIGEST_SIZE);
+
+    return commit(slots);
+}
+
+uint8 Ota_Slots_Activate(Ota_Slots_t *slots)
+{
+    uint8           slot = Ota_Slots_GetInactive(slots);
+    Ota_SlotInfo_t *info = &slots->record.slots[slot];
+
+    if (info->state != (uint8)Ota_SlotState_ready)
+        return FLASH4_ERROR;
+
+    info->state              = (uint8)Ota_SlotState_pending;
+    info->bootAttempts       = 0;
+    slots->record.activeSlot = slot;
+
+    return commit(slots);
+}
+
+uint8 Ota_Slots_SelectBoot(Ota_Slots_t *slots, uint8 *slot)
+{
+    Ota_SlotInfo_t *active = &slots->record.slots[slots->record.activeSlot];
+    Ota_SlotInfo_t *other  = &slots->record.slots[Ota_Slots_GetInactive(slots)];
+    uint8 result = FLASH4_OK;
+
+    if (active->state == (uint8)Ota_SlotState_pending)
+    {
+        if (active->bootAttempts >= OTA_MAX_BOOT_ATTEMPTS)
+        {
+            if (other->state != (uint8)Ota_SlotState_confirmed)
+                return FLASH4_ERROR;
+
+            /* Trial failed: roll back in the same record that invalidates the new image */
+            active->state            = (uint8)Ota_SlotState_invalid;
+            slots->record.activeSlot = Ota_Slots_GetInactive(slots);
+        }
+        else
+        {
+            active->bootAttempts++;
+        }
+
+        result = commit(slots);
+    }
+
+    *slot = slots->record.activeSlot;
+
+    return result;
+}
+
+uint8 Ota_Slots_Confirm(Ota_Slots_t *slots)
+{
+    Ota_SlotInfo_t *active = &slots->record.slots[slots->record.activeSlot];
+
+    if (active->state != (uint8)Ota_SlotState_pending)
+        return FLASH4_ERROR;
+
+    active->state = (uint8)Ota_SlotState_confirmed;
+
+    return commit(slots);
+}
+
+uint8 Ota_Slots_Verify(const Ota_Slots_t *slots, uint8 slot)
+{
+    const Ota_SlotInfo_t *info = &slots->record.slots[slot];
+
+    if (info->size == 0u || info->state == (uint8)Ota_SlotState_downloading)
+        return FLASH4_ERROR;
+
+    return (imageCrc(Ota_Slots_GetAddress(slot), info->size) == info->imageCrc) ? FLASH4_OK : FLASH4_ERROR;
+}
@@ -0,0 +1,168 @@
+/**********************************************************************************************************************
+ * \file Ota_Slots.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * A/B firmware slots in Flash4
+ * Two firmware slots share one metadata area holding version, size, CRC, digest, state and boot attempts of both
+ * slots. Metadata is never rewritten in place: every change appends a complete record with a higher sequence
+ * number and its own CRC to a journal of two alternating sectors. Programming one record is the commit point, so
+ * activating the new slot or rolling back is atomic; a record torn by a reset fails its CRC and the previous one
+ * stays in effect.
+ *
+ * Update flow:
+ *   Ota_Slots_BeginDownload()     inactive slot -> downloading, then write it e.g. with Ota_StreamWriter
+ *   Ota_Slots_CompleteDownload()  inactive slot -> ready, CRC computed from the programmed image
+ *                                 (Ota_Slots_RecordDownload() if the CRC is known from the download)
+ *   Ota_Slots_Activate()          ready slot becomes active in state pending
+ *   Ota_Slots_SelectBoot()        at startup, counts trial boots and rolls back after OTA_MAX_BOOT_ATTEMPTS
+ *   Ota_Slots_Confirm()           application is healthy, pending -> confirmed
+ * The active slot is never written during an update and stays readable the whole time.
+ *********************************************************************************************************************/
+
+#ifndef OTA_SLOTS_H_
+#define OTA_SLOTS_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+#include "Flash4_Config.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define OTA_SLOT_A                               0
+#define OTA_SLOT_B                               1
+#define OTA_SLOT_COUNT                           2
+#define OTA_SLOT_DIGEST_SIZE                     32          /* SHA-256 of the image from the update manifest */
+#define OTA_METADATA_MAGIC                       0x4154454DUL    /* "META" */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef enum
+{
+    Ota_SlotState_empty = 0,        /* No image                                                 */
+    Ota_SlotState_downloading,      /* Being written, content undefined                         */
+    Ota_SlotState_ready,            /* Complete image, not activated yet                        */
+    Ota_SlotState_pending,          /* Active, on trial until Ota_Slots_Confirm()               */
+    Ota_SlotState_confirmed,        /* Known good image                                         */
+    Ota_SlotState_invalid           /* Failed verification or trial boots                       */
+} Ota_SlotState;
+
+typedef struct
+{
+    uint32 version;                 /* Firmware version                                         */
+    uint32 size;                    /* Image size in bytes                                      */
+    uint8  state;                   /* Ota_SlotState                                            */
+    uint8  bootAttempts;            /* Trial boots in state pending                             */
+    uint16 imageCrc;                /* CRC-16 of the programmed image                           */
+    uint8  digest[OTA_SLOT_DIGEST_SIZE];
+} Ota_SlotInfo_t;
+
+/* Metadata record, one per page */
+typedef struct
+{
+    uint32         magic;           /* OTA_METADATA_MAGIC                                       */
+    uint32         sequence;        /* Incremented with every record, the highest valid wins    */
+    uint8          activeSlot;      /* OTA_SLOT_A or OTA_SLOT_B                                 */
+    uint8          reserved[3];
+    Ota_SlotInfo_t slots[OTA_SLOT_COUNT];
+    uint16         reserved2;
+    uint16         crc;             /* CRC-16 over the record with crc = 0                      */
+} Ota_SlotRecord_t;
+
+typedef struct
+{
+    Ota_SlotRecord_t record;        /* Current metadata                                         */
+    uint32           nextAddress;   /* Page for the next record                                 */
+} Ota_Slots_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Load the newest valid metadata record
+ * Without any record slot A is assumed to hold a confirmed image of unknown version, as stored by Example 7.
+ * \param slots Slot manager state
+ * \return FLASH4_OK
+ */
+uint8 Ota_Slots_Init(Ota_Slots_t *slots);
+
+/**
+ * \brief Flash4 address of a slot
+ * \param slot OTA_SLOT_A or OTA_SLOT_B
+ * \return Start address of the slot
+ */
+uint32 Ota_Slots_GetAddress(uint8 slot);
+
+/**
+ * \brief Slot not currently active, the target of downloads
+ * \param slots Slot manager state
+ * \return OTA_SLOT_A or OTA_SLOT_B
+ */
+uint8 Ota_Slots_GetInactive(const Ota_Slots_t *slots);
+
+/**
+ * \brief Mark the inactive slot as being downloaded, before its first sector is erased
+ * \param slots Slot manager state
+ * \return FLASH4_OK, FLASH4_ERROR if the active slot is still pending, or the metadata program error
+ */
+uint8 Ota_Slots_BeginDownload(Ota_Slots_t *slots);
+
+/**
+ * \brief Record a completely written inactive slot
+ * \param slots Slot manager state
+ * \param version Firmware version
+ * \param size Image size in bytes
+ * \param digest Image digest from the update manifest (OTA_SLOT_DIGEST_SIZE bytes), NULL_PTR if none
+ * \return FLASH4_OK, FLASH4_ERROR if no download was started or the size is invalid
+ */
+uint8 Ota_Slots_CompleteDownload(Ota_Slots_t *slots, uint32 version, uint32 size, const uint8 *digest);
+
+/**
+ * \brief Record a completely written inactive slot whose CRC is already known, without reading it back
+ * \param slots Slot manager state
+ * \param version Firmware version
+ * \param size Image size in bytes
+ * \param crc CRC-16 of the image, e.g. from Ota_Manifest_GetImageCrc()
+ * \param digest Image digest from the update manifest (OTA_SLOT_DIGEST_SIZE bytes), NULL_PTR if none
+ * \return FLASH4_OK, FLASH4_ERROR if no download was started or the size is invalid
+ */
+uint8 Ota_Slots_RecordDownload(Ota_Slots_t *slots, uint32 version, uint32 size, uint16 crc, const uint8 *digest);
+
+/**
+ * \brief Switch to the ready inactive slot with a single metadata record
+ * \param slots Slot manager state
+ * \return FLASH4_OK, FLASH4_ERROR if the inactive slot is not ready
+ */
+uint8 Ota_Slots_Activate(Ota_Slots_t *slots);
+
+/**
+ * \brief Select the slot to boot, call once per startup
+ * A pending slot is booted at most OTA_MAX_BOOT_ATTEMPTS times. After that it is marked invalid and the
+ * previous slot becomes active again.
+ * \param slots Slot manager state
+ * \param slot Output slot to boot
+ * \return FLASH4_OK, FLASH4_ERROR if a rollback is needed but the other slot is not confirmed
+ */
+uint8 Ota_Slots_SelectBoot(Ota_Slots_t *slots, uint8 *slot);
+
+/**
+ * \brief Confirm the pending active slot after a successful startup
+ * \param slots Slot manager state
+ * \return FLASH4_OK, FLASH4_ERROR if the active slot is not pending
+ */
+uint8 Ota_Slots_Confirm(Ota_Slots_t *slots);
+
+/**
+ * \brief Check the image of a slot against its recorded CRC
+ * \param slots Slot manager state
+ * \param slot OTA_SLOT_A or OTA_SLOT_B
+ * \return FLASH4_OK, FLASH4_ERROR on mismatch or if the slot has no image
+ */
+uint8 Ota_Slots_Verify(const Ota_Slots_t *slots, uint8 slot);
+
+#endif /* OTA_SLOTS_H_ */
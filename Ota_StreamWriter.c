@@ -0,0 +1,359 @@
+/**********************************************************************************************************************
+ * \file Ota_StreamWriter.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Pipelined streaming image writer for Flash4
+ *********************************************************************************************************************/
+
+#include "Ota_StreamWriter.h"
+#include "IfxStm.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define WRITER_SUSPEND_TIMEOUT_MS   1u      /* Erase suspend latency is in the order of 40 us */
+#define WRITER_SECTOR_BASE(addr)    ((addr) & ~(uint32)(FLASH4_SECTOR_SIZE - 1u))
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Length of the page at the ring head if it can be programmed now, 0 otherwise */
+static uint16 readyLength(const Ota_StreamWriter_t *writer)
+{
+    if (writer->status != FLASH4_OK || writer->programAddress >= writer->erasedLimit)
+        return 0;
+    if (writer->filled > 0u)
+        return FLASH4_MAX_PAGE_SIZE;
+    if (writer->finishing)
+        return writer->fill;
+    return 0;
+}
+
+static void startProgram(Ota_StreamWriter_t *writer, uint16 length)
+{
+    writer->programLength = length;
+    Flash4_WriteCommand(FLASH4_CMD_WRITE_ENABLE_WREN);
+    Flash4_PageProgram4(writer->ring[writer->head], writer->programAddress, length);
+    writer->operation = Ota_WriterOp_program;
+}
+
+/* Keep the first error, it is what Ota_StreamWriter_Finish() reports */
+static void recordError(Ota_StreamWriter_t *writer, uint8 result)
+{
+    if (writer->status == FLASH4_OK)
+        writer->status = result;
+}
+
+/* State of the running program or erase: FLASH4_BUSY, FLASH4_OK or FLASH4_ERROR on P_ERR / E_ERR */
+static uint8 operationResult(void)
+{
+    /* A failed operation keeps WIP set until the error is cleared, so the error bits are checked first */
+    if (Flash4_CheckError() != 0u)
+        return FLASH4_ERROR;
+
+    return Flash4_CheckWIP() ? FLASH4_BUSY : FLASH4_OK;
+}
+
+/* End the running page program, the page leaves the ring only if it was programmed */
+static void completeProgram(Ota_StreamWriter_t *writer, uint8 result)
+{
+    writer->operation = Ota_WriterOp_none;
+    if (result != FLASH4_OK)
+    {
+        recordError(writer, result);
+        return;
+    }
+
+    if (writer->filled > 0u)
+    {
+        writer->filled--;
+        writer->head = (uint8)((writer->head + 1u) % OTA_WRITER_RING_PAGES);
+    }
+    else
+    {
+        writer->fill = 0;   /* Partial last page */
+    }
+
+    writer->programAddress += writer->programLength;
+}
+
+/* End the running sector erase, the sector counts as erased only on success */
+static void completeErase(Ota_StreamWriter_t *writer, uint8 result)
+{
+    writer->operation = Ota_WriterOp_none;
+    if (result != FLASH4_OK)
+    {
+        recordError(writer, result);
+        return;
+    }
+
+    writer->erasedLimit = writer->eraseAddress + FLASH4_SECTOR_SIZE;
+}
+
+/* Keep the sector after the one the transport is filling erased, but never erase beyond the image */
+static boolean needsErase(const Ota_StreamWriter_t *writer)
+{
+    uint32 dataEnd = writer->startAddress + writer->bytesAccepted;
+
+    if (writer->erasedLimit >= writer->endAddress)
+        return FALSE;
+    if (writer->finishing)
+        return writer->erasedLimit < dataEnd;
+
+    return writer->erasedLimit < WRITER_SECTOR_BASE(dataEnd) + 2u * FLASH4_SECTOR_SIZE;
+}
+
+static void suspendErase(Ota_StreamWriter_t *writer)
+{
+    uint8 result;
+
+    Flash4_WriteCommand(FLASH4_CMD_ERASE_SUSPEND);
+    result = Flash4_WaitReady(WRITER_SUSPEND_TIMEOUT_MS);
+
+    /* Still erasing after a timeout: the flash is not readable and the erase stays the running operation */
+    if (result == FLASH4_TIMEOUT_ERROR)
+    {
+        recordError(writer, result);
+        return;
+    }
+    if (result != FLASH4_OK)
+    {
+        completeErase(writer, result);
+        return;
+    }
+
+    writer->eraseSuspended = TRUE;
+    writer->operation      = Ota_WriterOp_none;
+    writer->suspendCount++;
+}
+
+/* Nothing left to do; after an error the buffered pages are given up, only the running operation is awaited */
+static boolean isIdle(const Ota_StreamWriter_t *writer)
+{
+    return writer->operation == Ota_WriterOp_none && !writer->eraseSuspended &&
+           (writer->status != FLASH4_OK || (writer->filled == 0u && writer->fill == 0u));
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+uint8 Ota_StreamWriter_Init(Ota_StreamWriter_t *writer, uint32 startAddress, uint32 maxSize)
+{
+    if (startAddress % FLASH4_SECTOR_SIZE != 0u || maxSize == 0u)
+        return FLASH4_ERROR;
+
+    writer->startAddress   = startAddress;
+    writer->endAddress     = startAddress + maxSize;
+    writer->bytesAccepted  = 0;
+    writer->programAddress = startAddress;
+    writer->erasedLimit    = startAddress;
+    writer->eraseAddress   = startAddress;
+    writer->operation      = Ota_WriterOp_none;
+    writer->eraseSuspended = FALSE;
+    writer->finishing      = FALSE;
+    writer->status         = FLASH4_OK;
+    writer->head           = 0;
+    writer->filled         = 0;
+    writer->fill           = 0;
+    writer->programLength  = 0;
+    writer->eraseCount     = 0;
+    writer->suspendCount   = 0;
+
+    Ota_StreamWriter_Poll(writer);
+
+    return FLASH4_OK;
+}
+
+uint32 Ota_StreamWriter_Write(Ota_StreamWriter_t *writer, const uint8 *data, uint32 length)
+{
+    uint32 accepted = 0;
+    uint8 *buffer;
+    uint32 n;
+
+    if (writer->status != FLASH4_OK)
+        return Ota_StreamWriter_Commit(writer, length);
+
+    while (accepted < length && (buffer = Ota_StreamWriter_GetBuffer(writer, accepted, &n)) != NULL_PTR)
+    {
+        if (n > length - accepted)
+            n = length - accepted;
+
+        memcpy(buffer, &data[accepted], n);
+        accepted += n;
+    }
+
+    return Ota_StreamWriter_Commit(writer, accepted);
+}
+
+uint8 *Ota_StreamWriter_GetBuffer(Ota_StreamWriter_t *writer, uint32 offset, uint32 *length)
+{
+    uint32 used = (uint32)writer->filled * FLASH4_MAX_PAGE_SIZE + writer->fill + offset;
+    uint32 page;
+    uint32 position;
+
+    if (writer->status != FLASH4_OK || writer->finishing || used >= OTA_WRITER_RING_PAGES * FLASH4_MAX_PAGE_SIZE)
+    {
+        *length = 0;
+        return NULL_PTR;
+    }
+
+    /* Pages leaving the ring advance head and lower filled together, so the slot of a position does not change */
+    page     = (writer->head + used / FLASH4_MAX_PAGE_SIZE) % OTA_WRITER_RING_PAGES;
+    position = used % FLASH4_MAX_PAGE_SIZE;
+    *length  = FLASH4_MAX_PAGE_SIZE - position;
+
+    return &writer->ring[page][position];
+}
+
+uint32 Ota_StreamWriter_Commit(Ota_StreamWriter_t *writer, uint32 length)
+{
+    uint32 space = writer->endAddress - writer->startAddress - writer->bytesAccepted;
+
+    /* After an error the data is dropped, so the producer runs on to Ota_StreamWriter_Finish() which reports it */
+    if (writer->status != FLASH4_OK)
+    {
+        Ota_StreamWriter_Poll(writer);
+        return length;
+    }
+
+    if (writer->finishing)
+        return 0;
+
+    if (length > space)
+    {
+        writer->status = FLASH4_ERROR;
+        length         = space;
+    }
+
+    writer->fill   += (uint16)(length % FLASH4_MAX_PAGE_SIZE);
+    writer->filled += (uint8)(length / FLASH4_MAX_PAGE_SIZE);
+    if (writer->fill >= FLASH4_MAX_PAGE_SIZE)
+    {
+        writer->fill -= FLASH4_MAX_PAGE_SIZE;
+        writer->filled++;
+    }
+
+    writer->bytesAccepted += length;
+    Ota_StreamWriter_Poll(writer);
+
+    return length;
+}
+
+void Ota_StreamWriter_Poll(Ota_StreamWriter_t *writer)
+{
+    uint16 length;
+    uint8  result;
+
+    if (writer->operation == Ota_WriterOp_program)
+    {
+        result = operationResult();
+        if (result == FLASH4_BUSY)
+            return;
+        completeProgram(writer, result);
+    }
+    else if (writer->operation == Ota_WriterOp_erase)
+    {
+        result = operationResult();
+        if (result != FLASH4_BUSY)
+        {
+            completeErase(writer, result);
+        }
+        else if (writer->filled < OTA_WRITER_RING_PAGES || readyLength(writer) == 0u)
+        {
+            return;
+        }
+        else
+        {
+            /* Ring full and the transport stalls: program inside the erase */
+            suspendErase(writer);
+        }
+    }
+
+    /* After an error nothing new is started, a suspended erase is resumed so the flash ends up idle */
+    if (writer->status != FLASH4_OK)
+    {
+        if (writer->eraseSuspended)
+        {
+            Flash4_WriteCommand(FLASH4_CMD_ERASE_RESUME);
+            writer->eraseSuspended = FALSE;
+            writer->operation      = Ota_WriterOp_erase;
+        }
+        return;
+    }
+
+    length = readyLength(writer);
+
+    if (writer->eraseSuspended)
+    {
+        /* Drain half of the ring, then give the erase time to progress while the transport refills it */
+        if (length > 0u && writer->filled > OTA_WRITER_RING_PAGES / 2u)
+        {
+            startProgram(writer, length);
+        }
+        else
+        {
+            /* If the erase finished just before the suspend, resume is ignored and WIP reads 0 on the next poll */
+            Flash4_WriteCommand(FLASH4_CMD_ERASE_RESUME);
+            writer->eraseSuspended = FALSE;
+            writer->operation      = Ota_WriterOp_erase;
+        }
+    }
+    else if (needsErase(writer))
+    {
+        /* Erase ahead first, pages buffered meanwhile are programmed by suspending it */
+        writer->eraseAddress = writer->erasedLimit;
+        Flash4_WriteCommand(FLASH4_CMD_WRITE_ENABLE_WREN);
+        Flash4_SectorErase4(writer->eraseAddress);
+        writer->operation = Ota_WriterOp_erase;
+        writer->eraseCount++;
+    }
+    else if (length > 0u)
+    {
+        startProgram(writer, length);
+    }
+}
+
+void Ota_StreamWriter_SuspendForRead(Ota_StreamWriter_t *writer)
+{
+    uint8 result;
+
+    if (writer->operation == Ota_WriterOp_program)
+    {
+        result = Flash4_WaitReady(FLASH4_PROGRAM_TIMEOUT_MS);
+
+        /* A program still running after the timeout is left to Ota_StreamWriter_Poll(), it is not done yet */
+        if (result == FLASH4_TIMEOUT_ERROR)
+            recordError(writer, result);
+        else
+            completeProgram(writer, result);
+    }
+    else if (writer->operation == Ota_WriterOp_erase)
+    {
+        suspendErase(writer);
+    }
+}
+
+uint8 Ota_StreamWriter_GetStatus(const Ota_StreamWriter_t *writer)
+{
+    return writer->status;
+}
+
+uint8 Ota_StreamWriter_Finish(Ota_StreamWriter_t *writer, uint32 timeoutMs)
+{
+    uint32 startTime    = IfxStm_get(&MODULE_STM0);
+    uint32 timeoutTicks = timeoutMs * (uint32)(IfxStm_getFrequency(&MODULE_STM0) / 1000u);
+
+    writer->finishing = TRUE;
+
+    while (!isIdle(writer))
+    {
+        if ((IfxStm_get(&MODULE_STM0) - startTime) > timeoutTicks)
+            return FLASH4_TIMEOUT_ERROR;
+        Ota_StreamWriter_Poll(writer);
+    }
+
+    return writer->status;
+}
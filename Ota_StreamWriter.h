@@ -0,0 +1,135 @@
+/**********************************************************************************************************************
+ * \file Ota_StreamWriter.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Pipelined streaming image writer for Flash4
+ * Image chunks are accepted as they arrive from the transport and collected in a small ring of page buffers, so RAM
+ * use does not depend on the image size. Flash operations are started from Ota_StreamWriter_Poll() without waiting
+ * for them: a full page is programmed as soon as its sector is erased, and the next sector is erased ahead while the
+ * transport delivers data for the current one. Pages are buffered while the erase runs; once the ring is full the
+ * erase is suspended, half the ring is programmed and the erase resumed. Staging therefore takes about
+ * max(transport time, program time) instead of their sum.
+ *********************************************************************************************************************/
+
+#ifndef OTA_STREAMWRITER_H_
+#define OTA_STREAMWRITER_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+#include "Flash4_Driver.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define OTA_WRITER_RING_PAGES                    4           /* Page buffers between transport and flash */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef enum
+{
+    Ota_WriterOp_none = 0,
+    Ota_WriterOp_program,
+    Ota_WriterOp_erase
+} Ota_WriterOp;
+
+typedef struct
+{
+    uint32       startAddress;      /* Sector aligned start of the image              */
+    uint32       endAddress;        /* End of the image or of the target area          */
+    uint32       bytesAccepted;     /* Bytes taken from the transport                  */
+    uint32       programAddress;    /* Next page to program                            */
+    uint32       erasedLimit;       /* Everything below is erased                      */
+    uint32       eraseAddress;      /* Sector being erased                             */
+    Ota_WriterOp operation;         /* Flash operation in progress                     */
+    boolean      eraseSuspended;
+    boolean      finishing;         /* Partial last page may be programmed             */
+    uint8        status;            /* FLASH4_OK or first error, stops the pipeline    */
+    uint8        head;              /* Ring slot being programmed next                 */
+    uint8        filled;            /* Complete pages waiting in the ring              */
+    uint16       fill;              /* Bytes in the page being filled                  */
+    uint16       programLength;     /* Length of the page being programmed             */
+    uint32       eraseCount;        /* Statistics                                      */
+    uint32       suspendCount;
+    uint8        ring[OTA_WRITER_RING_PAGES][FLASH4_MAX_PAGE_SIZE];
+} Ota_StreamWriter_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Start writing an image and begin erasing its first sector
+ * \param writer Writer state
+ * \param startAddress Sector aligned Flash4 address of the image
+ * \param maxSize Announced image size, or the size of the target area if unknown. No sector beyond it is erased.
+ * \return FLASH4_OK, FLASH4_ERROR on invalid parameters
+ */
+uint8 Ota_StreamWriter_Init(Ota_StreamWriter_t *writer, uint32 startAddress, uint32 maxSize);
+
+/**
+ * \brief Accept image data from the transport
+ * Copies as much as fits into the page ring and advances the flash pipeline. If less than length is accepted the
+ * caller retries the rest later, e.g. after its next Ota_StreamWriter_Poll(). After a flash error all data is taken
+ * and dropped, see Ota_StreamWriter_GetStatus().
+ * \param writer Writer state
+ * \param data Image data
+ * \param length Number of bytes
+ * \return Number of bytes accepted
+ */
+uint32 Ota_StreamWriter_Write(Ota_StreamWriter_t *writer, const uint8 *data, uint32 length);
+
+/**
+ * \brief Free space in the page ring, to produce image data in place instead of copying it in
+ * Data placed at increasing offsets is taken over by Ota_StreamWriter_Commit(); until then it may be rewritten or
+ * dropped, and Ota_StreamWriter_Poll() may run in between.
+ * \param writer Writer state
+ * \param offset Bytes already placed after the accepted data
+ * \param length Output, contiguous bytes available at the returned pointer
+ * \return Pointer into the ring, NULL_PTR if the ring is full at offset or after a flash error
+ */
+uint8 *Ota_StreamWriter_GetBuffer(Ota_StreamWriter_t *writer, uint32 offset, uint32 *length);
+
+/**
+ * \brief Accept data placed with Ota_StreamWriter_GetBuffer() and advance the flash pipeline
+ * \param writer Writer state
+ * \param length Number of bytes, at most what the buffers returned so far hold
+ * \return Number of bytes accepted, all of them after a flash error (dropped)
+ */
+uint32 Ota_StreamWriter_Commit(Ota_StreamWriter_t *writer, uint32 length);
+
+/**
+ * \brief Advance the flash pipeline without waiting, call while the transport is waiting for data
+ * \param writer Writer state
+ */
+void Ota_StreamWriter_Poll(Ota_StreamWriter_t *writer);
+
+/**
+ * \brief Make the flash readable, e.g. to read the active firmware slot while an update is being written
+ * Waits for a running page program (below 1 ms) and suspends a running erase. The next Ota_StreamWriter_Poll()
+ * or Ota_StreamWriter_Write() continues the pipeline. Call it only right before a read: an erase that is
+ * suspended again immediately after every resume makes no progress. If the program does not end or the erase
+ * does not suspend in time, the error is kept in the writer status and Ota_StreamWriter_Finish() reports it.
+ * \param writer Writer state
+ */
+void Ota_StreamWriter_SuspendForRead(Ota_StreamWriter_t *writer);
+
+/**
+ * \brief First error of the pipeline, to stop producing data once the image cannot be written anymore
+ * \param writer Writer state
+ * \return FLASH4_OK or the first error, which Ota_StreamWriter_Finish() also reports
+ */
+uint8 Ota_StreamWriter_GetStatus(const Ota_StreamWriter_t *writer);
+
+/**
+ * \brief Program the remaining data and wait until the flash is idle
+ * \param writer Writer state
+ * \param timeoutMs Timeout in milliseconds
+ * \return FLASH4_OK, FLASH4_ERROR if more than maxSize bytes were written or a program or erase failed (P_ERR /
+ *         E_ERR), FLASH4_TIMEOUT if the flash did not finish in time or did not suspend / end an operation
+ */
+uint8 Ota_StreamWriter_Finish(Ota_StreamWriter_t *writer, uint32 timeoutMs);
+
+#endif /* OTA_STREAMWRITER_H_ */
@@ -0,0 +1,566 @@
+/**********************************************************************************************************************
+ * \file P256.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * ECDSA P-256 verification implementation
+ *********************************************************************************************************************/
+
+#include "P256.h"
+#include "P256_BaseTable.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define P256_WORDS                  8
+#define P256_NAF_DIGITS             257         /* Width-4 NAF of a 256-bit scalar      */
+#define P256_Q_MULTIPLES            4           /* Q, 3Q, 5Q, 7Q                        */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 m[P256_WORDS];           /* Modulus, least significant word first       */
+    uint32 rr[P256_WORDS];          /* 2^512 mod m, converts to Montgomery form    */
+    uint32 m0inv;                   /* -m^-1 mod 2^32                              */
+} P256_Modulus_t;
+
+typedef struct
+{
+    uint32 x[P256_WORDS];           /* Jacobian coordinates in Montgomery form     */
+    uint32 y[P256_WORDS];
+    uint32 z[P256_WORDS];           /* Zero for the point at infinity              */
+} P256_Point_t;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static const P256_Modulus_t g_p256Field = {
+    {0xFFFFFFFFuL, 0xFFFFFFFFuL, 0xFFFFFFFFuL, 0x00000000uL, 0x00000000uL, 0x00000000uL, 0x00000001uL, 0xFFFFFFFFuL},
+    {0x00000003uL, 0x00000000uL, 0xFFFFFFFFuL, 0xFFFFFFFBuL, 0xFFFFFFFEuL, 0xFFFFFFFFuL, 0xFFFFFFFDuL, 0x00000004uL},
+    0x00000001uL
+};
+
+static const P256_Modulus_t g_p256Order = {
+    {0xFC632551uL, 0xF3B9CAC2uL, 0xA7179E84uL, 0xBCE6FAADuL, 0xFFFFFFFFuL, 0xFFFFFFFFuL, 0x00000000uL, 0xFFFFFFFFuL},
+    {0xBE79EEA2uL, 0x83244C95uL, 0x49BD6FA6uL, 0x4699799CuL, 0x2B6BEC59uL, 0x2845B239uL, 0xF3D95620uL, 0x66E12D94uL},
+    0xEE00BC4FuL
+};
+
+/* Curve constant b and the base point G in Montgomery form, Z = 1 in Montgomery form is 2^256 mod p */
+static const uint32 g_p256B[P256_WORDS] = {
+    0x29C4BDDFuL, 0xD89CDF62uL, 0x78843090uL, 0xACF005CDuL, 0xF7212ED6uL, 0xE5A220ABuL, 0x04874834uL, 0xDC30061DuL
+};
+
+static const P256_Point_t g_p256G = {
+    {0x18A9143CuL, 0x79E730D4uL, 0x5FEDB601uL, 0x75BA95FCuL, 0x77622510uL, 0x79FB732BuL, 0xA53755C6uL, 0x18905F76uL},
+    {0xCE95560AuL, 0xDDF25357uL, 0xBA19E45CuL, 0x8B4AB8E4uL, 0xDD21F325uL, 0xD2E88688uL, 0x25885D85uL, 0x8571FF18uL},
+    {0x00000001uL, 0x00000000uL, 0x00000000uL, 0xFFFFFFFFuL, 0xFFFFFFFFuL, 0xFFFFFFFFuL, 0xFFFFFFFEuL, 0x00000000uL}
+};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Big endian bytes to words */
+static void fromBytes(uint32 *r, const uint8 *in)
+{
+    uint32 i;
+
+    for (i = 0; i < P256_WORDS; i++)
+    {
+        const uint8 *b = &in[4u * (P256_WORDS - 1u - i)];
+
+        r[i] = ((uint32)b[0] << 24) | ((uint32)b[1] << 16) | ((uint32)b[2] << 8) | b[3];
+    }
+}
+
+static uint32 addWords(uint32 *r, const uint32 *a, const uint32 *b)
+{
+    uint64 sum = 0;
+    uint32 i;
+
+    for (i = 0; i < P256_WORDS; i++)
+    {
+        sum  += (uint64)a[i] + b[i];
+        r[i]  = (uint32)sum;
+        sum >>= 32;
+    }
+
+    return (uint32)sum;
+}
+
+static uint32 subWords(uint32 *r, const uint32 *a, const uint32 *b)
+{
+    uint64 borrow = 0;
+    uint64 diff;
+    uint32 i;
+
+    for (i = 0; i < P256_WORDS; i++)
+    {
+        diff   = (uint64)a[i] - b[i] - borrow;
+        r[i]   = (uint32)diff;
+        borrow = (diff >> 32) & 1u;
+    }
+
+    return (uint32)borrow;
+}
+
+static boolean isZero(const uint32 *a)
+{
+    uint32 bits = 0;
+    uint32 i;
+
+    for (i = 0; i < P256_WORDS; i++)
+        bits |= a[i];
+
+    return (bits == 0u) ? TRUE : FALSE;
+}
+
+static boolean lessThan(const uint32 *a, const uint32 *b)
+{
+    sint32 i;
+
+    for (i = P256_WORDS - 1; i >= 0; i--)
+    {
+        if (a[i] != b[i])
+            return (a[i] < b[i]) ? TRUE : FALSE;
+    }
+
+    return FALSE;
+}
+
+static boolean equal(const uint32 *a, const uint32 *b)
+{
+    return (memcmp(a, b, P256_WORDS * sizeof(uint32)) == 0) ? TRUE : FALSE;
+}
+
+/* r = a + b mod m for a, b < m */
+static void modAdd(uint32 *r, const uint32 *a, const uint32 *b, const P256_Modulus_t *mod)
+{
+    if (addWords(r, a, b) != 0u || !lessThan(r, mod->m))
+        (void)subWords(r, r, mod->m);
+}
+
+/* r = a - b mod m for a, b < m */
+static void modSub(uint32 *r, const uint32 *a, const uint32 *b, const P256_Modulus_t *mod)
+{
+    if (subWords(r, a, b) != 0u)
+        (void)addWords(r, r, mod->m);
+}
+
+/* r = a * b * 2^-256 mod m (CIOS), r may alias a or b */
+static void montMul(uint32 *r, const uint32 *a, const uint32 *b, const P256_Modulus_t *mod)
+{
+    uint32 t[P256_WORDS + 2u];
+    uint64 acc;
+    uint32 q;
+    uint32 i;
+    uint32 j;
+
+    memset(t, 0, sizeof(t));
+    for (i = 0; i < P256_WORDS; i++)
+    {
+        acc = 0;
+        for (j = 0; j < P256_WORDS; j++)
+        {
+            acc  = (uint64)a[j] * b[i] + t[j] + (acc >> 32);
+            t[j] = (uint32)acc;
+        }
+        acc                = (uint64)t[P256_WORDS] + (acc >> 32);
+        t[P256_WORDS]      = (uint32)acc;
+        t[P256_WORDS + 1u] = (uint32)(acc >> 32);
+
+        /* Add q * m so the lowest word becomes zero, and shift it out */
+        q   = t[0] * mod->m0inv;
+        acc = (uint64)q * mod->m[0] + t[0];
+        for (j = 1; j < P256_WORDS; j++)
+        {
+            acc       = (uint64)q * mod->m[j] + t[j] + (acc >> 32);
+            t[j - 1u] = (uint32)acc;
+        }
+        acc                = (uint64)t[P256_WORDS] + (acc >> 32);
+        t[P256_WORDS - 1u] = (uint32)acc;
+        t[P256_WORDS]      = t[P256_WORDS + 1u] + (uint32)(acc >> 32);
+    }
+
+    if (t[P256_WORDS] != 0u || !lessThan(t, mod->m))
+        (void)subWords(t, t, mod->m);
+    memcpy(r, t, P256_WORDS * sizeof(uint32));
+}
+
+/* r = a^(m-2) = a^-1 mod m in Montgomery form, a not zero */
+static void modInvert(uint32 *r, const uint32 *a, const P256_Modulus_t *mod)
+{
+    uint32 exponent[P256_WORDS];
+    uint32 base[P256_WORDS];
+    sint32 i;
+
+    memcpy(exponent, mod->m, sizeof(exponent));
+    exponent[0] -= 2u;              /* No borrow, the lowest word of p and n is larger */
+    memcpy(base, a, sizeof(base));
+    memcpy(r, a, sizeof(base));
+
+    /* The top bit of m - 2 is set */
+    for (i = 254; i >= 0; i--)
+    {
+        montMul(r, r, r, mod);
+        if ((exponent[i >> 5] >> (i & 31)) & 1u)
+            montMul(r, r, base, mod);
+    }
+}
+
+static void fieldMul(uint32 *r, const uint32 *a, const uint32 *b)
+{
+    montMul(r, a, b, &g_p256Field);
+}
+
+static void fieldAdd(uint32 *r, const uint32 *a, const uint32 *b)
+{
+    modAdd(r, a, b, &g_p256Field);
+}
+
+static void fieldSub(uint32 *r, const uint32 *a, const uint32 *b)
+{
+    modSub(r, a, b, &g_p256Field);
+}
+
+/* r = 2 * a, dbl-2001-b for a = -3, r may alias a */
+static void pointDouble(P256_Point_t *r, const P256_Point_t *a)
+{
+    uint32 delta[P256_WORDS];
+    uint32 gamma[P256_WORDS];
+    uint32 beta[P256_WORDS];
+    uint32 alpha[P256_WORDS];
+    uint32 t[P256_WORDS];
+
+    fieldMul(delta, a->z, a->z);
+    fieldMul(gamma, a->y, a->y);
+    fieldMul(beta, a->x, gamma);
+
+    /* alpha = 3 * (x - delta) * (x + delta) */
+    fieldSub(t, a->x, delta);
+    fieldAdd(alpha, a->x, delta);
+    fieldMul(alpha, alpha, t);
+    fieldAdd(t, alpha, alpha);
+    fieldAdd(alpha, alpha, t);
+
+    /* z3 = (y + z)^2 - gamma - delta */
+    fieldAdd(t, a->y, a->z);
+    fieldMul(r->z, t, t);
+    fieldSub(r->z, r->z, gamma);
+    fieldSub(r->z, r->z, delta);
+
+    /* x3 = alpha^2 - 8 * beta */
+    fieldAdd(beta, beta, beta);
+    fieldAdd(beta, beta, beta);
+    fieldAdd(t, beta, beta);
+    fieldMul(r->x, alpha, alpha);
+    fieldSub(r->x, r->x, t);
+
+    /* y3 = alpha * (4 * beta - x3) - 8 * gamma^2 */
+    fieldSub(beta, beta, r->x);
+    fieldMul(beta, alpha, beta);
+    fieldMul(gamma, gamma, gamma);
+    fieldAdd(gamma, gamma, gamma);
+    fieldAdd(gamma, gamma, gamma);
+    fieldAdd(gamma, gamma, gamma);
+    fieldSub(r->y, beta, gamma);
+}
+
+/* r = a + b, add-1998-cmo-2, r may alias a */
+static void pointAdd(P256_Point_t *r, const P256_Point_t *a, const P256_Point_t *b)
+{
+    uint32 u1[P256_WORDS];
+    uint32 u2[P256_WORDS];
+    uint32 s1[P256_WORDS];
+    uint32 s2[P256_WORDS];
+    uint32 h[P256_WORDS];
+    uint32 t[P256_WORDS];
+
+    if (isZero(a->z))
+    {
+        *r = *b;
+        return;
+    }
+    if (isZero(b->z))
+    {
+        *r = *a;
+        return;
+    }
+
+    fieldMul(t, b->z, b->z);
+    fieldMul(u1, a->x, t);
+    fieldMul(s1, a->y, t);
+    fieldMul(s1, s1, b->z);
+    fieldMul(t, a->z, a->z);
+    fieldMul(u2, b->x, t);
+    fieldMul(s2, b->y, t);
+    fieldMul(s2, s2, a->z);
+
+    fieldSub(h, u2, u1);
+    fieldSub(s2, s2, s1);          /* s2 is R from here on */
+    if (isZero(h))
+    {
+        if (isZero(s2))
+            pointDouble(r, a);
+        else
+            memset(r->z, 0, sizeof(r->z));
+        return;
+    }
+
+    /* z3 = z1 * z2 * h */
+    fieldMul(r->z, a->z, b->z);
+    fieldMul(r->z, r->z, h);
+
+    /* x3 = R^2 - h^3 - 2 * u1 * h^2 */
+    fieldMul(t, h, h);
+    fieldMul(u1, u1, t);
+    fieldMul(h, h, t);
+    fieldMul(r->x, s2, s2);
+    fieldSub(r->x, r->x, h);
+    fieldSub(r->x, r->x, u1);
+    fieldSub(r->x, r->x, u1);
+
+    /* y3 = R * (u1 * h^2 - x3) - s1 * h^3 */
+    fieldSub(u1, u1, r->x);
+    fieldMul(u1, u1, s2);
+    fieldMul(s1, s1, h);
+    fieldSub(r->y, u1, s1);
+}
+
+/* r = a + (x, y) for an affine point from the base table, add-1998-cmo-2 with Z2 = 1, r may alias a */
+static void pointAddAffine(P256_Point_t *r, const P256_Point_t *a, const uint32 *x, const uint32 *y)
+{
+    uint32 u2[P256_WORDS];
+    uint32 s2[P256_WORDS];
+    uint32 h[P256_WORDS];
+    uint32 hh[P256_WORDS];
+    uint32 t[P256_WORDS];
+
+    if (isZero(a->z))
+    {
+        memcpy(r->x, x, sizeof(r->x));
+        memcpy(r->y, y, sizeof(r->y));
+        memcpy(r->z, g_p256G.z, sizeof(r->z));
+        return;
+    }
+
+    fieldMul(t, a->z, a->z);
+    fieldMul(u2, x, t);
+    fieldMul(s2, y, t);
+    fieldMul(s2, s2, a->z);
+
+    fieldSub(h, u2, a->x);
+    fieldSub(s2, s2, a->y);        /* s2 is R from here on */
+    if (isZero(h))
+    {
+        if (isZero(s2))
+            pointDouble(r, a);
+        else
+            memset(r->z, 0, sizeof(r->z));
+        return;
+    }
+
+    /* z3 = z1 * h */
+    fieldMul(r->z, a->z, h);
+
+    /* x3 = R^2 - h^3 - 2 * x1 * h^2 */
+    fieldMul(hh, h, h);
+    fieldMul(u2, a->x, hh);
+    fieldMul(h, h, hh);
+    fieldMul(t, a->y, h);
+    fieldMul(r->x, s2, s2);
+    fieldSub(r->x, r->x, h);
+    fieldSub(r->x, r->x, u2);
+    fieldSub(r->x, r->x, u2);
+
+    /* y3 = R * (x1 * h^2 - x3) - y1 * h^3 */
+    fieldSub(u2, u2, r->x);
+    fieldMul(u2, u2, s2);
+    fieldSub(r->y, u2, t);
+}
+
+/* y = -y, the negative of a point */
+static void negateY(uint32 *y)
+{
+    static const uint32 zero[P256_WORDS] = {0};
+
+    fieldSub(y, zero, y);
+}
+
+/* Bit i of a 256-bit scalar, zero above */
+static uint32 bitAt(const uint32 *k, uint32 i)
+{
+    return (i < 256u) ? ((k[i >> 5] >> (i & 31u)) & 1u) : 0u;
+}
+
+/* Width-4 NAF, digits odd in [-7, 7] or zero and at least three zeros after each nonzero digit */
+static void recodeNaf(sint8 *naf, const uint32 *k)
+{
+    uint32 carry = 0;
+    uint32 word;
+    uint32 i     = 0;
+
+    memset(naf, 0, P256_NAF_DIGITS);
+    while (i < P256_NAF_DIGITS)
+    {
+        if (bitAt(k, i) == carry)
+        {
+            i++;
+            continue;
+        }
+
+        /* The window value is odd, subtract 16 from the upper half and carry it into the next window */
+        word   = bitAt(k, i) | (bitAt(k, i + 1u) << 1) | (bitAt(k, i + 2u) << 2) | (bitAt(k, i + 3u) << 3);
+        word  += carry;
+        carry  = (word >> 3) & 1u;
+        naf[i] = (sint8)((sint32)word - (sint32)(carry << 4));
+        i     += 4u;
+    }
+}
+
+/* Affine public key to Jacobian Montgomery form, FALSE unless it is a point on the curve */
+static boolean loadPoint(P256_Point_t *r, const uint8 *in)
+{
+    uint32 lhs[P256_WORDS];
+    uint32 rhs[P256_WORDS];
+    uint32 t[P256_WORDS];
+
+    fromBytes(r->x, in);
+    fromBytes(r->y, &in[P256_SCALAR_SIZE]);
+    if (!lessThan(r->x, g_p256Field.m) || !lessThan(r->y, g_p256Field.m))
+        return FALSE;
+
+    fieldMul(r->x, r->x, g_p256Field.rr);
+    fieldMul(r->y, r->y, g_p256Field.rr);
+    memcpy(r->z, g_p256G.z, sizeof(r->z));
+
+    /* y^2 = x^3 - 3x + b */
+    fieldMul(lhs, r->y, r->y);
+    fieldMul(rhs, r->x, r->x);
+    fieldMul(rhs, rhs, r->x);
+    fieldAdd(t, r->x, r->x);
+    fieldAdd(t, t, r->x);
+    fieldSub(rhs, rhs, t);
+    fieldAdd(rhs, rhs, g_p256B);
+
+    return equal(lhs, rhs);
+}
+
+/* Check x(point) mod n == r as X == r * Z^2, also for x = r + n when that is below p */
+static boolean matchesX(const P256_Point_t *point, const uint32 *r)
+{
+    uint32 zz[P256_WORDS];
+    uint32 candidate[P256_WORDS];
+    uint32 t[P256_WORDS];
+
+    fieldMul(zz, point->z, point->z);
+
+    fieldMul(t, r, g_p256Field.rr);
+    fieldMul(t, t, zz);
+    if (equal(t, point->x))
+        return TRUE;
+
+    if (addWords(candidate, r, g_p256Order.m) != 0u || !lessThan(candidate, g_p256Field.m))
+        return FALSE;
+    fieldMul(t, candidate, g_p256Field.rr);
+    fieldMul(t, t, zz);
+
+    return equal(t, point->x);
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+boolean P256_Verify(const uint8 *publicKey, const uint8 *digest, const uint8 *signature)
+{
+    P256_Point_t table[P256_Q_MULTIPLES];   /* Q, 3Q, 5Q, 7Q */
+    P256_Point_t sum;
+    sint8        naf[P256_NAF_DIGITS];
+    uint32       r[P256_WORDS];
+    uint32       s[P256_WORDS];
+    uint32       e[P256_WORDS];
+    uint32       u1[P256_WORDS];
+    uint32       u2[P256_WORDS];
+    uint32       y[P256_WORDS];
+    uint32       carry;
+    uint32       nibble;
+    sint32       digit;
+    boolean      negate;
+    sint32       i;
+
+    fromBytes(r, signature);
+    fromBytes(s, &signature[P256_SCALAR_SIZE]);
+    if (isZero(r) || isZero(s) || !lessThan(r, g_p256Order.m) || !lessThan(s, g_p256Order.m))
+        return FALSE;
+    if (!loadPoint(&table[0], publicKey))
+        return FALSE;
+
+    /* The digest is as long as n, one subtraction reduces it */
+    fromBytes(e, digest);
+    if (!lessThan(e, g_p256Order.m))
+        (void)subWords(e, e, g_p256Order.m);
+
+    /* u1 = e / s and u2 = r / s, s^-1 is in Montgomery form so the products come out normal */
+    montMul(s, s, g_p256Order.rr, &g_p256Order);
+    modInvert(s, s, &g_p256Order);
+    montMul(u1, e, s, &g_p256Order);
+    montMul(u2, r, s, &g_p256Order);
+
+    /* u2 * Q: odd multiples of Q, then one doubling per bit and an addition per nonzero NAF digit */
+    pointDouble(&sum, &table[0]);
+    for (i = 1; i < P256_Q_MULTIPLES; i++)
+        pointAdd(&table[i], &table[i - 1], &sum);
+
+    recodeNaf(naf, u2);
+    memset(&sum, 0, sizeof(sum));
+    for (i = P256_NAF_DIGITS - 1; i >= 0; i--)
+    {
+        pointDouble(&sum, &sum);
+        digit = naf[i];
+        if (digit > 0)
+        {
+            pointAdd(&sum, &sum, &table[digit >> 1]);
+        }
+        else if (digit < 0)
+        {
+            /* Add -kQ by negating the table entry for this addition */
+            negateY(table[(-digit) >> 1].y);
+            pointAdd(&sum, &sum, &table[(-digit) >> 1]);
+            negateY(table[(-digit) >> 1].y);
+        }
+    }
+
+    /*
+     * u1 * G without doublings: signed 4-bit digits in [-7, 8], digit j selects |digit| * 16^j * G from the base
+     * table. If the top digit could carry out of 256 bits, n - u1 is used instead and every point negated.
+     */
+    negate = (u1[P256_WORDS - 1u] >= 0x80000000uL) ? TRUE : FALSE;
+    if (negate)
+        (void)subWords(u1, g_p256Order.m, u1);
+
+    carry = 0;
+    for (i = 0; i < P256_BASE_WINDOWS; i++)
+    {
+        nibble = ((u1[i >> 3] >> ((i & 7) * 4)) & 0xFu) + carry;
+        carry  = (nibble > 8u) ? 1u : 0u;
+        digit  = (sint32)nibble - (sint32)(carry << 4);
+        if (digit != 0)
+        {
+            const uint32 *entry = g_p256BaseTable[i * P256_BASE_ENTRIES + ((digit > 0) ? digit : -digit) - 1];
+
+            memcpy(y, &entry[P256_WORDS], sizeof(y));
+            if ((digit < 0) != negate)
+                negateY(y);
+            pointAddAffine(&sum, &sum, entry, y);
+        }
+    }
+
+    if (isZero(sum.z))
+        return FALSE;
+
+    return matchesX(&sum, r);
+}
@@ -0,0 +1,44 @@
+/**********************************************************************************************************************
+ * \file P256.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * ECDSA signature verification on the NIST P-256 curve (FIPS 186-5), the classical half of the OTA manifest
+ * signature. Field and scalar arithmetic use 8 x 32-bit limbs with Montgomery multiplication and points are kept in
+ * Jacobian coordinates. u2 * Q takes one doubling per bit and a width-4 NAF over Q, 3Q, 5Q and 7Q; u1 * G needs no
+ * doublings at all, it adds one affine entry per 4-bit window from the 32 KB const table of P256_BaseTable.h
+ * (generated by Tools/p256_tables.c, linked into PFlash). The x coordinate is compared with r without leaving the
+ * Jacobian coordinates, so the only inversion is the one of s.
+ *
+ * Everything runs on the stack (about 1.5 KB) and the table is read from PFlash, so the function can run on any
+ * core. Verification only handles public data, it is not constant-time.
+ *********************************************************************************************************************/
+
+#ifndef P256_H_
+#define P256_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define P256_SCALAR_SIZE                         32
+#define P256_PUBLIC_KEY_SIZE                     64          /* x || y, big endian, without the 0x04 prefix     */
+#define P256_SIGNATURE_SIZE                      64          /* r || s, big endian                              */
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Verify an ECDSA P-256 signature over a message digest
+ * \param publicKey P256_PUBLIC_KEY_SIZE bytes, checked to be a point on the curve
+ * \param digest SHA-256 of the message, P256_SCALAR_SIZE bytes
+ * \param signature P256_SIGNATURE_SIZE bytes
+ * \return TRUE if the signature is valid, FALSE otherwise
+ */
+boolean P256_Verify(const uint8 *publicKey, const uint8 *digest, const uint8 *signature);
+
+#endif /* P256_H_ */
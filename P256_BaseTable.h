@@ -0,0 +1,1170 @@
+/**********************************************************************************************************************
+ * \file P256_BaseTable.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Fixed-base table of the ECDSA P-256 verifier, generated by Tools/p256_tables.c, do not edit
+ * Entry 8 * j + k is (k + 1) * 16^j * G, affine x followed by y in Montgomery form, least significant word first.
+ * Only included by P256.c; being const, the 32 KB are linked into PFlash.
+ *********************************************************************************************************************/
+
+#ifndef P256_BASETABLE_H_
+#define P256_BASETABLE_H_
+
+#define P256_BASE_WINDOWS           64
+#define P256_BASE_ENTRIES           8
+
+static const uint32 g_p256BaseTable[P256_BASE_WINDOWS * P256_BASE_ENTRIES][16] = {
+    /* 16^0 * G */
+    {0x18A9143CuL, 0x79E730D4uL, 0x5FEDB601uL, 0x75BA95FCuL, 0x77622510uL, 0x79FB732BuL, 0xA53755C6uL, 0x18905F76uL,
+     0xCE95560AuL, 0xDDF25357uL, 0xBA19E45CuL, 0x8B4AB8E4uL, 0xDD21F325uL, 0xD2E88688uL, 0x25885D85uL, 0x8571FF18uL},
+    {0x10DDD64DuL, 0x850046D4uL, 0xA433827DuL, 0xAA6AE3C1uL, 0x8D1490D9uL, 0x73220503uL, 0x3DCF3A3BuL, 0xF6BB32E4uL,
+     0x61BEE1A5uL, 0x2F3648D3uL, 0xEB236FF8uL, 0x152CD7CBuL, 0x92042DBEuL, 0x19A8FB0EuL, 0x0A5B8A3BuL, 0x78C57751uL},
+    {0x4EEBC127uL, 0xFFAC3F90uL, 0x087D81FBuL, 0xB027F84AuL, 0x87CBBC98uL, 0x66AD77DDuL, 0xB6FF747EuL, 0x26936A3FuL,
+     0xC983A7EBuL, 0xB04C5C1FuL, 0x0861FE1AuL, 0x583E47ADuL, 0x1A2EE98EuL, 0x78820831uL, 0xE587CC07uL, 0xD5F06A29uL},
+    {0x46918DCCuL, 0x74B0B50DuL, 0xC623C173uL, 0x4650A6EDuL, 0xE8100AF2uL, 0x0CDAACACuL, 0x41B0176BuL, 0x577362F5uL,
+     0xE4CBABA6uL, 0x2D96F24CuL, 0xFAD6F447uL, 0x17628471uL, 0xE5DDD22EuL, 0x6B6C36DEuL, 0x4C5AB863uL, 0x84B14C39uL},
+    {0xC45C61F5uL, 0xBE1B8AAEuL, 0x94B9537DuL, 0x90EC649AuL, 0xD076C20CuL, 0x941CB5AAuL, 0x890523C8uL, 0xC9079605uL,
+     0xE7BA4F10uL, 0xEB309B4AuL, 0xE5EB882BuL, 0x73C568EFuL, 0x7E7A1F68uL, 0x3540A987uL, 0x2DD1E916uL, 0x73A076BBuL},
+    {0x3E77664AuL, 0x40394737uL, 0x346CEE3EuL, 0x55AE744FuL, 0x5B17A3ADuL, 0xD50A961AuL, 0x54213673uL, 0x13074B59uL,
+     0xD377E44BuL, 0x93D36220uL, 0xADFF14B5uL, 0x299C2B53uL, 0xEF639F11uL, 0xF424D44CuL, 0x4A07F75FuL, 0xA4C9916DuL},
+    {0xA0173B4FuL, 0x0746354EuL, 0xD23C00F7uL, 0x2BD20213uL, 0x0C23BB08uL, 0xF43EAAB5uL, 0xC3123E03uL, 0x13BA5119uL,
+     0x3F5B9D4DuL, 0x2847D030uL, 0x5DA67BDDuL, 0x6742F2F2uL, 0x77C94195uL, 0xEF933BDCuL, 0x6E240867uL, 0xEAEDD915uL},
+    {0x9499A78FuL, 0x27F14CD1uL, 0x6F9B3455uL, 0x462AB5C5uL, 0xF02CFC6BuL, 0x8F90F02AuL, 0xB265230DuL, 0xB763891EuL,
+     0x532D4977uL, 0xF59DA3A9uL, 0xCF9EBA15uL, 0x21E3327DuL, 0xBE60BBF0uL, 0x123C7B84uL, 0x7706DF76uL, 0x56EC12F2uL},
+
+    /* 16^1 * G */
+    {0x0BC6FB80uL, 0x808B0B65uL, 0x3FFE2E6BuL, 0x5882E075uL, 0x2C83F549uL, 0xD5EF2F7CuL, 0x9103B723uL, 0x54D63C80uL,
+     0x52A23F9BuL, 0xF2F11BD6uL, 0x4B0B6587uL, 0x3670C319uL, 0xB1580E9EuL, 0x55C4623BuL, 0x01EFE220uL, 0x64EDF7B2uL},
+    {0xC5E3A3D8uL, 0xD8C5FCCFuL, 0x4079DFBFuL, 0xBEFD904CuL, 0xFEAD0197uL, 0xBC6D6A58uL, 0x695532A4uL, 0x39227077uL,
+     0xDBEF42F5uL, 0x09E23E6DuL, 0x480A9908uL, 0x7E449B64uL, 0xAD9A2E40uL, 0x7B969C1AuL, 0x9591C2A4uL, 0x6231D792uL},
+    {0x77ADC612uL, 0x6B344130uL, 0xBBD803A0uL, 0xA7496529uL, 0x6D8805BDuL, 0x1A1BAAA7uL, 0x470343ADuL, 0xC8403902uL,
+     0x175ADFF1uL, 0x39F59F66uL, 0xB7D8C5B7uL, 0x0B26D7FBuL, 0x529D75E3uL, 0xA875F5CEuL, 0x41325CC2uL, 0x85EFC7E9uL},
+    {0x05968B80uL, 0xDB6D96F3uL, 0x089F73B9uL, 0x380A0913uL, 0xC2C61E01uL, 0x7DA70B83uL, 0x569B38C7uL, 0x95FB8394uL,
+     0x80EDFE2FuL, 0x9A3C6512uL, 0x8FAEAF82uL, 0x8F726BB9uL, 0x78424BF8uL, 0x8010A4A0uL, 0x0E844970uL, 0x29672044uL},
+    {0x52B3E584uL, 0x492BDC07uL, 0xB5F86A2CuL, 0x35FF9AA8uL, 0xB27DE573uL, 0x2074213DuL, 0x5263832AuL, 0xC0BFFFC4uL,
+     0x1D49C605uL, 0x2429C22AuL, 0xB320EBFBuL, 0x1B037D75uL, 0x9220F428uL, 0x52B6A173uL, 0xA4CD2660uL, 0x2995919CuL},
+    {0x33E12B70uL, 0x802B8D23uL, 0x19DD329BuL, 0x6D490A4BuL, 0x6ABC354DuL, 0x14F356CCuL, 0xD0A0DA0DuL, 0x11EDDF7FuL,
+     0xD87FD1D8uL, 0x1E208328uL, 0xFD025813uL, 0xFD2F4F8CuL, 0x7C29BCA2uL, 0x03B48CC4uL, 0x241A2B71uL, 0x3F2A78B3uL},
+    {0x0A99CBCAuL, 0x6A950576uL, 0x04A428F2uL, 0x94E258F6uL, 0x7832BA0CuL, 0x45AB5A4DuL, 0x8938C167uL, 0x71704D00uL,
+     0xF88B8B70uL, 0xDB97AB0EuL, 0xC00EB207uL, 0x56FEB92EuL, 0x7D367D80uL, 0xE7035268uL, 0xC7973A41uL, 0x65000C24uL},
+    {0x7A2AD62AuL, 0x63C5CB81uL, 0xAC62FF54uL, 0x7EF2B6B9uL, 0xB3AD9DB5uL, 0x3749BBA4uL, 0x46D5A617uL, 0xAD311F2CuL,
+     0xC2FF3B6DuL, 0xB77A8087uL, 0x367834FFuL, 0xB46FEAF3uL, 0x75D6B138uL, 0xF8AA266DuL, 0xEC008188uL, 0xFA38D320uL},
+
+    /* 16^2 * G */
+    {0x696946FCuL, 0x486D8FFAuL, 0xB9CBA56DuL, 0x50FBC6D8uL, 0x90F35A15uL, 0x7E3D423EuL, 0xC0DD962CuL, 0x7C3DA195uL,
+     0x3CFD5D8BuL, 0xE673FDB0uL, 0x889DFCA5uL, 0x0704B7C2uL, 0xF52305AAuL, 0xF6CE581FuL, 0x914D5E53uL, 0x399D49EBuL},
+    {0x39949296uL, 0x44E38110uL, 0x361DB1B5uL, 0x5B63827BuL, 0x206EAFF5uL, 0x3E5323EDuL, 0xC21F4290uL, 0x942370D2uL,
+     0xE0D985A1uL, 0xF2CAAF2EuL, 0x7239846DuL, 0x192CC64BuL, 0xAE6312F8uL, 0x7C0B8F47uL, 0x96620108uL, 0x7DC61F91uL},
+    {0xED4C3717uL, 0x35D6A53EuL, 0x3D0ED2A3uL, 0x9F8240CFuL, 0xE5543AA5uL, 0x8C0D4D05uL, 0xDD33B4B4uL, 0x45D5BBFBuL,
+     0x137FD28EuL, 0xFA04CC73uL, 0xC73B3FFDuL, 0x862AC6EFuL, 0x31F51EF2uL, 0x403FF9F5uL, 0xBC73F5A2uL, 0x34D5E0FCuL},
+    {0x44CC3ADDuL, 0x4F7081E1uL, 0x87BE82CFuL, 0xD5FFA1D6uL, 0x0EDD6472uL, 0x89890B6CuL, 0x3ED17863uL, 0xADA26E1AuL,
+     0x63483CAAuL, 0x276F2715uL, 0x2F6077FDuL, 0xE6924CD9uL, 0x0A466E3CuL, 0x05A7FE98uL, 0xB1902D1FuL, 0xF1C794B0uL},
+    {0x08369A90uL, 0x33B2385CuL, 0x190EB4F8uL, 0x2990C59BuL, 0xC68EAC80uL, 0x819A6145uL, 0x2EC4A014uL, 0x7A786D62uL,
+     0x20AC3A8DuL, 0x33FAADBEuL, 0x5ABA2D30uL, 0x31A21781uL, 0xDBA4F565uL, 0x209D2742uL, 0x55AA0FBBuL, 0xDB2CE9E3uL},
+    {0x8BD7AFF1uL, 0xB3156BF3uL, 0x1D81B146uL, 0x1B5EE4CBuL, 0xD628A915uL, 0x7BA1AC41uL, 0xFD89699EuL, 0x8F3A8F9CuL,
+     0xA0748BE7uL, 0x7329B9C9uL, 0xA92E621FuL, 0x1D391C95uL, 0x4D10A837uL, 0xE51E6B21uL, 0x4947B435uL, 0xD255F53AuL},
+    {0x74A86108uL, 0x0C4A58D4uL, 0xEE4C5D90uL, 0xF8048A8FuL, 0xE86D4C80uL, 0xE3C7C924uL, 0x056A1E60uL, 0x28C889DEuL,
+     0xB214A040uL, 0x57E2662EuL, 0x37E10347uL, 0xE8C48E98uL, 0x80AC748AuL, 0x87742862uL, 0x186B06F2uL, 0xF1C24022uL},
+    {0xEB7926B8uL, 0x3D2B24B9uL, 0xCDBE5509uL, 0xBFF88CB3uL, 0xE4DD640BuL, 0xD0F399AFuL, 0x2F76ED45uL, 0x3C5FE130uL,
+     0x3764FB3DuL, 0x6F3562F4uL, 0x3151B62DuL, 0x7B5AF318uL, 0xD79CE5F3uL, 0xD5BD0BC7uL, 0xEC66890FuL, 0xFDAF6B20uL},
+
+    /* 16^3 * G */
+    {0xAB4B35A2uL, 0x6772B0E5uL, 0xF5EEAACFuL, 0x1D8B6001uL, 0x795B9580uL, 0x728F7CE4uL, 0x41FB81DAuL, 0x4A20ED2AuL,
+     0x4FEC01E6uL, 0x9F685CD4uL, 0xA7FF50ADuL, 0x3ED7DDCCuL, 0x0C2D97FDuL, 0x460FD264uL, 0xEB82F4F9uL, 0x3A241426uL},
+    {0xD5D721D5uL, 0x80009862uL, 0x5BD3A182uL, 0x0C3357A3uL, 0x7AA2CDA4uL, 0x27F3A83BuL, 0xF6F83085uL, 0xB58AE74EuL,
+     0x2E6DAD6BuL, 0x2A911A81uL, 0xF43D6C5BuL, 0xDE286051uL, 0xF996C4D8uL, 0x4BDCCC41uL, 0x0AE1E24EuL, 0xE7312EC0uL},
+    {0xAAE6EE70uL, 0x6FAF68FEuL, 0x5602B0C9uL, 0x78F4CC15uL, 0x6E94052AuL, 0x7E3321A8uL, 0x734D5D80uL, 0x2FB3A0D6uL,
+     0xB25A43BAuL, 0xF3B98F3BuL, 0x19EE2951uL, 0x30BF8031uL, 0x21B0612AuL, 0x7FFEE433uL, 0x2EB821D0uL, 0x12F775E4uL},
+    {0x6E6485B3uL, 0xF8D112E7uL, 0x771C52F8uL, 0x4D3E24DBuL, 0x684A2F6DuL, 0x48E3EE41uL, 0x21D95551uL, 0x7161957DuL,
+     0xCDB12A6CuL, 0x19631283uL, 0x2E50E164uL, 0xBF3FA882uL, 0x3166CC73uL, 0xF6254B63uL, 0xAEE8CC38uL, 0x3AEFA7AEuL},
+    {0x37A929A9uL, 0x46F70080uL, 0x19FEC6BDuL, 0x65601A8EuL, 0x12AB8B62uL, 0x537F5EDCuL, 0x5E5990CFuL, 0xE497CD95uL,
+     0x9AA5B2F9uL, 0x2FCD387FuL, 0x67B78FE8uL, 0xE5FAA3FFuL, 0x295D5E30uL, 0x1BCF538DuL, 0xA813A7ECuL, 0x3A573239uL},
+    {0xD17C2409uL, 0xE9F5286BuL, 0x63264D9BuL, 0x2C4E4793uL, 0x17F6880FuL, 0x177042B1uL, 0x4CE1EE43uL, 0x39B7E2C8uL,
+     0xD096F4A9uL, 0xCEC8E722uL, 0xBED5E697uL, 0x6861AECBuL, 0x6C231911uL, 0xC2D153F0uL, 0x2890537AuL, 0xCC2F42B8uL},
+    {0xD0A917B4uL, 0x33E2CB51uL, 0x4899F931uL, 0xC2CFA3F3uL, 0xE9A2F6B6uL, 0xB2C94F4BuL, 0x7CA162B7uL, 0x9707B181uL,
+     0xD5F8B10DuL, 0xB602A172uL, 0x4FD4542AuL, 0xFD307835uL, 0xDD996992uL, 0xEEF226DDuL, 0xEB0A15E1uL, 0x221FA989uL},
+    {0x3B36F9FDuL, 0x79B0FE62uL, 0xFDE19FC0uL, 0x26543B23uL, 0x958482EFuL, 0x136E64A0uL, 0x9B095825uL, 0x23F63771uL,
+     0xB6A1142EuL, 0x14CFD596uL, 0x335AAC0BuL, 0x5EA6AAC6uL, 0xF3081DD5uL, 0x86A0E8BDuL, 0x003DC12AuL, 0x5FB89D79uL},
+
+    /* 16^4 * G */
+    {0xE3779EE3uL, 0x0F0165FCuL, 0xBD495D9EuL, 0xE00E7F9DuL, 0x20284E7AuL, 0x1FA4EFA2uL, 0x47AC6219uL, 0x4564BADEuL,
+     0xC4708E8EuL, 0x90E6312AuL, 0xA71E9ADFuL, 0x4F5725FBuL, 0x3D684B9FuL, 0xE95F55AEuL, 0x1E94B415uL, 0x47F7CCB1uL},
+    {0x61A341C1uL, 0x36178903uL, 0x0CFD6142uL, 0x3604DC60uL, 0x8533316CuL, 0x022295EBuL, 0x44AF2922uL, 0x3DBDE4ACuL,
+     0x1C7EEF69uL, 0x898AFC5DuL, 0xD14F4FA1uL, 0x58896805uL, 0x203C21CAuL, 0x05002160uL, 0x40EF730BuL, 0x6F0D1F30uL},
+    {0xBE7A2AF3uL, 0xBD9B8B1DuL, 0x4FB74A72uL, 0xEC51CAA9uL, 0x63879697uL, 0xB9937A4BuL, 0xEC2687D5uL, 0x7C9A9D20uL,
+     0x6EF5F014uL, 0x1773E44FuL, 0xE90C6900uL, 0x8ABCF412uL, 0x8142161EuL, 0x387BD022uL, 0xFCB6FF2AuL, 0x50393755uL},
+    {0x77F7195AuL, 0xFABF7709uL, 0xADEB838FuL, 0x8EC86167uL, 0xBB4F012DuL, 0xEA1285A8uL, 0x9A3EAB3FuL, 0xD6883503uL,
+     0x309004C2uL, 0xEE5D24F8uL, 0x13FFE95EuL, 0xA96E4B76uL, 0xBD223EA4uL, 0x0CDFFE12uL, 0xB6739A53uL, 0x8F5C2EE5uL},
+    {0x59145A65uL, 0x3D613339uL, 0xFA406337uL, 0xCD9BC368uL, 0x2D8A52A0uL, 0x82D11BE3uL, 0x97A1C590uL, 0xF6877B27uL,
+     0xF5CBDB25uL, 0x837A819BuL, 0xDE090249uL, 0x2A4FD1D8uL, 0x74990E5FuL, 0x622A7DE7uL, 0x7945511BuL, 0x840FA5A0uL},
+    {0x6B0CF82EuL, 0xE58E90B3uL, 0x2615B5E7uL, 0x6438D246uL, 0x669C145AuL, 0x07B1F8FCuL, 0x36F1E1CBuL, 0xB0D8B2DAuL,
+     0xD9184C4DuL, 0x54D5DADBuL, 0xF93D9976uL, 0x3DBB18D5uL, 0xD1147D47uL, 0x0A3E0F56uL, 0xA0A48609uL, 0x2AFA8C8DuL},
+    {0xE3533D77uL, 0x26E08C07uL, 0x2E341C99uL, 0xD7222E6AuL, 0x8D2DC4EDuL, 0x9D60EC3DuL, 0x7C476CF8uL, 0xBDFE0D8FuL,
+     0x1D056605uL, 0x1FE59AB6uL, 0x86A8551FuL, 0xA9EA9DF6uL, 0x47FB8D8CuL, 0x8489941EuL, 0x4A7F1B10uL, 0xFEB874EBuL},
+    {0xBD763802uL, 0xED406AA9uL, 0x65303DA1uL, 0xC21486A0uL, 0xC7E62EC4uL, 0x61AE291EuL, 0xDF99333EuL, 0x622A0492uL,
+     0xBB7A8EE0uL, 0x7FD80C9DuL, 0x6C01AEDBuL, 0xDC2ED3BCuL, 0x08BE74ECuL, 0x35C35A12uL, 0x469F671FuL, 0xD540CB1AuL},
+
+    /* 16^5 * G */
+    {0x584C5E20uL, 0xA7A8746AuL, 0xB9DC7035uL, 0x267E4EA1uL, 0xB9548C9BuL, 0x593A15CFuL, 0x4BD012F3uL, 0x5E6E2135uL,
+     0x8C8F936EuL, 0xDF31CC6AuL, 0xB5C241DCuL, 0x8AF84D04uL, 0x345EFB86uL, 0x63990A6FuL, 0xB9B962CBuL, 0x6FEF4E61uL},
+    {0x25722608uL, 0xF6368F09uL, 0x131CF5C6uL, 0x131260DBuL, 0xFAB4F7ACuL, 0x40EB353BuL, 0x37EEE829uL, 0x85C78880uL,
+     0xC3BDF24EuL, 0x4C1581FFuL, 0xF5C3C5A8uL, 0x5BFF75CBuL, 0xA14E6F40uL, 0x35E8C83FuL, 0x0295E0CAuL, 0xB81D1C0FuL},
+    {0x442A8AD1uL, 0xF2EFE23DuL, 0x06B9C164uL, 0xC3816A7DuL, 0xDC0AA5E5uL, 0xA9DF2D8BuL, 0x120A8E65uL, 0x191AE46FuL,
+     0x00611C5BuL, 0x83667F87uL, 0xFF109948uL, 0x83171ED7uL, 0xCA695952uL, 0x33A2ECF8uL, 0xF48D1A13uL, 0xFA4A73EEuL},
+    {0xF43A730FuL, 0xFCDE7CC8uL, 0x33AB590EuL, 0xE89B6F3CuL, 0xAD03240BuL, 0xC823F529uL, 0x98BEA5DBuL, 0x82B79AFEuL,
+     0x962FE5DEuL, 0x568F2856uL, 0x60C591F3uL, 0x0C590ADBuL, 0x4A28A858uL, 0x1FC74A14uL, 0xB3203F4CuL, 0x3B662498uL},
+    {0x82DD1B6AuL, 0x48FC4ED0uL, 0x67B703AFuL, 0x5783A138uL, 0x005D6AAAuL, 0x2463CB9AuL, 0x706ECD43uL, 0xD31EC55CuL,
+     0x8E9A7641uL, 0x9F8ED33FuL, 0x098D9E7AuL, 0x625453EDuL, 0xEC887493uL, 0xA3BEADE4uL, 0x5A795566uL, 0x442B8050uL},
+    {0x6C39765AuL, 0x91E3CF0DuL, 0xAC3CCA0BuL, 0xA2DB3ACDuL, 0xCB953B50uL, 0x288F2F08uL, 0xCF43CF1AuL, 0x2414582CuL,
+     0x60EEE9A8uL, 0x8DEC8BBCuL, 0x729AA042uL, 0x54C79F02uL, 0x6532F5D5uL, 0xD81CD5ECuL, 0xCF82E15FuL, 0xA672303AuL},
+    {0x3BFAB839uL, 0x46DF582DuL, 0x2F8ADADEuL, 0x92474E04uL, 0x147A1BC3uL, 0x36A7766AuL, 0x0DC0F979uL, 0xB6940F54uL,
+     0xF2759F25uL, 0x44738EF2uL, 0xA719F4C6uL, 0x9DD95789uL, 0x0750C345uL, 0x2859B7F4uL, 0xB22180D5uL, 0x5E788BF2uL},
+    {0x719C0563uL, 0x376AAFA8uL, 0xBC5FC79FuL, 0xCD8AD2DCuL, 0xCB750CD3uL, 0x303FDB9FuL, 0x4418B08EuL, 0x14FF052FuL,
+     0x3E2D6520uL, 0xF75084CFuL, 0x144ED509uL, 0x7EBDF0F8uL, 0xD3F25B98uL, 0xF43BF0F2uL, 0xA354D837uL, 0x86AD71CFuL},
+
+    /* 16^6 * G */
+    {0x868AF75DuL, 0xD9D0C8C4uL, 0x45C8C7EAuL, 0xD7325CFFuL, 0xCC81ECB0uL, 0xAB471996uL, 0x611824EDuL, 0xFF5D55F3uL,
+     0x1977A0EEuL, 0xBE314541uL, 0x722038C6uL, 0x5085C4C5uL, 0xF94BB495uL, 0x2D5335BFuL, 0xC8E2A082uL, 0x894AD8A6uL},
+    {0x2C11BB37uL, 0x540234B2uL, 0xED4C74A3uL, 0x2D0366DDuL, 0xEEC5F25DuL, 0xF9A968DAuL, 0x67B63142uL, 0x36601068uL,
+     0x68D7B6D4uL, 0x07CD6D2CuL, 0x0C842942uL, 0xA8F74F09uL, 0x7768B1EEuL, 0xE2751404uL, 0xFE62AEE4uL, 0x4B5F7E89uL},
+    {0x1994EF20uL, 0xD1E059B2uL, 0x638AE318uL, 0x2A653B69uL, 0x2F699010uL, 0x70D5EB58uL, 0x09F5F84AuL, 0x279739F7uL,
+     0x8B799336uL, 0x5DA4663CuL, 0x203C37EBuL, 0xFDFDF14DuL, 0xA1DBFB2DuL, 0x32D8A9DCuL, 0x77D48F9BuL, 0xAB40CFF0uL},
+    {0x879FBBEDuL, 0xF2369F0BuL, 0xDA9D1869uL, 0x0FF0AE86uL, 0x56766F45uL, 0x5251D759uL, 0x2BE8D0FCuL, 0x4984D8C0uL,
+     0xD21008F0uL, 0x7ECC95A6uL, 0x3A1A1C49uL, 0x29BD54A0uL, 0xD26C50F3uL, 0xAB9828C5uL, 0x51D0D251uL, 0x32C0087CuL},
+    {0xFBAF50A5uL, 0xF61790ABuL, 0x684E0750uL, 0xDF55E76BuL, 0xF176B005uL, 0xEC516DA7uL, 0x7A2DDDC7uL, 0x575553BBuL,
+     0x553AFA73uL, 0x37C87CA3uL, 0x4D55C251uL, 0x315F3FFCuL, 0xAF3E5D35uL, 0xE846442AuL, 0x6495FF28uL, 0x61B91149uL},
+    {0x62B5F3AFuL, 0x47FEEB66uL, 0x0ABB3734uL, 0xCEFAB561uL, 0x19F35CB1uL, 0x449DE60EuL, 0x157F0EB9uL, 0x39F8DB14uL,
+     0x3C61BFD6uL, 0xFFAECC5BuL, 0x41216703uL, 0xA5A4D41DuL, 0x224E1CC2uL, 0x7F8FABEDuL, 0x871AD953uL, 0x0D5A8186uL},
+    {0x56F90823uL, 0x4BDF3A49uL, 0x741D777BuL, 0xBA0F5080uL, 0xF38BF760uL, 0x091D71C3uL, 0x9B625B02uL, 0x9633D50FuL,
+     0xB8C9DE61uL, 0x03ECB743uL, 0x5DE74720uL, 0xB4751254uL, 0x74CE1CB2uL, 0x9F9DEFC9uL, 0x00BD32EFuL, 0x774A4F6AuL},
+    {0x01799A52uL, 0x190D8EA6uL, 0xB86D2952uL, 0xA20CEC41uL, 0x7FFF2A7CuL, 0x3062FFB2uL, 0x79F19D37uL, 0x741B32E5uL,
+     0x4EB57D47uL, 0xF80D8181uL, 0x16AEF06BuL, 0x7A2D0ED4uL, 0x1CECB588uL, 0x09735FB0uL, 0xC6061F5BuL, 0x1641CAAAuL},
+
+    /* 16^7 * G */
+    {0x20151427uL, 0x7F99824FuL, 0x92430206uL, 0x206828B6uL, 0xE1112357uL, 0xAA9097D7uL, 0x09E414ECuL, 0xACF9A2F2uL,
+     0x27915356uL, 0xDBDAC9DAuL, 0x001EFEE3uL, 0x7E0734B7uL, 0xD2B288E2uL, 0x54FAB5BBuL, 0xF62DD09CuL, 0x4C630FC4uL},
+    {0x1AC2703BuL, 0x8537107AuL, 0x6BC857B5uL, 0xB49258D8uL, 0xBCDACCD1uL, 0x57DF14DEuL, 0xC4AE8529uL, 0x24AB68D7uL,
+     0x734E59D0uL, 0x7ED8B5D4uL, 0xC495CC80uL, 0x5F8740C8uL, 0x291DB9B3uL, 0x84AEDD5AuL, 0x4FB995BEuL, 0x80B360F8uL},
+    {0x5FA067D1uL, 0xAE915F5DuL, 0x9668960CuL, 0x4134B57FuL, 0xA48EDAACuL, 0xBD3656D6uL, 0xFC1D7436uL, 0xDAC1E3E4uL,
+     0xD81FBB26uL, 0x674FF869uL, 0xB26C33D4uL, 0x449ED3ECuL, 0xD94203E8uL, 0x85138705uL, 0xBEEB6F4AuL, 0xCCDE538BuL},
+    {0xA61A76FAuL, 0x55D5C68DuL, 0xCA1554DCuL, 0x598B441DuL, 0x773B279CuL, 0xD39923B9uL, 0x36BF9EFCuL, 0x33331D3CuL,
+     0x298DE399uL, 0x2D4C848EuL, 0xA1A27F56uL, 0xCFDB8E77uL, 0x57B8AB70uL, 0x94C855EAuL, 0x6F7879BAuL, 0xDCDB9DAEuL},
+    {0x019F2A59uL, 0x7BDFF8C2uL, 0xCB4FBC74uL, 0xB3CE5BB3uL, 0x8A9173DDuL, 0xEA907F68uL, 0x95A75439uL, 0x6CD3D0D3uL,
+     0xEFED021CuL, 0x92ECC4D6uL, 0x6A77339AuL, 0x09A9F9B0uL, 0x7188C64AuL, 0x87CA6B15uL, 0x44899158uL, 0x10C29968uL},
+    {0xED6E82EFuL, 0x5859A229uL, 0x65EBAF4EuL, 0x16F338E3uL, 0x5EAD67AEuL, 0x0CD31387uL, 0x54EF0BB4uL, 0x1C73D228uL,
+     0x74A5C8C7uL, 0x4CB55131uL, 0x7F69AD6AuL, 0x01CD2970uL, 0xE966F87EuL, 0xA04D00DDuL, 0x0B7B0321uL, 0xD96FE447uL},
+    {0x88FBD381uL, 0x342AC06EuL, 0x5C35A493uL, 0x02CD4A84uL, 0x54F1BBCDuL, 0xE8FA89DEuL, 0x2575ED4CuL, 0x341D6367uL,
+     0xD238202BuL, 0xEBE357FBuL, 0xA984EAD9uL, 0x600B4D1AuL, 0x52436EA0uL, 0xC35C9F44uL, 0xA370751BuL, 0x96FE0A39uL},
+    {0x7F636A38uL, 0x4C4F0736uL, 0x0E76D5CBuL, 0x9F943FB7uL, 0xA8B68B8BuL, 0xB03510BAuL, 0x9ED07A1FuL, 0xC246780AuL,
+     0x6D549FC2uL, 0x3C051415uL, 0x607781CAuL, 0xC2953F31uL, 0xD8D95413uL, 0x955E2C69uL, 0x7BD282E3uL, 0xB300FADCuL},
+
+    /* 16^8 * G */
+    {0x4147519AuL, 0x20288602uL, 0x26B372F0uL, 0xD0981EACuL, 0xA785EBC8uL, 0xA9D4A7CAuL, 0xDBDF58E9uL, 0xD953C50DuL,
+     0xFD590F8FuL, 0x9D6361CCuL, 0x44E6C917uL, 0x72E9626BuL, 0x22EB64CFuL, 0x7FD96110uL, 0x9EB288F3uL, 0x863EBB7EuL},
+    {0x678A31B0uL, 0x877B7CF5uL, 0x3998B620uL, 0xD50301AEuL, 0xC00FB396uL, 0x734257C5uL, 0x04E672A6uL, 0xF9FB18A0uL,
+     0xE8758851uL, 0xFF8BD8EBuL, 0x5D99BA44uL, 0x1E64E4C6uL, 0x7DFD93B7uL, 0x4B8EAEDFuL, 0x04E76B8CuL, 0xBA2F2A98uL},
+    {0xE90FB21EuL, 0xA18F07E0uL, 0xBBA7FCA1uL, 0x00FD2B80uL, 0x95CD67B5uL, 0x20387F27uL, 0xD39707F7uL, 0x5B89A4E7uL,
+     0x894407CEuL, 0x8F83AD3FuL, 0x6C226132uL, 0xA0025B94uL, 0xF906C13BuL, 0xC79563C7uL, 0x4E7BB025uL, 0x5F548F31uL},
+    {0xC35D8794uL, 0x0EE6D3A7uL, 0x0356BAE5uL, 0x042E6558uL, 0x643322FDuL, 0x9F59698DuL, 0x50A61967uL, 0x9379AE15uL,
+     0xFCC9981EuL, 0x64B9AE62uL, 0x6D2934C6uL, 0xAED3D631uL, 0x5E4E65EBuL, 0x2454B302uL, 0xF9950428uL, 0xAB09F647uL},
+    {0x31B85F09uL, 0xC1B3D3D3uL, 0xA88AE64AuL, 0x0F45354AuL, 0x2FEC50FDuL, 0xA8B626D3uL, 0xE828834FuL, 0x1BDCFBD4uL,
+     0xCD522539uL, 0xE45A2866uL, 0x810F7AB3uL, 0xFA9D4732uL, 0xC905F293uL, 0xD8C1D6B4uL, 0x3461B597uL, 0x10AC8047uL},
+    {0x6D91CD2CuL, 0xE2C81536uL, 0xDAA3F0E4uL, 0x40A2BEEAuL, 0x2441E083uL, 0xFB167A59uL, 0xE9240347uL, 0x004675E9uL,
+     0x840E446EuL, 0x7848AAFFuL, 0xEA308F72uL, 0x9F9F258FuL, 0x639BFAD9uL, 0x50F12899uL, 0x205C0AF6uL, 0x0939AE63uL},
+    {0x6FC627E2uL, 0xBBB17514uL, 0x91573A51uL, 0xA0569BC5uL, 0x358243D5uL, 0xA7016D9EuL, 0xAC1D6692uL, 0x0DAC0C56uL,
+     0xDA590D5FuL, 0x993833B5uL, 0xDE817491uL, 0xA8067803uL, 0x4DBF75D0uL, 0x65B4F212uL, 0xCCF80CFBuL, 0xCC960232uL},
+    {0x22248ACCuL, 0xB2083A12uL, 0x3264E366uL, 0x1F6EC0EFuL, 0x5AFDEE28uL, 0x5659B704uL, 0xE6430BB5uL, 0x7A823A40uL,
+     0xE1900A79uL, 0x24592A04uL, 0xC9EE6576uL, 0xCDE09D4AuL, 0x4B5EA54AuL, 0x52B6463FuL, 0xD3CA65A7uL, 0x1EFE9ED3uL},
+
+    /* 16^9 * G */
+    {0x305406DDuL, 0xE27A6DBEuL, 0xDD5D1957uL, 0x8EB7DC7FuL, 0x387D4D8FuL, 0xF54A6876uL, 0xC7762DE4uL, 0x9C479409uL,
+     0x99B30778uL, 0xBE4D5B5DuL, 0x6E793682uL, 0x25380C56uL, 0xDAC740E3uL, 0x602D37F3uL, 0x1566E4AEuL, 0x140DEABEuL},
+    {0xC49A861EuL, 0xEAEE6126uL, 0xE14F0D06uL, 0x024F3B65uL, 0xC69BFC17uL, 0x51A3F1E8uL, 0xA7686381uL, 0xC3C3A8E9uL,
+     0xB103D4C8uL, 0x3400752CuL, 0x9218B36BuL, 0x02BC4613uL, 0x7651504AuL, 0xC67F75EBuL, 0xD02AEBFAuL, 0xD6848B56uL},
+    {0x1782269BuL, 0x958381DBuL, 0x2597E550uL, 0xAE34BF79uL, 0x5F385153uL, 0xBB5C6064uL, 0xE3088048uL, 0x6F0E96AFuL,
+     0x77884456uL, 0xBF6A0215uL, 0x69310EA7uL, 0xB3B5688CuL, 0x04FAD2DEuL, 0x17C94295uL, 0x17896D4DuL, 0xE020F0E5uL},
+    {0xBBE5A1A9uL, 0xCCA4428DuL, 0x3126BD67uL, 0x8187FD5FuL, 0x48105826uL, 0x0036973AuL, 0xB8BD61A0uL, 0xA39B6663uL,
+     0x2D65A808uL, 0x6D42DEEFuL, 0x94636B19uL, 0x4969044FuL, 0xDD5D564CuL, 0xF611EE47uL, 0xD2873077uL, 0x7B2F3A49uL},
+    {0x0F82B214uL, 0x03B0D8DDuL, 0xF103CBC6uL, 0x460C34F9uL, 0x18D79E19uL, 0xF32E5C03uL, 0xA84117F8uL, 0x8B8888BAuL,
+     0xC0722677uL, 0x8F3C37DCuL, 0x1C1C0F27uL, 0x10D21BE9uL, 0xE0F7A0C6uL, 0xD47C8468uL, 0xADECC0E0uL, 0x9BF02213uL},
+    {0xB7FE7B6EuL, 0x97554160uL, 0x400A3FB2uL, 0x7D16189AuL, 0xE328CA1EuL, 0xD73E9BEAuL, 0xE793D8CCuL, 0x0DD04B97uL,
+     0x506DB8CCuL, 0xA9C83C9BuL, 0xCF38814CuL, 0x5CD47AAEuL, 0xB64B45E6uL, 0x26FC430DuL, 0xD818EA84uL, 0x079B5499uL},
+    {0xE0AC2941uL, 0x03B5D21AuL, 0xC2D31937uL, 0x279B0254uL, 0xCAC992D0uL, 0x3307C052uL, 0xEFA8B1F3uL, 0x6AA7CB92uL,
+     0x0D37C7A5uL, 0x5A182580uL, 0x342D5422uL, 0x13380C37uL, 0xD5D2EF92uL, 0x92AC2D66uL, 0x030C63C6uL, 0x035A70C9uL},
+    {0x71BA1861uL, 0x5109B785uL, 0xD0C8F93DuL, 0x48B22D5CuL, 0x8633BB93uL, 0xE8FA84A7uL, 0x5AEBBD08uL, 0x53FBA6BAuL,
+     0xE5EEA7D8uL, 0x7FF27DF3uL, 0x68CA7158uL, 0x521C8796uL, 0xCE6F1A05uL, 0xB9D5133BuL, 0xFD0EBEE4uL, 0x2D50CD53uL},
+
+    /* 16^10 * G */
+    {0x533EF217uL, 0x889F6D65uL, 0xC3CA2E87uL, 0x7158C7E4uL, 0xDC2B4167uL, 0xFB670DFBuL, 0x844C257FuL, 0x75910A01uL,
+     0xCF88577DuL, 0xF336BF07uL, 0xE45E2ACEuL, 0x22245250uL, 0x7CA23D85uL, 0x2ED92E8DuL, 0x2B812F58uL, 0x29F8BE4CuL},
+    {0x2133FFD9uL, 0xFBB9B245uL, 0x830F1A20uL, 0x39A8B2F1uL, 0xD5A1F52AuL, 0x484BC97DuL, 0xA40EDDF8uL, 0xD6AEBF56uL,
+     0x76CCDAC6uL, 0x32257ACBuL, 0x1586FF27uL, 0xAF4D36ECuL, 0xF8DE7DD1uL, 0x8EAA8863uL, 0x88647C16uL, 0x0045D5CFuL},
+    {0x51FACC61uL, 0xC51E4143uL, 0xE68A25BCuL, 0xBAF2647DuL, 0x0FF872EDuL, 0x8F5271A0uL, 0x3D2D9659uL, 0x8F32EF99uL,
+     0x7593CBD4uL, 0xCA12488CuL, 0x02B82FABuL, 0xED266C5DuL, 0x14EB3F16uL, 0x0A2F78ADuL, 0x4D47AFE3uL, 0xC3404948uL},
+    {0xC005979DuL, 0xA6F3D574uL, 0x6A40E350uL, 0xC2072B42uL, 0x8DE2ECF9uL, 0xFCA5C156uL, 0xA515344EuL, 0xA8C8BF5BuL,
+     0x114DF14AuL, 0x97AEE555uL, 0xFDC5EC6BuL, 0xD4374A4DuL, 0x2CA85418uL, 0x754CC28FuL, 0xD3C41F78uL, 0x71CB9E27uL},
+    {0x09470496uL, 0x09C16702uL, 0xEBD23815uL, 0xA489A5EDuL, 0x8EDD4398uL, 0xC4DDE464uL, 0x80111696uL, 0x3CA7B94AuL,
+     0x2AD636A4uL, 0x3C385D68uL, 0x08DC5F1EuL, 0x67027025uL, 0xAFA21943uL, 0x0C1965DEuL, 0x610BE69EuL, 0x18666E16uL},
+    {0x0369C8E1uL, 0x6792FD35uL, 0xB9DC843BuL, 0x9271AA62uL, 0x4D02E2ABuL, 0x8711A4B1uL, 0x7EE1A383uL, 0x02B2A3E2uL,
+     0x0E2B379BuL, 0xB226E35FuL, 0xD652AB25uL, 0x3D3DE39CuL, 0x3B560106uL, 0xACA6D4C9uL, 0xC95BD877uL, 0xECED0CF4uL},
+    {0x2A604B3BuL, 0x45BEB4CAuL, 0x3A616762uL, 0x56F65184uL, 0x978B806EuL, 0xF52F5A70uL, 0x11DC4480uL, 0x7AA39787uL,
+     0x0E01FABCuL, 0xE13FAC2AuL, 0x237D99F9uL, 0x7C6EE8A5uL, 0x05211FFEuL, 0x251384EEuL, 0x1BC9D3EBuL, 0x4FF6976DuL},
+    {0x03605C39uL, 0x89105079uL, 0xA142C96CuL, 0xF0843D9EuL, 0x16923684uL, 0xF3744934uL, 0xFA0A2893uL, 0x732CAA2FuL,
+     0x61160170uL, 0xB2E8C270uL, 0x437FBAA3uL, 0xC32788CCuL, 0xA6EDA3ACuL, 0x39CD818EuL, 0x9E2B2E07uL, 0xE2E94239uL},
+
+    /* 16^11 * G */
+    {0x5922AC1CuL, 0x8DF27545uL, 0xA52B3F63uL, 0xA7B3EF5CuL, 0x71DE57C4uL, 0x8E77B214uL, 0x834C008BuL, 0x31682C10uL,
+     0x4BD55D31uL, 0xC76824F0uL, 0x17B61C71uL, 0xB6D1C086uL, 0xC2A5089DuL, 0x31DB0903uL, 0x184E5D3FuL, 0x9C092172uL},
+    {0xEA6C3997uL, 0x5ACE5035uL, 0xC2610BEFuL, 0x54259AAAuL, 0x3C80DD39uL, 0xEF18BB3FuL, 0x5FC3FA39uL, 0x6910B95BuL,
+     0x43E09AEEuL, 0xFCE2F510uL, 0xA7675665uL, 0xCED56C9FuL, 0xD872DB61uL, 0x10E265ACuL, 0xAE9FCE69uL, 0x6982812EuL},
+    {0x768FCCFCuL, 0xCA2EB690uL, 0xB835B362uL, 0xF402D37DuL, 0xE2FDFCCEuL, 0x0EFAC0D0uL, 0xB638D990uL, 0xEFC9CDEFuL,
+     0xD1669A8BuL, 0x2AF12B72uL, 0x5774CCBDuL, 0x33C536BCuL, 0xFB34870EuL, 0x30B21909uL, 0x7DF25ACAuL, 0xC38FA2F7uL},
+    {0x1341ED7AuL, 0xB8FA3D93uL, 0xA7B59D49uL, 0x4223272CuL, 0x83B8C4A4uL, 0x3DCB1947uL, 0xED1302E4uL, 0x4E413C01uL,
+     0xE17E44CEuL, 0x6D999127uL, 0x33B3ADFBuL, 0xEE86BF75uL, 0x25AA96CAuL, 0xF6902FE6uL, 0xE5AAE47DuL, 0xB73540E4uL},
+    {0xB2C69DBCuL, 0x7BFC5E75uL, 0x03C3DA6CuL, 0x3AA77A29uL, 0xCA910271uL, 0xDE0DF03CuL, 0x7806DC55uL, 0xCBD5CA4AuL,
+     0x6DB476CBuL, 0xE1CA5807uL, 0x5F37A31EuL, 0xFDE15D62uL, 0xF41AF416uL, 0xF49AF520uL, 0x7D342DB5uL, 0x96C5C5B1uL},
+    {0x872B4A60uL, 0xCC50EF6CuL, 0x4613521BuL, 0xAB2A34A4uL, 0x983E15D1uL, 0x39C5C190uL, 0x59905512uL, 0x61DDE5DFuL,
+     0x9F2275F3uL, 0xE417F621uL, 0x451D894BuL, 0x0750C8B6uL, 0x78B0BDAAuL, 0x75B04AB9uL, 0x458589BDuL, 0x3BFD9FD4uL},
+    {0xDB22B94BuL, 0xC792E02AuL, 0xA1EAA45BuL, 0x993D8AE9uL, 0xCD1E1C63uL, 0x8AAD6CD3uL, 0xC5CE688AuL, 0x89529CA7uL,
+     0xE572A253uL, 0x2CCEE3AAuL, 0x02A21EFBuL, 0xE02B6438uL, 0xC9430358uL, 0xA7091B6EuL, 0x9D7DB504uL, 0x06D1B1FAuL},
+    {0xAF95894CuL, 0xAAFCBFABuL, 0x276B2241uL, 0x7B9BDC07uL, 0x5BDDA48BuL, 0xEAF98362uL, 0xA3FCB4DFuL, 0x5977FAF2uL,
+     0x052C4B5BuL, 0xBED042EFuL, 0x067591F0uL, 0x9FE87F71uL, 0x22F24EC7uL, 0xC89C73CAuL, 0xE64A9F1BuL, 0x7D37FA9EuL},
+
+    /* 16^12 * G */
+    {0x0A750C0FuL, 0xCC7A6488uL, 0x4E548E83uL, 0x39BACFE3uL, 0x0C110F05uL, 0x3D418C76uL, 0xB1F11588uL, 0x3E4DAA4CuL,
+     0x5FFC69FFuL, 0x2733E7B5uL, 0x92053127uL, 0x46F147BCuL, 0xD722DF94uL, 0x885B2434uL, 0xE6FC6B7CuL, 0x6A444F65uL},
+    {0xC3F16EA8uL, 0x7A1A465AuL, 0xB2F1D11CuL, 0x115A461DuL, 0x6C68A172uL, 0x4767DD95uL, 0xD13A4698uL, 0x3392F2EBuL,
+     0xE526CDC7uL, 0xC7A99CCDuL, 0x22292B81uL, 0x8E537FDCuL, 0xA6D39198uL, 0x76D8CF69uL, 0x2446852DuL, 0xFFC5FF43uL},
+    {0xBDAEDFBDuL, 0x6D0B16F4uL, 0x86746CEDuL, 0x23FD3260uL, 0xFF4B3E17uL, 0x8BFB1D2FuL, 0x019C14C8uL, 0xC7F2EC2DuL,
+     0x45104B0DuL, 0x3E0832F2uL, 0xADEA2B7EuL, 0x5F00DAFBuL, 0x99FBFB0FuL, 0x29E5CF66uL, 0x61827CDAuL, 0x264F9723uL},
+    {0xA90567E6uL, 0x97B14F7EuL, 0xB6AE5CB7uL, 0x513257B7uL, 0x9F10903DuL, 0x85454A3CuL, 0x69BC3724uL, 0xD8D2C9ADuL,
+     0x6B29CB44uL, 0x38DA9324uL, 0x77C8CBACuL, 0xB540A21DuL, 0x01918E42uL, 0x9BBFE435uL, 0x56C3614EuL, 0xFFFA707AuL},
+    {0xE30BC27FuL, 0x6EB1A2F3uL, 0xB0836511uL, 0xE5F0C05AuL, 0x4965AB0EuL, 0x4D741BBFuL, 0x83464BBDuL, 0xFEEC41CAuL,
+     0x99D0B09FuL, 0x1ACA705FuL, 0xF42DA5FAuL, 0xC5D6CC56uL, 0xCC52B931uL, 0x49964EDDuL, 0xC884D8D8uL, 0x8AE59615uL},
+    {0xD4E353B7uL, 0x0CE4E3F1uL, 0xEF46B0A0uL, 0x062D8A14uL, 0x574B73FDuL, 0x6408D5ABuL, 0xD3273FFDuL, 0xBC41D1C9uL,
+     0x6BE77800uL, 0x3538E1E7uL, 0xC5655031uL, 0x71FE8B37uL, 0x6B9B331AuL, 0x1CD91621uL, 0xBB388F73uL, 0xAD825D0BuL},
+    {0x39F8868AuL, 0xF634B57BuL, 0x75CC69AFuL, 0xE27F4FD4uL, 0xD0D5496EuL, 0xA47E58CBuL, 0xD323E07FuL, 0x8A26793FuL,
+     0xFA30F349uL, 0xC61A9B72uL, 0xB696D134uL, 0x94C9D9C9uL, 0x5880A6D1uL, 0x792BECA8uL, 0xAF039995uL, 0xBDCC4645uL},
+    {0x1CB76219uL, 0x56C2E05BuL, 0x71567E7EuL, 0x0EC0BF91uL, 0x61C4C910uL, 0xE7076F86uL, 0xBABC04D9uL, 0xD67B085BuL,
+     0x5E93A96AuL, 0x9FB90459uL, 0xFBDC249AuL, 0x7526C1EAuL, 0xECDD0BB7uL, 0x0D44D367uL, 0x9DC0D695uL, 0x95399917uL},
+
+    /* 16^13 * G */
+    {0xCECA9754uL, 0x83F49167uL, 0x4B7939A0uL, 0x426D2CF6uL, 0x723FD0BFuL, 0x2555E355uL, 0xC4F144E2uL, 0xA96E6D06uL,
+     0x87880E61uL, 0x4768A8DDuL, 0xE508E4D5uL, 0x15543815uL, 0xB1B65E15uL, 0x09D7E772uL, 0xAC302FA0uL, 0x63439DD6uL},
+    {0x983C38B5uL, 0x859D3145uL, 0x637ABC8BuL, 0xB14F176CuL, 0xCAFF7BE6uL, 0x2793FB9DuL, 0x35A66A5AuL, 0xEBE5A55FuL,
+     0x9F87DC59uL, 0x7CEC1DCDuL, 0xFBDBF560uL, 0x7C595CD3uL, 0x26EB3257uL, 0x5B543B22uL, 0xC4C935FDuL, 0x69080646uL},
+    {0xADD70482uL, 0x6AAC688EuL, 0x7B4A4E8AuL, 0x708DE92AuL, 0x758A6EEFuL, 0x75B6DD73uL, 0x725B3C43uL, 0xEA4BF352uL,
+     0x87912868uL, 0x10041F2CuL, 0xEF09297AuL, 0xB1B1BE95uL, 0xA9F3860AuL, 0x19AE23C5uL, 0x515DCF4BuL, 0xC4F0F839uL},
+    {0x1D531696uL, 0xB9345238uL, 0x88CDDE69uL, 0x57201C00uL, 0x9A86AFC7uL, 0xDDE92251uL, 0xBD35CEA8uL, 0xE3043895uL,
+     0x8555970DuL, 0x7608C1E1uL, 0x2535935EuL, 0x8267DFA9uL, 0x322EA38BuL, 0xD4C60A57uL, 0x804EF8B5uL, 0xE0BF7977uL},
+    {0x16A66E91uL, 0xD730049FuL, 0xFA1B0E0DuL, 0xE97F2820uL, 0x304C28EAuL, 0x4131E003uL, 0x526BAC62uL, 0x820AB732uL,
+     0x28714423uL, 0xB2AC9EF9uL, 0xADB10CB2uL, 0x54ECFFFAuL, 0xF886A4CCuL, 0x8781476EuL, 0xDB2F8D49uL, 0x4B2C87B5uL},
+    {0x86D2E0F8uL, 0x6ADA1D42uL, 0x0E8A9FD5uL, 0xE5920122uL, 0x708C1B49uL, 0x02C936AFuL, 0x2B4BFAFFuL, 0x60F30FEEuL,
+     0x858E6A61uL, 0x6637AD06uL, 0x3FD374D0uL, 0xCE4C7767uL, 0x7188DEFBuL, 0x39D54B2DuL, 0xF56A6B66uL, 0xA8C9D250uL},
+    {0x5F520698uL, 0x0E6EC096uL, 0x44F7B8D9uL, 0x640631FEuL, 0xA35A68B9uL, 0x92FD34FCuL, 0x4D40CF4EuL, 0x9C5A4B66uL,
+     0x80B6783DuL, 0x949454BFuL, 0x3A320A10uL, 0x80E701FEuL, 0x1A0A39B2uL, 0x8D1A564AuL, 0x320587DBuL, 0x1436D53DuL},
+    {0xC094DBB5uL, 0x6233EA68uL, 0xD968D410uL, 0xB77D062EuL, 0x58B3002DuL, 0x3E719BBCuL, 0x3DC49D58uL, 0x68E7DD3DuL,
+     0x013A5E58uL, 0x8D825740uL, 0x3C9E3C1BuL, 0x21311747uL, 0x7C99B6ABuL, 0x0CB0A2A7uL, 0xC2F888F2uL, 0x5C48A3B3uL},
+
+    /* 16^14 * G */
+    {0x991724F3uL, 0xC7913E91uL, 0x39CBD686uL, 0x5EDA799CuL, 0x63D4FC1EuL, 0xDDB595C7uL, 0xAC4FED54uL, 0x6B63B80BuL,
+     0x7E5FB516uL, 0x6EA0FC69uL, 0xD0F1C964uL, 0x737708BAuL, 0x11A92CA5uL, 0x9628745FuL, 0x9A86967AuL, 0x61F37958uL},
+    {0xAA665072uL, 0x9AF39B2CuL, 0xEFD324EFuL, 0x78322FA4uL, 0xC327BD31uL, 0x3D153394uL, 0x3129DAB0uL, 0x81D5F271uL,
+     0xF48027F5uL, 0xC72E0C42uL, 0x8536E717uL, 0xAA40CDBCuL, 0x2D369D0FuL, 0xF45A657AuL, 0xEA7F74E6uL, 0xB03BBFC4uL},
+    {0x0D738DEDuL, 0x46A8C418uL, 0xE0DE5729uL, 0x6F1A5BB0uL, 0x8BA81675uL, 0xF10230B9uL, 0x112B33D4uL, 0x32C6F30CuL,
+     0xD8FFFB62uL, 0x7559129DuL, 0xB459BF05uL, 0x6A281B47uL, 0xFA3B6776uL, 0x77C1BD3AuL, 0x7829973AuL, 0x0709B380uL},
+    {0xA3326505uL, 0x8C26B232uL, 0xEE1D41BFuL, 0x38D69272uL, 0xFFE32AFAuL, 0x0459453EuL, 0x7CB3EA87uL, 0xCE8143ADuL,
+     0x7E6AB666uL, 0x932EC1FAuL, 0x22286264uL, 0x6CD2D230uL, 0x6736F8EDuL, 0x459A46FEuL, 0x9ECA85BBuL, 0x50BF0D00uL},
+    {0x877A21ECuL, 0x0B825852uL, 0x0F537A94uL, 0x300414A7uL, 0x21A9A6A2uL, 0x3F1CBA40uL, 0x76943C00uL, 0x50824EEEuL,
+     0xF83CBA5DuL, 0xA0DBFCECuL, 0x93B4F3C0uL, 0xF9538148uL, 0x48F24DD7uL, 0x61744162uL, 0xE4FB09DDuL, 0x5322D64DuL},
+    {0x3D9325F3uL, 0x57447384uL, 0xF371CB84uL, 0xA9BEF2D0uL, 0xA61E36C5uL, 0x77D2188BuL, 0xC602DF72uL, 0xBBD6A7D7uL,
+     0x8F61BC0BuL, 0xBA3AA902uL, 0x6ED0B6A1uL, 0xF49085EDuL, 0xAE6E8298uL, 0x8BC625D6uL, 0xA2E9C01DuL, 0x832B0B1DuL},
+    {0xF1F0CED1uL, 0xA337C447uL, 0x9492DD2BuL, 0x800CC793uL, 0xBEA08EFAuL, 0x4B93151DuL, 0xDE0A741EuL, 0x820CF3F8uL,
+     0x1C0F7D13uL, 0xFF1982DCuL, 0x84DDE6CAuL, 0xEF921960uL, 0x45F96EE3uL, 0x1AD7D972uL, 0x29DEA0C7uL, 0x319C8DBEuL},
+    {0x7B82B99BuL, 0xD3EA3871uL, 0x470EB624uL, 0x75922D4DuL, 0x3B95D466uL, 0x8F66EC54uL, 0xBEE1E346uL, 0x66E673CCuL,
+     0xB5F2B89AuL, 0x6AFE67C4uL, 0x290E5CD3uL, 0x3DE9C1E6uL, 0x310A2ADAuL, 0x8C278BB6uL, 0x0BDB323BuL, 0x420FA384uL},
+
+    /* 16^15 * G */
+    {0x6424C49BuL, 0x646F9679uL, 0x67C241C9uL, 0xF888DFE8uL, 0x24F68B49uL, 0xE12D4B93uL, 0xA571DF20uL, 0x9A6B62D8uL,
+     0x179483CBuL, 0x81B4B26DuL, 0x9511FAE2uL, 0x666F9632uL, 0xD53AA51FuL, 0xD281B3E4uL, 0x7F3DBD16uL, 0x7F96A765uL},
+    {0x051AF62BuL, 0x8553D37CuL, 0x0BF94496uL, 0xE9A998EBuL, 0xB0D59AA1uL, 0xE0844F9FuL, 0xE6AFB813uL, 0x983FD558uL,
+     0x65D69804uL, 0x9670C0CAuL, 0x6EA5FF2DuL, 0x732B22DEuL, 0x5FD8623BuL, 0xD7640BA9uL, 0xA6351782uL, 0x9F619163uL},
+    {0xBDEFDD4FuL, 0xF167B4E0uL, 0xF366E401uL, 0x69958465uL, 0xA73BBEC0uL, 0x5AA368ABuL, 0x7B240C21uL, 0x12148709uL,
+     0x18969006uL, 0x378C3233uL, 0xE1FE53D1uL, 0xCB4D73CEuL, 0x130C4361uL, 0x5F50A80EuL, 0x7EF5212BuL, 0xD67F5951uL},
+    {0x8CAD38C0uL, 0x332F8108uL, 0x6BD68AE2uL, 0x471B7E90uL, 0x0D8E27A3uL, 0x56AC3FB2uL, 0x136B4B0DuL, 0xB54660DBuL,
+     0xA6FD8DE4uL, 0x123A1E11uL, 0xA37799EFuL, 0x44DBFFEAuL, 0xCE6AC17CuL, 0x4540B977uL, 0xAF60ACEFuL, 0x495173A8uL},
+    {0x4573EAB0uL, 0xEB443743uL, 0xD1AC6031uL, 0x11570DFBuL, 0x44DD9AFDuL, 0xF7D9B45BuL, 0x22067231uL, 0xB8066ADDuL,
+     0xF8A3F0B4uL, 0x15F92AD8uL, 0xE0ACE2A2uL, 0x9E0E4899uL, 0xFAB38B80uL, 0xBDCD0AADuL, 0x17020052uL, 0x46506AE9uL},
+    {0x8FCA399DuL, 0x429A69F7uL, 0x0207BB63uL, 0xFE9E27D2uL, 0x8788F582uL, 0xEC655ED6uL, 0xADB75F6EuL, 0xA426D748uL,
+     0xCA81C66DuL, 0x18695C02uL, 0xA531D425uL, 0x84FB8D27uL, 0xDEFF48BAuL, 0x3A3A8956uL, 0x766D2247uL, 0xAF1D0D56uL},
+    {0x352C4B5CuL, 0x5A059565uL, 0x590BC3E2uL, 0x49261531uL, 0xF66F9F5FuL, 0x809F7521uL, 0xC70A4A9BuL, 0x2BAEF6BFuL,
+     0x09ED3561uL, 0xE7E6FA65uL, 0x984B230CuL, 0x11370233uL, 0xD04CDC69uL, 0x2151659BuL, 0xF007D416uL, 0xBDB83C63uL},
+    {0x391C2A82uL, 0x9EBB284DuL, 0x158308E8uL, 0xBCDD4863uL, 0x83F1EDCAuL, 0x006F16ECuL, 0x695DC6C8uL, 0xA13E2C37uL,
+     0x4A057A87uL, 0x2AB756F0uL, 0xA6B48F98uL, 0xA8765500uL, 0x68651C44uL, 0x4252FACEuL, 0xE1765E02uL, 0xA52B540BuL},
+
+    /* 16^16 * G */
+    {0x16A0D2BBuL, 0x4F922FC5uL, 0x1A623499uL, 0x0D5CC16CuL, 0x57C62C8BuL, 0x9241CF3AuL, 0xFD1B667FuL, 0x2F5E6961uL,
+     0xF5A01797uL, 0x5C15C70BuL, 0x60956192uL, 0x3D20B44DuL, 0x071FDB52uL, 0x04911B37uL, 0x8D6F0F7BuL, 0xF648F916uL},
+    {0xFAC61D9AuL, 0x027CC8B8uL, 0xE3C6FE8AuL, 0x7D25E062uL, 0xE5BFF503uL, 0xE08805BFuL, 0x6FF632F7uL, 0x13271E6CuL,
+     0x232F76A5uL, 0x55DCA6C0uL, 0x701EF426uL, 0x8957C32DuL, 0xA10A5178uL, 0xEE728BCBuL, 0xB62C5173uL, 0x5EA60411uL},
+    {0xB5DEF996uL, 0x4090914BuL, 0x233DD1E7uL, 0x1CB69C83uL, 0x9B3D5E76uL, 0xC1E9C1D3uL, 0xFCCF6012uL, 0x1F3338EDuL,
+     0x2F5378A8uL, 0xB1E95D0DuL, 0x2F00CD21uL, 0xACF4C2C7uL, 0xEB5FE290uL, 0x6E984240uL, 0x248088AEuL, 0xD66C038DuL},
+    {0xB4D8BC50uL, 0x9AD5462BuL, 0xA9195770uL, 0x181C0B16uL, 0x78412A68uL, 0xEBD4FE1CuL, 0xC0DFF48CuL, 0xAE0341BCuL,
+     0x7003E866uL, 0xB6BC45CFuL, 0x8A24A41BuL, 0xF11A6DEAuL, 0xD04C24C2uL, 0x5407151AuL, 0xDA5B7B68uL, 0x62C9D27DuL},
+    {0x614C0900uL, 0xD4992B30uL, 0xBD00C24BuL, 0xDA98D121uL, 0x7EC4BFA1uL, 0x7F534DC8uL, 0x37DC34BCuL, 0x4A5FF674uL,
+     0x1D7EA1D7uL, 0x68C196B8uL, 0x80A6D208uL, 0x38CF2893uL, 0xE3CBBD6EuL, 0xFD56CD09uL, 0x4205A5B6uL, 0xEC72E27EuL},
+    {0xA8AFD30BuL, 0x32865719uL, 0x8A826DCEuL, 0x86798328uL, 0xC4A8FBE0uL, 0xDF04E891uL, 0xEBF56AD3uL, 0xBB6B6E1BuL,
+     0x471F1FF0uL, 0x0A695B11uL, 0xBE15BAF0uL, 0xD76C3389uL, 0xBE96C43EuL, 0x018EDB95uL, 0x90794158uL, 0xF2BEAAF4uL},
+    {0xB88756DDuL, 0xE8B97932uL, 0xF17E3E61uL, 0xED4E8652uL, 0x3EE1C4A4uL, 0xC2DD1499uL, 0x597F8C0EuL, 0xC0AAEE17uL,
+     0x6C168AF3uL, 0x15C4EDB9uL, 0xB39AE875uL, 0x6563C7BFuL, 0x20ADB436uL, 0xADFADB6FuL, 0x9A042AC0uL, 0xAD55E8C9uL},
+    {0x523B8BF6uL, 0x0A50B12EuL, 0x8F910C1BuL, 0x8009EB5BuL, 0x4A167588uL, 0xF535AF82uL, 0xFB2A2ABDuL, 0x0F835F9CuL,
+     0x2AFCEB62uL, 0xF59B2931uL, 0x169D383FuL, 0xC797DF2AuL, 0x66AC02B0uL, 0xEB3F5FB0uL, 0xDAA2D0CAuL, 0x029D4C6FuL},
+
+    /* 16^17 * G */
+    {0xF5B343BCuL, 0x58AF2010uL, 0xF2F142FEuL, 0x0F2E400AuL, 0xA85F4BDFuL, 0x3483BFDEuL, 0x03BFEAA9uL, 0xF0B1D093uL,
+     0xC7081603uL, 0x2EA01B95uL, 0x3DBA1097uL, 0xE943E4C9uL, 0xB438F3A6uL, 0x47BE92ADuL, 0xE5BF6636uL, 0x00BB7742uL},
+    {0x7BFE7178uL, 0xB674481BuL, 0x65405868uL, 0x4E1DEBAEuL, 0xC48C867DuL, 0x061B2821uL, 0x513B30EAuL, 0x69C15B35uL,
+     0x36871088uL, 0x3B4A1666uL, 0x1220B1FFuL, 0xE5E29F5DuL, 0x233D9F4DuL, 0x4B82BB35uL, 0x18CDC675uL, 0x4E076333uL},
+    {0x31815E69uL, 0x3A63C397uL, 0xDCDD2802uL, 0x6DF9CBD6uL, 0x15B4F6AFuL, 0x4C47ED4AuL, 0x6AC0F978uL, 0x62009D82uL,
+     0x8B898FC7uL, 0x664D80D2uL, 0x2C17C91FuL, 0x72F1EEDAuL, 0x7AAE6609uL, 0x9E84D3BCuL, 0x28376895uL, 0x58C7C195uL},
+    {0xA3E6FCEDuL, 0x0D53F5C7uL, 0xF45FBDEBuL, 0xE8CBBDD5uL, 0x13339A70uL, 0xF85C01DFuL, 0x142CEB81uL, 0x0FF71880uL,
+     0xBD70437AuL, 0x4C4E8774uL, 0xBA0BDA6AuL, 0x5FB32891uL, 0xF18BD26EuL, 0x1CDBEBD2uL, 0x03A9D522uL, 0x2F9526F1uL},
+    {0xA8271D7EuL, 0xA752C905uL, 0x58E5810BuL, 0x4735DFA5uL, 0x5D925AEBuL, 0xE18A44EEuL, 0x13C8A853uL, 0x9708697FuL,
+     0xBFCC9A0BuL, 0x8377D540uL, 0xE574D403uL, 0x7B27E01CuL, 0xCF60A8A6uL, 0x3D3D180CuL, 0xF1C298BFuL, 0xE48EF152uL},
+    {0x0AEAA3C0uL, 0x313A2E8CuL, 0xABE85B0AuL, 0x89F46D9EuL, 0x2DA97D3AuL, 0xD2889EBDuL, 0x103F8CBAuL, 0x9484026AuL,
+     0x87D83B5FuL, 0x52159F8AuL, 0xB1EF0295uL, 0xDB2220D6uL, 0x03C01ACFuL, 0xBDA0746EuL, 0x14419FE3uL, 0x4F97B2A7uL},
+    {0xC880E5CAuL, 0xCCBF7AC2uL, 0x8D11C450uL, 0x8299DBEEuL, 0x0F77A6BFuL, 0xBB27D11BuL, 0x5EDCE793uL, 0xC601630BuL,
+     0x79E7F8EAuL, 0xDB73B9FBuL, 0xF4367288uL, 0xE448BBA7uL, 0xB035571BuL, 0xF5B6416FuL, 0xA48891A2uL, 0x981B8F5DuL},
+    {0x92C4D684uL, 0x40CE3051uL, 0x7612EFCDuL, 0x8B04D725uL, 0x6F9CAE20uL, 0xB9DCDA36uL, 0xF058856CuL, 0x0EDC4D24uL,
+     0x85427900uL, 0x64F2E6BFuL, 0xDC09DFEAuL, 0x3DE81295uL, 0x379BF26CuL, 0xD41B4487uL, 0x6DF135A9uL, 0x50B62C6DuL},
+
+    /* 16^18 * G */
+    {0xD005832AuL, 0x0DB2FB5EuL, 0x91042E4FuL, 0x5F5EFD3BuL, 0xED70F8CAuL, 0x8C4FFDC6uL, 0xB52DA9CCuL, 0xE4645D0BuL,
+     0xC9001D1FuL, 0x9596F58BuL, 0x4E117205uL, 0x52C8F0BCuL, 0xE398A084uL, 0xFD4AA0D2uL, 0x104F49DEuL, 0x815BFE3AuL},
+    {0xE548B37BuL, 0x54EB3ACCuL, 0x84D40549uL, 0xB38E7542uL, 0x7B341B4FuL, 0x8C3DAA51uL, 0x690BF7FAuL, 0x2F6928ECuL,
+     0x86CE6C41uL, 0x0496B323uL, 0x10ADADCDuL, 0x01BE1C55uL, 0x4BB5FAF9uL, 0xC04E67E7uL, 0xE15C9985uL, 0x3CBAF678uL},
+    {0xD7AB9A2DuL, 0x524D226AuL, 0x7DFAE958uL, 0x9C00090DuL, 0x8751D8C2uL, 0x0BA5F539uL, 0x3AB8262DuL, 0x8AFCBCDDuL,
+     0xE99D043BuL, 0x57392729uL, 0xAEBC943AuL, 0xEF51263BuL, 0x20862935uL, 0x9FEACE93uL, 0xB06C817BuL, 0x639EFC03uL},
+    {0x341D81DCuL, 0xE839BE7DuL, 0x32148379uL, 0xCDDB6889uL, 0xF7026EADuL, 0xDA6211A1uL, 0xF4D1CC5EuL, 0xF3B2575FuL,
+     0xA7A73AE6uL, 0x40CFC8F6uL, 0x61D5B483uL, 0x83879A5EuL, 0x41A50EBCuL, 0xC5ACB1EDuL, 0x3C07D8FAuL, 0x59A60CC8uL},
+    {0xC3B81990uL, 0xDEC98D4AuL, 0x9E0CC8FEuL, 0x1CB83722uL, 0xD2B427B9uL, 0xFE0B0491uL, 0xE983A66CuL, 0x0F2386ACuL,
+     0xB3291213uL, 0x930C4D1EuL, 0x59A62AE4uL, 0xA2F82B2EuL, 0xF93E89E3uL, 0x77233853uL, 0x11777C7FuL, 0x7F8063ACuL},
+    {0x59371000uL, 0x604AC97CuL, 0x7F759C18uL, 0xE1C48C70uL, 0xA5DB6B65uL, 0x3F62ECC5uL, 0x38A21495uL, 0x0A78B173uL,
+     0xBCC8AD94uL, 0x6BE1819DuL, 0xD89C3400uL, 0x70DC04F6uL, 0xA6B4840AuL, 0x462557B4uL, 0x60BD21C0uL, 0x544C6ADEuL},
+    {0x02FF6072uL, 0x36E607CFuL, 0x8AD98CDCuL, 0xA47D2CA9uL, 0xF5F56609uL, 0xBF471D1EuL, 0xF264ADA0uL, 0xBCF86623uL,
+     0xAA9E5CB6uL, 0xB70C0687uL, 0x17401C6CuL, 0xC98124F2uL, 0xD4A61435uL, 0x8189635FuL, 0xA9D98EA6uL, 0xD28FB8AFuL},
+    {0x65C7322DuL, 0x439530B6uL, 0xB3C1B3FBuL, 0xCF12CC01uL, 0x0172F685uL, 0xC70B0186uL, 0x1B58391DuL, 0xB915EE22uL,
+     0xA317DB24uL, 0x9AFDF03BuL, 0x17B8FFC4uL, 0x87DEC659uL, 0xE4D3D050uL, 0x7F46597BuL, 0x006500E7uL, 0x80A1C1EDuL},
+
+    /* 16^19 * G */
+    {0x97ACF4ECuL, 0x3E22A7B3uL, 0x5EA8B640uL, 0x0426C400uL, 0x4E969285uL, 0x5E3295A6uL, 0xA6A45670uL, 0x22AABC59uL,
+     0x5F5942BCuL, 0xB929714CuL, 0xFA3182EDuL, 0x9A6168BDuL, 0x104152BAuL, 0x2216A665uL, 0xB6926368uL, 0x46908D03uL},
+    {0x5A1251FBuL, 0xA9F5D874uL, 0xC72725C7uL, 0x967747A8uL, 0x31FFE89EuL, 0x195C33E5uL, 0xE964935EuL, 0x609D210FuL,
+     0x2FE12227uL, 0xCAFD6CA8uL, 0x0426469DuL, 0xAF9B5B96uL, 0x5693183CuL, 0x2E9EE04CuL, 0xC8146FEFuL, 0x1084A333uL},
+    {0x10395755uL, 0xCE06B882uL, 0x5EC1DF80uL, 0x117CE634uL, 0xEFF55E96uL, 0xFEFAE513uL, 0xFD7FED1EuL, 0xCF36CBA6uL,
+     0xA40EBF88uL, 0x7340ECA9uL, 0xB3D37E12uL, 0xE6EC1BCFuL, 0x86BBF9FFuL, 0xCA51B64EuL, 0x8B40E05EuL, 0x4E0DBB58uL},
+    {0xAED1D1F7uL, 0x96649933uL, 0x50563090uL, 0x566EAFF3uL, 0xAD2E39CFuL, 0x345057F0uL, 0x1F832124uL, 0x148FF65BuL,
+     0xCF94CF0DuL, 0x042E89D4uL, 0x520C58B3uL, 0x319BEC84uL, 0x5361AA0DuL, 0x2A267626uL, 0x8FBC87ADuL, 0xC86FA302uL},
+    {0x7EA2EE34uL, 0x359D7B9CuL, 0x09CC3A71uL, 0x3FD0D94CuL, 0x3A1EA37AuL, 0xBB53C31CuL, 0xCF818C87uL, 0x533425FAuL,
+     0x810156E0uL, 0x7CD199C3uL, 0x30C16448uL, 0x0EA020E4uL, 0x4A642542uL, 0xE557BA09uL, 0x9465F5EAuL, 0xE657E7E7uL},
+    {0x5C8B06D5uL, 0xFC83D2ABuL, 0xFE4EAC46uL, 0xB1A785A2uL, 0x846F7779uL, 0xB99315BCuL, 0xEF9EA505uL, 0xCF31D816uL,
+     0x15D7DC85uL, 0x2391FE6AuL, 0xB4016B33uL, 0x2F132B04uL, 0x181CB4C7uL, 0x29547FE3uL, 0x650155A1uL, 0xDB66D8A6uL},
+    {0x593D070FuL, 0x59CD0E8BuL, 0x5255625DuL, 0x43757516uL, 0x5B7A0399uL, 0x551FDDA7uL, 0x2DEC1EEBuL, 0x7BB6E6B0uL,
+     0x334C0922uL, 0x729BB662uL, 0x0CF41B79uL, 0x3DF631DFuL, 0x78F32402uL, 0x01ABF3C5uL, 0x9CD33C88uL, 0xFCB4666CuL},
+    {0xADC1696FuL, 0x6B66D7E1uL, 0x0ACD72D0uL, 0x98EBE593uL, 0xCC1B7435uL, 0x65F24550uL, 0xB4B9A5ECuL, 0xCE231393uL,
+     0xDB067DF9uL, 0x234A22D4uL, 0xCAFF9B00uL, 0x98DDA095uL, 0x6100C9C1uL, 0x1BBC75A0uL, 0x939CF695uL, 0x1560A9C8uL},
+
+    /* 16^20 * G */
+    {0xF1C367CAuL, 0xE4050F1CuL, 0xC90FBC7DuL, 0x9BC85A9BuL, 0xE1A11032uL, 0xA373C4A2uL, 0xAD0393A9uL, 0xB64232B7uL,
+     0x167DAD29uL, 0xF5577EB0uL, 0x94B78AB2uL, 0x1604F301uL, 0xE829348BuL, 0x0BAA94AFuL, 0x41654342uL, 0x77FBD8DDuL},
+    {0xFCF0A7FDuL, 0x31F14802uL, 0x5488B01EuL, 0x42FD0789uL, 0x9952B498uL, 0x71D78D6DuL, 0x07AC5201uL, 0x8EB572D9uL,
+     0x4D194A88uL, 0xE0A2A44CuL, 0xBA017E66uL, 0xD2B63FD9uL, 0xF888AEFCuL, 0x78EFC6C8uL, 0x4A881A11uL, 0xB76F6BDAuL},
+    {0x68AF43EEuL, 0xA2F7932CuL, 0x703D00BDuL, 0x5502468EuL, 0x2FB061F5uL, 0xE5DC978FuL, 0x28C815ADuL, 0xC9A1904AuL,
+     0x470C56A4uL, 0xD3AF538DuL, 0x193D8CEDuL, 0x159ABC5FuL, 0x20108EF3uL, 0x2A37245FuL, 0x223F7178uL, 0xFA17081EuL},
+    {0xB4B4B67CuL, 0x1FE2A9B2uL, 0xE8020604uL, 0xC1D10DF0uL, 0xBC8058D8uL, 0x9D64ABFCuL, 0x712A0FBBuL, 0x8943B9B2uL,
+     0x3B3DEF04uL, 0x90EED914uL, 0x4CE775FFuL, 0x85AB3AA2uL, 0x7BBC9040uL, 0x605FD4CAuL, 0xE2C75DFBuL, 0x8B34A564uL},
+    {0x8E2F7D90uL, 0x5C18ACF8uL, 0x77BE32CDuL, 0xFDBF33D7uL, 0xD2EB5EE9uL, 0x0A085CD7uL, 0xB3201115uL, 0x2D702CFBuL,
+     0x85C88CE8uL, 0xB6E0EBDBuL, 0x1E01D617uL, 0x23A3CE3CuL, 0x567333ACuL, 0x3041618EuL, 0x157EDB6BuL, 0x9DD0FD8FuL},
+    {0x98FA7AAAuL, 0xB2B26107uL, 0xF073AA4EuL, 0x41209EE4uL, 0xF2D6B19BuL, 0xF1570359uL, 0xFC577CAFuL, 0xCBE6868CuL,
+     0x32C04DD3uL, 0x186C4BDCuL, 0xCFEEE397uL, 0xA6C35FAEuL, 0xF086C0CFuL, 0xB4A1B312uL, 0xD9461FE2uL, 0xE0A5CCC6uL},
+    {0x6FA6110CuL, 0x516FF3A3uL, 0xFB93561FuL, 0x74FB1EB1uL, 0x8457522BuL, 0x6C0C9047uL, 0x6BB8BDC6uL, 0xCFD32104uL,
+     0xCC80AD57uL, 0x2D6884A2uL, 0x86A9B637uL, 0x7C27FC35uL, 0xADF4E8CDuL, 0x3461BAEDuL, 0x617242F0uL, 0x1D56251AuL},
+    {0x431DD80EuL, 0xB84011A9uL, 0x73306CD9uL, 0xEB7C7CCAuL, 0xD1B3B730uL, 0x20FADD29uL, 0xFE37B3D3uL, 0x83858B5BuL,
+     0xB6251D5CuL, 0xBF4CD193uL, 0x1352D952uL, 0x1CCA1FD3uL, 0x90FBC051uL, 0xC66157A4uL, 0x89B98636uL, 0x7990A638uL},
+
+    /* 16^21 * G */
+    {0x87DEC0E1uL, 0xE5AA692AuL, 0xF7B39D00uL, 0x010DED8DuL, 0x54CFA0B5uL, 0x7B1B80C8uL, 0xA0F8EA28uL, 0x66BEB876uL,
+     0x3476CD0EuL, 0x50D7F531uL, 0xB08D3949uL, 0xA63D0E65uL, 0x53479FC6uL, 0x1A09EEA9uL, 0xF499E742uL, 0x82AE9891uL},
+    {0x5CA7D866uL, 0xAB58B910uL, 0x3ADB3B34uL, 0x582967E2uL, 0xCCEAC0BCuL, 0x89AE4447uL, 0x7BF56AF5uL, 0x919C667CuL,
+     0x60F5DCD7uL, 0x9AEC17B1uL, 0xDDCAADBCuL, 0xEC697B9FuL, 0x463467F5uL, 0x0B98F341uL, 0xA967132FuL, 0xB187F1F7uL},
+    {0x214AEB18uL, 0x90FE7A1DuL, 0x741432F7uL, 0x1506AF3CuL, 0xE591A0C4uL, 0xBB5565F9uL, 0xB44F1BC3uL, 0x10D41A77uL,
+     0xA84BDE96uL, 0xA09D65E4uL, 0xF20A6A1CuL, 0x42F060D8uL, 0xF27F9CE7uL, 0x652A3BFDuL, 0x3B3D739FuL, 0xB6BDB65CuL},
+    {0xEC7FAE9FuL, 0xEB5DDCB6uL, 0xEFB66E5AuL, 0x995F2714uL, 0x69445D52uL, 0xDEE95D8EuL, 0x09E27620uL, 0x1B6C2D46uL,
+     0x8129D716uL, 0x32621C31uL, 0x0958C1AAuL, 0xB03909F1uL, 0x1AF4AF63uL, 0x8C468EF9uL, 0xFBA5CDF6uL, 0x162C429FuL},
+    {0x753B9371uL, 0x2F682343uL, 0x5F1F9CD7uL, 0x29CAB45AuL, 0xB245DB96uL, 0x571623ABuL, 0x3FD79999uL, 0xC507DB09uL,
+     0xAF036C32uL, 0x4E2EF652uL, 0x05018E5CuL, 0x86F0CC78uL, 0xAB8BE350uL, 0xC10A73D4uL, 0x7E826327uL, 0x6519B397uL},
+    {0x9C053DF7uL, 0xE8CB5EEFuL, 0xB300EA6FuL, 0x8DE25B37uL, 0xC849CFFBuL, 0xDB03FA92uL, 0xE84169BBuL, 0x242E43A7uL,
+     0xDD6F958EuL, 0xE4FA51F4uL, 0xF4445A8DuL, 0x6925A77FuL, 0xE90D8949uL, 0xE6E72A50uL, 0x2B1F6390uL, 0xC66648E3uL},
+    {0x173E460CuL, 0xB2AB1957uL, 0x30704590uL, 0x1BBBCE75uL, 0xDB1C7162uL, 0xC0A90DBDuL, 0x15CDD65DuL, 0x505E399EuL,
+     0x57797AB7uL, 0x68434DCBuL, 0x6A2CA8E8uL, 0x60AD35BAuL, 0xDE3336C1uL, 0x4BFDB1E0uL, 0xD8B39015uL, 0xBBEF99EBuL},
+    {0x1711EBECuL, 0x6C3B96F3uL, 0xCE98FDC4uL, 0x2DA40F1FuL, 0x57B4411FuL, 0xB99774D3uL, 0x15B65BB6uL, 0x87C8BDF4uL,
+     0xC2EEF12DuL, 0xDA3A89E3uL, 0x3C7471F3uL, 0xDE95BB9BuL, 0xD812C594uL, 0x600F225BuL, 0x2B75A56BuL, 0x54907C5DuL},
+
+    /* 16^22 * G */
+    {0xF79588C0uL, 0xA80D1DB6uL, 0xB55768CCuL, 0xFA52FC69uL, 0x7F54438AuL, 0x0B4DF1AEuL, 0xF9B46A4FuL, 0x0CADD1A7uL,
+     0x1803DD6FuL, 0xB40EA6B3uL, 0x55EAAE35uL, 0x488E4FA5uL, 0x382E4E16uL, 0x9F047D55uL, 0x2F6E0C98uL, 0xC9B5B7E0uL},
+    {0x7C4A658AuL, 0xC12738B6uL, 0x40E72182uL, 0xB3C47639uL, 0x8798E44FuL, 0x3B77BE46uL, 0x17A7F85FuL, 0xDC047DF2uL,
+     0x5E59D92DuL, 0x2439D4C5uL, 0xE8E64D8DuL, 0xCEDCA475uL, 0x87CA9B16uL, 0xA724CD0DuL, 0xA5540DFEuL, 0x35E4FD59uL},
+    {0x83A7337BuL, 0x4B7D0E06uL, 0xFFECF249uL, 0x1E3416D4uL, 0x66A2B71FuL, 0x24840EFFuL, 0xB37CC26DuL, 0xD0D9A50AuL,
+     0x6FE28EF7uL, 0xE2198150uL, 0x23324C7FuL, 0x3CC5EF16uL, 0x769B5263uL, 0x220F3455uL, 0xA10BF475uL, 0xE2ADE2F1uL},
+    {0x3A29467AuL, 0x9894344FuL, 0xC51EBA6DuL, 0xDE81E949uL, 0xA5E5C2F2uL, 0xDAEA066BuL, 0x08C8C7B3uL, 0x3FC8A614uL,
+     0x06D0DE9FuL, 0x7ADFF88FuL, 0x3B75CE0AuL, 0xBBC11CF5uL, 0xFBBC87D5uL, 0x9FBB7ACCuL, 0x7BADFDE2uL, 0xA1458E26uL},
+    {0xDACDDB7DuL, 0x03B6C8C7uL, 0x7E1EDCADuL, 0x92ED5004uL, 0x54080633uL, 0xA0E46C2FuL, 0x46DEC1CEuL, 0xCD37663DuL,
+     0xF365B7CCuL, 0x396984C5uL, 0xE79BB95DuL, 0x294E3A2AuL, 0x27B1D3C1uL, 0x9AA17D77uL, 0xE49440F5uL, 0x3FFD3CFAuL},
+    {0xABB830D1uL, 0x041C93E3uL, 0x5C2C5270uL, 0x2AD23532uL, 0xEE4B259DuL, 0xAEFD1BE2uL, 0x1EADD857uL, 0x3EF26777uL,
+     0x9B0D7D86uL, 0x2AF8F703uL, 0x7B7E6F20uL, 0x80F5AF2DuL, 0xCEC8E295uL, 0xB5FA1D3CuL, 0xF68F09F6uL, 0xE73F3902uL},
+    {0x399F9CF3uL, 0x26679D11uL, 0x1E3C4394uL, 0x78E7A48EuL, 0x0D98DAF1uL, 0x08722DEAuL, 0x80030EA3uL, 0x37E7ED58uL,
+     0x3C8AAE72uL, 0xF3731AD4uL, 0xAC729695uL, 0x7878BE95uL, 0xBBC28352uL, 0x6A643AFFuL, 0x78759B61uL, 0xEF8B801BuL},
+    {0xE039C256uL, 0x1CB43668uL, 0x7C17FD5DuL, 0x5F26FB8BuL, 0x79AA062BuL, 0xEEE426AFuL, 0xD78FBF04uL, 0x072002D0uL,
+     0xE84FB7E3uL, 0x4C9CA237uL, 0x0C82133DuL, 0xB401D8A1uL, 0x6D7E4181uL, 0xAAA52592uL, 0x73DBB152uL, 0xE9430833uL},
+
+    /* 16^23 * G */
+    {0xBE24319AuL, 0xF92DDA31uL, 0xE095A8E7uL, 0x03F7D28BuL, 0x98782185uL, 0xA52FE840uL, 0x29C24DBCuL, 0x276DDAFEuL,
+     0x1D7A64EBuL, 0x80CD5496uL, 0x7F1DBE42uL, 0xE4360889uL, 0x8438D2D5uL, 0x2F81A877uL, 0x85169036uL, 0x7E4D52A8uL},
+    {0x615FAA8FuL, 0x7B15FD9DuL, 0x968554EDuL, 0x8FA1EB40uL, 0x7AA44882uL, 0x7BB4447EuL, 0x029FFF32uL, 0x2BB2D0D1uL,
+     0x6CAA6D2FuL, 0x075E2A64uL, 0x22E7351BuL, 0x8EB879DEuL, 0x9A506C62uL, 0xBCD5624EuL, 0xA87E24DCuL, 0x218EAEF0uL},
+    {0x3D30A2C5uL, 0x1FE647D8uL, 0xF78A81DCuL, 0x0857F77EuL, 0x131A4A9BuL, 0x11D5A334uL, 0x29D393F5uL, 0xC0A94AF9uL,
+     0xDAA6EC1AuL, 0xBC3A5C0BuL, 0x88D2D7EDuL, 0xBA9FE493uL, 0xBB614797uL, 0xBB4335B4uL, 0x72F83533uL, 0x991C4D68uL},
+    {0xE978A1D3uL, 0x77B868CEuL, 0x7AB92D04uL, 0xE3A68B33uL, 0x87A5B862uL, 0x51029794uL, 0x3A61D41DuL, 0x5F0606C3uL,
+     0x6F9326F1uL, 0x2814BE27uL, 0xC6FE3C2EuL, 0x2F521C14uL, 0xACDF7351uL, 0x17464D7DuL, 0x777F7E44uL, 0x10F5F9D3uL},
+    {0x3D34A2E3uL, 0x1FD84CE4uL, 0xB43B5D61uL, 0xEE3759CEuL, 0x619186C7uL, 0x895BC78CuL, 0xCBB9725AuL, 0xF19C3809uL,
+     0xDE744B1FuL, 0xC0BE21AAuL, 0x60F8056BuL, 0xA7D222B0uL, 0xB23EFE11uL, 0x74BE6157uL, 0x0CD68253uL, 0x6FAB2B4FuL},
+    {0xA4D32282uL, 0xB6E33878uL, 0x48020AE7uL, 0xE36E029DuL, 0x37A9B750uL, 0xE05847FBuL, 0xB29E3819uL, 0xF876812CuL,
+     0xD23A17F0uL, 0x84AD138EuL, 0xF0B3950EuL, 0x6D7B4480uL, 0x2FD67AE0uL, 0xDFA8AEF4uL, 0x52333AF6uL, 0x8D3EEA24uL},
+    {0xB99A72CBuL, 0x2101A522uL, 0x87618016uL, 0x06DE6E67uL, 0xE6F3653EuL, 0x5FF8C7CDuL, 0xC7A6754AuL, 0x0A821AB5uL,
+     0x7CB0B5A2uL, 0x7E3FA52BuL, 0xC9048790uL, 0xA7FB121CuL, 0x06CE053AuL, 0x1A725020uL, 0x04E929B0uL, 0xB490A31FuL},
+    {0xC5F95CD8uL, 0xB06B1244uL, 0xF4AB95F4uL, 0xDA8C8AF0uL, 0xB9E5836DuL, 0x1BAE59C2uL, 0x3ACFFFFCuL, 0x07D51E7EuL,
+     0xC2CCBCDAuL, 0x01E15E6AuL, 0x8528C3E0uL, 0x3BC1923FuL, 0xA49FEAD4uL, 0x43324577uL, 0x2AA7A711uL, 0x61A1B884uL},
+
+    /* 16^24 * G */
+    {0xB0E63D34uL, 0x4FE7EE31uL, 0xA9E54FABuL, 0xF4600572uL, 0xD5E7B5A4uL, 0xC0493334uL, 0x06D54831uL, 0x8589FB92uL,
+     0x6583553AuL, 0xAA70F5CCuL, 0xE25649E5uL, 0x0879094AuL, 0x10044652uL, 0xCC904507uL, 0x02541C4FuL, 0xEBB0696DuL},
+    {0xA2DEE7A6uL, 0x758C1A3EuL, 0x734B2284uL, 0xDCDE2F3CuL, 0x4EABA6ADuL, 0xABA445D2uL, 0x76CEE0A7uL, 0x35AAF668uL,
+     0xE5AA049AuL, 0x7E0B04A9uL, 0x91103E84uL, 0xE74083ADuL, 0x40AFECC3uL, 0xBEB183CEuL, 0xEA043F7AuL, 0x6B89DE9FuL},
+    {0x99375235uL, 0xB99F0E03uL, 0xB9917970uL, 0x7614C847uL, 0x524EC067uL, 0xFEC93CE9uL, 0x9B122520uL, 0xE40E7BF8uL,
+     0xEE4C4774uL, 0xB5670631uL, 0x3B04914CuL, 0x6F03847AuL, 0xDC9DD226uL, 0xC96E9429uL, 0x8C57C1F8uL, 0x43489B6CuL},
+    {0xFE67BA66uL, 0x0E299D23uL, 0x93CF2F34uL, 0x91450760uL, 0x97FCF913uL, 0xF45B5EA9uL, 0x8BD7DDDAuL, 0x5BE00843uL,
+     0xD53FF04DuL, 0x358C3E05uL, 0x5DE91EF7uL, 0xBF7CCDC3uL, 0xB69EC1A0uL, 0xAD684DBFuL, 0x801FD997uL, 0x367E7CF2uL},
+    {0xCC2338FBuL, 0x46FFD227uL, 0x90E26153uL, 0x89FF6FA9uL, 0x331A0076uL, 0xBE570779uL, 0x06E1F3AFuL, 0x43D241C5uL,
+     0xDE9B62A3uL, 0xFDCDB97DuL, 0xA0AE30EAuL, 0x6A06E984uL, 0x4FBDDF7DuL, 0xC9BF1680uL, 0xD36163C4uL, 0x170471A2uL},
+    {0x3113655EuL, 0xFF5BA8AEuL, 0x57B83180uL, 0xFA2C6E2BuL, 0x77E0EABEuL, 0x1C482719uL, 0x337FEA97uL, 0xF9F3C555uL,
+     0xA42581CBuL, 0x340F7022uL, 0x18F710E3uL, 0xE1DE0BC2uL, 0xF62E5AA8uL, 0xEE640ADEuL, 0x49428940uL, 0x16B23891uL},
+    {0x55950CC3uL, 0x361619E4uL, 0x56B66BB8uL, 0xC71D665CuL, 0xAFAC6D84uL, 0xEA034B34uL, 0xE5E4C7E3uL, 0xA987F832uL,
+     0x7A79A6A7uL, 0xA0742772uL, 0xE26D6C23uL, 0x56E5D017uL, 0x38167E10uL, 0x7E50B976uL, 0xE88AA84EuL, 0xAA6C81EFuL},
+    {0xB0DC8595uL, 0x0CA1F3B7uL, 0x9F1D9F2EuL, 0x27DE4608uL, 0xBADD82A7uL, 0x1AF3BF39uL, 0x65862448uL, 0x79356A79uL,
+     0xF5F9A052uL, 0xC0602345uL, 0x139A42F9uL, 0x1A8B0F89uL, 0x844D40FCuL, 0xB53EEE42uL, 0x4E5B6368uL, 0x93B0BFE5uL},
+
+    /* 16^25 * G */
+    {0xC8DE610BuL, 0x0F893A5DuL, 0x67E223CEuL, 0xE8C515FBuL, 0x4EAD6DC5uL, 0x7774BFA6uL, 0x925C728FuL, 0x89D20F95uL,
+     0x098583CEuL, 0x7A1E0966uL, 0x93F2A7D7uL, 0xA2EEDB94uL, 0x4C304D4AuL, 0x1B282097uL, 0xC077282DuL, 0x0842E3DAuL},
+    {0x74CD06FFuL, 0xA1010E9DuL, 0xACA3EEACuL, 0x9C17C7DFuL, 0x8063AA2BuL, 0x74C86CD3uL, 0x734614FFuL, 0x8595C4B3uL,
+     0x990F62CCuL, 0xA3DE00CAuL, 0xCA0C3BE5uL, 0xD9BED213uL, 0xDF8CE9F5uL, 0x7886078AuL, 0x5CD44444uL, 0xDDB27CE3uL},
+    {0xFC15AA1EuL, 0x5A3097BEuL, 0xB54B0745uL, 0x40D12548uL, 0x519A5F12uL, 0x5BAD4706uL, 0xA439DEE6uL, 0xED03F717uL,
+     0x4A02C499uL, 0x0794BB6CuL, 0xCFFE71D2uL, 0xF725083DuL, 0x0F3ADCAFuL, 0x2CAD7519uL, 0x43729310uL, 0x7F68EA1CuL},
+    {0x26EE8382uL, 0x9C7C581DuL, 0x359D638EuL, 0xCF17DCC5uL, 0xB728AE3DuL, 0xEE8273ABuL, 0xF821F047uL, 0x1D112926uL,
+     0x50491A74uL, 0x11498477uL, 0xFDE0DFB9uL, 0x687FA761uL, 0x7EA435ABuL, 0x2C258022uL, 0x91CE7E3FuL, 0x6B8BDB94uL},
+    {0xF7F91D0FuL, 0x9C806D8AuL, 0xA82A5728uL, 0x3B61B0F1uL, 0x94D76754uL, 0x4640032DuL, 0x47D834C6uL, 0x273EB5DEuL,
+     0x7B4E4D53uL, 0x2988ABF7uL, 0xDE401777uL, 0xB7CE66BFuL, 0x715071B3uL, 0x9FBA6B32uL, 0xAD3A1A98uL, 0x82413C24uL},
+    {0x3CC8AC85uL, 0x75537B7EuL, 0xDD02753BuL, 0x8D725F57uL, 0xB737DF2FuL, 0xFD05FF64uL, 0xF6D2531DuL, 0x55FE8712uL,
+     0x6AB6B01CuL, 0x57CE04A9uL, 0x7CD93724uL, 0x69A02A89uL, 0xCF86699BuL, 0x4F82AC35uL, 0x9CB4B232uL, 0x8242D3ADuL},
+    {0x9BE47BE0uL, 0x69C43526uL, 0xCB28FEA1uL, 0x323B7DD8uL, 0x3A6C67E5uL, 0xFA5538BAuL, 0x1D378E46uL, 0xEF921D70uL,
+     0x3C4B880EuL, 0xF92961FCuL, 0x98940A67uL, 0x3F6F914EuL, 0xFEF0FF39uL, 0xA990EB0AuL, 0xF0EEFF9CuL, 0xA6C2920FuL},
+    {0x53FB2B56uL, 0xB23A03A5uL, 0x4E057F78uL, 0x6CE141E7uL, 0x89E490D9uL, 0x796525C3uL, 0xA31A7E75uL, 0x0BC95725uL,
+     0x1220FD06uL, 0x1EC56791uL, 0x408B0BD6uL, 0x716E3A3CuL, 0xE8EBEBA9uL, 0x31CD6BF7uL, 0xBEE6B670uL, 0xA7326CA6uL},
+
+    /* 16^26 * G */
+    {0xCF7D62D2uL, 0x20D3C982uL, 0x23BA8150uL, 0x1F36E29DuL, 0x92763F9EuL, 0x48AE0BF0uL, 0x1D3A7007uL, 0x7A527E6BuL,
+     0x581A85E3uL, 0xB4A89097uL, 0xDC158BE5uL, 0x1F1A520FuL, 0x167D726EuL, 0xF98DB37DuL, 0x1113E862uL, 0x8802786EuL},
+    {0x36F09AB0uL, 0xEFB2149EuL, 0x4A10BB5BuL, 0x03F163CAuL, 0x06E20998uL, 0xD0297045uL, 0x1B5A3BABuL, 0x56F0AF00uL,
+     0x70880E0DuL, 0x7AF4CFECuL, 0xBE3D913FuL, 0x7332A66FuL, 0x7ECEB4BDuL, 0x32E6C84AuL, 0x9C228F55uL, 0xEDC4A79AuL},
+    {0xF4C6B6ECuL, 0xF6E894D1uL, 0x18B3CD9BuL, 0x526B0827uL, 0x12117FBFuL, 0x73F952A8uL, 0x11945BF5uL, 0x2BE864B0uL,
+     0x42099B64uL, 0x86F18EA5uL, 0x07548CE2uL, 0x2770B28AuL, 0x295C1C9CuL, 0x97390F28uL, 0xCB5206C3uL, 0x672E6A43uL},
+    {0xC55C4496uL, 0xC37C7DD0uL, 0x25BBABD2uL, 0xA6A96357uL, 0xADD7F363uL, 0x5B7E63F2uL, 0x2E73F1DFuL, 0x9DCE3782uL,
+     0xB2B91F71uL, 0xE1E5A16AuL, 0x5BA0163CuL, 0xE4489823uL, 0xF6E515ADuL, 0xF2759C32uL, 0x8615EECFuL, 0xA5E2F1F8uL},
+    {0x47C64367uL, 0xCACCE2C8uL, 0x45AF4EC0uL, 0x6A496B9FuL, 0x6034042CuL, 0x2A0836F3uL, 0x0B6C62EAuL, 0x14A1F390uL,
+     0x3EF1F540uL, 0xE7FA9363uL, 0x72A76D93uL, 0xD323B30AuL, 0x0FEAE451uL, 0xFFEEC8B5uL, 0xBD04EF87uL, 0x4EAFC172uL},
+    {0xABDED551uL, 0x74519BE7uL, 0xC8B74410uL, 0x03D358B8uL, 0x0E10D9A9uL, 0x4D00B10BuL, 0x28DA52B7uL, 0x6392B0B1uL,
+     0x0B75C904uL, 0x6744A298uL, 0xA8F7F96CuL, 0xC305B0AEuL, 0x182CF932uL, 0x042E421DuL, 0x9E4636CAuL, 0xF6FC5D50uL},
+    {0xB3E59B89uL, 0xE4435A51uL, 0x4133A1C9uL, 0x13613955uL, 0x440BEE59uL, 0x87F46973uL, 0x00C401E4uL, 0x714710F8uL,
+     0xD6C446C9uL, 0xC0CF4BCEuL, 0x6C4D5368uL, 0xE0AA7FD6uL, 0xFC68FC37uL, 0xDE5D811AuL, 0xB7C2A057uL, 0x61FEBD72uL},
+    {0xD64CC78CuL, 0x795847C9uL, 0x9B6CB27BuL, 0x6C50621BuL, 0xDF8022ABuL, 0x07099BF8uL, 0xC04EDA1DuL, 0x48F862EBuL,
+     0xE1603C16uL, 0xD12732EDuL, 0x5C9A9450uL, 0x19A80E0FuL, 0xB429B4FCuL, 0xE2257F54uL, 0x45460515uL, 0x66D3B2C6uL},
+
+    /* 16^27 * G */
+    {0x453CADD6uL, 0x8DE2B7BCuL, 0xBC0BC1F8uL, 0x203900A7uL, 0xA6ABD3AFuL, 0xBCD86E47uL, 0x8502EFFBuL, 0x911CAC12uL,
+     0xEC965469uL, 0x2D550242uL, 0x29E0017EuL, 0x0E9F7692uL, 0x65979885uL, 0x633F078FuL, 0x4CF751EFuL, 0xFB87D449uL},
+    {0xD551EE10uL, 0x6066E2A2uL, 0x727E09A6uL, 0x87A8F1D8uL, 0x2C01148DuL, 0x00D08BABuL, 0x424F33FEuL, 0x6DA8E4F1uL,
+     0xCF9A4E71uL, 0x466D17F0uL, 0x3BF5CB19uL, 0xFF502010uL, 0xD062ECC0uL, 0xDCCF97D8uL, 0x81D80AC4uL, 0x80C0D9AFuL},
+    {0x1D7AADABuL, 0x1A0445FFuL, 0xD5F6A67CuL, 0x65D38260uL, 0x91CFB26FuL, 0x6E62FB08uL, 0x5C7D91D6uL, 0xEF1E0FA5uL,
+     0x33DB72CDuL, 0x47E7C7BAuL, 0xFA7C74B2uL, 0x017CBC09uL, 0xF50A503CuL, 0x3C931590uL, 0x616BAA42uL, 0xCAC54F60uL},
+    {0x1BF4581CuL, 0x98857CEBuL, 0xACA7B166uL, 0xE635E186uL, 0x659722ACuL, 0x278DDD22uL, 0x1DB68007uL, 0xA0903C4CuL,
+     0x48F21402uL, 0x366E4589uL, 0xB96ABDA2uL, 0x31B49C14uL, 0xE0403190uL, 0x329C4B09uL, 0xD29F43FEuL, 0x97197CA3uL},
+    {0x4B07E2B1uL, 0x7173DD5DuL, 0x8D9EA221uL, 0xD144C4CBuL, 0x1105AB14uL, 0xE8B04EA4uL, 0xFE80D8F1uL, 0x92DDA542uL,
+     0xCF03DCE6uL, 0xE9982FA8uL, 0x1A22CFFCuL, 0x8B5EA965uL, 0x3FAD88C4uL, 0xF7F4EA7FuL, 0x6A5BA95CuL, 0x62DB773EuL},
+    {0x820357C7uL, 0x18BD3FB4uL, 0x6F1458ADuL, 0x992039AEuL, 0x25B44AA1uL, 0x9A1DF3C5uL, 0xED3D5281uL, 0x2D780357uL,
+     0xC77AD4D4uL, 0x58CF7E4DuL, 0xF9DF4FC4uL, 0xD49A7998uL, 0x1D71205EuL, 0x4465A8B5uL, 0x649254AAuL, 0xA0EE0EA6uL},
+    {0x9C92B235uL, 0x4BAAE6E8uL, 0x6B3993A1uL, 0xA73BBD0EuL, 0x693DD031uL, 0xD06D60ECuL, 0x7156881CuL, 0x03CAB91BuL,
+     0x1DB3574BuL, 0xD615862FuL, 0x64BB061AuL, 0x485B0185uL, 0xA0181E06uL, 0x27434988uL, 0xC1C0C757uL, 0x2CD61AD4uL},
+    {0xF3480D4AuL, 0x03E2DE1CuL, 0xBC8ACF1AuL, 0xF0D8EDC7uL, 0x68295A9CuL, 0xF23E3303uL, 0xC546A97DuL, 0xFADD5F68uL,
+     0x96F8ACB1uL, 0x895597ADuL, 0x671BDAE2uL, 0xBDDD49D5uL, 0x21DD43F4uL, 0x16FCD528uL, 0x6619141AuL, 0xA5A45412uL},
+
+    /* 16^28 * G */
+    {0xC360E25AuL, 0x8CE9B6BFuL, 0x075A1A78uL, 0xE6425195uL, 0x481732F4uL, 0x9DC756A8uL, 0x5432B57AuL, 0x83C0440FuL,
+     0xD720281FuL, 0xC670B3F1uL, 0xD135E051uL, 0x2205910EuL, 0xDB052BE7uL, 0xDED14B0EuL, 0xC568EA39uL, 0x697B3D27uL},
+    {0xFB3FF9EDuL, 0x2E599B9AuL, 0x17F6515CuL, 0x28C2E0ABuL, 0x474DA449uL, 0x1CBEE4FDuL, 0x4F364452uL, 0x071279A4uL,
+     0x01FBE855uL, 0x97ABFF66uL, 0x5FDA51C4uL, 0x3EE394E8uL, 0x67597C0BuL, 0x190385F6uL, 0xA27EE34BuL, 0x6E9FCCC6uL},
+    {0x14092EBBuL, 0x0B89DE93uL, 0x428E240CuL, 0xF17256BDuL, 0x93D2F064uL, 0xCF89A7F3uL, 0xE1ED3B14uL, 0x4F57841EuL,
+     0xE708D855uL, 0x4EE14405uL, 0x03F1C3D0uL, 0x856AAE72uL, 0xBDD7EED5uL, 0xC8E5424FuL, 0x73AB4270uL, 0x3333E4EFuL},
+    {0xDDA492F8uL, 0x3BC77ADEuL, 0x78297205uL, 0xC11A3AEAuL, 0x34931B4CuL, 0x5E89A3E7uL, 0x9F5694BBuL, 0x17512E2EuL,
+     0x177BF8B6uL, 0x5DC349F3uL, 0x08C7FF3EuL, 0x232EA4BAuL, 0xF511145DuL, 0x9C4F9D16uL, 0x33B379C3uL, 0xCCF109A3uL},
+    {0xA1F25897uL, 0xE75E7A88uL, 0xA1B5D4D8uL, 0x7AC6961FuL, 0x08F3ED5CuL, 0xE3E10773uL, 0x0A892DFBuL, 0x208A54ECuL,
+     0x78660710uL, 0xBE826E19uL, 0x237DF2C8uL, 0x0CF70A97uL, 0xED704DA5uL, 0x418A7340uL, 0x08CA33FDuL, 0xA3EEB9A9uL},
+    {0x169BCA96uL, 0x49D96233uL, 0x2DA6AAFBuL, 0x04D286D4uL, 0xA0C2FA94uL, 0xC09606ECuL, 0x23FF0FB3uL, 0x8869D0D5uL,
+     0xD0150D65uL, 0xA99937E5uL, 0x240C14C9uL, 0xA92E2503uL, 0x108E2D49uL, 0x656BF945uL, 0xA2F59E2BuL, 0x152A733AuL},
+    {0x8434A920uL, 0xB4323D58uL, 0x622103C5uL, 0xC0AF8E93uL, 0x938DBF9AuL, 0x667518EFuL, 0x83A9CDF2uL, 0xA1843073uL,
+     0x5447AB80uL, 0x350A94AAuL, 0xC75A3D61uL, 0xE5E5A325uL, 0x68411A9EuL, 0x74BA507FuL, 0x594F70C5uL, 0x10581FC1uL},
+    {0x80EB24A9uL, 0x60E28570uL, 0x488E0CFDuL, 0x7BEDFB4DuL, 0xC259CDB8uL, 0x721EBBD7uL, 0xBC6390A9uL, 0x0B0DA855uL,
+     0xDE314C70uL, 0x2B4D04DBuL, 0x6C32E846uL, 0xCDBF1FBCuL, 0xB162FC9EuL, 0x33833EABuL, 0xB0DD3AB7uL, 0x9939B48BuL},
+
+    /* 16^29 * G */
+    {0x711B0EB9uL, 0x96892C1FuL, 0x780AB954uL, 0xB905F2C8uL, 0xA20792DBuL, 0xACE26309uL, 0x0684E126uL, 0xEC8AC9B3uL,
+     0xB40A2447uL, 0x486AD8B6uL, 0x9FE3FB24uL, 0x60121FC1uL, 0x1A8E3B3FuL, 0x5626FCCFuL, 0x6AD1F394uL, 0x4E568622uL},
+    {0x4A8A3D62uL, 0x5A4B46C6uL, 0x247743D2uL, 0x8469C4D0uL, 0x88F7E433uL, 0x2BB3A13DuL, 0x01BE5849uL, 0x62B23A10uL,
+     0xA63D1A4CuL, 0xE83596B4uL, 0x7D183F3EuL, 0x454E7FEAuL, 0x17AFB01CuL, 0x643FCE61uL, 0x1C4C3638uL, 0x4E65E5E6uL},
+    {0x6ADD8545uL, 0xE5DB7717uL, 0x72C49B66uL, 0x1B71CB66uL, 0x68421D77uL, 0xD8560739uL, 0x83E3AFEAuL, 0x03840FE8uL,
+     0x1EC69977uL, 0xB391DAD5uL, 0x307F6726uL, 0xAE243FB9uL, 0xE8CA160CuL, 0xC88AC87BuL, 0x4CE355F4uL, 0x5174CCEDuL},
+    {0xCBC613E5uL, 0xC1E17EB6uL, 0x497EA61CuL, 0x33131D55uL, 0xAF7EDED5uL, 0x2F69D39EuL, 0xDE6AF11BuL, 0x73C2F434uL,
+     0xA4A375FAuL, 0x4CA52493uL, 0xB833C5C2uL, 0x5F06787CuL, 0x3E6E71CFuL, 0x814E091FuL, 0x8B746666uL, 0x76451F57uL},
+    {0x95FE1347uL, 0x5EE6AB84uL, 0x6F24503CuL, 0xAB0F6C39uL, 0x4486DD6BuL, 0x807E3FFBuL, 0x8002FEF5uL, 0xF00B6C74uL,
+     0xA7862999uL, 0x48BFF9A6uL, 0xBED89E26uL, 0x85E5A06CuL, 0x3D8419EBuL, 0x86D311AFuL, 0x34733F16uL, 0x24F3AD78uL},
+    {0x6C68D687uL, 0x5E3E03FCuL, 0x1FF052C7uL, 0x3E732C3DuL, 0x6ED16E7AuL, 0xF2D0EFA6uL, 0xB65BB746uL, 0x63D92B26uL,
+     0xDD44867CuL, 0xFFCD82BAuL, 0xF8C081B8uL, 0xA71B4A9EuL, 0x736C8785uL, 0x6C1676A7uL, 0x9D8932D0uL, 0xBE2C0616uL},
+    {0x2BCFFBC4uL, 0x53376D28uL, 0x06EADB7AuL, 0x708817A7uL, 0xCD35AE69uL, 0x6FF50E05uL, 0x74BC7FDEuL, 0x63B5FB75uL,
+     0xE7FE08C4uL, 0x71C9E953uL, 0xF583CA18uL, 0xB4D8BFD4uL, 0x45E81C5CuL, 0xDE8D7882uL, 0xE0474138uL, 0xA5F5E93CuL},
+    {0x694DB7E0uL, 0x80F9BDEFuL, 0xB9FCDDC6uL, 0xEDCA8787uL, 0x03B8DCE1uL, 0x51981C34uL, 0x70E10BA1uL, 0x4274DCF1uL,
+     0x6DEF6D1AuL, 0xF72743B8uL, 0xEBDB1866uL, 0xD25B1670uL, 0x050C6F58uL, 0xC4491E8CuL, 0x87FBD7F5uL, 0x2BE2B2ABuL},
+
+    /* 16^30 * G */
+    {0xD111F8ECuL, 0x3E0E5C9DuL, 0xB7C4E760uL, 0xBCC33F8DuL, 0xBD392A51uL, 0x702F9A91uL, 0xC132E92DuL, 0x7DA4A795uL,
+     0x0BB1151BuL, 0x1A0B0AE3uL, 0x02E32251uL, 0x54FEBAC8uL, 0x694E9E78uL, 0xEA3A5082uL, 0xE4FE40B8uL, 0xE58FFEC1uL},
+    {0x29C4120BuL, 0xFBB8349DuL, 0xC0D0D915uL, 0x9F94391FuL, 0x5410BA51uL, 0xC4074FA7uL, 0x150A5911uL, 0xA66ADBF6uL,
+     0x34BFCA38uL, 0xC164543CuL, 0xB9E1CCFCuL, 0xE0F27560uL, 0xE820219CuL, 0x99DA0F53uL, 0xC6B4997AuL, 0xE8234498uL},
+    {0x516E19E4uL, 0x7B23C513uL, 0xC5C4D593uL, 0x56E2E847uL, 0x5CE71EF6uL, 0x9F727D73uL, 0xF79A44C5uL, 0x5B6304A6uL,
+     0x3AB7E433uL, 0x6638A736uL, 0xFE742F83uL, 0x1ADEA470uL, 0x5B7FC19FuL, 0xE054B854uL, 0xBA1D0698uL, 0xF935381AuL},
+    {0x918E4936uL, 0xB5504F9DuL, 0xB2513982uL, 0x65035EF6uL, 0x6F4D9CB9uL, 0x0553A0C2uL, 0xBEA85509uL, 0x6CB10D56uL,
+     0xA242DA11uL, 0x48D957B7uL, 0x672B7268uL, 0x16A4D3DDuL, 0x8502A96BuL, 0x3D7E637CuL, 0x730D463BuL, 0x27C7032BuL},
+    {0x5846426FuL, 0x55366B7DuL, 0x247D441DuL, 0xE7D09E89uL, 0x736FBF48uL, 0x510B404DuL, 0xE784BD7DuL, 0x7FA003D0uL,
+     0x17FD9596uL, 0x25F7614FuL, 0x35CB98DBuL, 0x49E0E0A1uL, 0x2E83A76AuL, 0x2C65957BuL, 0xCDDBE0F8uL, 0x5D40DA8DuL},
+    {0xA595939DuL, 0x37F68BB4uL, 0x28740217uL, 0x03556479uL, 0x84AD7612uL, 0x8E740E7CuL, 0x9044695FuL, 0xD89BC843uL,
+     0x85A9184DuL, 0xF7F3DA5DuL, 0x9FC0B074uL, 0x562563BBuL, 0xF88A888EuL, 0x06D2E6AAuL, 0x161FBE7CuL, 0x612D8643uL},
+    {0x54530BB2uL, 0x9FB3BBA3uL, 0xCB0869EAuL, 0xBDE3EF77uL, 0x0B431163uL, 0x89BC9046uL, 0xE4819A35uL, 0x4D03D7D2uL,
+     0x43B6A782uL, 0x33AE4F9EuL, 0x9C88A686uL, 0x216DB307uL, 0x00FFEDD9uL, 0x91DD88E0uL, 0x12BD4840uL, 0xB280DA9FuL},
+    {0x3E538CD7uL, 0x458F8691uL, 0x8E08AD53uL, 0xA7001F6CuL, 0xBF5D15FFuL, 0x52B8C6E6uL, 0x011215DDuL, 0x548234A4uL,
+     0x3D5B4045uL, 0xFF5A9D2DuL, 0x4A904190uL, 0xB0FFEEB6uL, 0x48607F8BuL, 0x55A3ACA4uL, 0x30A0672AuL, 0x8CBD665CuL},
+
+    /* 16^31 * G */
+    {0x33F6746CuL, 0xC7F3A8F8uL, 0xFEA990CAuL, 0x21E46F65uL, 0xCADDB0A9uL, 0x915FD5C5uL, 0x78614555uL, 0xBD41F016uL,
+     0x426FFB58uL, 0x346F4434uL, 0x14DBC204uL, 0x80559436uL, 0x5A969B7FuL, 0xF3DD20FEuL, 0xE899A39AuL, 0x9D59E956uL},
+    {0xB733AA5FuL, 0x3C2F0BA9uL, 0xF05AF235uL, 0xDECE47CBuL, 0xA2AC82A5uL, 0xF8E3F715uL, 0x2203F18AuL, 0xC97BA641uL,
+     0x09C11060uL, 0xC3AF5504uL, 0x46AF512DuL, 0x56EA2C05uL, 0xF3F28146uL, 0xFAC28DAFuL, 0x959EF494uL, 0x87FAB43AuL},
+    {0x775D6ECEuL, 0xEF4F115CuL, 0xE8C0E78DuL, 0x69D2E3BBuL, 0x145CFC81uL, 0xB0264EF1uL, 0x1B69788BuL, 0x0A41E9FAuL,
+     0x909A1F0BuL, 0x0D9233BEuL, 0x0AE76B30uL, 0x150A8452uL, 0x0632BB69uL, 0xEA337537uL, 0xAA25584AuL, 0x15F7B3CFuL},
+    {0xD4C5105FuL, 0x09891641uL, 0x6D7FBD65uL, 0x1AE80F8EuL, 0xBEE6BDB0uL, 0x9D67225FuL, 0x7FC4D860uL, 0x3B433B59uL,
+     0x93E85638uL, 0x44E66DB6uL, 0xE3E9862FuL, 0xF7B59252uL, 0x665C32ECuL, 0xDB785157uL, 0xAE362F50uL, 0x702FEFD7uL},
+    {0x1339609AuL, 0x6EB4A914uL, 0x3E37EABDuL, 0x2B627DEEuL, 0x728C8D9CuL, 0xEA4083D1uL, 0x518F21E4uL, 0xE70814D4uL,
+     0x17398D14uL, 0x4CB05B57uL, 0x8003F6C9uL, 0x9D37D255uL, 0x60829275uL, 0x70577AF7uL, 0xC67D7E4FuL, 0xCB4A9A9AuL},
+    {0x97290293uL, 0xFE756A5CuL, 0xD388ACBFuL, 0xBF04A19CuL, 0x5E916BDAuL, 0xFBBBB9CFuL, 0x91F93BECuL, 0xF4895273uL,
+     0x2A5923D7uL, 0xDEE07EC3uL, 0xFDE0C370uL, 0xC7BC949BuL, 0x0419D8FCuL, 0xBD512175uL, 0x3FDCC93FuL, 0x54F5D476uL},
+    {0xD13FB27DuL, 0xC20F05F7uL, 0x6C7195C0uL, 0xC05B30D3uL, 0x32FC56C5uL, 0xA335CF18uL, 0x62B3A82BuL, 0xAE65BCD3uL,
+     0x630D99EAuL, 0xCBF6AAB8uL, 0xE62CEC6CuL, 0x164BE816uL, 0x2FEED2F1uL, 0x6D41819DuL, 0x0B91BD0DuL, 0xFCDC5907uL},
+    {0x0FEFB0C3uL, 0x3754475DuL, 0x46D7C35DuL, 0xD48FB56BuL, 0x363798A4uL, 0xA070B633uL, 0x8FDB98E6uL, 0xAE89F3D2uL,
+     0x6363D14CuL, 0x970B89C8uL, 0x67ABD27DuL, 0x89817521uL, 0x44D5A021uL, 0x9BF7D474uL, 0xCAC72AEEuL, 0xB3083BAFuL},
+
+    /* 16^32 * G */
+    {0xBFE20925uL, 0x62A8C244uL, 0x8FDCE867uL, 0x91C19AC3uL, 0xDD387063uL, 0x5A96A5D5uL, 0x21D324F6uL, 0x61D587D4uL,
+     0xA37173EAuL, 0xE87673A2uL, 0x53778B65uL, 0x23848008uL, 0x05BAB43EuL, 0x10F8441EuL, 0x4621EFBEuL, 0xFA11FE12uL},
+    {0xB8A24A20uL, 0x23F949FEuL, 0xF52CA53FuL, 0x17EBFED1uL, 0xBCFB4853uL, 0x9B691BBEuL, 0x6278A05DuL, 0x5617FF6BuL,
+     0xE3C99EBDuL, 0x241B34C5uL, 0x1784156AuL, 0xFC64242EuL, 0x695D67DFuL, 0x4206482FuL, 0xEE27C011uL, 0xB967CE0EuL},
+    {0xB2335834uL, 0xC0F734A3uL, 0x90EF6860uL, 0x9526205AuL, 0x04E2BB0DuL, 0xCB8BE717uL, 0x02F383FAuL, 0x2418871EuL,
+     0x4082C157uL, 0xD7177681uL, 0x29C20073uL, 0xCC914AD0uL, 0xE587E728uL, 0xF186C1EBuL, 0x61BCD5FDuL, 0x6FDB3C22uL},
+    {0x41C23FA3uL, 0xB4480F04uL, 0xC1989A2EuL, 0xB4712EB0uL, 0x93A29CA7uL, 0x3CCBBA0FuL, 0xD619428CuL, 0x6E205C14uL,
+     0xB3641686uL, 0x90DB7957uL, 0x45AC8B4EuL, 0x0432691DuL, 0xF64E0350uL, 0x07A759ACuL, 0x9C972517uL, 0x0514D89CuL},
+    {0x2CF9D7C1uL, 0xCC7C4C1CuL, 0xEE95E5ABuL, 0x1320886AuL, 0xBEAE170CuL, 0xBB7B9056uL, 0xDBC0D662uL, 0xC8A5B250uL,
+     0xC11D2303uL, 0x4ED81432uL, 0x1F03769FuL, 0x7DA66912uL, 0x84539828uL, 0x3AC7A5FDuL, 0x3BCCDD02uL, 0x14DADA94uL},
+    {0xF0DCBC49uL, 0x7BB4F7AAuL, 0x70BBB45BuL, 0x7DE551F9uL, 0x9F2CA2E5uL, 0xCFD0F3E4uL, 0x1F5C76EFuL, 0xECE58709uL,
+     0x167D79AEuL, 0x32920EDDuL, 0xFA7D7EC1uL, 0x039DF8A2uL, 0xBB30AF91uL, 0xF46206C0uL, 0x22676B59uL, 0x1FF5E2F5uL},
+    {0xCBAE2F70uL, 0x51B90651uL, 0x93AAA8EBuL, 0xEFC4BC05uL, 0xDD1DF499uL, 0x8ECD8689uL, 0x22F367A5uL, 0x1AEE99A8uL,
+     0xAE8274C5uL, 0x95D485B9uL, 0x7D30B39CuL, 0x6C14D445uL, 0xBCC1EF81uL, 0xBAFEA90BuL, 0xA459A2EDuL, 0x7C5F317AuL},
+    {0xC4FE3C39uL, 0xE3B22C6BuL, 0x6C7BEBDFuL, 0xBA4A8153uL, 0x25693459uL, 0xF23AB6B7uL, 0x14922B11uL, 0x53BC3770uL,
+     0x5AFC60DBuL, 0x4645C8ABuL, 0x20B9F2A3uL, 0xAA022355uL, 0xCE0FC507uL, 0x52A2954CuL, 0x7CE1C2E7uL, 0x8C2731BBuL},
+
+    /* 16^33 * G */
+    {0xE48FB889uL, 0x6A7091C2uL, 0x7B8A9D06uL, 0x26882C13uL, 0x1B82A0E2uL, 0xA2498663uL, 0x3518152DuL, 0x844ED736uL,
+     0xD86E27C7uL, 0x282F476FuL, 0x04AFEFDCuL, 0xA04EDACAuL, 0x6119E34DuL, 0x8B256EBCuL, 0x0787D78BuL, 0x56A413E9uL},
+    {0x5A74BE50uL, 0x82EE061DuL, 0xDEA16FF5uL, 0xE41781C4uL, 0x99BFC8A2uL, 0xE0B0C81EuL, 0x0B547E2DuL, 0x624F4D69uL,
+     0xBDCC9AE4uL, 0x3A83545DuL, 0x409B1E8EuL, 0x2573DBB6uL, 0xA6C93539uL, 0x482960C4uL, 0x5AE18798uL, 0xF01059ADuL},
+    {0x4D559D96uL, 0x38151E27uL, 0xB8DB6C01uL, 0x4F18C0D3uL, 0x6F9921AFuL, 0x49A3AA83uL, 0x8C046029uL, 0xDBEAB27BuL,
+     0x7040BF3BuL, 0x242B9EAAuL, 0x1614B091uL, 0x39C479E5uL, 0x0E4BAF5DuL, 0x338EDE2BuL, 0xF0A53945uL, 0x5BB192B7uL},
+    {0x3112795FuL, 0x715C9F97uL, 0x984E6EE1uL, 0xE8244437uL, 0xECB66BCDuL, 0x55CB4858uL, 0xABAFFBEEuL, 0x7C136735uL,
+     0x5DBEC38EuL, 0x54661595uL, 0x388AD153uL, 0x51C0782CuL, 0xC6E0952FuL, 0x9BA4C53AuL, 0x1B21DFA8uL, 0x27E6782AuL},
+    {0xEC5D7F65uL, 0x7D89C251uL, 0x90394087uL, 0x0C8F5616uL, 0xF0691AB3uL, 0x609E1CFCuL, 0xE9B20B21uL, 0x2A0300BFuL,
+     0xB114FAF4uL, 0xBF532FADuL, 0x521BF5D1uL, 0x328FC0B9uL, 0x3BFC36DEuL, 0xBD51F93CuL, 0x7A4E5F60uL, 0xD989050EuL},
+    {0x4ED2DBC2uL, 0x682F903DuL, 0x7C3B2D83uL, 0x0EBA59C8uL, 0x9C7E9335uL, 0x8E9DC84DuL, 0x0EB226D7uL, 0x5F9B21B0uL,
+     0xAF267BAEuL, 0xE33BD394uL, 0xBE2E15AEuL, 0xAA86CC25uL, 0x6A8EC500uL, 0x4F0BF67DuL, 0xF9630658uL, 0x5846AA44uL},
+    {0xE7E0C278uL, 0x6786BA38uL, 0x588B2E6FuL, 0x09BF87CEuL, 0x465FEE3AuL, 0x723B7022uL, 0x64682394uL, 0x08B84114uL,
+     0x29E64629uL, 0x0EB52CE0uL, 0xCCA78E43uL, 0xADB60E8FuL, 0xB654A991uL, 0x20DD7062uL, 0xC69A6FE5uL, 0x4281D428uL},
+    {0xE2C2BF15uL, 0xFEB09740uL, 0xA9E99704uL, 0x627A2205uL, 0xC2FBC565uL, 0xEC8D73D0uL, 0xC20C8DE8uL, 0x223EED8FuL,
+     0xA8363B49uL, 0x1EE32583uL, 0xC9C2B0A6uL, 0x1A0B6CB9uL, 0x90DBC85CuL, 0x49F7C3D2uL, 0x1EF4C1ACuL, 0xA8DFBB97uL},
+
+    /* 16^34 * G */
+    {0x846E364FuL, 0xC16C236EuL, 0xDEA50CA0uL, 0x7F33527CuL, 0x0926B86DuL, 0xC4810775uL, 0x0598E70CuL, 0x6C2A3609uL,
+     0xF024E924uL, 0xA6755E52uL, 0x9DB4AFCAuL, 0xE0FA07A4uL, 0x66831790uL, 0x15C3CE7DuL, 0xA6CBB0D6uL, 0x5B4EF350uL},
+    {0x0F15DDE9uL, 0x05214C05uL, 0x0D5F2B82uL, 0xA47A76A8uL, 0x62E82B62uL, 0xBB254D30uL, 0x3EC955EEuL, 0x11A05FE0uL,
+     0x9D529B36uL, 0x7EAFF46EuL, 0x8F9E3DF6uL, 0x55AB1301uL, 0x99317698uL, 0xC463E371uL, 0xCCDA47ADuL, 0xFD251438uL},
+    {0xA9D82ABFuL, 0xE2A37598uL, 0xE6C170F5uL, 0x5F188CCBuL, 0x5066B087uL, 0x81682200uL, 0xC7155ADAuL, 0xDA22C212uL,
+     0xFBDDB479uL, 0x151E5D3AuL, 0x6D715B99uL, 0x4B606B84uL, 0xF997CB2EuL, 0x4A73B54BuL, 0x3ECD8B66uL, 0x9A1BFE43uL},
+    {0xDBFB894EuL, 0xE13122F3uL, 0xCE274B18uL, 0xBE9B79F6uL, 0xCA58AADFuL, 0x85A49DE5uL, 0x11487351uL, 0x24957758uL,
+     0xBB939099uL, 0x111DEF61uL, 0x26D13694uL, 0x1D6A974AuL, 0xD3FC253BuL, 0x4474B4CEuL, 0x4C5DB15EuL, 0x3A1485E6uL},
+    {0x1430C9ABuL, 0x5AFDDAB6uL, 0x2238E997uL, 0x0BDD41D3uL, 0x418042AEuL, 0xF0947430uL, 0xCDDDC4CBuL, 0x71F9ADDAuL,
+     0xC52DD907uL, 0x7090C016uL, 0x29E2047FuL, 0xD9BDF44DuL, 0x1B1011A6uL, 0xE6F1FE80uL, 0xD9ACDC78uL, 0xB63ACCBCuL},
+    {0x4BAEF62EuL, 0x7817ACABuL, 0xA85B91E8uL, 0x9F5A2202uL, 0x6CE57610uL, 0x9666EBE6uL, 0xF73BFE03uL, 0x32AD31F3uL,
+     0x25BCF4D6uL, 0x628330A4uL, 0x515056E6uL, 0xEA950593uL, 0xE1332156uL, 0x59811C89uL, 0x8C11B2D7uL, 0xC89CF1FEuL},
+    {0xC0B7EFF3uL, 0x0AD7337AuL, 0xC5E48B3CuL, 0x8552225EuL, 0x73F13A5FuL, 0xE6F78B0CuL, 0x82349CBEuL, 0x5E70062EuL,
+     0xE7073969uL, 0x6B8D5048uL, 0xC33CB3D2uL, 0x392D2A29uL, 0x4ECAA20FuL, 0xEE4F727CuL, 0x2CCDE707uL, 0xA068C99EuL},
+    {0x1ED66F18uL, 0xEBDE86ECuL, 0xD61FCE43uL, 0x225D906BuL, 0xE8BED74DuL, 0x5CAB07D6uL, 0x27855AB7uL, 0x16E4617FuL,
+     0xB2FBC3DDuL, 0x6568AADDuL, 0x8AEDDF5BuL, 0xEDB5484FuL, 0x6DCF2FADuL, 0x878F20E8uL, 0x615F5699uL, 0x3516497CuL},
+
+    /* 16^35 * G */
+    {0xFA181E69uL, 0xEF0A3FECuL, 0x30D69A98uL, 0x9EA02F81uL, 0x66EAB95DuL, 0xB2E9CF8EuL, 0x24720021uL, 0x520F2BEBuL,
+     0x1DF84361uL, 0x621C540AuL, 0x71FA6D5DuL, 0x12037721uL, 0x0FF5F6FFuL, 0x6E3C7B51uL, 0xABB2BEF3uL, 0x817A069BuL},
+    {0xB294CDA6uL, 0x83572FB6uL, 0xB9039F34uL, 0x6CE9BF75uL, 0x095CBB21uL, 0x20E012F0uL, 0xD063F0DAuL, 0xA0AECC1BuL,
+     0xF02909E5uL, 0x57C21C3AuL, 0x48CE9CDCuL, 0xC7D59ECFuL, 0x8AE336F8uL, 0x2732B844uL, 0x3F4F85F4uL, 0x056E3723uL},
+    {0x89E800CAuL, 0x8A10B531uL, 0x145208FDuL, 0x50FE0C17uL, 0xB714BA37uL, 0x9E43C0D3uL, 0x34189ACCuL, 0x427D200EuL,
+     0xE616E2C0uL, 0x05DEE24FuL, 0xEE1854C1uL, 0x9C25F4C8uL, 0x8F342A73uL, 0x4D3222A5uL, 0xA027C952uL, 0x0807804FuL},
+    {0x4F0D56F3uL, 0xC222653AuL, 0xCA28B805uL, 0x961E4047uL, 0x4A73434BuL, 0x2C03F8B0uL, 0xAB712A19uL, 0x4C966787uL,
+     0x864FEE42uL, 0xCC196C42uL, 0x5B0ECE5CuL, 0xC1BE93DAuL, 0xC131C159uL, 0xA87D9F22uL, 0xDCE45655uL, 0x2BB6D593uL},
+    {0xB809B7CEuL, 0x22C49EC9uL, 0xE2C72C2CuL, 0x8A41486BuL, 0xFEA0BF36uL, 0x813B9420uL, 0xA66DAC69uL, 0xB3D36EE9uL,
+     0x328CC987uL, 0x6FDDC08AuL, 0x3A326461uL, 0x0A3BCD2CuL, 0xD810DBBAuL, 0x7103C49DuL, 0x4B78A4C4uL, 0xF9D81A28uL},
+    {0xE4D55941uL, 0x3DE865ADuL, 0x30384087uL, 0xDEDAFA5EuL, 0x4EF18B9BuL, 0x6F414ABBuL, 0xFAEE5268uL, 0x9EE9EA42uL,
+     0x37A55A4AuL, 0x260FAA16uL, 0x015F93B9uL, 0xEB19A514uL, 0x9E9C3598uL, 0x51D7EBD2uL, 0x1932178EuL, 0x523FC56DuL},
+    {0xB98FE684uL, 0x501D070CuL, 0x124A1458uL, 0xD60FBE9AuL, 0x92BC6B3FuL, 0xA45761C8uL, 0xFE6F27CBuL, 0xF5384858uL,
+     0xB59E763BuL, 0x4B0271F7uL, 0x5B5A8E5EuL, 0x3D4606A9uL, 0x05A48292uL, 0x1EDA5D9BuL, 0xE6FEC446uL, 0xDA7731D0uL},
+    {0x90D45871uL, 0xA3E33693uL, 0x06166D8DuL, 0xE9764040uL, 0x89A90403uL, 0xB5C33682uL, 0x72F1D637uL, 0x4BD17983uL,
+     0xD5D2C53AuL, 0xA616679EuL, 0xFDCF3B87uL, 0x5EC4BCD8uL, 0xB66A694EuL, 0xAE6D7613uL, 0xE3FC27E5uL, 0x7460FC76uL},
+
+    /* 16^36 * G */
+    {0xC63C4962uL, 0x80531FE1uL, 0x981FDB25uL, 0x50541E89uL, 0xFD4C2B6BuL, 0xDC1291A1uL, 0xA6DF4FCAuL, 0xC0693A17uL,
+     0x0117F203uL, 0xB2C4604EuL, 0x0A99B8D0uL, 0x245F1963uL, 0xC6212C44uL, 0xAEDC20AAuL, 0x520F52A8uL, 0xB1ED4E56uL},
+    {0x700A1ACDuL, 0xB5560FB6uL, 0xFD999681uL, 0xE823FD73uL, 0x6CB4E1BAuL, 0xDA915D1FuL, 0x6EBE00A3uL, 0x0D030118uL,
+     0x89FCA8CDuL, 0x744FB0C9uL, 0xF9DA0E0BuL, 0x970D01DBuL, 0x7931D76FuL, 0x0AD8C564uL, 0xF659B96AuL, 0xB15737BFuL},
+    {0x6BDF22DAuL, 0x18F37A9CuL, 0x90DC82DFuL, 0xEFBC432FuL, 0x5D703651uL, 0xC52CEF8EuL, 0xD99881A5uL, 0x82887BA0uL,
+     0xB920EC1DuL, 0x7CEC9DDAuL, 0xEC3E8D3BuL, 0xD0D7E8C3uL, 0x4CA88747uL, 0x445BC395uL, 0x9FD53535uL, 0xEDEAA2E0uL},
+    {0xCE53C2D0uL, 0xA12B384EuL, 0x5E4606DAuL, 0x779D897DuL, 0x73EC12B0uL, 0xA53E47B0uL, 0x5756F1ADuL, 0x462DBBBAuL,
+     0xCAFE37B6uL, 0x69FE09F2uL, 0xECCE2E17uL, 0x273D1EBFuL, 0x3CF607FDuL, 0x8AC1D538uL, 0x12E10C25uL, 0x8035F7FFuL},
+    {0x296C9005uL, 0xB7D4CC0FuL, 0x7B0AEBDBuL, 0x4B9094FAuL, 0xC00EC8D4uL, 0xE1BF10F1uL, 0xD667C101uL, 0xD807B1C4uL,
+     0xBE713383uL, 0xA9412CDFuL, 0x81142BA1uL, 0x435E063EuL, 0xAF0A6BDCuL, 0x984C15ECuL, 0x92A3DAB9uL, 0x592C2460uL},
+    {0x2093C22AuL, 0xCA442D5AuL, 0xD5703AEDuL, 0xEBD0BD31uL, 0x653287B6uL, 0x308F2AFDuL, 0x0D1BC8BAuL, 0x9BB88BACuL,
+     0x75C1E3B2uL, 0xFBAF8538uL, 0xCA11447CuL, 0xBD2AC950uL, 0xEA5C4C8DuL, 0x286D816CuL, 0x28DC3208uL, 0xDC3AA800uL},
+    {0x16E23E9DuL, 0x93656900uL, 0xA7CC41E1uL, 0xCB220C6BuL, 0x69D6245CuL, 0xB36B20C3uL, 0xB62E9A6AuL, 0x2D63C348uL,
+     0xCDC0BCB5uL, 0xA3473E19uL, 0x8F601B98uL, 0x70F18B3FuL, 0xCDE346E4uL, 0x8AD7A2C7uL, 0xBD3AAA64uL, 0xAE9F6EC3uL},
+    {0x7E6C5520uL, 0x854D34C7uL, 0xDCB9EA58uL, 0xC27DF9EFuL, 0xD686666DuL, 0x405F2369uL, 0x0417AA85uL, 0x29D1FEBFuL,
+     0x93470AFEuL, 0x9846819EuL, 0xE2A27F9EuL, 0x3E6A9669uL, 0xE31E6504uL, 0x24D008A2uL, 0x9CB7680AuL, 0xDBA7CECFuL},
+
+    /* 16^37 * G */
+    {0x338D6E43uL, 0xECAFF541uL, 0x4541D5CCuL, 0x56F7DD73uL, 0x96BC88CAuL, 0xB5D426DEuL, 0x9ED3A2C3uL, 0x48D94F6BuL,
+     0x2EF8279CuL, 0x6354A3BBuL, 0x0B1867F2uL, 0xD575465BuL, 0x95225151uL, 0xEF99B0FFuL, 0xF94500D8uL, 0xF3E19D88uL},
+    {0x51EFB310uL, 0x0D0DF6CEuL, 0x958DF5BEuL, 0xCB5B2EB4uL, 0x36158E59uL, 0xD6459E29uL, 0x1466E336uL, 0x82AAE2B9uL,
+     0x411AA636uL, 0xFB658A39uL, 0xD4C0A933uL, 0x7152ECC5uL, 0x49F026B7uL, 0xF10C758AuL, 0xCB09311FuL, 0xF4837F97uL},
+    {0xB71698F5uL, 0x7807F364uL, 0x9F7B605EuL, 0x6BA418D2uL, 0xA03B2CBBuL, 0xFD20B00FuL, 0xDA54386FuL, 0x883ECA37uL,
+     0xF3437F24uL, 0xFF0BE43FuL, 0xA48BB33CuL, 0xE910B432uL, 0x329DF765uL, 0x4963A128uL, 0xBE2FE6F7uL, 0xAC1DD556uL},
+    {0x626332D5uL, 0x994F523AuL, 0x5561BB44uL, 0x7BC38833uL, 0x3D845EA2uL, 0x005ED4B0uL, 0xC2A1F08AuL, 0xD39D3EE1uL,
+     0xE7676B0DuL, 0x6561FDD3uL, 0xFB706017uL, 0x620E35FFuL, 0xF264F9A8uL, 0x36CE424FuL, 0xDA2681F7uL, 0xC4C3419FuL},
+    {0xF405FF06uL, 0x1C30861CuL, 0x486E828BuL, 0xEBAC86BDuL, 0x636933FCuL, 0xE791A971uL, 0x7AEEE947uL, 0x50E7C2BEuL,
+     0xFA90D767uL, 0xC3D4A095uL, 0xE670AB7BuL, 0xAE60EB7BuL, 0x397B056DuL, 0x17633A64uL, 0x105012AAuL, 0x93A21F33uL},
+    {0x369B87ADuL, 0x857C1F22uL, 0x32FCA556uL, 0x3C00E5D9uL, 0x90B06466uL, 0x1AD74CABuL, 0x550FAAF2uL, 0xA7112386uL,
+     0x6D9BD5F5uL, 0x7435E198uL, 0x59C3463FuL, 0x2DCC7E38uL, 0xCA7BD4B2uL, 0xDC7DF748uL, 0x9DEC2F31uL, 0x13CD4C08uL},
+    {0x22CAF46BuL, 0x5936E460uL, 0x9A96FE4FuL, 0x6A45DD8FuL, 0xB98F474EuL, 0xF7925434uL, 0x0053EF15uL, 0x41410412uL,
+     0x41DE97BFuL, 0x71CF8D12uL, 0xBD80BEF4uL, 0xB8547B61uL, 0xC4DB0037uL, 0xB47D3970uL, 0xFEF20DFFuL, 0xF1BCD328uL},
+    {0x9BB81648uL, 0x00F83176uL, 0x653120D0uL, 0xD69EB485uL, 0x4CCABC62uL, 0xD17D75F4uL, 0xB749FCB1uL, 0x34A07F82uL,
+     0xBBFB5554uL, 0x2C3AF787uL, 0x62E283F8uL, 0xB06ED4D0uL, 0xA19213A0uL, 0x5722889FuL, 0xDCF3C7B4uL, 0x162B085EuL},
+
+    /* 16^38 * G */
+    {0x7189E71FuL, 0x32670D2FuL, 0x5ECF91E7uL, 0xC6438748uL, 0xDB757A21uL, 0x15758E57uL, 0x290A9CE5uL, 0x427D09F8uL,
+     0x38384A7AuL, 0x846A308FuL, 0xB0732B99uL, 0xAAC3ACB4uL, 0x17845819uL, 0x9E941009uL, 0xA7CE5E03uL, 0x95CBA111uL},
+    {0xAACA5E9BuL, 0x97B7851AuL, 0x56713B97uL, 0x518AA521uL, 0x150A61F6uL, 0x3357E8C7uL, 0xEC2C2B69uL, 0x7842E7E2uL,
+     0x6868A548uL, 0x8DFFAF65uL, 0xE068FC81uL, 0xD963BD82uL, 0x65917733uL, 0x64DA5C8BuL, 0x7B247328uL, 0x927090FFuL},
+    {0xA105FC8EuL, 0x37A01E48uL, 0x289BA48CuL, 0x769D754AuL, 0xD51C2180uL, 0xC08C6FE1uL, 0xB7BD1387uL, 0xB032DD33uL,
+     0x020B0AA6uL, 0x953826DBuL, 0x0664C73CuL, 0x05137E80uL, 0x660CF95DuL, 0xC66302C4uL, 0xB2CEF28AuL, 0x99004E11uL},
+    {0xD298C241uL, 0x214BC9A7uL, 0x56807CFDuL, 0xE3B697BAuL, 0x4564EADBuL, 0xEF1C7802uL, 0xB48149C5uL, 0xDDE8CDCFuL,
+     0x5A4D2604uL, 0x946BF0A7uL, 0x6C1538AFuL, 0x27154D7FuL, 0xDE5B1FCCuL, 0x95CC9230uL, 0x66864F82uL, 0xD88519E9uL},
+    {0x96EA6CA1uL, 0x1013E4F7uL, 0x1F792871uL, 0x567CDC2AuL, 0x5C658D45uL, 0xADB72870uL, 0xCE600E98uL, 0xF7C1FF4AuL,
+     0x4B6CAD39uL, 0xA1BA8657uL, 0xBA20B428uL, 0x3D58D634uL, 0xA2E6FDFBuL, 0xC0011CDEuL, 0x7B18960DuL, 0xA832367AuL},
+    {0x0E4938F7uL, 0x47618C9FuL, 0xDC83719EuL, 0x58D47D69uL, 0xF41A64CCuL, 0xD74C1A23uL, 0xB5829F66uL, 0x5D28E068uL,
+     0x210466F6uL, 0xD8D37529uL, 0xC6A64EF8uL, 0x2AF1152FuL, 0x19CE6A7AuL, 0x55D4485CuL, 0xF648E2D7uL, 0x6D0BD2F5uL},
+    {0xF416448DuL, 0x1ECC032AuL, 0xEC76D971uL, 0x4A7E8C10uL, 0xB90B6EAEuL, 0x854F9805uL, 0x4BED0594uL, 0xFD0B1532uL,
+     0xD98B5CA3uL, 0x89F71848uL, 0xF039B3EFuL, 0xD01FE5FCuL, 0x627BDA2EuL, 0x4481332EuL, 0xA5073E41uL, 0xE67CECD7uL},
+    {0x7CB1282CuL, 0xB828DD1AuL, 0xBE46973AuL, 0xA08D7626uL, 0xE708D6B2uL, 0x6BAF8D40uL, 0x4DAEB3F3uL, 0x72571FA1uL,
+     0xF22DFD98uL, 0x85B1732FuL, 0x0087108DuL, 0x87AB01A7uL, 0x5988207AuL, 0xAAAAFEA8uL, 0x69F00755uL, 0xCCC832F8uL},
+
+    /* 16^39 * G */
+    {0xCA8D9D1AuL, 0x488F1185uL, 0xD987DED2uL, 0xADF2C77DuL, 0x60C46124uL, 0x5F3039F0uL, 0x71E095F4uL, 0xE5D70B75uL,
+     0x6260E70FuL, 0x82D58650uL, 0xF750D105uL, 0x39D75EA7uL, 0x75BAC364uL, 0x8CF3D0B1uL, 0x21D01329uL, 0xF3A7564DuL},
+    {0x3FCD3EFCuL, 0xB24AA43EuL, 0xB8088E9AuL, 0xDD26C034uL, 0xBD3D46EAuL, 0xA5EF4DC9uL, 0x8A4C6A6FuL, 0xA2F99D58uL,
+     0x2F1DA46CuL, 0xDDABD355uL, 0x1AFACDD1uL, 0x72C3F8CEuL, 0x92D40578uL, 0xD90C4EEEuL, 0xCA623B94uL, 0xD28BB41FuL},
+    {0xE7417CE1uL, 0x242792D2uL, 0x970EE7F5uL, 0xFF42BC71uL, 0x5C67A41EuL, 0x1FF4DC6DuL, 0x20882A58uL, 0x77709B7BuL,
+     0xBE217F2CuL, 0x3554731DuL, 0x5BB72177uL, 0x2AF2A8CDuL, 0x591DD059uL, 0x58EEE769uL, 0x4BBA6477uL, 0xBB2930C9uL},
+    {0xF176F2C0uL, 0x1E6ADDDAuL, 0xE2572658uL, 0x01CA4604uL, 0x85342FFBuL, 0x0A404DEDuL, 0x441838D6uL, 0x8CF60F96uL,
+     0xC9071C4AuL, 0x9BBC691CuL, 0x34442803uL, 0xFD588744uL, 0x809C0D81uL, 0x97101C85uL, 0x8C456F7FuL, 0xA7FB754CuL},
+    {0xAF71013FuL, 0x6AF7A1D5uL, 0x0BEDC946uL, 0xE68216E5uL, 0xD27370A0uL, 0xF4CBA30BuL, 0x870421CCuL, 0x7981AFBFuL,
+     0x9449F0E1uL, 0x02496A67uL, 0x0A47EDAEuL, 0x86CFC4BEuL, 0xB1FECA22uL, 0x3073C936uL, 0x03F8F8FBuL, 0xF5694612uL},
+    {0x5BDE48F8uL, 0xBCADD671uL, 0x2189BC7DuL, 0xC9703873uL, 0xC709EE8AuL, 0x5D45299EuL, 0x845AAFF8uL, 0xD1287EE2uL,
+     0xDB1DBF1FuL, 0x7D1F8874uL, 0x990C88D6uL, 0xEA46588BuL, 0x84368313uL, 0x60BA649AuL, 0x60D543AEuL, 0xD5FDCBCEuL},
+    {0x9890272DuL, 0xCF3DE995uL, 0x3E713A10uL, 0x75F3432AuL, 0xE28227B8uL, 0x5E13479FuL, 0xFEFACDC8uL, 0xB8561EA9uL,
+     0x8332AAFDuL, 0xA6A297A0uL, 0x73809B62uL, 0x9B0D8BB5uL, 0x0C63036FuL, 0xD2FA1CFDuL, 0xBD64BDA8uL, 0x7A16EB55uL},
+    {0x2AC13E27uL, 0xF7E48E8AuL, 0x4EB1A9F5uL, 0x4494F6DFuL, 0x981F0A62uL, 0xEDBF84EBuL, 0x536438F0uL, 0x49BADC32uL,
+     0x004F7571uL, 0x50BEA541uL, 0xDF1C94EEuL, 0xBAC67D10uL, 0xB727BC31uL, 0x253D73A1uL, 0x30686E28uL, 0xB3D01CF2uL},
+
+    /* 16^40 * G */
+    {0x6D3549CFuL, 0xD433E50FuL, 0xFACD665EuL, 0x6F33696FuL, 0xCE11FCB4uL, 0x695BFDACuL, 0xAF7C9860uL, 0x810EE252uL,
+     0x7159BB2CuL, 0x65450FE1uL, 0x758B357BuL, 0xF7DFBEBEuL, 0xD69FEA72uL, 0x2B057E74uL, 0x92731745uL, 0xD485717AuL},
+    {0xEE36860CuL, 0x896C42E8uL, 0x4113C22DuL, 0xDAF04DFDuL, 0x44104213uL, 0x1ADBB7B7uL, 0x1FD394EAuL, 0xE5FD5FA1uL,
+     0x1A4E0551uL, 0x68235D94uL, 0x18D10151uL, 0x6772CFBEuL, 0x09984523uL, 0x276071E3uL, 0x5A56BA98uL, 0xE4E879DEuL},
+    {0xB898FD52uL, 0x6C8D0AA9uL, 0xBE9AF1A7uL, 0x2FB38A57uL, 0x3B4F03F8uL, 0xE1F2B9A9uL, 0xC3F0CC6FuL, 0x2B1AAD44uL,
+     0x7CF2C084uL, 0x58B5332EuL, 0x0367D26DuL, 0x1C57D96FuL, 0xFA6E4A8DuL, 0x2297EABDuL, 0x4A0E2B6AuL, 0x65A947EEuL},
+    {0x285B9491uL, 0xAAAFAFB0uL, 0x1E4C705EuL, 0x01A0BE88uL, 0x2AD9CAABuL, 0xFF1D4F5DuL, 0xC37A233FuL, 0x6E349A4AuL,
+     0x4A1C6A16uL, 0xCF1C1246uL, 0x29383260uL, 0xD99E6B66uL, 0x5F6D5471uL, 0xEA3D4366uL, 0xFF8CC89BuL, 0x36974D04uL},
+    {0xFDD5B854uL, 0xF535B616uL, 0x5728719FuL, 0x592549C8uL, 0x06921CADuL, 0xE2314686uL, 0x311B1EF8uL, 0x98C8CE34uL,
+     0xE9090B36uL, 0x28B937E7uL, 0x0BF7BBB7uL, 0x67FC3AB9uL, 0xA9D87974uL, 0x12337097uL, 0xF970E3FEuL, 0x3E5ADCA1uL},
+    {0xCFE89D80uL, 0xC26C49A1uL, 0xDA9C8371uL, 0xB42C026DuL, 0xDAD066D2uL, 0xCA6C013AuL, 0x56A4F3EEuL, 0xFB8F7228uL,
+     0xD850935BuL, 0x08B579ECuL, 0xD631E1B3uL, 0x34C1A74CuL, 0xAC198534uL, 0xCB5FE596uL, 0xE1F24F25uL, 0x39FF21F6uL},
+    {0xB3F85FF0uL, 0xCDCC68A7uL, 0x1A888044uL, 0xACD21CDDuL, 0x05DBE894uL, 0xB6719B2EuL, 0x8B8260D4uL, 0xFAE1D3D8uL,
+     0x8A1C5D92uL, 0xEDFEDECEuL, 0xDC52077EuL, 0xBCA01A94uL, 0x16DD13EDuL, 0xC085549CuL, 0x495EBAADuL, 0xDC5C3BAEuL},
+    {0x8F929057uL, 0x27F29E14uL, 0xC0C853DFuL, 0x7A64AE06uL, 0x58E9C5CEuL, 0x256CD183uL, 0xDED092A5uL, 0x9D9CCE82uL,
+     0x6E93B7C7uL, 0xCC6E5979uL, 0x31BB9E27uL, 0xE1E47092uL, 0xAA9E29A0uL, 0xB70B3083uL, 0x3785E644uL, 0xBF181A75uL},
+
+    /* 16^41 * G */
+    {0x1402B9D0uL, 0xD3B3A13FuL, 0x2C7BC863uL, 0x573441C3uL, 0x578C3E6EuL, 0x4B301EC4uL, 0x0ADAF57EuL, 0xC26FC9C4uL,
+     0x7493CEA3uL, 0x96E71BFDuL, 0x1AF81456uL, 0xD05D4B3FuL, 0x6A8C608FuL, 0xDACA2A8AuL, 0x0725B276uL, 0x53EF07F6uL},
+    {0x46AC49D2uL, 0xA6B5C9D6uL, 0x83137AA9uL, 0x42C77C0BuL, 0x68225A38uL, 0x24D000FCuL, 0x2FE1E907uL, 0x0F63CFC8uL,
+     0xC6441F95uL, 0x22D1B01BuL, 0xEC8E448FuL, 0x7D38F719uL, 0x787FB1BAuL, 0x9B33FA5FuL, 0x190158DFuL, 0x94DCFDA1uL},
+    {0x526F09FDuL, 0x057FED45uL, 0x8128240AuL, 0xE8A4F10CuL, 0xFF2BFD8DuL, 0x9332EFC4uL, 0xBD35AA31uL, 0x214E77A0uL,
+     0x14FAA40EuL, 0x32896D73uL, 0x01E5F186uL, 0x767867ECuL, 0x17A1813EuL, 0xC9ADF8F1uL, 0x54741795uL, 0xCB6CDA78uL},
+    {0x296C36EFuL, 0x211CDE10uL, 0x82C4DA77uL, 0x7EE89672uL, 0xA57836DAuL, 0xB617D270uL, 0x9CB7560BuL, 0xF0CD9C31uL,
+     0xE455FE90uL, 0x01FDCBF7uL, 0x7E7334F3uL, 0x3FB53CBBuL, 0x4E7DE4ECuL, 0x781E2EA4uL, 0x0B384FD0uL, 0x8ADAB3ADuL},
+    {0x53B618C0uL, 0x1C6BD47DuL, 0x6A227923uL, 0xC424F46CuL, 0xDD92D964uL, 0x7303FFDEuL, 0x71B5ABF2uL, 0xE9712878uL,
+     0xF815561DuL, 0x8F48A632uL, 0xD3C055D1uL, 0x85F48FF5uL, 0x7525684FuL, 0x222A1427uL, 0x67360CC3uL, 0xD0D841A0uL},
+    {0x599FF0F9uL, 0x01778A2BuL, 0x8104FC6BuL, 0x68A923D7uL, 0xDA694FF3uL, 0x5BFA44DFuL, 0xF7667F12uL, 0x4F7199DBuL,
+     0xE46F2A79uL, 0xC06D8FF6uL, 0xE9F8131DuL, 0x08B5DEADuL, 0xABB4CE7CuL, 0x02519A59uL, 0xB42AEC3EuL, 0xC4F710BCuL},
+    {0x0E0B040DuL, 0xB228A90FuL, 0x45FF897FuL, 0xBAF02D82uL, 0x00FA6122uL, 0x2AAC79E6uL, 0x8E36F557uL, 0x24828817uL,
+     0x113EC356uL, 0xB9521D31uL, 0x15EFF1F8uL, 0x9E48861EuL, 0xE0D41715uL, 0x2AA1D412uL, 0x53F131B8uL, 0x71F86203uL},
+    {0x4ED80940uL, 0x3014368BuL, 0x7A6FCEDDuL, 0x67E6D056uL, 0xCA97579FuL, 0x7C208C49uL, 0xA23597F6uL, 0xFE3D7A81uL,
+     0x7E096AE2uL, 0x5E203202uL, 0x24B39366uL, 0xB1F3E1E7uL, 0x2FDCDFFCuL, 0x26DA26F3uL, 0x6097BE83uL, 0x79422F1DuL},
+
+    /* 16^42 * G */
+    {0x9DB3B381uL, 0x263A2CFBuL, 0xD4DF0A4BuL, 0x9C3A2DEEuL, 0x7D04E61FuL, 0x728D06E9uL, 0x42449325uL, 0x8B1ADFBCuL,
+     0x7E053A1BuL, 0x6EC1D939uL, 0x66DAF707uL, 0xEE2BE5C7uL, 0x810AC7ABuL, 0x80BA1E14uL, 0xF530F174uL, 0xDD2AE778uL},
+    {0x205B9D8BuL, 0x0435D97AuL, 0x056756D4uL, 0x6EB8F064uL, 0xB6F8210EuL, 0xD5E88A8BuL, 0xEC9FD9EAuL, 0x070EF12DuL,
+     0x3BCC876AuL, 0x4D849505uL, 0xA7404CE3uL, 0x12A75338uL, 0xB8A1DB5EuL, 0xD22B49E1uL, 0x14BFA5ADuL, 0xEC1F2051uL},
+    {0xB6828F36uL, 0xADBAEB79uL, 0x01BD5B9EuL, 0x9D7A0258uL, 0x1E844B0CuL, 0xEDA01E0DuL, 0x887EDFC9uL, 0x4B625175uL,
+     0x9669B621uL, 0x14109FDDuL, 0xF6F87B98uL, 0x88A2CA56uL, 0x170DF6BCuL, 0xFE2EB788uL, 0xFFA473F9uL, 0x0CEA06F4uL},
+    {0xC4E83D33uL, 0x43ED81B5uL, 0x5EFD488BuL, 0xD9F35879uL, 0x9DEB4D0FuL, 0x164A620FuL, 0xAC6A7394uL, 0xC6927BDBuL,
+     0x9F9E0F03uL, 0x45C28DF7uL, 0xFCD7E1A9uL, 0x2868661EuL, 0xFFA348F1uL, 0x7CF4E8D0uL, 0x398538E0uL, 0x6BD4C284uL},
+    {0x289A8619uL, 0x2618A091uL, 0x6671B173uL, 0xEF796E60uL, 0x9090C632uL, 0x664E46E5uL, 0x1E66F8FBuL, 0xA38062D4uL,
+     0x0573274EuL, 0x6C744A20uL, 0xA9271394uL, 0xD07B67E4uL, 0x6BDC0E20uL, 0x391223B2uL, 0xEB0A05A7uL, 0xBE2D93F1uL},
+    {0x3F36D141uL, 0xF23E2E53uL, 0x4DFCA442uL, 0xE84BB3D4uL, 0x6B7C023AuL, 0xB804A48DuL, 0x76431C3BuL, 0x1E16A8FAuL,
+     0xDDD472E0uL, 0x1B5452ADuL, 0x0D1EE127uL, 0x7D405EE7uL, 0xFFA27599uL, 0x50FC6F1DuL, 0xBF391B35uL, 0x351AC53CuL},
+    {0x4444896BuL, 0x7EFA14B8uL, 0xF94027FBuL, 0x64974D2FuL, 0xDE84487DuL, 0xEFDCD0E8uL, 0x2B48989BuL, 0x8C45B260uL,
+     0xD8463487uL, 0xA8FCBBC2uL, 0x3FBC476CuL, 0xD1B2B3F7uL, 0xC8F443C0uL, 0x21D005B7uL, 0x40C0139CuL, 0x518F2E67uL},
+    {0x06D75FC1uL, 0x56036E8CuL, 0x3249A89FuL, 0x2DCF7BB7uL, 0xE245E7DDuL, 0x81DD1D3DuL, 0xEBD6E2A7uL, 0xF578DC4BuL,
+     0xDF2CE7A0uL, 0x4C028903uL, 0x9C39AFACuL, 0xAEE36288uL, 0x146404ABuL, 0xDC847C31uL, 0xA4E97818uL, 0x6304C0D8uL},
+
+    /* 16^43 * G */
+    {0x070D3AABuL, 0xE4AC8B33uL, 0x9A2CD5E5uL, 0x2643672BuL, 0x1CFC9173uL, 0x52EFF79BuL, 0x90A7C13FuL, 0x665CA49BuL,
+     0xB3EFB998uL, 0x5A8DDA59uL, 0x052F1341uL, 0x8A5B922DuL, 0x3CF9A530uL, 0xAE9EBBABuL, 0xF56DA4D7uL, 0x35986E7BuL},
+    {0xDA79E5ACuL, 0x534ACF4FuL, 0x8630215FuL, 0x68B83B3AuL, 0xD085756EuL, 0x5C748B2EuL, 0xE5D37CB2uL, 0xB0317258uL,
+     0xC5CCC2C4uL, 0x6735841AuL, 0x3D9D5069uL, 0x7D7DC96BuL, 0xFD1754BDuL, 0xA147E410uL, 0xD399DDD5uL, 0x65296E94uL},
+    {0xF0290A8FuL, 0x831AB3EDuL, 0xCB47C387uL, 0xCAE81966uL, 0x184EFB4FuL, 0xAAD7DECEuL, 0x4749110EuL, 0xDCFC53B3uL,
+     0x4CB632F9uL, 0x6698F23CuL, 0xB91F8067uL, 0xC42A1AD6uL, 0x6284180AuL, 0xB116A81DuL, 0xE901326FuL, 0xEBEDF5F8uL},
+    {0xB30CFB3AuL, 0xD7E0C4CDuL, 0x6C9DB4C8uL, 0x6D09B8C1uL, 0x07C8D9DFuL, 0x40BA1A42uL, 0x1C52C66DuL, 0x6FD495F7uL,
+     0x275264DAuL, 0xFB0E169FuL, 0xE57D8362uL, 0x80C2B746uL, 0x49AD7222uL, 0xEDD987F7uL, 0x4398EC7BuL, 0xFDC229AFuL},
+    {0x59B0FF62uL, 0x54A6FE5AuL, 0x4094D0D4uL, 0x25EC81A3uL, 0x33437F1DuL, 0xFCFD834EuL, 0xA67604DCuL, 0x8E98378BuL,
+     0xF4848598uL, 0x53137DD6uL, 0x62FDA36AuL, 0x87F2C5BFuL, 0xEF74DF46uL, 0x70DC1C27uL, 0x0A86A056uL, 0x3EBF428FuL},
+    {0xD0D350A3uL, 0x6713AC7AuL, 0x105A1F2FuL, 0x84F6EBF9uL, 0x16254046uL, 0x17A14958uL, 0xAEF406F7uL, 0xAFA5E9A4uL,
+     0x1CDD69B6uL, 0xF97BAF7CuL, 0x5EE86474uL, 0x64081A30uL, 0x1227F62AuL, 0xEB9F7F09uL, 0x3485652CuL, 0x3E47F1DCuL},
+    {0xB7F01D83uL, 0x6F975E7FuL, 0x45CCF5CBuL, 0x5F1F860BuL, 0x8B70930FuL, 0x22702EBAuL, 0x2B5CC879uL, 0xD8186DF7uL,
+     0x1720468FuL, 0x8C065DA0uL, 0x00464C80uL, 0x42477261uL, 0xC277E1CAuL, 0xD8C4BBBEuL, 0x66BA642FuL, 0x04AAEA17uL},
+    {0x52666A58uL, 0xB0D1ED84uL, 0xE6A9C3C2uL, 0x4BCB6E00uL, 0x26906408uL, 0x3C57411CuL, 0x13556400uL, 0xCFC20755uL,
+     0x5294DBA3uL, 0xA08B1C50uL, 0x8B7DD31EuL, 0xA30BA286uL, 0x991ECA74uL, 0xD70BA90EuL, 0xE762C2B9uL, 0x094E142CuL},
+
+    /* 16^44 * G */
+    {0x979F3925uL, 0xB81D783EuL, 0xAF4C89A7uL, 0x1EFD130AuL, 0xFD1BF7FAuL, 0x525C2144uL, 0x1B265A9EuL, 0x4B296904uL,
+     0xB9DB65B6uL, 0xED8E9634uL, 0x03599D8AuL, 0x35C82E32uL, 0x403563F3uL, 0xDAA7A54FuL, 0x022C38ABuL, 0x9DF088ADuL},
+    {0x4237B64BuL, 0x8D084F12uL, 0xE3ECFD07uL, 0x688EBE99uL, 0xF6845DD8uL, 0x57B8A70CuL, 0x5DA4A325uL, 0x808FC59CuL,
+     0xA3585862uL, 0xA9032B2BuL, 0xEDF29386uL, 0xB66825D5uL, 0x431EC29BuL, 0xB5A5A8DBuL, 0x3A1E8DC8uL, 0xBB143A98uL},
+    {0xF111661EuL, 0x9E93BA24uL, 0xB105EB04uL, 0xEDCED484uL, 0xF424B578uL, 0x96DC9BA1uL, 0xE83E9069uL, 0xBF8F66B7uL,
+     0xD7ED8216uL, 0x872D4DF4uL, 0x8E2CBECFuL, 0xBF07F377uL, 0x98E73754uL, 0x4281D899uL, 0x8AAB8708uL, 0xFEC85FBBuL},
+    {0x765FA7D0uL, 0x13B5BF22uL, 0x1D6A5370uL, 0x59805BF0uL, 0x4280DB98uL, 0x67A5E29DuL, 0x776B1CE3uL, 0x4F53916FuL,
+     0x33DDF626uL, 0x714FF61FuL, 0xA085D103uL, 0x4206238EuL, 0xE5809EE3uL, 0x1C50D4B7uL, 0x85F8EB1DuL, 0x999F450DuL},
+    {0x1A3A93BCuL, 0x82EEBE73uL, 0xA21ADC1AuL, 0x42BBF465uL, 0xEF030EFDuL, 0xC10B6FA4uL, 0x87B097BBuL, 0x247AA4C7uL,
+     0xF60C77DAuL, 0x8B8DC632uL, 0xC223523EuL, 0x6FFBC26AuL, 0x344579CFuL, 0xA4F6FF11uL, 0x980250F6uL, 0x5825653CuL},
+    {0x4A493B31uL, 0x4BF367BAuL, 0x9BF7F026uL, 0x54F20A52uL, 0x9795914BuL, 0xB696E062uL, 0x8BF236ACuL, 0xCDDAB96DuL,
+     0xED25EA13uL, 0x4FF2C70AuL, 0x81CBBBE7uL, 0xFA1D09EBuL, 0x468544C5uL, 0x88FC8C87uL, 0x696B3317uL, 0x847A670DuL},
+    {0xD314E7BCuL, 0xEDA6C595uL, 0x467899EDuL, 0x2EE7464BuL, 0x0A1ED5D3uL, 0x1CEF423CuL, 0x69CC7613uL, 0x217E76EAuL,
+     0xE7CDA917uL, 0x27CCCE1FuL, 0x8A893F16uL, 0x12D8016BuL, 0x9FC74F6BuL, 0xBCD6DE84uL, 0xF3144E61uL, 0xFA5817E2uL},
+    {0xAC751E7BuL, 0xB79D4CC5uL, 0xFD4211BDuL, 0x93F96472uL, 0xC8DE4FC6uL, 0x8C72D3D2uL, 0xDF44F064uL, 0x7B69CBF5uL,
+     0xF4BF94E1uL, 0x3DA90CA2uL, 0xF12894E2uL, 0x1A5325F8uL, 0x7917D60BuL, 0x0A437F6CuL, 0x96C9CB5DuL, 0x9BE70486uL},
+
+    /* 16^45 * G */
+    {0xE1337C26uL, 0x949C9976uL, 0xD73D68E5uL, 0x6FAADEBDuL, 0xF1B768D9uL, 0x9E158614uL, 0x9CC4F069uL, 0x22DFA557uL,
+     0xBE93C6D6uL, 0xCCD6DA17uL, 0xA504F5B9uL, 0x24866C61uL, 0x8D694DA1uL, 0x2121353CuL, 0x0140B8C6uL, 0x1C6CA580uL},
+    {0xD4B79BB8uL, 0xF1604A7DuL, 0x52C878C8uL, 0xAEE806FBuL, 0x8D47B8E8uL, 0x34144F11uL, 0x949F9054uL, 0x72EDF52BuL,
+     0x2127015AuL, 0xEBFCA84EuL, 0x9CB7CEF3uL, 0x9051D0C0uL, 0x296DEEC8uL, 0x86E8FE58uL, 0x41010D74uL, 0x33B28188uL},
+    {0x9AED9F40uL, 0xBD5660EDuL, 0x532A8C99uL, 0x70CA6AD1uL, 0x95C371EAuL, 0xC4978BFBuL, 0x7003109DuL, 0xE5464D0DuL,
+     0xD9E535EFuL, 0x1AF32FDFuL, 0x98C9185BuL, 0xABF57EA7uL, 0x12B42488uL, 0xED7A7417uL, 0xE97286FAuL, 0x8E0296A7uL},
+    {0x171B445FuL, 0x01079383uL, 0x8131AD4CuL, 0x9BCF21E3uL, 0xC93987E8uL, 0x8CDFE205uL, 0xC92E8C8FuL, 0xE63F4152uL,
+     0x30ADD43DuL, 0x729462A9uL, 0xC980F05AuL, 0x62EBB143uL, 0x3B06E968uL, 0x4F3954E5uL, 0x242CF6B1uL, 0xFE1D75ADuL},
+    {0x1F017D5EuL, 0x8B57416EuL, 0x7674E99BuL, 0x37533396uL, 0xE8F488A0uL, 0x6E6D94C0uL, 0xDC16F95EuL, 0xB93A787AuL,
+     0xDCC99CCCuL, 0xC3AC51A2uL, 0x9AA47C1DuL, 0xC134B413uL, 0xAFDFD8D5uL, 0xF28FCDAFuL, 0x10B831EDuL, 0x0D57BD8EuL},
+    {0xF0BCFC46uL, 0x9276FBCCuL, 0xB5CFFEE6uL, 0x3A822ACEuL, 0xC75D915BuL, 0x328ED2FEuL, 0xC359476CuL, 0xA145C113uL,
+     0x8BE17BCDuL, 0xF61A8153uL, 0xAA6C3D8FuL, 0x01E867C3uL, 0x6516C82FuL, 0x5634E15DuL, 0x6948B9B0uL, 0xC1437BD2uL},
+    {0x6C19D4C7uL, 0xD2FCD200uL, 0xE1B1E976uL, 0xA0F3C437uL, 0x94F237E8uL, 0xF0545FF6uL, 0xC0BF8BB1uL, 0xDD10EC3FuL,
+     0xAC7CD3E1uL, 0x4F89696CuL, 0x5F24BFE6uL, 0xED3714ECuL, 0x5FAF7706uL, 0x363EB1D8uL, 0xC027CC32uL, 0xFCBD604DuL},
+    {0xAF8685C8uL, 0x5F95C6C7uL, 0x2F8F01AAuL, 0xD4C1C8CEuL, 0x2574692AuL, 0xC44BBE32uL, 0xD4A4A068uL, 0xB8003478uL,
+     0x2ECA3CDBuL, 0x7C8FC6E5uL, 0xEC04D399uL, 0xEA1DB16BuL, 0x8F2BC5CFuL, 0xB05BC82EuL, 0xF44793D2uL, 0x763D517FuL},
+
+    /* 16^46 * G */
+    {0x4C830320uL, 0xF3B7963FuL, 0x903203E3uL, 0x842C7AA0uL, 0xE7327AFBuL, 0xAF22CA0AuL, 0x967609B6uL, 0x38E13092uL,
+     0x757558F1uL, 0x73B8FB62uL, 0xF7ECA8C1uL, 0x3CC3E831uL, 0xF6331627uL, 0xE4174474uL, 0xC3C40234uL, 0xA77989CAuL},
+    {0xB0166F7AuL, 0xAE8317F4uL, 0xCEEC74E6uL, 0xFBD3E3F7uL, 0xE0874BFDuL, 0xFDB516ACuL, 0xC681F3A3uL, 0x3D846019uL,
+     0x7C1620B0uL, 0x0B12EE5CuL, 0x2B63C501uL, 0xBA68B4DDuL, 0x6668C51EuL, 0xAC03CD32uL, 0x4E0BCB5BuL, 0x2A6279F7uL},
+    {0xB796D219uL, 0xB32CB8B0uL, 0x34741DD9uL, 0xC3E95F4FuL, 0x68EDF6F5uL, 0x87212125uL, 0xA2B9CB8EuL, 0x7A03AEE4uL,
+     0xF53A89AAuL, 0x0CD3C376uL, 0x948A28DCuL, 0x0D8AF9B1uL, 0x902AB04FuL, 0xCF86A3F4uL, 0x7F42002DuL, 0x8AACB62AuL},
+    {0x8F5FCDA8uL, 0xFD8E139FuL, 0xBDEE5BFDuL, 0xF3E558C4uL, 0xE33F9F77uL, 0xD76CBAF4uL, 0x71771969uL, 0x3A4C97A4uL,
+     0xF6DCE6A7uL, 0xDA27E84BuL, 0x13E6C2D1uL, 0xFF373D96uL, 0xD759A6E9uL, 0xF115193CuL, 0x63D2262CuL, 0x3F9B7025uL},
+    {0x252BD479uL, 0x9CB0AE6CuL, 0x12B5848FuL, 0x05E0F88AuL, 0xA5C97663uL, 0x78F6D2B2uL, 0xC162225CuL, 0x6F6E149BuL,
+     0xDE601A89uL, 0xE602235CuL, 0xF373BE1FuL, 0xD17BBE98uL, 0xA8471827uL, 0xCAF49A5BuL, 0x18AAA116uL, 0x7E1A0A85uL},
+    {0x87BAA627uL, 0x12536FEAuL, 0xF72AA680uL, 0x58C1FEC1uL, 0x601E5DC9uL, 0x6C29B637uL, 0xDE9E01B9uL, 0x9E3C3C1CuL,
+     0x2BCFE0B0uL, 0xEFC8127BuL, 0x2A12F50DuL, 0x35107102uL, 0x4879B397uL, 0x6CCD6CB1uL, 0xF8A82F21uL, 0xF792F804uL},
+    {0x35E6FC06uL, 0x8B1E5722uL, 0x0B3E13D5uL, 0x3477728FuL, 0xAA8A7372uL, 0x150C294DuL, 0x3BFA528AuL, 0xC0291D43uL,
+     0xCEC5A196uL, 0xC6C8BC67uL, 0x5C2E8A7CuL, 0xDEEB31E4uL, 0xFB6E1C51uL, 0xBA93E244uL, 0x2E28E156uL, 0xB9F8B71BuL},
+    {0x1A335CC8uL, 0x8C318491uL, 0x6A5913E4uL, 0x563459BAuL, 0xC7B32919uL, 0x1B920D61uL, 0xA02425ADuL, 0x805AB8B6uL,
+     0x8D006086uL, 0x2AC512DAuL, 0xBCF5C0FDuL, 0x6CA4846AuL, 0xAC2138D7uL, 0xAFEA51D8uL, 0x344CD443uL, 0xCB647545uL},
+
+    /* 16^47 * G */
+    {0x53544774uL, 0x511053E4uL, 0x3ADBA2BCuL, 0x834D0ECCuL, 0xBAE371F5uL, 0x4215D7F7uL, 0x6C8663BCuL, 0xFCFD57BFuL,
+     0xD6901B1DuL, 0xDED2383DuL, 0xB5587DC3uL, 0x3B49FBB4uL, 0x07625F62uL, 0xFD44A08DuL, 0x9DE9B762uL, 0x3EE4D65BuL},
+    {0x0D63D1FAuL, 0x64E5137DuL, 0x02A9D89FuL, 0x658FC052uL, 0x50436309uL, 0x48894874uL, 0xD598DA61uL, 0xE9AE30F8uL,
+     0x818BAF91uL, 0x2ED710D1uL, 0x8B6A0C20uL, 0xE27E9E06uL, 0x1C1A6B44uL, 0x1E28DCFBuL, 0xD6AC57DCuL, 0x883ACB64uL},
+    {0x4E6DAAE2uL, 0xED7F2E77uL, 0x9E0A19BCuL, 0x7B3AE0E3uL, 0x91AE677EuL, 0xD3293F8AuL, 0x45C8611FuL, 0xD363B0CBuL,
+     0x309AE93BuL, 0xBE1D1CCFuL, 0x3920CAE1uL, 0xA3F80BE7uL, 0x498EDF01uL, 0xAAACBA74uL, 0xB2F5AC90uL, 0x1E6D2A4AuL},
+    {0xC2C6FF70uL, 0x8735728DuL, 0xC5DC2235uL, 0x79D6122FuL, 0x19E277F9uL, 0x23F5D003uL, 0xDDED8CC7uL, 0x7EE84E25uL,
+     0x63CD880AuL, 0x91A8AFB0uL, 0x3574AF60uL, 0x3F3EA7C6uL, 0x02DE7F42uL, 0x0CFCDC84uL, 0xB31AA152uL, 0x62D0792FuL},
+    {0xBECCEFB5uL, 0x40FDF5AAuL, 0x3621D7C7uL, 0xCF56EDE9uL, 0x52B576C1uL, 0xB632A9CEuL, 0x9A6F6027uL, 0xD3403AE8uL,
+     0xE8785A64uL, 0x660A050DuL, 0x9682652EuL, 0x10F3D647uL, 0x4FBCBE02uL, 0x78B25EDFuL, 0xB4F9315DuL, 0xC9710FDEuL},
+    {0x8A5807CEuL, 0x8E1B4E43uL, 0xE4109A7EuL, 0xAD283893uL, 0xAFD59DDAuL, 0xC30CC9CBuL, 0x3D8D8093uL, 0xF65F36C6uL,
+     0xA60D32B2uL, 0xDF31469EuL, 0x3E8191C8uL, 0xEE93DF4BuL, 0x355BDEB5uL, 0x9C1017C5uL, 0x8616AA28uL, 0xD2623185uL},
+    {0x3245980EuL, 0xD655ADE7uL, 0x81067200uL, 0xA6F59657uL, 0xDB136BE1uL, 0xE4FC23BEuL, 0xAF13D879uL, 0x9F246CDCuL,
+     0xF961AC0EuL, 0xC2B93117uL, 0xEBDB9E1AuL, 0xC8A741B5uL, 0x6C693BD1uL, 0x82EDE246uL, 0x3DD1701EuL, 0xFCDE6B4FuL},
+    {0xDEC31A21uL, 0xB02C83F9uL, 0x6AD9D573uL, 0x988C8B23uL, 0xA57BE365uL, 0x53E983AEuL, 0x646F834EuL, 0xE968734DuL,
+     0x5DA6309BuL, 0x9137EA8FuL, 0xC1F1CE16uL, 0x10F3A624uL, 0xCA440921uL, 0x782A9EA2uL, 0x5B46F1B5uL, 0xDF94739EuL},
+
+    /* 16^48 * G */
+    {0xF4F8B16AuL, 0x56F8410EuL, 0xC47B266AuL, 0x97241AFEuL, 0x6D9C87C1uL, 0x0A406B8EuL, 0xCD42AB1BuL, 0x803F3E02uL,
+     0x04DBEC69uL, 0x7F0309A8uL, 0x3BBAD05FuL, 0xA83B85F7uL, 0xAD8E197FuL, 0xC6097273uL, 0x5067ADC1uL, 0xC097440EuL},
+    {0xB311898CuL, 0x3F747FA0uL, 0xCD0EAC65uL, 0xE2A272E4uL, 0xF914D0BCuL, 0x4BBA5851uL, 0xC4A43EE3uL, 0x7A1A9660uL,
+     0xA1C8CDE9uL, 0xE5A367CEuL, 0x7271ABE3uL, 0x9D958BA9uL, 0x3D1615CDuL, 0xF3FF7EB6uL, 0xF5AE20B0uL, 0xA2280DCEuL},
+    {0x3794F8DCuL, 0x266344A4uL, 0x483C5C36uL, 0xDCCA923AuL, 0x3F9D10A0uL, 0x2D6B6BBFuL, 0x81D9BDF3uL, 0xB320C5CAuL,
+     0x47B50A95uL, 0x620E28FFuL, 0xCEF03371uL, 0x933E3B01uL, 0x99100153uL, 0xF081BF85uL, 0xC3A8C8D6uL, 0x183BE9A0uL},
+    {0x41DCA566uL, 0xB6C185C3uL, 0xD8622AA3uL, 0x7DE7FEDAuL, 0x901B6DFBuL, 0x99E84D92uL, 0x7C4AD288uL, 0x30A02B0EuL,
+     0x2FD3CF36uL, 0xC7C81DAAuL, 0xDF89E59FuL, 0xD1319547uL, 0xCD496733uL, 0xB2BE8184uL, 0x93D3412BuL, 0xD5F449EBuL},
+    {0xE085116BuL, 0x25470FABuL, 0x87285310uL, 0x04A43375uL, 0xE2BFD52FuL, 0x4E39187EuL, 0x7D9EBC74uL, 0x36166B44uL,
+     0xFD4B322CuL, 0x92AD433CuL, 0xBA79AB51uL, 0x726AA817uL, 0xC1DB15EBuL, 0xF96EACD8uL, 0x0476BE63uL, 0xFAF71E91uL},
+    {0xC97E6516uL, 0xD74E9BDAuL, 0xC230F49EuL, 0x88779360uL, 0x1E74EA49uL, 0xA6EC1DE3uL, 0x3FB645A2uL, 0x581DCEE5uL,
+     0x8F483F14uL, 0xBAEF2391uL, 0xD137D13BuL, 0x6D2DDDFCuL, 0xD2743A42uL, 0x54CDE50EuL, 0xE4D97E67uL, 0x89A34FC5uL},
+    {0x49DEE168uL, 0x72CFD2E9uL, 0x3E2AF239uL, 0x1AE05223uL, 0x1D94066AuL, 0x009E75BEuL, 0x38ABF413uL, 0x6CCA31C7uL,
+     0x9BC49908uL, 0xB50BD61DuL, 0xF5E2BC1EuL, 0x4A9B4A8CuL, 0x946F83ACuL, 0xEB6CC5F7uL, 0xEBFFAB28uL, 0x27DA93FCuL},
+    {0x4CD8F64CuL, 0xC492EC64uL, 0x279D7B51uL, 0x58A2D790uL, 0x1FC75256uL, 0x0CED1FC5uL, 0x8F433017uL, 0x3E658AEDuL,
+     0x05DA59EBuL, 0x0B61942EuL, 0x0DDC3722uL, 0xBA3D60A3uL, 0x742E7F87uL, 0x7C311CD1uL, 0xF6B01B6EuL, 0x6473FFEEuL},
+
+    /* 16^49 * G */
+    {0x692AC542uL, 0x8303604FuL, 0x227B91D3uL, 0xF079FFE1uL, 0x15AAF9BDuL, 0x19F63E63uL, 0xF1F344FBuL, 0xF99EE565uL,
+     0xD6219199uL, 0x8A1D661FuL, 0xD48CE41CuL, 0x8C883BC6uL, 0x3C74D904uL, 0x1065118FuL, 0x0FAF8B1BuL, 0x713889EEuL},
+    {0x81A1B3BEuL, 0x972B3F8FuL, 0xCE2764A0uL, 0x4F3CE145uL, 0x28C4F5F7uL, 0xE2D0F1CCuL, 0xC7F3985BuL, 0xDEEE0C0DuL,
+     0xD39E25C3uL, 0x7DF4ADC0uL, 0xC467A080uL, 0x40619820uL, 0x61CF5A58uL, 0x440EBC93uL, 0x422AD600uL, 0x527729A6uL},
+    {0xB1B76BA6uL, 0xCA6C0937uL, 0x4D2026DCuL, 0x1A2EAB85uL, 0x19D9AE0AuL, 0xB1715E15uL, 0xBAC4A026uL, 0xF1AD9199uL,
+     0x07EA7B0EuL, 0x35B3DFB8uL, 0x3ED9EB89uL, 0xEDF5496FuL, 0x2D6D08ABuL, 0x8932E5FFuL, 0x25BD2731uL, 0xF314874EuL},
+    {0x3F73F449uL, 0xEFB26A75uL, 0x8D44FC79uL, 0x1D1C94F8uL, 0x3BC0DC4DuL, 0x49F0FBC5uL, 0x3698A0D0uL, 0xB747EA0BuL,
+     0x228D291EuL, 0x5218C3FEuL, 0x43C129D6uL, 0x35B804B5uL, 0xD1ACC516uL, 0xFAC859B8uL, 0x95D6E668uL, 0x6C10697DuL},
+    {0x0876FD4EuL, 0xC38E438FuL, 0x83D2F383uL, 0x45F0C307uL, 0xB10934CBuL, 0x203CC2ECuL, 0x2C9D46EEuL, 0x6A8F2439uL,
+     0x65CCDE7BuL, 0xF16B431BuL, 0x27E76A6FuL, 0x41E2CD18uL, 0x4E3484D7uL, 0xB9C8CF8FuL, 0x8315244AuL, 0x64426EFDuL},
+    {0xFC94DEA3uL, 0x1C0A8E44uL, 0xDAD6A0B0uL, 0x34C8CDBFuL, 0x04113CEFuL, 0x919C3840uL, 0x15490FFAuL, 0xFD32FBA4uL,
+     0x795DCFB7uL, 0x58D190F6uL, 0x83588BAFuL, 0xFEF01B03uL, 0xCA1FC1C0uL, 0x9E6D1D63uL, 0xF0A41AC9uL, 0x53173F96uL},
+    {0xBA16F73BuL, 0x2B1D402AuL, 0x8CF9B9FCuL, 0x2FB31014uL, 0x446EF7BFuL, 0x2D51E60EuL, 0xB91E1745uL, 0xC731021BuL,
+     0x4FEE99D4uL, 0x9D3B4724uL, 0xFAC5C1EAuL, 0x4BCA48B6uL, 0xBBEA9AF7uL, 0x70F5F514uL, 0x974C283AuL, 0x751F55A5uL},
+    {0xCB452FDBuL, 0x6E30251AuL, 0x50F30650uL, 0x31EE6965uL, 0x933548D9uL, 0xB0B3E508uL, 0xF4B0EF5BuL, 0xB8949A4FuL,
+     0x3C88F3BDuL, 0x208B8326uL, 0xDB1D9989uL, 0xAB147C30uL, 0x44D4DF03uL, 0xED6515FDuL, 0xE72EB0C5uL, 0x17A12F75uL},
+
+    /* 16^50 * G */
+    {0x81FDAD90uL, 0x25914F78uL, 0x0D2CF6ABuL, 0xCF638F56uL, 0xCC054DE5uL, 0xB90BC03FuL, 0x18B06350uL, 0x932811A7uL,
+     0x9BBD11FFuL, 0x2F00B330uL, 0xB4044974uL, 0x76108A6FuL, 0xA851D266uL, 0x801BB9E0uL, 0xBF8990C1uL, 0x0DD099BEuL},
+    {0x58D6CD46uL, 0x14C6DD8AuL, 0x8E6634D2uL, 0x9CB633B5uL, 0xF81BC328uL, 0xC1305047uL, 0x26A177E5uL, 0x12EDE0E2uL,
+     0x065A6F4FuL, 0x332CCA62uL, 0x67BE487BuL, 0xC3A47ECDuL, 0x0F47ED1CuL, 0x741EB187uL, 0xE7598B14uL, 0x99E66E58uL},
+    {0x7B0AC93DuL, 0xEBD6A677uL, 0x78F5E0D7uL, 0xA6E37B0DuL, 0x76F5492BuL, 0x2516C096uL, 0x9AC05F3AuL, 0x1E4BF888uL,
+     0x4DF0BA2BuL, 0xCDB42CE0uL, 0x5062341BuL, 0x935D5CFDuL, 0x82ACAC20uL, 0x8A303333uL, 0x5198B00EuL, 0x429438C4uL},
+    {0x67E573E0uL, 0xFB2838BEuL, 0x4084C44BuL, 0x05891DB9uL, 0x96C1C2C5uL, 0x91311373uL, 0xD958444BuL, 0x6AEBFA3FuL,
+     0xE56E55C1uL, 0xAC9CDCE9uL, 0x2CAA46D0uL, 0x7148CED3uL, 0xB61FE8EBuL, 0x2E10C7EFuL, 0xFF97CF4DuL, 0x9FD835DAuL},
+    {0xC1770616uL, 0x6C626F56uL, 0x09DA9A2DuL, 0x5351909EuL, 0xA3730E45uL, 0xE58E6825uL, 0x03EF0A79uL, 0x9D8C8BC0uL,
+     0x056BECFDuL, 0x543F78B6uL, 0xA090B36DuL, 0x33F13253uL, 0x794432F9uL, 0x82AD4997uL, 0x4721F502uL, 0x1386493CuL},
+    {0x5ABEA82AuL, 0x3794EEFAuL, 0x93FE62D4uL, 0x8DC611B9uL, 0x281EF606uL, 0x69F1AF37uL, 0x39839E69uL, 0x6AF546C8uL,
+     0xC977EC23uL, 0x625578C7uL, 0xBD5C0576uL, 0xA8DE294CuL, 0x7CD1A4C0uL, 0xE2DDAF0FuL, 0x4F95F4D4uL, 0x8243FC70uL},
+    {0xB008733AuL, 0xE566F400uL, 0x512E1F57uL, 0xCBA0697DuL, 0x40509CD0uL, 0x9537C2B2uL, 0x57353D8CuL, 0x5F989C69uL,
+     0x4C3C2B2FuL, 0x7DBEC972uL, 0xFF031FA8uL, 0x90E02FA8uL, 0xCFD5D11FuL, 0xF4D15C53uL, 0x48314DFCuL, 0xB3404FAEuL},
+    {0x081E9387uL, 0xA36DA109uL, 0x8C935828uL, 0xFB9780D7uL, 0xE540B015uL, 0xD5940332uL, 0xE0F466FAuL, 0xC9D7B51BuL,
+     0xD6D9F671uL, 0xFAADCD41uL, 0xB1A2AC17uL, 0xBA6C1E28uL, 0xED201E5FuL, 0x066A7833uL, 0xF90F462BuL, 0x19D99719uL},
+
+    /* 16^51 * G */
+    {0x060B5F61uL, 0xF431F462uL, 0x7BD057C2uL, 0xA56F46B4uL, 0x47E1BF65uL, 0x348DCA6CuL, 0x41BCF1FFuL, 0x9A38783EuL,
+     0xDA710718uL, 0x7A5D33A9uL, 0x2E0AEAF6uL, 0x5A779987uL, 0x2D29D187uL, 0xCA87314DuL, 0xC687D733uL, 0xFA0EDC3EuL},
+    {0xCB198AC7uL, 0x1C894849uL, 0x0F264665uL, 0xA884A93DuL, 0x9B200678uL, 0x2DA964EFuL, 0x009834E6uL, 0x3C351B87uL,
+     0xE2C4B44BuL, 0xAFB2EF9FuL, 0x3326790CuL, 0x580F6C47uL, 0x0B02264AuL, 0xB8480521uL, 0x42A194E2uL, 0x8BA6F9E2uL},
+    {0x5EB03C0EuL, 0x499B6AB6uL, 0x72BC3FDEuL, 0xF19B7954uL, 0x6E3A80D2uL, 0xA86B5B9CuL, 0x6D42819FuL, 0xE4377508uL,
+     0xBB3EE8A3uL, 0xC1663650uL, 0xB132075FuL, 0x75EB14FCuL, 0x7AD834F6uL, 0xA8CCC906uL, 0xE6E92FFDuL, 0xEA6A2474uL},
+    {0xD3C095F1uL, 0x39D934ABuL, 0xE4B76D71uL, 0x04B261BEuL, 0xE73E6984uL, 0x1D2E6970uL, 0x5E5FCB11uL, 0x879FB23BuL,
+     0xDFD75490uL, 0x11506C72uL, 0x61BCF1C1uL, 0x3A97D085uL, 0xBF5E7007uL, 0x43201D82uL, 0x798232A7uL, 0x7F0AC52FuL},
+    {0x4B049136uL, 0xCB4D20EEuL, 0x356A4613uL, 0x8B63BF12uL, 0x70E08128uL, 0x1221AEF6uL, 0x4ACB6B16uL, 0xE62D8C51uL,
+     0x379E7896uL, 0x71F64A67uL, 0xCAFD7FA5uL, 0xB25237A2uL, 0x3841BA6AuL, 0xF077BD98uL, 0x3CD16E7EuL, 0xC4AC0244uL},
+    {0x319D7682uL, 0xB25101FBuL, 0x0A982FEEuL, 0xB0293129uL, 0x0261B344uL, 0x51C1C9B9uL, 0xBFD371FAuL, 0x0E008C5BuL,
+     0x0278CA33uL, 0xD866DD1CuL, 0xE5AA53B1uL, 0x666F76A6uL, 0x6013A2CFuL, 0xE5CFB779uL, 0xA3521836uL, 0x1D3A1AADuL},
+    {0x50F75F9CuL, 0x3C5604FFuL, 0x7E752B22uL, 0x1D8EDDF3uL, 0x3C9A1118uL, 0x0EF074DDuL, 0xCCB86D7BuL, 0xD0FFC172uL,
+     0x037D90F2uL, 0xABD1ECE3uL, 0x6055856CuL, 0xE3F307D6uL, 0x7E4C6DAFuL, 0x422F9328uL, 0x334879A0uL, 0x902AAC66uL},
+    {0x567193ECuL, 0x76B4131AuL, 0xE5F6E70BuL, 0xAF3C305AuL, 0x031EEBDDuL, 0x9587BD39uL, 0x71BBE831uL, 0x5709DEF8uL,
+     0x0EB2B669uL, 0x57059983uL, 0x875B7029uL, 0x4D80CE1BuL, 0x0364AC16uL, 0x838A7DA8uL, 0xBE1C83ABuL, 0x2F431D23uL},
+
+    /* 16^52 * G */
+    {0xADF7CCCFuL, 0x75D9BC15uL, 0xDFA1E1B0uL, 0x81A3E5D6uL, 0x249BC17EuL, 0x8C39E444uL, 0x8EA7FD43uL, 0xF37DCCB2uL,
+     0x907FBA12uL, 0xDA654873uL, 0x4A372904uL, 0x35DAA6DAuL, 0x6283A6C5uL, 0x0564CFC6uL, 0x4A9395BFuL, 0xD09FA4F6uL},
+    {0xEB6B242DuL, 0x832D7080uL, 0x3B71E246uL, 0xD30BD023uL, 0xBE31139DuL, 0x7027991BuL, 0x462E4E53uL, 0x68797E91uL,
+     0x6B4E185AuL, 0x423FE20AuL, 0x42D9B707uL, 0x82F2C67EuL, 0x4CF7811BuL, 0x25C81768uL, 0x045BB95DuL, 0xBD53005EuL},
+    {0x5CFE5C48uL, 0xC51AA29EuL, 0x815EE096uL, 0x82C020AEuL, 0x7549A68AuL, 0x7848AD82uL, 0x60471355uL, 0x7933D489uL,
+     0x67C51E57uL, 0x04998D2EuL, 0xD9944AFCuL, 0x0F64020AuL, 0xA7FADAC6uL, 0x7A299FE1uL, 0x5AEFE92CuL, 0x40C73FF4uL},
+    {0x9D8E68FDuL, 0xE5F649BEuL, 0x1B044320uL, 0xDB0F0533uL, 0xE0C33398uL, 0xF6FDE9B3uL, 0x66C8CFAEuL, 0x92F4209BuL,
+     0x1A739D4BuL, 0xE9D1AFCCuL, 0xA28AB8DEuL, 0x09AEA75FuL, 0xEAC6F1D0uL, 0x14375FB5uL, 0x708F7AA5uL, 0x6420B560uL},
+    {0x5488771AuL, 0xBF44FFC7uL, 0x7F2F2191uL, 0xCB76E3F1uL, 0x94F86A42uL, 0x4197BDE3uL, 0x70641D9AuL, 0x45C25BB9uL,
+     0xF88CE6DCuL, 0xD8A29E31uL, 0x4BB7AC7DuL, 0xBE2BECFDuL, 0xB5670CC7uL, 0x13094214uL, 0x60AF8433uL, 0xE90A8FD5uL},
+    {0x96F37750uL, 0x2D1AFD56uL, 0x91507FF2uL, 0x25DDA557uL, 0x006543EDuL, 0x2B95FD4CuL, 0xA23C3911uL, 0xF3C778D9uL,
+     0x3B04938DuL, 0x84CCF446uL, 0x7EEF947BuL, 0x3D9DDED6uL, 0xDAE325B5uL, 0xBED83735uL, 0xF921455DuL, 0x5BA0F75CuL},
+    {0x4EBD3F02uL, 0x0ECF9B8BuL, 0x86B770EAuL, 0xA47ACD9DuL, 0x2DA213CEuL, 0x93B84A6AuL, 0x53E7C8CFuL, 0xD760871BuL,
+     0x36E530D7uL, 0x7A5F58E5uL, 0x1912AD51uL, 0x7ABC52A5uL, 0x2EA0252AuL, 0x7AD43DB0uL, 0xC176B742uL, 0x498B00ECuL},
+    {0x6254DC41uL, 0x9EAE499CuL, 0x7A837E7EuL, 0x7E293924uL, 0x090524A7uL, 0x74AEC08CuL, 0x8D6F55F2uL, 0xF82B9219uL,
+     0x1402CEC5uL, 0x493C962EuL, 0xFA2F30E7uL, 0x9F17CA17uL, 0xE9B879CBuL, 0xBCD783E8uL, 0x5A6F145FuL, 0xEA3D8C14uL},
+
+    /* 16^53 * G */
+    {0x0EBCF726uL, 0x103C46E6uL, 0x6231470EuL, 0x4482B831uL, 0x487C2109uL, 0x6F6DFACAuL, 0x62E666EFuL, 0x2E0ACE97uL,
+     0x1F8D1F42uL, 0x3246A9D3uL, 0x574944D2uL, 0x1B1E83F1uL, 0xA57F334BuL, 0x13DFA63AuL, 0x9F025D81uL, 0x0CF8DAEDuL},
+    {0x1E935ABBuL, 0x85DE1F0DuL, 0x154DE37AuL, 0xDEFD10B4uL, 0x369CEBB5uL, 0xB8D9E392uL, 0x761324BEuL, 0x54D5EF9BuL,
+     0x74F17E26uL, 0x4D6341BAuL, 0x78C1DDE4uL, 0xC0A0E3C8uL, 0x87D918FDuL, 0xA6D77581uL, 0x02CA3A13uL, 0x66876015uL},
+    {0x207674F1uL, 0xBC19180CuL, 0x33AE8FDBuL, 0x112E09A7uL, 0x6AAEB71EuL, 0x99667554uL, 0xE101B1C7uL, 0x79432AF1uL,
+     0xDE2DDEC6uL, 0xD5EB558FuL, 0x5357753FuL, 0x81392D1FuL, 0x3AE1158AuL, 0xA7A76B97uL, 0x4A899991uL, 0x416FBBFFuL},
+    {0x904FC3FAuL, 0xEE7332C7uL, 0xC7E3636AuL, 0x14A23F45uL, 0xF091D9AAuL, 0xC38659C3uL, 0xB12D8540uL, 0x4A995E5DuL,
+     0xF3A5598AuL, 0x20A53BECuL, 0xB1EAA995uL, 0x56534B17uL, 0xBF04E03CuL, 0x9ED3DCA4uL, 0xD8D56268uL, 0x716C563AuL},
+    {0x2F3B26E7uL, 0x6D956E89uL, 0xDA875247uL, 0xF4709860uL, 0x2482DDA3uL, 0x3AD15179uL, 0x017D82F0uL, 0xD64110E3uL,
+     0xFAD414E4uL, 0x14928D2CuL, 0x2ED02B24uL, 0x2B155F58uL, 0xCB821BF1uL, 0x481A141BuL, 0x4F81F5DAuL, 0x12E3C770uL},
+    {0x308780F2uL, 0xDD5944EAuL, 0x3845F5E4uL, 0xDC8DE761uL, 0x7624D7A3uL, 0x6BEABA7DuL, 0x304DF11EuL, 0x1E709AFDuL,
+     0x02170456uL, 0x95364376uL, 0xC8F94B64uL, 0xBF204B3AuL, 0x5680CA68uL, 0x4E53AF7CuL, 0xE0C67574uL, 0x0526074AuL},
+    {0x7882F14FuL, 0xE29FA63EuL, 0x07C6CADCuL, 0xC9F6DC35uL, 0xB882BED0uL, 0x46F22D6FuL, 0xD118E52CuL, 0x1A45755BuL,
+     0x7C4608CFuL, 0x9F2C7C27uL, 0x568012C2uL, 0x7CCBDF32uL, 0x61729B0EuL, 0xFCB0AEDDuL, 0xF7D75DBFuL, 0x7CA2CA9EuL},
+    {0xE0F222C2uL, 0x5043DEA7uL, 0x72E65142uL, 0x309D42ACuL, 0x9216CD30uL, 0x94FE9DDDuL, 0x0F87FEECuL, 0xD6539C7DuL,
+     0x432AC7D7uL, 0x03C5A57CuL, 0x327FDA10uL, 0x72692CF0uL, 0x280698DEuL, 0xEC28C85FuL, 0x7EC283B1uL, 0x2331FB46uL},
+
+    /* 16^54 * G */
+    {0xE457A477uL, 0xA0158EEAuL, 0xEE6DDC05uL, 0xD19857DBuL, 0x18C41671uL, 0xB3265224uL, 0x3C2C0D58uL, 0x3FFDFC7EuL,
+     0x26EE7CDAuL, 0x3A3A5254uL, 0xDF02C3A8uL, 0x341B0869uL, 0x723BBFC8uL, 0xA023BF42uL, 0x14452691uL, 0x3D15002AuL},
+    {0x85EDFA30uL, 0x5EF7324CuL, 0x87D4F3DAuL, 0x25976554uL, 0xDCB50C86uL, 0x352F5BC0uL, 0x4832A96CuL, 0x8F6927B0uL,
+     0x55F2F94CuL, 0xD08EE1BAuL, 0x344B45FAuL, 0x6A996F99uL, 0xA8AA455DuL, 0xE133CB8DuL, 0x758DC1F7uL, 0x5D0721ECuL},
+    {0x262A3539uL, 0xF3CAE7E9uL, 0x6670D59EuL, 0x78A49D1DuL, 0xC1C5E1B9uL, 0x37DE0F63uL, 0x69CB7C1CuL, 0x3072C30CuL,
+     0x77C850E6uL, 0x1D278A52uL, 0x1F6A3DE6uL, 0x84F15F8FuL, 0x592CA7ADuL, 0x46A8BB45uL, 0xE4D424B8uL, 0x1912E3EEuL},
+    {0x79E5FB67uL, 0x6BA7A920uL, 0x70AA725EuL, 0xE1331FEBuL, 0x7DF5D837uL, 0x5080CCF5uL, 0x7FF72E21uL, 0xE4CAE01DuL,
+     0x0412A77DuL, 0xD9243EE6uL, 0xDF449025uL, 0x06FF7CACuL, 0x23EF5A31uL, 0xBE75F7CDuL, 0x0DDEF7A8uL, 0xBC957822uL},
+    {0x365E668BuL, 0xDC988086uL, 0xAABDA5FBuL, 0xADA8DCDAuL, 0x255F1FBEuL, 0xBC146B4CuL, 0xCF34CFC3uL, 0x9CFCDE29uL,
+     0x7E85D1E4uL, 0xACBB453EuL, 0xF92358B5uL, 0x9CA09679uL, 0x240823FFuL, 0x15FC2D96uL, 0x0C11D11EuL, 0x8D65ADF7uL},
+    {0xB0CE1C55uL, 0x8CF7230CuL, 0x0BBFB607uL, 0x5B534D05uL, 0x0E16363BuL, 0xEE1EF113uL, 0xB4999E82uL, 0x27E0AA7AuL,
+     0x79362C41uL, 0xCE1DAC2DuL, 0x91BB6CB0uL, 0x67920C90uL, 0x2223DF24uL, 0x1E648D63uL, 0xE32E8F28uL, 0x0F7D9EEFuL},
+    {0x0296F4FDuL, 0x775557F1uL, 0xEA51B436uL, 0x1DCA76A3uL, 0xFB950805uL, 0xF3E98F60uL, 0x831CF7F1uL, 0x31FF32EAuL,
+     0x8D2C714BuL, 0x643E7BF1uL, 0x2E9D2ACAuL, 0x64B5C339uL, 0x6ADC2D23uL, 0xA9FD9CCCuL, 0xCC721B9BuL, 0xFC2397ECuL},
+    {0xFA833834uL, 0x6943F39AuL, 0xA6328562uL, 0x22951722uL, 0x4170FC10uL, 0x81D63DD5uL, 0xAECC2E6DuL, 0x9F5FA58FuL,
+     0xE77D9A3BuL, 0xB66C8725uL, 0x6384EBE0uL, 0x11235CEAuL, 0x5845E24AuL, 0x06A8C118uL, 0xEBD093B1uL, 0x0137B286uL},
+
+    /* 16^55 * G */
+    {0xC42BD6D2uL, 0xDB567D6AuL, 0xBB1F96AEuL, 0x6DF86468uL, 0x4843B28EuL, 0x0EFE5B1AuL, 0x6379B240uL, 0x961BBB05uL,
+     0x70A6A26BuL, 0xB6CAF5F0uL, 0x328E6E39uL, 0x70686C0DuL, 0x895FC8D3uL, 0x80DA06CFuL, 0xB363FDC9uL, 0x804D8810uL},
+    {0x4462007DuL, 0x63B99CE7uL, 0x4CB5F5B7uL, 0xB8AB48A5uL, 0xF55EDDE7uL, 0x9EC673D2uL, 0x8CFAEFDAuL, 0xD1567F74uL,
+     0x0887BCECuL, 0x46381B6BuL, 0xE178F3C2uL, 0x694497CEuL, 0x1E6266CBuL, 0x5E6525E3uL, 0x697D6413uL, 0x5931DE26uL},
+    {0x1F17A34CuL, 0x14E49DA1uL, 0x235A1456uL, 0x5420AB39uL, 0x2F50363BuL, 0xB7637241uL, 0xC3FABB6EuL, 0x7B15D623uL,
+     0xE274E49CuL, 0xA0EF40B1uL, 0x96B1860AuL, 0x5CF50744uL, 0x66AFE5A4uL, 0xD6583FBFuL, 0xF47E3E9AuL, 0x44240510uL},
+    {0x1A93507AuL, 0x142B5502uL, 0x8D3C06CFuL, 0xB4CD1187uL, 0x91EC3F40uL, 0xDF70E76AuL, 0x4E7553C2uL, 0x484E81ADuL,
+     0x272E9D6EuL, 0x830F87B5uL, 0xC6FF514AuL, 0xEA1C93E5uL, 0xC4192A8EuL, 0x67CC2ADCuL, 0x42F4535AuL, 0xC77E27E2uL},
+    {0x48AC2840uL, 0xB5358B1EuL, 0xECBA9477uL, 0x18311294uL, 0xA6946B43uL, 0xDA58F990uL, 0x9AB41819uL, 0x3098BAF9uL,
+     0x4198DA52uL, 0x66C4C158uL, 0x146BFD1BuL, 0xAB4FC17CuL, 0xBF36A908uL, 0x2F0A4C3CuL, 0x58CF7838uL, 0x2AE9E34BuL},
+    {0x0CCCED58uL, 0x45EB40ECuL, 0x0DA44F98uL, 0x25CD4B9CuL, 0x871812C6uL, 0x43E06458uL, 0x16CEF651uL, 0x99F80D55uL,
+     0xCE6DC153uL, 0x571340C9uL, 0xD8665521uL, 0x138D5117uL, 0x4E07014DuL, 0xACDB45BCuL, 0x84B60B91uL, 0x2F34BB38uL},
+    {0x4A34F239uL, 0x417499E8uL, 0xB90402D5uL, 0x15FDB83CuL, 0x433AA832uL, 0xB75F46BFuL, 0x63215DB1uL, 0xB61E15AFuL,
+     0xA127F89AuL, 0xAABE59D4uL, 0x07E816DAuL, 0x5D541E0CuL, 0xA618B692uL, 0xAABA0659uL, 0x17266026uL, 0x55327733uL},
+    {0xD0C05199uL, 0x8CDA9CF2uL, 0xFAE78454uL, 0x502FBC22uL, 0xF572A182uL, 0xC0BDA9DFuL, 0x6158B372uL, 0x5F9B71B8uL,
+     0x2B82DD07uL, 0xE0F33A59uL, 0x9523032EuL, 0x76302735uL, 0xC4505A32uL, 0x7FE1A721uL, 0xF796409FuL, 0x7B6E3E82uL},
+
+    /* 16^56 * G */
+    {0x35D0B34AuL, 0xE3417BC0uL, 0x8327C0A7uL, 0x440B386BuL, 0xAC0362D1uL, 0x8FB7262DuL, 0xE0CDF943uL, 0x2C41114CuL,
+     0xAD95A0B1uL, 0x2BA5CEF1uL, 0x67D54362uL, 0xC09B37A8uL, 0x01E486C9uL, 0x26D6CDD2uL, 0x42FF9297uL, 0x20477ABFuL},
+    {0x292A9287uL, 0xA004DCB3uL, 0x77B092C7uL, 0xDDC15CF6uL, 0x806C0605uL, 0x083A8464uL, 0x3DB997B0uL, 0x4A68DF70uL,
+     0x05BF7DD0uL, 0x9C134E45uL, 0x8CCF7F8CuL, 0xA4E63D39uL, 0x41B5F8AFuL, 0xA6E6517FuL, 0xAD7BC1CCuL, 0xAA8B9342uL},
+    {0x1E706AD9uL, 0x126F35B5uL, 0xC3A9EBDFuL, 0xB99CEBB4uL, 0xBF608D90uL, 0xA75389AFuL, 0xC6C89858uL, 0x76113C4FuL,
+     0x97E2B5AAuL, 0x80DE8EB0uL, 0x63B91304uL, 0x7E1022CCuL, 0x6CCC066CuL, 0x3BDAB605uL, 0xB2EDF900uL, 0x33CBB144uL},
+    {0x7AF715D2uL, 0xC4176471uL, 0xD0134A96uL, 0xE2F7F594uL, 0xA41EC956uL, 0x2C1873EFuL, 0x77821304uL, 0xE4E7B4F6uL,
+     0x88D5374AuL, 0xE5C8FF97uL, 0x80823D5BuL, 0x2B915E63uL, 0xB2EE8FE2uL, 0xEA6BC755uL, 0xE7112651uL, 0x6657624CuL},
+    {0xDACE5ACAuL, 0x157AF101uL, 0x11A6A267uL, 0xC4FDBCF2uL, 0xC49C8609uL, 0xDADDF340uL, 0xE9604A65uL, 0x97E49F52uL,
+     0x937E2AD5uL, 0x9BE8E790uL, 0x326E17F1uL, 0x846E2508uL, 0x0BBBC0DCuL, 0x3F38007AuL, 0xB11E16D6uL, 0xCF03603FuL},
+    {0x7442F1D5uL, 0xD6F800E0uL, 0x66E0E3ABuL, 0x475607D1uL, 0xB7C64047uL, 0x82807F16uL, 0xA749883DuL, 0x8858E1E3uL,
+     0x8231EE10uL, 0x5859120BuL, 0x638A1ECEuL, 0x1B80E7EBuL, 0xC6AA73A4uL, 0xCB72525AuL, 0x844423ACuL, 0xA7CDEA3DuL},
+    {0xF8AE7C38uL, 0x5ED0C007uL, 0x3D740192uL, 0x6DB07A5CuL, 0x5FE36DB3uL, 0xBE5E9C2AuL, 0x76E95046uL, 0xD5B9D57AuL,
+     0x8EBA20F2uL, 0x54AC32E7uL, 0x71B9A352uL, 0xEF11CA8FuL, 0xFF98A658uL, 0x305E373EuL, 0x823EB667uL, 0xFFE5A100uL},
+    {0xE51732D2uL, 0x57477B11uL, 0x2538FC0EuL, 0xDFD6EB28uL, 0x3B39EEC5uL, 0x5C43B0CCuL, 0xCB36CC57uL, 0x6AF12778uL,
+     0x06C425AEuL, 0x70B0852DuL, 0x5C221B9BuL, 0x6DF92F8CuL, 0xCE826D9CuL, 0x6C8D4F9EuL, 0xB49359C3uL, 0xF59ABA7BuL},
+
+    /* 16^57 * G */
+    {0x421D3AA4uL, 0xC37E2C2EuL, 0xE84FA840uL, 0xF926407CuL, 0x1454E41CuL, 0x18ABC03DuL, 0x3F7AF644uL, 0x26605ECDuL,
+     0xD6A5EABFuL, 0x242341A6uL, 0x216B668EuL, 0x1EDB84F4uL, 0x04010102uL, 0xD836EDB8uL, 0x945E1D8CuL, 0x5B337CE7uL},
+    {0xD23DDC82uL, 0x4C076B86uL, 0x7E0143F0uL, 0x03FD344CuL, 0x317AF2C5uL, 0xA95362FFuL, 0xE18B7A4FuL, 0x0ADD3DB7uL,
+     0x8260E01BuL, 0x9C673E3FuL, 0x54A1CC91uL, 0xFBEB49E5uL, 0x92F2E433uL, 0x91351BF2uL, 0x851141EBuL, 0xC755E7ECuL},
+    {0xDA9F3804uL, 0x349AE368uL, 0xA164349CuL, 0x470F07FEuL, 0x8562BAA5uL, 0xD52F4CC9uL, 0x2B290DF3uL, 0xC74A9E86uL,
+     0x43471A24uL, 0xD3A1AA35uL, 0xB8194511uL, 0x239446BEuL, 0x81DCD44DuL, 0xBEC2DD00uL, 0xC42AC82DuL, 0xCA3D7F0FuL},
+    {0xF23206D5uL, 0x2BF5DB47uL, 0x1D260152uL, 0x2F6D3420uL, 0x3F8FF89AuL, 0x17B87653uL, 0x378FA458uL, 0x5157C30CuL,
+     0x2D4FB936uL, 0x7517C5C5uL, 0xE6518CDCuL, 0xEF22F7ACuL, 0xBF847A64uL, 0xDEB483E6uL, 0x92E0FA89uL, 0xF5084558uL},
+    {0x9B583160uL, 0xB418C2A6uL, 0xB4E59194uL, 0xBE74FCD4uL, 0x3C83E3FFuL, 0xF178EEAAuL, 0xE296F29BuL, 0xE051F895uL,
+     0x06CEB84AuL, 0xD0235238uL, 0xE111FE6BuL, 0x5ACE48CEuL, 0x1C045545uL, 0x40E43A49uL, 0xDD522146uL, 0xF3FA86DDuL},
+    {0x908EC5B5uL, 0x959616FAuL, 0xA01AB12DuL, 0x882D661DuL, 0x4382AE8AuL, 0xC49F6082uL, 0x5D133F5EuL, 0x5CDF92EBuL,
+     0x5EF6C9C1uL, 0x98CECC42uL, 0x664D84EEuL, 0xB52D6682uL, 0x6F25B8C4uL, 0x9E285ED8uL, 0x48DEBE88uL, 0xEB80CDC7uL},
+    {0xEC222BA0uL, 0x2D9794C1uL, 0x523E5D48uL, 0xC3DFF42FuL, 0x0FE4846BuL, 0x4A7CD570uL, 0xFF135174uL, 0xEFC5B113uL,
+     0xC6B05E85uL, 0x2630B25BuL, 0x654CD077uL, 0x0A6D3029uL, 0x32D8B89DuL, 0xB4F1F54FuL, 0x1627FC27uL, 0xDE3BAFF2uL},
+    {0xDF7304D4uL, 0xAB9659D8uL, 0xFF210E8EuL, 0xB71BCF1BuL, 0xD73FBD60uL, 0xA9A2438BuL, 0x5D11B4DEuL, 0x4595CD1FuL,
+     0x4835859DuL, 0x9C0D329AuL, 0x7DBB6E56uL, 0x4A0F0D2DuL, 0xDF928A4EuL, 0xC6038E5EuL, 0x8F5AD154uL, 0xC9429621uL},
+
+    /* 16^58 * G */
+    {0xF23F2D92uL, 0x91213462uL, 0x60B94078uL, 0x6CAB71BDuL, 0x176CDE20uL, 0x6BDD0A63uL, 0xEE4D54BCuL, 0x54C9B20CuL,
+     0x9F2AC02FuL, 0x3CD2D8AAuL, 0x206EEDB0uL, 0x03F8E617uL, 0x93086434uL, 0xC7F68E16uL, 0x92DD3DB9uL, 0x831469C5uL},
+    {0x3AE9C1BDuL, 0x7AA7A158uL, 0xE37CE240uL, 0xE0AF6D98uL, 0x28AB38B4uL, 0xE54342D9uL, 0x0A1C98CAuL, 0xE8B75007uL,
+     0xE02358F2uL, 0xEFCE86AFuL, 0xEA921228uL, 0x31B8B856uL, 0x0A1C67FCuL, 0x052A1912uL, 0xE3AEAD59uL, 0xB4069EA4uL},
+    {0xE36D0757uL, 0x4A9090CDuL, 0xD9A29382uL, 0xF722D7B1uL, 0x04B48DDFuL, 0xFB7FB04CuL, 0xEBE16F43uL, 0x628AD2A7uL,
+     0x20226040uL, 0xCD3FBFB5uL, 0x5104B6C4uL, 0x6C34ECB1uL, 0xC903C188uL, 0x30C0754EuL, 0x2D23CAB0uL, 0xEC336B08uL},
+    {0x558DF019uL, 0x9F51439EuL, 0xAC712B27uL, 0x230DA4BAuL, 0x55185A24uL, 0x518919E3uL, 0x84B78F50uL, 0x4DCEFCDDuL,
+     0xA47D4C5AuL, 0xA7D90FB2uL, 0xB30E009EuL, 0x55AC9ABFuL, 0x74EED273uL, 0xFD2FC359uL, 0xDBEA8FAFuL, 0xB72D824CuL},
+    {0xCBB13D1BuL, 0xD213F923uL, 0x5BFB9BFEuL, 0x98799F42uL, 0x701144A9uL, 0x1AE8DDC9uL, 0x4C5595EEuL, 0x0B8B3BB6uL,
+     0x3ECEBB21uL, 0x0EA9EF2EuL, 0x3671F9A7uL, 0x17CB6C4BuL, 0x726F1D1FuL, 0x47EF464FuL, 0x6943A276uL, 0x171B9484uL},
+    {0xDE7E5C19uL, 0x779B8552uL, 0xC1C0256CuL, 0xFAB28609uL, 0xABD4743DuL, 0x64F58EEEuL, 0x7B6CC93BuL, 0x4E8EF838uL,
+     0x4CB1BF3DuL, 0xEE650D26uL, 0x73DEDF61uL, 0x4C1F9D09uL, 0xBFB70CEDuL, 0xAEF7C9D7uL, 0x1641DE1EuL, 0x1EC0507EuL},
+    {0xA607419DuL, 0xC9941109uL, 0xBB6BCA80uL, 0xFAA71E62uL, 0x07C431F3uL, 0x34158C13uL, 0x992BC47AuL, 0x594ABEBCuL,
+     0xEB78399FuL, 0x6DFEA691uL, 0x3F42CBA4uL, 0x48AAFB35uL, 0x077C04F0uL, 0xEDCD65AFuL, 0xE884491AuL, 0x1A29A366uL},
+    {0xEF7D9289uL, 0x549DB2B5uL, 0x197F015AuL, 0x2480D4A8uL, 0xC40493B6uL, 0x61D5590BuL, 0x6F780331uL, 0x3A55B52EuL,
+     0x309EADB0uL, 0x40EB8115uL, 0x92E5C625uL, 0xDEA7DE5AuL, 0xCC6A3D5AuL, 0x64D631F0uL, 0x93E8DD61uL, 0x9D5E9D7CuL},
+
+    /* 16^59 * G */
+    {0x1E84E0E5uL, 0x19686041uL, 0xAEA34C93uL, 0xA5DB84D3uL, 0x7073A732uL, 0xF9D5BB19uL, 0x6BCFD7C0uL, 0xB8D2FE56uL,
+     0xF3EB82FAuL, 0x45775F36uL, 0xFDFF8B58uL, 0x8CB20CCCuL, 0x8374C110uL, 0x1659B65FuL, 0x330C789AuL, 0xB8B4A422uL},
+    {0xAF2EBC2FuL, 0xC4F4CDA3uL, 0xCB4EFE24uL, 0xA0AF843DuL, 0x9CCD10B1uL, 0x53B857C1uL, 0x914D3E04uL, 0xDDC9D1EBuL,
+     0x62771DEBuL, 0x7BDEC8BBuL, 0x91C5AA81uL, 0x829277AAuL, 0x832391AEuL, 0x7AF18DD6uL, 0xC71A84CAuL, 0x1740F316uL},
+    {0xCAB91F1EuL, 0x2D500910uL, 0x4D1CD216uL, 0xBEDD9E44uL, 0xEDD02252uL, 0xD634B74FuL, 0x1258617AuL, 0xBD60F8E1uL,
+     0x9E05614AuL, 0xD8C7537BuL, 0xE7AF5FC5uL, 0xFD26C766uL, 0x582BD926uL, 0x0660B581uL, 0xACF07FC8uL, 0x87019244uL},
+    {0xEEAF8C49uL, 0x8928E99AuL, 0x6E24D728uL, 0xEE7AA73DuL, 0xE72B156CuL, 0x4C5007C2uL, 0xED408A1DuL, 0x5FCF57C5uL,
+     0xB6057604uL, 0x9F719E39uL, 0xC2868BBFuL, 0x7D343C01uL, 0x7E103E2DuL, 0x2CCA254BuL, 0xF131BEA2uL, 0xE6EB38A9uL},
+    {0x0A981B0DuL, 0x0BA4E352uL, 0xBD1A41A4uL, 0x1C354CB3uL, 0xDF9FAB9CuL, 0x1AABAA3AuL, 0x53C418D5uL, 0x0701A7D1uL,
+     0xDCF2B921uL, 0xDD1A7CEFuL, 0xBCF48061uL, 0x6CEEF0B3uL, 0xDE25CCE6uL, 0x1083B598uL, 0xE90A5E34uL, 0x890A54C7uL},
+    {0x4F6D01B1uL, 0x405718DBuL, 0x8F11E8A0uL, 0xE73C6BC2uL, 0xA0591A3BuL, 0xAC11BB8CuL, 0x0ACC4531uL, 0x12D09A5AuL,
+     0xE7DE13F4uL, 0xCBF174EEuL, 0x044FD682uL, 0x177E2BE6uL, 0x1C48AF70uL, 0x65F574CBuL, 0x9961CB7CuL, 0xCE596692uL},
+    {0x048752A1uL, 0xC59EED6CuL, 0xA01341B4uL, 0x41F2702EuL, 0x9DC6B092uL, 0x6E35903BuL, 0x1F5B5B23uL, 0x4291ABA8uL,
+     0xA653D61DuL, 0x8173AA70uL, 0x4F2EB51EuL, 0xD1B648D4uL, 0x5AB93F8FuL, 0x31B7CE06uL, 0x99E2F4FEuL, 0xA55408EEuL},
+    {0x8BE762B4uL, 0xB33E624FuL, 0x058E3413uL, 0x2A9EE4D1uL, 0x67D805FAuL, 0x968E6369uL, 0x7DB8BFD7uL, 0x9848949BuL,
+     0xD23A8417uL, 0x5308D7E5uL, 0xF3E29DA5uL, 0x892F3B1DuL, 0x3DEE471FuL, 0xC95C139EuL, 0xD757E089uL, 0x8631594DuL},
+
+    /* 16^60 * G */
+    {0x1F095615uL, 0x1083E2EAuL, 0x14E68C33uL, 0x0A28AD77uL, 0x3D8818BEuL, 0x6BFC0252uL, 0xF35850CDuL, 0xB585113AuL,
+     0x30DF8AA1uL, 0x7D935F0BuL, 0x4AB7E3ACuL, 0xADDDA07CuL, 0x552F00CBuL, 0x92C34299uL, 0x2909DF6CuL, 0xC33ED1DEuL},
+    {0x3E07113CuL, 0x2DC40D48uL, 0x7D8B63AEuL, 0x6E4A5D39uL, 0x79684C2BuL, 0x5582A94BuL, 0x622DA26CuL, 0x932B33D4uL,
+     0x0DBBF08DuL, 0xF534F651uL, 0x64C23A52uL, 0x211D07C9uL, 0xEE5BDC9BuL, 0x0EEECE0FuL, 0xF7015558uL, 0xDF178168uL},
+    {0x83CDD60EuL, 0xABE7905AuL, 0xA1170184uL, 0x50602FB5uL, 0xB023642AuL, 0x689886CDuL, 0xA6E1FB00uL, 0xD568D090uL,
+     0x0259217FuL, 0x5B1922C7uL, 0xC43141E4uL, 0x93831CD9uL, 0x0C95F86EuL, 0xDFCA3587uL, 0x568AE828uL, 0xDEC2057AuL},
+    {0x913CC16DuL, 0x568F8925uL, 0xE1A26F5AuL, 0x18BC5B6DuL, 0xF5F499AEuL, 0xDFA413BEuL, 0xC3F0AE84uL, 0xF8835DECuL,
+     0x65A40AB0uL, 0xB6E60BD8uL, 0x194B377EuL, 0x65596439uL, 0x92084A69uL, 0xBCD85625uL, 0x4F23EDE0uL, 0x5CE433B9uL},
+    {0x42E06189uL, 0x860D523DuL, 0x4E3AFF13uL, 0xBF077941uL, 0xC1B20650uL, 0x0B616DCAuL, 0x2131300DuL, 0xE66DD6D1uL,
+     0xFF99ABDEuL, 0xD4A0FD67uL, 0xC7AAC50DuL, 0xC9903550uL, 0x7C46B2D7uL, 0x022ECF8BuL, 0x3ABF92AFuL, 0x3333B1E8uL},
+    {0x84D6365DuL, 0xC0DA65E7uL, 0x8F759FB8uL, 0xBCB7443FuL, 0x7AE81930uL, 0x35C712B1uL, 0x4C6E08ABuL, 0x80428DFFuL,
+     0xA4FAF843uL, 0xF19DAFEFuL, 0xFFA9855FuL, 0xCED8538DuL, 0xBE3AC7CEuL, 0x20AC409CuL, 0x882DA71EuL, 0x358C1FB6uL},
+    {0xBE42A582uL, 0xEFECDEF7uL, 0x65046BE6uL, 0xD3FC6080uL, 0x09E8DBA9uL, 0xC9AF13C8uL, 0x641491FFuL, 0x1E6C9847uL,
+     0xD30C31F7uL, 0x3B574925uL, 0xAC2A2122uL, 0xB7EB72BAuL, 0xEF0859E7uL, 0x776A0DACuL, 0x21900942uL, 0x06FEC314uL},
+    {0x7E50122BuL, 0x324794B0uL, 0x4AF07CA5uL, 0xDD744F8BuL, 0xD63FC97BuL, 0x30A12F08uL, 0x76626D9DuL, 0x39650F1AuL,
+     0x1FA38477uL, 0x101B47F7uL, 0xD4DC124FuL, 0x3D815F19uL, 0xB26EB58AuL, 0x1569AE95uL, 0x95FB1887uL, 0xC3CDE188uL},
+
+    /* 16^61 * G */
+    {0x2F41DEFFuL, 0x02B37A95uL, 0xE63B89B7uL, 0x0E44A59AuL, 0x143FF951uL, 0x673257DCuL, 0xD752BAF4uL, 0x19C02205uL,
+     0xC4B7D692uL, 0x46C23069uL, 0xFD1502ACuL, 0x2E6392C3uL, 0x1B220846uL, 0x6057B1A2uL, 0x0C1B5B63uL, 0xE51FF946uL},
+    {0x566C5C43uL, 0x6E85CB51uL, 0x3597F046uL, 0xCFF9C919uL, 0x4994D94AuL, 0x9354E90CuL, 0x2147927DuL, 0xE0A39332uL,
+     0x0DC1EB2BuL, 0x8427FAC1uL, 0x2FF319FAuL, 0x88CFD8C2uL, 0x01965274uL, 0xE2D4E684uL, 0x67AAA746uL, 0xFA2E067DuL},
+    {0x5B0F7BD4uL, 0xB9DC857CuL, 0x108EA1CDuL, 0x6990C2C9uL, 0xB984C7A9uL, 0x84730B83uL, 0xEAB18A78uL, 0x552723D2uL,
+     0x919BA0F9uL, 0x9752C2E2uL, 0x4BF40890uL, 0x075A3BD9uL, 0xA6D98212uL, 0x71E52A04uL, 0x9F18A4C8uL, 0x3FB6607AuL},
+    {0x3E5F9F11uL, 0xB6D92A7FuL, 0xD6CB3B8EuL, 0x9AFE153AuL, 0xDDF800BDuL, 0x4D1A6DD7uL, 0xCAF17E19uL, 0xF6C13CC0uL,
+     0x325FC3EEuL, 0x15F6C58EuL, 0xA31DC3B2uL, 0x71095400uL, 0xAFA3D3E7uL, 0x168E7C07uL, 0x94C7AE2DuL, 0x3F8417A1uL},
+    {0x6CE400BBuL, 0xF47B7521uL, 0xCAF07D99uL, 0xF72919F7uL, 0x00CE62E0uL, 0x95B86E06uL, 0x8FCFD00EuL, 0x11872BAFuL,
+     0x211F7DC6uL, 0x049B21EBuL, 0x54EBD6F6uL, 0xB8900E56uL, 0x162D78DAuL, 0x7C38CEA4uL, 0x0BFA3DA0uL, 0x9A586C9EuL},
+    {0x813B230DuL, 0xEC234772uL, 0x17344427uL, 0x634D0F5FuL, 0xD77FC56AuL, 0x11548AB1uL, 0xCE06AF77uL, 0x7FAB1750uL,
+     0x4F7C4F83uL, 0xB62C10A7uL, 0x220A67D9uL, 0xA7D2EDC4uL, 0x921209A0uL, 0x1C404170uL, 0xFACE59F0uL, 0x0B9815A0uL},
+    {0x51C3EBE5uL, 0xAD3883E1uL, 0xD25D7BE8uL, 0xDB14D5C7uL, 0x558EA8C9uL, 0x23E44911uL, 0x3F45C6ABuL, 0x3A68529FuL,
+     0x149F75B8uL, 0xEB18A1DCuL, 0x079C7CB2uL, 0x9B8946A1uL, 0x1157A94EuL, 0x27AD2A19uL, 0x1106F85AuL, 0x84B14F46uL},
+    {0x319540C3uL, 0x2842589BuL, 0xA283D6F8uL, 0x18490F59uL, 0xDAAE9FCBuL, 0xA2731F84uL, 0xC3683BA0uL, 0x3DB6D960uL,
+     0x14611069uL, 0xC85C63BBuL, 0x0788BF05uL, 0xB19436AFuL, 0x347460D2uL, 0x905459DFuL, 0xE11A7DB1uL, 0x73F6E094uL},
+
+    /* 16^62 * G */
+    {0xEE3C76CBuL, 0xF306A3C8uL, 0xD32A1F6EuL, 0x3CF11623uL, 0x6863E956uL, 0xE6D5AB64uL, 0x5C005C26uL, 0x3B8A4CBEuL,
+     0x9CE6BB27uL, 0xDCD529A5uL, 0x04D4B16FuL, 0xC4AFAA52uL, 0x7923798DuL, 0xB0624A26uL, 0x6B307FABuL, 0x85E56DF6uL},
+    {0x4E4CA463uL, 0xB2330FEFuL, 0x3566CC63uL, 0xBCEF7287uL, 0xCF780900uL, 0xD161D2CAuL, 0x5B54827DuL, 0x135DC539uL,
+     0x27BF1BC6uL, 0x638F052EuL, 0x07DFA06CuL, 0x10A224F0uL, 0x6D3321DAuL, 0xE973586DuL, 0x26152C8FuL, 0x8B0C5738uL},
+    {0x9884AAF7uL, 0x89689595uL, 0x07B348A6uL, 0xB1959BE3uL, 0x3C147C87uL, 0x96250E57uL, 0xDD0C61F8uL, 0xAE0EFB3AuL,
+     0xCA8C325EuL, 0xED00745EuL, 0xECFF3F70uL, 0x3C911696uL, 0x319AD41DuL, 0x73ACBC65uL, 0xF0B1C7EFuL, 0x7B01A020uL},
+    {0x23A5D896uL, 0x9910BA6BuL, 0x7FE4364EuL, 0x1FE19E35uL, 0x9A33C677uL, 0x6E1DA8C3uL, 0x29FD9FD0uL, 0x15B4488BuL,
+     0x1A1F22BFuL, 0x1F439254uL, 0xAB8163E8uL, 0x920A8A70uL, 0x07E5658EuL, 0x3FD1B249uL, 0xB6EC839BuL, 0xF2C4F79CuL},
+    {0x224C08DCuL, 0x262143B5uL, 0x81B50C91uL, 0x2BBB09B4uL, 0xACA8C84FuL, 0xC16ED709uL, 0xB2850CA8uL, 0xA6210D9DuL,
+     0x09CB54D6uL, 0x6D8DF67AuL, 0x500919A4uL, 0x91EEF6E0uL, 0x0F132857uL, 0x90F61381uL, 0xF8D5028BuL, 0x9ACEDE47uL},
+    {0x1416A6A5uL, 0x84CEA069uL, 0x43EF881CuL, 0x8F860C79uL, 0x38038A5DuL, 0x41311F8AuL, 0xFC612067uL, 0xE78C2EC0uL,
+     0x5AD73581uL, 0x494D2E81uL, 0x59604097uL, 0xB4CC9E00uL, 0xF3612CBAuL, 0xFF558AECuL, 0x9E36C39EuL, 0x35BEEF7AuL},
+    {0xDE673629uL, 0x45E21446uL, 0x703C2D21uL, 0x57F7AA1EuL, 0x98C868C7uL, 0xA0E99B7FuL, 0x8B641676uL, 0x4E42F66DuL,
+     0x91077896uL, 0x602884DCuL, 0xC2C9885BuL, 0xA0D690CFuL, 0x3B9A5187uL, 0xFEB4DA33uL, 0x153C87EEuL, 0x5F789598uL},
+    {0x76497EE8uL, 0x8B5C619CuL, 0xC717370EuL, 0x5D2B0AC6uL, 0x4FCF68E1uL, 0x98204CB6uL, 0x62BC6792uL, 0x0BDEC211uL,
+     0xA63B1011uL, 0x6973CCEFuL, 0xE0DE1AC5uL, 0xF9E3FA97uL, 0x3D0E0C8BuL, 0x5EFB693EuL, 0xD2D4FCB4uL, 0x037248E9uL},
+
+    /* 16^63 * G */
+    {0x1EC34F9EuL, 0x80802DC9uL, 0x33810603uL, 0xD8772D35uL, 0x530CB4F3uL, 0x3F06D66CuL, 0xC475C129uL, 0x7BE5ED0DuL,
+     0x31E82B10uL, 0xCB9E3C19uL, 0xC9FF6B4CuL, 0xC63D2857uL, 0x92A1B45EuL, 0xB92118C6uL, 0x7285BBCAuL, 0x0AEC4414uL},
+    {0x1E29A3EFuL, 0xFC189AE7uL, 0x4C93302EuL, 0xCBE906F0uL, 0xCEAAE10EuL, 0xD0107914uL, 0xB68E19F8uL, 0xB7A23F34uL,
+     0xEFD2119DuL, 0xE9D875C2uL, 0xFCADC9C8uL, 0x03198C6EuL, 0x4DA17113uL, 0x65591BF6uL, 0x3D443038uL, 0x3CF0BBF8uL},
+    {0x2B724759uL, 0xAE485BB7uL, 0xB2D4C63AuL, 0x945353E1uL, 0xDE7D6F2CuL, 0x82159D07uL, 0x4EC5B109uL, 0x389CAEF3uL,
+     0xDB65EF14uL, 0x4A8EBB53uL, 0xDD99DE43uL, 0x2DC2CB7EuL, 0x83F2405FuL, 0x816FA3EDuL, 0xC14208A3uL, 0x73429BB9uL},
+    {0xB01E6E27uL, 0xB618D590uL, 0xE180B2DCuL, 0x047E2CCDuL, 0x04AEA4A9uL, 0xD1B299B5uL, 0x9FA403A4uL, 0x412C9E1EuL,
+     0x79407552uL, 0x88D28A36uL, 0xF332B8E3uL, 0x49C50136uL, 0xE668DE19uL, 0x3A1B6FCCuL, 0x75122B97uL, 0x178851BCuL},
+    {0xFB85FA4CuL, 0xB1E13752uL, 0x383C8CE9uL, 0xD61257CEuL, 0xD2F74DAEuL, 0xD43DA670uL, 0xBF846BBBuL, 0xA35AA23FuL,
+     0x4421FC83uL, 0x5E74235DuL, 0xC363473BuL, 0xF6DF8EE0uL, 0x3C4AA158uL, 0x34D7F52AuL, 0x9BC6D22EuL, 0x50D05AABuL},
+    {0xA64785F4uL, 0x8C56E735uL, 0x5F29CD07uL, 0xBC56637BuL, 0x3EE35067uL, 0x53B2BB80uL, 0xDC919270uL, 0x50235A0FuL,
+     0xF2C4AA65uL, 0x191AB6D8uL, 0x8396023BuL, 0xC3475831uL, 0xF0F805BAuL, 0x80400BA5uL, 0x5EC0F80FuL, 0x8881065BuL},
+    {0xCC1B5E83uL, 0xC370E522uL, 0x860B8BFBuL, 0xDE2D4AD1uL, 0x67B256DFuL, 0xAD364DF0uL, 0xE0138997uL, 0x8F12502EuL,
+     0x7783920AuL, 0x503FA0DCuL, 0xC0BC866AuL, 0xE80014ADuL, 0xD3064BA6uL, 0x3F89B744uL, 0xCBA5DBA5uL, 0x03511DCDuL},
+    {0x95A7B1A2uL, 0x197DD46DuL, 0x3C6341FBuL, 0x9C4E7AD6uL, 0x484C2ECEuL, 0x426ECA29uL, 0xDE7F4F8AuL, 0x9211E489uL,
+     0xC78EF1F4uL, 0x14997F6EuL, 0x06574586uL, 0x2B2C0910uL, 0x1C3EEDE8uL, 0x17286A6EuL, 0x0F60E018uL, 0x25F92E47uL}
+};
+
+#endif /* P256_BASETABLE_H_ */
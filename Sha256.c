@@ -0,0 +1,191 @@
+/**********************************************************************************************************************
+ * \file Sha256.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ * 
+ * SHA-256 implementation
+ *********************************************************************************************************************/
+
+#include "Sha256.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define ROTR(x, n)                  (((x) >> (n)) | ((x) << (32u - (n))))
+#define CH(x, y, z)                 ((z) ^ ((x) & ((y) ^ (z))))
+#define MAJ(x, y, z)                (((x) & (y)) | ((z) & ((x) | (y))))
+#define BIG_SIGMA0(x)               (ROTR((x), 2u) ^ ROTR((x), 13u) ^ ROTR((x), 22u))
+#define BIG_SIGMA1(x)               (ROTR((x), 6u) ^ ROTR((x), 11u) ^ ROTR((x), 25u))
+#define SMALL_SIGMA0(x)             (ROTR((x), 7u) ^ ROTR((x), 18u) ^ ((x) >> 3))
+#define SMALL_SIGMA1(x)             (ROTR((x), 17u) ^ ROTR((x), 19u) ^ ((x) >> 10))
+
+/* Next schedule word in place of w[j], the 16 words are a ring over the 64 rounds */
+#define SCHEDULE(w, j)                                                                                              \
+    ((w)[(j)] += SMALL_SIGMA1((w)[((j) + 14u) & 15u]) + (w)[((j) + 9u) & 15u] + SMALL_SIGMA0((w)[((j) + 1u) & 15u]))
+
+/* One round; instead of moving all eight words the caller renames them, so only d and h are written */
+#define ROUND(a, b, c, d, e, f, g, h, k, w)                                                                         \
+    do                                                                                                              \
+    {                                                                                                               \
+        uint32 t1 = (h) + BIG_SIGMA1(e) + CH((e), (f), (g)) + (k) + (w);                                            \
+        (d) += t1;                                                                                                  \
+        (h)  = t1 + BIG_SIGMA0(a) + MAJ((a), (b), (c));                                                             \
+    } while (0)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static const uint32 g_sha256K[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Compression function, with a 16 word message schedule and 16 unrolled rounds per pass */
+static void transform(uint32 *state, const uint8 *block)
+{
+    uint32 w[16];
+    uint32 a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32 e = state[4], f = state[5], g = state[6], h = state[7];
+    uint32 i;
+    uint32 j;
+
+    for (i = 0; i < 16u; i++)
+    {
+        w[i] = ((uint32)block[4u * i] << 24) | ((uint32)block[4u * i + 1u] << 16) |
+               ((uint32)block[4u * i + 2u] << 8) | (uint32)block[4u * i + 3u];
+    }
+
+    for (i = 0; i < 64u; i += 16u)
+    {
+        if (i != 0u)
+        {
+            for (j = 0; j < 16u; j++)
+                SCHEDULE(w, j);
+        }
+
+        ROUND(a, b, c, d, e, f, g, h, g_sha256K[i + 0u], w[0]);
+        ROUND(h, a, b, c, d, e, f, g, g_sha256K[i + 1u], w[1]);
+        ROUND(g, h, a, b, c, d, e, f, g_sha256K[i + 2u], w[2]);
+        ROUND(f, g, h, a, b, c, d, e, g_sha256K[i + 3u], w[3]);
+        ROUND(e, f, g, h, a, b, c, d, g_sha256K[i + 4u], w[4]);
+        ROUND(d, e, f, g, h, a, b, c, g_sha256K[i + 5u], w[5]);
+        ROUND(c, d, e, f, g, h, a, b, g_sha256K[i + 6u], w[6]);
+        ROUND(b, c, d, e, f, g, h, a, g_sha256K[i + 7u], w[7]);
+        ROUND(a, b, c, d, e, f, g, h, g_sha256K[i + 8u], w[8]);
+        ROUND(h, a, b, c, d, e, f, g, g_sha256K[i + 9u], w[9]);
+        ROUND(g, h, a, b, c, d, e, f, g_sha256K[i + 10u], w[10]);
+        ROUND(f, g, h, a, b, c, d, e, g_sha256K[i + 11u], w[11]);
+        ROUND(e, f, g, h, a, b, c, d, g_sha256K[i + 12u], w[12]);
+        ROUND(d, e, f, g, h, a, b, c, g_sha256K[i + 13u], w[13]);
+        ROUND(c, d, e, f, g, h, a, b, g_sha256K[i + 14u], w[14]);
+        ROUND(b, c, d, e, f, g, h, a, g_sha256K[i + 15u], w[15]);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+void Sha256_Init(Sha256_t *ctx)
+{
+    ctx->state[0]    = 0x6A09E667;
+    ctx->state[1]    = 0xBB67AE85;
+    ctx->state[2]    = 0x3C6EF372;
+    ctx->state[3]    = 0xA54FF53A;
+    ctx->state[4]    = 0x510E527F;
+    ctx->state[5]    = 0x9B05688C;
+    ctx->state[6]    = 0x1F83D9AB;
+    ctx->state[7]    = 0x5BE0CD19;
+    ctx->length      = 0;
+    ctx->blockLength = 0;
+}
+
+void Sha256_Update(Sha256_t *ctx, const uint8 *data, uint32 length)
+{
+    ctx->length += length;
+
+    if (ctx->blockLength > 0u)
+    {
+        uint32 n = SHA256_BLOCK_SIZE - ctx->blockLength;
+
+        if (n > length)
+            n = length;
+
+        memcpy(&ctx->block[ctx->blockLength], data, n);
+        ctx->blockLength += n;
+        data             += n;
+        length           -= n;
+
+        if (ctx->blockLength < SHA256_BLOCK_SIZE)
+            return;
+
+        transform(ctx->state, ctx->block);
+        ctx->blockLength = 0;
+    }
+
+    /* Whole blocks straight from the input */
+    while (length >= SHA256_BLOCK_SIZE)
+    {
+        transform(ctx->state, data);
+        data   += SHA256_BLOCK_SIZE;
+        length -= SHA256_BLOCK_SIZE;
+    }
+
+    memcpy(ctx->block, data, length);
+    ctx->blockLength = length;
+}
+
+void Sha256_Final(Sha256_t *ctx, uint8 *digest)
+{
+    uint64 bits = ctx->length * 8u;
+    uint32 i;
+
+    ctx->block[ctx->blockLength++] = 0x80;
+    if (ctx->blockLength > SHA256_BLOCK_SIZE - 8u)
+    {
+        memset(&ctx->block[ctx->blockLength], 0, SHA256_BLOCK_SIZE - ctx->blockLength);
+        transform(ctx->state, ctx->block);
+        ctx->blockLength = 0;
+    }
+
+    memset(&ctx->block[ctx->blockLength], 0, SHA256_BLOCK_SIZE - 8u - ctx->blockLength);
+    for (i = 0; i < 8u; i++)
+        ctx->block[SHA256_BLOCK_SIZE - 1u - i] = (uint8)(bits >> (8u * i));
+    transform(ctx->state, ctx->block);
+
+    for (i = 0; i < 8u; i++)
+    {
+        digest[4u * i]      = (uint8)(ctx->state[i] >> 24);
+        digest[4u * i + 1u] = (uint8)(ctx->state[i] >> 16);
+        digest[4u * i + 2u] = (uint8)(ctx->state[i] >> 8);
+        digest[4u * i + 3u] = (uint8)ctx->state[i];
+    }
+}
+
+void Sha256_Calculate(const uint8 *data, uint32 length, uint8 *digest)
+{
+    Sha256_t ctx;
+
+    Sha256_Init(&ctx);
+    Sha256_Update(&ctx, data, length);
+    Sha256_Final(&ctx, digest);
+}
@@ -0,0 +1,66 @@
+/**********************************************************************************************************************
+ * \file Sha256.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ * 
+ * SHA-256 (FIPS 180-4) with a streaming init/update/final interface, used to hash OTA image chunks.
+ *********************************************************************************************************************/
+
+#ifndef SHA256_H_
+#define SHA256_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define SHA256_DIGEST_SIZE                       32
+#define SHA256_BLOCK_SIZE                        64
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint32 state[8];
+    uint64 length;                          /* Bytes hashed so far           */
+    uint32 blockLength;                     /* Bytes pending in block        */
+    uint8  block[SHA256_BLOCK_SIZE];
+} Sha256_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Start a new hash
+ * \param ctx Hash state
+ */
+void Sha256_Init(Sha256_t *ctx);
+
+/**
+ * \brief Hash more data
+ * \param ctx Hash state
+ * \param data Input data
+ * \param length Number of bytes
+ */
+void Sha256_Update(Sha256_t *ctx, const uint8 *data, uint32 length);
+
+/**
+ * \brief Complete the hash
+ * \param ctx Hash state, must be initialized again before reuse
+ * \param digest Output, SHA256_DIGEST_SIZE bytes
+ */
+void Sha256_Final(Sha256_t *ctx, uint8 *digest);
+
+/**
+ * \brief Hash a buffer
+ * \param data Input data
+ * \param length Number of bytes
+ * \param digest Output, SHA256_DIGEST_SIZE bytes
+ */
+void Sha256_Calculate(const uint8 *data, uint32 length, uint8 *digest);
+
+#endif /* SHA256_H_ */
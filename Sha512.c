@@ -0,0 +1,213 @@
+/**********************************************************************************************************************
+ * \file Sha512.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * SHA-512 implementation
+ *********************************************************************************************************************/
+
+#include "Sha512.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define ROTR(x, n)                  (((x) >> (n)) | ((x) << (64u - (n))))
+#define CH(x, y, z)                 ((z) ^ ((x) & ((y) ^ (z))))
+#define MAJ(x, y, z)                (((x) & (y)) | ((z) & ((x) | (y))))
+#define BIG_SIGMA0(x)               (ROTR((x), 28u) ^ ROTR((x), 34u) ^ ROTR((x), 39u))
+#define BIG_SIGMA1(x)               (ROTR((x), 14u) ^ ROTR((x), 18u) ^ ROTR((x), 41u))
+#define SMALL_SIGMA0(x)             (ROTR((x), 1u) ^ ROTR((x), 8u) ^ ((x) >> 7))
+#define SMALL_SIGMA1(x)             (ROTR((x), 19u) ^ ROTR((x), 61u) ^ ((x) >> 6))
+
+/* Same ring schedule and renamed rounds as in Sha256.c */
+#define SCHEDULE(w, j)                                                                                              \
+    ((w)[(j)] += SMALL_SIGMA1((w)[((j) + 14u) & 15u]) + (w)[((j) + 9u) & 15u] + SMALL_SIGMA0((w)[((j) + 1u) & 15u]))
+
+#define ROUND(a, b, c, d, e, f, g, h, k, w)                                                                         \
+    do                                                                                                              \
+    {                                                                                                               \
+        uint64 t1 = (h) + BIG_SIGMA1(e) + CH((e), (f), (g)) + (k) + (w);                                            \
+        (d) += t1;                                                                                                  \
+        (h)  = t1 + BIG_SIGMA0(a) + MAJ((a), (b), (c));                                                             \
+    } while (0)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static const uint64 g_sha512K[80] = {
+    0x428A2F98D728AE22ULL, 0x7137449123EF65CDULL, 0xB5C0FBCFEC4D3B2FULL, 0xE9B5DBA58189DBBCULL,
+    0x3956C25BF348B538ULL, 0x59F111F1B605D019ULL, 0x923F82A4AF194F9BULL, 0xAB1C5ED5DA6D8118ULL,
+    0xD807AA98A3030242ULL, 0x12835B0145706FBEULL, 0x243185BE4EE4B28CULL, 0x550C7DC3D5FFB4E2ULL,
+    0x72BE5D74F27B896FULL, 0x80DEB1FE3B1696B1ULL, 0x9BDC06A725C71235ULL, 0xC19BF174CF692694ULL,
+    0xE49B69C19EF14AD2ULL, 0xEFBE4786384F25E3ULL, 0x0FC19DC68B8CD5B5ULL, 0x240CA1CC77AC9C65ULL,
+    0x2DE92C6F592B0275ULL, 0x4A7484AA6EA6E483ULL, 0x5CB0A9DCBD41FBD4ULL, 0x76F988DA831153B5ULL,
+    0x983E5152EE66DFABULL, 0xA831C66D2DB43210ULL, 0xB00327C898FB213FULL, 0xBF597FC7BEEF0EE4ULL,
+    0xC6E00BF33DA88FC2ULL, 0xD5A79147930AA725ULL, 0x06CA6351E003826FULL, 0x142929670A0E6E70ULL,
+    0x27B70A8546D22FFCULL, 0x2E1B21385C26C926ULL, 0x4D2C6DFC5AC42AEDULL, 0x53380D139D95B3DFULL,
+    0x650A73548BAF63DEULL, 0x766A0ABB3C77B2A8ULL, 0x81C2C92E47EDAEE6ULL, 0x92722C851482353BULL,
+    0xA2BFE8A14CF10364ULL, 0xA81A664BBC423001ULL, 0xC24B8B70D0F89791ULL, 0xC76C51A30654BE30ULL,
+    0xD192E819D6EF5218ULL, 0xD69906245565A910ULL, 0xF40E35855771202AULL, 0x106AA07032BBD1B8ULL,
+    0x19A4C116B8D2D0C8ULL, 0x1E376C085141AB53ULL, 0x2748774CDF8EEB99ULL, 0x34B0BCB5E19B48A8ULL,
+    0x391C0CB3C5C95A63ULL, 0x4ED8AA4AE3418ACBULL, 0x5B9CCA4F7763E373ULL, 0x682E6FF3D6B2B8A3ULL,
+    0x748F82EE5DEFB2FCULL, 0x78A5636F43172F60ULL, 0x84C87814A1F0AB72ULL, 0x8CC702081A6439ECULL,
+    0x90BEFFFA23631E28ULL, 0xA4506CEBDE82BDE9ULL, 0xBEF9A3F7B2C67915ULL, 0xC67178F2E372532BULL,
+    0xCA273ECEEA26619CULL, 0xD186B8C721C0C207ULL, 0xEADA7DD6CDE0EB1EULL, 0xF57D4F7FEE6ED178ULL,
+    0x06F067AA72176FBAULL, 0x0A637DC5A2C898A6ULL, 0x113F9804BEF90DAEULL, 0x1B710B35131C471BULL,
+    0x28DB77F523047D84ULL, 0x32CAAB7B40C72493ULL, 0x3C9EBE0A15C9BEBCULL, 0x431D67C49C100D4CULL,
+    0x4CC5D4BECB3E42B6ULL, 0x597F299CFC657E2AULL, 0x5FCB6FAB3AD6FAECULL, 0x6C44198C4A475817ULL
+};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static uint64 load64(const uint8 *bytes)
+{
+    uint64 value = 0;
+    uint32 i;
+
+    for (i = 0; i < 8u; i++)
+        value = (value << 8) | bytes[i];
+
+    return value;
+}
+
+static void store64(uint8 *bytes, uint64 value)
+{
+    uint32 i;
+
+    for (i = 0; i < 8u; i++)
+        bytes[7u - i] = (uint8)(value >> (8u * i));
+}
+
+/* Compression function, 80 rounds in five passes of 16 */
+static void transform(uint64 *state, const uint8 *block)
+{
+    uint64 w[16];
+    uint64 a = state[0], b = state[1], c = state[2], d = state[3];
+    uint64 e = state[4], f = state[5], g = state[6], h = state[7];
+    uint32 i;
+    uint32 j;
+
+    for (i = 0; i < 16u; i++)
+        w[i] = load64(&block[8u * i]);
+
+    for (i = 0; i < 80u; i += 16u)
+    {
+        if (i != 0u)
+        {
+            for (j = 0; j < 16u; j++)
+                SCHEDULE(w, j);
+        }
+
+        ROUND(a, b, c, d, e, f, g, h, g_sha512K[i + 0u], w[0]);
+        ROUND(h, a, b, c, d, e, f, g, g_sha512K[i + 1u], w[1]);
+        ROUND(g, h, a, b, c, d, e, f, g_sha512K[i + 2u], w[2]);
+        ROUND(f, g, h, a, b, c, d, e, g_sha512K[i + 3u], w[3]);
+        ROUND(e, f, g, h, a, b, c, d, g_sha512K[i + 4u], w[4]);
+        ROUND(d, e, f, g, h, a, b, c, g_sha512K[i + 5u], w[5]);
+        ROUND(c, d, e, f, g, h, a, b, g_sha512K[i + 6u], w[6]);
+        ROUND(b, c, d, e, f, g, h, a, g_sha512K[i + 7u], w[7]);
+        ROUND(a, b, c, d, e, f, g, h, g_sha512K[i + 8u], w[8]);
+        ROUND(h, a, b, c, d, e, f, g, g_sha512K[i + 9u], w[9]);
+        ROUND(g, h, a, b, c, d, e, f, g_sha512K[i + 10u], w[10]);
+        ROUND(f, g, h, a, b, c, d, e, g_sha512K[i + 11u], w[11]);
+        ROUND(e, f, g, h, a, b, c, d, g_sha512K[i + 12u], w[12]);
+        ROUND(d, e, f, g, h, a, b, c, g_sha512K[i + 13u], w[13]);
+        ROUND(c, d, e, f, g, h, a, b, g_sha512K[i + 14u], w[14]);
+        ROUND(b, c, d, e, f, g, h, a, g_sha512K[i + 15u], w[15]);
+    }
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+    state[5] += f;
+    state[6] += g;
+    state[7] += h;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+void Sha512_Init(Sha512_t *ctx)
+{
+    ctx->state[0]    = 0x6A09E667F3BCC908ULL;
+    ctx->state[1]    = 0xBB67AE8584CAA73BULL;
+    ctx->state[2]    = 0x3C6EF372FE94F82BULL;
+    ctx->state[3]    = 0xA54FF53A5F1D36F1ULL;
+    ctx->state[4]    = 0x510E527FADE682D1ULL;
+    ctx->state[5]    = 0x9B05688C2B3E6C1FULL;
+    ctx->state[6]    = 0x1F83D9ABFB41BD6BULL;
+    ctx->state[7]    = 0x5BE0CD19137E2179ULL;
+    ctx->length      = 0;
+    ctx->blockLength = 0;
+}
+
+void Sha512_Update(Sha512_t *ctx, const uint8 *data, uint32 length)
+{
+    ctx->length += length;
+
+    if (ctx->blockLength > 0u)
+    {
+        uint32 n = SHA512_BLOCK_SIZE - ctx->blockLength;
+
+        if (n > length)
+            n = length;
+
+        memcpy(&ctx->block[ctx->blockLength], data, n);
+        ctx->blockLength += n;
+        data             += n;
+        length           -= n;
+
+        if (ctx->blockLength < SHA512_BLOCK_SIZE)
+            return;
+
+        transform(ctx->state, ctx->block);
+        ctx->blockLength = 0;
+    }
+
+    /* Whole blocks straight from the input */
+    while (length >= SHA512_BLOCK_SIZE)
+    {
+        transform(ctx->state, data);
+        data   += SHA512_BLOCK_SIZE;
+        length -= SHA512_BLOCK_SIZE;
+    }
+
+    memcpy(ctx->block, data, length);
+    ctx->blockLength = length;
+}
+
+void Sha512_Final(Sha512_t *ctx, uint8 *digest)
+{
+    uint32 i;
+
+    ctx->block[ctx->blockLength++] = 0x80;
+    if (ctx->blockLength > SHA512_BLOCK_SIZE - 16u)
+    {
+        memset(&ctx->block[ctx->blockLength], 0, SHA512_BLOCK_SIZE - ctx->blockLength);
+        transform(ctx->state, ctx->block);
+        ctx->blockLength = 0;
+    }
+
+    /* 128-bit length in bits, the upper half only holds the top bits of the byte count */
+    memset(&ctx->block[ctx->blockLength], 0, SHA512_BLOCK_SIZE - 16u - ctx->blockLength);
+    store64(&ctx->block[SHA512_BLOCK_SIZE - 16u], ctx->length >> 61);
+    store64(&ctx->block[SHA512_BLOCK_SIZE - 8u], ctx->length << 3);
+    transform(ctx->state, ctx->block);
+
+    for (i = 0; i < 8u; i++)
+        store64(&digest[8u * i], ctx->state[i]);
+}
+
+void Sha512_Calculate(const uint8 *data, uint32 length, uint8 *digest)
+{
+    Sha512_t ctx;
+
+    Sha512_Init(&ctx);
+    Sha512_Update(&ctx, data, length);
+    Sha512_Final(&ctx, digest);
+}
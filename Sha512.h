@@ -0,0 +1,67 @@
+/**********************************************************************************************************************
+ * \file Sha512.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * SHA-512 (FIPS 180-4) with the same streaming init/update/final interface as Sha256.h. Needed by Ed25519 and for
+ * image digests where a 256-bit security level is required.
+ *********************************************************************************************************************/
+
+#ifndef SHA512_H_
+#define SHA512_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define SHA512_DIGEST_SIZE                       64
+#define SHA512_BLOCK_SIZE                        128
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint64 state[8];
+    uint64 length;                          /* Bytes hashed so far           */
+    uint32 blockLength;                     /* Bytes pending in block        */
+    uint8  block[SHA512_BLOCK_SIZE];
+} Sha512_t;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Start a new hash
+ * \param ctx Hash state
+ */
+void Sha512_Init(Sha512_t *ctx);
+
+/**
+ * \brief Hash more data
+ * \param ctx Hash state
+ * \param data Input data
+ * \param length Number of bytes
+ */
+void Sha512_Update(Sha512_t *ctx, const uint8 *data, uint32 length);
+
+/**
+ * \brief Complete the hash
+ * \param ctx Hash state, must be initialized again before reuse
+ * \param digest Output, SHA512_DIGEST_SIZE bytes
+ */
+void Sha512_Final(Sha512_t *ctx, uint8 *digest);
+
+/**
+ * \brief Hash a buffer
+ * \param data Input data
+ * \param length Number of bytes
+ * \param digest Output, SHA512_DIGEST_SIZE bytes
+ */
+void Sha512_Calculate(const uint8 *data, uint32 length, uint8 *digest);
+
+#endif /* SHA512_H_ */
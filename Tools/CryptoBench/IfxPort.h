@@ -0,0 +1,13 @@
+/**********************************************************************************************************************
+ * \file IfxPort.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Host stand-in for the iLLD header of the same name, Flash4_Driver.h includes it but needs nothing from it
+ *********************************************************************************************************************/
+
+#ifndef IFXPORT_H
+#define IFXPORT_H
+
+#include "Ifx_Types.h"
+
+#endif /* IFXPORT_H */
@@ -0,0 +1,16 @@
+/**********************************************************************************************************************
+ * \file IfxQspi_SpiMaster.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Host stand-in for the iLLD header of the same name, only the handle types used by Flash4_Driver.h
+ *********************************************************************************************************************/
+
+#ifndef IFXQSPI_SPIMASTER_H
+#define IFXQSPI_SPIMASTER_H
+
+#include "Ifx_Types.h"
+
+typedef struct { uint32 unused; } IfxQspi_SpiMaster;
+typedef struct { uint32 unused; } IfxQspi_SpiMaster_Channel;
+
+#endif /* IFXQSPI_SPIMASTER_H */
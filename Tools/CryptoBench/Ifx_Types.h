@@ -0,0 +1,29 @@
+/**********************************************************************************************************************
+ * \file Ifx_Types.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Host stand-in for the iLLD header of the same name. Besides the types the crypto modules only use
+ * Flash4_ReadBuffer(), which crypto_bench provides on a RAM image
+ *********************************************************************************************************************/
+
+#ifndef IFX_TYPES_H
+#define IFX_TYPES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t  uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+typedef int8_t   sint8;
+typedef int16_t  sint16;
+typedef int32_t  sint32;
+typedef int64_t  sint64;
+typedef uint8_t  boolean;
+
+#define TRUE                           1
+#define FALSE                          0
+#define NULL_PTR                       ((void *)0)
+
+#endif /* IFX_TYPES_H */
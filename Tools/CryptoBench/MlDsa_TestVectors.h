@@ -0,0 +1,591 @@
+/**********************************************************************************************************************
+ * \file MlDsa_TestVectors.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * ML-DSA known answer vectors of the crypto benchmark, generated by Tools/mldsa_vectors.c, do not edit
+ * Key pairs from the seed 00 01 .. 1F, deterministic FIPS 204 signatures of MLDSA_VECTOR_MESSAGE under the
+ * context string MLDSA_VECTOR_CONTEXT, computed with OpenSSL.
+ *********************************************************************************************************************/
+
+#ifndef MLDSA_TESTVECTORS_H_
+#define MLDSA_TESTVECTORS_H_
+
+#define MLDSA_VECTOR_MESSAGE        "FIPS 204 known answer test"
+#define MLDSA_VECTOR_CONTEXT        "crypto_bench"
+
+/* ML-DSA-44 */
+static const uint8 g_mlDsa44PublicKey[MLDSA44_PUBLIC_KEY_SIZE] = {
+    0xD7, 0xB2, 0xB4, 0x72, 0x54, 0xAA, 0xE0, 0xDB, 0x45, 0xE7, 0x93, 0x0D, 0x4A, 0x98, 0xD2, 0xC9,
+    0x7D, 0x8F, 0x13, 0x97, 0xD1, 0x78, 0x9D, 0xAF, 0xA1, 0x70, 0x24, 0xB3, 0x16, 0xE9, 0xBE, 0xC9,
+    0x4F, 0xC9, 0x94, 0x6D, 0x42, 0xF1, 0x9B, 0x79, 0xA7, 0x41, 0x3B, 0xBA, 0xA3, 0x3E, 0x71, 0x49,
+    0xCB, 0x42, 0xED, 0x51, 0x15, 0x69, 0x3A, 0xC0, 0x41, 0xFA, 0xCB, 0x98, 0x8A, 0xDE, 0xB5, 0xFE,
+    0x0E, 0x1D, 0x86, 0x31, 0x18, 0x49, 0x95, 0xB5, 0x92, 0xC3, 0x97, 0xD2, 0x29, 0x4E, 0x2E, 0x14,
+    0xF9, 0x0A, 0xA4, 0x14, 0xBA, 0x38, 0x26, 0x89, 0x9A, 0xC4, 0x3F, 0x4C, 0xCC, 0xAC, 0xBC, 0x26,
+    0xE9, 0xA8, 0x32, 0xB9, 0x51, 0x18, 0xD5, 0xCB, 0x43, 0x3C, 0xBE, 0xF9, 0x66, 0x0B, 0x00, 0x13,
+    0x8E, 0x08, 0x17, 0xF6, 0x1E, 0x76, 0x2C, 0xA2, 0x74, 0xC3, 0x6A, 0xD5, 0x54, 0xEB, 0x22, 0xAA,
+    0xC1, 0x16, 0x2E, 0x4A, 0xB0, 0x1A, 0xCB, 0xA1, 0xE3, 0x8C, 0x4E, 0xFD, 0x8F, 0x80, 0xB6, 0x5B,
+    0x33, 0x3D, 0x0F, 0x72, 0xE5, 0x5D, 0xFE, 0x71, 0xCE, 0x9C, 0x1E, 0xBB, 0x98, 0x89, 0xE7, 0xC5,
+    0x61, 0x06, 0xC0, 0xFD, 0x73, 0x80, 0x3A, 0x2A, 0xEC, 0xFE, 0xAF, 0xDE, 0xD7, 0xAA, 0x3C, 0xB2,
+    0xCE, 0xDA, 0x54, 0xD1, 0x2B, 0xD8, 0xCD, 0x36, 0xA7, 0x8C, 0xF9, 0x75, 0x94, 0x3B, 0x47, 0xAB,
+    0xD2, 0x5E, 0x88, 0x0A, 0xC4, 0x52, 0xE5, 0x74, 0x2E, 0xD1, 0xE8, 0xD1, 0xA8, 0x2A, 0xFA, 0x86,
+    0xE5, 0x90, 0xC7, 0x58, 0xC1, 0x5A, 0xE4, 0xD2, 0x84, 0x0D, 0x92, 0xBC, 0xA1, 0xA5, 0x09, 0x0F,
+    0x40, 0x49, 0x65, 0x97, 0xFC, 0xA7, 0xD8, 0xB9, 0x51, 0x3F, 0x1A, 0x1B, 0xDA, 0x6E, 0x95, 0x0A,
+    0xAA, 0x98, 0xDE, 0x46, 0x75, 0x07, 0xD4, 0xA4, 0xF5, 0xA4, 0xF0, 0x59, 0x92, 0x16, 0x58, 0x2C,
+    0x35, 0x72, 0xF6, 0x2E, 0xDA, 0x89, 0x05, 0xAB, 0x35, 0x81, 0x67, 0x0C, 0x4A, 0x02, 0x77, 0x7A,
+    0x33, 0xE0, 0xCA, 0x72, 0x95, 0xFD, 0x8F, 0x4F, 0xF6, 0xD1, 0xA0, 0xA3, 0xA7, 0x68, 0x3D, 0x65,
+    0xF5, 0xF5, 0xF7, 0xFC, 0x60, 0xDA, 0x02, 0x3E, 0x82, 0x6C, 0x5F, 0x92, 0x14, 0x4C, 0x02, 0xF7,
+    0xD1, 0xBA, 0x10, 0x75, 0x98, 0x75, 0x53, 0xEA, 0x93, 0x67, 0xFC, 0xD7, 0x6D, 0x99, 0x0B, 0x7F,
+    0xA9, 0x9C, 0xD4, 0x5A, 0xFD, 0xB8, 0x83, 0x6D, 0x43, 0xE4, 0x59, 0xF5, 0x18, 0x7D, 0xF0, 0x58,
+    0x47, 0x97, 0x09, 0xA0, 0x1E, 0xA6, 0x83, 0x59, 0x35, 0xFA, 0x70, 0x46, 0x09, 0x90, 0xCD, 0x3D,
+    0xC1, 0xBA, 0x40, 0x1B, 0xA9, 0x4B, 0xAB, 0x1D, 0xDE, 0x41, 0xAC, 0x67, 0xAB, 0x33, 0x19, 0xDC,
+    0xAC, 0xA0, 0x60, 0x48, 0xD4, 0xC4, 0xEE, 0xF2, 0x7E, 0xE1, 0x3A, 0x9C, 0x17, 0xD0, 0x53, 0x8F,
+    0x43, 0x0F, 0x2D, 0x64, 0x2D, 0xC2, 0x41, 0x56, 0x60, 0xDE, 0x78, 0x87, 0x7D, 0x8D, 0x8A, 0xBC,
+    0x72, 0x52, 0x39, 0x78, 0xC0, 0x42, 0xE4, 0x28, 0x5F, 0x43, 0x19, 0x84, 0x6C, 0x44, 0x12, 0x62,
+    0x42, 0x97, 0x68, 0x44, 0xC1, 0x0E, 0x55, 0x6B, 0xA2, 0x15, 0xB5, 0xA7, 0x19, 0xE5, 0x9D, 0x0C,
+    0x6B, 0x2A, 0x96, 0xD3, 0x98, 0x59, 0x07, 0x1F, 0xDC, 0xC2, 0xCD, 0xE7, 0x52, 0x4A, 0x7B, 0xED,
+    0xAE, 0x54, 0xE8, 0x5B, 0x31, 0x8E, 0x85, 0x4E, 0x8F, 0xE2, 0xB2, 0xF3, 0xED, 0xFA, 0xC9, 0x71,
+    0x91, 0x28, 0x27, 0x0A, 0xAF, 0xD1, 0xE5, 0x04, 0x4C, 0x3A, 0x4F, 0xDA, 0xFD, 0x9F, 0xF3, 0x1F,
+    0x90, 0x78, 0x4B, 0x8E, 0x8E, 0x45, 0x96, 0x14, 0x4A, 0x0D, 0xAF, 0x58, 0x65, 0x11, 0xD3, 0xD9,
+    0x96, 0x2B, 0x9E, 0xA9, 0x5A, 0xF1, 0x97, 0xB4, 0xE5, 0xFC, 0x60, 0xF2, 0xB1, 0xED, 0x15, 0xDE,
+    0x3A, 0x5B, 0xEF, 0x5F, 0x89, 0xBD, 0xC7, 0x9D, 0x91, 0x05, 0x1D, 0x9B, 0x28, 0x16, 0xE7, 0x4F,
+    0xA5, 0x45, 0x31, 0xEF, 0xDC, 0x1C, 0xBE, 0x74, 0xD4, 0x48, 0x85, 0x7F, 0x47, 0x6B, 0xCD, 0x58,
+    0xF2, 0x1C, 0x0B, 0x65, 0x3B, 0x3B, 0x76, 0xA4, 0xE0, 0x76, 0xA6, 0x55, 0x9A, 0x30, 0x27, 0x18,
+    0x55, 0x5C, 0xC6, 0x3F, 0x74, 0x85, 0x9A, 0xAB, 0xAB, 0x92, 0x5F, 0x02, 0x38, 0x61, 0xCA, 0x8C,
+    0xD0, 0xF7, 0xBA, 0xDB, 0x28, 0x71, 0xF6, 0x7D, 0x55, 0x32, 0x6D, 0x74, 0x51, 0x13, 0x5A, 0xD4,
+    0x5F, 0x4A, 0x1B, 0xA6, 0x91, 0x18, 0xFB, 0xB2, 0xC8, 0xA3, 0x0E, 0xEC, 0x93, 0x92, 0xEF, 0x3F,
+    0x97, 0x70, 0x66, 0xC9, 0xAD, 0xD5, 0xC7, 0x10, 0xCC, 0x64, 0x7B, 0x15, 0x14, 0xD2, 0x17, 0xD9,
+    0x58, 0xC7, 0x01, 0x7C, 0x3E, 0x90, 0xFD, 0x20, 0xC0, 0x4E, 0x67, 0x4B, 0x90, 0x48, 0x6E, 0x93,
+    0x70, 0xA3, 0x1A, 0x00, 0x1D, 0x32, 0xF4, 0x73, 0x97, 0x9E, 0x49, 0x06, 0x74, 0x9E, 0x7E, 0x47,
+    0x7F, 0xA0, 0xB7, 0x45, 0x08, 0xF8, 0xA5, 0xF2, 0x37, 0x83, 0x12, 0xB8, 0x3C, 0x25, 0xBD, 0x38,
+    0x8C, 0xA0, 0xB0, 0xFF, 0xF7, 0x47, 0x8B, 0xAF, 0x42, 0xB7, 0x16, 0x67, 0xED, 0xAA, 0xC9, 0x7C,
+    0x46, 0xB1, 0x29, 0x64, 0x3E, 0x58, 0x6E, 0x5B, 0x05, 0x5A, 0x0C, 0x21, 0x19, 0x46, 0xD4, 0xF3,
+    0x6E, 0x67, 0x5B, 0xED, 0x58, 0x60, 0xFA, 0x04, 0x2A, 0x31, 0x5D, 0x98, 0x26, 0x16, 0x4D, 0x6A,
+    0x92, 0x37, 0xC3, 0x5A, 0x5F, 0xBF, 0x49, 0x54, 0x90, 0xA5, 0xBD, 0x4D, 0xF2, 0x48, 0xB9, 0x5C,
+    0x4A, 0xAE, 0x77, 0x84, 0xB6, 0x05, 0x67, 0x31, 0x66, 0xAC, 0x42, 0x45, 0xB5, 0xB4, 0xB0, 0x82,
+    0xA0, 0x9E, 0x93, 0x23, 0xE6, 0x2F, 0x20, 0x78, 0xC5, 0xB7, 0x67, 0x83, 0x44, 0x6D, 0xEF, 0xD7,
+    0x36, 0xAD, 0x3A, 0x37, 0x02, 0xD4, 0x9B, 0x08, 0x98, 0x44, 0x90, 0x0A, 0x61, 0x83, 0x33, 0x97,
+    0xBC, 0x44, 0x19, 0xB3, 0x0D, 0x7A, 0x97, 0xA0, 0xB3, 0x87, 0xC1, 0x91, 0x14, 0x74, 0xC4, 0xD4,
+    0x1B, 0x53, 0xE3, 0x2A, 0x97, 0x7A, 0xCB, 0x6F, 0x0E, 0xA7, 0x5D, 0xB6, 0x5B, 0xB3, 0x9E, 0x59,
+    0xE7, 0x01, 0xE7, 0x69, 0x57, 0xDE, 0xF6, 0xF2, 0xD4, 0x45, 0x59, 0xC3, 0x1A, 0x77, 0x12, 0x2B,
+    0x52, 0x04, 0xE3, 0xB5, 0xC2, 0x19, 0xF1, 0x68, 0x8B, 0x14, 0xED, 0x0B, 0xC0, 0xB8, 0x01, 0xB3,
+    0xE6, 0xE8, 0x2D, 0xCD, 0x43, 0xE9, 0xC0, 0xE9, 0xF4, 0x17, 0x44, 0xCD, 0x98, 0x15, 0xBD, 0x1B,
+    0xC8, 0x82, 0x0D, 0x8B, 0xB1, 0x23, 0xF0, 0x4F, 0xAC, 0xD1, 0xB1, 0xB6, 0x85, 0xDD, 0x5A, 0x2B,
+    0x1B, 0x8D, 0xBB, 0xF3, 0xED, 0x93, 0x36, 0x70, 0xF0, 0x95, 0xA1, 0x80, 0xB4, 0xF1, 0x92, 0xD0,
+    0x8B, 0x10, 0xB8, 0xFA, 0xBB, 0xDF, 0xCC, 0x2B, 0x24, 0x51, 0x8E, 0x32, 0xEE, 0xA0, 0xA5, 0xE0,
+    0xC9, 0x04, 0xCA, 0x84, 0x47, 0x80, 0x08, 0x3F, 0x3B, 0x0C, 0xD2, 0xD0, 0xB8, 0xB6, 0xAF, 0x67,
+    0xBC, 0x35, 0x5B, 0x94, 0x94, 0x02, 0x5D, 0xC7, 0xB0, 0xA7, 0x8F, 0xA8, 0x0E, 0x3A, 0x2D, 0xBF,
+    0xEB, 0x51, 0x32, 0x88, 0x51, 0xD6, 0x07, 0x81, 0x98, 0xE9, 0x49, 0x36, 0x51, 0xAE, 0x78, 0x7E,
+    0xC0, 0x25, 0x1F, 0x92, 0x2B, 0xA3, 0x0E, 0x9F, 0x51, 0xDF, 0x62, 0xA6, 0xD7, 0x27, 0x84, 0xCF,
+    0x3D, 0xD2, 0x05, 0x39, 0x31, 0x76, 0xDF, 0xA3, 0x24, 0xA5, 0x12, 0xBD, 0x94, 0x97, 0x0A, 0x36,
+    0xDD, 0x34, 0xA5, 0x14, 0xA8, 0x67, 0x91, 0xF0, 0xEB, 0x36, 0xF0, 0x14, 0x5B, 0x09, 0xAB, 0x64,
+    0x65, 0x1B, 0x4A, 0x03, 0x13, 0xB2, 0x99, 0x61, 0x1A, 0x2A, 0x1C, 0x48, 0x89, 0x16, 0x27, 0x59,
+    0x87, 0x68, 0xA3, 0x11, 0x40, 0x60, 0xBA, 0x44, 0x43, 0x48, 0x6D, 0xF5, 0x15, 0x22, 0xA1, 0xCE,
+    0x88, 0xB3, 0x09, 0x85, 0xC2, 0x16, 0xF8, 0xE6, 0xED, 0x17, 0x8D, 0xD5, 0x67, 0xB3, 0x04, 0xA0,
+    0xD4, 0xCA, 0xFB, 0xA8, 0x82, 0xA2, 0x83, 0x42, 0xF1, 0x7A, 0x9A, 0xA2, 0x6A, 0xE5, 0x8D, 0xB6,
+    0x30, 0x08, 0x3D, 0x2C, 0x35, 0x8F, 0xDF, 0x56, 0x6C, 0x3F, 0x5D, 0x62, 0xA4, 0x28, 0x56, 0x7B,
+    0xC9, 0xEA, 0x8C, 0xE9, 0x5C, 0xAA, 0x0F, 0x35, 0x47, 0x4B, 0x0B, 0xFA, 0x8F, 0x33, 0x9A, 0x25,
+    0x0A, 0xB4, 0xDF, 0xCF, 0x20, 0x83, 0xBE, 0x8E, 0xEF, 0xBC, 0x10, 0x55, 0xE1, 0x8F, 0xE1, 0x53,
+    0x70, 0xEE, 0xCB, 0x26, 0x05, 0x66, 0xD8, 0x3F, 0xF0, 0x6B, 0x21, 0x1A, 0xAE, 0xC4, 0x3C, 0xA2,
+    0x9B, 0x54, 0xCC, 0xD0, 0x0F, 0x88, 0x15, 0xA2, 0x46, 0x5E, 0xF0, 0xB4, 0x65, 0x15, 0xCC, 0x7E,
+    0x41, 0xF3, 0x12, 0x4F, 0x09, 0xEF, 0xFF, 0x73, 0x93, 0x09, 0xAB, 0x58, 0xB2, 0x9A, 0x14, 0x59,
+    0xA0, 0x0B, 0xCE, 0x50, 0x38, 0xE9, 0x38, 0xC9, 0x67, 0x8F, 0x72, 0xEB, 0x0E, 0x4E, 0xE5, 0xFD,
+    0xAA, 0xE6, 0x6D, 0x9F, 0x85, 0x73, 0xFC, 0x97, 0xFC, 0x42, 0xB4, 0x95, 0x9F, 0x4B, 0xF8, 0xB6,
+    0x1D, 0x78, 0x43, 0x3E, 0x86, 0xB0, 0x33, 0x5D, 0x6E, 0x91, 0x91, 0xC4, 0xD8, 0xBF, 0x48, 0x7B,
+    0x39, 0x05, 0xC1, 0x08, 0xCF, 0xD6, 0xAC, 0x24, 0xB0, 0xCE, 0xB7, 0xDC, 0xB7, 0xCF, 0x51, 0xF8,
+    0x4D, 0x0E, 0xD6, 0x87, 0xB9, 0x5E, 0xAE, 0xB1, 0xC5, 0x33, 0xC0, 0x6F, 0x0D, 0x97, 0x02, 0x3D,
+    0x92, 0xA7, 0x08, 0x25, 0x83, 0x7B, 0x59, 0xBA, 0x6C, 0xB7, 0xD4, 0xE5, 0x6B, 0x0A, 0x87, 0xC2,
+    0x03, 0x86, 0x2A, 0xE8, 0xF3, 0x15, 0xBA, 0x59, 0x25, 0xE8, 0xED, 0xEF, 0xA6, 0x79, 0x36, 0x9A,
+    0x22, 0x02, 0x76, 0x61, 0x51, 0xF1, 0x6A, 0x96, 0x5F, 0x9F, 0x81, 0xEC, 0xE7, 0x6C, 0xC0, 0x70,
+    0xB5, 0x58, 0x69, 0xE4, 0xDB, 0x97, 0x84, 0xCF, 0x05, 0xC8, 0x30, 0xB3, 0x24, 0x2C, 0x83, 0x12
+};
+static const uint8 g_mlDsa44Signature[MLDSA44_SIGNATURE_SIZE] = {
+    0x83, 0xA2, 0x7E, 0xEE, 0x25, 0xBE, 0x77, 0x5B, 0xA5, 0x35, 0x0D, 0x73, 0x55, 0xB4, 0xAD, 0xB3,
+    0x6E, 0xB6, 0xE0, 0x48, 0xD4, 0x32, 0x7B, 0xB8, 0x2F, 0x4B, 0x6E, 0xF7, 0x98, 0x05, 0x10, 0x0C,
+    0xC1, 0xC3, 0x8A, 0x24, 0x02, 0xE8, 0x4B, 0xF9, 0x59, 0x2C, 0xFD, 0x12, 0x38, 0x5E, 0x2F, 0xE2,
+    0x1C, 0xD3, 0x2F, 0x93, 0x47, 0xEC, 0x98, 0x81, 0xD2, 0x41, 0x01, 0x9E, 0xEC, 0x92, 0xE3, 0x97,
+    0x28, 0x5C, 0x36, 0x46, 0x01, 0xFE, 0x48, 0x56, 0x31, 0x52, 0x99, 0xB3, 0x37, 0xB8, 0x28, 0x97,
+    0x40, 0x46, 0x21, 0x82, 0x4C, 0x1B, 0x36, 0x37, 0x57, 0xFB, 0xF3, 0x39, 0x1D, 0xD0, 0xDE, 0xA1,
+    0x6D, 0x41, 0xE3, 0x3A, 0xF3, 0xCC, 0x67, 0x43, 0x0A, 0x61, 0xA2, 0xE5, 0xF4, 0xCA, 0xBF, 0x5C,
+    0x7B, 0x8D, 0x91, 0xC2, 0x52, 0x36, 0x61, 0x87, 0xC4, 0x82, 0xFB, 0x3D, 0x90, 0x0C, 0xBC, 0xE5,
+    0x8D, 0x92, 0x65, 0x26, 0xF0, 0x1C, 0x6A, 0xE8, 0xF9, 0xB4, 0x9A, 0x39, 0x7A, 0xD4, 0xFD, 0xAA,
+    0x28, 0x0A, 0x72, 0xF3, 0x3C, 0xE8, 0xFC, 0xEE, 0x89, 0xE4, 0x62, 0x5E, 0x39, 0xF5, 0x8B, 0x17,
+    0x6C, 0xF2, 0xB7, 0x79, 0x57, 0xF4, 0x1E, 0x3E, 0x37, 0x51, 0x96, 0xAA, 0x56, 0xD7, 0xBE, 0x6F,
+    0x01, 0xCA, 0xFA, 0xED, 0x8F, 0x15, 0x5E, 0xEB, 0xEF, 0x66, 0x98, 0x6F, 0x41, 0xF7, 0xE5, 0x17,
+    0x2F, 0x02, 0x26, 0x65, 0x44, 0x9F, 0x71, 0x86, 0xB2, 0x10, 0xBD, 0xF1, 0xDA, 0xA1, 0x07, 0x42,
+    0xD9, 0x26, 0x38, 0xE2, 0x5A, 0x7A, 0x0C, 0xB3, 0x9B, 0x49, 0xA5, 0xD2, 0x8F, 0x77, 0x60, 0xA0,
+    0x82, 0xEA, 0xD6, 0x65, 0x22, 0x48, 0xEA, 0xB9, 0x05, 0x43, 0x34, 0xA3, 0xE0, 0x53, 0x48, 0xA7,
+    0x0E, 0xDD, 0x97, 0x76, 0x5C, 0xDD, 0x45, 0xEA, 0xC9, 0x00, 0xB7, 0x30, 0x36, 0x17, 0x95, 0x87,
+    0x4F, 0xDD, 0x3E, 0x2B, 0xD8, 0xA1, 0xDE, 0xD3, 0x95, 0xE8, 0xF3, 0x5E, 0xB0, 0x92, 0x41, 0x69,
+    0x23, 0x6E, 0x80, 0x0E, 0x59, 0x45, 0x0C, 0xFC, 0x56, 0x20, 0xE3, 0x17, 0x4C, 0x1C, 0xA5, 0x7D,
+    0x58, 0x19, 0x22, 0x94, 0x87, 0x3F, 0xB7, 0x6F, 0x62, 0xDE, 0xE8, 0x0C, 0x8E, 0x98, 0x9C, 0x5D,
+    0x17, 0xCF, 0xDB, 0xDA, 0xE7, 0x2C, 0xDE, 0x1B, 0x32, 0x43, 0x73, 0xE9, 0xAC, 0x89, 0xE4, 0x1A,
+    0x36, 0x08, 0xFC, 0x81, 0x0E, 0x33, 0x94, 0x9E, 0x3E, 0xA9, 0xF0, 0x9B, 0x43, 0x36, 0xEC, 0x2C,
+    0xB6, 0x15, 0x11, 0xBF, 0x00, 0xB5, 0x2E, 0x8F, 0xC9, 0x60, 0x73, 0xC7, 0x41, 0x05, 0xA2, 0x82,
+    0x40, 0x52, 0x06, 0x8F, 0x18, 0xF0, 0x70, 0xED, 0x6D, 0xBD, 0x79, 0x58, 0xD6, 0x60, 0x24, 0xE4,
+    0xFC, 0x92, 0x2C, 0x30, 0x6B, 0x6D, 0x11, 0x30, 0x14, 0xFD, 0x2A, 0x4F, 0x47, 0x80, 0x5C, 0xE9,
+    0x7F, 0x96, 0x44, 0x8D, 0x57, 0x87, 0xFB, 0x77, 0xF0, 0xC9, 0xB2, 0x0B, 0x47, 0xB7, 0x69, 0x30,
+    0xE0, 0x86, 0x7B, 0x59, 0x6D, 0xFB, 0x0F, 0xC6, 0xCF, 0xCD, 0x75, 0x4E, 0x0F, 0xD0, 0xF1, 0xC9,
+    0x52, 0x7C, 0x38, 0xFA, 0xF4, 0xCD, 0x6B, 0xD7, 0x12, 0xB4, 0x66, 0xD2, 0xDA, 0x6B, 0xAE, 0xB4,
+    0xBC, 0x09, 0x9C, 0x5F, 0x97, 0x59, 0xB3, 0x2D, 0x70, 0x82, 0x2F, 0x62, 0x4B, 0x8A, 0x2B, 0xD7,
+    0xC3, 0xC6, 0x47, 0xFF, 0x4F, 0x1C, 0x82, 0xAE, 0xA2, 0x5F, 0x5B, 0xD2, 0x59, 0xF3, 0x45, 0xA5,
+    0x68, 0x0A, 0x8E, 0x02, 0x99, 0xFF, 0x08, 0x86, 0x6F, 0xE7, 0x15, 0x88, 0x68, 0xCC, 0x70, 0xBF,
+    0x9A, 0x58, 0x85, 0xF4, 0x38, 0x07, 0x54, 0x1C, 0x6A, 0xDA, 0x07, 0x78, 0x33, 0xD2, 0x89, 0xCD,
+    0xBC, 0x86, 0x33, 0xFC, 0x8B, 0x1B, 0xDB, 0x42, 0x4A, 0xFA, 0x44, 0x06, 0xF0, 0xB5, 0xB8, 0xD3,
+    0x95, 0xB1, 0x9E, 0x54, 0xDA, 0x40, 0x31, 0xEE, 0x04, 0x82, 0xE7, 0xAC, 0x9F, 0xED, 0x5F, 0xC9,
+    0xDA, 0x93, 0x43, 0x4E, 0x43, 0xD0, 0x7D, 0x19, 0xE7, 0x89, 0x80, 0xC9, 0x98, 0x70, 0xB9, 0x68,
+    0x4E, 0xE6, 0x57, 0xE1, 0x0B, 0x03, 0x02, 0xA6, 0xFB, 0xA2, 0x31, 0xA7, 0x4D, 0x1C, 0xA0, 0xA3,
+    0x79, 0x6E, 0x30, 0x2F, 0x4C, 0x39, 0x2C, 0x06, 0x67, 0xD2, 0x90, 0x0B, 0x5E, 0xA0, 0xDA, 0x06,
+    0x40, 0xE5, 0x9B, 0xA3, 0x98, 0xC0, 0x96, 0x7C, 0xEF, 0xD5, 0x31, 0xF6, 0xE4, 0xED, 0x34, 0xEF,
+    0x46, 0xD0, 0xB4, 0x7E, 0x89, 0x86, 0x51, 0x53, 0x3B, 0xE4, 0x24, 0x4C, 0xE1, 0x75, 0xFE, 0x83,
+    0x2F, 0xFE, 0xE7, 0x92, 0x3E, 0x22, 0xFC, 0xE9, 0x0A, 0x5A, 0x06, 0xCA, 0x99, 0xBB, 0x4B, 0xAE,
+    0x79, 0x05, 0xCE, 0xAD, 0x5B, 0xC1, 0x7C, 0x98, 0xD3, 0x61, 0x15, 0x41, 0x48, 0x14, 0x6A, 0x10,
+    0x41, 0x84, 0x55, 0x36, 0x40, 0xDD, 0x80, 0x61, 0xC1, 0xB7, 0xCA, 0x47, 0x57, 0xA2, 0x3A, 0x49,
+    0xF6, 0xD8, 0xB2, 0x4C, 0xC2, 0x4D, 0xD8, 0xFF, 0x59, 0x47, 0x66, 0x3E, 0x06, 0xDE, 0xD3, 0xA9,
+    0x6D, 0x2D, 0x1E, 0xE2, 0xD1, 0x75, 0x44, 0x18, 0xCC, 0xA2, 0x11, 0xB9, 0x31, 0xC5, 0x6C, 0x2F,
+    0xDA, 0xAE, 0x0F, 0xDC, 0x2B, 0x79, 0x8B, 0x98, 0x01, 0x77, 0x4D, 0x1E, 0xD6, 0xFF, 0xFB, 0xFF,
+    0x9A, 0x4E, 0xF5, 0x6E, 0x74, 0xF2, 0xD7, 0x2A, 0x6A, 0xA4, 0xB8, 0x57, 0x3A, 0x8C, 0x6D, 0x0F,
+    0x32, 0x41, 0x55, 0x36, 0x17, 0x54, 0xDB, 0x5D, 0xFA, 0xB8, 0xD4, 0xC4, 0x98, 0x79, 0x6B, 0x39,
+    0x56, 0x36, 0x8E, 0xB1, 0x1A, 0x53, 0xEC, 0x5B, 0x9F, 0x86, 0xB9, 0x4E, 0xCC, 0x80, 0xDF, 0x54,
+    0x46, 0xC5, 0xEB, 0x6D, 0x51, 0x7D, 0xCC, 0x27, 0x25, 0x80, 0x3A, 0x33, 0xC4, 0xFF, 0x81, 0xBA,
+    0x98, 0xEF, 0xCE, 0x4A, 0xA3, 0x76, 0x15, 0xB6, 0x52, 0x0C, 0x86, 0xDA, 0xA9, 0xA6, 0x6D, 0x7A,
+    0x26, 0x34, 0xC5, 0xBE, 0x37, 0x82, 0x25, 0x80, 0xDA, 0x80, 0x22, 0xD2, 0x8C, 0x6C, 0x17, 0xB7,
+    0xBD, 0xC5, 0xA6, 0x08, 0x49, 0x62, 0xFA, 0xB5, 0x2B, 0xD2, 0x57, 0xD1, 0x04, 0xBD, 0x23, 0x21,
+    0x17, 0xC4, 0x03, 0xE8, 0x98, 0xF0, 0x41, 0x3C, 0x33, 0xE6, 0xE1, 0x54, 0x95, 0x1B, 0x2C, 0x3C,
+    0x0B, 0x24, 0xAE, 0xB8, 0xF1, 0x85, 0x05, 0x97, 0x40, 0x6F, 0x82, 0x26, 0x26, 0xF1, 0x68, 0x3D,
+    0xA1, 0xBE, 0xE3, 0xCC, 0xA8, 0x99, 0xC7, 0xAE, 0x79, 0x52, 0x1D, 0x1E, 0x69, 0x9D, 0xFF, 0x0C,
+    0xF9, 0x52, 0xA4, 0xF8, 0x9C, 0x46, 0x49, 0x3C, 0x93, 0x84, 0x73, 0x34, 0x0E, 0xC6, 0x02, 0x13,
+    0xA6, 0x0B, 0xD4, 0x6F, 0x7A, 0xD6, 0x13, 0xEB, 0x56, 0xF7, 0x2B, 0x95, 0x9A, 0x55, 0xA3, 0x51,
+    0x74, 0xD0, 0xFC, 0x65, 0xDB, 0xF0, 0xD5, 0x37, 0x0D, 0x2A, 0x41, 0xF3, 0xBF, 0x00, 0x41, 0xC5,
+    0x85, 0xE9, 0xF6, 0xD4, 0xC0, 0xB3, 0xCE, 0x9D, 0x1E, 0x1E, 0x8E, 0xE9, 0x1C, 0x07, 0x9E, 0xBD,
+    0x68, 0x3E, 0xF0, 0xFE, 0xF1, 0x29, 0xBB, 0xDA, 0xA1, 0xFF, 0xC3, 0x4D, 0xCA, 0x09, 0x7B, 0xC7,
+    0x6D, 0x79, 0x0E, 0x20, 0x90, 0xDF, 0x3A, 0x67, 0x4B, 0xD2, 0xCB, 0x9B, 0xB2, 0x59, 0x10, 0x14,
+    0x00, 0xED, 0x69, 0x70, 0x0D, 0x8D, 0x8C, 0xC3, 0x72, 0xC8, 0xFD, 0x4C, 0x6A, 0xAA, 0x91, 0x5F,
+    0x17, 0xCB, 0xCF, 0x2D, 0x41, 0x74, 0xCF, 0xC1, 0x06, 0x04, 0xB5, 0x9D, 0xC1, 0x2A, 0xE9, 0xAB,
+    0xEC, 0xE6, 0xB9, 0xD2, 0x17, 0xD4, 0x58, 0x02, 0xF7, 0xBD, 0xB3, 0xC5, 0x8B, 0x63, 0x7D, 0xE6,
+    0x4B, 0xC0, 0xA5, 0x77, 0x62, 0xB1, 0xEB, 0x97, 0x80, 0xB3, 0x58, 0xA3, 0xB4, 0x7D, 0x18, 0x04,
+    0x33, 0x90, 0xF5, 0x00, 0xA4, 0x32, 0x95, 0xD2, 0x17, 0x6D, 0xF9, 0x67, 0x77, 0xAD, 0x07, 0x9E,
+    0xBE, 0x38, 0xEB, 0x09, 0xBD, 0x9E, 0x15, 0xDA, 0xF6, 0xF3, 0x85, 0xD9, 0x12, 0x4A, 0x22, 0xBC,
+    0xF4, 0x54, 0x04, 0xD8, 0x44, 0xAA, 0x6E, 0x6B, 0xDB, 0x62, 0xD5, 0xD8, 0xA7, 0x7D, 0x77, 0x65,
+    0xC6, 0x64, 0x52, 0xE7, 0x41, 0xEC, 0x1A, 0x4A, 0xF5, 0xE2, 0x16, 0xF1, 0x49, 0x3F, 0xF3, 0x46,
+    0x22, 0xA3, 0x78, 0x22, 0x54, 0x88, 0x4C, 0xA7, 0xCA, 0x45, 0xA5, 0xEA, 0x67, 0xF3, 0x09, 0x32,
+    0xF4, 0x0E, 0x9C, 0x53, 0x97, 0xDD, 0xAD, 0xD6, 0xAA, 0xB1, 0x28, 0xC9, 0xEA, 0xFD, 0xD3, 0x25,
+    0x35, 0xDD, 0x6B, 0xDD, 0x6A, 0xB1, 0x33, 0x03, 0x89, 0xB5, 0xD4, 0x27, 0x53, 0x5B, 0x2D, 0xF4,
+    0x10, 0xEE, 0x01, 0x90, 0x17, 0x7F, 0x72, 0x00, 0x04, 0x07, 0x59, 0x44, 0x50, 0x1E, 0x66, 0xBB,
+    0x8D, 0x64, 0x7D, 0xB3, 0x6A, 0xB3, 0x61, 0xC2, 0x3B, 0x90, 0x3C, 0x11, 0x86, 0x23, 0x82, 0xB5,
+    0x3F, 0x60, 0x62, 0x5A, 0x5E, 0x4C, 0x06, 0xC7, 0x84, 0x98, 0xC3, 0xEE, 0x29, 0x6D, 0xA8, 0x7A,
+    0x86, 0x9C, 0x96, 0xAD, 0x73, 0x8A, 0x08, 0x27, 0x90, 0x53, 0x08, 0x19, 0xF4, 0x46, 0xFB, 0x7C,
+    0x48, 0x00, 0x67, 0x42, 0xE4, 0x28, 0x0D, 0xF4, 0x5D, 0x22, 0xD8, 0x03, 0x52, 0xF8, 0xE3, 0xFB,
+    0xD2, 0x02, 0x6B, 0x54, 0xD9, 0x0B, 0x90, 0xF5, 0xB4, 0xC7, 0x9C, 0x74, 0xEB, 0xB2, 0x43, 0x68,
+    0x73, 0xE9, 0x21, 0x25, 0xA6, 0x2B, 0x91, 0x14, 0x28, 0xDB, 0x2D, 0x41, 0x16, 0x49, 0x35, 0xCD,
+    0x05, 0x32, 0xD2, 0x14, 0x33, 0xF6, 0xBE, 0xC0, 0x5E, 0xDD, 0x4C, 0xF2, 0xA3, 0x9A, 0x51, 0x90,
+    0x0E, 0xE7, 0x7F, 0xAD, 0xCA, 0x02, 0x0F, 0x7E, 0xDF, 0x4D, 0x16, 0xBF, 0x18, 0xEC, 0x38, 0xC6,
+    0x8B, 0x1F, 0x79, 0xD0, 0xD0, 0x56, 0xF1, 0xB9, 0x28, 0x39, 0x5D, 0xC4, 0x0B, 0x24, 0xE1, 0x7F,
+    0xC2, 0x0E, 0xCA, 0x62, 0x7A, 0xD3, 0xAB, 0x40, 0x41, 0x76, 0x3C, 0xEB, 0x33, 0xC7, 0xBC, 0xEC,
+    0xD2, 0xDF, 0x7A, 0xB6, 0x04, 0x19, 0xA9, 0x94, 0xF7, 0x3C, 0x2F, 0x23, 0x46, 0xB3, 0xED, 0x87,
+    0x28, 0xBF, 0xDC, 0x78, 0xC9, 0xF7, 0x44, 0x5B, 0x1F, 0x6B, 0x2F, 0x39, 0x35, 0xC3, 0xD9, 0x1C,
+    0x79, 0x86, 0x92, 0x03, 0x89, 0x67, 0x6B, 0x52, 0x25, 0x49, 0xA7, 0x86, 0x4D, 0x1B, 0xCB, 0xBC,
+    0xED, 0xE0, 0xF6, 0xF1, 0x9C, 0x4F, 0x14, 0x1C, 0x65, 0x64, 0x42, 0xCF, 0xED, 0x06, 0xB1, 0x61,
+    0xCC, 0x31, 0x1B, 0x40, 0xF1, 0x6A, 0x8A, 0x6F, 0xAE, 0xAA, 0xC7, 0xF6, 0x67, 0x6B, 0x7A, 0xA0,
+    0xD4, 0xBC, 0x55, 0x33, 0x8C, 0x9B, 0xCA, 0x1C, 0x19, 0xCD, 0x27, 0xFF, 0x38, 0x20, 0xEB, 0x4A,
+    0xEB, 0xCB, 0x02, 0xA6, 0xEB, 0xBF, 0x0E, 0x08, 0x96, 0x0A, 0xE4, 0xD9, 0xF9, 0x7C, 0x37, 0x75,
+    0xE5, 0x52, 0x2B, 0x24, 0xC0, 0xAA, 0x64, 0xE2, 0x75, 0x22, 0xDD, 0xD3, 0x51, 0x8B, 0x30, 0x33,
+    0xE9, 0xA3, 0x48, 0xA0, 0x93, 0x27, 0x08, 0x96, 0xED, 0xBB, 0x0B, 0xB9, 0x88, 0xF4, 0x95, 0xAE,
+    0x0E, 0x91, 0xEF, 0x26, 0x76, 0x3F, 0x4F, 0x0C, 0x26, 0x5E, 0xFC, 0x46, 0x2D, 0x21, 0x3B, 0x6F,
+    0x89, 0x8C, 0xB8, 0x09, 0xF4, 0x74, 0x21, 0xDF, 0xE5, 0x41, 0x48, 0x09, 0xC9, 0xB7, 0x53, 0x45,
+    0x24, 0xF5, 0x9A, 0xD7, 0x56, 0xD0, 0xA3, 0x1B, 0x48, 0x9F, 0x32, 0x11, 0x34, 0x50, 0x2E, 0xE5,
+    0xC9, 0xE4, 0xED, 0x17, 0x97, 0xDA, 0xCC, 0xC2, 0x8B, 0x5F, 0xA7, 0xAE, 0x2B, 0xCA, 0xD9, 0x13,
+    0x4E, 0x41, 0xF8, 0x8B, 0xDC, 0x56, 0xE6, 0x01, 0x82, 0xB1, 0x26, 0x9B, 0x06, 0x66, 0x22, 0x68,
+    0x15, 0x80, 0x8E, 0x36, 0xD8, 0x46, 0x93, 0x45, 0x66, 0xA4, 0x7C, 0xF1, 0x98, 0xC1, 0x16, 0xA2,
+    0x7C, 0x48, 0x68, 0xC7, 0xDE, 0x11, 0x82, 0x33, 0xD9, 0x74, 0x1F, 0xAD, 0xFC, 0x56, 0x24, 0xBD,
+    0xF9, 0xA4, 0x66, 0x67, 0x66, 0x81, 0xE3, 0x3B, 0x14, 0x42, 0x96, 0x94, 0xBB, 0xA2, 0x70, 0x50,
+    0xAD, 0x91, 0xB7, 0x58, 0xAB, 0x39, 0x7C, 0x8A, 0x78, 0x64, 0x98, 0xDD, 0xAF, 0xC7, 0x71, 0x8F,
+    0x7C, 0x71, 0x91, 0x3D, 0x26, 0x76, 0x37, 0x4C, 0x9D, 0x6E, 0x1F, 0x04, 0x04, 0x59, 0x80, 0x8E,
+    0xA8, 0xC8, 0x04, 0x66, 0x87, 0xA0, 0x65, 0xFF, 0xA4, 0x1C, 0x83, 0x9E, 0x5E, 0x91, 0x24, 0xAA,
+    0xDE, 0x84, 0xF9, 0x23, 0x05, 0x80, 0xC3, 0xD9, 0xC5, 0x5B, 0x9E, 0xF0, 0x45, 0x2D, 0xBA, 0xE6,
+    0x04, 0xD8, 0x14, 0x6E, 0xE7, 0x43, 0x78, 0x32, 0xAF, 0x36, 0xC9, 0x26, 0xF9, 0x4C, 0xB1, 0xDB,
+    0x20, 0x0B, 0x57, 0xFD, 0x96, 0xD3, 0x8D, 0xED, 0xB7, 0x91, 0x95, 0x47, 0xE4, 0x45, 0x87, 0xFA,
+    0x40, 0xEE, 0x21, 0xE1, 0x71, 0x0B, 0xFD, 0xE8, 0x38, 0xD0, 0x5E, 0x81, 0x87, 0x3D, 0xC7, 0x77,
+    0x19, 0x89, 0x40, 0xD1, 0xF7, 0x48, 0x01, 0x6F, 0xF2, 0xE4, 0xD6, 0x06, 0xB3, 0xB5, 0xED, 0xA9,
+    0xFB, 0xE7, 0x63, 0x33, 0x19, 0x2C, 0xF5, 0x66, 0xE4, 0x6C, 0x43, 0xD1, 0x99, 0xCD, 0x09, 0x46,
+    0x39, 0x31, 0xB1, 0xD3, 0x90, 0x16, 0xDD, 0x36, 0xA0, 0x8F, 0x6F, 0x95, 0xD7, 0x62, 0xF1, 0xEF,
+    0x6C, 0xA1, 0x32, 0x32, 0xDB, 0x3B, 0xC0, 0x4C, 0xBA, 0x9F, 0xCB, 0x1A, 0xF8, 0xEE, 0x8B, 0x76,
+    0x7F, 0xBF, 0xAB, 0x8D, 0x92, 0x7D, 0x17, 0x87, 0xBC, 0x60, 0x2F, 0x5B, 0xDD, 0x7B, 0xBB, 0x4F,
+    0x39, 0x91, 0x01, 0xF5, 0xA4, 0x5B, 0xB3, 0x01, 0x49, 0xD2, 0x03, 0xB7, 0xD5, 0xA8, 0x4E, 0xA4,
+    0x02, 0x63, 0x78, 0xA4, 0x43, 0xE5, 0x3F, 0x5A, 0x39, 0x6F, 0xB5, 0x8E, 0x00, 0x81, 0x7C, 0xB7,
+    0x83, 0x18, 0x71, 0xDB, 0x3B, 0x4A, 0x14, 0xC9, 0x1D, 0x28, 0xA2, 0xDA, 0xA6, 0xF4, 0x1D, 0x98,
+    0xDD, 0xDB, 0xFF, 0xD0, 0x29, 0xB7, 0xB4, 0x56, 0x05, 0x06, 0xA7, 0x33, 0x84, 0x26, 0x7D, 0xF4,
+    0xEF, 0x2B, 0x18, 0x19, 0x63, 0x11, 0xF0, 0xEF, 0x24, 0x8B, 0xE1, 0xD0, 0x11, 0xCA, 0xA1, 0xB6,
+    0x95, 0x6C, 0xBE, 0x00, 0xD0, 0x78, 0x20, 0xD8, 0x27, 0xCA, 0x43, 0x1F, 0xBE, 0x81, 0x4C, 0xED,
+    0x3C, 0x68, 0xBF, 0xBD, 0x1D, 0x6D, 0xEA, 0xDD, 0x0E, 0x6A, 0xD8, 0xE7, 0x75, 0x9C, 0x94, 0xB1,
+    0xB2, 0xFE, 0x78, 0x17, 0x57, 0xDF, 0x60, 0xFC, 0x92, 0xB8, 0x73, 0x23, 0x20, 0x78, 0xDD, 0x8A,
+    0xB2, 0xD3, 0xDC, 0x48, 0xE0, 0x85, 0xC7, 0xEB, 0x30, 0xDD, 0x40, 0xD4, 0xDE, 0x21, 0xC6, 0x2F,
+    0x65, 0xA7, 0xF8, 0x3F, 0x18, 0x37, 0xF7, 0x44, 0xD9, 0x6A, 0x65, 0xEB, 0xA6, 0x3E, 0x5D, 0x14,
+    0xEB, 0xBF, 0x72, 0xB7, 0x95, 0xD9, 0x92, 0xD6, 0x7C, 0x2C, 0xB3, 0x43, 0xDC, 0xE1, 0xA7, 0xE9,
+    0xE2, 0xFA, 0xB7, 0xB5, 0x5E, 0x88, 0xB0, 0xBF, 0xE8, 0xA1, 0xAB, 0xF0, 0xB2, 0xE3, 0x1A, 0xD0,
+    0x0B, 0xBA, 0xE1, 0xAD, 0x25, 0xF1, 0x40, 0x9B, 0x3B, 0x89, 0x68, 0x66, 0x04, 0x76, 0xD4, 0x0A,
+    0xFB, 0x35, 0xDF, 0xD2, 0x6A, 0x0E, 0x59, 0xAC, 0x9B, 0x6F, 0xCA, 0xB5, 0xA7, 0xE0, 0xFF, 0x78,
+    0xFD, 0x8C, 0x34, 0x5B, 0x98, 0x32, 0x71, 0xBE, 0x7A, 0x81, 0x83, 0x76, 0x0B, 0x78, 0x3C, 0x2C,
+    0xCD, 0x07, 0x33, 0xB8, 0x41, 0xB0, 0xB6, 0xC4, 0x0F, 0x2D, 0xB1, 0x03, 0xF1, 0x24, 0x47, 0x96,
+    0xBA, 0x2F, 0xF3, 0x85, 0xEB, 0x69, 0x88, 0x90, 0x8F, 0xDD, 0xAC, 0x40, 0x4A, 0xD7, 0x94, 0x6A,
+    0x00, 0x12, 0xC3, 0x6F, 0x07, 0x72, 0xCA, 0x0A, 0x84, 0x18, 0x7A, 0xA9, 0xBA, 0x54, 0xF8, 0x54,
+    0xD8, 0x6F, 0xBB, 0xF9, 0xFA, 0x94, 0x38, 0x8B, 0xB0, 0x46, 0x73, 0xCF, 0xB2, 0x6A, 0x16, 0xB1,
+    0x0C, 0xAE, 0x0E, 0x9A, 0xB0, 0x2C, 0x68, 0x4F, 0xD4, 0x30, 0x1E, 0x21, 0x9B, 0x4C, 0x16, 0xF2,
+    0xD0, 0xA9, 0x5B, 0x35, 0x7A, 0x36, 0x8D, 0x92, 0x38, 0x42, 0x7B, 0xB8, 0xE5, 0xCF, 0x33, 0x8E,
+    0xF3, 0xD4, 0x49, 0xE1, 0xAB, 0x98, 0xFD, 0x47, 0x2C, 0x7F, 0xAF, 0xB6, 0x89, 0x5B, 0x60, 0x80,
+    0xE4, 0x22, 0x30, 0xBA, 0xDD, 0x04, 0xAB, 0x8E, 0x0D, 0xE1, 0x53, 0x4E, 0x62, 0xB2, 0x52, 0x46,
+    0x4D, 0x10, 0x45, 0x88, 0x06, 0x41, 0x7A, 0xFF, 0xDD, 0xE0, 0x9D, 0x13, 0xD8, 0xE6, 0xB9, 0xB1,
+    0x45, 0x5D, 0xE0, 0xB8, 0x90, 0x92, 0x9E, 0x70, 0xE9, 0x66, 0xB2, 0xFD, 0xBA, 0x8B, 0xC7, 0x00,
+    0x32, 0x53, 0xEC, 0x35, 0xEE, 0x9B, 0x87, 0xA0, 0x84, 0xB2, 0xFF, 0x1A, 0x3C, 0x6C, 0xD7, 0xF2,
+    0x37, 0x37, 0xB8, 0xED, 0x08, 0xB9, 0x5A, 0x3F, 0x9B, 0xD7, 0xD0, 0x25, 0x97, 0x64, 0x56, 0xC2,
+    0xEC, 0xB0, 0xA8, 0x9F, 0xF3, 0x42, 0x68, 0x1F, 0xF0, 0xCD, 0x2E, 0xF7, 0xAD, 0x3C, 0x0D, 0x3A,
+    0x43, 0xAC, 0xB7, 0x05, 0x12, 0xB9, 0x35, 0x96, 0x70, 0x69, 0x50, 0xEB, 0x67, 0xA8, 0xAC, 0x8A,
+    0xAF, 0xDA, 0xBA, 0x6C, 0x7A, 0xAD, 0x9A, 0xDA, 0x0C, 0xBE, 0xA5, 0xCE, 0xA4, 0x3C, 0x1B, 0x24,
+    0xAE, 0x32, 0xDB, 0x97, 0x97, 0x04, 0x8E, 0xAA, 0x73, 0xB8, 0xAB, 0xB8, 0x51, 0x81, 0x4E, 0xC6,
+    0x27, 0x01, 0x66, 0x34, 0xB9, 0xC9, 0x2D, 0xC0, 0x7F, 0x48, 0x7C, 0xD3, 0xB2, 0xEB, 0x61, 0x9A,
+    0x6E, 0xA5, 0x00, 0x64, 0x42, 0x20, 0xAC, 0xC3, 0x61, 0x53, 0x09, 0x20, 0xAC, 0x71, 0xFA, 0x90,
+    0x31, 0x5C, 0xF9, 0x2B, 0x43, 0xCA, 0xF5, 0x5C, 0x55, 0xE3, 0xC0, 0x6B, 0xE0, 0x05, 0x62, 0x74,
+    0x1E, 0x7C, 0xD0, 0x18, 0x69, 0xBD, 0x53, 0x6B, 0x1D, 0x48, 0xA1, 0x32, 0x05, 0x52, 0xFD, 0x5C,
+    0x03, 0x0D, 0x2D, 0x41, 0x56, 0x57, 0x61, 0x70, 0x81, 0x83, 0x8A, 0x93, 0x9C, 0xA2, 0xB2, 0xC2,
+    0xC3, 0xCB, 0xD6, 0xEA, 0xEF, 0xF2, 0x00, 0x08, 0x0C, 0x15, 0x18, 0x24, 0x33, 0x3E, 0x45, 0x73,
+    0x77, 0x7A, 0x7D, 0x02, 0x0A, 0x2E, 0x38, 0x3F, 0x41, 0x62, 0x83, 0x90, 0x9E, 0xBA, 0xC9, 0x06,
+    0x26, 0x2C, 0x41, 0x59, 0x5E, 0x60, 0x68, 0x75, 0x7D, 0x82, 0x85, 0xA1, 0xE7, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x16, 0x23, 0x2F, 0x3E
+};
+
+/* ML-DSA-65 */
+static const uint8 g_mlDsa65PublicKey[MLDSA65_PUBLIC_KEY_SIZE] = {
+    0x48, 0x68, 0x3D, 0x91, 0x97, 0x8E, 0x31, 0xEB, 0x3D, 0xDD, 0xB8, 0xB0, 0x47, 0x34, 0x82, 0xD2,
+    0xB8, 0x8A, 0x5F, 0x62, 0x59, 0x49, 0xFD, 0x8F, 0x58, 0xA5, 0x61, 0xE6, 0x96, 0xBD, 0x4C, 0x27,
+    0xD0, 0x5B, 0x38, 0xDB, 0xB2, 0xED, 0xF0, 0x1E, 0x66, 0x4E, 0xFD, 0x81, 0xBE, 0x1E, 0xA8, 0x93,
+    0x68, 0x8C, 0xE6, 0x8A, 0xA2, 0xD5, 0x1C, 0x59, 0x58, 0xF8, 0xBB, 0xC6, 0xEB, 0x4E, 0x89, 0xEE,
+    0x67, 0xD2, 0xC0, 0x32, 0x09, 0x54, 0xD5, 0x72, 0x12, 0xCA, 0xC7, 0x22, 0x9F, 0xF1, 0xD6, 0xEA,
+    0xF0, 0x39, 0x28, 0xBD, 0x51, 0x51, 0x1F, 0x8D, 0x88, 0xD8, 0x47, 0x73, 0x6C, 0x7D, 0xE2, 0x73,
+    0x0D, 0x59, 0x78, 0xE5, 0x41, 0x07, 0x13, 0x16, 0x09, 0x78, 0x86, 0x77, 0x11, 0xBF, 0x55, 0x39,
+    0xA0, 0xBF, 0xC4, 0xC3, 0x50, 0xC2, 0xBE, 0x57, 0x2B, 0xAF, 0x0E, 0xE2, 0xE2, 0xFB, 0x16, 0xCC,
+    0xFE, 0xA0, 0x80, 0x28, 0xD9, 0x9A, 0xC4, 0x9A, 0xEB, 0xB7, 0x59, 0x37, 0xDD, 0xCE, 0x11, 0x1C,
+    0xDA, 0xB6, 0x2F, 0xFF, 0x3C, 0xEA, 0x8B, 0xA2, 0x23, 0x3D, 0x1E, 0x56, 0xFB, 0xC5, 0xC5, 0xA1,
+    0xE7, 0x26, 0xDE, 0x63, 0xFA, 0xDD, 0x2A, 0xF0, 0x16, 0xB1, 0x19, 0x17, 0x7F, 0xA3, 0xD9, 0x71,
+    0xA2, 0xD9, 0x27, 0x71, 0x73, 0xFC, 0xE5, 0x5B, 0x67, 0x74, 0x5A, 0xF0, 0xB7, 0xC2, 0x1D, 0x59,
+    0x7D, 0xBE, 0xB9, 0x3E, 0x6A, 0x32, 0xF3, 0x41, 0xC4, 0x9A, 0x5A, 0x8B, 0xE9, 0xE8, 0x25, 0x08,
+    0x8D, 0x1F, 0x2A, 0xA4, 0x51, 0x55, 0xD6, 0xC8, 0xAE, 0x15, 0x36, 0x7E, 0x4E, 0xB0, 0x03, 0xB8,
+    0xFD, 0xF7, 0x85, 0x10, 0x71, 0x94, 0x97, 0x39, 0xF9, 0xFF, 0xF0, 0x90, 0x23, 0xEA, 0xF4, 0x51,
+    0x04, 0xD2, 0xA8, 0x4A, 0x45, 0x90, 0x6E, 0xED, 0x46, 0x71, 0xA4, 0x4D, 0xC2, 0x8D, 0x27, 0x98,
+    0x7B, 0xB5, 0x5D, 0xF6, 0x9E, 0x9E, 0x85, 0x61, 0xF6, 0x1A, 0x80, 0xA7, 0x26, 0x99, 0x50, 0x38,
+    0x65, 0xFE, 0xD9, 0xB7, 0xEE, 0x72, 0xA8, 0xE1, 0x7A, 0x19, 0xC4, 0x08, 0x14, 0x4F, 0x4B, 0x29,
+    0xAF, 0xEF, 0x70, 0x31, 0xC3, 0xA6, 0xD8, 0x57, 0x16, 0x10, 0xB4, 0x2C, 0x9F, 0x42, 0x12, 0x45,
+    0xA8, 0x8F, 0x19, 0x7E, 0x16, 0x81, 0x2B, 0x03, 0x11, 0x59, 0xB6, 0x5B, 0x96, 0x87, 0xE5, 0xB3,
+    0xE9, 0x34, 0xC5, 0x22, 0x5A, 0xE9, 0x8A, 0x79, 0xBA, 0x73, 0xD2, 0xB3, 0x99, 0xD7, 0x35, 0x10,
+    0xEF, 0xFA, 0xD1, 0x9E, 0x53, 0xB8, 0x45, 0x0F, 0x0B, 0xA8, 0xFC, 0xE1, 0x01, 0x2F, 0xD9, 0x8D,
+    0x26, 0x0A, 0x74, 0xAA, 0xAA, 0x13, 0xFA, 0xE2, 0x49, 0xA0, 0x06, 0xB1, 0xC3, 0x4F, 0x5B, 0xA0,
+    0xB8, 0x82, 0xF2, 0x63, 0x78, 0x22, 0x2F, 0xB3, 0x6F, 0x22, 0x83, 0xC2, 0x43, 0xF0, 0xFF, 0xEB,
+    0x5F, 0x1B, 0xB4, 0x14, 0xA0, 0xA7, 0x0D, 0x55, 0xE3, 0xD4, 0x0A, 0x56, 0xB6, 0xCB, 0xC8, 0x8A,
+    0xE1, 0xF0, 0x3B, 0x7B, 0x28, 0x82, 0xD9, 0x8D, 0xEE, 0xA2, 0x8E, 0x14, 0x5C, 0x9D, 0xED, 0xFD,
+    0x8E, 0xAF, 0x1C, 0xEF, 0x2E, 0xD9, 0x4A, 0x8B, 0x05, 0x0F, 0x89, 0x64, 0xF4, 0x6D, 0x1E, 0xA0,
+    0xD0, 0xC2, 0xA4, 0x3E, 0x0D, 0xDA, 0x61, 0x82, 0xAD, 0xBF, 0x4F, 0x6E, 0xD1, 0x75, 0xB6, 0x74,
+    0x22, 0x57, 0x85, 0x9B, 0xF2, 0x2F, 0x3A, 0x41, 0x7E, 0xCF, 0x1F, 0x9D, 0x89, 0x31, 0x7B, 0x5E,
+    0x53, 0x9D, 0x58, 0x7A, 0xF1, 0x6B, 0x9E, 0x13, 0x13, 0xE0, 0x45, 0x14, 0xFF, 0xA6, 0x4B, 0xA8,
+    0xB3, 0xFF, 0x2B, 0x83, 0x21, 0xF8, 0x81, 0x1C, 0xB3, 0xFB, 0x02, 0x2C, 0x8F, 0x64, 0x4E, 0x70,
+    0xA4, 0xB8, 0x0A, 0x2F, 0xBF, 0xEE, 0x60, 0x4A, 0xBB, 0x73, 0x79, 0x09, 0x1E, 0xA8, 0xE6, 0xC5,
+    0xC7, 0x4D, 0xFC, 0x02, 0x83, 0x66, 0x6B, 0x40, 0xC0, 0x79, 0x38, 0x70, 0x02, 0x82, 0x04, 0xA1,
+    0x36, 0xBF, 0x5D, 0xA9, 0x56, 0x8E, 0xB7, 0x98, 0xD3, 0x49, 0x03, 0x8B, 0xDB, 0x0C, 0x11, 0xE0,
+    0x34, 0x45, 0xE7, 0x84, 0x7C, 0xB5, 0x06, 0x9C, 0x75, 0xCF, 0x28, 0xAC, 0x60, 0x1C, 0x77, 0x99,
+    0xD9, 0x58, 0x21, 0x0D, 0xDB, 0xCB, 0x22, 0x6E, 0x51, 0xAF, 0xEF, 0x9F, 0x1D, 0xE4, 0x7B, 0x07,
+    0x38, 0x73, 0xD6, 0xD3, 0xF9, 0x74, 0x56, 0xBE, 0xDE, 0x08, 0x50, 0x82, 0xE7, 0x4A, 0x29, 0x8B,
+    0x2C, 0xD4, 0x8F, 0x4B, 0x30, 0x93, 0x15, 0x5F, 0x36, 0x6C, 0x8F, 0xA6, 0x01, 0xC6, 0xAF, 0x85,
+    0x8D, 0xFA, 0x32, 0xC0, 0x84, 0x91, 0xB2, 0xA2, 0x98, 0x87, 0xF9, 0x03, 0x35, 0x94, 0x9A, 0x5D,
+    0x6E, 0xDA, 0xA6, 0x79, 0x88, 0x2A, 0x3A, 0x95, 0xD6, 0xBF, 0x6D, 0x97, 0x0A, 0x22, 0x1F, 0x4B,
+    0x9D, 0x3D, 0x8C, 0xBF, 0x38, 0x4A, 0xF8, 0x1A, 0xAC, 0x95, 0xE2, 0xB3, 0x29, 0x4E, 0x04, 0x78,
+    0x9A, 0xC8, 0x37, 0x27, 0xA5, 0xDC, 0x04, 0x55, 0x9F, 0x96, 0xAF, 0x41, 0xD8, 0xA0, 0x53, 0x51,
+    0x6F, 0xEE, 0xEE, 0xBC, 0x52, 0x74, 0x6E, 0xB6, 0xAB, 0x28, 0x19, 0xE0, 0x91, 0x08, 0x71, 0x0D,
+    0x83, 0x5F, 0x01, 0x1F, 0xA6, 0x30, 0x65, 0x87, 0x2A, 0xD3, 0x34, 0xD5, 0xCD, 0xFF, 0xB2, 0xB2,
+    0x31, 0x05, 0x07, 0xE9, 0x2F, 0xC9, 0x93, 0xAE, 0x31, 0x7D, 0xA9, 0x7F, 0x4F, 0x30, 0x9C, 0xDA,
+    0xF0, 0xF6, 0x7E, 0xD9, 0x9D, 0x90, 0x21, 0x55, 0x76, 0x08, 0x38, 0x49, 0xF9, 0x53, 0xB2, 0x46,
+    0xD7, 0xFE, 0xDB, 0x3F, 0xDB, 0x67, 0x67, 0x98, 0x50, 0xA5, 0xAD, 0x40, 0x4E, 0x64, 0x14, 0x7F,
+    0xB7, 0xCF, 0x4F, 0x6A, 0xED, 0xDD, 0x05, 0xAF, 0xB4, 0xB8, 0x34, 0x96, 0x8D, 0x1F, 0xE8, 0x80,
+    0x14, 0x96, 0x0D, 0xCE, 0x5D, 0x94, 0x22, 0x36, 0x52, 0x6E, 0x12, 0xA4, 0x78, 0xD6, 0x9E, 0x5F,
+    0xBE, 0x69, 0x70, 0x31, 0x0B, 0x30, 0x8C, 0x06, 0x84, 0x50, 0x18, 0xCF, 0xC7, 0xB2, 0xAB, 0x43,
+    0x0A, 0x13, 0xA6, 0xB1, 0xAC, 0x7B, 0xB0, 0x2C, 0xCC, 0xBB, 0x3D, 0x91, 0x1A, 0xC2, 0xF1, 0x10,
+    0x68, 0x61, 0x3F, 0xBE, 0x02, 0x9B, 0xFD, 0xCE, 0x02, 0xCF, 0x5C, 0xD3, 0x89, 0x50, 0xED, 0x72,
+    0xC8, 0x39, 0x44, 0xED, 0xFB, 0xC7, 0x56, 0x15, 0xAF, 0x87, 0xF8, 0x64, 0xC0, 0x51, 0xF3, 0xC5,
+    0x54, 0x56, 0xC5, 0x41, 0x28, 0x63, 0xA4, 0x0C, 0x06, 0xD1, 0xDA, 0xB5, 0x62, 0xBD, 0xFF, 0x05,
+    0x71, 0xB8, 0xD3, 0xC3, 0x91, 0x7B, 0xBD, 0x30, 0x08, 0x80, 0xBB, 0xA5, 0xE9, 0x98, 0x23, 0x9B,
+    0x95, 0xFA, 0x91, 0xB7, 0xD6, 0x41, 0x6D, 0x4F, 0x39, 0x8B, 0x3A, 0xDB, 0xCD, 0x30, 0x98, 0x3E,
+    0xD3, 0x59, 0x2B, 0x4D, 0x9E, 0xF7, 0xD4, 0x23, 0x6F, 0xD0, 0x0F, 0x50, 0xD9, 0x8A, 0xA5, 0x3A,
+    0x23, 0x5A, 0xC4, 0x17, 0x27, 0x20, 0xF7, 0x7D, 0x96, 0x17, 0x26, 0x72, 0x98, 0x0C, 0xFE, 0x8F,
+    0xF7, 0xA5, 0xA7, 0x02, 0x78, 0x3E, 0xDC, 0x2B, 0xA3, 0x1B, 0x22, 0x59, 0x01, 0x5A, 0x11, 0x2F,
+    0xC7, 0xF4, 0x68, 0xA9, 0xC2, 0xF9, 0x46, 0x40, 0x39, 0x00, 0x2D, 0x30, 0xEF, 0x67, 0x8B, 0x4C,
+    0xB7, 0x98, 0xBC, 0x11, 0x62, 0x16, 0xBF, 0x7A, 0x9A, 0x7C, 0x18, 0xBA, 0x03, 0xB7, 0xB5, 0x8F,
+    0xD0, 0x75, 0x15, 0xD3, 0x11, 0x50, 0x49, 0xD3, 0x61, 0x4B, 0xE7, 0xA0, 0x7E, 0x74, 0x43, 0x00,
+    0x75, 0x0D, 0xF1, 0xD2, 0xC5, 0x87, 0x53, 0x38, 0x90, 0x59, 0xEA, 0xFC, 0x3D, 0x78, 0x5C, 0xCD,
+    0xD3, 0x1C, 0x07, 0x64, 0x8B, 0xED, 0xC0, 0x3A, 0x5C, 0x3B, 0x8A, 0xD4, 0x6D, 0x06, 0x4D, 0x59,
+    0xC1, 0x3D, 0x57, 0x37, 0x47, 0x29, 0xFC, 0x4E, 0x29, 0x53, 0x62, 0xE2, 0xA5, 0x19, 0x12, 0x04,
+    0x53, 0x04, 0x28, 0xBC, 0x15, 0x22, 0xAF, 0xA2, 0x8F, 0xF5, 0xFE, 0x16, 0x55, 0xE3, 0x04, 0xCA,
+    0x5B, 0xC8, 0xC2, 0x7A, 0xD0, 0xE0, 0xC6, 0xA3, 0x9D, 0xD4, 0xDF, 0x28, 0x95, 0x6C, 0x14, 0xB3,
+    0x8C, 0xC9, 0x36, 0x82, 0xCE, 0xFE, 0x40, 0x2B, 0xBD, 0x5E, 0x82, 0xD2, 0x9C, 0x46, 0x4E, 0x44,
+    0xEB, 0x5D, 0x37, 0xB4, 0x8F, 0xC5, 0x68, 0xDF, 0xE0, 0xCC, 0x6E, 0x8E, 0x16, 0xBA, 0xEA, 0x05,
+    0xE5, 0x13, 0x55, 0x90, 0xF1, 0x92, 0x94, 0xE7, 0x3E, 0x83, 0x67, 0xB0, 0x21, 0x6D, 0xBB, 0x81,
+    0x50, 0x30, 0xB9, 0xDE, 0x55, 0x91, 0x3F, 0x08, 0x03, 0x9C, 0x42, 0x35, 0x1C, 0x59, 0xE5, 0x51,
+    0x5D, 0xD5, 0xAF, 0x8E, 0x08, 0x9A, 0x15, 0xE6, 0x25, 0xE8, 0xF6, 0xDE, 0xE6, 0x39, 0x38, 0x6C,
+    0x46, 0x49, 0x7D, 0x7A, 0x26, 0x32, 0x88, 0x77, 0x4D, 0xE5, 0x81, 0xA7, 0xDE, 0x96, 0x29, 0xB4,
+    0x1B, 0x44, 0x24, 0x14, 0x1F, 0x97, 0x8F, 0xB8, 0x33, 0x12, 0x08, 0xEF, 0xDE, 0xC3, 0xC6, 0xE0,
+    0xDE, 0x39, 0xBC, 0x57, 0x06, 0x3F, 0x3D, 0xCD, 0x6C, 0x47, 0x03, 0x73, 0xC0, 0x88, 0x91, 0xEA,
+    0x29, 0xCB, 0xC7, 0xCC, 0x6D, 0x64, 0x83, 0xB8, 0x88, 0x90, 0x83, 0xAC, 0xE8, 0x6A, 0xA7, 0xB5,
+    0x1B, 0x1C, 0x2C, 0xFE, 0x6E, 0x2A, 0xD1, 0x8D, 0x97, 0xCE, 0x36, 0xFB, 0xC5, 0x6E, 0xA4, 0x2F,
+    0xAE, 0x97, 0xE6, 0xA7, 0xAC, 0x11, 0x48, 0x64, 0x47, 0x8C, 0x36, 0x6D, 0xF1, 0xEB, 0xB1, 0xE7,
+    0xB1, 0x1A, 0x90, 0x98, 0x50, 0x4F, 0xD5, 0x97, 0x5B, 0xDF, 0x1F, 0x49, 0xDC, 0x70, 0x00, 0x2B,
+    0x63, 0xC1, 0x73, 0x9A, 0x9D, 0x26, 0x3F, 0xBA, 0xD4, 0x07, 0x3F, 0x6A, 0x9F, 0x6C, 0x2B, 0x8A,
+    0xF4, 0xB4, 0xC3, 0x32, 0xA1, 0x03, 0xA0, 0xCF, 0xFA, 0x5D, 0xEE, 0xB2, 0xD0, 0x62, 0xCA, 0x3C,
+    0x21, 0x5F, 0xD3, 0x60, 0x02, 0x6B, 0xE7, 0xC5, 0x16, 0x4F, 0x4A, 0x44, 0x24, 0xEF, 0x74, 0x94,
+    0x88, 0x04, 0xD6, 0x6F, 0x46, 0x48, 0x77, 0x32, 0xC8, 0x20, 0x2C, 0x79, 0x54, 0x78, 0x64, 0x7B,
+    0x4E, 0xA7, 0x1D, 0x62, 0x7C, 0x08, 0x60, 0x24, 0xCC, 0xA3, 0x54, 0xA4, 0x1F, 0x08, 0x77, 0xB3,
+    0x8F, 0x19, 0xB3, 0x77, 0x4A, 0xD2, 0x09, 0x5C, 0x8D, 0xA5, 0x3B, 0x06, 0x9E, 0x21, 0xC7, 0x6A,
+    0xE2, 0xD2, 0x00, 0x7E, 0x16, 0x71, 0x9E, 0xD4, 0x00, 0x80, 0xD3, 0x34, 0xF7, 0xDA, 0x52, 0xE9,
+    0xF5, 0xA5, 0x99, 0x04, 0x39, 0xCA, 0xF0, 0x83, 0xA9, 0x5B, 0x83, 0x3F, 0x02, 0xAD, 0x10, 0xA0,
+    0x8C, 0x1A, 0x6D, 0x0F, 0x26, 0x0C, 0x00, 0x72, 0x85, 0xBD, 0x4A, 0x2F, 0x47, 0x70, 0x3A, 0x5A,
+    0xEF, 0x46, 0x52, 0x87, 0xD2, 0x53, 0xB1, 0x8A, 0xC2, 0x25, 0x14, 0x31, 0x62, 0x10, 0xFF, 0x56,
+    0x68, 0x14, 0xB1, 0x0F, 0x87, 0xA2, 0x93, 0xD6, 0xF1, 0x99, 0xD3, 0xC3, 0x95, 0x99, 0x90, 0xD0,
+    0xC1, 0x26, 0x8B, 0x4F, 0x50, 0xD5, 0xF9, 0xFC, 0xEF, 0xBB, 0xF2, 0x37, 0xBD, 0x0C, 0x28, 0xB8,
+    0x01, 0x82, 0xD6, 0x65, 0x97, 0x41, 0xF1, 0x4F, 0x10, 0xBF, 0xBB, 0x21, 0xBB, 0xA1, 0x2A, 0xB6,
+    0x20, 0xAA, 0x23, 0x96, 0xF5, 0x6C, 0x06, 0x86, 0xB4, 0xEA, 0x90, 0x17, 0x99, 0x02, 0x24, 0x21,
+    0x6B, 0x2F, 0xE8, 0xAD, 0x76, 0xC4, 0xA9, 0x14, 0x8E, 0xEF, 0x9A, 0x86, 0xA3, 0x63, 0x5A, 0x6A,
+    0xA7, 0x7B, 0xC1, 0xDC, 0xFB, 0x6F, 0xBA, 0x59, 0xA7, 0x7D, 0xFD, 0xA9, 0xB7, 0x53, 0x0D, 0xC0,
+    0xCA, 0x86, 0x48, 0xC8, 0xD9, 0x73, 0x73, 0x8E, 0x01, 0xBA, 0xB8, 0xF0, 0x8B, 0x49, 0x05, 0xE8,
+    0x4A, 0xA4, 0x64, 0x1B, 0xD6, 0x02, 0x41, 0x0C, 0xD9, 0x75, 0x20, 0x26, 0x5F, 0x2F, 0x23, 0x1F,
+    0x2B, 0x35, 0xE1, 0x5E, 0xB2, 0xFA, 0x04, 0xD2, 0xBD, 0x94, 0xD5, 0xA7, 0x7A, 0xBA, 0xF1, 0xE0,
+    0xE1, 0x61, 0x01, 0x0A, 0x99, 0x00, 0x87, 0xF5, 0xB4, 0x6E, 0xA9, 0x88, 0xB2, 0xBC, 0x05, 0x12,
+    0xFD, 0xA0, 0xFA, 0x92, 0x3D, 0xAD, 0xD6, 0xC4, 0x5C, 0x53, 0x01, 0xD0, 0x94, 0x83, 0x67, 0x32,
+    0x65, 0xB5, 0xAB, 0x2E, 0x10, 0xF4, 0xBA, 0x52, 0x0F, 0x6B, 0xBA, 0xD5, 0x64, 0xA5, 0xC3, 0xD5,
+    0xE2, 0x7B, 0xDB, 0x08, 0x0F, 0x7D, 0x20, 0xE1, 0x32, 0x96, 0xA3, 0x18, 0x19, 0x54, 0xC3, 0x9C,
+    0x64, 0x9C, 0x94, 0x3E, 0xBE, 0x17, 0xDF, 0x5C, 0x1F, 0x7A, 0xAE, 0x0A, 0x8F, 0xE1, 0x26, 0xC4,
+    0x77, 0x58, 0x5A, 0x5D, 0x4D, 0x64, 0x8A, 0x0D, 0x00, 0x8B, 0x6A, 0xF5, 0xE8, 0xCD, 0x31, 0xBE,
+    0x69, 0xA9, 0x29, 0x6D, 0x4F, 0x3F, 0xD2, 0x5E, 0xD8, 0x6F, 0x22, 0x1E, 0x4B, 0x93, 0xF6, 0x5F,
+    0x59, 0x29, 0x96, 0x75, 0x33, 0x62, 0x4B, 0x92, 0x35, 0x75, 0x0C, 0x30, 0x70, 0x75, 0x50, 0xB5,
+    0x85, 0x36, 0xD1, 0x09, 0xA7, 0x13, 0x1C, 0x5A, 0x5B, 0xBE, 0x4A, 0x57, 0x15, 0x56, 0x7C, 0x12,
+    0x53, 0x4A, 0xEC, 0x76, 0x60, 0x76, 0x1E, 0xEB, 0xB9, 0xFA, 0xE2, 0x89, 0x1C, 0x77, 0x45, 0x89,
+    0xB8, 0x0E, 0x56, 0x6A, 0xD5, 0x57, 0xDD, 0xEF, 0x73, 0x67, 0x19, 0x6B, 0x72, 0x27, 0xEA, 0x98,
+    0x70, 0xEF, 0x09, 0xDD, 0xFE, 0xC7, 0x9D, 0x6B, 0x93, 0x19, 0xA6, 0x87, 0x9B, 0x52, 0x05, 0xD7,
+    0x6B, 0xF7, 0xAB, 0xA5, 0xAC, 0xF3, 0x3A, 0xFB, 0x59, 0xD1, 0x7F, 0xC5, 0x4E, 0x68, 0x38, 0x3D,
+    0x6B, 0xE5, 0xA0, 0x8E, 0x9B, 0x66, 0xDA, 0x53, 0xDC, 0xDE, 0x00, 0x8B, 0xB2, 0x94, 0xB8, 0x58,
+    0x2B, 0xD1, 0x32, 0xCD, 0xCC, 0x49, 0x95, 0x9F, 0xDB, 0xC2, 0x1E, 0x52, 0x72, 0x18, 0x80, 0xC8,
+    0xAD, 0x03, 0x52, 0xC7, 0x9F, 0x03, 0xA4, 0x3B, 0xBD, 0x84, 0xC4, 0xCD, 0xFD, 0xC6, 0xC5, 0x29,
+    0x00, 0x5E, 0x1E, 0x7C, 0xD9, 0xA3, 0x49, 0xA7, 0x16, 0x8A, 0x35, 0x56, 0x9B, 0xA5, 0xDE, 0xA8,
+    0x18, 0x96, 0x8D, 0x5A, 0x91, 0x46, 0x6B, 0xD6, 0xE6, 0x4E, 0x20, 0xBF, 0x62, 0x41, 0x71, 0x98,
+    0xAF, 0xC4, 0xE8, 0x1C, 0x28, 0xDD, 0x77, 0xED, 0x40, 0x28, 0x23, 0x23, 0x98, 0xB5, 0x2F, 0xBD,
+    0xE8, 0x6B, 0xC8, 0x4F, 0x47, 0x5B, 0x90, 0x16, 0x71, 0x0C, 0xE2, 0xAA, 0xBC, 0x11, 0xA0, 0x6B,
+    0x4D, 0xBA, 0xC9, 0x01, 0xEC, 0x16, 0xCF, 0x36, 0x5C, 0xA3, 0xF2, 0xD5, 0x38, 0x13, 0x94, 0x8A,
+    0x69, 0x3A, 0x0F, 0x93, 0xE7, 0x9C, 0x46, 0xCA, 0x5D, 0x5A, 0x6D, 0xCA, 0x3D, 0x28, 0xCA, 0x50,
+    0xAD, 0x18, 0xBD, 0x13, 0xFC, 0xA5, 0x50, 0x59, 0xDD, 0x9B, 0x18, 0x5F, 0x79, 0xF9, 0xC4, 0x71,
+    0x96, 0xA4, 0xE8, 0x1B, 0x21, 0x04, 0xBC, 0x46, 0x0A, 0x05, 0x1E, 0x02, 0xF2, 0xE8, 0x44, 0x4F
+};
+static const uint8 g_mlDsa65Signature[MLDSA65_SIGNATURE_SIZE] = {
+    0xA2, 0xF8, 0x43, 0xAE, 0xE2, 0xA3, 0x4D, 0x9F, 0xD0, 0x09, 0xF9, 0x0B, 0x9D, 0x57, 0x56, 0xE0,
+    0x2C, 0x0D, 0x87, 0x3D, 0x55, 0xFA, 0x8A, 0x64, 0xF2, 0xD1, 0x53, 0xDF, 0x89, 0x3C, 0x80, 0xE9,
+    0x3F, 0xF6, 0x2A, 0xE6, 0xB4, 0xAF, 0xD1, 0xA7, 0x8D, 0xD5, 0x3A, 0x81, 0xDF, 0x33, 0xEE, 0x97,
+    0x43, 0xA3, 0xEE, 0x51, 0x39, 0xAA, 0x56, 0x71, 0x28, 0xB5, 0x5B, 0x19, 0xBB, 0xDF, 0x13, 0x34,
+    0x66, 0xA0, 0x64, 0xC3, 0x9A, 0x2D, 0x02, 0x4D, 0x1D, 0x26, 0xE6, 0x0E, 0xFE, 0xD0, 0xEB, 0x55,
+    0xB4, 0x88, 0xF4, 0xC4, 0xD3, 0x74, 0xBA, 0x44, 0xB5, 0xCD, 0xAE, 0xD5, 0x42, 0xC6, 0x1D, 0xD3,
+    0x19, 0xF9, 0xFF, 0x6E, 0x94, 0xE6, 0xAD, 0xE9, 0x8A, 0x8D, 0x23, 0x91, 0x23, 0xAB, 0x97, 0x6B,
+    0xF9, 0x34, 0x4D, 0xD7, 0x1E, 0x2A, 0xE1, 0xC2, 0xB8, 0x34, 0xB4, 0x5F, 0x00, 0x6F, 0x74, 0xAB,
+    0xF1, 0xD5, 0xE5, 0xF7, 0x29, 0xCF, 0xBF, 0xFE, 0x2E, 0x81, 0xC6, 0xCC, 0xED, 0xA1, 0x15, 0x34,
+    0x5A, 0x25, 0x60, 0xE7, 0x99, 0x08, 0x5F, 0x57, 0xD9, 0x53, 0x60, 0x1A, 0xDC, 0x5B, 0xC8, 0xEF,
+    0x6D, 0x6D, 0x1B, 0x26, 0x66, 0x21, 0xD1, 0xDE, 0x80, 0x5A, 0xB6, 0x7A, 0x22, 0x88, 0x95, 0xD5,
+    0xF5, 0x4D, 0xB0, 0xF1, 0x96, 0x44, 0x8A, 0x6A, 0x3F, 0x30, 0x07, 0x21, 0x07, 0xA0, 0xE7, 0xB4,
+    0xAC, 0xBD, 0x68, 0x95, 0x37, 0xB3, 0x90, 0x79, 0x7F, 0xE8, 0x68, 0x5D, 0x11, 0x74, 0xD7, 0x85,
+    0x0D, 0x1A, 0x82, 0x30, 0x3B, 0x52, 0xE2, 0x43, 0x6D, 0xE6, 0x72, 0x5F, 0x27, 0x45, 0xBE, 0xB2,
+    0xD8, 0xB4, 0xD8, 0xEF, 0xFC, 0x24, 0x9E, 0xAB, 0xF4, 0x3F, 0x3C, 0x8D, 0xBC, 0x35, 0xA4, 0xAA,
+    0xF9, 0x3B, 0xFC, 0x32, 0x85, 0xEE, 0x5E, 0xE3, 0xD3, 0x3F, 0xBA, 0xCD, 0xFF, 0xCC, 0xD0, 0xBC,
+    0x68, 0x5D, 0x16, 0x83, 0x75, 0xFC, 0xFA, 0xF6, 0x7E, 0xDE, 0xB5, 0x15, 0x12, 0x7C, 0x21, 0xAF,
+    0x57, 0x9B, 0xE5, 0x53, 0x35, 0x79, 0xC5, 0x1E, 0x6B, 0x57, 0xE5, 0xD5, 0x0E, 0x6D, 0x2B, 0x6B,
+    0x44, 0x70, 0xE5, 0x1E, 0xDA, 0x55, 0xB8, 0xCB, 0xC8, 0x29, 0x53, 0xEE, 0x6E, 0xB5, 0xB9, 0xF8,
+    0x4E, 0x38, 0x19, 0x92, 0xF7, 0x4E, 0x4E, 0x46, 0xBA, 0x08, 0x75, 0xA8, 0x74, 0xCD, 0xBE, 0xBC,
+    0x1D, 0x7E, 0xFE, 0x2C, 0x16, 0xB7, 0xEC, 0xD6, 0x2B, 0xFB, 0x3A, 0xA0, 0xCB, 0x23, 0xD3, 0x2F,
+    0x82, 0x0A, 0xD9, 0xE2, 0x6D, 0x62, 0x5E, 0x30, 0xEB, 0x18, 0x21, 0xC5, 0x7F, 0x22, 0x4B, 0x12,
+    0xCC, 0x71, 0xFF, 0x65, 0x37, 0xD1, 0xEA, 0xFB, 0x38, 0x9F, 0x32, 0x0E, 0xF1, 0x09, 0xF0, 0xCA,
+    0x37, 0xD3, 0xC6, 0x93, 0xE2, 0x72, 0x9A, 0x42, 0x8A, 0xDA, 0xAB, 0x16, 0x9C, 0xC8, 0x6A, 0xCE,
+    0xA9, 0x29, 0xDD, 0xC9, 0x29, 0xE6, 0x9D, 0xBB, 0x2B, 0x77, 0xEF, 0xBB, 0xE0, 0xB0, 0xEF, 0x0B,
+    0x98, 0xD8, 0x89, 0x69, 0xC7, 0xCE, 0x3B, 0xE0, 0x22, 0xEB, 0x89, 0xDB, 0xEA, 0x2C, 0x79, 0x0D,
+    0x9F, 0x9A, 0x75, 0xC6, 0xEC, 0x4A, 0x7F, 0x33, 0xED, 0x9A, 0x15, 0x24, 0xD6, 0xCB, 0x0F, 0x29,
+    0x22, 0xD1, 0xBD, 0x52, 0x87, 0x83, 0x86, 0x8A, 0x34, 0x9B, 0xDB, 0x8D, 0x13, 0x65, 0x6A, 0x69,
+    0x41, 0x70, 0x49, 0x45, 0x47, 0x86, 0x5E, 0x99, 0x81, 0x81, 0x79, 0xB3, 0xCC, 0x6A, 0x3C, 0xB9,
+    0x34, 0xC6, 0x1F, 0xBF, 0x4F, 0x59, 0x2D, 0xD1, 0x67, 0xFC, 0x18, 0x4C, 0x10, 0x85, 0x3C, 0x92,
+    0xFE, 0x41, 0x5D, 0xC6, 0xE4, 0xE6, 0x02, 0x6E, 0xE4, 0xFC, 0xE8, 0x82, 0x6C, 0x3F, 0xC3, 0x1D,
+    0x5D, 0x80, 0x8E, 0xBD, 0x4C, 0xC1, 0x86, 0xAB, 0x7A, 0x3F, 0x38, 0x7B, 0xD8, 0x57, 0xE1, 0x48,
+    0x47, 0x27, 0x81, 0x74, 0x8D, 0x7B, 0xD2, 0xD5, 0x65, 0x82, 0xF7, 0x9E, 0xED, 0x98, 0xAE, 0x94,
+    0x05, 0x7F, 0x34, 0xDB, 0x8F, 0x90, 0x29, 0x0A, 0x01, 0xD8, 0xDA, 0x8F, 0x97, 0xC1, 0xA8, 0x88,
+    0xCE, 0xBA, 0xC8, 0xD2, 0x5A, 0x04, 0xFC, 0xE0, 0xEE, 0x64, 0x2E, 0x04, 0x33, 0x0F, 0x55, 0x4C,
+    0x1E, 0xF2, 0x5C, 0xCF, 0xFB, 0xBA, 0x9A, 0x91, 0x88, 0x14, 0xB5, 0x21, 0x42, 0xF7, 0xBA, 0x20,
+    0xDD, 0x63, 0xAD, 0x11, 0xA8, 0xC5, 0xA4, 0xC1, 0x74, 0xDD, 0x3C, 0xBA, 0xA7, 0x38, 0xFA, 0xA6,
+    0x82, 0x6E, 0x2C, 0xF7, 0xE4, 0xAB, 0xC6, 0x84, 0x03, 0x74, 0x6E, 0xF8, 0xE6, 0xEF, 0x42, 0xF5,
+    0xFE, 0x82, 0xA8, 0x23, 0xBC, 0x6A, 0xD3, 0x28, 0x93, 0x1C, 0xD4, 0x9C, 0x49, 0x08, 0xC3, 0x7E,
+    0x96, 0x3B, 0xE5, 0xC7, 0x44, 0x58, 0x28, 0xDF, 0xA7, 0xAD, 0x54, 0xE2, 0xEB, 0x8B, 0xB1, 0x1C,
+    0x8D, 0x60, 0xFA, 0x75, 0x43, 0xB3, 0x55, 0xA6, 0xE9, 0xAF, 0x1B, 0x96, 0x3D, 0xE2, 0x66, 0x2C,
+    0xEB, 0xEE, 0x3B, 0xBB, 0x75, 0xC5, 0xBB, 0x62, 0xF1, 0xFD, 0x71, 0xA2, 0xBA, 0x81, 0xEB, 0xB8,
+    0xDF, 0x04, 0x19, 0x6D, 0xFC, 0xCF, 0x40, 0x1C, 0xF1, 0x4D, 0x09, 0xFA, 0x2C, 0x0A, 0x0D, 0x43,
+    0x8A, 0x96, 0xE4, 0xD5, 0xE0, 0x90, 0xA2, 0x0F, 0x17, 0x1D, 0x8F, 0x72, 0xAA, 0x4E, 0xF2, 0xFC,
+    0xC9, 0x80, 0x8D, 0xF9, 0xCE, 0xF2, 0x78, 0x99, 0x2C, 0xD1, 0x5C, 0xF1, 0xBF, 0x34, 0x7A, 0x92,
+    0xDF, 0x77, 0x06, 0x65, 0xB3, 0x61, 0xF9, 0x77, 0x90, 0xEC, 0x72, 0xFD, 0x9C, 0x34, 0xEB, 0x0F,
+    0x5A, 0x2F, 0x5C, 0x78, 0xBF, 0x9B, 0xE7, 0x57, 0x53, 0x7E, 0x76, 0x37, 0xFD, 0x56, 0x4E, 0xCB,
+    0xE2, 0xAE, 0x21, 0x28, 0x6C, 0xE3, 0x6B, 0xDC, 0xA6, 0x30, 0xE1, 0x8F, 0xD0, 0x3A, 0x8E, 0x78,
+    0x81, 0x39, 0x6F, 0x5B, 0xB7, 0xFB, 0x41, 0xDB, 0x71, 0xB8, 0x3F, 0x2E, 0xEB, 0x9E, 0xAA, 0x68,
+    0xB1, 0xF8, 0x45, 0xA0, 0x3F, 0x00, 0xE3, 0x0B, 0xA8, 0x00, 0xB9, 0x50, 0x62, 0x04, 0x89, 0xCA,
+    0x73, 0x68, 0x14, 0x66, 0xA1, 0x2E, 0xB6, 0xA1, 0xD9, 0x6A, 0x1E, 0x6B, 0x47, 0x4F, 0x30, 0x5E,
+    0xBB, 0xBF, 0x89, 0x81, 0x6B, 0x8D, 0xD5, 0x7A, 0x4A, 0x97, 0x5D, 0xB1, 0x0C, 0xCD, 0x9E, 0x8A,
+    0x30, 0xCE, 0xBE, 0x43, 0x8C, 0x1B, 0x69, 0xF5, 0x91, 0xE5, 0xD8, 0x89, 0x41, 0x7A, 0x90, 0xD0,
+    0x67, 0x00, 0x8F, 0xC0, 0xA8, 0x98, 0x75, 0xC4, 0xC4, 0x27, 0x81, 0x54, 0xEB, 0x6B, 0x10, 0x3B,
+    0x15, 0x0B, 0x67, 0xA3, 0x28, 0x16, 0xD5, 0x81, 0xEA, 0x8B, 0x9C, 0x85, 0x04, 0x45, 0xC1, 0xB5,
+    0xB5, 0x42, 0x3F, 0x45, 0x6F, 0x65, 0xF0, 0x53, 0x4A, 0x1E, 0x37, 0x3C, 0xC3, 0xFF, 0x10, 0x0E,
+    0x4E, 0xD7, 0x19, 0x8D, 0x17, 0x10, 0xC9, 0x52, 0x9E, 0x04, 0x1E, 0x4F, 0x74, 0x99, 0xB6, 0x3E,
+    0xE8, 0xC5, 0x7A, 0xC2, 0x81, 0x6B, 0x5F, 0x34, 0xBE, 0xD4, 0xF6, 0x62, 0x30, 0xE0, 0x62, 0x6B,
+    0x9A, 0xDE, 0x65, 0xED, 0x15, 0x30, 0x99, 0xAC, 0x73, 0x98, 0xFB, 0xE0, 0xC7, 0x89, 0x94, 0x8D,
+    0x69, 0x5B, 0x62, 0x50, 0x52, 0x70, 0x1A, 0x38, 0x89, 0x75, 0xA8, 0x1A, 0xCA, 0xEC, 0x1A, 0x8E,
+    0x77, 0x2E, 0xC8, 0x3B, 0x0E, 0x89, 0x02, 0x29, 0x92, 0x0A, 0x9D, 0x53, 0x44, 0x3B, 0x45, 0x59,
+    0x14, 0xF3, 0xC3, 0x4F, 0xA4, 0x69, 0x83, 0x5B, 0x07, 0x29, 0x69, 0x0A, 0x58, 0xB8, 0x0C, 0xEF,
+    0xB8, 0x77, 0x7C, 0x73, 0x70, 0x05, 0xD0, 0x39, 0x3E, 0x96, 0x78, 0x70, 0x86, 0x3F, 0x09, 0xEF,
+    0x1C, 0xC2, 0xC7, 0xB8, 0x57, 0x29, 0x8E, 0xAA, 0x9C, 0x35, 0xB1, 0xEE, 0x82, 0xAD, 0x71, 0x20,
+    0x7C, 0x6A, 0x5A, 0x9F, 0x50, 0x45, 0x6D, 0x65, 0x85, 0x7E, 0xD5, 0xDD, 0x50, 0xE4, 0xC4, 0xEA,
+    0x48, 0x27, 0x4B, 0x79, 0xAF, 0x65, 0x76, 0x63, 0x1B, 0x16, 0x4D, 0x8B, 0x5C, 0x39, 0x04, 0x66,
+    0xDB, 0x7F, 0x65, 0x41, 0x30, 0x01, 0x2E, 0xA2, 0xB7, 0x79, 0x8C, 0x0A, 0x43, 0xB5, 0x7E, 0x3A,
+    0x9E, 0x56, 0x69, 0x38, 0x0C, 0x7D, 0xD9, 0x9D, 0x20, 0xFD, 0x64, 0xDE, 0x84, 0x31, 0x5B, 0x21,
+    0xA0, 0xAA, 0x25, 0x31, 0x6C, 0x91, 0x7C, 0x49, 0x08, 0x0A, 0xCB, 0x0B, 0xFB, 0xAF, 0x80, 0x26,
+    0x31, 0xF7, 0xF6, 0x9F, 0x65, 0x02, 0x9D, 0xB8, 0xDC, 0x1E, 0xFE, 0x08, 0x91, 0x4A, 0xB1, 0x5B,
+    0xB8, 0xBF, 0x4A, 0x5B, 0x50, 0x10, 0xDC, 0x02, 0xEB, 0x33, 0x7A, 0xCD, 0x44, 0xB5, 0xDD, 0xA7,
+    0x7A, 0x22, 0x7B, 0xC0, 0x3C, 0xC1, 0xC2, 0xD7, 0xF2, 0xE6, 0x69, 0x7B, 0x05, 0x5F, 0x25, 0x60,
+    0x28, 0xD3, 0x67, 0xDD, 0x2B, 0x60, 0xF1, 0xDE, 0x54, 0xAA, 0x34, 0x58, 0x17, 0x85, 0x78, 0x37,
+    0xA8, 0x09, 0xB9, 0x8A, 0x67, 0x77, 0x9C, 0x96, 0x1A, 0xA3, 0x31, 0xFC, 0x60, 0x8B, 0x9A, 0xB3,
+    0xC2, 0x4B, 0x8A, 0x13, 0x67, 0x3A, 0xF0, 0x57, 0xEF, 0xDF, 0xC5, 0xA3, 0x6B, 0xA2, 0x68, 0x8F,
+    0x27, 0xCF, 0x42, 0x59, 0xA8, 0xA8, 0xA8, 0x41, 0x1C, 0x9F, 0xC2, 0x10, 0xF3, 0xEB, 0x2A, 0xAE,
+    0x3F, 0x02, 0x22, 0x1C, 0x46, 0xBE, 0x25, 0x4B, 0x40, 0xE9, 0xEC, 0xF7, 0xF2, 0x48, 0x19, 0x53,
+    0xFB, 0xD1, 0x5B, 0x38, 0x4C, 0x95, 0x58, 0x58, 0xB0, 0x7A, 0x79, 0x01, 0x3D, 0xB3, 0x30, 0x93,
+    0x63, 0xC0, 0x82, 0x61, 0xCE, 0x25, 0xA8, 0xBB, 0x92, 0x16, 0x7F, 0xB9, 0x58, 0xF1, 0x21, 0x4E,
+    0x5C, 0x4D, 0xDF, 0x39, 0xF9, 0x3E, 0xC1, 0x05, 0xC2, 0x45, 0xE3, 0xB7, 0xA2, 0x2A, 0x54, 0x30,
+    0x4B, 0x35, 0x36, 0xF8, 0x96, 0x7E, 0x11, 0x1F, 0x0A, 0xA0, 0x03, 0x3C, 0x8B, 0x14, 0xE3, 0x2B,
+    0xA2, 0xFC, 0x3D, 0x3B, 0x9B, 0xE4, 0xD9, 0xD8, 0x7E, 0x1C, 0xDB, 0x93, 0xA6, 0x7F, 0xAE, 0xDC,
+    0xC8, 0x1A, 0x0E, 0x09, 0x5E, 0x63, 0xBB, 0x28, 0x99, 0x9C, 0x30, 0xDB, 0x50, 0x53, 0xA0, 0xC5,
+    0x26, 0x00, 0x3F, 0xDE, 0x56, 0x48, 0x38, 0x19, 0x1A, 0x83, 0x20, 0xD5, 0x54, 0xDF, 0x10, 0xD3,
+    0xC4, 0x96, 0x41, 0xE9, 0x4A, 0x39, 0xF5, 0x70, 0xF6, 0x1B, 0xF3, 0x56, 0xB5, 0xFA, 0x41, 0xBC,
+    0x59, 0x11, 0x95, 0x7B, 0x59, 0xBE, 0x59, 0xAF, 0x4D, 0x15, 0x3A, 0x4D, 0x04, 0x3B, 0x28, 0x96,
+    0xF5, 0x4E, 0x49, 0xE9, 0xD5, 0x7D, 0x23, 0xD7, 0x24, 0xAC, 0xBC, 0x74, 0x9B, 0x00, 0x7D, 0xEB,
+    0x79, 0x0B, 0x6A, 0x0C, 0x2E, 0xDC, 0x96, 0x8D, 0x11, 0x6E, 0x0E, 0xE3, 0xCA, 0xE3, 0x31, 0xB1,
+    0xFF, 0xD3, 0x71, 0x3E, 0x93, 0xB4, 0x79, 0xF0, 0xA5, 0xD4, 0x1C, 0xE3, 0xBF, 0x64, 0xCB, 0xF6,
+    0xA7, 0x33, 0x8C, 0xF3, 0x70, 0x57, 0x69, 0xB3, 0x89, 0xCB, 0x05, 0x76, 0xB0, 0x2D, 0x92, 0xE1,
+    0xEC, 0xF7, 0x4A, 0xF4, 0x9D, 0x6B, 0xE8, 0xA6, 0x7A, 0x3C, 0xEA, 0x68, 0xF1, 0xCC, 0x33, 0x6B,
+    0x3C, 0x52, 0xCE, 0xCE, 0x86, 0xA3, 0xD4, 0x65, 0x30, 0xB9, 0x77, 0x96, 0x63, 0x9E, 0x92, 0xF9,
+    0xD7, 0x0B, 0x4E, 0x04, 0x5C, 0x9F, 0x41, 0xD4, 0xF3, 0x9D, 0x28, 0xB7, 0xFB, 0x08, 0x77, 0x2C,
+    0x45, 0x55, 0x6A, 0x74, 0xB3, 0x5F, 0x40, 0xA0, 0xBB, 0xB2, 0x38, 0x08, 0xA5, 0x41, 0xDD, 0x97,
+    0xEC, 0x94, 0x1C, 0x08, 0x59, 0xC2, 0x91, 0x9A, 0xAA, 0x9C, 0x9B, 0x40, 0x90, 0xB2, 0xCB, 0xFE,
+    0xA3, 0x91, 0x23, 0x4A, 0x86, 0x24, 0x81, 0xE8, 0x58, 0xAC, 0x89, 0xF1, 0x06, 0x7E, 0x04, 0xA0,
+    0x17, 0xF8, 0xE0, 0xB8, 0x16, 0xA0, 0xA2, 0x8C, 0x86, 0x5C, 0x4E, 0xC2, 0x8E, 0x4F, 0xDC, 0x9F,
+    0x43, 0x98, 0xF1, 0xBC, 0xCA, 0x39, 0xD1, 0x27, 0x0C, 0xA9, 0x63, 0x6D, 0x31, 0x55, 0xD6, 0x75,
+    0x57, 0x45, 0x29, 0x2F, 0x9E, 0x5E, 0x80, 0xFC, 0x5C, 0xA0, 0x10, 0x1F, 0x9E, 0x4C, 0xC6, 0xEB,
+    0xE3, 0x9A, 0xD9, 0x2E, 0xF2, 0x50, 0xD5, 0x5C, 0xAD, 0xC2, 0x99, 0xE0, 0xC1, 0xD8, 0x60, 0x38,
+    0x46, 0x98, 0x3D, 0xF2, 0xC0, 0x1C, 0xDD, 0x27, 0xE7, 0x4C, 0xCE, 0x36, 0xCD, 0x7C, 0x94, 0xE3,
+    0xB5, 0xFC, 0xAB, 0x54, 0x26, 0xD5, 0x78, 0x08, 0x66, 0xD8, 0x49, 0xAF, 0x2A, 0x97, 0xBB, 0x01,
+    0x31, 0xF8, 0x06, 0x8A, 0xBE, 0x73, 0x6E, 0xEE, 0x94, 0xE3, 0x8D, 0x9C, 0x1D, 0x9D, 0x67, 0x99,
+    0x30, 0x8A, 0x40, 0x04, 0x2D, 0x11, 0x31, 0x8B, 0x00, 0x0E, 0xD8, 0xD5, 0xF0, 0xDD, 0x48, 0xA3,
+    0xB8, 0x98, 0xD5, 0x61, 0xC8, 0xC6, 0xC0, 0xC5, 0x7D, 0x8B, 0x33, 0x3F, 0x1F, 0xBD, 0x0A, 0xC7,
+    0xB3, 0xED, 0xA5, 0x0F, 0xE8, 0x2A, 0x2B, 0x5B, 0xFD, 0xF3, 0x65, 0x9E, 0x2B, 0xD4, 0x51, 0x97,
+    0x66, 0x6A, 0x0F, 0x27, 0x65, 0xC0, 0xB6, 0xA7, 0xA2, 0x4A, 0xA5, 0xB9, 0x4D, 0x31, 0x58, 0xE7,
+    0x16, 0xC5, 0xFD, 0x16, 0xC3, 0x92, 0x70, 0x7C, 0xA4, 0xDA, 0xA6, 0x8B, 0xE4, 0xCF, 0xAF, 0x3C,
+    0x7B, 0x1B, 0x8D, 0x8F, 0x30, 0xEB, 0x9F, 0x90, 0x5D, 0xFD, 0x38, 0xEE, 0x5F, 0x6D, 0x7F, 0x08,
+    0xD2, 0xF0, 0x1D, 0x74, 0xB6, 0xCE, 0x0B, 0x21, 0x81, 0xAE, 0x48, 0x8A, 0xF1, 0x55, 0x39, 0x59,
+    0xBC, 0xC5, 0x98, 0xA0, 0x5F, 0x48, 0xF9, 0xF2, 0x38, 0xFC, 0xA6, 0x0F, 0xCA, 0x1F, 0x51, 0xA0,
+    0x33, 0x22, 0xD6, 0x2A, 0x96, 0xF0, 0xE5, 0x5E, 0xC7, 0x14, 0x72, 0x06, 0x89, 0x9F, 0x6A, 0x5D,
+    0xA6, 0xD3, 0xE9, 0x65, 0x38, 0xAE, 0x29, 0xCA, 0x61, 0x91, 0x47, 0x4B, 0x45, 0x7B, 0x43, 0x86,
+    0x4F, 0xBD, 0x26, 0x9A, 0x79, 0xDA, 0xF5, 0x86, 0xC8, 0xA7, 0x6E, 0xFB, 0xFC, 0xB8, 0xAC, 0x99,
+    0xA4, 0x6E, 0xCE, 0x7B, 0x94, 0x90, 0x34, 0x53, 0xF0, 0x2E, 0x30, 0xF5, 0x25, 0x4B, 0x8A, 0xE1,
+    0xC1, 0x75, 0x31, 0xD9, 0x08, 0x27, 0xDF, 0xFE, 0x84, 0x3F, 0x11, 0x1F, 0xFF, 0xA8, 0xDD, 0x81,
+    0xA7, 0x23, 0x3C, 0x87, 0xD8, 0x65, 0xF3, 0x3B, 0xC0, 0xCC, 0x62, 0xE3, 0x9D, 0xE7, 0xF0, 0xF1,
+    0x6E, 0xD8, 0xAB, 0xA6, 0xF2, 0x0E, 0x40, 0x6D, 0xE2, 0xDC, 0x2B, 0xF9, 0x8F, 0x38, 0xD4, 0x78,
+    0xC6, 0xBB, 0x61, 0x37, 0xA3, 0x27, 0xE9, 0x38, 0x3A, 0x2B, 0x6E, 0x02, 0x3C, 0x39, 0x7D, 0x58,
+    0xEF, 0xED, 0x5D, 0x08, 0xE6, 0xDD, 0xB6, 0xBC, 0x66, 0x8C, 0x95, 0x1C, 0x07, 0xDD, 0x7D, 0xE2,
+    0xA6, 0x86, 0xA2, 0x56, 0x8F, 0x6F, 0x2F, 0xD3, 0xE0, 0x58, 0x6F, 0x42, 0x9A, 0x53, 0x66, 0x90,
+    0x90, 0x0C, 0x20, 0x26, 0xE4, 0xE7, 0x0A, 0x14, 0x71, 0xD1, 0xBB, 0x74, 0xB9, 0xEB, 0xBF, 0x97,
+    0x53, 0xCD, 0xA8, 0x98, 0x9C, 0x09, 0xC6, 0x20, 0xBE, 0x38, 0x1E, 0xD4, 0xEE, 0xF0, 0x2B, 0x8D,
+    0xEE, 0xDE, 0xC7, 0x7B, 0x8A, 0x3A, 0x87, 0xDF, 0x5C, 0xDB, 0xDF, 0x62, 0xCD, 0xDA, 0x9A, 0x25,
+    0xF3, 0x69, 0x8D, 0x28, 0x5E, 0x0C, 0xF3, 0x6E, 0xB9, 0xFB, 0x9B, 0xF7, 0x43, 0x1E, 0xF7, 0x6D,
+    0xB6, 0xD3, 0x9C, 0xF4, 0xA0, 0x56, 0xA2, 0x05, 0x55, 0x75, 0x56, 0x40, 0x35, 0xAB, 0x9B, 0xAF,
+    0xCC, 0xEB, 0x97, 0xB2, 0xC3, 0x3F, 0xDF, 0xE1, 0xC5, 0x7C, 0xBF, 0x4E, 0x3F, 0x46, 0x4B, 0xD9,
+    0x27, 0x4C, 0x31, 0x3E, 0x22, 0x05, 0xF1, 0x55, 0xE7, 0x86, 0xD7, 0x75, 0x69, 0xA6, 0x5D, 0x1D,
+    0x2F, 0x4A, 0xA4, 0x3B, 0x69, 0x78, 0x1C, 0x6D, 0x1A, 0xA4, 0x19, 0x55, 0x6C, 0xCF, 0x8A, 0x3A,
+    0x46, 0x4C, 0xFC, 0x27, 0x1A, 0x58, 0x7B, 0x47, 0x11, 0xBB, 0xF3, 0x91, 0x4B, 0xC1, 0xB3, 0x9A,
+    0xBB, 0x70, 0x4F, 0xE2, 0x0A, 0x13, 0x04, 0x72, 0x2E, 0x51, 0x7D, 0x32, 0x51, 0x92, 0xDC, 0xA4,
+    0xE3, 0x09, 0x05, 0x65, 0xA7, 0xC8, 0x74, 0x77, 0xAC, 0xCC, 0xE6, 0xC6, 0xA9, 0xA8, 0x7F, 0x52,
+    0xF1, 0x60, 0x33, 0x88, 0x07, 0x7D, 0xC4, 0x5D, 0x24, 0x3D, 0x93, 0x80, 0x75, 0x1D, 0x45, 0xA5,
+    0x1F, 0x9C, 0x1C, 0x45, 0x02, 0x6F, 0x32, 0x88, 0x68, 0xF8, 0x3D, 0xB2, 0x1A, 0xEF, 0x64, 0xD9,
+    0x5E, 0xF3, 0x9C, 0x4E, 0xC9, 0x79, 0x1F, 0x1D, 0x23, 0xCA, 0xC2, 0x7F, 0x36, 0xD9, 0x40, 0x98,
+    0x14, 0x1B, 0x47, 0x01, 0xB5, 0x30, 0x7C, 0xF6, 0x59, 0x87, 0xC2, 0x4C, 0x67, 0x5A, 0x58, 0x43,
+    0xA4, 0xF5, 0xE9, 0x8B, 0x84, 0x79, 0xC9, 0xCD, 0x95, 0x0E, 0x99, 0x3B, 0x62, 0x4E, 0x1F, 0x11,
+    0x4A, 0x8F, 0x9D, 0x1D, 0x80, 0xFB, 0x60, 0x5D, 0x81, 0x7E, 0x92, 0x61, 0x6E, 0x33, 0x52, 0x11,
+    0xA8, 0xF6, 0x41, 0x02, 0xCD, 0xAA, 0x13, 0x6B, 0x1C, 0xF8, 0x2B, 0xCF, 0xD4, 0xCF, 0x57, 0x36,
+    0x60, 0xC3, 0x95, 0xD3, 0x96, 0x6A, 0xE5, 0x7F, 0xC1, 0xF2, 0x48, 0x52, 0xDE, 0xB2, 0x83, 0xE7,
+    0xCA, 0x30, 0xCC, 0xB2, 0xC9, 0xFA, 0x58, 0xA1, 0xFA, 0xE0, 0x89, 0x27, 0x89, 0xEA, 0x5A, 0x3A,
+    0x5B, 0x01, 0x1D, 0x44, 0x1B, 0xCD, 0x41, 0xF5, 0xFC, 0xE6, 0xA2, 0xFC, 0xC3, 0x3F, 0xDA, 0x6F,
+    0x9B, 0x47, 0x97, 0xF1, 0x58, 0x96, 0x0A, 0xC8, 0x5C, 0x76, 0x40, 0x79, 0x46, 0xA6, 0x09, 0xD0,
+    0xA1, 0xC9, 0xA5, 0x91, 0x3E, 0x73, 0xD1, 0xCB, 0x83, 0x6B, 0x49, 0x12, 0xF1, 0xC3, 0xCC, 0xD0,
+    0x9F, 0x6D, 0xD8, 0x81, 0x67, 0xF3, 0x5A, 0x49, 0x8C, 0xFE, 0xC0, 0xAC, 0x14, 0x85, 0x1E, 0x18,
+    0x56, 0xFD, 0xD4, 0x4C, 0x33, 0x64, 0x0C, 0x70, 0xD0, 0x37, 0x6F, 0xB8, 0x5A, 0xF9, 0x0A, 0x24,
+    0x9E, 0x1C, 0x3D, 0x37, 0x10, 0xB3, 0x20, 0xEC, 0xDA, 0x57, 0xCA, 0xC1, 0xFE, 0xC8, 0x77, 0x4D,
+    0x59, 0xE3, 0x00, 0x9D, 0x7D, 0x67, 0x5F, 0xD9, 0xC3, 0x7E, 0xEC, 0x1E, 0x65, 0x70, 0x10, 0xCB,
+    0xA2, 0xC4, 0x6F, 0xF0, 0xEC, 0x08, 0x29, 0x4C, 0xCA, 0x6E, 0x5F, 0x36, 0x3E, 0xE2, 0x90, 0x42,
+    0x7D, 0x78, 0x42, 0xA6, 0xF3, 0x5C, 0xD2, 0x50, 0x16, 0x05, 0xA2, 0xAD, 0xB2, 0x1C, 0xA7, 0x9D,
+    0xFD, 0xF9, 0xA3, 0x4C, 0xCC, 0xEA, 0xA9, 0xE6, 0x22, 0x95, 0x8D, 0x37, 0xF2, 0x71, 0x06, 0xD9,
+    0xA0, 0xC7, 0xF4, 0xD2, 0x9C, 0xD5, 0x78, 0x54, 0xE9, 0x76, 0xFD, 0x86, 0xBA, 0xB1, 0xC0, 0x25,
+    0x26, 0xD8, 0x9F, 0x12, 0x4B, 0xAF, 0x7F, 0xF5, 0xB9, 0xB0, 0xD5, 0x5B, 0x96, 0xD5, 0xF9, 0x6C,
+    0x53, 0x46, 0xC0, 0x1D, 0xF3, 0xEE, 0x0A, 0x56, 0x25, 0x2E, 0x8C, 0x94, 0x1F, 0x5F, 0xC0, 0xBD,
+    0x89, 0x3D, 0xF6, 0x0A, 0x29, 0x84, 0xA6, 0x05, 0x74, 0x0F, 0x84, 0x5B, 0xA5, 0x9C, 0x4E, 0x86,
+    0x38, 0x29, 0x3E, 0x25, 0xC2, 0xD6, 0x34, 0xB4, 0xD4, 0x00, 0xA9, 0x26, 0x7D, 0x51, 0x75, 0xD2,
+    0xFF, 0x3C, 0x0A, 0xD7, 0x67, 0x3F, 0xEC, 0x60, 0x5B, 0xFB, 0x04, 0xBD, 0xFA, 0x7A, 0x14, 0x0E,
+    0x77, 0x45, 0xD4, 0xAA, 0x9C, 0x3E, 0xBD, 0x74, 0x17, 0x62, 0x0D, 0xEA, 0x98, 0xC6, 0xF4, 0x59,
+    0x80, 0xCD, 0x84, 0x93, 0x35, 0xC8, 0x3B, 0xA0, 0x9C, 0x7A, 0xF6, 0x6D, 0x20, 0x8D, 0x70, 0x76,
+    0x33, 0xEC, 0x34, 0x6E, 0xAB, 0x04, 0x0A, 0xD4, 0x2A, 0x57, 0x9E, 0x8B, 0xC1, 0xB7, 0xA5, 0xA1,
+    0xDC, 0x74, 0x00, 0x7F, 0x4B, 0x4F, 0x58, 0xBE, 0x70, 0x98, 0xE6, 0x56, 0xCE, 0xE5, 0xAB, 0xF8,
+    0x83, 0xBF, 0x40, 0xF8, 0xDC, 0x34, 0x47, 0xC6, 0x48, 0xED, 0x3A, 0x13, 0x97, 0xE9, 0xFC, 0xA1,
+    0xF2, 0x3D, 0xD2, 0x4B, 0x08, 0x87, 0x99, 0xFB, 0xA4, 0x98, 0x1D, 0xB5, 0x2C, 0x38, 0xF4, 0x26,
+    0xB3, 0x74, 0x67, 0x32, 0xB2, 0x89, 0x00, 0xA2, 0x34, 0xCC, 0x8D, 0x5D, 0x11, 0x16, 0xAA, 0x44,
+    0xFE, 0xF7, 0x00, 0x34, 0xF2, 0x01, 0x7F, 0x82, 0x9E, 0xCF, 0x9B, 0xFD, 0x77, 0xCF, 0x6D, 0x8C,
+    0x15, 0x80, 0xAC, 0x4B, 0xD3, 0x12, 0x68, 0xAE, 0x4F, 0x6B, 0x56, 0x60, 0x25, 0xB7, 0x19, 0x6F,
+    0x6A, 0x10, 0xF9, 0x2A, 0xC0, 0x41, 0x40, 0x46, 0xE0, 0x39, 0x71, 0x21, 0x6B, 0x96, 0xB0, 0x05,
+    0xFE, 0xCA, 0xDE, 0x9F, 0x5C, 0xA0, 0x16, 0x9C, 0x86, 0xCA, 0x50, 0xC8, 0x54, 0xCB, 0x85, 0x6C,
+    0xCB, 0xEC, 0x4D, 0x8F, 0x81, 0x4B, 0x6E, 0xD7, 0xC2, 0xF7, 0x40, 0x7D, 0xA1, 0xCD, 0xE6, 0xA5,
+    0xB8, 0xB3, 0x78, 0xD6, 0xC8, 0x54, 0x37, 0xDF, 0x40, 0x12, 0xD7, 0x7C, 0x51, 0x06, 0x20, 0x66,
+    0xE1, 0xF9, 0xAD, 0x0B, 0xD0, 0x48, 0x91, 0x7E, 0xED, 0x38, 0x20, 0xE1, 0x28, 0x24, 0x21, 0x91,
+    0xD8, 0xBE, 0xC6, 0xD9, 0x26, 0xF8, 0x03, 0x39, 0x2C, 0xC0, 0x27, 0xFF, 0x19, 0x69, 0x5C, 0x1D,
+    0x54, 0xCD, 0xDF, 0xBE, 0x4B, 0x55, 0xD6, 0xBA, 0x86, 0x63, 0x10, 0xE4, 0x0B, 0x6C, 0x76, 0x10,
+    0x2D, 0x91, 0xF2, 0xC3, 0xC5, 0x93, 0x68, 0x55, 0xAA, 0x39, 0x42, 0x4C, 0xEC, 0x5E, 0x0C, 0xDE,
+    0xF2, 0xF0, 0x2E, 0x3B, 0xB0, 0x08, 0x8D, 0x2A, 0x3F, 0xD0, 0x30, 0xAC, 0xFC, 0x91, 0xDA, 0x14,
+    0xA3, 0x9F, 0x93, 0x19, 0xED, 0x49, 0x92, 0x3A, 0xF2, 0x89, 0x9B, 0xFA, 0xF1, 0x19, 0x20, 0xBC,
+    0x42, 0x84, 0x2F, 0x1C, 0x67, 0x7F, 0x60, 0xFD, 0x75, 0xB6, 0xC6, 0x24, 0x9E, 0x98, 0x15, 0xEA,
+    0xE2, 0xA7, 0xE9, 0x85, 0x89, 0xE1, 0xA5, 0x2B, 0x32, 0x01, 0xBD, 0x08, 0xA2, 0x0C, 0xC1, 0x66,
+    0x84, 0x5D, 0x2F, 0xE0, 0x4C, 0x58, 0x9E, 0x2A, 0xF9, 0x10, 0x6B, 0xF0, 0xD6, 0x6B, 0xC0, 0xB6,
+    0xF0, 0x8C, 0xEC, 0xB5, 0x7F, 0x1D, 0x05, 0xEA, 0x80, 0x95, 0x89, 0x36, 0x49, 0xD3, 0xF2, 0x78,
+    0xAA, 0x32, 0x61, 0x2D, 0x56, 0xF9, 0xC7, 0x2D, 0x89, 0x7D, 0x7D, 0xC4, 0x1C, 0x91, 0x33, 0x20,
+    0x10, 0x62, 0xF1, 0xD3, 0xE7, 0x4D, 0xB7, 0xB2, 0x5E, 0xB2, 0xCE, 0x04, 0x0D, 0x08, 0xF0, 0x8D,
+    0xA2, 0xE4, 0x1A, 0xD3, 0x3C, 0x1B, 0xB8, 0xDD, 0x88, 0x2A, 0x0A, 0x76, 0xBD, 0x99, 0x22, 0x8D,
+    0xFC, 0x95, 0xE7, 0x11, 0xFE, 0x6A, 0x67, 0x28, 0x90, 0x92, 0x2C, 0xEF, 0x12, 0xC3, 0xC7, 0x6D,
+    0x71, 0xCA, 0x0C, 0x0D, 0xDF, 0x66, 0xC2, 0x70, 0x7E, 0x7D, 0x72, 0xD0, 0xC8, 0xD7, 0x55, 0x6E,
+    0xD5, 0xD6, 0x08, 0x2B, 0x8B, 0xB8, 0x10, 0x48, 0xEE, 0x3F, 0x97, 0x5F, 0x88, 0xB8, 0x10, 0x32,
+    0xCC, 0xB1, 0x81, 0xDA, 0xDD, 0x4D, 0xC0, 0x32, 0x2F, 0xC5, 0x96, 0xD0, 0x22, 0x4D, 0x1A, 0x52,
+    0xC7, 0xA6, 0x8F, 0x7B, 0xA8, 0xD6, 0xB0, 0x67, 0x53, 0x60, 0x56, 0xC7, 0xD0, 0xC2, 0x2B, 0x82,
+    0x4B, 0xF0, 0x43, 0x00, 0x48, 0x35, 0xC1, 0x20, 0xB6, 0xE8, 0x9D, 0x2E, 0x83, 0x37, 0x18, 0x02,
+    0x8A, 0x93, 0x2F, 0x67, 0x8F, 0xFB, 0xAD, 0x1C, 0x52, 0x80, 0x07, 0xAE, 0xF4, 0x75, 0x5F, 0xB4,
+    0x49, 0x55, 0x2C, 0x62, 0xAB, 0xD8, 0x32, 0xCE, 0x17, 0x12, 0x2D, 0xD5, 0xCF, 0x62, 0xC3, 0x66,
+    0x33, 0xDD, 0x14, 0xA5, 0xB5, 0xFC, 0xAB, 0x22, 0x43, 0x41, 0xBA, 0xEF, 0xD8, 0x41, 0x5B, 0x93,
+    0x35, 0xD6, 0x49, 0x7D, 0x07, 0xB7, 0x68, 0xC8, 0xEA, 0xF8, 0x1C, 0xB4, 0xF1, 0xBD, 0x23, 0x1A,
+    0xA1, 0x9D, 0x37, 0xC6, 0x18, 0x9E, 0xD6, 0x24, 0x66, 0xDC, 0x7E, 0xB8, 0x25, 0xF4, 0xC5, 0x19,
+    0xC8, 0x6C, 0x9F, 0x8E, 0xA0, 0x36, 0xF1, 0x79, 0xAF, 0x86, 0x70, 0xCA, 0x7C, 0xB1, 0xAA, 0x7A,
+    0x2A, 0x17, 0xD3, 0x3D, 0x14, 0x4B, 0xCF, 0x95, 0x17, 0x6D, 0x1F, 0x8F, 0x52, 0x1B, 0x8C, 0x15,
+    0xEE, 0x92, 0xB6, 0x86, 0x9B, 0xEE, 0x34, 0xFD, 0x8C, 0x19, 0xF6, 0x8F, 0xC0, 0x29, 0x2A, 0x9F,
+    0xFF, 0x49, 0x4A, 0xE0, 0xFE, 0xBB, 0xC7, 0x38, 0x7F, 0xBE, 0x34, 0xC3, 0x2A, 0xD1, 0xF7, 0x2C,
+    0xE9, 0x9B, 0x48, 0x63, 0x13, 0x99, 0xF0, 0xF0, 0x1C, 0x1B, 0x89, 0xF7, 0x52, 0xAF, 0xBF, 0x87,
+    0xA7, 0xB2, 0xDB, 0x00, 0x79, 0x54, 0xB1, 0x8E, 0x9E, 0x65, 0x28, 0x66, 0xC9, 0x22, 0x43, 0x08,
+    0xA8, 0x2D, 0xF0, 0xD1, 0x30, 0x29, 0x53, 0xCF, 0x34, 0x08, 0xD5, 0x51, 0x43, 0xB1, 0x47, 0x16,
+    0xD7, 0x55, 0xE1, 0xDE, 0x19, 0xAC, 0xE5, 0xB0, 0x44, 0x7B, 0x4F, 0x8A, 0x3D, 0xB7, 0x23, 0xF6,
+    0xF2, 0x98, 0x94, 0x38, 0xF0, 0xD6, 0x27, 0xB0, 0xC7, 0x3C, 0x90, 0x56, 0x8D, 0xFD, 0x3E, 0x88,
+    0x0A, 0x56, 0x6E, 0x3F, 0x51, 0xAE, 0xB4, 0xB5, 0xC9, 0xD5, 0xF8, 0x07, 0x2B, 0x91, 0x9B, 0xAB,
+    0xD5, 0xFE, 0x34, 0x6C, 0x72, 0x75, 0x9D, 0xE8, 0x3E, 0x4B, 0x6C, 0x96, 0xFA, 0x6D, 0x9A, 0xFD,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0B, 0x12, 0x18, 0x1D, 0x20
+};
+
+#endif /* MLDSA_TESTVECTORS_H_ */
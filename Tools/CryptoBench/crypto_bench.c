@@ -0,0 +1,690 @@
+/**********************************************************************************************************************
+ * \file crypto_bench.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Linux host benchmark of the crypto modules, built from the same sources as the target
+ *
+ * Build:  gcc -O2 -I. -I../.. -o crypto_bench crypto_bench.c ../../Keccak.c ../../MlKem.c ../../X25519.c \
+ *             ../../HybridKem.c ../../MlDsa.c ../../P256.c ../../Sha256.c ../../Sha512.c ../../Aes.c ../../AesGcm.c \
+ *             ../../ChaChaPoly.c ../../Fe25519.c ../../Ed25519.c ../../CtrDrbg.c
+ * Usage:  crypto_bench [runs]
+ *
+ * Every operation is also checked for consistency, e.g. both sides of a key exchange must derive the same
+ * secret. Cycles are read from the time stamp counter on x86 and are nanoseconds elsewhere; compare with the
+ * CPU cycles of Example20_KeyExchangeBenchmark() and Example21_SignatureBenchmark() on the TC375. The ML-DSA known
+ * answers in MlDsa_TestVectors.h are generated by Tools/mldsa_vectors.c.
+ *
+ * Flash4_ReadBuffer() reads from a RAM image here. The ML-DSA timing uses a random public key and a signature
+ * with in-range z and no hints, which takes the full verification path and is only rejected by the final
+ * challenge comparison.
+ *********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "Flash4_Driver.h"
+#include "AesGcm.h"
+#include "ChaChaPoly.h"
+#include "CtrDrbg.h"
+#include "Ed25519.h"
+#include "HybridKem.h"
+#include "Keccak.h"
+#include "MlDsa.h"
+#include "MlDsa_TestVectors.h"
+#include "P256.h"
+#include "Sha256.h"
+#include "Sha512.h"
+#include "X25519.h"
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static uint8 g_flash[MLDSA65_PUBLIC_KEY_SIZE + MLDSA65_SIGNATURE_SIZE];
+
+/* Key pair generated with OpenSSL, signature over SHA-256("sample") */
+static const uint8 g_p256PublicKey[P256_PUBLIC_KEY_SIZE] = {
+    0x36, 0xDB, 0xC2, 0x2A, 0x17, 0x2F, 0xFA, 0x61, 0x4A, 0x4F, 0xFE, 0x39, 0x1D, 0xDF, 0xDD, 0xC9,
+    0x03, 0x0D, 0x7D, 0x51, 0x82, 0x9E, 0xD6, 0xF0, 0xE3, 0x90, 0xC9, 0x4E, 0x08, 0x25, 0x0D, 0x19,
+    0x90, 0xB5, 0xFA, 0x28, 0x44, 0x88, 0x26, 0x1C, 0xFE, 0x11, 0x1A, 0xE0, 0xF6, 0x70, 0x7F, 0x41,
+    0x6D, 0xAD, 0x4A, 0xB3, 0x04, 0xBC, 0x62, 0xFC, 0xFF, 0xBC, 0x13, 0xAD, 0x52, 0x25, 0x1D, 0x84
+};
+static const uint8 g_p256Signature[P256_SIGNATURE_SIZE] = {
+    0xC3, 0x4F, 0xD0, 0x14, 0x0F, 0x56, 0xBF, 0x86, 0xC1, 0xF1, 0xE0, 0xCA, 0xF7, 0xD9, 0x62, 0x4B,
+    0x3D, 0xE9, 0xEA, 0x55, 0x6C, 0xA5, 0x6A, 0x62, 0xEA, 0x14, 0xC0, 0x3F, 0x1F, 0x74, 0x9D, 0xC7,
+    0xE5, 0xC0, 0x40, 0xEC, 0x39, 0x42, 0xB3, 0xE1, 0xC1, 0x55, 0x4B, 0xBB, 0x24, 0x56, 0xFD, 0xCB,
+    0xBC, 0xE0, 0x08, 0xFE, 0x3F, 0x99, 0x43, 0xEF, 0x57, 0xC4, 0x28, 0x26, 0x0F, 0x90, 0x38, 0xBF
+};
+
+/* FIPS 180-4 and FIPS 202 examples, SHA-256("abc"), SHA-512("abc") and SHA3-256("abc") */
+static const uint8 g_sha256Abc[SHA256_DIGEST_SIZE] = {
+    0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41, 0x40, 0xDE, 0x5D, 0xAE, 0x22, 0x23,
+    0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17, 0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD
+};
+static const uint8 g_sha512Abc[SHA512_DIGEST_SIZE] = {
+    0xDD, 0xAF, 0x35, 0xA1, 0x93, 0x61, 0x7A, 0xBA, 0xCC, 0x41, 0x73, 0x49, 0xAE, 0x20, 0x41, 0x31,
+    0x12, 0xE6, 0xFA, 0x4E, 0x89, 0xA9, 0x7E, 0xA2, 0x0A, 0x9E, 0xEE, 0xE6, 0x4B, 0x55, 0xD3, 0x9A,
+    0x21, 0x92, 0x99, 0x2A, 0x27, 0x4F, 0xC1, 0xA8, 0x36, 0xBA, 0x3C, 0x23, 0xA3, 0xFE, 0xEB, 0xBD,
+    0x45, 0x4D, 0x44, 0x23, 0x64, 0x3C, 0xE8, 0x0E, 0x2A, 0x9A, 0xC9, 0x4F, 0xA5, 0x4C, 0xA4, 0x9F
+};
+static const uint8 g_sha3Abc[SHA3_256_DIGEST_SIZE] = {
+    0x3A, 0x98, 0x5D, 0xA7, 0x4F, 0xE2, 0x25, 0xB2, 0x04, 0x5C, 0x17, 0x2D, 0x6B, 0xD3, 0x90, 0xBD,
+    0x85, 0x5F, 0x08, 0x6E, 0x3E, 0x9D, 0x52, 0x5B, 0x46, 0xBF, 0xE2, 0x45, 0x11, 0x43, 0x15, 0x32
+};
+
+/* Test case 2 of the GCM specification: zero key, zero IV, one zero block */
+static const uint8 g_gcmZeroBlock[AES_BLOCK_SIZE + AESGCM_TAG_SIZE] = {
+    0x03, 0x88, 0xDA, 0xCE, 0x60, 0xB6, 0xA3, 0x92, 0xF3, 0x28, 0xC2, 0xB9, 0x71, 0xB2, 0xFE, 0x78,
+    0xAB, 0x6E, 0x47, 0xD4, 0x2C, 0xEC, 0x13, 0xBD, 0xF5, 0x3A, 0x67, 0xB2, 0x12, 0x57, 0xBD, 0xDF
+};
+
+/* RFC 8439 section 2.8.2: tag of the sunscreen message */
+static const char g_sunscreen[] = "Ladies and Gentlemen of the class of '99: If I could offer you only one tip for "
+                                  "the future, sunscreen would be it.";
+static const uint8 g_sunscreenTag[CHACHAPOLY_TAG_SIZE] = {
+    0x1A, 0xE1, 0x0B, 0x59, 0x4F, 0x09, 0xE2, 0x6A, 0x7E, 0x90, 0x2E, 0xCB, 0xD0, 0x60, 0x06, 0x91
+};
+
+/* RFC 7748 section 5.2, first X25519 example */
+static const uint8 g_x25519Scalar[X25519_KEY_SIZE] = {
+    0xA5, 0x46, 0xE3, 0x6B, 0xF0, 0x52, 0x7C, 0x9D, 0x3B, 0x16, 0x15, 0x4B, 0x82, 0x46, 0x5E, 0xDD,
+    0x62, 0x14, 0x4C, 0x0A, 0xC1, 0xFC, 0x5A, 0x18, 0x50, 0x6A, 0x22, 0x44, 0xBA, 0x44, 0x9A, 0xC4
+};
+static const uint8 g_x25519Point[X25519_KEY_SIZE] = {
+    0xE6, 0xDB, 0x68, 0x67, 0x58, 0x30, 0x30, 0xDB, 0x35, 0x94, 0xC1, 0xA4, 0x24, 0xB1, 0x5F, 0x7C,
+    0x72, 0x66, 0x24, 0xEC, 0x26, 0xB3, 0x35, 0x3B, 0x10, 0xA9, 0x03, 0xA6, 0xD0, 0xAB, 0x1C, 0x4C
+};
+static const uint8 g_x25519Result[X25519_KEY_SIZE] = {
+    0xC3, 0xDA, 0x55, 0x37, 0x9D, 0xE9, 0xC6, 0x90, 0x8E, 0x94, 0xEA, 0x4D, 0xF2, 0x8D, 0x08, 0x4F,
+    0x32, 0xEC, 0xCF, 0x03, 0x49, 0x1C, 0x71, 0xF7, 0x54, 0xB4, 0x07, 0x55, 0x77, 0xA2, 0x85, 0x52
+};
+
+/* RFC 8032 section 7.1, test 1: empty message */
+static const uint8 g_ed25519SecretKey[ED25519_SECRET_KEY_SIZE] = {
+    0x9D, 0x61, 0xB1, 0x9D, 0xEF, 0xFD, 0x5A, 0x60, 0xBA, 0x84, 0x4A, 0xF4, 0x92, 0xEC, 0x2C, 0xC4,
+    0x44, 0x49, 0xC5, 0x69, 0x7B, 0x32, 0x69, 0x19, 0x70, 0x3B, 0xAC, 0x03, 0x1C, 0xAE, 0x7F, 0x60
+};
+static const uint8 g_ed25519PublicKey[ED25519_PUBLIC_KEY_SIZE] = {
+    0xD7, 0x5A, 0x98, 0x01, 0x82, 0xB1, 0x0A, 0xB7, 0xD5, 0x4B, 0xFE, 0xD3, 0xC9, 0x64, 0x07, 0x3A,
+    0x0E, 0xE1, 0x72, 0xF3, 0xDA, 0xA6, 0x23, 0x25, 0xAF, 0x02, 0x1A, 0x68, 0xF7, 0x07, 0x51, 0x1A
+};
+static const uint8 g_ed25519Signature[ED25519_SIGNATURE_SIZE] = {
+    0xE5, 0x56, 0x43, 0x00, 0xC3, 0x60, 0xAC, 0x72, 0x90, 0x86, 0xE2, 0xCC, 0x80, 0x6E, 0x82, 0x8A,
+    0x84, 0x87, 0x7F, 0x1E, 0xB8, 0xE5, 0xD9, 0x74, 0xD8, 0x73, 0xE0, 0x65, 0x22, 0x49, 0x01, 0x55,
+    0x5F, 0xB8, 0x82, 0x15, 0x90, 0xA3, 0x3B, 0xAC, 0xC6, 0x1E, 0x39, 0x70, 0x1C, 0xF9, 0xB4, 0x6B,
+    0xD2, 0x5B, 0xF5, 0xF0, 0x59, 0x5B, 0xBE, 0x24, 0x65, 0x51, 0x41, 0x43, 0x8E, 0x7A, 0x10, 0x0B
+};
+
+/* CTR_DRBG (AES-256, df) seeded with 00..2F and "crypto_bench", second 32 byte output computed with OpenSSL */
+static const uint8 g_ctrDrbgOutput[32] = {
+    0x53, 0x96, 0xF7, 0x79, 0x00, 0x26, 0x82, 0x56, 0x7F, 0x17, 0x88, 0x19, 0x5D, 0xD4, 0x63, 0xE4,
+    0x08, 0xEF, 0x19, 0xF4, 0xA8, 0x2F, 0x75, 0x12, 0x79, 0x90, 0xAA, 0x5F, 0xBB, 0x53, 0x1F, 0x79
+};
+
+/*
+ * FIPS 203 ML-KEM-768 with d || z = 00..3F and m = 40..5F, computed with OpenSSL 3.5: SHA3-256 of the public key,
+ * the secret key and the ciphertext, and the shared secret
+ */
+static const uint8 g_mlkemPublicKeyHash[SHA3_256_DIGEST_SIZE] = {
+    0xA2, 0x4E, 0x16, 0xD8, 0xF8, 0xF9, 0x38, 0x3A, 0x95, 0xB7, 0x70, 0x50, 0xF4, 0xD9, 0xFD, 0x2F,
+    0x57, 0x33, 0xEE, 0xC1, 0xD6, 0x3E, 0xF3, 0xC2, 0x3E, 0xBF, 0x99, 0x18, 0x17, 0x36, 0x69, 0xA7
+};
+static const uint8 g_mlkemSecretKeyHash[SHA3_256_DIGEST_SIZE] = {
+    0x11, 0x49, 0xF1, 0x7C, 0x3C, 0x4A, 0xC6, 0xAB, 0x1E, 0x3E, 0x2D, 0x9D, 0x8B, 0xD0, 0x17, 0x13,
+    0x55, 0xAC, 0x0F, 0xA3, 0x1B, 0xB8, 0x85, 0x5C, 0x48, 0xCE, 0xAD, 0xE8, 0x74, 0xC0, 0x86, 0x4B
+};
+static const uint8 g_mlkemCiphertextHash[SHA3_256_DIGEST_SIZE] = {
+    0xB4, 0xCF, 0xBD, 0x24, 0xCE, 0xF6, 0x7A, 0xFD, 0x37, 0x64, 0x27, 0x6C, 0x69, 0x80, 0xE0, 0xF8,
+    0x8F, 0x8E, 0x9C, 0xA5, 0x7F, 0x59, 0xB7, 0xF1, 0x2F, 0xE1, 0xA9, 0xC1, 0xE7, 0x2F, 0x47, 0x10
+};
+static const uint8 g_mlkemSecret[MLKEM_SHARED_SECRET_SIZE] = {
+    0x9C, 0xDD, 0xD0, 0x89, 0xFF, 0xE7, 0x0E, 0x39, 0x96, 0xE7, 0x6F, 0x7C, 0x8D, 0x06, 0x74, 0x6D,
+    0xF3, 0x4D, 0x07, 0xE8, 0x65, 0x7B, 0xC0, 0xFC, 0xF2, 0xBB, 0x0E, 0x1C, 0x30, 0x84, 0xAE, 0xA1
+};
+
+/*
+ * X25519MLKEM768 with the key pair random 80..DF and the encapsulation random E0..1F, ML-KEM and X25519 parts
+ * computed with OpenSSL 3.5: SHA3-256 of both key shares and the combined secret
+ */
+static const uint8 g_hybridClientShareHash[SHA3_256_DIGEST_SIZE] = {
+    0xC4, 0x73, 0x92, 0x22, 0xF0, 0x70, 0x6B, 0x04, 0xBC, 0x40, 0x1B, 0x50, 0x95, 0xA1, 0x65, 0x9B,
+    0xA9, 0xB8, 0x62, 0x1F, 0x58, 0x84, 0x83, 0x45, 0xBF, 0x7C, 0x34, 0x51, 0x56, 0xF4, 0xF8, 0xE1
+};
+static const uint8 g_hybridServerShareHash[SHA3_256_DIGEST_SIZE] = {
+    0xA3, 0x06, 0xCD, 0x35, 0x23, 0x87, 0xB5, 0x85, 0xD9, 0xC8, 0xE6, 0xC9, 0xCC, 0x12, 0x35, 0x40,
+    0xE4, 0xBE, 0x42, 0x3E, 0x21, 0x4A, 0x90, 0xDA, 0x80, 0xB2, 0x23, 0xF4, 0xC1, 0xA1, 0x15, 0x6E
+};
+static const uint8 g_hybridSecret[HYBRIDKEM_SECRET_SIZE] = {
+    0xD1, 0x24, 0xA0, 0x58, 0x10, 0x5D, 0x22, 0x90, 0xAE, 0x2A, 0x88, 0x61, 0xC9, 0x73, 0xDD, 0x5E,
+    0x45, 0x5C, 0x1F, 0xB2, 0x51, 0x7D, 0x6F, 0x75, 0x40, 0xD1, 0x8F, 0xB0, 0x89, 0x99, 0xEF, 0x98,
+    0xDA, 0xF2, 0x86, 0x7F, 0x8D, 0xCB, 0x09, 0x78, 0x25, 0x93, 0x23, 0x1C, 0xE4, 0x9E, 0x2D, 0x92,
+    0xF0, 0xF2, 0xFC, 0x5E, 0x87, 0x6D, 0x6B, 0x9C, 0xA5, 0x69, 0x60, 0xAD, 0x1C, 0x8D, 0xEA, 0x3C
+};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static uint64_t cycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+#endif
+}
+
+static void fillRandom(uint8 *data, uint32 length)
+{
+    uint32 i;
+
+    for (i = 0; i < length; i++)
+        data[i] = (uint8)rand();
+}
+
+/* Bytes first, first + 1, ... as the fixed random input of a known answer test */
+static void fillSequence(uint8 *data, uint32 length, uint8 first)
+{
+    uint32 i;
+
+    for (i = 0; i < length; i++)
+        data[i] = (uint8)(first + i);
+}
+
+/* 1 if the SHA3-256 of data differs from the expected digest */
+static int differsFromHash(const uint8 *data, uint32 length, const uint8 *expected)
+{
+    uint8 digest[SHA3_256_DIGEST_SIZE];
+
+    Keccak_Sha3_256(data, length, digest);
+
+    return (memcmp(digest, expected, SHA3_256_DIGEST_SIZE) != 0);
+}
+
+static void report(const char *name, uint64_t total, uint32 runs)
+{
+    printf("%-28s %10llu cycles\n", name, (unsigned long long)(total / runs));
+}
+
+static void reportRate(const char *name, uint64_t total, uint32 runs, uint32 bytes)
+{
+    printf("%-28s %10.1f cycles/byte\n", name, (double)total / runs / bytes);
+}
+
+static int benchSha2(uint32 runs)
+{
+    static uint8 data[16384];
+    uint8 digest[SHA512_DIGEST_SIZE];
+    uint64_t sha256 = 0, sha512 = 0, start;
+    uint32 run;
+    int failures = 0;
+
+    Sha256_Calculate((const uint8 *)"abc", 3u, digest);
+    failures += (memcmp(digest, g_sha256Abc, SHA256_DIGEST_SIZE) != 0);
+    Sha512_Calculate((const uint8 *)"abc", 3u, digest);
+    failures += (memcmp(digest, g_sha512Abc, SHA512_DIGEST_SIZE) != 0);
+
+    fillRandom(data, sizeof(data));
+    for (run = 0; run < runs; run++)
+    {
+        start = cycles();
+        Sha256_Calculate(data, sizeof(data), digest);
+        sha256 += cycles() - start;
+
+        start = cycles();
+        Sha512_Calculate(data, sizeof(data), digest);
+        sha512 += cycles() - start;
+    }
+    reportRate("SHA-256", sha256, runs, sizeof(data));
+    reportRate("SHA-512", sha512, runs, sizeof(data));
+
+    return failures;
+}
+
+static int benchKeccak(uint32 runs)
+{
+    static uint8 data[16 * KECCAK_RATE_SHAKE128];
+    static Keccak_t ctx;
+    uint8 digest[SHA3_256_DIGEST_SIZE];
+    uint64_t absorb = 0, squeeze = 0, sha3 = 0, start;
+    uint32 run;
+    int failures = 0;
+
+    Keccak_Sha3_256((const uint8 *)"abc", 3u, digest);
+    failures += (memcmp(digest, g_sha3Abc, SHA3_256_DIGEST_SIZE) != 0);
+
+    fillRandom(data, sizeof(data));
+    for (run = 0; run < runs; run++)
+    {
+        Keccak_Init(&ctx, KECCAK_RATE_SHAKE128);
+        start = cycles();
+        Keccak_Absorb(&ctx, data, sizeof(data));
+        absorb += cycles() - start;
+
+        Keccak_Finalize(&ctx, KECCAK_SUFFIX_SHAKE);
+        start = cycles();
+        Keccak_SqueezeBlocks(&ctx, data, 16u);
+        squeeze += cycles() - start;
+
+        start = cycles();
+        Keccak_Sha3_256(data, sizeof(data), digest);
+        sha3 += cycles() - start;
+    }
+    reportRate("SHAKE128 absorb", absorb, runs, sizeof(data));
+    reportRate("SHAKE128 squeeze blocks", squeeze, runs, sizeof(data));
+    reportRate("SHA3-256", sha3, runs, sizeof(data));
+
+    return failures;
+}
+
+static int benchAesGcm(uint32 runs)
+{
+    static uint8 data[16384];
+    static AesGcm_t ctx;
+    uint8 key[AES256_KEY_SIZE] = {0};
+    uint8 iv[AESGCM_IV_SIZE] = {0};
+    uint8 block[AES_BLOCK_SIZE + AESGCM_TAG_SIZE] = {0};
+    uint64_t decrypt = 0, start;
+    uint32 run;
+    int failures = 0;
+
+    (void)AesGcm_Init(&ctx, key, AES128_KEY_SIZE);
+    AesGcm_Start(&ctx, iv, NULL_PTR, 0u);
+    AesGcm_Encrypt(&ctx, block, block, AES_BLOCK_SIZE);
+    AesGcm_Finish(&ctx, &block[AES_BLOCK_SIZE]);
+    failures += (memcmp(block, g_gcmZeroBlock, sizeof(block)) != 0);
+
+    fillRandom(key, sizeof(key));
+    fillRandom(data, sizeof(data));
+    (void)AesGcm_Init(&ctx, key, AES256_KEY_SIZE);
+    for (run = 0; run < runs; run++)
+    {
+        AesGcm_Start(&ctx, iv, key, sizeof(key));
+        AesGcm_Encrypt(&ctx, data, data, sizeof(data));
+        AesGcm_Finish(&ctx, block);
+
+        /* In place, as Ota_Gcm decrypts into the page ring */
+        start = cycles();
+        AesGcm_Start(&ctx, iv, key, sizeof(key));
+        AesGcm_Decrypt(&ctx, data, data, sizeof(data));
+        failures += !AesGcm_CheckTag(&ctx, block);
+        decrypt += cycles() - start;
+    }
+    reportRate("AES-256-GCM decrypt", decrypt, runs, sizeof(data));
+
+    return failures;
+}
+
+static int benchChaChaPoly(uint32 runs)
+{
+    static uint8 data[16384];
+    static ChaChaPoly_t ctx;
+    static const uint8 aad[12] = {0x50, 0x51, 0x52, 0x53, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7};
+    static const uint8 nonce[CHACHAPOLY_NONCE_SIZE] = {0x07, 0, 0, 0, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47};
+    uint8 key[CHACHAPOLY_KEY_SIZE];
+    uint8 tag[CHACHAPOLY_TAG_SIZE];
+    uint64_t seal = 0, open = 0, start;
+    uint32 run;
+    uint32 i;
+    int failures = 0;
+
+    for (i = 0; i < CHACHAPOLY_KEY_SIZE; i++)
+        key[i] = (uint8)(0x80u + i);
+    memcpy(data, g_sunscreen, sizeof(g_sunscreen) - 1u);
+    ChaChaPoly_Init(&ctx, key);
+    ChaChaPoly_Seal(&ctx, nonce, aad, sizeof(aad), data, sizeof(g_sunscreen) - 1u, tag);
+    failures += (memcmp(tag, g_sunscreenTag, CHACHAPOLY_TAG_SIZE) != 0);
+
+    fillRandom(data, sizeof(data));
+    for (run = 0; run < runs; run++)
+    {
+        start = cycles();
+        ChaChaPoly_Seal(&ctx, nonce, aad, sizeof(aad), data, sizeof(data), tag);
+        seal += cycles() - start;
+
+        start = cycles();
+        failures += !ChaChaPoly_Open(&ctx, nonce, aad, sizeof(aad), data, sizeof(data), tag);
+        open += cycles() - start;
+    }
+    reportRate("ChaCha20-Poly1305 seal", seal, runs, sizeof(data));
+    reportRate("ChaCha20-Poly1305 open", open, runs, sizeof(data));
+
+    return failures;
+}
+
+/* Entropy source of the pool benchmark */
+static boolean benchEntropy(uint8 *data, uint32 length)
+{
+    fillRandom(data, length);
+
+    return TRUE;
+}
+
+static int benchCtrDrbg(uint32 runs)
+{
+    static CtrDrbg_Pool_t pool;
+    CtrDrbg_t drbg;
+    uint8 seed[CTRDRBG_MIN_ENTROPY_SIZE];
+    uint8 output[32];
+    uint64_t read = 0, generate = 0, refill = 0, start;
+    uint32 run;
+    uint32 i;
+    int failures = 0;
+
+    for (i = 0; i < CTRDRBG_MIN_ENTROPY_SIZE; i++)
+        seed[i] = (uint8)i;
+    failures += !CtrDrbg_Instantiate(&drbg, seed, sizeof(seed), (const uint8 *)"crypto_bench", 12u);
+    failures += !CtrDrbg_Generate(&drbg, output, sizeof(output), NULL_PTR, 0u);
+    failures += !CtrDrbg_Generate(&drbg, output, sizeof(output), NULL_PTR, 0u);
+    failures += (memcmp(output, g_ctrDrbgOutput, sizeof(output)) != 0);
+
+    /* A key sized read from the pool against the same request to the generator, then the batch refill */
+    failures += !CtrDrbg_PoolInit(&pool, benchEntropy, NULL_PTR, 0u);
+    for (run = 0; run < runs; run++)
+    {
+        start = cycles();
+        failures += !CtrDrbg_Read(&pool, output, sizeof(output));
+        read += cycles() - start;
+
+        start = cycles();
+        failures += !CtrDrbg_Generate(&drbg, output, sizeof(output), NULL_PTR, 0u);
+        generate += cycles() - start;
+
+        start = cycles();
+        failures += !CtrDrbg_Refill(&pool);
+        refill += cycles() - start;
+    }
+    report("CTR_DRBG pool read 32 B", read, runs);
+    report("CTR_DRBG generate 32 B", generate, runs);
+    reportRate("CTR_DRBG batch refill", refill, runs, sizeof(output));
+
+    return failures;
+}
+
+static int benchCurve25519(uint32 runs)
+{
+    uint8 output[X25519_KEY_SIZE];
+    uint8 publicKey[ED25519_PUBLIC_KEY_SIZE];
+    uint8 signature[ED25519_SIGNATURE_SIZE];
+    uint8 message[64];
+    uint64_t x25519 = 0, keyPair = 0, sign = 0, verify = 0, start;
+    uint32 run;
+    int failures = 0;
+
+    failures += !X25519_ScalarMult(output, g_x25519Scalar, g_x25519Point);
+    failures += (memcmp(output, g_x25519Result, X25519_KEY_SIZE) != 0);
+    Ed25519_PublicKey(publicKey, g_ed25519SecretKey);
+    failures += (memcmp(publicKey, g_ed25519PublicKey, ED25519_PUBLIC_KEY_SIZE) != 0);
+    Ed25519_Sign(signature, g_ed25519SecretKey, publicKey, message, 0u);
+    failures += (memcmp(signature, g_ed25519Signature, ED25519_SIGNATURE_SIZE) != 0);
+
+    fillRandom(message, sizeof(message));
+    for (run = 0; run < runs; run++)
+    {
+        start = cycles();
+        (void)X25519_ScalarMult(output, g_x25519Scalar, output);
+        x25519 += cycles() - start;
+
+        start = cycles();
+        Ed25519_PublicKey(publicKey, output);
+        keyPair += cycles() - start;
+
+        start = cycles();
+        Ed25519_Sign(signature, output, publicKey, message, sizeof(message));
+        sign += cycles() - start;
+
+        start = cycles();
+        failures += !Ed25519_Verify(publicKey, message, sizeof(message), signature);
+        verify += cycles() - start;
+    }
+    report("X25519 scalar multiplication", x25519, runs);
+    report("Ed25519 key pair", keyPair, runs);
+    report("Ed25519 sign", sign, runs);
+    report("Ed25519 verify", verify, runs);
+
+    return failures;
+}
+
+static int benchHybridKem(uint32 runs)
+{
+    static HybridKem_t client;
+    static HybridKem_t server;
+    static uint8 clientShare[HYBRIDKEM_CLIENT_SHARE_SIZE];
+    static uint8 serverShare[HYBRIDKEM_SERVER_SHARE_SIZE];
+    uint8 random[HYBRIDKEM_KEYPAIR_RANDOM_SIZE];
+    uint8 clientSecret[HYBRIDKEM_SECRET_SIZE];
+    uint8 serverSecret[HYBRIDKEM_SECRET_SIZE];
+    uint8 point[X25519_KEY_SIZE];
+    uint64_t keyPair = 0, encapsulate = 0, decapsulate = 0, mlkem = 0, x25519 = 0, start;
+    uint32 run;
+    int failures = 0;
+
+    /* ML-KEM-768 alone: key generation, encapsulation and decapsulation from fixed seeds */
+    fillSequence(random, MLKEM_SEED_SIZE, 0x00u);
+    MlKem_KeyPair(&client.workspace, random, clientShare, client.mlkemSecretKey);
+    failures += differsFromHash(clientShare, MLKEM768_PUBLIC_KEY_SIZE, g_mlkemPublicKeyHash);
+    failures += differsFromHash(client.mlkemSecretKey, MLKEM768_SECRET_KEY_SIZE, g_mlkemSecretKeyHash);
+    fillSequence(random, MLKEM_MESSAGE_SIZE, 0x40u);
+    failures += !MlKem_Encapsulate(&server.workspace, clientShare, random, serverShare, serverSecret);
+    failures += differsFromHash(serverShare, MLKEM768_CIPHERTEXT_SIZE, g_mlkemCiphertextHash);
+    failures += (memcmp(serverSecret, g_mlkemSecret, MLKEM_SHARED_SECRET_SIZE) != 0);
+    failures += !MlKem_Decapsulate(&client.workspace, client.mlkemSecretKey, serverShare, clientSecret);
+    failures += (memcmp(clientSecret, g_mlkemSecret, MLKEM_SHARED_SECRET_SIZE) != 0);
+
+    /* The hybrid exchange with both key shares and the combined secret */
+    fillSequence(random, HYBRIDKEM_KEYPAIR_RANDOM_SIZE, 0x80u);
+    HybridKem_KeyPair(&client, random, clientShare);
+    failures += differsFromHash(clientShare, HYBRIDKEM_CLIENT_SHARE_SIZE, g_hybridClientShareHash);
+    fillSequence(random, HYBRIDKEM_ENCAPSULATE_RANDOM_SIZE, 0xE0u);
+    failures += !HybridKem_Encapsulate(&server, clientShare, random, serverShare, serverSecret);
+    failures += differsFromHash(serverShare, HYBRIDKEM_SERVER_SHARE_SIZE, g_hybridServerShareHash);
+    failures += (memcmp(serverSecret, g_hybridSecret, HYBRIDKEM_SECRET_SIZE) != 0);
+    failures += !HybridKem_Decapsulate(&client, serverShare, clientSecret);
+    failures += (memcmp(clientSecret, g_hybridSecret, HYBRIDKEM_SECRET_SIZE) != 0);
+
+    for (run = 0; run < runs; run++)
+    {
+        fillRandom(random, sizeof(random));
+        start = cycles();
+        HybridKem_KeyPair(&client, random, clientShare);
+        keyPair += cycles() - start;
+
+        fillRandom(random, HYBRIDKEM_ENCAPSULATE_RANDOM_SIZE);
+        start = cycles();
+        failures += !HybridKem_Encapsulate(&server, clientShare, random, serverShare, serverSecret);
+        encapsulate += cycles() - start;
+
+        /* The ML-KEM part alone, from the secret key still held by the client */
+        start = cycles();
+        failures += !MlKem_Decapsulate(&client.workspace, client.mlkemSecretKey, serverShare, clientSecret);
+        mlkem += cycles() - start;
+
+        start = cycles();
+        (void)X25519_ScalarMult(point, client.x25519SecretKey, &serverShare[MLKEM768_CIPHERTEXT_SIZE]);
+        x25519 += cycles() - start;
+
+        start = cycles();
+        failures += !HybridKem_Decapsulate(&client, serverShare, clientSecret);
+        decapsulate += cycles() - start;
+
+        failures += (memcmp(clientSecret, serverSecret, sizeof(clientSecret)) != 0);
+    }
+
+    report("X25519MLKEM768 key pair", keyPair, runs);
+    report("X25519MLKEM768 encapsulate", encapsulate, runs);
+    report("X25519MLKEM768 decapsulate", decapsulate, runs);
+    report("  ML-KEM-768 decapsulate", mlkem, runs);
+    report("  X25519 shared secret", x25519, runs);
+
+    return failures;
+}
+
+/* Signature with c~ random, z within +-1000 of zero packed as gamma1 - z, and an empty hint section */
+static void fillSignature(uint8 *signature, uint32 challengeSize, uint32 columns, uint32 zBits, uint32 length)
+{
+    uint32 gamma1 = 1uL << (zBits - 1u);
+    uint32 acc = 0;
+    uint32 fill = 0;
+    uint32 i;
+    uint8 *out = &signature[challengeSize];
+
+    memset(signature, 0, length);
+    fillRandom(signature, challengeSize);
+    for (i = 0; i < columns * 256u; i++)
+    {
+        acc  |= (gamma1 + (uint32)(rand() % 2001) - 1000u) << fill;
+        fill += zBits;
+        while (fill >= 8u)
+        {
+            *out++ = (uint8)acc;
+            acc >>= 8;
+            fill -= 8u;
+        }
+    }
+}
+
+/*
+ * Known answer of one parameter set: the vector must verify, and a changed context string, message, signature or
+ * public key must be rejected
+ */
+static int checkMlDsa(MlDsa_Workspace_t *ws, MlDsa_Level level, const uint8 *publicKey, const uint8 *signature)
+{
+    uint8 message[sizeof(MLDSA_VECTOR_MESSAGE) - 1u];
+    uint32 publicKeySize = MlDsa_GetPublicKeySize(level);
+    uint32 contextSize = sizeof(MLDSA_VECTOR_CONTEXT) - 1u;
+    const uint8 *context = (const uint8 *)MLDSA_VECTOR_CONTEXT;
+    int failures = 0;
+
+    memcpy(g_flash, publicKey, publicKeySize);
+    memcpy(&g_flash[publicKeySize], signature, MlDsa_GetSignatureSize(level));
+    memcpy(message, MLDSA_VECTOR_MESSAGE, sizeof(message));
+
+    failures += !MlDsa_Verify(ws, level, 0u, publicKeySize, context, contextSize, message, sizeof(message));
+    failures += MlDsa_Verify(ws, level, 0u, publicKeySize, context, contextSize - 1u, message, sizeof(message));
+    failures += MlDsa_Verify(ws, level, 0u, publicKeySize, NULL_PTR, 0u, message, sizeof(message));
+
+    message[0] ^= 1u;
+    failures += MlDsa_Verify(ws, level, 0u, publicKeySize, context, contextSize, message, sizeof(message));
+    message[0] ^= 1u;
+
+    g_flash[publicKeySize + 100u] ^= 1u;
+    failures += MlDsa_Verify(ws, level, 0u, publicKeySize, context, contextSize, message, sizeof(message));
+    g_flash[publicKeySize + 100u] ^= 1u;
+
+    g_flash[100] ^= 1u;
+    failures += MlDsa_Verify(ws, level, 0u, publicKeySize, context, contextSize, message, sizeof(message));
+
+    return failures;
+}
+
+static int benchMlDsa(uint32 runs)
+{
+    static MlDsa_Workspace_t ws;
+    static const char *const names[2] = {"ML-DSA-44 verify", "ML-DSA-65 verify"};
+    static const uint32 challengeSize[2] = {32u, 48u};
+    static const uint32 columns[2] = {4u, 5u};
+    static const uint32 zBits[2] = {18u, 20u};
+    uint8 message[64];
+    uint64_t total, start;
+    uint32 publicKeySize;
+    uint32 run;
+    int level;
+    int failures = 0;
+
+    failures += checkMlDsa(&ws, MlDsa_Level_44, g_mlDsa44PublicKey, g_mlDsa44Signature);
+    failures += checkMlDsa(&ws, MlDsa_Level_65, g_mlDsa65PublicKey, g_mlDsa65Signature);
+
+    for (level = MlDsa_Level_44; level <= MlDsa_Level_65; level++)
+    {
+        publicKeySize = MlDsa_GetPublicKeySize((MlDsa_Level)level);
+        total = 0;
+        for (run = 0; run < runs; run++)
+        {
+            fillRandom(g_flash, publicKeySize);
+            fillSignature(&g_flash[publicKeySize], challengeSize[level], columns[level], zBits[level],
+                          MlDsa_GetSignatureSize((MlDsa_Level)level));
+            fillRandom(message, sizeof(message));
+
+            start = cycles();
+            failures += MlDsa_Verify(&ws, (MlDsa_Level)level, 0u, publicKeySize, NULL_PTR, 0u, message,
+                                     sizeof(message));
+            total += cycles() - start;
+        }
+        report(names[level], total, runs);
+    }
+    printf("%-28s %10u bytes\n", "  ML-DSA workspace", (unsigned)sizeof(ws));
+
+    return failures;
+}
+
+static int benchP256(uint32 runs)
+{
+    uint8 digest[SHA256_DIGEST_SIZE];
+    uint8 signature[P256_SIGNATURE_SIZE];
+    uint64_t total = 0, start;
+    uint32 run;
+    int failures = 0;
+
+    Sha256_Calculate((const uint8 *)"sample", 6u, digest);
+    for (run = 0; run < runs; run++)
+    {
+        start = cycles();
+        failures += !P256_Verify(g_p256PublicKey, digest, g_p256Signature);
+        total += cycles() - start;
+    }
+    report("ECDSA P-256 verify", total, runs);
+
+    /* A changed digest or signature must be rejected */
+    memcpy(signature, g_p256Signature, sizeof(signature));
+    signature[P256_SIGNATURE_SIZE - 1u] ^= 1u;
+    failures += P256_Verify(g_p256PublicKey, digest, signature);
+    digest[0] ^= 1u;
+    failures += P256_Verify(g_p256PublicKey, digest, g_p256Signature);
+
+    return failures;
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+void Flash4_ReadBuffer(uint8 *outData, uint32 addr, uint32 nData)
+{
+    memcpy(outData, &g_flash[addr], nData);
+}
+
+int main(int argc, char **argv)
+{
+    uint32 runs = (argc > 1) ? (uint32)strtoul(argv[1], NULL, 0) : 20u;
+    int failures = 0;
+
+    if (runs == 0u)
+        runs = 1u;
+
+    srand(1);
+    failures += benchSha2(runs);
+    failures += benchKeccak(runs);
+    failures += benchAesGcm(runs);
+    failures += benchChaChaPoly(runs);
+    failures += benchCtrDrbg(runs);
+    failures += benchCurve25519(runs);
+    failures += benchHybridKem(runs);
+    failures += benchMlDsa(runs);
+    failures += benchP256(runs);
+
+    if (failures != 0)
+    {
+        printf("%d consistency failures\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,2 @@
+/* Host stand-in for the iLLD header of the same name, see PFlashModel.h */
+#include "PFlashModel.h"
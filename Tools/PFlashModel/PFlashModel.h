@@ -0,0 +1,118 @@
+/**********************************************************************************************************************
+ * \file PFlashModel.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Host model of the TC37x program flash, the UCB and the address map swap
+ * Provides the parts of the iLLD used by Ota_Installer.c and Ota_BankSwap.c, so both compile unchanged on a Linux
+ * host. The headers next to this one stand in for the iLLD headers of the same name.
+ *
+ * The PFlash is mapped at its target address (0xA0000000, 6 MB) and the UCB area at 0xAF400000. Erase and burst
+ * commands keep the physical bank busy for a simulated time, and the model aborts on anything the flash module
+ * would reject: a command to a busy bank, programming a non-erased page, crossing a physical sector, missing
+ * endinit release, or the application reading its bank while that bank is busy.
+ *********************************************************************************************************************/
+
+#ifndef PFLASHMODEL_H_
+#define PFLASHMODEL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Types--------------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef uint8_t  uint8;
+typedef uint16_t uint16;
+typedef uint32_t uint32;
+typedef uint64_t uint64;
+typedef int8_t   sint8;
+typedef int16_t  sint16;
+typedef int32_t  sint32;
+typedef uint8_t  boolean;
+typedef float    float32;
+
+typedef int IfxQspi_SpiMaster;
+typedef int IfxQspi_SpiMaster_Channel;
+typedef int Ifx_STM;
+
+#define TRUE                           1
+#define FALSE                          0
+#define NULL_PTR                       ((void *)0)
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define IFXFLASH_PFLASH_BURST_LENGTH   0x100
+#define IFXFLASH_PFLASH_P0_START       0xA0000000u
+#define IFXFLASH_PFLASH_P0_SIZE        0x300000u
+#define IFXFLASH_PFLASH_P0_END         (IFXFLASH_PFLASH_P0_START + IFXFLASH_PFLASH_P0_SIZE - 1u)
+#define IFXFLASH_PFLASH_P1_START       (IFXFLASH_PFLASH_P0_START + IFXFLASH_PFLASH_P0_SIZE)
+#define IFXFLASH_PFLASH_P1_SIZE        0x300000u
+#define IFXFLASH_PFLASH_P1_END         (IFXFLASH_PFLASH_P1_START + IFXFLASH_PFLASH_P1_SIZE - 1u)
+
+#define PFLASH_MODEL_UCB_START         0xAF400000u
+#define PFLASH_MODEL_UCB_SIZE          0x6000u
+
+/* Reading the status register lets simulated time pass, like polling it on the target */
+#define DMU_HF_STATUS                  (*PFlashModel_status())
+#define SCU_SWAPCTRL                   g_pflashModelSwapCtrl
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef enum
+{
+    IfxFlash_FlashType_D0 = 0,
+    IfxFlash_FlashType_D1 = 1,
+    IfxFlash_FlashType_P0 = 2,
+    IfxFlash_FlashType_P1 = 3
+} IfxFlash_FlashType;
+
+typedef union
+{
+    uint32 U;
+} Ifx_DMU_HF_STATUS;
+
+typedef union
+{
+    uint32 U;
+    struct
+    {
+        uint32 ADDRCFG:2;
+        uint32 SPARE:14;
+        uint32 reserved_16:16;
+    } B;
+} Ifx_SCU_SWAPCTRL;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Global variables---------------------------------------------------*/
+/*********************************************************************************************************************/
+extern Ifx_STM          MODULE_STM0;
+extern Ifx_SCU_SWAPCTRL g_pflashModelSwapCtrl;
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* iLLD */
+uint8  IfxFlash_enterPageMode(uint32 pageAddr);
+uint8  IfxFlash_waitUnbusy(uint32 flash, IfxFlash_FlashType flashType);
+void   IfxFlash_loadPage2X32(uint32 pageAddr, uint32 wordL, uint32 wordU);
+void   IfxFlash_writeBurst(uint32 pageAddr);
+void   IfxFlash_writePage(uint32 pageAddr);
+void   IfxFlash_eraseMultipleSectors(uint32 sectorAddr, uint32 numSector);
+uint16 IfxScuWdt_getSafetyWatchdogPasswordInline(void);
+void   IfxScuWdt_clearSafetyEndinitInline(uint16 password);
+void   IfxScuWdt_setSafetyEndinitInline(uint16 password);
+uint32 IfxStm_get(Ifx_STM *stm);
+float32 IfxStm_getFrequency(Ifx_STM *stm);
+
+/* Model control */
+Ifx_DMU_HF_STATUS *PFlashModel_status(void);
+void   PFlashModel_Init(void);
+uint8 *PFlashModel_Flash4(void);
+void   PFlashModel_Execute(uint32 microseconds);
+void   PFlashModel_Reset(void);
+uint64 PFlashModel_Time(void);
+
+#endif /* PFLASHMODEL_H_ */
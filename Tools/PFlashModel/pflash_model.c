@@ -0,0 +1,421 @@
+/**********************************************************************************************************************
+ * \file pflash_model.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Linux host model of the TC37x PFlash banks, the UCB_SWAP area and the address map swap, with an update scenario
+ * running the unmodified Ota_BankSwap and Ota_Installer code against it
+ *
+ * Build:  gcc -O2 -I. -I../.. -o ota_pflash_model pflash_model.c ../../Ota_BankSwap.c ../../Ota_Installer.c
+ * Usage:  ota_pflash_model [<imageSize>]
+ *
+ * The scenario installs two updates while a simulated application keeps executing from the active bank, swaps the
+ * banks through a reset after each one, rolls back with a further UCB entry and finally fills UCB_SWAP. Times are
+ * simulated from the order of magnitude of the data sheet values, they show where the time goes rather than
+ * predicting the target exactly.
+ *********************************************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "PFlashModel.h"
+#include "Flash4_Driver.h"
+#include "Ota_BankSwap.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define MODEL_PFLASH_SIZE          (IFXFLASH_PFLASH_P0_SIZE + IFXFLASH_PFLASH_P1_SIZE)
+#define MODEL_FLASH4_SIZE          0x01000000u
+#define MODEL_SOURCE_ADDRESS       0x00100000u     /* Staged image in Flash4                      */
+#define MODEL_BURST_US             100u            /* PFlash 256 byte burst                       */
+#define MODEL_ERASE_SECTOR_US      20000u          /* PFlash 16 KB logical sector                 */
+#define MODEL_PAGE_US              50u             /* DFlash 8 byte page                          */
+#define MODEL_POLL_US              1u              /* One status register read                    */
+#define MODEL_FLASH4_BYTES_PER_US  6u              /* 50 MHz single SPI                           */
+#define MODEL_APP_STEP_US          200u            /* Application work between two polls          */
+#define MODEL_DEFAULT_IMAGE_SIZE   (0x100000u + 77u)
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+Ifx_STM          MODULE_STM0;
+Ifx_SCU_SWAPCTRL g_pflashModelSwapCtrl;
+
+static uint8            *g_pflash;
+static uint8            *g_ucb;
+static uint8            *g_flash4;
+static uint64            g_time;               /* Microseconds                       */
+static uint64            g_busyUntil[4];       /* Per IfxFlash_FlashType             */
+static Ifx_DMU_HF_STATUS g_status;
+static boolean           g_endinit = TRUE;
+static boolean           g_pageMode;
+static uint32            g_pageWords[IFXFLASH_PFLASH_BURST_LENGTH / 4u];
+static uint32            g_loaded;
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static void fail(const char *message, uint32 address)
+{
+    fprintf(stderr, "model: %s at 0x%08X\n", message, address);
+    exit(2);
+}
+
+static void *mapAt(uint32 address, uint32 size)
+{
+    void *memory = mmap((void *)(uintptr_t)address, size, PROT_READ | PROT_WRITE,
+                        MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (memory != (void *)(uintptr_t)address)
+    {
+        perror("mmap");
+        exit(2);
+    }
+
+    return memory;
+}
+
+static boolean isAlternate(void)
+{
+    return (g_pflashModelSwapCtrl.B.ADDRCFG == OTA_SWAP_ADDRCFG_ALTERNATE) ? TRUE : FALSE;
+}
+
+/* Physical bank behind a CPU address in the current address map */
+static IfxFlash_FlashType bankOf(uint32 address)
+{
+    if (address >= PFLASH_MODEL_UCB_START)
+        return IfxFlash_FlashType_D0;
+
+    if ((address >= IFXFLASH_PFLASH_P1_START) != isAlternate())
+        return IfxFlash_FlashType_P1;
+
+    return IfxFlash_FlashType_P0;
+}
+
+static void startCommand(uint32 address, uint64 duration)
+{
+    IfxFlash_FlashType bank = bankOf(address);
+
+    if (g_endinit)
+        fail("command with safety endinit set", address);
+    if (g_busyUntil[bank] > g_time)
+        fail("command to a busy bank", address);
+
+    g_busyUntil[bank] = g_time + duration;
+    g_pageMode        = FALSE;
+}
+
+static void program(uint32 address, uint32 length)
+{
+    uint8 *memory = (uint8 *)(uintptr_t)address;
+    uint32 i;
+
+    if (!g_pageMode || g_loaded * 4u != length || (address % length) != 0u)
+        fail("program without a complete page", address);
+
+    for (i = 0; i < length; i++)
+    {
+        if (memory[i] != 0u)
+            fail("program of a page that is not erased", address);
+    }
+
+    memcpy(memory, g_pageWords, length);
+}
+
+/* Startup software: the last confirmed set of UCB_SWAP_ORIG selects the map, UCB_SWAP_COPY if ORIG has none */
+static uint32 evaluateUcb(uint32 ucb)
+{
+    uint32 map = 0;
+    uint32 set;
+
+    for (set = 0; set < OTA_SWAP_SET_COUNT; set++)
+    {
+        uint32        address = ucb + set * OTA_SWAP_SET_SIZE;
+        const uint32 *words   = (const uint32 *)(uintptr_t)address;
+
+        if (words[1] == address && words[2] == OTA_SWAP_CONFIRMATION_CODE && words[3] == address + 8u &&
+            (words[0] == OTA_SWAP_MARKER_STANDARD || words[0] == OTA_SWAP_MARKER_ALTERNATE))
+            map = words[0];
+    }
+
+    return map;
+}
+
+/*********************************************************************************************************************/
+/*------------------------------------------------iLLD and Flash4 Model----------------------------------------------*/
+/*********************************************************************************************************************/
+
+Ifx_DMU_HF_STATUS *PFlashModel_status(void)
+{
+    uint32 bank;
+
+    g_time    += MODEL_POLL_US;
+    g_status.U = 0;
+    for (bank = 0; bank < 4u; bank++)
+    {
+        if (g_busyUntil[bank] > g_time)
+            g_status.U |= 1u << bank;
+    }
+
+    return &g_status;
+}
+
+uint8 IfxFlash_enterPageMode(uint32 pageAddr)
+{
+    g_pageMode = TRUE;
+    g_loaded   = 0;
+    return 0;
+}
+
+uint8 IfxFlash_waitUnbusy(uint32 flash, IfxFlash_FlashType flashType)
+{
+    if (g_busyUntil[flashType] > g_time)
+        g_time = g_busyUntil[flashType];
+    return 0;
+}
+
+void IfxFlash_loadPage2X32(uint32 pageAddr, uint32 wordL, uint32 wordU)
+{
+    if (!g_pageMode || g_loaded + 2u > IFXFLASH_PFLASH_BURST_LENGTH / 4u)
+        fail("load page outside page mode", pageAddr);
+
+    g_pageWords[g_loaded++] = wordL;
+    g_pageWords[g_loaded++] = wordU;
+}
+
+void IfxFlash_writeBurst(uint32 pageAddr)
+{
+    program(pageAddr, IFXFLASH_PFLASH_BURST_LENGTH);
+    startCommand(pageAddr, MODEL_BURST_US);
+}
+
+void IfxFlash_writePage(uint32 pageAddr)
+{
+    if (bankOf(pageAddr) != IfxFlash_FlashType_D0)
+        fail("page write outside the UCB", pageAddr);
+
+    program(pageAddr, 8u);
+    startCommand(pageAddr, MODEL_PAGE_US);
+}
+
+void IfxFlash_eraseMultipleSectors(uint32 sectorAddr, uint32 numSector)
+{
+    uint32 offset = sectorAddr - IFXFLASH_PFLASH_P0_START;
+
+    if (sectorAddr < IFXFLASH_PFLASH_P0_START || sectorAddr > IFXFLASH_PFLASH_P1_END || (offset % 0x4000u) != 0u ||
+        numSector == 0u)
+        fail("erase of an invalid sector", sectorAddr);
+    if ((offset % 0x100000u) + numSector * 0x4000u > 0x100000u)
+        fail("erase across a physical sector", sectorAddr);
+
+    memset((void *)(uintptr_t)sectorAddr, 0, numSector * 0x4000u);
+    startCommand(sectorAddr, (uint64)numSector * MODEL_ERASE_SECTOR_US);
+}
+
+uint16 IfxScuWdt_getSafetyWatchdogPasswordInline(void)
+{
+    return 0x3Cu;
+}
+
+void IfxScuWdt_clearSafetyEndinitInline(uint16 password)
+{
+    g_endinit = FALSE;
+}
+
+void IfxScuWdt_setSafetyEndinitInline(uint16 password)
+{
+    g_endinit = TRUE;
+}
+
+uint32 IfxStm_get(Ifx_STM *stm)
+{
+    return (uint32)g_time;
+}
+
+float32 IfxStm_getFrequency(Ifx_STM *stm)
+{
+    return 1000000.0f;
+}
+
+void Flash4_ReadBuffer(uint8 *outData, uint32 addr, uint32 nData)
+{
+    if (addr + nData > MODEL_FLASH4_SIZE)
+        fail("Flash4 read out of range", addr);
+
+    memcpy(outData, &g_flash4[addr], nData);
+    g_time += 2u + nData / MODEL_FLASH4_BYTES_PER_US;
+}
+
+/*********************************************************************************************************************/
+/*--------------------------------------------------Model Control----------------------------------------------------*/
+/*********************************************************************************************************************/
+
+void PFlashModel_Init(void)
+{
+    g_pflash = mapAt(IFXFLASH_PFLASH_P0_START, MODEL_PFLASH_SIZE);
+    g_ucb    = mapAt(PFLASH_MODEL_UCB_START, PFLASH_MODEL_UCB_SIZE);
+    g_flash4 = calloc(MODEL_FLASH4_SIZE, 1);
+
+    /* Erased UCB, unknown content in the PFlash */
+    memset(g_ucb, 0, PFLASH_MODEL_UCB_SIZE);
+    memset(g_pflash, 0xA5, MODEL_PFLASH_SIZE);
+    g_pflashModelSwapCtrl.B.ADDRCFG = 1u;
+}
+
+uint8 *PFlashModel_Flash4(void)
+{
+    return g_flash4;
+}
+
+/* The application fetches code and constants from the lower half, i.e. from its physical bank */
+void PFlashModel_Execute(uint32 microseconds)
+{
+    if (g_busyUntil[bankOf(IFXFLASH_PFLASH_P0_START)] > g_time)
+        fail("application stalled, its bank is busy", IFXFLASH_PFLASH_P0_START);
+
+    g_time += microseconds;
+}
+
+void PFlashModel_Reset(void)
+{
+    uint32  map       = evaluateUcb(OTA_SWAP_UCB_ORIG_ADDRESS);
+    boolean alternate;
+
+    if (map == 0u)
+        map = evaluateUcb(OTA_SWAP_UCB_COPY_ADDRESS);
+    alternate = (map == OTA_SWAP_MARKER_ALTERNATE) ? TRUE : FALSE;
+
+    /* A reset aborts running commands */
+    memset(g_busyUntil, 0, sizeof(g_busyUntil));
+
+    if (alternate != isAlternate())
+    {
+        uint8 *half = malloc(IFXFLASH_PFLASH_P0_SIZE);
+
+        memcpy(half, g_pflash, IFXFLASH_PFLASH_P0_SIZE);
+        memcpy(g_pflash, &g_pflash[IFXFLASH_PFLASH_P0_SIZE], IFXFLASH_PFLASH_P0_SIZE);
+        memcpy(&g_pflash[IFXFLASH_PFLASH_P0_SIZE], half, IFXFLASH_PFLASH_P0_SIZE);
+        free(half);
+    }
+
+    g_pflashModelSwapCtrl.B.ADDRCFG = alternate ? OTA_SWAP_ADDRCFG_ALTERNATE : 1u;
+}
+
+uint64 PFlashModel_Time(void)
+{
+    return g_time;
+}
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Scenario------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+static const char *mapName(Ota_BankMap map)
+{
+    return (map == Ota_BankMap_alternate) ? "alternate" : "standard";
+}
+
+static void randomImage(uint8 *image, uint32 size, uint32 seed)
+{
+    uint32 i;
+
+    srand(seed);
+    for (i = 0; i < size; i++)
+        image[i] = (uint8)rand();
+}
+
+static int update(const char *name, const uint8 *image, uint32 size)
+{
+    static Ota_BankSwap_t swap;
+    uint32 steps = 0;
+    uint64 start, installed;
+
+    memcpy(&g_flash4[MODEL_SOURCE_ADDRESS], image, size);
+
+    if (Ota_BankSwap_Begin(&swap, MODEL_SOURCE_ADDRESS, size, NULL_PTR) != FLASH4_OK)
+    {
+        printf("%s: begin failed\n", name);
+        return 1;
+    }
+
+    /* Application main loop with the update as background job */
+    start = g_time;
+    while (swap.state == Ota_SwapState_installing)
+    {
+        PFlashModel_Execute(MODEL_APP_STEP_US);
+        Ota_BankSwap_Poll(&swap);
+        steps++;
+    }
+    installed = g_time;
+
+    if (swap.state != Ota_SwapState_installed || Ota_BankSwap_Commit(&swap) != FLASH4_OK)
+    {
+        printf("%s: installation failed\n", name);
+        return 1;
+    }
+
+    PFlashModel_Reset();
+
+    printf("%s: %u bytes, %s -> %s map, background install %.1f ms with %u application steps (%.1f ms), "
+           "commit %u us\n", name, size, mapName(swap.map), mapName(Ota_BankSwap_GetMap()),
+           (double)(installed - start) / 1000.0, steps, (double)steps * MODEL_APP_STEP_US / 1000.0,
+           (uint32)(g_time - installed));
+
+    if (Ota_BankSwap_GetMap() == swap.map || memcmp(g_pflash, image, size) != 0)
+    {
+        printf("%s: the new image does not run after the reset\n", name);
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    uint32 size = (argc > 1) ? (uint32)strtoul(argv[1], NULL, 0) : MODEL_DEFAULT_IMAGE_SIZE;
+    uint8 *v2, *v3;
+    uint32 entries;
+    int    errors = 0;
+
+    if (size == 0u || size > IFXFLASH_PFLASH_P1_SIZE || MODEL_SOURCE_ADDRESS + size > MODEL_FLASH4_SIZE)
+    {
+        fprintf(stderr, "usage: %s [<imageSize 1..%u>]\n", argv[0], IFXFLASH_PFLASH_P1_SIZE);
+        return 1;
+    }
+
+    PFlashModel_Init();
+    v2 = malloc(size);
+    v3 = malloc(size);
+    randomImage(v2, size, 2);
+    randomImage(v3, size, 3);
+
+    errors += update("update 1", v2, size);
+    errors += update("update 2", v3, size);
+
+    /* Roll back to the previous image, it is still in the upper half */
+    if (Ota_BankSwap_SelectMap(Ota_BankSwap_GetMap() == Ota_BankMap_standard ? Ota_BankMap_alternate :
+                                                                              Ota_BankMap_standard) != FLASH4_OK)
+        errors++;
+    PFlashModel_Reset();
+    printf("rollback: %s map\n", mapName(Ota_BankSwap_GetMap()));
+    if (memcmp(g_pflash, v2, size) != 0)
+    {
+        printf("rollback: the previous image does not run\n");
+        errors++;
+    }
+
+    /* Every swap uses one set of UCB_SWAP, the 3 above included */
+    for (entries = 3; Ota_BankSwap_SelectMap(Ota_BankMap_standard) == FLASH4_OK; entries++)
+        ;
+    printf("UCB_SWAP full after %u entries\n", entries);
+    if (entries != OTA_SWAP_SET_COUNT)
+        errors++;
+
+    printf(errors == 0 ? "all checks passed\n" : "%d checks failed\n", errors);
+
+    free(v2);
+    free(v3);
+    return (errors == 0) ? 0 : 1;
+}
@@ -0,0 +1,371 @@
+/**********************************************************************************************************************
+ * \file flash4_mkarchive.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Linux host tool building a Flash4 asset archive image (see Flash4_Archive.h for the format)
+ *
+ * Build:  gcc -O2 -o flash4_mkarchive flash4_mkarchive.c
+ * Usage:  flash4_mkarchive <image.bin> <name>=<file> [<name>=<file> ...]
+ *         flash4_mkarchive -l <image.bin>
+ *
+ * A plain <file> argument is stored under its base name. The minimal perfect hash is built with the
+ * hash-and-displace method: names are grouped into buckets of about four, and for each bucket, largest first,
+ * a seed is searched that moves all its names to free slots.
+ *********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define ARCHIVE_MAGIC               0x52413446UL    /* "F4AR" */
+#define ARCHIVE_VERSION             1
+#define ARCHIVE_HEADER_SIZE         32
+#define ARCHIVE_ENTRY_SIZE          16
+#define ARCHIVE_FINGERPRINT_SEED    0xFFFFFFFFUL
+#define ARCHIVE_KEYS_PER_BUCKET     4
+#define ARCHIVE_MAX_SEED            100000000UL
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    const char *name;
+    uint8_t    *data;
+    uint32_t    length;
+    uint32_t    bucket;
+    uint32_t    slot;
+    uint32_t    offset;
+} Asset_t;
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Must match Flash4_Archive_Hash() */
+static uint32_t archiveHash(const char *name, uint32_t seed)
+{
+    uint32_t h = 2166136261UL ^ (uint32_t)(seed * 0x9E3779B9UL);
+
+    while (*name != '\0')
+    {
+        h ^= (uint8_t)*name++;
+        h *= 16777619UL;
+    }
+
+    h ^= h >> 16;
+    h *= 0x85EBCA6BUL;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35UL;
+    h ^= h >> 16;
+
+    return h;
+}
+
+/* Must match Crc16_Calculate() */
+static uint16_t crc16(const uint8_t *data, uint32_t length)
+{
+    uint16_t crc = 0xFFFF;
+    uint32_t i;
+    int      j;
+
+    for (i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (j = 0; j < 8; j++)
+        {
+            crc = (crc & 1u) ? (uint16_t)((crc >> 1) ^ 0xA001u) : (uint16_t)(crc >> 1);
+        }
+    }
+
+    return crc;
+}
+
+static void put16(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static uint32_t get16(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return get16(p) | (get16(p + 2) << 16);
+}
+
+static uint8_t *readFile(const char *path, uint32_t *length)
+{
+    FILE    *file = fopen(path, "rb");
+    uint8_t *data;
+    long     size;
+
+    if (file == NULL)
+        return NULL;
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    data = malloc((size_t)size + 1u);
+    if (data == NULL || fread(data, 1, (size_t)size, file) != (size_t)size)
+    {
+        fclose(file);
+        free(data);
+        return NULL;
+    }
+
+    fclose(file);
+    *length = (uint32_t)size;
+    return data;
+}
+
+/* Search one seed per bucket, largest buckets first, so that all names land on distinct slots */
+static int buildPerfectHash(Asset_t *assets, uint32_t count, uint32_t bucketCount, uint32_t *seeds)
+{
+    uint8_t  *taken   = calloc(count, 1);
+    uint32_t *members = malloc(count * sizeof(uint32_t));
+    uint32_t *order   = malloc(bucketCount * sizeof(uint32_t));
+    uint32_t *sizes   = calloc(bucketCount, sizeof(uint32_t));
+    uint32_t  b, i, k;
+    int       ok = 1;
+
+    for (i = 0; i < count; i++)
+        sizes[assets[i].bucket]++;
+
+    for (b = 0; b < bucketCount; b++)
+        order[b] = b;
+
+    for (b = 1; b < bucketCount; b++)
+    {
+        uint32_t v = order[b];
+
+        for (k = b; k > 0 && sizes[order[k - 1]] < sizes[v]; k--)
+            order[k] = order[k - 1];
+        order[k] = v;
+    }
+
+    for (b = 0; b < bucketCount && ok; b++)
+    {
+        uint32_t bucket = order[b];
+        uint32_t n      = 0;
+        uint32_t seed;
+
+        for (i = 0; i < count; i++)
+        {
+            if (assets[i].bucket == bucket)
+                members[n++] = i;
+        }
+
+        if (n == 0)
+        {
+            seeds[bucket] = 1;
+            continue;
+        }
+
+        for (seed = 1; seed < ARCHIVE_MAX_SEED; seed++)
+        {
+            int fits = 1;
+
+            for (i = 0; i < n && fits; i++)
+            {
+                uint32_t slot = archiveHash(assets[members[i]].name, seed) % count;
+
+                assets[members[i]].slot = slot;
+                if (taken[slot])
+                    fits = 0;
+                for (k = 0; k < i && fits; k++)
+                {
+                    if (assets[members[k]].slot == slot)
+                        fits = 0;
+                }
+            }
+
+            if (fits)
+                break;
+        }
+
+        if (seed == ARCHIVE_MAX_SEED)
+        {
+            ok = 0;
+            break;
+        }
+
+        seeds[bucket] = seed;
+        for (i = 0; i < n; i++)
+            taken[assets[members[i]].slot] = 1;
+    }
+
+    free(taken);
+    free(members);
+    free(order);
+    free(sizes);
+    return ok;
+}
+
+static int listArchive(const char *path)
+{
+    uint32_t length;
+    uint8_t *image = readFile(path, &length);
+    uint32_t count, bucketCount, entryOffset, i;
+
+    if (image == NULL || length < ARCHIVE_HEADER_SIZE || get32(image) != ARCHIVE_MAGIC)
+    {
+        fprintf(stderr, "%s: not an archive image\n", path);
+        return 1;
+    }
+
+    count       = get32(&image[8]);
+    bucketCount = get32(&image[12]);
+    entryOffset = get32(&image[20]);
+    printf("%u assets, %u buckets, %u bytes\n", count, bucketCount, get32(&image[24]));
+
+    for (i = 0; i < count; i++)
+    {
+        const uint8_t *entry = &image[entryOffset + i * ARCHIVE_ENTRY_SIZE];
+
+        printf("slot %4u  fingerprint %08X  offset %8u  length %8u  crc %04X\n", i, get32(entry), get32(&entry[4]),
+               get32(&entry[8]), get16(&entry[12]));
+    }
+
+    free(image);
+    return 0;
+}
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------------Main--------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv)
+{
+    Asset_t  *assets;
+    uint32_t *seeds;
+    uint8_t  *image;
+    uint32_t  count, bucketCount, seedOffset, entryOffset, dataOffset, imageSize;
+    uint32_t  i, k;
+    FILE     *out;
+
+    if (argc == 3 && strcmp(argv[1], "-l") == 0)
+        return listArchive(argv[2]);
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <image.bin> <name>=<file> ...\n       %s -l <image.bin>\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    count       = (uint32_t)(argc - 2);
+    bucketCount = (count + ARCHIVE_KEYS_PER_BUCKET - 1u) / ARCHIVE_KEYS_PER_BUCKET;
+    if (bucketCount == 0u)
+        bucketCount = 1u;
+
+    assets = calloc(count + 1u, sizeof(Asset_t));
+    seeds  = calloc(bucketCount, sizeof(uint32_t));
+
+    for (i = 0; i < count; i++)
+    {
+        char       *arg       = argv[i + 2];
+        char       *separator = strchr(arg, '=');
+        const char *path      = arg;
+
+        if (separator != NULL)
+        {
+            *separator     = '\0';
+            assets[i].name = arg;
+            path           = separator + 1;
+        }
+        else
+        {
+            const char *slash = strrchr(arg, '/');
+            assets[i].name    = (slash != NULL) ? slash + 1 : arg;
+        }
+
+        assets[i].data = readFile(path, &assets[i].length);
+        if (assets[i].data == NULL)
+        {
+            fprintf(stderr, "cannot read %s\n", path);
+            return 1;
+        }
+
+        for (k = 0; k < i; k++)
+        {
+            if (strcmp(assets[k].name, assets[i].name) == 0)
+            {
+                fprintf(stderr, "duplicate name %s\n", assets[i].name);
+                return 1;
+            }
+        }
+
+        assets[i].bucket = archiveHash(assets[i].name, 0u) % bucketCount;
+    }
+
+    if (count > 0u && !buildPerfectHash(assets, count, bucketCount, seeds))
+    {
+        fprintf(stderr, "no perfect hash found\n");
+        return 1;
+    }
+
+    /* Layout: header, seeds, entries, 4 byte aligned data */
+    seedOffset  = ARCHIVE_HEADER_SIZE;
+    entryOffset = seedOffset + bucketCount * 4u;
+    dataOffset  = entryOffset + count * ARCHIVE_ENTRY_SIZE;
+    imageSize   = dataOffset;
+    for (i = 0; i < count; i++)
+    {
+        assets[i].offset = imageSize;
+        imageSize       += (assets[i].length + 3u) & ~3u;
+    }
+
+    image = calloc(imageSize, 1);
+    for (i = 0; i < bucketCount; i++)
+        put32(&image[seedOffset + i * 4u], seeds[i]);
+
+    for (i = 0; i < count; i++)
+    {
+        uint8_t *entry = &image[entryOffset + assets[i].slot * ARCHIVE_ENTRY_SIZE];
+
+        put32(&entry[0], archiveHash(assets[i].name, ARCHIVE_FINGERPRINT_SEED));
+        put32(&entry[4], assets[i].offset);
+        put32(&entry[8], assets[i].length);
+        put16(&entry[12], crc16(assets[i].data, assets[i].length));
+        put16(&entry[14], 0);
+        memcpy(&image[assets[i].offset], assets[i].data, assets[i].length);
+    }
+
+    put32(&image[0], ARCHIVE_MAGIC);
+    put16(&image[4], ARCHIVE_VERSION);
+    put16(&image[6], ARCHIVE_HEADER_SIZE);
+    put32(&image[8], count);
+    put32(&image[12], bucketCount);
+    put32(&image[16], seedOffset);
+    put32(&image[20], entryOffset);
+    put32(&image[24], imageSize);
+    put16(&image[28], crc16(&image[seedOffset], dataOffset - seedOffset));
+    put16(&image[30], 0);
+    put16(&image[30], crc16(image, ARCHIVE_HEADER_SIZE));
+
+    out = fopen(argv[1], "wb");
+    if (out == NULL || fwrite(image, 1, imageSize, out) != imageSize)
+    {
+        fprintf(stderr, "cannot write %s\n", argv[1]);
+        return 1;
+    }
+    fclose(out);
+
+    printf("%s: %u assets, %u buckets, index %u bytes, image %u bytes\n", argv[1], count, bucketCount,
+           dataOffset - seedOffset, imageSize);
+    return 0;
+}
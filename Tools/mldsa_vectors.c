@@ -0,0 +1,162 @@
+/**********************************************************************************************************************
+ * \file mldsa_vectors.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Linux host tool generating the ML-DSA known answer vectors of the crypto benchmark (MlDsa_TestVectors.h)
+ *
+ * Build:  gcc -O2 -o mldsa_vectors mldsa_vectors.c -lcrypto          (OpenSSL 3.5 or later)
+ * Usage:  mldsa_vectors <MlDsa_TestVectors.h>
+ *
+ * For ML-DSA-44 and ML-DSA-65 the key pair is derived from the seed 00 01 .. 1F and the message is signed with the
+ * deterministic variant of FIPS 204 under the context string below, so the output does not change between runs.
+ * The signatures come from OpenSSL and are an independent check of MlDsa.c. Every signature is verified again
+ * before it is written.
+ *********************************************************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include <openssl/evp.h>
+#include <openssl/params.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define SEED_SIZE                   32
+#define MAX_PUBLIC_KEY_SIZE         1952
+#define MAX_SIGNATURE_SIZE          3309
+#define VECTOR_MESSAGE              "FIPS 204 known answer test"
+#define VECTOR_CONTEXT              "crypto_bench"
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static void writeArray(FILE *out, const char *name, const char *size, const unsigned char *data, size_t length)
+{
+    size_t i;
+
+    fprintf(out, "static const uint8 %s[%s] = {\n", name, size);
+    for (i = 0; i < length; i++)
+        fprintf(out, "%s0x%02X%s", (i % 16u == 0u) ? "    " : "", data[i],
+                (i + 1u == length) ? "\n" : ((i % 16u == 15u) ? ",\n" : ", "));
+    fputs("};\n", out);
+}
+
+/* Key pair from the seed, deterministic signature of the message; 0 on success */
+static int generate(const char *algorithm, unsigned char *publicKey, size_t *publicKeyLength, unsigned char *signature,
+                    size_t *signatureLength)
+{
+    unsigned char  seed[SEED_SIZE];
+    int            deterministic = 1;
+    EVP_PKEY_CTX  *ctx;
+    EVP_PKEY      *key = NULL;
+    EVP_SIGNATURE *sig;
+    OSSL_PARAM     keyParams[2];
+    OSSL_PARAM     signParams[3];
+    int            i;
+    int            ok;
+
+    for (i = 0; i < SEED_SIZE; i++)
+        seed[i] = (unsigned char)i;
+    keyParams[0]  = OSSL_PARAM_construct_octet_string("seed", seed, sizeof(seed));
+    keyParams[1]  = OSSL_PARAM_construct_end();
+    signParams[0] = OSSL_PARAM_construct_octet_string("context-string", VECTOR_CONTEXT, strlen(VECTOR_CONTEXT));
+    signParams[1] = OSSL_PARAM_construct_int("deterministic", &deterministic);
+    signParams[2] = OSSL_PARAM_construct_end();
+
+    ctx = EVP_PKEY_CTX_new_from_name(NULL, algorithm, NULL);
+    ok  = ctx != NULL && EVP_PKEY_fromdata_init(ctx) > 0 &&
+          EVP_PKEY_fromdata(ctx, &key, EVP_PKEY_KEYPAIR, keyParams) > 0;
+    EVP_PKEY_CTX_free(ctx);
+    if (!ok)
+        return 1;
+
+    sig = EVP_SIGNATURE_fetch(NULL, algorithm, NULL);
+    ctx = EVP_PKEY_CTX_new_from_pkey(NULL, key, NULL);
+    ok  = EVP_PKEY_get_octet_string_param(key, "pub", publicKey, MAX_PUBLIC_KEY_SIZE, publicKeyLength) > 0 &&
+          sig != NULL && ctx != NULL && EVP_PKEY_sign_message_init(ctx, sig, signParams) > 0 &&
+          EVP_PKEY_sign(ctx, signature, signatureLength, (const unsigned char *)VECTOR_MESSAGE,
+                        strlen(VECTOR_MESSAGE)) > 0;
+
+    /* Check the signature before it becomes a known answer */
+    ok = ok && EVP_PKEY_verify_message_init(ctx, sig, signParams) > 0 &&
+         EVP_PKEY_verify(ctx, signature, *signatureLength, (const unsigned char *)VECTOR_MESSAGE,
+                         strlen(VECTOR_MESSAGE)) > 0;
+
+    EVP_PKEY_CTX_free(ctx);
+    EVP_SIGNATURE_free(sig);
+    EVP_PKEY_free(key);
+
+    return ok ? 0 : 1;
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv)
+{
+    static const char *const algorithms[2] = {"ML-DSA-44", "ML-DSA-65"};
+    static const char *const prefixes[2]   = {"g_mlDsa44", "g_mlDsa65"};
+    static const char *const sizes[2][2]   = {{"MLDSA44_PUBLIC_KEY_SIZE", "MLDSA44_SIGNATURE_SIZE"},
+                                              {"MLDSA65_PUBLIC_KEY_SIZE", "MLDSA65_SIGNATURE_SIZE"}};
+    static unsigned char publicKey[MAX_PUBLIC_KEY_SIZE];
+    static unsigned char signature[MAX_SIGNATURE_SIZE];
+    char   name[32];
+    size_t publicKeyLength;
+    size_t signatureLength;
+    FILE  *out;
+    int    level;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <MlDsa_TestVectors.h>\n", argv[0]);
+        return 1;
+    }
+
+    out = fopen(argv[1], "w");
+    if (out == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fputs("/*****************************************************************************************************"
+          "*****************\n"
+          " * \\file MlDsa_TestVectors.h\n"
+          " * \\copyright Copyright (C) Infineon Technologies AG 2019\n"
+          " *\n"
+          " * ML-DSA known answer vectors of the crypto benchmark, generated by Tools/mldsa_vectors.c, do not edit\n"
+          " * Key pairs from the seed 00 01 .. 1F, deterministic FIPS 204 signatures of MLDSA_VECTOR_MESSAGE under "
+          "the\n"
+          " * context string MLDSA_VECTOR_CONTEXT, computed with OpenSSL.\n"
+          " ****************************************************************************************************"
+          "*****************/\n\n"
+          "#ifndef MLDSA_TESTVECTORS_H_\n"
+          "#define MLDSA_TESTVECTORS_H_\n\n", out);
+    fprintf(out, "#define MLDSA_VECTOR_MESSAGE        \"%s\"\n", VECTOR_MESSAGE);
+    fprintf(out, "#define MLDSA_VECTOR_CONTEXT        \"%s\"\n", VECTOR_CONTEXT);
+
+    for (level = 0; level < 2; level++)
+    {
+        publicKeyLength = 0;
+        signatureLength = sizeof(signature);
+        if (generate(algorithms[level], publicKey, &publicKeyLength, signature, &signatureLength) != 0)
+        {
+            fprintf(stderr, "%s: key generation or signing failed\n", algorithms[level]);
+            fclose(out);
+            return 1;
+        }
+
+        fprintf(out, "\n/* %s */\n", algorithms[level]);
+        snprintf(name, sizeof(name), "%sPublicKey", prefixes[level]);
+        writeArray(out, name, sizes[level][0], publicKey, publicKeyLength);
+        snprintf(name, sizeof(name), "%sSignature", prefixes[level]);
+        writeArray(out, name, sizes[level][1], signature, signatureLength);
+    }
+
+    fputs("\n#endif /* MLDSA_TESTVECTORS_H_ */\n", out);
+    fclose(out);
+
+    return 0;
+}
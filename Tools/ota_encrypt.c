@@ -0,0 +1,279 @@
+/**********************************************************************************************************************
+ * \file ota_encrypt.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Linux host tool encrypting OTA payloads for the streaming AES-GCM decryptor (see Ota_Gcm.h for the format)
+ *
+ * Build:  gcc -O2 -o ota_encrypt ota_encrypt.c -lcrypto
+ * Usage:  ota_encrypt [-c <chunkSize>] <key.bin> <input> <output.gcm>    encrypt, chunks of 768 bytes by default
+ *         ota_encrypt -d <key.bin> <input.gcm> <output>                   decrypt and check every tag
+ *
+ * The key file holds the raw 16 or 32 byte AES key. The nonce is taken from /dev/urandom, so a key may encrypt
+ * many images; the chunk index completes it to the 12 byte IV. Encryption uses OpenSSL as an independent check of
+ * the AES-GCM implementation on the target.
+ *********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <openssl/evp.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define GCM_MAGIC                   0x43473446UL    /* "F4GC" */
+#define GCM_VERSION                 1
+#define GCM_HEADER_SIZE             20
+#define GCM_NONCE_SIZE              8
+#define GCM_IV_SIZE                 12
+#define GCM_TAG_SIZE                16
+#define GCM_DEFAULT_CHUNK_SIZE      768             /* OTA_GCM_MAX_CHUNK_SIZE of the target */
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static void put16(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static uint32_t get16(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return get16(p) | (get16(p + 2) << 16);
+}
+
+static uint8_t *readFile(const char *path, uint32_t *length)
+{
+    FILE    *file = fopen(path, "rb");
+    uint8_t *data;
+    long     size;
+
+    if (file == NULL)
+        return NULL;
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    data = malloc((size_t)size + 1u);
+    if (data == NULL || fread(data, 1, (size_t)size, file) != (size_t)size)
+    {
+        fclose(file);
+        free(data);
+        return NULL;
+    }
+
+    fclose(file);
+    *length = (uint32_t)size;
+    return data;
+}
+
+static int writeFile(const char *path, const uint8_t *data, uint32_t length)
+{
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL || fwrite(data, 1, length, file) != length)
+    {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 0;
+    }
+
+    fclose(file);
+    return 1;
+}
+
+static const EVP_CIPHER *cipherForKey(uint32_t keyLength)
+{
+    return (keyLength == 16u) ? EVP_aes_128_gcm() : (keyLength == 32u) ? EVP_aes_256_gcm() : NULL;
+}
+
+/* One chunk: IV = nonce || index (big endian), header as additional data. Returns 0 if the tag does not match. */
+static int cryptChunk(const uint8_t *key, uint32_t keyLength, const uint8_t *header, uint32_t index,
+                      const uint8_t *in, uint32_t length, uint8_t *out, uint8_t *tag, int encrypt)
+{
+    EVP_CIPHER_CTX *ctx = EVP_CIPHER_CTX_new();
+    uint8_t         iv[GCM_IV_SIZE];
+    int             n;
+    int             ok;
+
+    memcpy(iv, &header[12], GCM_NONCE_SIZE);
+    iv[8]  = (uint8_t)(index >> 24);
+    iv[9]  = (uint8_t)(index >> 16);
+    iv[10] = (uint8_t)(index >> 8);
+    iv[11] = (uint8_t)index;
+
+    ok = EVP_CipherInit_ex(ctx, cipherForKey(keyLength), NULL, key, iv, encrypt) &&
+         EVP_CipherUpdate(ctx, NULL, &n, header, GCM_HEADER_SIZE) &&
+         EVP_CipherUpdate(ctx, out, &n, in, (int)length);
+
+    if (ok && encrypt)
+    {
+        ok = EVP_CipherFinal_ex(ctx, out + n, &n) &&
+             EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, GCM_TAG_SIZE, tag);
+    }
+    else if (ok)
+    {
+        ok = EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, GCM_TAG_SIZE, tag) &&
+             EVP_CipherFinal_ex(ctx, out + n, &n) > 0;
+    }
+
+    EVP_CIPHER_CTX_free(ctx);
+    return ok;
+}
+
+static int encryptImage(const uint8_t *key, uint32_t keyLength, const uint8_t *in, uint32_t length,
+                        uint32_t chunkSize, const char *outPath)
+{
+    uint32_t chunks = (length + chunkSize - 1u) / chunkSize;
+    uint32_t size   = GCM_HEADER_SIZE + length + chunks * GCM_TAG_SIZE;
+    uint8_t *out    = malloc(size);
+    uint8_t *p      = out + GCM_HEADER_SIZE;
+    FILE    *random = fopen("/dev/urandom", "rb");
+    uint32_t i;
+
+    put32(&out[0], GCM_MAGIC);
+    out[4] = GCM_VERSION;
+    out[5] = 0;
+    put16(&out[6], chunkSize);
+    put32(&out[8], length);
+
+    if (random == NULL || fread(&out[12], 1, GCM_NONCE_SIZE, random) != GCM_NONCE_SIZE)
+    {
+        fprintf(stderr, "cannot read /dev/urandom\n");
+        return 1;
+    }
+    fclose(random);
+
+    for (i = 0; i < chunks; i++)
+    {
+        uint32_t n = (length - i * chunkSize < chunkSize) ? length - i * chunkSize : chunkSize;
+
+        if (!cryptChunk(key, keyLength, out, i, &in[i * chunkSize], n, p, p + n, 1))
+        {
+            fprintf(stderr, "encryption failed\n");
+            return 1;
+        }
+        p += n + GCM_TAG_SIZE;
+    }
+
+    if (!writeFile(outPath, out, size))
+        return 1;
+
+    printf("%s: %u -> %u bytes, %u chunks of %u bytes\n", outPath, length, size, chunks, chunkSize);
+    return 0;
+}
+
+static int decryptImage(const uint8_t *key, uint32_t keyLength, const uint8_t *in, uint32_t length,
+                        const char *outPath)
+{
+    uint32_t chunkSize = (length >= GCM_HEADER_SIZE) ? get16(&in[6]) : 0u;
+    uint32_t size      = (length >= GCM_HEADER_SIZE) ? get32(&in[8]) : 0u;
+    uint8_t *out       = malloc(size + 1u);
+    uint32_t position  = GCM_HEADER_SIZE;
+    uint32_t done      = 0;
+    uint32_t i;
+
+    if (length < GCM_HEADER_SIZE || get32(&in[0]) != GCM_MAGIC || in[4] != GCM_VERSION || chunkSize == 0u)
+    {
+        fprintf(stderr, "invalid header\n");
+        return 1;
+    }
+
+    for (i = 0; done < size; i++)
+    {
+        uint32_t n = (size - done < chunkSize) ? size - done : chunkSize;
+
+        if (position + n + GCM_TAG_SIZE > length)
+        {
+            fprintf(stderr, "stream truncated in chunk %u\n", i);
+            return 1;
+        }
+        if (!cryptChunk(key, keyLength, in, i, &in[position], n, &out[done], (uint8_t *)&in[position + n], 0))
+        {
+            fprintf(stderr, "tag mismatch in chunk %u\n", i);
+            return 1;
+        }
+        position += n + GCM_TAG_SIZE;
+        done     += n;
+    }
+
+    return writeFile(outPath, out, size) ? 0 : 1;
+}
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Function Implementations---------------------------------------------*/
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv)
+{
+    uint32_t chunkSize = GCM_DEFAULT_CHUNK_SIZE;
+    uint32_t keyLength;
+    uint32_t length;
+    uint8_t *key;
+    uint8_t *in;
+    int      decrypt = 0;
+    int      arg     = 1;
+
+    while (arg < argc && argv[arg][0] == '-')
+    {
+        if (strcmp(argv[arg], "-c") == 0 && arg + 1 < argc)
+        {
+            chunkSize = (uint32_t)atoi(argv[++arg]);
+        }
+        else if (strcmp(argv[arg], "-d") == 0)
+        {
+            decrypt = 1;
+        }
+        else
+        {
+            break;
+        }
+        arg++;
+    }
+
+    if (chunkSize == 0u || chunkSize > GCM_DEFAULT_CHUNK_SIZE || argc - arg != 3)
+    {
+        fprintf(stderr, "usage: %s [-c <chunkSize>] <key.bin> <input> <output.gcm>\n"
+                        "       %s -d <key.bin> <input.gcm> <output>\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    key = readFile(argv[arg], &keyLength);
+    if (key == NULL || cipherForKey(keyLength) == NULL)
+    {
+        fprintf(stderr, "%s: expected a 16 or 32 byte key\n", argv[arg]);
+        return 1;
+    }
+
+    in = readFile(argv[arg + 1], &length);
+    if (in == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", argv[arg + 1]);
+        return 1;
+    }
+
+    if (!decrypt && length == 0u)
+    {
+        fprintf(stderr, "%s is empty\n", argv[arg + 1]);
+        return 1;
+    }
+
+    if (decrypt)
+        return decryptImage(key, keyLength, in, length, argv[arg + 2]);
+
+    return encryptImage(key, keyLength, in, length, chunkSize, argv[arg + 2]);
+}
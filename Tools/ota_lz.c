@@ -0,0 +1,481 @@
+/**********************************************************************************************************************
+ * \file ota_lz.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Linux host tool compressing OTA payloads for the streaming decompressor (see Ota_Lz.h for the format)
+ *
+ * Build:  gcc -O2 -o ota_lz ota_lz.c
+ * Usage:  ota_lz [-w <bits>] <input> <output.lz>     compress, window 2^bits (9..15, default 12)
+ *         ota_lz -d <input.lz> <output>               decompress
+ *         ota_lz -b [-w <bits>] <input>               compression ratio and host decode speed
+ *
+ * Matches are searched through hash chains over 4 byte strings with one step of lazy evaluation. The window must
+ * not exceed OTA_LZ_WINDOW_BITS of the target, which rejects streams with a larger one.
+ *********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define LZ_MAGIC                    0x5A4C3446UL    /* "F4LZ" */
+#define LZ_VERSION                  1
+#define LZ_HEADER_SIZE              20
+#define LZ_MIN_MATCH                4
+#define LZ_HASH_BITS                16
+#define LZ_MAX_CHAIN                256
+#define LZ_DEFAULT_WINDOW_BITS      12
+#define LZ_BENCHMARK_ROUNDS         20
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint8_t *data;
+    uint32_t length;
+    uint32_t capacity;
+} Buffer_t;
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Must match Crc16_Calculate() */
+static uint16_t crc16(const uint8_t *data, uint32_t length)
+{
+    uint16_t crc = 0xFFFF;
+    uint32_t i;
+    int      j;
+
+    for (i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (j = 0; j < 8; j++)
+        {
+            crc = (crc & 1u) ? (uint16_t)((crc >> 1) ^ 0xA001u) : (uint16_t)(crc >> 1);
+        }
+    }
+
+    return crc;
+}
+
+static void put16(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static uint32_t get16(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return get16(p) | (get16(p + 2) << 16);
+}
+
+static uint8_t *readFile(const char *path, uint32_t *length)
+{
+    FILE    *file = fopen(path, "rb");
+    uint8_t *data;
+    long     size;
+
+    if (file == NULL)
+        return NULL;
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    data = malloc((size_t)size + 1u);
+    if (data == NULL || fread(data, 1, (size_t)size, file) != (size_t)size)
+    {
+        fclose(file);
+        free(data);
+        return NULL;
+    }
+
+    fclose(file);
+    *length = (uint32_t)size;
+    return data;
+}
+
+static int writeFile(const char *path, const uint8_t *data, uint32_t length)
+{
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL || fwrite(data, 1, length, file) != length)
+    {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 0;
+    }
+
+    fclose(file);
+    return 1;
+}
+
+static void emit(Buffer_t *buffer, const uint8_t *data, uint32_t length)
+{
+    if (buffer->length + length > buffer->capacity)
+    {
+        buffer->capacity = (buffer->length + length) * 2u + 256u;
+        buffer->data     = realloc(buffer->data, buffer->capacity);
+    }
+
+    memcpy(&buffer->data[buffer->length], data, length);
+    buffer->length += length;
+}
+
+static void emitLength(Buffer_t *buffer, uint32_t length)
+{
+    uint8_t byte = 255;
+
+    while (length >= 255u)
+    {
+        emit(buffer, &byte, 1);
+        length -= 255u;
+    }
+
+    byte = (uint8_t)length;
+    emit(buffer, &byte, 1);
+}
+
+static void emitSequence(Buffer_t *out, const uint8_t *literals, uint32_t literalLength, uint32_t offset,
+                         uint32_t matchLength)
+{
+    uint32_t matchCode = (matchLength >= LZ_MIN_MATCH) ? matchLength - LZ_MIN_MATCH : 0u;
+    uint8_t  token     = (uint8_t)(((literalLength < 15u) ? literalLength : 15u) << 4);
+    uint8_t  bytes[2];
+
+    if (matchLength >= LZ_MIN_MATCH)
+        token |= (uint8_t)((matchCode < 15u) ? matchCode : 15u);
+
+    emit(out, &token, 1);
+    if (literalLength >= 15u)
+        emitLength(out, literalLength - 15u);
+    emit(out, literals, literalLength);
+
+    if (matchLength >= LZ_MIN_MATCH)
+    {
+        put16(bytes, offset);
+        emit(out, bytes, 2);
+        if (matchCode >= 15u)
+            emitLength(out, matchCode - 15u);
+    }
+}
+
+static uint32_t hash4(const uint8_t *p)
+{
+    uint32_t v = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+
+    return (uint32_t)(v * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+static uint32_t findMatch(const uint8_t *in, uint32_t length, uint32_t position, const uint32_t *head,
+                          const uint32_t *chain, uint32_t window, uint32_t *offset)
+{
+    uint32_t best      = 0;
+    uint32_t candidate;
+    uint32_t steps     = 0;
+
+    if (position + LZ_MIN_MATCH > length)
+        return 0;
+
+    candidate = head[hash4(&in[position])];
+    while (candidate != UINT32_MAX && position - candidate <= window && steps++ < LZ_MAX_CHAIN)
+    {
+        uint32_t n = 0;
+
+        while (position + n < length && in[candidate + n] == in[position + n])
+            n++;
+
+        if (n > best)
+        {
+            best    = n;
+            *offset = position - candidate;
+        }
+        candidate = chain[candidate];
+    }
+
+    return (best >= LZ_MIN_MATCH) ? best : 0u;
+}
+
+static Buffer_t compress(const uint8_t *in, uint32_t length, uint32_t windowBits)
+{
+    Buffer_t  out     = {NULL, 0, 0};
+    uint32_t *head    = malloc(sizeof(uint32_t) << LZ_HASH_BITS);
+    uint32_t *chain   = malloc((length + 1u) * sizeof(uint32_t));
+    uint32_t  window  = 1u << windowBits;
+    uint32_t  literal = 0;
+    uint32_t  inserted = 0;
+    uint32_t  p       = 0;
+    uint8_t   header[LZ_HEADER_SIZE] = {0};
+
+    memset(head, 0xFF, sizeof(uint32_t) << LZ_HASH_BITS);
+    emit(&out, header, LZ_HEADER_SIZE);
+
+    while (p < length)
+    {
+        uint32_t offset = 0, nextOffset = 0;
+        uint32_t matchLength, nextLength;
+
+        /* Insert all positions up to p into the hash chains */
+        for (; inserted < p && inserted + LZ_MIN_MATCH <= length; inserted++)
+        {
+            uint32_t h = hash4(&in[inserted]);
+
+            chain[inserted] = head[h];
+            head[h]         = inserted;
+        }
+
+        matchLength = findMatch(in, length, p, head, chain, window, &offset);
+        if (matchLength == 0u)
+        {
+            p++;
+            continue;
+        }
+
+        /* Lazy evaluation: a longer match one byte later wins */
+        if (p + 1u + LZ_MIN_MATCH <= length)
+        {
+            uint32_t h = hash4(&in[p]);
+
+            if (inserted == p)
+            {
+                chain[p] = head[h];
+                head[h]  = p;
+                inserted = p + 1u;
+            }
+            nextLength = findMatch(in, length, p + 1u, head, chain, window, &nextOffset);
+            if (nextLength > matchLength + 1u)
+            {
+                p++;
+                continue;
+            }
+        }
+
+        emitSequence(&out, &in[literal], p - literal, offset, matchLength);
+        p      += matchLength;
+        literal = p;
+    }
+
+    /* Last sequence: literals only */
+    emitSequence(&out, &in[literal], length - literal, 0, 0);
+
+    put32(&out.data[0], LZ_MAGIC);
+    out.data[4] = LZ_VERSION;
+    out.data[5] = (uint8_t)windowBits;
+    put16(&out.data[6], 0);
+    put32(&out.data[8], length);
+    put32(&out.data[12], out.length);
+    put16(&out.data[16], crc16(in, length));
+    put16(&out.data[18], crc16(out.data, LZ_HEADER_SIZE));
+
+    free(head);
+    free(chain);
+    return out;
+}
+
+static uint32_t readLength(const uint8_t *in, uint32_t length, uint32_t *position)
+{
+    uint32_t sum = 0;
+    uint8_t  byte;
+
+    do
+    {
+        if (*position >= length)
+            return UINT32_MAX;
+        byte = in[(*position)++];
+        sum += byte;
+    } while (byte == 255u);
+
+    return sum;
+}
+
+/* Reference decoder, returns the decompressed length or -1 */
+static int64_t decompress(const uint8_t *in, uint32_t length, uint8_t *out, uint32_t capacity)
+{
+    uint32_t position = LZ_HEADER_SIZE;
+    uint32_t produced = 0;
+    uint32_t size;
+
+    if (length < LZ_HEADER_SIZE || get32(in) != LZ_MAGIC)
+        return -1;
+
+    size = get32(&in[8]);
+    if (size > capacity)
+        return -1;
+
+    while (position < length)
+    {
+        uint8_t  token         = in[position++];
+        uint32_t literalLength = token >> 4;
+        uint32_t matchLength   = (token & 0x0Fu) + LZ_MIN_MATCH;
+        uint32_t offset, i;
+
+        if (literalLength == 15u)
+            literalLength += readLength(in, length, &position);
+        if (literalLength > size - produced || literalLength > length - position)
+            return -1;
+
+        memcpy(&out[produced], &in[position], literalLength);
+        position += literalLength;
+        produced += literalLength;
+        if (produced == size)
+            break;
+
+        if (position + 2u > length)
+            return -1;
+        offset    = get16(&in[position]);
+        position += 2u;
+        if (matchLength == 15u + LZ_MIN_MATCH)
+            matchLength += readLength(in, length, &position);
+        if (offset == 0u || offset > produced || matchLength > size - produced)
+            return -1;
+
+        if (offset >= matchLength)
+            memcpy(&out[produced], &out[produced - offset], matchLength);
+        else
+            for (i = 0; i < matchLength; i++)
+                out[produced + i] = out[produced + i - offset];
+        produced += matchLength;
+    }
+
+    if (produced != size || crc16(out, size) != get16(&in[16]))
+        return -1;
+
+    return size;
+}
+
+static double seconds(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec * 1e-9;
+}
+
+static int benchmark(const uint8_t *in, uint32_t length, uint32_t windowBits)
+{
+    Buffer_t packed = compress(in, length, windowBits);
+    uint8_t *out    = malloc(length + 1u);
+    double   start;
+    double   elapsed;
+    int      round;
+
+    start = seconds();
+    for (round = 0; round < LZ_BENCHMARK_ROUNDS; round++)
+    {
+        if (decompress(packed.data, packed.length, out, length) != (int64_t)length)
+        {
+            fprintf(stderr, "internal error: round trip failed\n");
+            return 1;
+        }
+    }
+    elapsed = seconds() - start;
+
+    printf("%u -> %u bytes (%.1f%%), window %u bytes\n", length, packed.length, 100.0 * packed.length / length,
+           1u << windowBits);
+    printf("host decode: %.1f MB/s, %.2f ns/byte\n", (double)length * LZ_BENCHMARK_ROUNDS / elapsed / 1e6,
+           elapsed * 1e9 / ((double)length * LZ_BENCHMARK_ROUNDS));
+    printf("target cycles per byte: run Example14_DecompressBenchmark() on the TC375\n");
+    return 0;
+}
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------------Main--------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv)
+{
+    uint32_t windowBits = LZ_DEFAULT_WINDOW_BITS;
+    uint32_t length;
+    uint8_t *in;
+    int      mode = 'c';
+    int      arg  = 1;
+
+    while (arg < argc && argv[arg][0] == '-')
+    {
+        if (strcmp(argv[arg], "-w") == 0 && arg + 1 < argc)
+        {
+            windowBits = (uint32_t)atoi(argv[++arg]);
+        }
+        else if (strcmp(argv[arg], "-d") == 0 || strcmp(argv[arg], "-b") == 0)
+        {
+            mode = argv[arg][1];
+        }
+        else
+        {
+            break;
+        }
+        arg++;
+    }
+
+    if (windowBits < 9u || windowBits > 15u || argc - arg != ((mode == 'b') ? 1 : 2))
+    {
+        fprintf(stderr, "usage: %s [-w <bits>] <input> <output.lz>\n       %s -d <input.lz> <output>\n"
+                        "       %s -b [-w <bits>] <input>\n", argv[0], argv[0], argv[0]);
+        return 1;
+    }
+
+    in = readFile(argv[arg], &length);
+    if (in == NULL)
+    {
+        fprintf(stderr, "cannot read %s\n", argv[arg]);
+        return 1;
+    }
+
+    if (mode != 'd' && length == 0u)
+    {
+        fprintf(stderr, "%s is empty\n", argv[arg]);
+        return 1;
+    }
+
+    if (mode == 'b')
+        return benchmark(in, length, windowBits);
+
+    if (mode == 'd')
+    {
+        uint32_t size = (length >= LZ_HEADER_SIZE) ? get32(&in[8]) : 0u;
+        uint8_t *out  = malloc(size + 1u);
+
+        if (decompress(in, length, out, size) < 0)
+        {
+            fprintf(stderr, "%s: invalid stream\n", argv[arg]);
+            return 1;
+        }
+        return writeFile(argv[arg + 1], out, size) ? 0 : 1;
+    }
+    else
+    {
+        Buffer_t packed = compress(in, length, windowBits);
+        uint8_t *check  = malloc(length + 1u);
+
+        if (decompress(packed.data, packed.length, check, length) != (int64_t)length ||
+            memcmp(check, in, length) != 0)
+        {
+            fprintf(stderr, "internal error: round trip failed\n");
+            return 1;
+        }
+
+        if (!writeFile(argv[arg + 1], packed.data, packed.length))
+            return 1;
+
+        printf("%s: %u -> %u bytes (%.1f%%)\n", argv[arg + 1], length, packed.length,
+               100.0 * packed.length / (length ? length : 1u));
+    }
+
+    return 0;
+}
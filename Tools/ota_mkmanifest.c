@@ -0,0 +1,247 @@
+/**********************************************************************************************************************
+ * \file ota_mkmanifest.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Linux host tool building the chunk manifest of a firmware image (see Ota_Manifest.h for the format)
+ *
+ * Build:  gcc -O2 -o ota_mkmanifest ota_mkmanifest.c
+ * Usage:  ota_mkmanifest [-c <chunkBits>] [-v <version>] <image.bin> <manifest.bin>
+ *
+ * The manifest is the 56 byte header followed by the chunk hashes. The header holds the Merkle root and is the
+ * part to be signed. The tree is built level by level here, as an independent check of the incremental
+ * computation on the target.
+ *********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define MANIFEST_MAGIC              0x464D3446UL    /* "F4MF" */
+#define MANIFEST_VERSION            1
+#define MANIFEST_HEADER_SIZE        56
+#define MANIFEST_MIN_CHUNK_BITS     10
+#define MANIFEST_MAX_CHUNK_BITS     16
+#define MANIFEST_MAX_CHUNKS         1024
+#define MANIFEST_DEFAULT_CHUNK_BITS 12
+#define DIGEST_SIZE                 32
+
+#define ROTR(x, n)                  (((x) >> (n)) | ((x) << (32 - (n))))
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static const uint32_t g_k[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static void put16(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static uint8_t *readFile(const char *path, uint32_t *length)
+{
+    FILE    *file = fopen(path, "rb");
+    uint8_t *data;
+    long     size;
+
+    if (file == NULL)
+        return NULL;
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    data = malloc((size_t)size + 1u);
+    if (data == NULL || fread(data, 1, (size_t)size, file) != (size_t)size)
+    {
+        fclose(file);
+        free(data);
+        return NULL;
+    }
+
+    fclose(file);
+    *length = (uint32_t)size;
+    return data;
+}
+
+static void sha256Block(uint32_t *state, const uint8_t *block)
+{
+    uint32_t w[64], v[8], i;
+
+    for (i = 0; i < 16; i++)
+        w[i] = ((uint32_t)block[4 * i] << 24) | ((uint32_t)block[4 * i + 1] << 16) |
+               ((uint32_t)block[4 * i + 2] << 8) | block[4 * i + 3];
+    for (i = 16; i < 64; i++)
+        w[i] = w[i - 16] + (ROTR(w[i - 15], 7) ^ ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3)) + w[i - 7] +
+               (ROTR(w[i - 2], 17) ^ ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10));
+
+    memcpy(v, state, sizeof(v));
+    for (i = 0; i < 64; i++)
+    {
+        uint32_t t1 = v[7] + (ROTR(v[4], 6) ^ ROTR(v[4], 11) ^ ROTR(v[4], 25)) + ((v[4] & v[5]) ^ (~v[4] & v[6])) +
+                      g_k[i] + w[i];
+        uint32_t t2 = (ROTR(v[0], 2) ^ ROTR(v[0], 13) ^ ROTR(v[0], 22)) + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+
+        memmove(&v[1], &v[0], 7 * sizeof(uint32_t));
+        v[4] += t1;
+        v[0]  = t1 + t2;
+    }
+
+    for (i = 0; i < 8; i++)
+        state[i] += v[i];
+}
+
+/* SHA-256 of prefix || data */
+static void sha256(uint8_t prefix, const uint8_t *data, uint32_t length, uint8_t *digest)
+{
+    uint32_t state[8] = {0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
+    uint64_t bits     = ((uint64_t)length + 1u) * 8u;
+    uint32_t total    = length + 1u;
+    uint32_t padded   = (total + 8u + 63u) & ~63u;
+    uint8_t *message  = calloc(padded, 1);
+    uint32_t i;
+
+    message[0] = prefix;
+    memcpy(&message[1], data, length);
+    message[total] = 0x80;
+    for (i = 0; i < 8; i++)
+        message[padded - 1 - i] = (uint8_t)(bits >> (8 * i));
+
+    for (i = 0; i < padded; i += 64)
+        sha256Block(state, &message[i]);
+
+    for (i = 0; i < 8; i++)
+    {
+        digest[4 * i]     = (uint8_t)(state[i] >> 24);
+        digest[4 * i + 1] = (uint8_t)(state[i] >> 16);
+        digest[4 * i + 2] = (uint8_t)(state[i] >> 8);
+        digest[4 * i + 3] = (uint8_t)state[i];
+    }
+
+    free(message);
+}
+
+/* Merkle root, level by level; an unpaired last node moves up unchanged */
+static void merkleRoot(const uint8_t *leaves, uint32_t count, uint8_t *root)
+{
+    uint8_t *level = malloc((size_t)count * DIGEST_SIZE);
+
+    memcpy(level, leaves, (size_t)count * DIGEST_SIZE);
+
+    while (count > 1)
+    {
+        uint32_t i, next = 0;
+
+        for (i = 0; i + 1 < count; i += 2)
+            sha256(0x01, &level[i * DIGEST_SIZE], 2 * DIGEST_SIZE, &level[next++ * DIGEST_SIZE]);
+        if (i < count)
+            memmove(&level[next++ * DIGEST_SIZE], &level[i * DIGEST_SIZE], DIGEST_SIZE);
+
+        count = next;
+    }
+
+    memcpy(root, level, DIGEST_SIZE);
+    free(level);
+}
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------------Main--------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv)
+{
+    uint32_t chunkBits = MANIFEST_DEFAULT_CHUNK_BITS;
+    uint32_t version   = 0;
+    uint32_t length, chunkCount, i;
+    uint8_t *image, *manifest;
+    FILE    *file;
+    int      arg = 1;
+
+    while (arg + 1 < argc && argv[arg][0] == '-')
+    {
+        if (strcmp(argv[arg], "-c") == 0)
+            chunkBits = (uint32_t)atoi(argv[arg + 1]);
+        else if (strcmp(argv[arg], "-v") == 0)
+            version = (uint32_t)strtoul(argv[arg + 1], NULL, 0);
+        else
+            break;
+        arg += 2;
+    }
+
+    if (argc - arg != 2 || chunkBits < MANIFEST_MIN_CHUNK_BITS || chunkBits > MANIFEST_MAX_CHUNK_BITS)
+    {
+        fprintf(stderr, "usage: %s [-c <chunkBits %d..%d>] [-v <version>] <image.bin> <manifest.bin>\n", argv[0],
+                MANIFEST_MIN_CHUNK_BITS, MANIFEST_MAX_CHUNK_BITS);
+        return 1;
+    }
+
+    image = readFile(argv[arg], &length);
+    if (image == NULL || length == 0)
+    {
+        fprintf(stderr, "cannot read %s\n", argv[arg]);
+        return 1;
+    }
+
+    chunkCount = (length + (1u << chunkBits) - 1u) >> chunkBits;
+    if (chunkCount > MANIFEST_MAX_CHUNKS)
+    {
+        fprintf(stderr, "%u chunks, at most %d are supported: use larger chunks\n", chunkCount, MANIFEST_MAX_CHUNKS);
+        return 1;
+    }
+
+    manifest = calloc(MANIFEST_HEADER_SIZE + (size_t)chunkCount * DIGEST_SIZE, 1);
+    for (i = 0; i < chunkCount; i++)
+    {
+        uint32_t offset = i << chunkBits;
+        uint32_t n      = (length - offset > (1u << chunkBits)) ? (1u << chunkBits) : length - offset;
+
+        sha256(0x00, &image[offset], n, &manifest[MANIFEST_HEADER_SIZE + i * DIGEST_SIZE]);
+    }
+
+    put32(&manifest[0], MANIFEST_MAGIC);
+    manifest[4] = MANIFEST_VERSION;
+    manifest[5] = (uint8_t)chunkBits;
+    put32(&manifest[8], version);
+    put32(&manifest[12], length);
+    put32(&manifest[16], chunkCount);
+    merkleRoot(&manifest[MANIFEST_HEADER_SIZE], chunkCount, &manifest[24]);
+
+    file = fopen(argv[arg + 1], "wb");
+    if (file == NULL || fwrite(manifest, 1, MANIFEST_HEADER_SIZE + chunkCount * DIGEST_SIZE, file) !=
+                            MANIFEST_HEADER_SIZE + chunkCount * DIGEST_SIZE)
+    {
+        fprintf(stderr, "cannot write %s\n", argv[arg + 1]);
+        return 1;
+    }
+    fclose(file);
+
+    printf("%s: %u chunks of %u bytes, root ", argv[arg + 1], chunkCount, 1u << chunkBits);
+    for (i = 0; i < DIGEST_SIZE; i++)
+        printf("%02x", manifest[24 + i]);
+    printf("\nsign the first %d bytes\n", MANIFEST_HEADER_SIZE);
+
+    return 0;
+}
@@ -0,0 +1,460 @@
+/**********************************************************************************************************************
+ * \file ota_mkpatch.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Linux host tool building a delta patch between two firmware images (see Ota_Patch.h for the format)
+ *
+ * Build:  gcc -O2 -o ota_mkpatch ota_mkpatch.c
+ * Usage:  ota_mkpatch <old.bin> <new.bin> <patch.bin>
+ *         ota_mkpatch -a <old.bin> <patch.bin> <new.bin>
+ *
+ * Matches of at least PATCH_MIN_MATCH bytes are searched through a hash chain over all 8 byte strings of the old
+ * image, preferring the continuation of the previous match. Bytes between two matches become an ADD against the
+ * old image if they replace bytes in place or at least half of them are unchanged (typical for code where only
+ * addresses moved), otherwise an INSERT. ADD diffs are mostly zero and compress well. Every patch is applied again
+ * in memory and checked before it is written.
+ * -a applies a patch on the host.
+ *********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define PATCH_MAGIC                 0x50443446UL    /* "F4DP" */
+#define PATCH_VERSION               1
+#define PATCH_HEADER_SIZE           32
+#define PATCH_OP_END                0x00
+#define PATCH_OP_COPY               0x01
+#define PATCH_OP_ADD                0x02
+#define PATCH_OP_INSERT             0x03
+#define PATCH_MIN_MATCH             12
+#define PATCH_KEY_LENGTH            8
+#define PATCH_HASH_BITS             20
+#define PATCH_MAX_CHAIN             64
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint8_t *data;
+    uint32_t length;
+    uint32_t capacity;
+} Buffer_t;
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* Must match Crc16_Calculate() */
+static uint16_t crc16(const uint8_t *data, uint32_t length)
+{
+    uint16_t crc = 0xFFFF;
+    uint32_t i;
+    int      j;
+
+    for (i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (j = 0; j < 8; j++)
+        {
+            crc = (crc & 1u) ? (uint16_t)((crc >> 1) ^ 0xA001u) : (uint16_t)(crc >> 1);
+        }
+    }
+
+    return crc;
+}
+
+static void put16(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static uint32_t get16(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return get16(p) | (get16(p + 2) << 16);
+}
+
+static uint8_t *readFile(const char *path, uint32_t *length)
+{
+    FILE    *file = fopen(path, "rb");
+    uint8_t *data;
+    long     size;
+
+    if (file == NULL)
+        return NULL;
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    data = malloc((size_t)size + 1u);
+    if (data == NULL || fread(data, 1, (size_t)size, file) != (size_t)size)
+    {
+        fclose(file);
+        free(data);
+        return NULL;
+    }
+
+    fclose(file);
+    *length = (uint32_t)size;
+    return data;
+}
+
+static int writeFile(const char *path, const uint8_t *data, uint32_t length)
+{
+    FILE *file = fopen(path, "wb");
+
+    if (file == NULL || fwrite(data, 1, length, file) != length)
+    {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 0;
+    }
+
+    fclose(file);
+    return 1;
+}
+
+static void emit(Buffer_t *buffer, const uint8_t *data, uint32_t length)
+{
+    if (buffer->length + length > buffer->capacity)
+    {
+        buffer->capacity = (buffer->length + length) * 2u + 256u;
+        buffer->data     = realloc(buffer->data, buffer->capacity);
+    }
+
+    memcpy(&buffer->data[buffer->length], data, length);
+    buffer->length += length;
+}
+
+static void emitVarint(Buffer_t *buffer, uint32_t value)
+{
+    uint8_t byte;
+
+    do
+    {
+        byte    = (uint8_t)(value & 0x7Fu);
+        value >>= 7;
+        if (value != 0u)
+            byte |= 0x80u;
+        emit(buffer, &byte, 1);
+    } while (value != 0u);
+}
+
+static void emitOp(Buffer_t *buffer, uint8_t op, uint32_t length)
+{
+    emit(buffer, &op, 1);
+    emitVarint(buffer, length);
+}
+
+static void emitSeek(Buffer_t *buffer, int64_t seek)
+{
+    emitVarint(buffer, (seek < 0) ? (uint32_t)(((-seek - 1) << 1) | 1) : (uint32_t)(seek << 1));
+}
+
+static uint32_t keyHash(const uint8_t *p)
+{
+    uint64_t key;
+
+    memcpy(&key, p, PATCH_KEY_LENGTH);
+    return (uint32_t)((key * 0x9E3779B97F4A7C15ULL) >> (64 - PATCH_HASH_BITS));
+}
+
+static uint32_t matchLength(const uint8_t *oldData, uint32_t oldSize, uint32_t o, const uint8_t *newData,
+                            uint32_t newSize, uint32_t n)
+{
+    uint32_t length = 0;
+
+    while (o + length < oldSize && n + length < newSize && oldData[o + length] == newData[n + length])
+        length++;
+
+    return length;
+}
+
+/* Bytes between two matches: ADD against the predicted old position if the next match continues right behind
+   it (bytes changed in place) or if mostly unchanged, INSERT otherwise */
+static void emitLiteral(Buffer_t *patch, const uint8_t *oldData, uint32_t oldSize, uint32_t *oldPosition,
+                        const uint8_t *newData, uint32_t start, uint32_t end, int inPlace, uint32_t *stats)
+{
+    uint32_t length = end - start;
+    uint32_t same   = 0;
+    uint32_t i;
+
+    if (length == 0u)
+        return;
+
+    if (*oldPosition + length <= oldSize)
+    {
+        for (i = 0; i < length; i++)
+            same += (oldData[*oldPosition + i] == newData[start + i]) ? 1u : 0u;
+    }
+
+    if ((inPlace || same * 2u >= length) && *oldPosition + length <= oldSize)
+    {
+        emitOp(patch, PATCH_OP_ADD, length);
+        for (i = 0; i < length; i++)
+        {
+            uint8_t diff = (uint8_t)(newData[start + i] - oldData[*oldPosition + i]);
+            emit(patch, &diff, 1);
+        }
+        *oldPosition += length;
+        stats[1]     += length;
+    }
+    else
+    {
+        emitOp(patch, PATCH_OP_INSERT, length);
+        emit(patch, &newData[start], length);
+        stats[2] += length;
+    }
+}
+
+static Buffer_t makePatch(const uint8_t *oldData, uint32_t oldSize, const uint8_t *newData, uint32_t newSize,
+                          uint32_t *stats)
+{
+    Buffer_t  patch       = {NULL, 0, 0};
+    uint32_t *head        = malloc(sizeof(uint32_t) << PATCH_HASH_BITS);
+    uint32_t *chain       = malloc((oldSize + 1u) * sizeof(uint32_t));
+    uint32_t  oldPosition = 0;
+    uint32_t  literal     = 0;
+    uint32_t  n           = 0;
+    uint32_t  i;
+    uint8_t   header[PATCH_HEADER_SIZE] = {0};
+
+    memset(head, 0xFF, sizeof(uint32_t) << PATCH_HASH_BITS);
+    for (i = 0; i + PATCH_KEY_LENGTH <= oldSize; i++)
+    {
+        uint32_t h = keyHash(&oldData[i]);
+
+        chain[i] = head[h];
+        head[h]  = i;
+    }
+
+    emit(&patch, header, PATCH_HEADER_SIZE);
+
+    while (n < newSize)
+    {
+        uint32_t bestLength   = 0;
+        uint32_t bestPosition = 0;
+
+        /* Continuation of the previous match behind the literal bytes first, it needs no seek */
+        if (oldPosition + (n - literal) < oldSize)
+        {
+            bestPosition = oldPosition + (n - literal);
+            bestLength   = matchLength(oldData, oldSize, bestPosition, newData, newSize, n);
+        }
+
+        if (bestLength < PATCH_MIN_MATCH && n + PATCH_KEY_LENGTH <= newSize)
+        {
+            uint32_t candidate = head[keyHash(&newData[n])];
+            uint32_t steps     = 0;
+
+            while (candidate != 0xFFFFFFFFUL && steps++ < PATCH_MAX_CHAIN)
+            {
+                uint32_t length = matchLength(oldData, oldSize, candidate, newData, newSize, n);
+
+                if (length > bestLength)
+                {
+                    bestLength   = length;
+                    bestPosition = candidate;
+                }
+                candidate = chain[candidate];
+            }
+        }
+
+        if (bestLength < PATCH_MIN_MATCH)
+        {
+            n++;
+            continue;
+        }
+
+        emitLiteral(&patch, oldData, oldSize, &oldPosition, newData, literal, n,
+                    bestPosition == oldPosition + (n - literal), stats);
+        emitOp(&patch, PATCH_OP_COPY, bestLength);
+        emitSeek(&patch, (int64_t)bestPosition - (int64_t)oldPosition);
+        oldPosition = bestPosition + bestLength;
+        n          += bestLength;
+        literal     = n;
+        stats[0]   += bestLength;
+    }
+
+    emitLiteral(&patch, oldData, oldSize, &oldPosition, newData, literal, newSize, 0, stats);
+    header[0] = PATCH_OP_END;
+    emit(&patch, header, 1);
+
+    put32(&patch.data[0], PATCH_MAGIC);
+    put16(&patch.data[4], PATCH_VERSION);
+    put16(&patch.data[6], PATCH_HEADER_SIZE);
+    put32(&patch.data[8], oldSize);
+    put32(&patch.data[12], newSize);
+    put16(&patch.data[16], crc16(oldData, oldSize));
+    put16(&patch.data[18], crc16(newData, newSize));
+    put32(&patch.data[20], patch.length);
+    put16(&patch.data[30], crc16(patch.data, PATCH_HEADER_SIZE));
+
+    free(head);
+    free(chain);
+    return patch;
+}
+
+static int getVarint(const uint8_t *patch, uint32_t length, uint32_t *position, uint32_t *value)
+{
+    uint32_t shift = 0;
+
+    *value = 0;
+    while (*position < length && shift <= 28u)
+    {
+        uint8_t byte = patch[(*position)++];
+
+        *value |= (uint32_t)(byte & 0x7Fu) << shift;
+        if ((byte & 0x80u) == 0u)
+            return 1;
+        shift += 7u;
+    }
+
+    return 0;
+}
+
+/* Reference implementation of the applier, returns the new image length or -1 */
+static int64_t applyPatch(const uint8_t *oldData, uint32_t oldSize, const uint8_t *patch, uint32_t patchLength,
+                          uint8_t **newData)
+{
+    uint32_t position    = PATCH_HEADER_SIZE;
+    uint32_t oldPosition = 0;
+    uint32_t produced    = 0;
+    uint32_t newSize;
+    uint8_t *out;
+
+    if (patchLength < PATCH_HEADER_SIZE || get32(patch) != PATCH_MAGIC || get32(&patch[8]) != oldSize ||
+        get16(&patch[16]) != crc16(oldData, oldSize))
+        return -1;
+
+    newSize = get32(&patch[12]);
+    out     = malloc(newSize + 1u);
+
+    while (position < patchLength)
+    {
+        uint8_t  op = patch[position++];
+        uint32_t length, seek, i;
+
+        if (op == PATCH_OP_END)
+            break;
+        if (!getVarint(patch, patchLength, &position, &length) || length > newSize - produced)
+            return -1;
+
+        if (op == PATCH_OP_INSERT)
+        {
+            if (length > patchLength - position)
+                return -1;
+            memcpy(&out[produced], &patch[position], length);
+            position += length;
+        }
+        else
+        {
+            if (op == PATCH_OP_COPY)
+            {
+                if (!getVarint(patch, patchLength, &position, &seek))
+                    return -1;
+                oldPosition = (seek & 1u) ? oldPosition - (seek >> 1) - 1u : oldPosition + (seek >> 1);
+            }
+            if (oldPosition > oldSize || length > oldSize - oldPosition)
+                return -1;
+
+            for (i = 0; i < length; i++)
+            {
+                out[produced + i] = oldData[oldPosition + i];
+                if (op == PATCH_OP_ADD)
+                    out[produced + i] = (uint8_t)(out[produced + i] + patch[position++]);
+            }
+            oldPosition += length;
+        }
+        produced += length;
+    }
+
+    if (produced != newSize || crc16(out, newSize) != get16(&patch[18]))
+        return -1;
+
+    *newData = out;
+    return newSize;
+}
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------------Main--------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv)
+{
+    uint8_t *oldData, *newData, *check;
+    uint32_t oldSize, newSize;
+    uint32_t stats[3] = {0, 0, 0};
+    Buffer_t patch;
+
+    if (argc == 5 && strcmp(argv[1], "-a") == 0)
+    {
+        uint32_t patchLength;
+        uint8_t *patchData = readFile(argv[3], &patchLength);
+        int64_t  length;
+
+        oldData = readFile(argv[2], &oldSize);
+        if (oldData == NULL || patchData == NULL)
+        {
+            fprintf(stderr, "cannot read input\n");
+            return 1;
+        }
+
+        length = applyPatch(oldData, oldSize, patchData, patchLength, &newData);
+        if (length < 0)
+        {
+            fprintf(stderr, "%s: invalid patch or wrong old image\n", argv[3]);
+            return 1;
+        }
+
+        return writeFile(argv[4], newData, (uint32_t)length) ? 0 : 1;
+    }
+
+    if (argc != 4)
+    {
+        fprintf(stderr, "usage: %s <old.bin> <new.bin> <patch.bin>\n       %s -a <old.bin> <patch.bin> <new.bin>\n",
+                argv[0], argv[0]);
+        return 1;
+    }
+
+    oldData = readFile(argv[1], &oldSize);
+    newData = readFile(argv[2], &newSize);
+    if (oldData == NULL || newData == NULL)
+    {
+        fprintf(stderr, "cannot read input\n");
+        return 1;
+    }
+
+    patch = makePatch(oldData, oldSize, newData, newSize, stats);
+
+    if (applyPatch(oldData, oldSize, patch.data, patch.length, &check) != (int64_t)newSize ||
+        memcmp(check, newData, newSize) != 0)
+    {
+        fprintf(stderr, "internal error: patch does not reproduce %s\n", argv[2]);
+        return 1;
+    }
+
+    if (!writeFile(argv[3], patch.data, patch.length))
+        return 1;
+
+    printf("%s: %u bytes (%.1f%% of %u), copied %u, added %u, inserted %u\n", argv[3], patch.length,
+           100.0 * patch.length / (newSize ? newSize : 1u), newSize, stats[0], stats[1], stats[2]);
+    return 0;
+}
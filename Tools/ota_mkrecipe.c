@@ -0,0 +1,342 @@
+/**********************************************************************************************************************
+ * \file ota_mkrecipe.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Linux host tool splitting a firmware image into content-defined chunks and writing its recipe
+ * (see Ota_ChunkStore.h for the format)
+ *
+ * Build:  gcc -O2 -o ota_mkrecipe ota_mkrecipe.c
+ * Usage:  ota_mkrecipe [-v <version>] [-b <base.bin>]... <image.bin> <recipe.bin>
+ *
+ * The recipe is the 88 byte header followed by one (hash, length) reference per chunk. The header holds the image
+ * digest and the digest of the reference list and is the part to be signed. Every -b image is split the same way
+ * and counts as already in the target's chunk store, e.g. the installed version, older versions or images of other
+ * ECUs sharing libraries; the tool reports how much of the new image then still has to be downloaded.
+ *********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define RECIPE_MAGIC                0x52433446UL    /* "F4CR" */
+#define RECIPE_VERSION              1
+#define RECIPE_HEADER_SIZE          88
+#define RECIPE_REF_SIZE             36
+#define MIN_CHUNK                   1024
+#define AVG_CHUNK                   4096
+#define MAX_CHUNK                   16384
+#define MASK_SMALL                  0xFFFC0000UL
+#define MASK_LARGE                  0xFFC00000UL
+#define MAX_BASES                   16
+#define DIGEST_SIZE                 32
+
+#define ROTR(x, n)                  (((x) >> (n)) | ((x) << (32 - (n))))
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Data Structures---------------------------------------------------*/
+/*********************************************************************************************************************/
+typedef struct
+{
+    uint8_t  hash[DIGEST_SIZE];
+    uint32_t offset;
+    uint32_t length;
+} Chunk;
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static const uint32_t g_k[64] = {
+    0x428A2F98, 0x71374491, 0xB5C0FBCF, 0xE9B5DBA5, 0x3956C25B, 0x59F111F1, 0x923F82A4, 0xAB1C5ED5,
+    0xD807AA98, 0x12835B01, 0x243185BE, 0x550C7DC3, 0x72BE5D74, 0x80DEB1FE, 0x9BDC06A7, 0xC19BF174,
+    0xE49B69C1, 0xEFBE4786, 0x0FC19DC6, 0x240CA1CC, 0x2DE92C6F, 0x4A7484AA, 0x5CB0A9DC, 0x76F988DA,
+    0x983E5152, 0xA831C66D, 0xB00327C8, 0xBF597FC7, 0xC6E00BF3, 0xD5A79147, 0x06CA6351, 0x14292967,
+    0x27B70A85, 0x2E1B2138, 0x4D2C6DFC, 0x53380D13, 0x650A7354, 0x766A0ABB, 0x81C2C92E, 0x92722C85,
+    0xA2BFE8A1, 0xA81A664B, 0xC24B8B70, 0xC76C51A3, 0xD192E819, 0xD6990624, 0xF40E3585, 0x106AA070,
+    0x19A4C116, 0x1E376C08, 0x2748774C, 0x34B0BCB5, 0x391C0CB3, 0x4ED8AA4A, 0x5B9CCA4F, 0x682E6FF3,
+    0x748F82EE, 0x78A5636F, 0x84C87814, 0x8CC70208, 0x90BEFFFA, 0xA4506CEB, 0xBEF9A3F7, 0xC67178F2
+};
+
+static uint32_t g_gear[256];
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+static void put16(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static uint8_t *readFile(const char *path, uint32_t *length)
+{
+    FILE    *file = fopen(path, "rb");
+    uint8_t *data;
+    long     size;
+
+    if (file == NULL)
+        return NULL;
+
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    data = malloc((size_t)size + 1u);
+    if (data == NULL || fread(data, 1, (size_t)size, file) != (size_t)size)
+    {
+        fclose(file);
+        free(data);
+        return NULL;
+    }
+
+    fclose(file);
+    *length = (uint32_t)size;
+    return data;
+}
+
+static void sha256Block(uint32_t *state, const uint8_t *block)
+{
+    uint32_t w[64], v[8], i;
+
+    for (i = 0; i < 16; i++)
+        w[i] = ((uint32_t)block[4 * i] << 24) | ((uint32_t)block[4 * i + 1] << 16) |
+               ((uint32_t)block[4 * i + 2] << 8) | block[4 * i + 3];
+    for (i = 16; i < 64; i++)
+        w[i] = w[i - 16] + (ROTR(w[i - 15], 7) ^ ROTR(w[i - 15], 18) ^ (w[i - 15] >> 3)) + w[i - 7] +
+               (ROTR(w[i - 2], 17) ^ ROTR(w[i - 2], 19) ^ (w[i - 2] >> 10));
+
+    memcpy(v, state, sizeof(v));
+    for (i = 0; i < 64; i++)
+    {
+        uint32_t t1 = v[7] + (ROTR(v[4], 6) ^ ROTR(v[4], 11) ^ ROTR(v[4], 25)) + ((v[4] & v[5]) ^ (~v[4] & v[6])) +
+                      g_k[i] + w[i];
+        uint32_t t2 = (ROTR(v[0], 2) ^ ROTR(v[0], 13) ^ ROTR(v[0], 22)) + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+
+        memmove(&v[1], &v[0], 7 * sizeof(uint32_t));
+        v[4] += t1;
+        v[0]  = t1 + t2;
+    }
+
+    for (i = 0; i < 8; i++)
+        state[i] += v[i];
+}
+
+static void sha256(const uint8_t *data, uint32_t length, uint8_t *digest)
+{
+    uint32_t state[8] = {0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19};
+    uint64_t bits     = (uint64_t)length * 8u;
+    uint32_t full     = length & ~63u;
+    uint8_t  tail[128] = {0};
+    uint32_t rest     = length - full;
+    uint32_t padded   = (rest + 1u + 8u <= 64u) ? 64u : 128u;
+    uint32_t i;
+
+    for (i = 0; i < full; i += 64)
+        sha256Block(state, &data[i]);
+
+    memcpy(tail, &data[full], rest);
+    tail[rest] = 0x80;
+    for (i = 0; i < 8; i++)
+        tail[padded - 1 - i] = (uint8_t)(bits >> (8 * i));
+    for (i = 0; i < padded; i += 64)
+        sha256Block(state, &tail[i]);
+
+    for (i = 0; i < 8; i++)
+    {
+        digest[4 * i]     = (uint8_t)(state[i] >> 24);
+        digest[4 * i + 1] = (uint8_t)(state[i] >> 16);
+        digest[4 * i + 2] = (uint8_t)(state[i] >> 8);
+        digest[4 * i + 3] = (uint8_t)state[i];
+    }
+}
+
+/* Same gear table and cut rule as Ota_ChunkStore.c */
+static void initGear(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < 256; i++)
+    {
+        uint32_t x = (i + 1u) * 0x9E3779B9u;
+
+        x ^= x >> 16;
+        x *= 0x85EBCA6Bu;
+        x ^= x >> 13;
+        x *= 0xC2B2AE35u;
+        x ^= x >> 16;
+        g_gear[i] = x;
+    }
+}
+
+static uint32_t nextCut(const uint8_t *data, uint32_t length)
+{
+    uint32_t hash = 0;
+    uint32_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        uint32_t n = i + 1;
+
+        hash = (hash << 1) + g_gear[data[i]];
+        if (n >= MAX_CHUNK)
+            return n;
+        if (n >= MIN_CHUNK && (hash & ((n < AVG_CHUNK) ? MASK_SMALL : MASK_LARGE)) == 0)
+            return n;
+    }
+
+    return length;
+}
+
+static Chunk *split(const uint8_t *image, uint32_t length, uint32_t *count)
+{
+    Chunk   *chunks = malloc(((size_t)length / MIN_CHUNK + 1u) * sizeof(Chunk));
+    uint32_t offset = 0;
+
+    *count = 0;
+    while (offset < length)
+    {
+        Chunk *chunk = &chunks[(*count)++];
+
+        chunk->offset = offset;
+        chunk->length = nextCut(&image[offset], length - offset);
+        sha256(&image[offset], chunk->length, chunk->hash);
+        offset += chunk->length;
+    }
+
+    return chunks;
+}
+
+static int compareHash(const void *a, const void *b)
+{
+    return memcmp(a, b, DIGEST_SIZE);
+}
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------------Main--------------------------------------------------------*/
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv)
+{
+    const char *bases[MAX_BASES];
+    uint32_t    baseCount = 0;
+    uint32_t    version   = 0;
+    uint32_t    length, count, known = 0, i;
+    uint8_t    *image, *recipe, *knownHashes;
+    Chunk      *chunks;
+    uint32_t    downloadCount = 0, downloadBytes = 0, uniqueCount = 0;
+    FILE       *file;
+    int         arg = 1;
+
+    while (arg + 1 < argc && argv[arg][0] == '-')
+    {
+        if (strcmp(argv[arg], "-v") == 0)
+            version = (uint32_t)strtoul(argv[arg + 1], NULL, 0);
+        else if (strcmp(argv[arg], "-b") == 0 && baseCount < MAX_BASES)
+            bases[baseCount++] = argv[arg + 1];
+        else
+            break;
+        arg += 2;
+    }
+
+    if (argc - arg != 2)
+    {
+        fprintf(stderr, "usage: %s [-v <version>] [-b <base.bin>]... <image.bin> <recipe.bin>\n", argv[0]);
+        return 1;
+    }
+
+    initGear();
+
+    image = readFile(argv[arg], &length);
+    if (image == NULL || length == 0)
+    {
+        fprintf(stderr, "cannot read %s\n", argv[arg]);
+        return 1;
+    }
+    chunks = split(image, length, &count);
+
+    /* Hashes of the chunks the store already holds */
+    knownHashes = malloc(1);
+    for (i = 0; i < baseCount; i++)
+    {
+        uint32_t baseLength, baseChunkCount, j;
+        uint8_t *base = readFile(bases[i], &baseLength);
+        Chunk   *baseChunks;
+
+        if (base == NULL)
+        {
+            fprintf(stderr, "cannot read %s\n", bases[i]);
+            return 1;
+        }
+
+        baseChunks  = split(base, baseLength, &baseChunkCount);
+        knownHashes = realloc(knownHashes, ((size_t)known + baseChunkCount) * DIGEST_SIZE);
+        for (j = 0; j < baseChunkCount; j++)
+            memcpy(&knownHashes[(size_t)known++ * DIGEST_SIZE], baseChunks[j].hash, DIGEST_SIZE);
+
+        free(baseChunks);
+        free(base);
+    }
+    qsort(knownHashes, known, DIGEST_SIZE, compareHash);
+
+    recipe = calloc(RECIPE_HEADER_SIZE + (size_t)count * RECIPE_REF_SIZE, 1);
+    for (i = 0; i < count; i++)
+    {
+        uint8_t *ref = &recipe[RECIPE_HEADER_SIZE + (size_t)i * RECIPE_REF_SIZE];
+        uint32_t j;
+
+        memcpy(ref, chunks[i].hash, DIGEST_SIZE);
+        put32(&ref[DIGEST_SIZE], chunks[i].length);
+
+        /* A chunk repeated inside the image is stored and downloaded once */
+        for (j = 0; j < i && memcmp(chunks[j].hash, chunks[i].hash, DIGEST_SIZE) != 0; j++)
+            ;
+        if (j < i)
+            continue;
+
+        uniqueCount++;
+        if (bsearch(chunks[i].hash, knownHashes, known, DIGEST_SIZE, compareHash) == NULL)
+        {
+            downloadCount++;
+            downloadBytes += chunks[i].length;
+        }
+    }
+
+    put32(&recipe[0], RECIPE_MAGIC);
+    recipe[4] = RECIPE_VERSION;
+    put32(&recipe[8], version);
+    put32(&recipe[12], length);
+    put32(&recipe[16], count);
+    sha256(image, length, &recipe[24]);
+    sha256(&recipe[RECIPE_HEADER_SIZE], count * RECIPE_REF_SIZE, &recipe[56]);
+
+    file = fopen(argv[arg + 1], "wb");
+    if (file == NULL || fwrite(recipe, 1, RECIPE_HEADER_SIZE + count * RECIPE_REF_SIZE, file) !=
+                            RECIPE_HEADER_SIZE + count * RECIPE_REF_SIZE)
+    {
+        fprintf(stderr, "cannot write %s\n", argv[arg + 1]);
+        return 1;
+    }
+    fclose(file);
+
+    printf("%s: %u bytes in %u chunks (%u distinct, average %u bytes)\n", argv[arg + 1], length, count, uniqueCount,
+           length / count);
+    printf("download: %u chunks, %u bytes (%.1f%% of the image) with %u base image(s)\n", downloadCount,
+           downloadBytes, 100.0 * downloadBytes / length, baseCount);
+    printf("sign the first %d bytes\n", RECIPE_HEADER_SIZE);
+
+    free(recipe);
+    free(knownHashes);
+    free(chunks);
+    free(image);
+    return 0;
+}
@@ -0,0 +1,147 @@
+/**********************************************************************************************************************
+ * \file p256_tables.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * Linux host tool generating the fixed-base table of the ECDSA P-256 verifier (P256_BaseTable.h)
+ *
+ * Build:  gcc -O2 -o p256_tables p256_tables.c -lcrypto
+ * Usage:  p256_tables <P256_BaseTable.h>
+ *
+ * Window j of the table holds the multiples 1 * 16^j * G to 8 * 16^j * G of the base point as affine coordinates
+ * in the Montgomery form of P256.c, least significant word first. The points are computed with OpenSSL, which also
+ * makes the table an independent check of the field arithmetic on the target.
+ *********************************************************************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/obj_mac.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define TABLE_WINDOWS               64
+#define TABLE_ENTRIES               8
+#define FIELD_WORDS                 8
+
+/*********************************************************************************************************************/
+/*----------------------------------------------Static Helper Functions----------------------------------------------*/
+/*********************************************************************************************************************/
+
+/* One coordinate as x * 2^256 mod p in eight words */
+static void writeCoordinate(FILE *out, const BIGNUM *value, const BIGNUM *r, const BIGNUM *p, BN_CTX *ctx,
+                            const char *indent, const char *end)
+{
+    BIGNUM       *mont = BN_new();
+    unsigned char bytes[4 * FIELD_WORDS];
+    uint32_t      word;
+    int           i;
+
+    BN_mod_mul(mont, value, r, p, ctx);
+    BN_bn2lebinpad(mont, bytes, sizeof(bytes));
+    fputs(indent, out);
+    for (i = 0; i < FIELD_WORDS; i++)
+    {
+        word = (uint32_t)bytes[4 * i] | ((uint32_t)bytes[4 * i + 1] << 8) | ((uint32_t)bytes[4 * i + 2] << 16) |
+               ((uint32_t)bytes[4 * i + 3] << 24);
+        fprintf(out, "0x%08XuL%s", (unsigned)word, (i + 1 < FIELD_WORDS) ? ", " : end);
+    }
+    fputc('\n', out);
+    BN_free(mont);
+}
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+int main(int argc, char **argv)
+{
+    EC_GROUP *group;
+    EC_POINT *base;
+    EC_POINT *point;
+    BN_CTX   *ctx;
+    BIGNUM   *p;
+    BIGNUM   *r;
+    BIGNUM   *x;
+    BIGNUM   *y;
+    FILE     *out;
+    int       j;
+    int       k;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "usage: %s <P256_BaseTable.h>\n", argv[0]);
+        return 1;
+    }
+
+    ctx   = BN_CTX_new();
+    group = EC_GROUP_new_by_curve_name(NID_X9_62_prime256v1);
+    base  = EC_POINT_dup(EC_GROUP_get0_generator(group), group);
+    point = EC_POINT_new(group);
+    p     = BN_new();
+    r     = BN_new();
+    x     = BN_new();
+    y     = BN_new();
+    EC_GROUP_get_curve(group, p, NULL, NULL, ctx);
+    BN_set_bit(r, 256);
+    BN_mod(r, r, p, ctx);
+
+    out = fopen(argv[1], "w");
+    if (out == NULL)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fputs("/*****************************************************************************************************"
+          "*****************\n"
+          " * \\file P256_BaseTable.h\n"
+          " * \\copyright Copyright (C) Infineon Technologies AG 2019\n"
+          " *\n"
+          " * Fixed-base table of the ECDSA P-256 verifier, generated by Tools/p256_tables.c, do not edit\n"
+          " * Entry 8 * j + k is (k + 1) * 16^j * G, affine x followed by y in Montgomery form, least significant word "
+          "first.\n"
+          " * Only included by P256.c; being const, the 32 KB are linked into PFlash.\n"
+          " ****************************************************************************************************"
+          "*****************/\n\n"
+          "#ifndef P256_BASETABLE_H_\n"
+          "#define P256_BASETABLE_H_\n\n", out);
+    fprintf(out, "#define P256_BASE_WINDOWS           %d\n", TABLE_WINDOWS);
+    fprintf(out, "#define P256_BASE_ENTRIES           %d\n\n", TABLE_ENTRIES);
+    fprintf(out, "static const uint32 g_p256BaseTable[P256_BASE_WINDOWS * P256_BASE_ENTRIES][%d] = {\n",
+            2 * FIELD_WORDS);
+
+    for (j = 0; j < TABLE_WINDOWS; j++)
+    {
+        fprintf(out, "%s    /* 16^%d * G */\n", (j > 0) ? "\n" : "", j);
+        EC_POINT_copy(point, base);
+        for (k = 0; k < TABLE_ENTRIES; k++)
+        {
+            if (k > 0)
+                EC_POINT_add(group, point, point, base, ctx);
+            EC_POINT_get_affine_coordinates(group, point, x, y, ctx);
+            writeCoordinate(out, x, r, p, ctx, "    {", ",");
+            writeCoordinate(out, y, r, p, ctx, "     ", (j + 1 < TABLE_WINDOWS || k + 1 < TABLE_ENTRIES) ? "}," : "}");
+        }
+
+        /* Next window: 16 times the base of this one */
+        for (k = 0; k < 4; k++)
+            EC_POINT_dbl(group, base, base, ctx);
+    }
+
+    fputs("};\n\n#endif /* P256_BASETABLE_H_ */\n", out);
+    fclose(out);
+
+    BN_free(y);
+    BN_free(x);
+    BN_free(r);
+    BN_free(p);
+    EC_POINT_free(point);
+    EC_POINT_free(base);
+    EC_GROUP_free(group);
+    BN_CTX_free(ctx);
+
+    return 0;
+}
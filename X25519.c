@@ -0,0 +1,100 @@
+/**********************************************************************************************************************
+ * \file X25519.c
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * X25519 Montgomery ladder over the radix 2^25.5 field arithmetic of Fe25519.c
+ *********************************************************************************************************************/
+
+#include "X25519.h"
+#include "Fe25519.h"
+#include <string.h>
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define X25519_A24                  121665          /* (486662 - 2) / 4 */
+
+/*********************************************************************************************************************/
+/*-------------------------------------------------Global variables--------------------------------------------------*/
+/*********************************************************************************************************************/
+static const uint8 g_basePoint[X25519_KEY_SIZE] = {9};
+
+/*********************************************************************************************************************/
+/*---------------------------------------------Function Implementations----------------------------------------------*/
+/*********************************************************************************************************************/
+
+boolean X25519_ScalarMult(uint8 *output, const uint8 *scalar, const uint8 *point)
+{
+    uint8     z[X25519_KEY_SIZE];
+    Fe25519_t x1;
+    Fe25519_t x2;
+    Fe25519_t z2;
+    Fe25519_t x3;
+    Fe25519_t z3;
+    Fe25519_t a;
+    Fe25519_t b;
+    Fe25519_t aa;
+    Fe25519_t bb;
+    Fe25519_t e;
+    uint32    swap = 0;
+    uint32    bit;
+    uint8     zero = 0;
+    sint32    i;
+
+    memcpy(z, scalar, sizeof(z));
+    z[31] = (uint8)((z[31] & 127u) | 64u);
+    z[0] &= 248u;
+
+    Fe25519_FromBytes(x1, point);
+    memset(x2, 0, sizeof(Fe25519_t));
+    memset(z2, 0, sizeof(Fe25519_t));
+    memset(z3, 0, sizeof(Fe25519_t));
+    memcpy(x3, x1, sizeof(Fe25519_t));
+    x2[0] = 1;
+    z3[0] = 1;
+
+    /* RFC 7748 ladder, (x2 : z2) and (x3 : z3) differ by the input point; swaps are deferred to the next bit */
+    for (i = 254; i >= 0; i--)
+    {
+        bit   = (z[i >> 3] >> (i & 7)) & 1u;
+        swap ^= bit;
+        Fe25519_CondSwap(x2, x3, swap);
+        Fe25519_CondSwap(z2, z3, swap);
+        swap = bit;
+
+        Fe25519_Add(a, x2, z2);
+        Fe25519_Sub(b, x2, z2);
+        Fe25519_Square(aa, a);
+        Fe25519_Square(bb, b);
+        Fe25519_Sub(e, aa, bb);
+        Fe25519_Add(x2, x3, z3);            /* C */
+        Fe25519_Sub(z2, x3, z3);            /* D */
+        Fe25519_Mul(z2, z2, a);             /* DA */
+        Fe25519_Mul(x2, x2, b);             /* CB */
+        Fe25519_Add(x3, z2, x2);
+        Fe25519_Square(x3, x3);
+        Fe25519_Sub(z3, z2, x2);
+        Fe25519_Square(z3, z3);
+        Fe25519_Mul(z3, z3, x1);
+        Fe25519_Mul(x2, aa, bb);
+        Fe25519_MulSmall(z2, e, X25519_A24);
+        Fe25519_Add(z2, z2, aa);
+        Fe25519_Mul(z2, z2, e);
+    }
+    Fe25519_CondSwap(x2, x3, swap);
+    Fe25519_CondSwap(z2, z3, swap);
+
+    Fe25519_Invert(z2, z2);
+    Fe25519_Mul(x2, x2, z2);
+    Fe25519_ToBytes(output, x2);
+
+    for (i = 0; i < X25519_KEY_SIZE; i++)
+        zero |= output[i];
+
+    return (zero != 0u) ? TRUE : FALSE;
+}
+
+void X25519_PublicKey(uint8 *publicKey, const uint8 *privateKey)
+{
+    (void)X25519_ScalarMult(publicKey, privateKey, g_basePoint);
+}
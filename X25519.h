@@ -0,0 +1,44 @@
+/**********************************************************************************************************************
+ * \file X25519.h
+ * \copyright Copyright (C) Infineon Technologies AG 2019
+ *
+ * X25519 Diffie-Hellman (RFC 7748), the classical half of the hybrid key exchange.
+ * The Montgomery ladder runs in constant time: the sequence of operations and memory accesses does not depend on
+ * the scalar. Field elements use the radix 2^25.5 arithmetic of Fe25519.h, a ladder step is five multiplications,
+ * four squarings and one multiplication by a small constant.
+ *********************************************************************************************************************/
+
+#ifndef X25519_H_
+#define X25519_H_
+
+/*********************************************************************************************************************/
+/*-----------------------------------------------------Includes------------------------------------------------------*/
+/*********************************************************************************************************************/
+#include "Ifx_Types.h"
+
+/*********************************************************************************************************************/
+/*------------------------------------------------------Macros-------------------------------------------------------*/
+/*********************************************************************************************************************/
+#define X25519_KEY_SIZE                          32
+
+/*********************************************************************************************************************/
+/*------------------------------------------------Function Prototypes------------------------------------------------*/
+/*********************************************************************************************************************/
+
+/**
+ * \brief Multiply a point by a scalar
+ * \param output u-coordinate of the result, X25519_KEY_SIZE bytes
+ * \param scalar Private key, clamped internally
+ * \param point u-coordinate of the peer public key
+ * \return FALSE if the result is all zero (low order peer point), TRUE otherwise
+ */
+boolean X25519_ScalarMult(uint8 *output, const uint8 *scalar, const uint8 *point);
+
+/**
+ * \brief Derive the public key of a private key
+ * \param publicKey Output, X25519_KEY_SIZE bytes
+ * \param privateKey 32 random bytes
+ */
+void X25519_PublicKey(uint8 *publicKey, const uint8 *privateKey);
+
+#endif /* X25519_H_ */